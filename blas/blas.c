@@ -29,6 +29,8 @@
 #include <gsl/gsl_blas_types.h>
 #include <gsl/gsl_blas.h>
 
+#include "profile.h"
+
 /* ========================================================================
  * Level 1
  * ========================================================================
@@ -47,9 +49,10 @@ gsl_blas_sdsdot (float alpha, const gsl_vector_float * X,
 {
   if (X->size == Y->size)
     {
-      *result =
-        cblas_sdsdot (INT (X->size), alpha, X->data, INT (X->stride), Y->data,
-                      INT (Y->stride));
+      BLAS_PROFILE ("sdsdot", 's', PROFILE_DOT, X->size, 0, 0,
+                    *result = cblas_sdsdot (INT (X->size), alpha, X->data,
+                                            INT (X->stride), Y->data,
+                                            INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -64,9 +67,10 @@ gsl_blas_dsdot (const gsl_vector_float * X, const gsl_vector_float * Y,
 {
   if (X->size == Y->size)
     {
-      *result =
-        cblas_dsdot (INT (X->size), X->data, INT (X->stride), Y->data,
-                     INT (Y->stride));
+      BLAS_PROFILE ("dsdot", 's', PROFILE_DOT, X->size, 0, 0,
+                    *result = cblas_dsdot (INT (X->size), X->data,
+                                           INT (X->stride), Y->data,
+                                           INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -81,9 +85,10 @@ gsl_blas_sdot (const gsl_vector_float * X, const gsl_vector_float * Y,
 {
   if (X->size == Y->size)
     {
-      *result =
-        cblas_sdot (INT (X->size), X->data, INT (X->stride), Y->data,
-                    INT (Y->stride));
+      BLAS_PROFILE ("sdot", 's', PROFILE_DOT, X->size, 0, 0,
+                    *result = cblas_sdot (INT (X->size), X->data,
+                                          INT (X->stride), Y->data,
+                                          INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -97,9 +102,10 @@ gsl_blas_ddot (const gsl_vector * X, const gsl_vector * Y, double *result)
 {
   if (X->size == Y->size)
     {
-      *result =
-        cblas_ddot (INT (X->size), X->data, INT (X->stride), Y->data,
-                    INT (Y->stride));
+      BLAS_PROFILE ("ddot", 'd', PROFILE_DOT, X->size, 0, 0,
+                    *result = cblas_ddot (INT (X->size), X->data,
+                                          INT (X->stride), Y->data,
+                                          INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -115,8 +121,10 @@ gsl_blas_cdotu (const gsl_vector_complex_float * X,
 {
   if (X->size == Y->size)
     {
-      cblas_cdotu_sub (INT (X->size), X->data, INT (X->stride), Y->data,
-                       INT (Y->stride), GSL_COMPLEX_P (dotu));
+      BLAS_PROFILE ("cdotu", 'c', PROFILE_DOT, X->size, 0, 0,
+                    cblas_cdotu_sub (INT (X->size), X->data, INT (X->stride),
+                                     Y->data, INT (Y->stride),
+                                     GSL_COMPLEX_P (dotu)));
       return GSL_SUCCESS;
     }
   else
@@ -132,8 +140,10 @@ gsl_blas_cdotc (const gsl_vector_complex_float * X,
 {
   if (X->size == Y->size)
     {
-      cblas_cdotc_sub (INT (X->size), X->data, INT (X->stride), Y->data,
-                       INT (Y->stride), GSL_COMPLEX_P (dotc));
+      BLAS_PROFILE ("cdotc", 'c', PROFILE_DOT, X->size, 0, 0,
+                    cblas_cdotc_sub (INT (X->size), X->data, INT (X->stride),
+                                     Y->data, INT (Y->stride),
+                                     GSL_COMPLEX_P (dotc)));
       return GSL_SUCCESS;
     }
   else
@@ -149,8 +159,10 @@ gsl_blas_zdotu (const gsl_vector_complex * X, const gsl_vector_complex * Y,
 {
   if (X->size == Y->size)
     {
-      cblas_zdotu_sub (INT (X->size), X->data, INT (X->stride), Y->data,
-                       INT (Y->stride), GSL_COMPLEX_P (dotu));
+      BLAS_PROFILE ("zdotu", 'z', PROFILE_DOT, X->size, 0, 0,
+                    cblas_zdotu_sub (INT (X->size), X->data, INT (X->stride),
+                                     Y->data, INT (Y->stride),
+                                     GSL_COMPLEX_P (dotu)));
       return GSL_SUCCESS;
     }
   else
@@ -166,8 +178,10 @@ gsl_blas_zdotc (const gsl_vector_complex * X, const gsl_vector_complex * Y,
 {
   if (X->size == Y->size)
     {
-      cblas_zdotc_sub (INT (X->size), X->data, INT (X->stride), Y->data,
-                       INT (Y->stride), GSL_COMPLEX_P (dotc));
+      BLAS_PROFILE ("zdotc", 'z', PROFILE_DOT, X->size, 0, 0,
+                    cblas_zdotc_sub (INT (X->size), X->data, INT (X->stride),
+                                     Y->data, INT (Y->stride),
+                                     GSL_COMPLEX_P (dotc)));
       return GSL_SUCCESS;
     }
   else
@@ -181,25 +195,45 @@ gsl_blas_zdotc (const gsl_vector_complex * X, const gsl_vector_complex * Y,
 float
 gsl_blas_snrm2 (const gsl_vector_float * X)
 {
-  return cblas_snrm2 (INT (X->size), X->data, INT (X->stride));
+  float r;
+
+  BLAS_PROFILE ("snrm2", 's', PROFILE_NRM2, X->size, 0, 0,
+                r = cblas_snrm2 (INT (X->size), X->data, INT (X->stride)));
+
+  return r;
 }
 
 double
 gsl_blas_dnrm2 (const gsl_vector * X)
 {
-  return cblas_dnrm2 (INT (X->size), X->data, INT (X->stride));
+  double r;
+
+  BLAS_PROFILE ("dnrm2", 'd', PROFILE_NRM2, X->size, 0, 0,
+                r = cblas_dnrm2 (INT (X->size), X->data, INT (X->stride)));
+
+  return r;
 }
 
 float
 gsl_blas_scnrm2 (const gsl_vector_complex_float * X)
 {
-  return cblas_scnrm2 (INT (X->size), X->data, INT (X->stride));
+  float r;
+
+  BLAS_PROFILE ("scnrm2", 'c', PROFILE_NRM2, X->size, 0, 0,
+                r = cblas_scnrm2 (INT (X->size), X->data, INT (X->stride)));
+
+  return r;
 }
 
 double
 gsl_blas_dznrm2 (const gsl_vector_complex * X)
 {
-  return cblas_dznrm2 (INT (X->size), X->data, INT (X->stride));
+  double r;
+
+  BLAS_PROFILE ("dznrm2", 'z', PROFILE_NRM2, X->size, 0, 0,
+                r = cblas_dznrm2 (INT (X->size), X->data, INT (X->stride)));
+
+  return r;
 }
 
 /* Absolute sums of vectors */
@@ -207,25 +241,45 @@ gsl_blas_dznrm2 (const gsl_vector_complex * X)
 float
 gsl_blas_sasum (const gsl_vector_float * X)
 {
-  return cblas_sasum (INT (X->size), X->data, INT (X->stride));
+  float r;
+
+  BLAS_PROFILE ("sasum", 's', PROFILE_ASUM, X->size, 0, 0,
+                r = cblas_sasum (INT (X->size), X->data, INT (X->stride)));
+
+  return r;
 }
 
 double
 gsl_blas_dasum (const gsl_vector * X)
 {
-  return cblas_dasum (INT (X->size), X->data, INT (X->stride));
+  double r;
+
+  BLAS_PROFILE ("dasum", 'd', PROFILE_ASUM, X->size, 0, 0,
+                r = cblas_dasum (INT (X->size), X->data, INT (X->stride)));
+
+  return r;
 }
 
 float
 gsl_blas_scasum (const gsl_vector_complex_float * X)
 {
-  return cblas_scasum (INT (X->size), X->data, INT (X->stride));
+  float r;
+
+  BLAS_PROFILE ("scasum", 'c', PROFILE_ASUM, X->size, 0, 0,
+                r = cblas_scasum (INT (X->size), X->data, INT (X->stride)));
+
+  return r;
 }
 
 double
 gsl_blas_dzasum (const gsl_vector_complex * X)
 {
-  return cblas_dzasum (INT (X->size), X->data, INT (X->stride));
+  double r;
+
+  BLAS_PROFILE ("dzasum", 'z', PROFILE_ASUM, X->size, 0, 0,
+                r = cblas_dzasum (INT (X->size), X->data, INT (X->stride)));
+
+  return r;
 }
 
 /* Maximum elements of vectors */
@@ -233,25 +287,45 @@ gsl_blas_dzasum (const gsl_vector_complex * X)
 CBLAS_INDEX_t
 gsl_blas_isamax (const gsl_vector_float * X)
 {
-  return cblas_isamax (INT (X->size), X->data, INT (X->stride));
+  CBLAS_INDEX_t r;
+
+  BLAS_PROFILE ("isamax", 's', PROFILE_IAMAX, X->size, 0, 0,
+                r = cblas_isamax (INT (X->size), X->data, INT (X->stride)));
+
+  return r;
 }
 
 CBLAS_INDEX_t
 gsl_blas_idamax (const gsl_vector * X)
 {
-  return cblas_idamax (INT (X->size), X->data, INT (X->stride));
+  CBLAS_INDEX_t r;
+
+  BLAS_PROFILE ("idamax", 'd', PROFILE_IAMAX, X->size, 0, 0,
+                r = cblas_idamax (INT (X->size), X->data, INT (X->stride)));
+
+  return r;
 }
 
 CBLAS_INDEX_t
 gsl_blas_icamax (const gsl_vector_complex_float * X)
 {
-  return cblas_icamax (INT (X->size), X->data, INT (X->stride));
+  CBLAS_INDEX_t r;
+
+  BLAS_PROFILE ("icamax", 'c', PROFILE_IAMAX, X->size, 0, 0,
+                r = cblas_icamax (INT (X->size), X->data, INT (X->stride)));
+
+  return r;
 }
 
 CBLAS_INDEX_t
 gsl_blas_izamax (const gsl_vector_complex * X)
 {
-  return cblas_izamax (INT (X->size), X->data, INT (X->stride));
+  CBLAS_INDEX_t r;
+
+  BLAS_PROFILE ("izamax", 'z', PROFILE_IAMAX, X->size, 0, 0,
+                r = cblas_izamax (INT (X->size), X->data, INT (X->stride)));
+
+  return r;
 }
 
 
@@ -262,8 +336,9 @@ gsl_blas_sswap (gsl_vector_float * X, gsl_vector_float * Y)
 {
   if (X->size == Y->size)
     {
-      cblas_sswap (INT (X->size), X->data, INT (X->stride), Y->data,
-                   INT (Y->stride));
+      BLAS_PROFILE ("sswap", 's', PROFILE_SWAP, X->size, 0, 0,
+                    cblas_sswap (INT (X->size), X->data, INT (X->stride),
+                                 Y->data, INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -277,8 +352,9 @@ gsl_blas_dswap (gsl_vector * X, gsl_vector * Y)
 {
   if (X->size == Y->size)
     {
-      cblas_dswap (INT (X->size), X->data, INT (X->stride), Y->data,
-                   INT (Y->stride));
+      BLAS_PROFILE ("dswap", 'd', PROFILE_SWAP, X->size, 0, 0,
+                    cblas_dswap (INT (X->size), X->data, INT (X->stride),
+                                 Y->data, INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -292,8 +368,9 @@ gsl_blas_cswap (gsl_vector_complex_float * X, gsl_vector_complex_float * Y)
 {
   if (X->size == Y->size)
     {
-      cblas_cswap (INT (X->size), X->data, INT (X->stride), Y->data,
-                   INT (Y->stride));
+      BLAS_PROFILE ("cswap", 'c', PROFILE_SWAP, X->size, 0, 0,
+                    cblas_cswap (INT (X->size), X->data, INT (X->stride),
+                                 Y->data, INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -307,8 +384,9 @@ gsl_blas_zswap (gsl_vector_complex * X, gsl_vector_complex * Y)
 {
   if (X->size == Y->size)
     {
-      cblas_zswap (INT (X->size), X->data, INT (X->stride), Y->data,
-                   INT (Y->stride));
+      BLAS_PROFILE ("zswap", 'z', PROFILE_SWAP, X->size, 0, 0,
+                    cblas_zswap (INT (X->size), X->data, INT (X->stride),
+                                 Y->data, INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -325,8 +403,9 @@ gsl_blas_scopy (const gsl_vector_float * X, gsl_vector_float * Y)
 {
   if (X->size == Y->size)
     {
-      cblas_scopy (INT (X->size), X->data, INT (X->stride), Y->data,
-                   INT (Y->stride));
+      BLAS_PROFILE ("scopy", 's', PROFILE_COPY, X->size, 0, 0,
+                    cblas_scopy (INT (X->size), X->data, INT (X->stride),
+                                 Y->data, INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -340,8 +419,9 @@ gsl_blas_dcopy (const gsl_vector * X, gsl_vector * Y)
 {
   if (X->size == Y->size)
     {
-      cblas_dcopy (INT (X->size), X->data, INT (X->stride), Y->data,
-                   INT (Y->stride));
+      BLAS_PROFILE ("dcopy", 'd', PROFILE_COPY, X->size, 0, 0,
+                    cblas_dcopy (INT (X->size), X->data, INT (X->stride),
+                                 Y->data, INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -356,8 +436,9 @@ gsl_blas_ccopy (const gsl_vector_complex_float * X,
 {
   if (X->size == Y->size)
     {
-      cblas_ccopy (INT (X->size), X->data, INT (X->stride), Y->data,
-                   INT (Y->stride));
+      BLAS_PROFILE ("ccopy", 'c', PROFILE_COPY, X->size, 0, 0,
+                    cblas_ccopy (INT (X->size), X->data, INT (X->stride),
+                                 Y->data, INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -371,8 +452,9 @@ gsl_blas_zcopy (const gsl_vector_complex * X, gsl_vector_complex * Y)
 {
   if (X->size == Y->size)
     {
-      cblas_zcopy (INT (X->size), X->data, INT (X->stride), Y->data,
-                   INT (Y->stride));
+      BLAS_PROFILE ("zcopy", 'z', PROFILE_COPY, X->size, 0, 0,
+                    cblas_zcopy (INT (X->size), X->data, INT (X->stride),
+                                 Y->data, INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -389,8 +471,9 @@ gsl_blas_saxpy (float alpha, const gsl_vector_float * X, gsl_vector_float * Y)
 {
   if (X->size == Y->size)
     {
-      cblas_saxpy (INT (X->size), alpha, X->data, INT (X->stride), Y->data,
-                   INT (Y->stride));
+      BLAS_PROFILE ("saxpy", 's', PROFILE_AXPY, X->size, 0, 0,
+                    cblas_saxpy (INT (X->size), alpha, X->data,
+                                 INT (X->stride), Y->data, INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -404,8 +487,9 @@ gsl_blas_daxpy (double alpha, const gsl_vector * X, gsl_vector * Y)
 {
   if (X->size == Y->size)
     {
-      cblas_daxpy (INT (X->size), alpha, X->data, INT (X->stride), Y->data,
-                   INT (Y->stride));
+      BLAS_PROFILE ("daxpy", 'd', PROFILE_AXPY, X->size, 0, 0,
+                    cblas_daxpy (INT (X->size), alpha, X->data,
+                                 INT (X->stride), Y->data, INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -421,8 +505,10 @@ gsl_blas_caxpy (const gsl_complex_float alpha,
 {
   if (X->size == Y->size)
     {
-      cblas_caxpy (INT (X->size), GSL_COMPLEX_P (&alpha), X->data,
-                   INT (X->stride), Y->data, INT (Y->stride));
+      BLAS_PROFILE ("caxpy", 'c', PROFILE_AXPY, X->size, 0, 0,
+                    cblas_caxpy (INT (X->size), GSL_COMPLEX_P (&alpha),
+                                 X->data, INT (X->stride), Y->data,
+                                 INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -437,8 +523,10 @@ gsl_blas_zaxpy (const gsl_complex alpha, const gsl_vector_complex * X,
 {
   if (X->size == Y->size)
     {
-      cblas_zaxpy (INT (X->size), GSL_COMPLEX_P (&alpha), X->data,
-                   INT (X->stride), Y->data, INT (Y->stride));
+      BLAS_PROFILE ("zaxpy", 'z', PROFILE_AXPY, X->size, 0, 0,
+                    cblas_zaxpy (INT (X->size), GSL_COMPLEX_P (&alpha),
+                                 X->data, INT (X->stride), Y->data,
+                                 INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -452,14 +540,16 @@ gsl_blas_zaxpy (const gsl_complex alpha, const gsl_vector_complex * X,
 int
 gsl_blas_srotg (float a[], float b[], float c[], float s[])
 {
-  cblas_srotg (a, b, c, s);
+  BLAS_PROFILE ("srotg", 's', PROFILE_NONE, 0, 0, 0,
+                cblas_srotg (a, b, c, s));
   return GSL_SUCCESS;
 }
 
 int
 gsl_blas_drotg (double a[], double b[], double c[], double s[])
 {
-  cblas_drotg (a, b, c, s);
+  BLAS_PROFILE ("drotg", 'd', PROFILE_NONE, 0, 0, 0,
+                cblas_drotg (a, b, c, s));
   return GSL_SUCCESS;
 }
 
@@ -470,8 +560,9 @@ gsl_blas_srot (gsl_vector_float * X, gsl_vector_float * Y, float c, float s)
 {
   if (X->size == Y->size)
     {
-      cblas_srot (INT (X->size), X->data, INT (X->stride), Y->data,
-                  INT (Y->stride), c, s);
+      BLAS_PROFILE ("srot", 's', PROFILE_ROT, X->size, 0, 0,
+                    cblas_srot (INT (X->size), X->data, INT (X->stride),
+                                Y->data, INT (Y->stride), c, s));
       return GSL_SUCCESS;
     }
   else
@@ -485,8 +576,9 @@ gsl_blas_drot (gsl_vector * X, gsl_vector * Y, const double c, const double s)
 {
   if (X->size == Y->size)
     {
-      cblas_drot (INT (X->size), X->data, INT (X->stride), Y->data,
-                  INT (Y->stride), c, s);
+      BLAS_PROFILE ("drot", 'd', PROFILE_ROT, X->size, 0, 0,
+                    cblas_drot (INT (X->size), X->data, INT (X->stride),
+                                Y->data, INT (Y->stride), c, s));
       return GSL_SUCCESS;
     }
   else
@@ -501,14 +593,16 @@ gsl_blas_drot (gsl_vector * X, gsl_vector * Y, const double c, const double s)
 int
 gsl_blas_srotmg (float d1[], float d2[], float b1[], float b2, float P[])
 {
-  cblas_srotmg (d1, d2, b1, b2, P);
+  BLAS_PROFILE ("srotmg", 's', PROFILE_NONE, 0, 0, 0,
+                cblas_srotmg (d1, d2, b1, b2, P));
   return GSL_SUCCESS;
 }
 
 int
 gsl_blas_drotmg (double d1[], double d2[], double b1[], double b2, double P[])
 {
-  cblas_drotmg (d1, d2, b1, b2, P);
+  BLAS_PROFILE ("drotmg", 'd', PROFILE_NONE, 0, 0, 0,
+                cblas_drotmg (d1, d2, b1, b2, P));
   return GSL_SUCCESS;
 }
 
@@ -520,8 +614,9 @@ gsl_blas_srotm (gsl_vector_float * X, gsl_vector_float * Y, const float P[])
 {
   if (X->size == Y->size)
     {
-      cblas_srotm (INT (X->size), X->data, INT (X->stride), Y->data,
-                   INT (Y->stride), P);
+      BLAS_PROFILE ("srotm", 's', PROFILE_ROT, X->size, 0, 0,
+                    cblas_srotm (INT (X->size), X->data, INT (X->stride),
+                                 Y->data, INT (Y->stride), P));
       return GSL_SUCCESS;
     }
   else
@@ -535,8 +630,9 @@ gsl_blas_drotm (gsl_vector * X, gsl_vector * Y, const double P[])
 {
   if (X->size == Y->size)
     {
-      cblas_drotm (INT (X->size), X->data, INT (X->stride), Y->data,
-                   INT (Y->stride), P);
+      BLAS_PROFILE ("drotm", 'd', PROFILE_ROT, X->size, 0, 0,
+                    cblas_drotm (INT (X->size), X->data, INT (X->stride),
+                                 Y->data, INT (Y->stride), P));
       return GSL_SUCCESS;
     }
   else
@@ -551,39 +647,221 @@ gsl_blas_drotm (gsl_vector * X, gsl_vector * Y, const double P[])
 void
 gsl_blas_sscal (float alpha, gsl_vector_float * X)
 {
-  cblas_sscal (INT (X->size), alpha, X->data, INT (X->stride));
+  BLAS_PROFILE ("sscal", 's', PROFILE_SCAL, X->size, 0, 0,
+                cblas_sscal (INT (X->size), alpha, X->data, INT (X->stride)));
 }
 
 void
 gsl_blas_dscal (double alpha, gsl_vector * X)
 {
-  cblas_dscal (INT (X->size), alpha, X->data, INT (X->stride));
+  BLAS_PROFILE ("dscal", 'd', PROFILE_SCAL, X->size, 0, 0,
+                cblas_dscal (INT (X->size), alpha, X->data, INT (X->stride)));
 }
 
 void
 gsl_blas_cscal (const gsl_complex_float alpha, gsl_vector_complex_float * X)
 {
-  cblas_cscal (INT (X->size), GSL_COMPLEX_P (&alpha), X->data,
-               INT (X->stride));
+  BLAS_PROFILE ("cscal", 'c', PROFILE_SCAL, X->size, 0, 0,
+                cblas_cscal (INT (X->size), GSL_COMPLEX_P (&alpha), X->data,
+                             INT (X->stride)));
 }
 
 void
 gsl_blas_zscal (const gsl_complex alpha, gsl_vector_complex * X)
 {
-  cblas_zscal (INT (X->size), GSL_COMPLEX_P (&alpha), X->data,
-               INT (X->stride));
+  BLAS_PROFILE ("zscal", 'z', PROFILE_SCAL, X->size, 0, 0,
+                cblas_zscal (INT (X->size), GSL_COMPLEX_P (&alpha), X->data,
+                             INT (X->stride)));
 }
 
 void
 gsl_blas_csscal (float alpha, gsl_vector_complex_float * X)
 {
-  cblas_csscal (INT (X->size), alpha, X->data, INT (X->stride));
+  BLAS_PROFILE ("csscal", 'c', PROFILE_SCAL, X->size, 0, 0,
+                cblas_csscal (INT (X->size), alpha, X->data, INT (X->stride)));
 }
 
 void
 gsl_blas_zdscal (double alpha, gsl_vector_complex * X)
 {
-  cblas_zdscal (INT (X->size), alpha, X->data, INT (X->stride));
+  BLAS_PROFILE ("zdscal", 'z', PROFILE_SCAL, X->size, 0, 0,
+                cblas_zdscal (INT (X->size), alpha, X->data, INT (X->stride)));
+}
+
+/* Fused operations. These are not part of the BLAS: each one does the
+   work of two consecutive Level 1 calls in a single pass over the
+   vectors, for the inner loops of the iterative solvers where the
+   vectors are too long to stay in cache between calls. They are
+   written directly rather than in terms of CBLAS, with independent
+   partial sums in the unit-stride loops so that the compiler can
+   vectorize them. */
+
+static double
+fused_daxpy_nrm2 (const size_t N, const double alpha, const double *x,
+                  const size_t incX, double *y, const size_t incY)
+{
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  double ssq;
+  size_t i = 0;
+
+  if (incX == 1 && incY == 1)
+    {
+      for (; i + 4 <= N; i += 4)
+        {
+          const double y0 = y[i] + alpha * x[i];
+          const double y1 = y[i + 1] + alpha * x[i + 1];
+          const double y2 = y[i + 2] + alpha * x[i + 2];
+          const double y3 = y[i + 3] + alpha * x[i + 3];
+
+          y[i] = y0;
+          y[i + 1] = y1;
+          y[i + 2] = y2;
+          y[i + 3] = y3;
+
+          s0 += y0 * y0;
+          s1 += y1 * y1;
+          s2 += y2 * y2;
+          s3 += y3 * y3;
+        }
+    }
+
+  for (; i < N; i++)
+    {
+      const double yi = y[i * incY] + alpha * x[i * incX];
+      y[i * incY] = yi;
+      s0 += yi * yi;
+    }
+
+  ssq = (s0 + s1) + (s2 + s3);
+
+  /* the unscaled sum of squares is accurate unless it overflows or the
+     squares of the largest elements underflow; otherwise fall back to
+     the scaled norm of the updated vector. The bound is the one used by
+     cblas_dnrm2 */
+  if (ssq >= N * (GSL_DBL_MIN / GSL_DBL_EPSILON) && ssq <= GSL_DBL_MAX)
+    return sqrt (ssq);
+  else
+    return cblas_dnrm2 (INT (N), y, INT (incY));
+}
+
+static void
+fused_ddot2 (const size_t N, const double *x, const size_t incX,
+             const double *y, const size_t incY, const double *z,
+             const size_t incZ, double *xy, double *xz)
+{
+  double a0 = 0.0, a1 = 0.0, a2 = 0.0, a3 = 0.0;
+  double b0 = 0.0, b1 = 0.0, b2 = 0.0, b3 = 0.0;
+  size_t i = 0;
+
+  if (incX == 1 && incY == 1 && incZ == 1)
+    {
+      for (; i + 4 <= N; i += 4)
+        {
+          a0 += x[i] * y[i];
+          a1 += x[i + 1] * y[i + 1];
+          a2 += x[i + 2] * y[i + 2];
+          a3 += x[i + 3] * y[i + 3];
+
+          b0 += x[i] * z[i];
+          b1 += x[i + 1] * z[i + 1];
+          b2 += x[i + 2] * z[i + 2];
+          b3 += x[i + 3] * z[i + 3];
+        }
+    }
+
+  for (; i < N; i++)
+    {
+      const double xi = x[i * incX];
+      a0 += xi * y[i * incY];
+      b0 += xi * z[i * incZ];
+    }
+
+  *xy = (a0 + a1) + (a2 + a3);
+  *xz = (b0 + b1) + (b2 + b3);
+}
+
+static void
+fused_daxpby (const size_t N, const double alpha, const double *x,
+              const size_t incX, const double beta, double *y,
+              const size_t incY)
+{
+  size_t i;
+
+  /* as in the BLAS, Y is not read when beta = 0 */
+  if (beta == 0.0)
+    {
+      if (incX == 1 && incY == 1)
+        {
+          for (i = 0; i < N; i++)
+            y[i] = alpha * x[i];
+        }
+      else
+        {
+          for (i = 0; i < N; i++)
+            y[i * incY] = alpha * x[i * incX];
+        }
+    }
+  else if (incX == 1 && incY == 1)
+    {
+      for (i = 0; i < N; i++)
+        y[i] = alpha * x[i] + beta * y[i];
+    }
+  else
+    {
+      for (i = 0; i < N; i++)
+        y[i * incY] = alpha * x[i * incX] + beta * y[i * incY];
+    }
+}
+
+int
+gsl_blas_daxpy_nrm2 (double alpha, const gsl_vector * X, gsl_vector * Y,
+                     double *nrm)
+{
+  if (X->size == Y->size)
+    {
+      BLAS_PROFILE ("daxpy_nrm2", 'd', PROFILE_AXPY_NRM2, X->size, 0, 0,
+                    *nrm = fused_daxpy_nrm2 (X->size, alpha, X->data,
+                                             X->stride, Y->data, Y->stride));
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      GSL_ERROR ("invalid length", GSL_EBADLEN);
+    }
+}
+
+int
+gsl_blas_ddot2 (const gsl_vector * X, const gsl_vector * Y,
+                const gsl_vector * Z, double *xy, double *xz)
+{
+  if (X->size == Y->size && X->size == Z->size)
+    {
+      BLAS_PROFILE ("ddot2", 'd', PROFILE_DOT2, X->size, 0, 0,
+                    fused_ddot2 (X->size, X->data, X->stride, Y->data,
+                                 Y->stride, Z->data, Z->stride, xy, xz));
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      GSL_ERROR ("invalid length", GSL_EBADLEN);
+    }
+}
+
+int
+gsl_blas_daxpby (double alpha, const gsl_vector * X, double beta,
+                 gsl_vector * Y)
+{
+  if (X->size == Y->size)
+    {
+      BLAS_PROFILE ("daxpby", 'd', PROFILE_AXPBY, X->size, 0, 0,
+                    fused_daxpby (X->size, alpha, X->data, X->stride, beta,
+                                  Y->data, Y->stride));
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      GSL_ERROR ("invalid length", GSL_EBADLEN);
+    }
 }
 
 /* ===========================================================================
@@ -604,9 +882,11 @@ gsl_blas_sgemv (CBLAS_TRANSPOSE_t TransA, float alpha,
   if ((TransA == CblasNoTrans && N == X->size && M == Y->size)
       || (TransA == CblasTrans && M == X->size && N == Y->size))
     {
-      cblas_sgemv (CblasRowMajor, TransA, INT (M), INT (N), alpha, A->data,
-                   INT (A->tda), X->data, INT (X->stride), beta, Y->data,
-                   INT (Y->stride));
+      BLAS_PROFILE ("sgemv", 's', PROFILE_GEMV, M, N, 0,
+                    cblas_sgemv (CblasRowMajor, TransA, INT (M), INT (N),
+                                 alpha, A->data, INT (A->tda), X->data,
+                                 INT (X->stride), beta, Y->data,
+                                 INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -626,9 +906,11 @@ gsl_blas_dgemv (CBLAS_TRANSPOSE_t TransA, double alpha, const gsl_matrix * A,
   if ((TransA == CblasNoTrans && N == X->size && M == Y->size)
       || (TransA == CblasTrans && M == X->size && N == Y->size))
     {
-      cblas_dgemv (CblasRowMajor, TransA, INT (M), INT (N), alpha, A->data,
-                   INT (A->tda), X->data, INT (X->stride), beta, Y->data,
-                   INT (Y->stride));
+      BLAS_PROFILE ("dgemv", 'd', PROFILE_GEMV, M, N, 0,
+                    cblas_dgemv (CblasRowMajor, TransA, INT (M), INT (N),
+                                 alpha, A->data, INT (A->tda), X->data,
+                                 INT (X->stride), beta, Y->data,
+                                 INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -638,6 +920,40 @@ gsl_blas_dgemv (CBLAS_TRANSPOSE_t TransA, double alpha, const gsl_matrix * A,
 }
 
 
+int
+gsl_blas_dgemv_batch (CBLAS_TRANSPOSE_t TransA, double alpha,
+                      const gsl_matrix * A[], const gsl_vector * X[],
+                      double beta, gsl_vector * Y[], const size_t nbatch)
+{
+  size_t p;
+
+  for (p = 0; p < nbatch; p++)
+    {
+      const size_t M = A[p]->size1;
+      const size_t N = A[p]->size2;
+
+      if (!((TransA == CblasNoTrans && N == X[p]->size && M == Y[p]->size)
+            || (TransA == CblasTrans && M == X[p]->size && N == Y[p]->size)))
+        {
+          GSL_ERROR ("invalid length", GSL_EBADLEN);
+        }
+    }
+
+  for (p = 0; p < nbatch; p++)
+    {
+      BLAS_PROFILE ("dgemv_batch", 'd', PROFILE_GEMV,
+                    A[p]->size1, A[p]->size2, 0,
+                    cblas_dgemv (CblasRowMajor, TransA, INT (A[p]->size1),
+                                 INT (A[p]->size2), alpha, A[p]->data,
+                                 INT (A[p]->tda), X[p]->data,
+                                 INT (X[p]->stride), beta, Y[p]->data,
+                                 INT (Y[p]->stride)));
+    }
+
+  return GSL_SUCCESS;
+}
+
+
 int
 gsl_blas_cgemv (CBLAS_TRANSPOSE_t TransA, const gsl_complex_float alpha,
                 const gsl_matrix_complex_float * A,
@@ -651,10 +967,12 @@ gsl_blas_cgemv (CBLAS_TRANSPOSE_t TransA, const gsl_complex_float alpha,
       || (TransA == CblasTrans && M == X->size && N == Y->size)
       || (TransA == CblasConjTrans && M == X->size && N == Y->size))
     {
-      cblas_cgemv (CblasRowMajor, TransA, INT (M), INT (N),
-                   GSL_COMPLEX_P (&alpha), A->data, INT (A->tda), X->data,
-                   INT (X->stride), GSL_COMPLEX_P (&beta), Y->data,
-                   INT (Y->stride));
+      BLAS_PROFILE ("cgemv", 'c', PROFILE_GEMV, M, N, 0,
+                    cblas_cgemv (CblasRowMajor, TransA, INT (M), INT (N),
+                                 GSL_COMPLEX_P (&alpha), A->data, INT (A->tda),
+                                 X->data, INT (X->stride),
+                                 GSL_COMPLEX_P (&beta), Y->data,
+                                 INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -676,10 +994,12 @@ gsl_blas_zgemv (CBLAS_TRANSPOSE_t TransA, const gsl_complex alpha,
       || (TransA == CblasTrans && M == X->size && N == Y->size)
       || (TransA == CblasConjTrans && M == X->size && N == Y->size))
     {
-      cblas_zgemv (CblasRowMajor, TransA, INT (M), INT (N),
-                   GSL_COMPLEX_P (&alpha), A->data, INT (A->tda), X->data,
-                   INT (X->stride), GSL_COMPLEX_P (&beta), Y->data,
-                   INT (Y->stride));
+      BLAS_PROFILE ("zgemv", 'z', PROFILE_GEMV, M, N, 0,
+                    cblas_zgemv (CblasRowMajor, TransA, INT (M), INT (N),
+                                 GSL_COMPLEX_P (&alpha), A->data, INT (A->tda),
+                                 X->data, INT (X->stride),
+                                 GSL_COMPLEX_P (&beta), Y->data,
+                                 INT (Y->stride)));
       return GSL_SUCCESS;
     }
   else
@@ -710,9 +1030,11 @@ gsl_blas_chemv (CBLAS_UPLO_t Uplo, const gsl_complex_float alpha,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_chemv (CblasRowMajor, Uplo, INT (N), GSL_COMPLEX_P (&alpha), A->data,
-               INT (A->tda), X->data, INT (X->stride), GSL_COMPLEX_P (&beta),
-               Y->data, INT (Y->stride));
+  BLAS_PROFILE ("chemv", 'c', PROFILE_SYMV, N, 0, 0,
+                cblas_chemv (CblasRowMajor, Uplo, INT (N),
+                             GSL_COMPLEX_P (&alpha), A->data, INT (A->tda),
+                             X->data, INT (X->stride), GSL_COMPLEX_P (&beta),
+                             Y->data, INT (Y->stride)));
   return GSL_SUCCESS;
 }
 
@@ -733,9 +1055,11 @@ gsl_blas_zhemv (CBLAS_UPLO_t Uplo, const gsl_complex alpha,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_zhemv (CblasRowMajor, Uplo, INT (N), GSL_COMPLEX_P (&alpha), A->data,
-               INT (A->tda), X->data, INT (X->stride), GSL_COMPLEX_P (&beta),
-               Y->data, INT (Y->stride));
+  BLAS_PROFILE ("zhemv", 'z', PROFILE_SYMV, N, 0, 0,
+                cblas_zhemv (CblasRowMajor, Uplo, INT (N),
+                             GSL_COMPLEX_P (&alpha), A->data, INT (A->tda),
+                             X->data, INT (X->stride), GSL_COMPLEX_P (&beta),
+                             Y->data, INT (Y->stride)));
   return GSL_SUCCESS;
 }
 
@@ -758,8 +1082,10 @@ gsl_blas_ssymv (CBLAS_UPLO_t Uplo, float alpha, const gsl_matrix_float * A,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_ssymv (CblasRowMajor, Uplo, INT (N), alpha, A->data, INT (A->tda),
-               X->data, INT (X->stride), beta, Y->data, INT (Y->stride));
+  BLAS_PROFILE ("ssymv", 's', PROFILE_SYMV, N, 0, 0,
+                cblas_ssymv (CblasRowMajor, Uplo, INT (N), alpha, A->data,
+                             INT (A->tda), X->data, INT (X->stride), beta,
+                             Y->data, INT (Y->stride)));
   return GSL_SUCCESS;
 }
 
@@ -779,8 +1105,10 @@ gsl_blas_dsymv (CBLAS_UPLO_t Uplo, double alpha, const gsl_matrix * A,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_dsymv (CblasRowMajor, Uplo, INT (N), alpha, A->data, INT (A->tda),
-               X->data, INT (X->stride), beta, Y->data, INT (Y->stride));
+  BLAS_PROFILE ("dsymv", 'd', PROFILE_SYMV, N, 0, 0,
+                cblas_dsymv (CblasRowMajor, Uplo, INT (N), alpha, A->data,
+                             INT (A->tda), X->data, INT (X->stride), beta,
+                             Y->data, INT (Y->stride)));
   return GSL_SUCCESS;
 }
 
@@ -804,8 +1132,9 @@ gsl_blas_strmv (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t TransA,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_strmv (CblasRowMajor, Uplo, TransA, Diag, INT (N), A->data,
-               INT (A->tda), X->data, INT (X->stride));
+  BLAS_PROFILE ("strmv", 's', PROFILE_TRMV, N, 0, 0,
+                cblas_strmv (CblasRowMajor, Uplo, TransA, Diag, INT (N),
+                             A->data, INT (A->tda), X->data, INT (X->stride)));
   return GSL_SUCCESS;
 }
 
@@ -826,8 +1155,9 @@ gsl_blas_dtrmv (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t TransA,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_dtrmv (CblasRowMajor, Uplo, TransA, Diag, INT (N), A->data,
-               INT (A->tda), X->data, INT (X->stride));
+  BLAS_PROFILE ("dtrmv", 'd', PROFILE_TRMV, N, 0, 0,
+                cblas_dtrmv (CblasRowMajor, Uplo, TransA, Diag, INT (N),
+                             A->data, INT (A->tda), X->data, INT (X->stride)));
   return GSL_SUCCESS;
 }
 
@@ -849,8 +1179,9 @@ gsl_blas_ctrmv (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t TransA,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_ctrmv (CblasRowMajor, Uplo, TransA, Diag, INT (N), A->data,
-               INT (A->tda), X->data, INT (X->stride));
+  BLAS_PROFILE ("ctrmv", 'c', PROFILE_TRMV, N, 0, 0,
+                cblas_ctrmv (CblasRowMajor, Uplo, TransA, Diag, INT (N),
+                             A->data, INT (A->tda), X->data, INT (X->stride)));
   return GSL_SUCCESS;
 }
 
@@ -872,8 +1203,9 @@ gsl_blas_ztrmv (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t TransA,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_ztrmv (CblasRowMajor, Uplo, TransA, Diag, INT (N), A->data,
-               INT (A->tda), X->data, INT (X->stride));
+  BLAS_PROFILE ("ztrmv", 'z', PROFILE_TRMV, N, 0, 0,
+                cblas_ztrmv (CblasRowMajor, Uplo, TransA, Diag, INT (N),
+                             A->data, INT (A->tda), X->data, INT (X->stride)));
   return GSL_SUCCESS;
 }
 
@@ -897,8 +1229,9 @@ gsl_blas_strsv (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t TransA,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_strsv (CblasRowMajor, Uplo, TransA, Diag, INT (N), A->data,
-               INT (A->tda), X->data, INT (X->stride));
+  BLAS_PROFILE ("strsv", 's', PROFILE_TRMV, N, 0, 0,
+                cblas_strsv (CblasRowMajor, Uplo, TransA, Diag, INT (N),
+                             A->data, INT (A->tda), X->data, INT (X->stride)));
   return GSL_SUCCESS;
 }
 
@@ -919,8 +1252,9 @@ gsl_blas_dtrsv (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t TransA,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_dtrsv (CblasRowMajor, Uplo, TransA, Diag, INT (N), A->data,
-               INT (A->tda), X->data, INT (X->stride));
+  BLAS_PROFILE ("dtrsv", 'd', PROFILE_TRMV, N, 0, 0,
+                cblas_dtrsv (CblasRowMajor, Uplo, TransA, Diag, INT (N),
+                             A->data, INT (A->tda), X->data, INT (X->stride)));
   return GSL_SUCCESS;
 }
 
@@ -942,8 +1276,9 @@ gsl_blas_ctrsv (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t TransA,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_ctrsv (CblasRowMajor, Uplo, TransA, Diag, INT (N), A->data,
-               INT (A->tda), X->data, INT (X->stride));
+  BLAS_PROFILE ("ctrsv", 'c', PROFILE_TRMV, N, 0, 0,
+                cblas_ctrsv (CblasRowMajor, Uplo, TransA, Diag, INT (N),
+                             A->data, INT (A->tda), X->data, INT (X->stride)));
   return GSL_SUCCESS;
 }
 
@@ -965,8 +1300,9 @@ gsl_blas_ztrsv (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t TransA,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_ztrsv (CblasRowMajor, Uplo, TransA, Diag, INT (N), A->data,
-               INT (A->tda), X->data, INT (X->stride));
+  BLAS_PROFILE ("ztrsv", 'z', PROFILE_TRMV, N, 0, 0,
+                cblas_ztrsv (CblasRowMajor, Uplo, TransA, Diag, INT (N),
+                             A->data, INT (A->tda), X->data, INT (X->stride)));
   return GSL_SUCCESS;
 }
 
@@ -982,9 +1318,10 @@ gsl_blas_sger (float alpha, const gsl_vector_float * X,
 
   if (X->size == M && Y->size == N)
     {
-      cblas_sger (CblasRowMajor, INT (M), INT (N), alpha, X->data,
-                  INT (X->stride), Y->data, INT (Y->stride), A->data,
-                  INT (A->tda));
+      BLAS_PROFILE ("sger", 's', PROFILE_GER, M, N, 0,
+                    cblas_sger (CblasRowMajor, INT (M), INT (N), alpha,
+                                X->data, INT (X->stride), Y->data,
+                                INT (Y->stride), A->data, INT (A->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1003,9 +1340,10 @@ gsl_blas_dger (double alpha, const gsl_vector * X, const gsl_vector * Y,
 
   if (X->size == M && Y->size == N)
     {
-      cblas_dger (CblasRowMajor, INT (M), INT (N), alpha, X->data,
-                  INT (X->stride), Y->data, INT (Y->stride), A->data,
-                  INT (A->tda));
+      BLAS_PROFILE ("dger", 'd', PROFILE_GER, M, N, 0,
+                    cblas_dger (CblasRowMajor, INT (M), INT (N), alpha,
+                                X->data, INT (X->stride), Y->data,
+                                INT (Y->stride), A->data, INT (A->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1028,9 +1366,11 @@ gsl_blas_cgeru (const gsl_complex_float alpha,
 
   if (X->size == M && Y->size == N)
     {
-      cblas_cgeru (CblasRowMajor, INT (M), INT (N), GSL_COMPLEX_P (&alpha),
-                   X->data, INT (X->stride), Y->data, INT (Y->stride),
-                   A->data, INT (A->tda));
+      BLAS_PROFILE ("cgeru", 'c', PROFILE_GER, M, N, 0,
+                    cblas_cgeru (CblasRowMajor, INT (M), INT (N),
+                                 GSL_COMPLEX_P (&alpha), X->data,
+                                 INT (X->stride), Y->data, INT (Y->stride),
+                                 A->data, INT (A->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1048,9 +1388,11 @@ gsl_blas_zgeru (const gsl_complex alpha, const gsl_vector_complex * X,
 
   if (X->size == M && Y->size == N)
     {
-      cblas_zgeru (CblasRowMajor, INT (M), INT (N), GSL_COMPLEX_P (&alpha),
-                   X->data, INT (X->stride), Y->data, INT (Y->stride),
-                   A->data, INT (A->tda));
+      BLAS_PROFILE ("zgeru", 'z', PROFILE_GER, M, N, 0,
+                    cblas_zgeru (CblasRowMajor, INT (M), INT (N),
+                                 GSL_COMPLEX_P (&alpha), X->data,
+                                 INT (X->stride), Y->data, INT (Y->stride),
+                                 A->data, INT (A->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1073,9 +1415,11 @@ gsl_blas_cgerc (const gsl_complex_float alpha,
 
   if (X->size == M && Y->size == N)
     {
-      cblas_cgerc (CblasRowMajor, INT (M), INT (N), GSL_COMPLEX_P (&alpha),
-                   X->data, INT (X->stride), Y->data, INT (Y->stride),
-                   A->data, INT (A->tda));
+      BLAS_PROFILE ("cgerc", 'c', PROFILE_GER, M, N, 0,
+                    cblas_cgerc (CblasRowMajor, INT (M), INT (N),
+                                 GSL_COMPLEX_P (&alpha), X->data,
+                                 INT (X->stride), Y->data, INT (Y->stride),
+                                 A->data, INT (A->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1094,9 +1438,11 @@ gsl_blas_zgerc (const gsl_complex alpha, const gsl_vector_complex * X,
 
   if (X->size == M && Y->size == N)
     {
-      cblas_zgerc (CblasRowMajor, INT (M), INT (N), GSL_COMPLEX_P (&alpha),
-                   X->data, INT (X->stride), Y->data, INT (Y->stride),
-                   A->data, INT (A->tda));
+      BLAS_PROFILE ("zgerc", 'z', PROFILE_GER, M, N, 0,
+                    cblas_zgerc (CblasRowMajor, INT (M), INT (N),
+                                 GSL_COMPLEX_P (&alpha), X->data,
+                                 INT (X->stride), Y->data, INT (Y->stride),
+                                 A->data, INT (A->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1124,8 +1470,9 @@ gsl_blas_cher (CBLAS_UPLO_t Uplo, float alpha,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_cher (CblasRowMajor, Uplo, INT (M), alpha, X->data, INT (X->stride),
-              A->data, INT (A->tda));
+  BLAS_PROFILE ("cher", 'c', PROFILE_SYR, M, 0, 0,
+                cblas_cher (CblasRowMajor, Uplo, INT (M), alpha, X->data,
+                            INT (X->stride), A->data, INT (A->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1146,8 +1493,9 @@ gsl_blas_zher (CBLAS_UPLO_t Uplo, double alpha, const gsl_vector_complex * X,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_zher (CblasRowMajor, Uplo, INT (N), alpha, X->data, INT (X->stride),
-              A->data, INT (A->tda));
+  BLAS_PROFILE ("zher", 'z', PROFILE_SYR, N, 0, 0,
+                cblas_zher (CblasRowMajor, Uplo, INT (N), alpha, X->data,
+                            INT (X->stride), A->data, INT (A->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1172,9 +1520,10 @@ gsl_blas_cher2 (CBLAS_UPLO_t Uplo, const gsl_complex_float alpha,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_cher2 (CblasRowMajor, Uplo, INT (N), GSL_COMPLEX_P (&alpha), X->data,
-               INT (X->stride), Y->data, INT (Y->stride), A->data,
-               INT (A->tda));
+  BLAS_PROFILE ("cher2", 'c', PROFILE_SYR2, N, 0, 0,
+                cblas_cher2 (CblasRowMajor, Uplo, INT (N),
+                             GSL_COMPLEX_P (&alpha), X->data, INT (X->stride),
+                             Y->data, INT (Y->stride), A->data, INT (A->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1196,9 +1545,10 @@ gsl_blas_zher2 (CBLAS_UPLO_t Uplo, const gsl_complex alpha,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_zher2 (CblasRowMajor, Uplo, INT (N), GSL_COMPLEX_P (&alpha), X->data,
-               INT (X->stride), Y->data, INT (Y->stride), A->data,
-               INT (A->tda));
+  BLAS_PROFILE ("zher2", 'z', PROFILE_SYR2, N, 0, 0,
+                cblas_zher2 (CblasRowMajor, Uplo, INT (N),
+                             GSL_COMPLEX_P (&alpha), X->data, INT (X->stride),
+                             Y->data, INT (Y->stride), A->data, INT (A->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1221,8 +1571,9 @@ gsl_blas_ssyr (CBLAS_UPLO_t Uplo, float alpha, const gsl_vector_float * X,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_ssyr (CblasRowMajor, Uplo, INT (N), alpha, X->data, INT (X->stride),
-              A->data, INT (A->tda));
+  BLAS_PROFILE ("ssyr", 's', PROFILE_SYR, N, 0, 0,
+                cblas_ssyr (CblasRowMajor, Uplo, INT (N), alpha, X->data,
+                            INT (X->stride), A->data, INT (A->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1243,8 +1594,9 @@ gsl_blas_dsyr (CBLAS_UPLO_t Uplo, double alpha, const gsl_vector * X,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_dsyr (CblasRowMajor, Uplo, INT (N), alpha, X->data, INT (X->stride),
-              A->data, INT (A->tda));
+  BLAS_PROFILE ("dsyr", 'd', PROFILE_SYR, N, 0, 0,
+                cblas_dsyr (CblasRowMajor, Uplo, INT (N), alpha, X->data,
+                            INT (X->stride), A->data, INT (A->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1267,8 +1619,10 @@ gsl_blas_ssyr2 (CBLAS_UPLO_t Uplo, float alpha, const gsl_vector_float * X,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_ssyr2 (CblasRowMajor, Uplo, INT (N), alpha, X->data, INT (X->stride),
-               Y->data, INT (Y->stride), A->data, INT (A->tda));
+  BLAS_PROFILE ("ssyr2", 's', PROFILE_SYR2, N, 0, 0,
+                cblas_ssyr2 (CblasRowMajor, Uplo, INT (N), alpha, X->data,
+                             INT (X->stride), Y->data, INT (Y->stride),
+                             A->data, INT (A->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1289,8 +1643,10 @@ gsl_blas_dsyr2 (CBLAS_UPLO_t Uplo, double alpha, const gsl_vector * X,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_dsyr2 (CblasRowMajor, Uplo, INT (N), alpha, X->data, INT (X->stride),
-               Y->data, INT (Y->stride), A->data, INT (A->tda));
+  BLAS_PROFILE ("dsyr2", 'd', PROFILE_SYR2, N, 0, 0,
+                cblas_dsyr2 (CblasRowMajor, Uplo, INT (N), alpha, X->data,
+                             INT (X->stride), Y->data, INT (Y->stride),
+                             A->data, INT (A->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1318,9 +1674,11 @@ gsl_blas_sgemm (CBLAS_TRANSPOSE_t TransA, CBLAS_TRANSPOSE_t TransB,
 
   if (M == MA && N == NB && NA == MB)   /* [MxN] = [MAxNA][MBxNB] */
     {
-      cblas_sgemm (CblasRowMajor, TransA, TransB, INT (M), INT (N), INT (NA),
-                   alpha, A->data, INT (A->tda), B->data, INT (B->tda), beta,
-                   C->data, INT (C->tda));
+      BLAS_PROFILE ("sgemm", 's', PROFILE_GEMM, M, N, NA,
+                    cblas_sgemm (CblasRowMajor, TransA, TransB, INT (M),
+                                 INT (N), INT (NA), alpha, A->data,
+                                 INT (A->tda), B->data, INT (B->tda), beta,
+                                 C->data, INT (C->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1344,9 +1702,11 @@ gsl_blas_dgemm (CBLAS_TRANSPOSE_t TransA, CBLAS_TRANSPOSE_t TransB,
 
   if (M == MA && N == NB && NA == MB)   /* [MxN] = [MAxNA][MBxNB] */
     {
-      cblas_dgemm (CblasRowMajor, TransA, TransB, INT (M), INT (N), INT (NA),
-                   alpha, A->data, INT (A->tda), B->data, INT (B->tda), beta,
-                   C->data, INT (C->tda));
+      BLAS_PROFILE ("dgemm", 'd', PROFILE_GEMM, M, N, NA,
+                    cblas_dgemm (CblasRowMajor, TransA, TransB, INT (M),
+                                 INT (N), INT (NA), alpha, A->data,
+                                 INT (A->tda), B->data, INT (B->tda), beta,
+                                 C->data, INT (C->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1356,6 +1716,46 @@ gsl_blas_dgemm (CBLAS_TRANSPOSE_t TransA, CBLAS_TRANSPOSE_t TransB,
 }
 
 
+int
+gsl_blas_dgemm_batch (CBLAS_TRANSPOSE_t TransA, CBLAS_TRANSPOSE_t TransB,
+                      double alpha, const gsl_matrix * A[],
+                      const gsl_matrix * B[], double beta, gsl_matrix * C[],
+                      const size_t nbatch)
+{
+  size_t p;
+
+  for (p = 0; p < nbatch; p++)
+    {
+      const size_t M = C[p]->size1;
+      const size_t N = C[p]->size2;
+      const size_t MA = (TransA == CblasNoTrans) ? A[p]->size1 : A[p]->size2;
+      const size_t NA = (TransA == CblasNoTrans) ? A[p]->size2 : A[p]->size1;
+      const size_t MB = (TransB == CblasNoTrans) ? B[p]->size1 : B[p]->size2;
+      const size_t NB = (TransB == CblasNoTrans) ? B[p]->size2 : B[p]->size1;
+
+      if (M != MA || N != NB || NA != MB)   /* [MxN] = [MAxNA][MBxNB] */
+        {
+          GSL_ERROR ("invalid length", GSL_EBADLEN);
+        }
+    }
+
+  for (p = 0; p < nbatch; p++)
+    {
+      const size_t K = (TransA == CblasNoTrans) ? A[p]->size2 : A[p]->size1;
+
+      BLAS_PROFILE ("dgemm_batch", 'd', PROFILE_GEMM,
+                    C[p]->size1, C[p]->size2, K,
+                    cblas_dgemm (CblasRowMajor, TransA, TransB,
+                                 INT (C[p]->size1), INT (C[p]->size2), INT (K),
+                                 alpha, A[p]->data, INT (A[p]->tda),
+                                 B[p]->data, INT (B[p]->tda), beta, C[p]->data,
+                                 INT (C[p]->tda)));
+    }
+
+  return GSL_SUCCESS;
+}
+
+
 int
 gsl_blas_cgemm (CBLAS_TRANSPOSE_t TransA, CBLAS_TRANSPOSE_t TransB,
                 const gsl_complex_float alpha,
@@ -1372,10 +1772,12 @@ gsl_blas_cgemm (CBLAS_TRANSPOSE_t TransA, CBLAS_TRANSPOSE_t TransB,
 
   if (M == MA && N == NB && NA == MB)   /* [MxN] = [MAxNA][MBxNB] */
     {
-      cblas_cgemm (CblasRowMajor, TransA, TransB, INT (M), INT (N), INT (NA),
-                   GSL_COMPLEX_P (&alpha), A->data, INT (A->tda), B->data,
-                   INT (B->tda), GSL_COMPLEX_P (&beta), C->data,
-                   INT (C->tda));
+      BLAS_PROFILE ("cgemm", 'c', PROFILE_GEMM, M, N, NA,
+                    cblas_cgemm (CblasRowMajor, TransA, TransB, INT (M),
+                                 INT (N), INT (NA), GSL_COMPLEX_P (&alpha),
+                                 A->data, INT (A->tda), B->data, INT (B->tda),
+                                 GSL_COMPLEX_P (&beta), C->data,
+                                 INT (C->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1400,10 +1802,12 @@ gsl_blas_zgemm (CBLAS_TRANSPOSE_t TransA, CBLAS_TRANSPOSE_t TransB,
 
   if (M == MA && N == NB && NA == MB)   /* [MxN] = [MAxNA][MBxNB] */
     {
-      cblas_zgemm (CblasRowMajor, TransA, TransB, INT (M), INT (N), INT (NA),
-                   GSL_COMPLEX_P (&alpha), A->data, INT (A->tda), B->data,
-                   INT (B->tda), GSL_COMPLEX_P (&beta), C->data,
-                   INT (C->tda));
+      BLAS_PROFILE ("zgemm", 'z', PROFILE_GEMM, M, N, NA,
+                    cblas_zgemm (CblasRowMajor, TransA, TransB, INT (M),
+                                 INT (N), INT (NA), GSL_COMPLEX_P (&alpha),
+                                 A->data, INT (A->tda), B->data, INT (B->tda),
+                                 GSL_COMPLEX_P (&beta), C->data,
+                                 INT (C->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1435,9 +1839,11 @@ gsl_blas_ssymm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo, float alpha,
   if ((Side == CblasLeft && (M == MA && N == NB && NA == MB))
       || (Side == CblasRight && (M == MB && N == NA && NB == MA)))
     {
-      cblas_ssymm (CblasRowMajor, Side, Uplo, INT (M), INT (N), alpha,
-                   A->data, INT (A->tda), B->data, INT (B->tda), beta,
-                   C->data, INT (C->tda));
+      BLAS_PROFILE ("ssymm", 's', PROFILE_SYMM,
+                    M, N, (Side == CblasLeft) ? M : N,
+                    cblas_ssymm (CblasRowMajor, Side, Uplo, INT (M), INT (N),
+                                 alpha, A->data, INT (A->tda), B->data,
+                                 INT (B->tda), beta, C->data, INT (C->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1468,9 +1874,11 @@ gsl_blas_dsymm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo, double alpha,
   if ((Side == CblasLeft && (M == MA && N == NB && NA == MB))
       || (Side == CblasRight && (M == MB && N == NA && NB == MA)))
     {
-      cblas_dsymm (CblasRowMajor, Side, Uplo, INT (M), INT (N), alpha,
-                   A->data, INT (A->tda), B->data, INT (B->tda), beta,
-                   C->data, INT (C->tda));
+      BLAS_PROFILE ("dsymm", 'd', PROFILE_SYMM,
+                    M, N, (Side == CblasLeft) ? M : N,
+                    cblas_dsymm (CblasRowMajor, Side, Uplo, INT (M), INT (N),
+                                 alpha, A->data, INT (A->tda), B->data,
+                                 INT (B->tda), beta, C->data, INT (C->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1502,10 +1910,12 @@ gsl_blas_csymm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
   if ((Side == CblasLeft && (M == MA && N == NB && NA == MB))
       || (Side == CblasRight && (M == MB && N == NA && NB == MA)))
     {
-      cblas_csymm (CblasRowMajor, Side, Uplo, INT (M), INT (N),
-                   GSL_COMPLEX_P (&alpha), A->data, INT (A->tda), B->data,
-                   INT (B->tda), GSL_COMPLEX_P (&beta), C->data,
-                   INT (C->tda));
+      BLAS_PROFILE ("csymm", 'c', PROFILE_SYMM,
+                    M, N, (Side == CblasLeft) ? M : N,
+                    cblas_csymm (CblasRowMajor, Side, Uplo, INT (M), INT (N),
+                                 GSL_COMPLEX_P (&alpha), A->data, INT (A->tda),
+                                 B->data, INT (B->tda), GSL_COMPLEX_P (&beta),
+                                 C->data, INT (C->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1535,10 +1945,12 @@ gsl_blas_zsymm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
   if ((Side == CblasLeft && (M == MA && N == NB && NA == MB))
       || (Side == CblasRight && (M == MB && N == NA && NB == MA)))
     {
-      cblas_zsymm (CblasRowMajor, Side, Uplo, INT (M), INT (N),
-                   GSL_COMPLEX_P (&alpha), A->data, INT (A->tda), B->data,
-                   INT (B->tda), GSL_COMPLEX_P (&beta), C->data,
-                   INT (C->tda));
+      BLAS_PROFILE ("zsymm", 'z', PROFILE_SYMM,
+                    M, N, (Side == CblasLeft) ? M : N,
+                    cblas_zsymm (CblasRowMajor, Side, Uplo, INT (M), INT (N),
+                                 GSL_COMPLEX_P (&alpha), A->data, INT (A->tda),
+                                 B->data, INT (B->tda), GSL_COMPLEX_P (&beta),
+                                 C->data, INT (C->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1572,10 +1984,12 @@ gsl_blas_chemm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
   if ((Side == CblasLeft && (M == MA && N == NB && NA == MB))
       || (Side == CblasRight && (M == MB && N == NA && NB == MA)))
     {
-      cblas_chemm (CblasRowMajor, Side, Uplo, INT (M), INT (N),
-                   GSL_COMPLEX_P (&alpha), A->data, INT (A->tda), B->data,
-                   INT (B->tda), GSL_COMPLEX_P (&beta), C->data,
-                   INT (C->tda));
+      BLAS_PROFILE ("chemm", 'c', PROFILE_SYMM,
+                    M, N, (Side == CblasLeft) ? M : N,
+                    cblas_chemm (CblasRowMajor, Side, Uplo, INT (M), INT (N),
+                                 GSL_COMPLEX_P (&alpha), A->data, INT (A->tda),
+                                 B->data, INT (B->tda), GSL_COMPLEX_P (&beta),
+                                 C->data, INT (C->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1607,10 +2021,12 @@ gsl_blas_zhemm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
   if ((Side == CblasLeft && (M == MA && N == NB && NA == MB))
       || (Side == CblasRight && (M == MB && N == NA && NB == MA)))
     {
-      cblas_zhemm (CblasRowMajor, Side, Uplo, INT (M), INT (N),
-                   GSL_COMPLEX_P (&alpha), A->data, INT (A->tda), B->data,
-                   INT (B->tda), GSL_COMPLEX_P (&beta), C->data,
-                   INT (C->tda));
+      BLAS_PROFILE ("zhemm", 'z', PROFILE_SYMM,
+                    M, N, (Side == CblasLeft) ? M : N,
+                    cblas_zhemm (CblasRowMajor, Side, Uplo, INT (M), INT (N),
+                                 GSL_COMPLEX_P (&alpha), A->data, INT (A->tda),
+                                 B->data, INT (B->tda), GSL_COMPLEX_P (&beta),
+                                 C->data, INT (C->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1639,8 +2055,10 @@ gsl_blas_ssyrk (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t Trans, float alpha,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_ssyrk (CblasRowMajor, Uplo, Trans, INT (N), INT (K), alpha, A->data,
-               INT (A->tda), beta, C->data, INT (C->tda));
+  BLAS_PROFILE ("ssyrk", 's', PROFILE_SYRK, N, N, K,
+                cblas_ssyrk (CblasRowMajor, Uplo, Trans, INT (N), INT (K),
+                             alpha, A->data, INT (A->tda), beta, C->data,
+                             INT (C->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1663,8 +2081,10 @@ gsl_blas_dsyrk (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t Trans, double alpha,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_dsyrk (CblasRowMajor, Uplo, Trans, INT (N), INT (K), alpha, A->data,
-               INT (A->tda), beta, C->data, INT (C->tda));
+  BLAS_PROFILE ("dsyrk", 'd', PROFILE_SYRK, N, N, K,
+                cblas_dsyrk (CblasRowMajor, Uplo, Trans, INT (N), INT (K),
+                             alpha, A->data, INT (A->tda), beta, C->data,
+                             INT (C->tda)));
   return GSL_SUCCESS;
 
 }
@@ -1690,9 +2110,10 @@ gsl_blas_csyrk (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t Trans,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_csyrk (CblasRowMajor, Uplo, Trans, INT (N), INT (K),
-               GSL_COMPLEX_P (&alpha), A->data, INT (A->tda),
-               GSL_COMPLEX_P (&beta), C->data, INT (C->tda));
+  BLAS_PROFILE ("csyrk", 'c', PROFILE_SYRK, N, N, K,
+                cblas_csyrk (CblasRowMajor, Uplo, Trans, INT (N), INT (K),
+                             GSL_COMPLEX_P (&alpha), A->data, INT (A->tda),
+                             GSL_COMPLEX_P (&beta), C->data, INT (C->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1716,9 +2137,10 @@ gsl_blas_zsyrk (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t Trans,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_zsyrk (CblasRowMajor, Uplo, Trans, INT (N), INT (K),
-               GSL_COMPLEX_P (&alpha), A->data, INT (A->tda),
-               GSL_COMPLEX_P (&beta), C->data, INT (C->tda));
+  BLAS_PROFILE ("zsyrk", 'z', PROFILE_SYRK, N, N, K,
+                cblas_zsyrk (CblasRowMajor, Uplo, Trans, INT (N), INT (K),
+                             GSL_COMPLEX_P (&alpha), A->data, INT (A->tda),
+                             GSL_COMPLEX_P (&beta), C->data, INT (C->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1743,8 +2165,10 @@ gsl_blas_cherk (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t Trans, float alpha,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_cherk (CblasRowMajor, Uplo, Trans, INT (N), INT (K), alpha, A->data,
-               INT (A->tda), beta, C->data, INT (C->tda));
+  BLAS_PROFILE ("cherk", 'c', PROFILE_SYRK, N, N, K,
+                cblas_cherk (CblasRowMajor, Uplo, Trans, INT (N), INT (K),
+                             alpha, A->data, INT (A->tda), beta, C->data,
+                             INT (C->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1768,8 +2192,10 @@ gsl_blas_zherk (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t Trans, double alpha,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_zherk (CblasRowMajor, Uplo, Trans, INT (N), INT (K), alpha, A->data,
-               INT (A->tda), beta, C->data, INT (C->tda));
+  BLAS_PROFILE ("zherk", 'z', PROFILE_SYRK, N, N, K,
+                cblas_zherk (CblasRowMajor, Uplo, Trans, INT (N), INT (K),
+                             alpha, A->data, INT (A->tda), beta, C->data,
+                             INT (C->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1796,9 +2222,10 @@ gsl_blas_ssyr2k (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t Trans, float alpha,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_ssyr2k (CblasRowMajor, Uplo, Trans, INT (N), INT (NA), alpha, A->data,
-                INT (A->tda), B->data, INT (B->tda), beta, C->data,
-                INT (C->tda));
+  BLAS_PROFILE ("ssyr2k", 's', PROFILE_SYR2K, N, N, NA,
+                cblas_ssyr2k (CblasRowMajor, Uplo, Trans, INT (N), INT (NA),
+                              alpha, A->data, INT (A->tda), B->data,
+                              INT (B->tda), beta, C->data, INT (C->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1824,9 +2251,10 @@ gsl_blas_dsyr2k (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t Trans, double alpha,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_dsyr2k (CblasRowMajor, Uplo, Trans, INT (N), INT (NA), alpha, A->data,
-                INT (A->tda), B->data, INT (B->tda), beta, C->data,
-                INT (C->tda));
+  BLAS_PROFILE ("dsyr2k", 'd', PROFILE_SYR2K, N, N, NA,
+                cblas_dsyr2k (CblasRowMajor, Uplo, Trans, INT (N), INT (NA),
+                              alpha, A->data, INT (A->tda), B->data,
+                              INT (B->tda), beta, C->data, INT (C->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1854,9 +2282,11 @@ gsl_blas_csyr2k (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t Trans,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_csyr2k (CblasRowMajor, Uplo, Trans, INT (N), INT (NA),
-                GSL_COMPLEX_P (&alpha), A->data, INT (A->tda), B->data,
-                INT (B->tda), GSL_COMPLEX_P (&beta), C->data, INT (C->tda));
+  BLAS_PROFILE ("csyr2k", 'c', PROFILE_SYR2K, N, N, NA,
+                cblas_csyr2k (CblasRowMajor, Uplo, Trans, INT (N), INT (NA),
+                              GSL_COMPLEX_P (&alpha), A->data, INT (A->tda),
+                              B->data, INT (B->tda), GSL_COMPLEX_P (&beta),
+                              C->data, INT (C->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1884,9 +2314,11 @@ gsl_blas_zsyr2k (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t Trans,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_zsyr2k (CblasRowMajor, Uplo, Trans, INT (N), INT (NA),
-                GSL_COMPLEX_P (&alpha), A->data, INT (A->tda), B->data,
-                INT (B->tda), GSL_COMPLEX_P (&beta), C->data, INT (C->tda));
+  BLAS_PROFILE ("zsyr2k", 'z', PROFILE_SYR2K, N, N, NA,
+                cblas_zsyr2k (CblasRowMajor, Uplo, Trans, INT (N), INT (NA),
+                              GSL_COMPLEX_P (&alpha), A->data, INT (A->tda),
+                              B->data, INT (B->tda), GSL_COMPLEX_P (&beta),
+                              C->data, INT (C->tda)));
   return GSL_SUCCESS;
 }
 
@@ -1915,9 +2347,11 @@ gsl_blas_cher2k (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t Trans,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_cher2k (CblasRowMajor, Uplo, Trans, INT (N), INT (NA),
-                GSL_COMPLEX_P (&alpha), A->data, INT (A->tda), B->data,
-                INT (B->tda), beta, C->data, INT (C->tda));
+  BLAS_PROFILE ("cher2k", 'c', PROFILE_SYR2K, N, N, NA,
+                cblas_cher2k (CblasRowMajor, Uplo, Trans, INT (N), INT (NA),
+                              GSL_COMPLEX_P (&alpha), A->data, INT (A->tda),
+                              B->data, INT (B->tda), beta, C->data,
+                              INT (C->tda)));
   return GSL_SUCCESS;
 
 }
@@ -1945,9 +2379,11 @@ gsl_blas_zher2k (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t Trans,
       GSL_ERROR ("invalid length", GSL_EBADLEN);
     }
 
-  cblas_zher2k (CblasRowMajor, Uplo, Trans, INT (N), INT (NA),
-                GSL_COMPLEX_P (&alpha), A->data, INT (A->tda), B->data,
-                INT (B->tda), beta, C->data, INT (C->tda));
+  BLAS_PROFILE ("zher2k", 'z', PROFILE_SYR2K, N, N, NA,
+                cblas_zher2k (CblasRowMajor, Uplo, Trans, INT (N), INT (NA),
+                              GSL_COMPLEX_P (&alpha), A->data, INT (A->tda),
+                              B->data, INT (B->tda), beta, C->data,
+                              INT (C->tda)));
   return GSL_SUCCESS;
 
 }
@@ -1971,8 +2407,11 @@ gsl_blas_strmm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
 
   if ((Side == CblasLeft && M == MA) || (Side == CblasRight && N == MA))
     {
-      cblas_strmm (CblasRowMajor, Side, Uplo, TransA, Diag, INT (M), INT (N),
-                   alpha, A->data, INT (A->tda), B->data, INT (B->tda));
+      BLAS_PROFILE ("strmm", 's', PROFILE_TRMM,
+                    M, N, (Side == CblasLeft) ? M : N,
+                    cblas_strmm (CblasRowMajor, Side, Uplo, TransA, Diag,
+                                 INT (M), INT (N), alpha, A->data,
+                                 INT (A->tda), B->data, INT (B->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -1999,8 +2438,11 @@ gsl_blas_dtrmm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
 
   if ((Side == CblasLeft && M == MA) || (Side == CblasRight && N == MA))
     {
-      cblas_dtrmm (CblasRowMajor, Side, Uplo, TransA, Diag, INT (M), INT (N),
-                   alpha, A->data, INT (A->tda), B->data, INT (B->tda));
+      BLAS_PROFILE ("dtrmm", 'd', PROFILE_TRMM,
+                    M, N, (Side == CblasLeft) ? M : N,
+                    cblas_dtrmm (CblasRowMajor, Side, Uplo, TransA, Diag,
+                                 INT (M), INT (N), alpha, A->data,
+                                 INT (A->tda), B->data, INT (B->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -2029,9 +2471,12 @@ gsl_blas_ctrmm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
 
   if ((Side == CblasLeft && M == MA) || (Side == CblasRight && N == MA))
     {
-      cblas_ctrmm (CblasRowMajor, Side, Uplo, TransA, Diag, INT (M), INT (N),
-                   GSL_COMPLEX_P (&alpha), A->data, INT (A->tda), B->data,
-                   INT (B->tda));
+      BLAS_PROFILE ("ctrmm", 'c', PROFILE_TRMM,
+                    M, N, (Side == CblasLeft) ? M : N,
+                    cblas_ctrmm (CblasRowMajor, Side, Uplo, TransA, Diag,
+                                 INT (M), INT (N), GSL_COMPLEX_P (&alpha),
+                                 A->data, INT (A->tda), B->data,
+                                 INT (B->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -2059,9 +2504,12 @@ gsl_blas_ztrmm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
 
   if ((Side == CblasLeft && M == MA) || (Side == CblasRight && N == MA))
     {
-      cblas_ztrmm (CblasRowMajor, Side, Uplo, TransA, Diag, INT (M), INT (N),
-                   GSL_COMPLEX_P (&alpha), A->data, INT (A->tda), B->data,
-                   INT (B->tda));
+      BLAS_PROFILE ("ztrmm", 'z', PROFILE_TRMM,
+                    M, N, (Side == CblasLeft) ? M : N,
+                    cblas_ztrmm (CblasRowMajor, Side, Uplo, TransA, Diag,
+                                 INT (M), INT (N), GSL_COMPLEX_P (&alpha),
+                                 A->data, INT (A->tda), B->data,
+                                 INT (B->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -2090,8 +2538,11 @@ gsl_blas_strsm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
 
   if ((Side == CblasLeft && M == MA) || (Side == CblasRight && N == MA))
     {
-      cblas_strsm (CblasRowMajor, Side, Uplo, TransA, Diag, INT (M), INT (N),
-                   alpha, A->data, INT (A->tda), B->data, INT (B->tda));
+      BLAS_PROFILE ("strsm", 's', PROFILE_TRMM,
+                    M, N, (Side == CblasLeft) ? M : N,
+                    cblas_strsm (CblasRowMajor, Side, Uplo, TransA, Diag,
+                                 INT (M), INT (N), alpha, A->data,
+                                 INT (A->tda), B->data, INT (B->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -2118,8 +2569,11 @@ gsl_blas_dtrsm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
 
   if ((Side == CblasLeft && M == MA) || (Side == CblasRight && N == MA))
     {
-      cblas_dtrsm (CblasRowMajor, Side, Uplo, TransA, Diag, INT (M), INT (N),
-                   alpha, A->data, INT (A->tda), B->data, INT (B->tda));
+      BLAS_PROFILE ("dtrsm", 'd', PROFILE_TRMM,
+                    M, N, (Side == CblasLeft) ? M : N,
+                    cblas_dtrsm (CblasRowMajor, Side, Uplo, TransA, Diag,
+                                 INT (M), INT (N), alpha, A->data,
+                                 INT (A->tda), B->data, INT (B->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -2129,6 +2583,47 @@ gsl_blas_dtrsm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
 }
 
 
+int
+gsl_blas_dtrsm_batch (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
+                      CBLAS_TRANSPOSE_t TransA, CBLAS_DIAG_t Diag,
+                      double alpha, const gsl_matrix * A[], gsl_matrix * B[],
+                      const size_t nbatch)
+{
+  size_t p;
+
+  for (p = 0; p < nbatch; p++)
+    {
+      const size_t M = B[p]->size1;
+      const size_t N = B[p]->size2;
+      const size_t MA = A[p]->size1;
+      const size_t NA = A[p]->size2;
+
+      if (MA != NA)
+        {
+          GSL_ERROR ("matrix A must be square", GSL_ENOTSQR);
+        }
+
+      if (!((Side == CblasLeft && M == MA) || (Side == CblasRight && N == MA)))
+        {
+          GSL_ERROR ("invalid length", GSL_EBADLEN);
+        }
+    }
+
+  for (p = 0; p < nbatch; p++)
+    {
+      BLAS_PROFILE ("dtrsm_batch", 'd', PROFILE_TRMM,
+                    B[p]->size1, B[p]->size2,
+                    (Side == CblasLeft) ? B[p]->size1 : B[p]->size2,
+                    cblas_dtrsm (CblasRowMajor, Side, Uplo, TransA, Diag,
+                                 INT (B[p]->size1), INT (B[p]->size2), alpha,
+                                 A[p]->data, INT (A[p]->tda), B[p]->data,
+                                 INT (B[p]->tda)));
+    }
+
+  return GSL_SUCCESS;
+}
+
+
 int
 gsl_blas_ctrsm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
                 CBLAS_TRANSPOSE_t TransA, CBLAS_DIAG_t Diag,
@@ -2148,9 +2643,12 @@ gsl_blas_ctrsm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
 
   if ((Side == CblasLeft && M == MA) || (Side == CblasRight && N == MA))
     {
-      cblas_ctrsm (CblasRowMajor, Side, Uplo, TransA, Diag, INT (M), INT (N),
-                   GSL_COMPLEX_P (&alpha), A->data, INT (A->tda), B->data,
-                   INT (B->tda));
+      BLAS_PROFILE ("ctrsm", 'c', PROFILE_TRMM,
+                    M, N, (Side == CblasLeft) ? M : N,
+                    cblas_ctrsm (CblasRowMajor, Side, Uplo, TransA, Diag,
+                                 INT (M), INT (N), GSL_COMPLEX_P (&alpha),
+                                 A->data, INT (A->tda), B->data,
+                                 INT (B->tda)));
       return GSL_SUCCESS;
     }
   else
@@ -2178,9 +2676,12 @@ gsl_blas_ztrsm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
 
   if ((Side == CblasLeft && M == MA) || (Side == CblasRight && N == MA))
     {
-      cblas_ztrsm (CblasRowMajor, Side, Uplo, TransA, Diag, INT (M), INT (N),
-                   GSL_COMPLEX_P (&alpha), A->data, INT (A->tda), B->data,
-                   INT (B->tda));
+      BLAS_PROFILE ("ztrsm", 'z', PROFILE_TRMM,
+                    M, N, (Side == CblasLeft) ? M : N,
+                    cblas_ztrsm (CblasRowMajor, Side, Uplo, TransA, Diag,
+                                 INT (M), INT (N), GSL_COMPLEX_P (&alpha),
+                                 A->data, INT (A->tda), B->data,
+                                 INT (B->tda)));
       return GSL_SUCCESS;
     }
   else
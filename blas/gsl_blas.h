@@ -23,6 +23,7 @@
 #ifndef __GSL_BLAS_H__
 #define __GSL_BLAS_H__
 
+#include <stdio.h>
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_matrix.h>
 
@@ -176,6 +177,23 @@ void gsl_blas_zscal  (const gsl_complex alpha, gsl_vector_complex * X);
 void gsl_blas_csscal (float  alpha, gsl_vector_complex_float * X);
 void gsl_blas_zdscal (double alpha, gsl_vector_complex * X);
 
+/* Fused operations (GSL extensions) */
+
+int  gsl_blas_daxpy_nrm2 (double alpha,
+                          const gsl_vector * X,
+                          gsl_vector * Y,
+                          double * nrm);
+
+int  gsl_blas_ddot2 (const gsl_vector * X,
+                     const gsl_vector * Y,
+                     const gsl_vector * Z,
+                     double * xy, double * xz);
+
+int  gsl_blas_daxpby (double alpha,
+                      const gsl_vector * X,
+                      double beta,
+                      gsl_vector * Y);
+
 
 /* ===========================================================================
  * Level 2
@@ -209,6 +227,14 @@ int  gsl_blas_dgemv (CBLAS_TRANSPOSE_t TransA,
                      double beta,
                      gsl_vector * Y);
 
+int  gsl_blas_dgemv_batch (CBLAS_TRANSPOSE_t TransA,
+                           double alpha,
+                           const gsl_matrix * A[],
+                           const gsl_vector * X[],
+                           double beta,
+                           gsl_vector * Y[],
+                           const size_t nbatch);
+
 int  gsl_blas_dtrmv (CBLAS_UPLO_t Uplo,
                      CBLAS_TRANSPOSE_t TransA, CBLAS_DIAG_t Diag,
                      const gsl_matrix * A,
@@ -420,6 +446,15 @@ int  gsl_blas_dgemm (CBLAS_TRANSPOSE_t TransA,
                      double beta,
                      gsl_matrix * C);
 
+int  gsl_blas_dgemm_batch (CBLAS_TRANSPOSE_t TransA,
+                           CBLAS_TRANSPOSE_t TransB,
+                           double alpha,
+                           const gsl_matrix * A[],
+                           const gsl_matrix * B[],
+                           double beta,
+                           gsl_matrix * C[],
+                           const size_t nbatch);
+
 int  gsl_blas_dsymm (CBLAS_SIDE_t Side,
                      CBLAS_UPLO_t Uplo,
                      double alpha,
@@ -457,6 +492,14 @@ int  gsl_blas_dtrsm (CBLAS_SIDE_t Side,
                      const gsl_matrix * A,
                      gsl_matrix * B);
 
+int  gsl_blas_dtrsm_batch (CBLAS_SIDE_t Side,
+                           CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t TransA,
+                           CBLAS_DIAG_t Diag,
+                           double alpha,
+                           const gsl_matrix * A[],
+                           gsl_matrix * B[],
+                           const size_t nbatch);
+
 int  gsl_blas_cgemm (CBLAS_TRANSPOSE_t TransA,
                      CBLAS_TRANSPOSE_t TransB,
                      const gsl_complex_float alpha,
@@ -596,6 +639,53 @@ int  gsl_blas_zher2k (CBLAS_UPLO_t Uplo,
                       double beta,
                       gsl_matrix_complex * C);
 
+/*
+ * ===========================================================================
+ * Mixed precision (GSL extensions): single precision operands with
+ * double precision accumulation
+ * ===========================================================================
+ */
+
+int  gsl_blas_dsgemv (CBLAS_TRANSPOSE_t TransA,
+                      double alpha,
+                      const gsl_matrix_float * A,
+                      const gsl_vector_float * X,
+                      double beta,
+                      gsl_vector * Y);
+
+int  gsl_blas_sdsgemv (CBLAS_TRANSPOSE_t TransA,
+                       double alpha,
+                       const gsl_matrix_float * A,
+                       const gsl_vector_float * X,
+                       double beta,
+                       gsl_vector_float * Y);
+
+int  gsl_blas_dsgemm (CBLAS_TRANSPOSE_t TransA,
+                      CBLAS_TRANSPOSE_t TransB,
+                      double alpha,
+                      const gsl_matrix_float * A,
+                      const gsl_matrix_float * B,
+                      double beta,
+                      gsl_matrix * C);
+
+int  gsl_blas_sdsgemm (CBLAS_TRANSPOSE_t TransA,
+                       CBLAS_TRANSPOSE_t TransB,
+                       double alpha,
+                       const gsl_matrix_float * A,
+                       const gsl_matrix_float * B,
+                       double beta,
+                       gsl_matrix_float * C);
+
+/*
+ * ===========================================================================
+ * Profiling of the gsl_blas functions
+ * ===========================================================================
+ */
+
+int  gsl_blas_profile_set (const int enable);
+void gsl_blas_profile_reset (void);
+int  gsl_blas_profile_fprintf (FILE * stream);
+
 
 __END_DECLS
 
@@ -0,0 +1,374 @@
+/* blas/mixed.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Mixed precision matrix products: the operands are stored in single
+ * precision and the products are accumulated in double precision, in
+ * the same way as cblas_dsdot and cblas_sdsdot for the inner product.
+ *
+ * The matrix-vector products are written directly, in one pass over
+ * the matrix, since they are limited by the memory bandwidth.
+ *
+ * The matrix-matrix products are done in tiles of C. For each tile the
+ * operands are converted to double precision one slice of the inner
+ * dimension at a time, into buffers small enough to stay in cache, and
+ * each slice is multiplied with cblas_dgemm.  The conversion costs one
+ * pass over a slice of A and B for every tile, which is negligible
+ * compared with the product itself.  Only the standard CBLAS interface
+ * is used, so these functions work with any CBLAS library. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_cblas.h>
+#include <gsl/gsl_blas_types.h>
+#include <gsl/gsl_blas.h>
+
+#include "profile.h"
+
+#define INT(X) ((int)(X))
+
+/* size of the tiles of C, and depth of the slices of A and B */
+#define MIXED_TILE 512
+#define MIXED_KC 256
+
+/* y = alpha op(A) x + beta y, with y in double (yd) or single (yf)
+   precision */
+static int
+mixed_gemv (CBLAS_TRANSPOSE_t TransA, const double alpha,
+            const gsl_matrix_float * A, const gsl_vector_float * X,
+            const double beta, gsl_vector * yd, gsl_vector_float * yf)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  const size_t ny = (yd != NULL) ? yd->size : yf->size;
+  const size_t nx = X->size;
+  const int scale_only = (alpha == 0.0 || M == 0 || N == 0);
+  double *w;
+  size_t i, j;
+
+  if ((TransA == CblasNoTrans && (N != nx || M != ny))
+      || (TransA != CblasNoTrans && (M != nx || N != ny)))
+    {
+      GSL_ERROR ("invalid length", GSL_EBADLEN);
+    }
+
+  w = malloc ((N > 0 ? N : 1) * sizeof (double));
+
+  if (w == NULL)
+    {
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  if (scale_only)
+    {
+      /* A and x are not read */
+    }
+  else if (TransA == CblasNoTrans)
+    {
+      /* w holds x, and each element of y is an inner product with a
+         row of A */
+      for (j = 0; j < N; j++)
+        w[j] = X->data[j * X->stride];
+    }
+  else
+    {
+      /* w accumulates the linear combination of the rows of A */
+      for (j = 0; j < N; j++)
+        w[j] = 0.0;
+
+      for (i = 0; i < M; i++)
+        {
+          const float *a = A->data + i * A->tda;
+          const double xi = X->data[i * X->stride];
+
+          if (xi != 0.0)
+            {
+              for (j = 0; j < N; j++)
+                w[j] += xi * a[j];
+            }
+        }
+    }
+
+  for (i = 0; i < ny; i++)
+    {
+      double t;
+
+      if (scale_only)
+        {
+          t = 0.0;
+        }
+      else if (TransA == CblasNoTrans)
+        {
+          const float *a = A->data + i * A->tda;
+          double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+
+          for (j = 0; j + 4 <= N; j += 4)
+            {
+              s0 += a[j] * w[j];
+              s1 += a[j + 1] * w[j + 1];
+              s2 += a[j + 2] * w[j + 2];
+              s3 += a[j + 3] * w[j + 3];
+            }
+
+          for (; j < N; j++)
+            s0 += a[j] * w[j];
+
+          t = (s0 + s1) + (s2 + s3);
+        }
+      else
+        {
+          t = w[i];
+        }
+
+      t *= alpha;
+
+      if (yd != NULL)
+        {
+          double *y = yd->data + i * yd->stride;
+          *y = (beta == 0.0) ? t : t + beta * (*y);
+        }
+      else
+        {
+          float *y = yf->data + i * yf->stride;
+          *y = (float) ((beta == 0.0) ? t : t + beta * (*y));
+        }
+    }
+
+  free (w);
+
+  return GSL_SUCCESS;
+}
+
+/* copy the n1-by-n2 block of A starting at (i0,j0) into b, with
+   leading dimension n2 */
+static void
+mixed_convert (const gsl_matrix_float * A, const size_t i0, const size_t j0,
+               const size_t n1, const size_t n2, double *b)
+{
+  size_t i, j;
+
+  for (i = 0; i < n1; i++)
+    {
+      const float *a = A->data + (i0 + i) * A->tda + j0;
+
+      for (j = 0; j < n2; j++)
+        b[i * n2 + j] = a[j];
+    }
+}
+
+/* C = alpha op(A) op(B) + beta C, with C in double (Cd) or single (Cf)
+   precision */
+static int
+mixed_gemm (CBLAS_TRANSPOSE_t TransA, CBLAS_TRANSPOSE_t TransB,
+            const double alpha, const gsl_matrix_float * A,
+            const gsl_matrix_float * B, const double beta, gsl_matrix * Cd,
+            gsl_matrix_float * Cf)
+{
+  const size_t M = (Cd != NULL) ? Cd->size1 : Cf->size1;
+  const size_t N = (Cd != NULL) ? Cd->size2 : Cf->size2;
+  const size_t MA = (TransA == CblasNoTrans) ? A->size1 : A->size2;
+  const size_t NA = (TransA == CblasNoTrans) ? A->size2 : A->size1;
+  const size_t MB = (TransB == CblasNoTrans) ? B->size1 : B->size2;
+  const size_t NB = (TransB == CblasNoTrans) ? B->size2 : B->size1;
+  const size_t K = NA;
+  double *work, *Ab, *Bb, *Ct;
+  size_t i0, j0, p0, i, j;
+
+  if (M != MA || N != NB || NA != MB)   /* [MxN] = [MAxNA][MBxNB] */
+    {
+      GSL_ERROR ("invalid length", GSL_EBADLEN);
+    }
+
+  if (M == 0 || N == 0)
+    return GSL_SUCCESS;
+
+  if (alpha == 0.0 || K == 0)
+    {
+      /* C = beta C; C is not read when beta is zero */
+      for (i = 0; i < M; i++)
+        {
+          for (j = 0; j < N; j++)
+            {
+              if (Cd != NULL)
+                {
+                  double *c = Cd->data + i * Cd->tda + j;
+                  *c = (beta == 0.0) ? 0.0 : beta * (*c);
+                }
+              else
+                {
+                  float *c = Cf->data + i * Cf->tda + j;
+                  *c = (float) ((beta == 0.0) ? 0.0 : beta * (*c));
+                }
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+
+  {
+    const size_t tm = GSL_MIN (MIXED_TILE, M);
+    const size_t tn = GSL_MIN (MIXED_TILE, N);
+    const size_t tk = GSL_MIN (MIXED_KC, K);
+
+    work = malloc ((tm * tk + tk * tn + ((Cf != NULL) ? tm * tn : 0))
+                   * sizeof (double));
+
+    if (work == NULL)
+      {
+        GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+      }
+
+    Ab = work;
+    Bb = Ab + tm * tk;
+    Ct = Bb + tk * tn;
+  }
+
+  for (i0 = 0; i0 < M; i0 += MIXED_TILE)
+    {
+      const size_t mb = GSL_MIN (MIXED_TILE, M - i0);
+
+      for (j0 = 0; j0 < N; j0 += MIXED_TILE)
+        {
+          const size_t nb = GSL_MIN (MIXED_TILE, N - j0);
+          double *c;
+          size_t ldc;
+
+          /* a single precision tile is accumulated in Ct and rounded
+             once at the end */
+          if (Cd != NULL)
+            {
+              c = Cd->data + i0 * Cd->tda + j0;
+              ldc = Cd->tda;
+            }
+          else
+            {
+              c = Ct;
+              ldc = nb;
+
+              for (i = 0; i < mb; i++)
+                for (j = 0; j < nb; j++)
+                  Ct[i * nb + j] = (beta == 0.0) ? 0.0
+                    : Cf->data[(i0 + i) * Cf->tda + j0 + j];
+            }
+
+          for (p0 = 0; p0 < K; p0 += MIXED_KC)
+            {
+              const size_t kb = GSL_MIN (MIXED_KC, K - p0);
+              size_t lda, ldb;
+
+              /* the slices keep the layout of A and B, and are passed
+                 to dgemm with the same transpose flags */
+              if (TransA == CblasNoTrans)
+                {
+                  mixed_convert (A, i0, p0, mb, kb, Ab);
+                  lda = kb;
+                }
+              else
+                {
+                  mixed_convert (A, p0, i0, kb, mb, Ab);
+                  lda = mb;
+                }
+
+              if (TransB == CblasNoTrans)
+                {
+                  mixed_convert (B, p0, j0, kb, nb, Bb);
+                  ldb = nb;
+                }
+              else
+                {
+                  mixed_convert (B, j0, p0, nb, kb, Bb);
+                  ldb = kb;
+                }
+
+              cblas_dgemm (CblasRowMajor, TransA, TransB, INT (mb), INT (nb),
+                           INT (kb), alpha, Ab, INT (lda), Bb, INT (ldb),
+                           (p0 == 0) ? beta : 1.0, c, INT (ldc));
+            }
+
+          if (Cf != NULL)
+            {
+              for (i = 0; i < mb; i++)
+                for (j = 0; j < nb; j++)
+                  Cf->data[(i0 + i) * Cf->tda + j0 + j] = (float) Ct[i * nb + j];
+            }
+        }
+    }
+
+  free (work);
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_blas_dsgemv (CBLAS_TRANSPOSE_t TransA, double alpha,
+                 const gsl_matrix_float * A, const gsl_vector_float * X,
+                 double beta, gsl_vector * Y)
+{
+  int status;
+
+  BLAS_PROFILE ("dsgemv", 's', PROFILE_GEMV, A->size1, A->size2, 0,
+                status = mixed_gemv (TransA, alpha, A, X, beta, Y, NULL));
+
+  return status;
+}
+
+int
+gsl_blas_sdsgemv (CBLAS_TRANSPOSE_t TransA, double alpha,
+                  const gsl_matrix_float * A, const gsl_vector_float * X,
+                  double beta, gsl_vector_float * Y)
+{
+  int status;
+
+  BLAS_PROFILE ("sdsgemv", 's', PROFILE_GEMV, A->size1, A->size2, 0,
+                status = mixed_gemv (TransA, alpha, A, X, beta, NULL, Y));
+
+  return status;
+}
+
+int
+gsl_blas_dsgemm (CBLAS_TRANSPOSE_t TransA, CBLAS_TRANSPOSE_t TransB,
+                 double alpha, const gsl_matrix_float * A,
+                 const gsl_matrix_float * B, double beta, gsl_matrix * C)
+{
+  const size_t K = (TransA == CblasNoTrans) ? A->size2 : A->size1;
+  int status;
+
+  BLAS_PROFILE ("dsgemm", 's', PROFILE_GEMM, C->size1, C->size2, K,
+                status = mixed_gemm (TransA, TransB, alpha, A, B, beta, C,
+                                     NULL));
+
+  return status;
+}
+
+int
+gsl_blas_sdsgemm (CBLAS_TRANSPOSE_t TransA, CBLAS_TRANSPOSE_t TransB,
+                  double alpha, const gsl_matrix_float * A,
+                  const gsl_matrix_float * B, double beta,
+                  gsl_matrix_float * C)
+{
+  const size_t K = (TransA == CblasNoTrans) ? A->size2 : A->size1;
+  int status;
+
+  BLAS_PROFILE ("sdsgemm", 's', PROFILE_GEMM, C->size1, C->size2, K,
+                status = mixed_gemm (TransA, TransB, alpha, A, B, beta, NULL,
+                                     C));
+
+  return status;
+}
@@ -0,0 +1,538 @@
+/* blas/profile.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Profiler for the gsl_blas functions.
+ *
+ * When profiling is on, each call is timed and counted, together with
+ * an estimate of the floating point operations and of the memory
+ * traffic computed from its dimensions, and a histogram of its largest
+ * dimension in powers of two.  When it is off, the only cost is a test
+ * of gsl_blas_profile_flag in each function.
+ *
+ * Each thread accumulates its counts in its own table, so that the
+ * counters are not shared between threads.  The tables are kept after
+ * the threads exit and are summed when the report is printed.  Each
+ * table has its own lock, which is taken by its thread for every
+ * update and by gsl_blas_profile_reset and gsl_blas_profile_fprintf,
+ * so that it is only contended while the counters are reset or
+ * printed.
+ *
+ * Profiling is turned on by the environment variable GSL_BLAS_PROFILE,
+ * read at the first call, or by gsl_blas_profile_set.  When it is
+ * turned on by the environment the report is printed at exit, to
+ * stderr if the value is 1 and otherwise to the file it names.
+ */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_blas.h>
+#include "profile.h"
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+#define PROFILE_MAX_ROUTINES 256
+
+/* histogram bins of the largest dimension: bin b counts dimensions
+   below 2^(b+1), and the last bin all larger dimensions */
+#define PROFILE_NBINS 16
+
+typedef struct
+{
+  unsigned long calls;
+  unsigned long hist[PROFILE_NBINS];
+  double flops;
+  double bytes;
+  double time;
+} profile_entry;
+
+typedef struct profile_table
+{
+  profile_entry entry[PROFILE_MAX_ROUTINES];
+  struct profile_table *next;
+#ifdef HAVE_PTHREAD
+  pthread_mutex_t lock;
+#endif
+} profile_table;
+
+int gsl_blas_profile_flag = -1;
+
+static const char *profile_names[PROFILE_MAX_ROUTINES];
+static int profile_nroutines = 0;
+static profile_table *profile_tables = NULL;
+static const char *profile_output = NULL;
+
+#ifdef HAVE_PTHREAD
+
+static pthread_mutex_t profile_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t profile_once = PTHREAD_ONCE_INIT;
+static pthread_key_t profile_key;
+
+#define PROFILE_LOCK() pthread_mutex_lock (&profile_lock)
+#define PROFILE_UNLOCK() pthread_mutex_unlock (&profile_lock)
+#define PROFILE_TABLE_LOCK(t) pthread_mutex_lock (&(t)->lock)
+#define PROFILE_TABLE_UNLOCK(t) pthread_mutex_unlock (&(t)->lock)
+
+#else
+
+#define PROFILE_LOCK()
+#define PROFILE_UNLOCK()
+#define PROFILE_TABLE_LOCK(t)
+#define PROFILE_TABLE_UNLOCK(t)
+
+#endif
+
+static double
+profile_clock (void)
+{
+#ifdef HAVE_CLOCK_GETTIME
+  struct timespec t;
+  clock_gettime (CLOCK_MONOTONIC, &t);
+  return t.tv_sec + 1.0e-9 * t.tv_nsec;
+#else
+  return (double) clock () / CLOCKS_PER_SEC;
+#endif
+}
+
+static void
+profile_atexit (void)
+{
+  FILE *stream = stderr;
+
+  if (profile_output != NULL && strcmp (profile_output, "1") != 0)
+    {
+      stream = fopen (profile_output, "w");
+
+      if (stream == NULL)
+        stream = stderr;
+    }
+
+  gsl_blas_profile_fprintf (stream);
+
+  if (stream != stderr)
+    fclose (stream);
+}
+
+static void
+profile_set_flag (const int flag)
+{
+#ifdef PROFILE_ATOMIC
+  __atomic_store_n (&gsl_blas_profile_flag, flag, __ATOMIC_RELAXED);
+#else
+  gsl_blas_profile_flag = flag;
+#endif
+}
+
+/* read GSL_BLAS_PROFILE, once */
+static void
+profile_init (void)
+{
+  const char *env = getenv ("GSL_BLAS_PROFILE");
+
+#ifdef HAVE_PTHREAD
+  pthread_key_create (&profile_key, NULL);
+#endif
+
+  if (env != NULL && *env != '\0' && strcmp (env, "0") != 0)
+    {
+      profile_output = env;
+      atexit (profile_atexit);
+      profile_set_flag (1);
+    }
+  else
+    {
+      profile_set_flag (0);
+    }
+}
+
+static void
+profile_init_once (void)
+{
+#ifdef HAVE_PTHREAD
+  pthread_once (&profile_once, profile_init);
+#else
+  static int done = 0;
+
+  if (!done)
+    {
+      done = 1;
+      profile_init ();
+    }
+#endif
+}
+
+/* the table of the calling thread, or NULL if it cannot be allocated */
+static profile_table *
+profile_table_get (void)
+{
+#ifdef HAVE_PTHREAD
+  profile_table *t = pthread_getspecific (profile_key);
+#else
+  profile_table *t = profile_tables;
+#endif
+
+  if (t == NULL)
+    {
+      t = calloc (1, sizeof (profile_table));
+
+      if (t == NULL)
+        return NULL;
+
+#ifdef HAVE_PTHREAD
+      pthread_mutex_init (&t->lock, NULL);
+#endif
+
+      PROFILE_LOCK ();
+      t->next = profile_tables;
+      profile_tables = t;
+      PROFILE_UNLOCK ();
+
+#ifdef HAVE_PTHREAD
+      pthread_setspecific (profile_key, t);
+#endif
+    }
+
+  return t;
+}
+
+/* the index of the routine name, registering it if needed; called
+   with profile_lock held */
+static int
+profile_register (const char *name)
+{
+  int i;
+
+  for (i = 0; i < profile_nroutines; i++)
+    {
+      if (strcmp (profile_names[i], name) == 0)
+        break;
+    }
+
+  if (i == profile_nroutines)
+    {
+      if (profile_nroutines < PROFILE_MAX_ROUTINES)
+        profile_names[profile_nroutines++] = name;
+      else
+        i = -1;
+    }
+
+  return i;
+}
+
+/* the index of the routine name cached in *slot, which is shared by
+   the threads calling the routine */
+static int
+profile_slot (int *slot, const char *name)
+{
+  int i;
+
+#ifdef PROFILE_ATOMIC
+  i = __atomic_load_n (slot, __ATOMIC_ACQUIRE);
+
+  if (i < 0)
+    {
+      PROFILE_LOCK ();
+      i = profile_register (name);
+      PROFILE_UNLOCK ();
+
+      __atomic_store_n (slot, i, __ATOMIC_RELEASE);
+    }
+#else
+  PROFILE_LOCK ();
+
+  if (*slot < 0)
+    *slot = profile_register (name);
+
+  i = *slot;
+
+  PROFILE_UNLOCK ();
+#endif
+
+  return i;
+}
+
+/* estimated flops and bytes of a call; a complex flop counts as four
+   real ones */
+static void
+profile_cost (const int type, const int kind, const double m,
+              const double n, const double k, double *flops, double *bytes)
+{
+  const double size = (type == 's') ? 4.0 : (type == 'z') ? 16.0 : 8.0;
+  const double fc = (type == 'c' || type == 'z') ? 4.0 : 1.0;
+  double f = 0.0, w = 0.0;      /* flops and elements accessed */
+
+  switch (kind)
+    {
+    case PROFILE_DOT:
+      f = 2.0 * m;
+      w = 2.0 * m;
+      break;
+    case PROFILE_NRM2:
+      f = 2.0 * m;
+      w = m;
+      break;
+    case PROFILE_ASUM:
+    case PROFILE_IAMAX:
+      f = m;
+      w = m;
+      break;
+    case PROFILE_SWAP:
+      w = 4.0 * m;
+      break;
+    case PROFILE_COPY:
+      w = 2.0 * m;
+      break;
+    case PROFILE_AXPY:
+      f = 2.0 * m;
+      w = 3.0 * m;
+      break;
+    case PROFILE_SCAL:
+      f = m;
+      w = 2.0 * m;
+      break;
+    case PROFILE_ROT:
+      f = 6.0 * m;
+      w = 4.0 * m;
+      break;
+    case PROFILE_AXPY_NRM2:
+    case PROFILE_DOT2:
+      f = 4.0 * m;
+      w = 3.0 * m;
+      break;
+    case PROFILE_AXPBY:
+      f = 3.0 * m;
+      w = 3.0 * m;
+      break;
+    case PROFILE_GEMV:
+      f = 2.0 * m * n;
+      w = m * n + n + 2.0 * m;
+      break;
+    case PROFILE_GER:
+      f = 2.0 * m * n;
+      w = 2.0 * m * n + m + n;
+      break;
+    case PROFILE_SYMV:
+      f = 2.0 * m * m;
+      w = 0.5 * m * m + 3.0 * m;
+      break;
+    case PROFILE_TRMV:
+      f = m * m;
+      w = 0.5 * m * m + 2.0 * m;
+      break;
+    case PROFILE_SYR:
+      f = m * m;
+      w = m * m + m;
+      break;
+    case PROFILE_SYR2:
+      f = 2.0 * m * m;
+      w = m * m + 2.0 * m;
+      break;
+    case PROFILE_GEMM:
+      f = 2.0 * m * n * k;
+      w = m * k + k * n + 2.0 * m * n;
+      break;
+    case PROFILE_SYMM:
+      f = 2.0 * m * n * k;
+      w = 0.5 * k * k + 3.0 * m * n;
+      break;
+    case PROFILE_SYRK:
+      f = m * m * k;
+      w = m * k + m * m;
+      break;
+    case PROFILE_SYR2K:
+      f = 2.0 * m * m * k;
+      w = 2.0 * m * k + m * m;
+      break;
+    case PROFILE_TRMM:
+      f = m * n * k;
+      w = 0.5 * k * k + 2.0 * m * n;
+      break;
+    default:
+      break;
+    }
+
+  *flops = fc * f;
+  *bytes = size * w;
+}
+
+double
+gsl_blas_profile_begin (void)
+{
+  if (PROFILE_FLAG () < 0)
+    profile_init_once ();
+
+  return (PROFILE_FLAG () > 0) ? profile_clock () : -1.0;
+}
+
+void
+gsl_blas_profile_end (int *slot, const char *name, const int type,
+                      const int kind, const size_t m, const size_t n,
+                      const size_t k, const double t0)
+{
+  const double t1 = profile_clock ();
+  profile_table *t = profile_table_get ();
+  profile_entry *e;
+  size_t d = (m > n) ? m : n;
+  double flops, bytes;
+  int i, b;
+
+  i = profile_slot (slot, name);
+
+  if (t == NULL || i < 0)
+    return;
+
+  if (k > d)
+    d = k;
+
+  for (b = 0; b < PROFILE_NBINS - 1 && (d >> (b + 1)) != 0; b++)
+    ;
+
+  profile_cost (type, kind, (double) m, (double) n, (double) k, &flops,
+                &bytes);
+
+  PROFILE_TABLE_LOCK (t);
+
+  e = &t->entry[i];
+  e->calls++;
+  e->hist[b]++;
+  e->flops += flops;
+  e->bytes += bytes;
+  e->time += t1 - t0;
+
+  PROFILE_TABLE_UNLOCK (t);
+}
+
+int
+gsl_blas_profile_set (const int enable)
+{
+  int previous;
+
+  profile_init_once ();
+
+  previous = PROFILE_FLAG ();
+  profile_set_flag (enable != 0);
+
+  return previous;
+}
+
+void
+gsl_blas_profile_reset (void)
+{
+  profile_table *t;
+
+  PROFILE_LOCK ();
+
+  for (t = profile_tables; t != NULL; t = t->next)
+    {
+      PROFILE_TABLE_LOCK (t);
+      memset (t->entry, 0, sizeof (t->entry));
+      PROFILE_TABLE_UNLOCK (t);
+    }
+
+  PROFILE_UNLOCK ();
+}
+
+int
+gsl_blas_profile_fprintf (FILE * stream)
+{
+  profile_entry total[PROFILE_MAX_ROUTINES];
+  int order[PROFILE_MAX_ROUTINES];
+  profile_table *t;
+  int i, j, b, n, status;
+
+  PROFILE_LOCK ();
+
+  n = profile_nroutines;
+  memset (total, 0, sizeof (total));
+
+  for (t = profile_tables; t != NULL; t = t->next)
+    {
+      PROFILE_TABLE_LOCK (t);
+
+      for (i = 0; i < n; i++)
+        {
+          total[i].calls += t->entry[i].calls;
+          total[i].flops += t->entry[i].flops;
+          total[i].bytes += t->entry[i].bytes;
+          total[i].time += t->entry[i].time;
+
+          for (b = 0; b < PROFILE_NBINS; b++)
+            total[i].hist[b] += t->entry[i].hist[b];
+        }
+
+      PROFILE_TABLE_UNLOCK (t);
+    }
+
+  PROFILE_UNLOCK ();
+
+  /* sort the routines by decreasing time */
+  for (i = 0; i < n; i++)
+    {
+      for (j = i; j > 0 && total[order[j - 1]].time < total[i].time; j--)
+        order[j] = order[j - 1];
+
+      order[j] = i;
+    }
+
+  status = fprintf (stream, "%-16s %10s %12s %12s %12s %10s\n", "routine",
+                    "calls", "time (s)", "Mflop", "Mbyte", "Gflop/s");
+
+  for (j = 0; j < n && status >= 0; j++)
+    {
+      const profile_entry *e = &total[order[j]];
+
+      if (e->calls == 0)
+        continue;
+
+      status = fprintf (stream, "%-16s %10lu %12.4e %12.4e %12.4e %10.3f\n",
+                        profile_names[order[j]], e->calls, e->time,
+                        1.0e-6 * e->flops, 1.0e-6 * e->bytes,
+                        (e->time > 0.0) ? 1.0e-9 * e->flops / e->time : 0.0);
+
+      if (status >= 0)
+        status = fprintf (stream, "  size");
+
+      for (b = 0; b < PROFILE_NBINS && status >= 0; b++)
+        {
+          if (e->hist[b] == 0)
+            continue;
+
+          if (b < PROFILE_NBINS - 1)
+            status = fprintf (stream, " <%lu:%lu", 2UL << b, e->hist[b]);
+          else
+            status = fprintf (stream, " >=%lu:%lu", 1UL << b, e->hist[b]);
+        }
+
+      if (status >= 0)
+        status = fprintf (stream, "\n");
+    }
+
+  if (status < 0)
+    {
+      GSL_ERROR ("fprintf failed", GSL_EFAILED);
+    }
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,99 @@
+/* blas/profile.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_BLAS_PROFILE_H__
+#define __GSL_BLAS_PROFILE_H__
+
+/* Internal interface of the BLAS profiler (profile.c) */
+
+/* operation classes, which determine the estimated flops and bytes of
+   a call from its dimensions (m, n, k) */
+enum
+{
+  PROFILE_NONE,                 /* rotg, rotmg */
+  PROFILE_DOT,                  /* x.y, n */
+  PROFILE_NRM2,                 /* ||x||, n */
+  PROFILE_ASUM,                 /* sum |x_i|, n */
+  PROFILE_IAMAX,                /* argmax |x_i|, n */
+  PROFILE_SWAP,                 /* x <-> y, n */
+  PROFILE_COPY,                 /* y = x, n */
+  PROFILE_AXPY,                 /* y = a x + y, n */
+  PROFILE_SCAL,                 /* x = a x, n */
+  PROFILE_ROT,                  /* plane rotation of x and y, n */
+  PROFILE_AXPY_NRM2,            /* y = a x + y and ||y||, n */
+  PROFILE_DOT2,                 /* x.y and x.z, n */
+  PROFILE_AXPBY,                /* y = a x + b y, n */
+  PROFILE_GEMV,                 /* m-by-n matrix times vector */
+  PROFILE_GER,                  /* m-by-n rank-1 update */
+  PROFILE_SYMV,                 /* n-by-n symmetric matrix times vector */
+  PROFILE_TRMV,                 /* n-by-n triangular product or solve */
+  PROFILE_SYR,                  /* n-by-n symmetric rank-1 update */
+  PROFILE_SYR2,                 /* n-by-n symmetric rank-2 update */
+  PROFILE_GEMM,                 /* m-by-k times k-by-n */
+  PROFILE_SYMM,                 /* k-by-k symmetric times m-by-n */
+  PROFILE_SYRK,                 /* n-by-n rank-k update */
+  PROFILE_SYR2K,                /* n-by-n rank-2k update */
+  PROFILE_TRMM                  /* k-by-k triangular times m-by-n */
+};
+
+/* zero when profiling is off, -1 before the environment is read */
+extern int gsl_blas_profile_flag;
+
+/* gsl_blas_profile_flag and the cached routine indices are shared by
+   all threads; with the GCC atomic builtins they are accessed
+   atomically, otherwise the indices are accessed under a lock */
+#if defined(__GNUC__) && defined(__ATOMIC_RELAXED)
+#define PROFILE_ATOMIC 1
+#define PROFILE_FLAG() __atomic_load_n (&gsl_blas_profile_flag, __ATOMIC_RELAXED)
+#else
+#define PROFILE_FLAG() gsl_blas_profile_flag
+#endif
+
+/* start time of a call, or -1 if profiling is off */
+double gsl_blas_profile_begin (void);
+
+/* record a call of the routine name, of element type 's', 'd', 'c' or
+   'z', which started at time t0; *slot caches the index of the routine,
+   is shared by the threads calling it, and must be initialized to -1 */
+void gsl_blas_profile_end (int *slot, const char *name, const int type,
+                           const int kind, const size_t m, const size_t n,
+                           const size_t k, const double t0);
+
+/* execute the statement stmt, recording it as a call of the routine
+   name when profiling is on */
+#define BLAS_PROFILE(name, type, kind, m, n, k, stmt)                   \
+  do                                                                    \
+    {                                                                   \
+      if (PROFILE_FLAG () == 0)                                         \
+        {                                                               \
+          stmt;                                                         \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          static int profile_slot = -1;                                 \
+          const double profile_t0 = gsl_blas_profile_begin ();          \
+          stmt;                                                         \
+          if (profile_t0 >= 0.0)                                        \
+            gsl_blas_profile_end (&profile_slot, name, type, kind,      \
+                                  (m), (n), (k), profile_t0);           \
+        }                                                               \
+    }                                                                   \
+  while (0)
+
+#endif /* __GSL_BLAS_PROFILE_H__ */
@@ -0,0 +1,751 @@
+/* blas/test.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Tests of the gsl_blas extensions which are not plain wrappers of a
+ * single CBLAS routine. The reference results are computed with the
+ * single-problem gsl_blas functions, and for the mixed precision
+ * functions with the double precision functions on widened operands.
+ */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_ieee_utils.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_test.h>
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+/* dimensions of the problems of a batch; consecutive problems with the
+   same dimensions form the runs, and the leading dimension varies within
+   a run of equal sizes so that the batch is not uniform */
+#define NBATCH 9
+static const size_t batch_m[NBATCH] = { 3, 3, 3, 5, 5, 1, 3, 17, 4 };
+static const size_t batch_n[NBATCH] = { 3, 3, 3, 2, 2, 7, 3, 9, 4 };
+static const size_t batch_k[NBATCH] = { 4, 4, 4, 6, 6, 1, 4, 33, 4 };
+static const size_t batch_pad[NBATCH] = { 0, 0, 2, 0, 1, 0, 0, 3, 0 };
+
+/* allocate an m-by-n matrix with tda n + pad, filled with uniform random
+   values in [-1,1) */
+static gsl_matrix *
+random_matrix (const size_t m, const size_t n, const size_t pad,
+               gsl_rng * r)
+{
+  gsl_block *b = gsl_block_alloc (m * (n + pad));
+  gsl_matrix *A = gsl_matrix_alloc_from_block (b, 0, m, n, n + pad);
+  size_t i, j;
+
+  A->owner = 1;
+
+  for (i = 0; i < m; i++)
+    for (j = 0; j < n; j++)
+      gsl_matrix_set (A, i, j, 2.0 * gsl_rng_uniform (r) - 1.0);
+
+  return A;
+}
+
+static gsl_vector *
+random_vector (const size_t n, const size_t stride, gsl_rng * r)
+{
+  gsl_block *b = gsl_block_alloc (n * stride);
+  gsl_vector *x = gsl_vector_alloc_from_block (b, 0, n, stride);
+  size_t i;
+
+  x->owner = 1;
+
+  for (i = 0; i < n; i++)
+    gsl_vector_set (x, i, 2.0 * gsl_rng_uniform (r) - 1.0);
+
+  return x;
+}
+
+static gsl_matrix_float *
+random_matrix_float (const size_t m, const size_t n, const size_t pad,
+                     gsl_rng * r)
+{
+  gsl_block_float *b = gsl_block_float_alloc (m * (n + pad));
+  gsl_matrix_float *A = gsl_matrix_float_alloc_from_block (b, 0, m, n, n + pad);
+  size_t i, j;
+
+  A->owner = 1;
+
+  for (i = 0; i < m; i++)
+    for (j = 0; j < n; j++)
+      gsl_matrix_float_set (A, i, j, (float) (2.0 * gsl_rng_uniform (r) - 1.0));
+
+  return A;
+}
+
+static gsl_vector_float *
+random_vector_float (const size_t n, const size_t stride, gsl_rng * r)
+{
+  gsl_block_float *b = gsl_block_float_alloc (n * stride);
+  gsl_vector_float *x = gsl_vector_float_alloc_from_block (b, 0, n, stride);
+  size_t i;
+
+  x->owner = 1;
+
+  for (i = 0; i < n; i++)
+    gsl_vector_float_set (x, i, (float) (2.0 * gsl_rng_uniform (r) - 1.0));
+
+  return x;
+}
+
+/* exact double precision copies of single precision operands */
+static gsl_matrix *
+widen_matrix (const gsl_matrix_float * A)
+{
+  gsl_matrix *B = gsl_matrix_alloc (A->size1, A->size2);
+  size_t i, j;
+
+  for (i = 0; i < A->size1; i++)
+    for (j = 0; j < A->size2; j++)
+      gsl_matrix_set (B, i, j, gsl_matrix_float_get (A, i, j));
+
+  return B;
+}
+
+static gsl_vector *
+widen_vector (const gsl_vector_float * x)
+{
+  gsl_vector *y = gsl_vector_alloc (x->size);
+  size_t i;
+
+  for (i = 0; i < x->size; i++)
+    gsl_vector_set (y, i, gsl_vector_float_get (x, i));
+
+  return y;
+}
+
+/* largest relative difference between the elements of x and y */
+static double
+vector_reldiff (const gsl_vector * x, const gsl_vector * y)
+{
+  double d = 0.0;
+  size_t i;
+
+  for (i = 0; i < x->size; i++)
+    {
+      const double xi = gsl_vector_get (x, i), yi = gsl_vector_get (y, i);
+      const double di = fabs (xi - yi) / GSL_MAX (fabs (yi), GSL_DBL_MIN);
+
+      if (!(di <= d))           /* also catches NaN */
+        d = di;
+    }
+
+  return d;
+}
+
+/* the fused Level 1 functions against the pairs of calls they replace;
+   the elements of x are multiplied by scale to reach the underflow and
+   overflow fallbacks of the norm */
+static void
+test_fused (const size_t N, const size_t incX, const size_t incY,
+            const double scale, gsl_rng * r)
+{
+  const double tol = 16.0 * GSL_DBL_EPSILON;
+  const double alpha = -0.75, beta = 1.5;
+  gsl_vector *X = random_vector (N, incX, r);
+  gsl_vector *Y = random_vector (N, incY, r);
+  gsl_vector *Z = random_vector (N, incX + incY, r);
+  gsl_vector *Y_exp = gsl_vector_alloc (N);
+  double nrm, nrm_exp, xy, xz, xy_exp, xz_exp;
+  int status;
+
+  gsl_vector_scale (X, scale);
+  gsl_vector_scale (Y, scale);
+
+  /* daxpy_nrm2 */
+  gsl_vector_memcpy (Y_exp, Y);
+  gsl_blas_daxpy (alpha, X, Y_exp);
+  nrm_exp = gsl_blas_dnrm2 (Y_exp);
+
+  status = gsl_blas_daxpy_nrm2 (alpha, X, Y, &nrm);
+  gsl_test (status, "daxpy_nrm2 N=%zu incX=%zu incY=%zu scale=%g status",
+            N, incX, incY, scale);
+  gsl_test (vector_reldiff (Y, Y_exp) > tol,
+            "daxpy_nrm2 N=%zu incX=%zu incY=%zu scale=%g y", N, incX, incY, scale);
+  gsl_test_rel (nrm, nrm_exp, tol,
+                "daxpy_nrm2 N=%zu incX=%zu incY=%zu scale=%g norm",
+                N, incX, incY, scale);
+
+  /* ddot2; the products of scaled vectors underflow or overflow */
+  if (scale == 1.0)
+    {
+      gsl_blas_ddot (X, Y, &xy_exp);
+      gsl_blas_ddot (X, Z, &xz_exp);
+
+      status = gsl_blas_ddot2 (X, Y, Z, &xy, &xz);
+      gsl_test (status, "ddot2 N=%zu incX=%zu incY=%zu status", N, incX, incY);
+      gsl_test_abs (xy, xy_exp, tol * N, "ddot2 N=%zu incX=%zu incY=%zu x.y",
+                    N, incX, incY);
+      gsl_test_abs (xz, xz_exp, tol * N, "ddot2 N=%zu incX=%zu incY=%zu x.z",
+                    N, incX, incY);
+    }
+
+  /* daxpby */
+  gsl_vector_memcpy (Y_exp, Y);
+  gsl_blas_dscal (beta, Y_exp);
+  gsl_blas_daxpy (alpha, X, Y_exp);
+
+  status = gsl_blas_daxpby (alpha, X, beta, Y);
+  gsl_test (status, "daxpby N=%zu incX=%zu incY=%zu beta=%g status",
+            N, incX, incY, beta);
+  gsl_test (vector_reldiff (Y, Y_exp) > tol,
+            "daxpby N=%zu incX=%zu incY=%zu beta=%g", N, incX, incY, beta);
+
+  /* with beta = 0, Y is not read */
+  gsl_vector_set_zero (Y_exp);
+  gsl_blas_daxpy (alpha, X, Y_exp);
+  gsl_vector_set_all (Y, GSL_NAN);
+
+  status = gsl_blas_daxpby (alpha, X, 0.0, Y);
+  gsl_test (status, "daxpby N=%zu incX=%zu incY=%zu beta=0 status",
+            N, incX, incY);
+  gsl_test (vector_reldiff (Y, Y_exp) > tol,
+            "daxpby N=%zu incX=%zu incY=%zu beta=0", N, incX, incY);
+
+  gsl_vector_free (X);
+  gsl_vector_free (Y);
+  gsl_vector_free (Z);
+  gsl_vector_free (Y_exp);
+}
+
+static void
+test_dgemm_batch (CBLAS_TRANSPOSE_t TransA, CBLAS_TRANSPOSE_t TransB,
+                  const double alpha, const double beta, gsl_rng * r)
+{
+  gsl_matrix *A[NBATCH], *B[NBATCH], *C[NBATCH], *C_exp[NBATCH];
+  size_t p;
+  int status;
+
+  for (p = 0; p < NBATCH; p++)
+    {
+      const size_t m = batch_m[p], n = batch_n[p], k = batch_k[p];
+
+      A[p] = (TransA == CblasNoTrans) ? random_matrix (m, k, batch_pad[p], r)
+                                      : random_matrix (k, m, batch_pad[p], r);
+      B[p] = (TransB == CblasNoTrans) ? random_matrix (k, n, batch_pad[p], r)
+                                      : random_matrix (n, k, batch_pad[p], r);
+      C[p] = random_matrix (m, n, batch_pad[p], r);
+      C_exp[p] = gsl_matrix_alloc (m, n);
+      gsl_matrix_memcpy (C_exp[p], C[p]);
+
+      gsl_blas_dgemm (TransA, TransB, alpha, A[p], B[p], beta, C_exp[p]);
+    }
+
+  status = gsl_blas_dgemm_batch (TransA, TransB, alpha,
+                                 (const gsl_matrix **) A,
+                                 (const gsl_matrix **) B, beta, C, NBATCH);
+  gsl_test (status, "dgemm_batch TransA=%d TransB=%d alpha=%g beta=%g status",
+            TransA, TransB, alpha, beta);
+
+  for (p = 0; p < NBATCH; p++)
+    {
+      gsl_test (!gsl_matrix_equal (C[p], C_exp[p]),
+                "dgemm_batch TransA=%d TransB=%d alpha=%g beta=%g problem %zu",
+                TransA, TransB, alpha, beta, p);
+
+      gsl_matrix_free (A[p]);
+      gsl_matrix_free (B[p]);
+      gsl_matrix_free (C[p]);
+      gsl_matrix_free (C_exp[p]);
+    }
+}
+
+static void
+test_dgemv_batch (CBLAS_TRANSPOSE_t TransA, const double alpha,
+                  const double beta, gsl_rng * r)
+{
+  gsl_matrix *A[NBATCH];
+  gsl_vector *X[NBATCH], *Y[NBATCH], *Y_exp[NBATCH];
+  size_t p;
+  int status;
+
+  for (p = 0; p < NBATCH; p++)
+    {
+      const size_t m = batch_m[p], n = batch_k[p];
+      const size_t lenX = (TransA == CblasNoTrans) ? n : m;
+      const size_t lenY = (TransA == CblasNoTrans) ? m : n;
+
+      A[p] = random_matrix (m, n, batch_pad[p], r);
+      X[p] = random_vector (lenX, 1 + batch_pad[p], r);
+      Y[p] = random_vector (lenY, 1 + (p % 2), r);
+      Y_exp[p] = gsl_vector_alloc (lenY);
+      gsl_vector_memcpy (Y_exp[p], Y[p]);
+
+      gsl_blas_dgemv (TransA, alpha, A[p], X[p], beta, Y_exp[p]);
+    }
+
+  status = gsl_blas_dgemv_batch (TransA, alpha, (const gsl_matrix **) A,
+                                 (const gsl_vector **) X, beta, Y, NBATCH);
+  gsl_test (status, "dgemv_batch TransA=%d alpha=%g beta=%g status",
+            TransA, alpha, beta);
+
+  for (p = 0; p < NBATCH; p++)
+    {
+      gsl_test (!gsl_vector_equal (Y[p], Y_exp[p]),
+                "dgemv_batch TransA=%d alpha=%g beta=%g problem %zu",
+                TransA, alpha, beta, p);
+
+      gsl_matrix_free (A[p]);
+      gsl_vector_free (X[p]);
+      gsl_vector_free (Y[p]);
+      gsl_vector_free (Y_exp[p]);
+    }
+}
+
+static void
+test_dtrsm_batch (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
+                  CBLAS_TRANSPOSE_t TransA, CBLAS_DIAG_t Diag,
+                  const double alpha, gsl_rng * r)
+{
+  gsl_matrix *A[NBATCH], *B[NBATCH], *B_exp[NBATCH];
+  size_t p, i;
+  int status;
+
+  for (p = 0; p < NBATCH; p++)
+    {
+      const size_t m = batch_m[p], n = batch_n[p];
+      const size_t na = (Side == CblasLeft) ? m : n;
+
+      /* diagonally dominant, so that the solves are well conditioned */
+      A[p] = random_matrix (na, na, batch_pad[p], r);
+      for (i = 0; i < na; i++)
+        gsl_matrix_set (A[p], i, i, gsl_matrix_get (A[p], i, i) + 2.0 * na);
+
+      B[p] = random_matrix (m, n, batch_pad[p], r);
+      B_exp[p] = gsl_matrix_alloc (m, n);
+      gsl_matrix_memcpy (B_exp[p], B[p]);
+
+      gsl_blas_dtrsm (Side, Uplo, TransA, Diag, alpha, A[p], B_exp[p]);
+    }
+
+  status = gsl_blas_dtrsm_batch (Side, Uplo, TransA, Diag, alpha,
+                                 (const gsl_matrix **) A, B, NBATCH);
+  gsl_test (status, "dtrsm_batch Side=%d Uplo=%d TransA=%d Diag=%d status",
+            Side, Uplo, TransA, Diag);
+
+  for (p = 0; p < NBATCH; p++)
+    {
+      gsl_test (!gsl_matrix_equal (B[p], B_exp[p]),
+                "dtrsm_batch Side=%d Uplo=%d TransA=%d Diag=%d problem %zu",
+                Side, Uplo, TransA, Diag, p);
+
+      gsl_matrix_free (A[p]);
+      gsl_matrix_free (B[p]);
+      gsl_matrix_free (B_exp[p]);
+    }
+}
+
+/* a batch with one invalid problem is rejected before any is solved */
+static void
+test_batch_invalid (gsl_rng * r)
+{
+  gsl_matrix *A[2], *B[2], *C[2], *C0;
+  int status;
+  size_t p;
+
+  for (p = 0; p < 2; p++)
+    {
+      A[p] = random_matrix (3, 4, 0, r);
+      B[p] = random_matrix (4, 2, 0, r);
+      C[p] = random_matrix (3, 2 + p, 0, r);
+    }
+
+  C0 = gsl_matrix_alloc (3, 2);
+  gsl_matrix_memcpy (C0, C[0]);
+
+  status = gsl_blas_dgemm_batch (CblasNoTrans, CblasNoTrans, 1.0,
+                                 (const gsl_matrix **) A,
+                                 (const gsl_matrix **) B, 1.0, C, 2);
+  gsl_test (status != GSL_EBADLEN, "dgemm_batch invalid problem status");
+  gsl_test (!gsl_matrix_equal (C[0], C0), "dgemm_batch invalid problem, C unchanged");
+
+  for (p = 0; p < 2; p++)
+    {
+      gsl_matrix_free (A[p]);
+      gsl_matrix_free (B[p]);
+      gsl_matrix_free (C[p]);
+    }
+
+  gsl_matrix_free (C0);
+}
+
+/* the mixed precision results may differ from the double precision
+   reference by the rounding of a different summation order, of size
+   K eps times the magnitude of the terms; the single precision results
+   are rounded once more */
+#define MIXED_TOL(K) (8.0 * (K) * GSL_DBL_EPSILON)
+
+static int
+mixed_check (const double got, const double expected, const double scale,
+             const double tol_round, const size_t K)
+{
+  return fabs (got - expected) <= tol_round * fabs (expected)
+    + MIXED_TOL (K) * scale;
+}
+
+/* shapes of the mixed precision products, M x K times K x N; the larger
+   ones cross the 512 tile boundary of C and the 256 slice depth of K */
+#define NMIXED 5
+static const size_t mixed_m[NMIXED] = { 1, 7, 515, 3, 600 };
+static const size_t mixed_n[NMIXED] = { 1, 5, 9, 530, 520 };
+static const size_t mixed_k[NMIXED] = { 1, 13, 300, 260, 3 };
+
+static void
+test_mixed_gemm (CBLAS_TRANSPOSE_t TransA, CBLAS_TRANSPOSE_t TransB,
+                 const double alpha, const double beta, gsl_rng * r)
+{
+  size_t p, i, j;
+
+  for (p = 0; p < NMIXED; p++)
+    {
+      const size_t M = mixed_m[p], N = mixed_n[p], K = mixed_k[p];
+      const double scale = fabs (alpha) * K + fabs (beta);
+      gsl_matrix_float *A = (TransA == CblasNoTrans) ? random_matrix_float (M, K, p % 2, r)
+                                                     : random_matrix_float (K, M, p % 2, r);
+      gsl_matrix_float *B = (TransB == CblasNoTrans) ? random_matrix_float (K, N, 0, r)
+                                                     : random_matrix_float (N, K, 0, r);
+      gsl_matrix_float *Cf = random_matrix_float (M, N, p % 3, r);
+      gsl_matrix *Ad = widen_matrix (A);
+      gsl_matrix *Bd = widen_matrix (B);
+      gsl_matrix *C_exp = widen_matrix (Cf);
+      gsl_matrix *Cd = gsl_matrix_alloc (M, N);
+      int status, ok_d = 1, ok_f = 1;
+
+      /* C is not read when beta is zero */
+      if (beta == 0.0)
+        {
+          gsl_matrix_set_all (Cd, GSL_NAN);
+          gsl_matrix_float_set_all (Cf, GSL_NAN);
+        }
+      else
+        {
+          gsl_matrix_memcpy (Cd, C_exp);
+        }
+
+      gsl_blas_dgemm (TransA, TransB, alpha, Ad, Bd, beta, C_exp);
+
+      status = gsl_blas_dsgemm (TransA, TransB, alpha, A, B, beta, Cd);
+      gsl_test (status, "dsgemm TransA=%d TransB=%d alpha=%g beta=%g %zux%zux%zu status",
+                TransA, TransB, alpha, beta, M, N, K);
+
+      status = gsl_blas_sdsgemm (TransA, TransB, alpha, A, B, beta, Cf);
+      gsl_test (status, "sdsgemm TransA=%d TransB=%d alpha=%g beta=%g %zux%zux%zu status",
+                TransA, TransB, alpha, beta, M, N, K);
+
+      for (i = 0; i < M; i++)
+        {
+          for (j = 0; j < N; j++)
+            {
+              const double c = gsl_matrix_get (C_exp, i, j);
+
+              ok_d &= mixed_check (gsl_matrix_get (Cd, i, j), c, scale, 0.0, K);
+              ok_f &= mixed_check (gsl_matrix_float_get (Cf, i, j), c, scale,
+                                   GSL_FLT_EPSILON, K);
+            }
+        }
+
+      gsl_test (!ok_d, "dsgemm TransA=%d TransB=%d alpha=%g beta=%g %zux%zux%zu",
+                TransA, TransB, alpha, beta, M, N, K);
+      gsl_test (!ok_f, "sdsgemm TransA=%d TransB=%d alpha=%g beta=%g %zux%zux%zu",
+                TransA, TransB, alpha, beta, M, N, K);
+
+      gsl_matrix_float_free (A);
+      gsl_matrix_float_free (B);
+      gsl_matrix_float_free (Cf);
+      gsl_matrix_free (Ad);
+      gsl_matrix_free (Bd);
+      gsl_matrix_free (Cd);
+      gsl_matrix_free (C_exp);
+    }
+}
+
+static void
+test_mixed_gemv (CBLAS_TRANSPOSE_t TransA, const double alpha,
+                 const double beta, gsl_rng * r)
+{
+  size_t p, i;
+
+  for (p = 0; p < NMIXED; p++)
+    {
+      const size_t M = mixed_m[p], N = mixed_n[p] + mixed_k[p];
+      const size_t lenX = (TransA == CblasNoTrans) ? N : M;
+      const size_t lenY = (TransA == CblasNoTrans) ? M : N;
+      const size_t K = (TransA == CblasNoTrans) ? N : M;
+      const double scale = fabs (alpha) * K + fabs (beta);
+      gsl_matrix_float *A = random_matrix_float (M, N, p % 2, r);
+      gsl_vector_float *X = random_vector_float (lenX, 1 + p % 2, r);
+      gsl_vector_float *Yf = random_vector_float (lenY, 1 + p % 3, r);
+      gsl_matrix *Ad = widen_matrix (A);
+      gsl_vector *Xd = widen_vector (X);
+      gsl_vector *Y_exp = widen_vector (Yf);
+      gsl_vector *Yd = gsl_vector_alloc (lenY);
+      int status, ok_d = 1, ok_f = 1;
+
+      /* y is not read when beta is zero */
+      if (beta == 0.0)
+        {
+          gsl_vector_set_all (Yd, GSL_NAN);
+          gsl_vector_float_set_all (Yf, GSL_NAN);
+        }
+      else
+        {
+          gsl_vector_memcpy (Yd, Y_exp);
+        }
+
+      gsl_blas_dgemv (TransA, alpha, Ad, Xd, beta, Y_exp);
+
+      status = gsl_blas_dsgemv (TransA, alpha, A, X, beta, Yd);
+      gsl_test (status, "dsgemv TransA=%d alpha=%g beta=%g %zux%zu status",
+                TransA, alpha, beta, M, N);
+
+      status = gsl_blas_sdsgemv (TransA, alpha, A, X, beta, Yf);
+      gsl_test (status, "sdsgemv TransA=%d alpha=%g beta=%g %zux%zu status",
+                TransA, alpha, beta, M, N);
+
+      for (i = 0; i < lenY; i++)
+        {
+          const double y = gsl_vector_get (Y_exp, i);
+
+          ok_d &= mixed_check (gsl_vector_get (Yd, i), y, scale, 0.0, K);
+          ok_f &= mixed_check (gsl_vector_float_get (Yf, i), y, scale,
+                               GSL_FLT_EPSILON, K);
+        }
+
+      gsl_test (!ok_d, "dsgemv TransA=%d alpha=%g beta=%g %zux%zu",
+                TransA, alpha, beta, M, N);
+      gsl_test (!ok_f, "sdsgemv TransA=%d alpha=%g beta=%g %zux%zu",
+                TransA, alpha, beta, M, N);
+
+      gsl_matrix_float_free (A);
+      gsl_vector_float_free (X);
+      gsl_vector_float_free (Yf);
+      gsl_matrix_free (Ad);
+      gsl_vector_free (Xd);
+      gsl_vector_free (Y_exp);
+      gsl_vector_free (Yd);
+    }
+}
+
+/* the counts printed by gsl_blas_profile_fprintf for the routine name:
+   the number of calls and the histogram line, or -1 and an empty
+   string if it is not listed */
+static long
+profile_read (FILE * stream, const char *name, char *hist, size_t len)
+{
+  char line[256], routine[64];
+  long calls = -1;
+  unsigned long c;
+
+  rewind (stream);
+  hist[0] = '\0';
+
+  while (fgets (line, sizeof (line), stream) != NULL)
+    {
+      if (sscanf (line, "%63s %lu", routine, &c) == 2
+          && strcmp (routine, name) == 0)
+        {
+          calls = (long) c;
+
+          if (fgets (line, sizeof (line), stream) != NULL)
+            {
+              line[strcspn (line, "\n")] = '\0';
+              strncpy (hist, line, len - 1);
+              hist[len - 1] = '\0';
+            }
+
+          break;
+        }
+    }
+
+  return calls;
+}
+
+#define PROFILE_NDOT 100
+
+static void *
+profile_ddot (void *arg)
+{
+  const gsl_vector *x = arg;
+  double d;
+  size_t i;
+
+  for (i = 0; i < PROFILE_NDOT; i++)
+    gsl_blas_ddot (x, x, &d);
+
+  return NULL;
+}
+
+static void
+test_profile (gsl_rng * r)
+{
+  gsl_vector *x = random_vector (5, 1, r);
+  gsl_matrix *A = random_matrix (10, 10, 0, r);
+  gsl_matrix *B = random_matrix (100, 100, 0, r);
+  gsl_matrix *C = gsl_matrix_alloc (100, 100);
+  gsl_matrix_view c = gsl_matrix_submatrix (C, 0, 0, 10, 10);
+  FILE *stream = tmpfile ();
+  char hist[256];
+  size_t nthreads = 1, i;
+  int status;
+
+  if (stream == NULL)
+    {
+      gsl_test (1, "profile tmpfile");
+      return;
+    }
+
+  gsl_blas_profile_set (1);
+  gsl_blas_profile_reset ();
+
+  /* dimensions 5 fall in the bin below 8, 10 below 16 and 100 below 128 */
+#ifdef HAVE_PTHREAD
+  {
+    pthread_t threads[3];
+
+    for (i = 0; i < 3; i++)
+      {
+        if (pthread_create (&threads[i], NULL, profile_ddot, x) == 0)
+          nthreads++;
+        else
+          break;
+      }
+
+    profile_ddot (x);
+
+    while (i-- > 0)
+      pthread_join (threads[i], NULL);
+  }
+#else
+  profile_ddot (x);
+#endif
+
+  gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, A, A, 0.0, &c.matrix);
+  gsl_blas_dgemm (CblasNoTrans, CblasTrans, 1.0, A, A, 1.0, &c.matrix);
+  gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, B, B, 0.0, C);
+
+  status = gsl_blas_profile_fprintf (stream);
+  gsl_test (status, "profile fprintf status");
+
+  gsl_test_int (profile_read (stream, "ddot", hist, sizeof (hist)),
+                (int) (nthreads * PROFILE_NDOT), "profile ddot calls");
+  {
+    char expected[64];
+    sprintf (expected, "  size <8:%d", (int) (nthreads * PROFILE_NDOT));
+    gsl_test (strcmp (hist, expected) != 0, "profile ddot histogram \"%s\"",
+              hist);
+  }
+
+  gsl_test_int (profile_read (stream, "dgemm", hist, sizeof (hist)), 3,
+                "profile dgemm calls");
+  gsl_test (strcmp (hist, "  size <16:2 <128:1") != 0,
+            "profile dgemm histogram \"%s\"", hist);
+
+  gsl_test_int (profile_read (stream, "dgemv", hist, sizeof (hist)), -1,
+                "profile dgemv not called");
+
+  /* after a reset no routine is listed */
+  gsl_blas_profile_reset ();
+  fclose (stream);
+  stream = tmpfile ();
+
+  if (stream != NULL)
+    {
+      gsl_blas_profile_fprintf (stream);
+      gsl_test_int (profile_read (stream, "ddot", hist, sizeof (hist)), -1,
+                    "profile ddot after reset");
+      fclose (stream);
+    }
+
+  gsl_blas_profile_set (0);
+
+  gsl_vector_free (x);
+  gsl_matrix_free (A);
+  gsl_matrix_free (B);
+  gsl_matrix_free (C);
+}
+
+int
+main (void)
+{
+  const double scalars[][2] = { { 1.0, 0.0 }, { -0.7, 1.0 }, { 0.0, 2.5 }, { 1.3, -0.4 } };
+  const CBLAS_TRANSPOSE_t trans[] = { CblasNoTrans, CblasTrans };
+  gsl_rng *r;
+  size_t i, a, b, s, u, d;
+
+  gsl_ieee_env_setup ();
+  r = gsl_rng_alloc (gsl_rng_default);
+
+  {
+    const size_t sizes[] = { 1, 3, 4, 7, 16, 61, 1000 };
+    const double scales[] = { 1.0, 1.0e-160, 1.0e160 };
+
+    for (i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++)
+      for (s = 0; s < sizeof (scales) / sizeof (scales[0]); s++)
+        {
+          test_fused (sizes[i], 1, 1, scales[s], r);
+          test_fused (sizes[i], 2, 3, scales[s], r);
+        }
+  }
+
+  for (i = 0; i < sizeof (scalars) / sizeof (scalars[0]); i++)
+    {
+      const double alpha = scalars[i][0], beta = scalars[i][1];
+
+      for (a = 0; a < 2; a++)
+        {
+          test_dgemv_batch (trans[a], alpha, beta, r);
+          test_mixed_gemv (trans[a], alpha, beta, r);
+
+          for (b = 0; b < 2; b++)
+            {
+              test_dgemm_batch (trans[a], trans[b], alpha, beta, r);
+              test_mixed_gemm (trans[a], trans[b], alpha, beta, r);
+            }
+        }
+    }
+
+  for (s = 0; s < 2; s++)
+    for (u = 0; u < 2; u++)
+      for (a = 0; a < 2; a++)
+        for (d = 0; d < 2; d++)
+          test_dtrsm_batch (s ? CblasRight : CblasLeft,
+                            u ? CblasLower : CblasUpper, trans[a],
+                            d ? CblasUnit : CblasNonUnit, 0.5 + s, r);
+
+  test_profile (r);
+
+  gsl_set_error_handler_off ();
+  test_batch_invalid (r);
+
+  gsl_rng_free (r);
+
+  exit (gsl_test_summary ());
+}
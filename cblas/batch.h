@@ -0,0 +1,73 @@
+/* cblas/batch.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __CBLAS_BATCH_H__
+#define __CBLAS_BATCH_H__
+
+/*
+ * Instantiation of the small-matrix kernels used by the strided batch
+ * routines (xgemm_batch_strided, xgemv_batch_strided,
+ * xtrsm_batch_strided).
+ *
+ * A kernel template is a header which uses
+ *
+ *   BATCH_N         the length of the contiguous dimension
+ *   BATCH_NMAX      a compile-time bound on BATCH_N
+ *   BATCH_NAME(f)   the name of the instance of function f
+ *
+ * Defining BATCH_KERNEL to the name of the template and including
+ * batch_sizes.h creates an instance for each size in BATCH_SIZES, with
+ * BATCH_N a constant, so that the compiler can unroll the inner loops
+ * and keep a row of the result in registers, and a generic instance
+ * f_any with BATCH_N equal to the parameter n (at most BATCH_MAX).
+ * BATCH_CALL(f, n, args) calls the instance of f for size n.
+ *
+ * The same tasks serve the group routines (xgemm_batch, xgemv_batch,
+ * xtrsm_batch), where the problems of a group are given by arrays of
+ * pointers instead of a base pointer and a stride.
+ */
+
+#define BATCH_MAX 32
+
+/* problems with a contiguous dimension of at most BATCH_MAX and other
+   dimensions of at most BATCH_MAX_OUTER use the kernels; larger ones
+   are passed to the full routine */
+#define BATCH_MAX_OUTER 64
+
+/* problem b of a batch given either by the array of pointers Xp, or
+   when Xp is null by the base pointer X and the stride */
+#define BATCH_PTR(Xp,X,stride,b) \
+  ((Xp) ? (Xp)[b] : (X) + (size_t) (stride) * (b))
+
+#define BATCH_CALL(f,n,args) \
+  do { \
+    switch (n) { \
+    case 1: f ## _1 args; break; \
+    case 2: f ## _2 args; break; \
+    case 3: f ## _3 args; break; \
+    case 4: f ## _4 args; break; \
+    case 6: f ## _6 args; break; \
+    case 8: f ## _8 args; break; \
+    case 16: f ## _16 args; break; \
+    case 32: f ## _32 args; break; \
+    default: f ## _any args; break; \
+    } \
+  } while (0)
+
+#endif /* __CBLAS_BATCH_H__ */
@@ -0,0 +1,93 @@
+/* cblas/batch_sizes.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Included with BATCH_KERNEL defined; see batch.h. The sizes must
+   match the cases of BATCH_CALL. */
+
+#define BATCH_N 1
+#define BATCH_NMAX 1
+#define BATCH_NAME(f) f ## _1
+#include BATCH_KERNEL
+#undef BATCH_NAME
+#undef BATCH_NMAX
+#undef BATCH_N
+
+#define BATCH_N 2
+#define BATCH_NMAX 2
+#define BATCH_NAME(f) f ## _2
+#include BATCH_KERNEL
+#undef BATCH_NAME
+#undef BATCH_NMAX
+#undef BATCH_N
+
+#define BATCH_N 3
+#define BATCH_NMAX 3
+#define BATCH_NAME(f) f ## _3
+#include BATCH_KERNEL
+#undef BATCH_NAME
+#undef BATCH_NMAX
+#undef BATCH_N
+
+#define BATCH_N 4
+#define BATCH_NMAX 4
+#define BATCH_NAME(f) f ## _4
+#include BATCH_KERNEL
+#undef BATCH_NAME
+#undef BATCH_NMAX
+#undef BATCH_N
+
+#define BATCH_N 6
+#define BATCH_NMAX 6
+#define BATCH_NAME(f) f ## _6
+#include BATCH_KERNEL
+#undef BATCH_NAME
+#undef BATCH_NMAX
+#undef BATCH_N
+
+#define BATCH_N 8
+#define BATCH_NMAX 8
+#define BATCH_NAME(f) f ## _8
+#include BATCH_KERNEL
+#undef BATCH_NAME
+#undef BATCH_NMAX
+#undef BATCH_N
+
+#define BATCH_N 16
+#define BATCH_NMAX 16
+#define BATCH_NAME(f) f ## _16
+#include BATCH_KERNEL
+#undef BATCH_NAME
+#undef BATCH_NMAX
+#undef BATCH_N
+
+#define BATCH_N 32
+#define BATCH_NMAX 32
+#define BATCH_NAME(f) f ## _32
+#include BATCH_KERNEL
+#undef BATCH_NAME
+#undef BATCH_NMAX
+#undef BATCH_N
+
+#define BATCH_N n
+#define BATCH_NMAX BATCH_MAX
+#define BATCH_NAME(f) f ## _any
+#include BATCH_KERNEL
+#undef BATCH_NAME
+#undef BATCH_NMAX
+#undef BATCH_N
@@ -0,0 +1,355 @@
+/* cblas/benchmark.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Timing of the Level-3 kernels. Build with "make benchmark" and run
+ *
+ *   ./benchmark [nmax]
+ *
+ * For each size n the blocked cblas_dgemm is compared with the plain
+ * k-i-j loop which it replaced, and the rate is reported in GFLOP/s.
+ * cblas_dtrsm and cblas_dtrmm are then timed with n-by-n operands for
+ * every combination of side, uplo, trans and diag, next to the
+ * column-oriented loop which cblas_dtrsm used for the left, lower,
+ * no-transpose case before blocking. Finally the rank-k update
+ * cblas_dsyrk, C := A*A' + C with n-by-k A, is compared with its
+ * previous dot-product loop and with cblas_dgemm computing the whole
+ * of C.
+ *
+ * The Level-2 kernels cblas_dgemv and cblas_dger are limited by the
+ * memory bandwidth, and are reported in GB/s of matrix traffic next to
+ * a copy of the same n-by-n matrix with memcpy, which is about the best
+ * a streaming kernel can reach; the last columns give the fraction of
+ * that bandwidth achieved. */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <gsl/gsl_cblas.h>
+
+static double
+seconds (void)
+{
+  return (double) clock () / CLOCKS_PER_SEC;
+}
+
+static void
+fill (double *x, const size_t n, unsigned long seed)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      seed = (seed * 1103515245UL + 12345UL) & 0x7fffffffUL;
+      x[i] = (double) seed / 2147483648.0 - 0.5;
+    }
+}
+
+/* the unblocked C := A*B + C loop previously used by cblas_dgemm */
+static void
+loop_dgemm (const int n, const double *A, const double *B, double *C)
+{
+  int i, j, k;
+
+  for (k = 0; k < n; k++)
+    {
+      for (i = 0; i < n; i++)
+        {
+          const double temp = A[n * i + k];
+          if (temp != 0.0)
+            {
+              for (j = 0; j < n; j++)
+                C[n * i + j] += temp * B[n * k + j];
+            }
+        }
+    }
+}
+
+/* the unblocked B := inv(A)*B loop previously used by cblas_dtrsm for
+   side = left, uplo = lower, trans = no-transpose, diag = non-unit */
+static void
+loop_dtrsm (const int n, const double *A, double *B)
+{
+  int i, j, k;
+
+  for (i = 0; i < n; i++)
+    {
+      const double Aii = A[n * i + i];
+
+      for (j = 0; j < n; j++)
+        B[n * i + j] /= Aii;
+
+      for (k = i + 1; k < n; k++)
+        {
+          const double Aki = A[n * k + i];
+          for (j = 0; j < n; j++)
+            B[n * k + j] -= Aki * B[n * i + j];
+        }
+    }
+}
+
+/* the unblocked upper, no-transpose loop previously used by cblas_dsyrk */
+static void
+loop_dsyrk (const int n, const int k, const double *A, double *C)
+{
+  int i, j, p;
+
+  for (i = 0; i < n; i++)
+    {
+      for (j = i; j < n; j++)
+        {
+          double temp = 0.0;
+          for (p = 0; p < k; p++)
+            temp += A[i * k + p] * A[j * k + p];
+          C[i * n + j] += temp;
+        }
+    }
+}
+
+/* the row-major, no-transpose loop previously used by cblas_dgemv */
+static void
+loop_dgemv (const int n, const double *A, const double *X, double *Y)
+{
+  int i, j;
+
+  for (i = 0; i < n; i++)
+    {
+      double temp = 0.0;
+      for (j = 0; j < n; j++)
+        temp += X[j] * A[n * i + j];
+      Y[i] += temp;
+    }
+}
+
+/* run f repeatedly for at least 0.2s and return the time per call */
+#define TIME_CALL(t, call)                              \
+  do {                                                  \
+    size_t nrep = 0;                                    \
+    double t0 = seconds (), t1;                         \
+    do { call; nrep++; t1 = seconds (); }               \
+    while (t1 - t0 < 0.2);                              \
+    t = (t1 - t0) / nrep;                               \
+  } while (0)
+
+static void
+bench_gemm (const int nmax)
+{
+  int n;
+
+  printf ("dgemm: C := A*B + C, row-major, no transpose\n");
+  printf ("%6s %12s %12s %8s\n", "n", "loop GF/s", "block GF/s", "speedup");
+
+  for (n = 64; n <= nmax; n *= 2)
+    {
+      const size_t nn = (size_t) n * n;
+      const double flops = 2.0 * n * (double) n * n;
+      double *A = malloc (nn * sizeof (double));
+      double *B = malloc (nn * sizeof (double));
+      double *C = malloc (nn * sizeof (double));
+      double t_loop, t_block;
+
+      fill (A, nn, 1);
+      fill (B, nn, 2);
+      fill (C, nn, 3);
+
+      TIME_CALL (t_loop, loop_dgemm (n, A, B, C));
+      TIME_CALL (t_block, cblas_dgemm (CblasRowMajor, CblasNoTrans, CblasNoTrans,
+                                       n, n, n, 1.0, A, n, B, n, 1.0, C, n));
+
+      printf ("%6d %12.3f %12.3f %8.2f\n", n,
+              flops / t_loop * 1e-9, flops / t_block * 1e-9, t_loop / t_block);
+
+      free (A);
+      free (B);
+      free (C);
+    }
+}
+
+static void
+bench_trxm (const int nmax)
+{
+  static const int sizes[] = { 100, 200, 500, 1000, 2000, 4000 };
+  size_t is;
+  int side, uplo, trans, diag;
+
+  printf ("\ndtrsm, dtrmm: n-by-n triangular A and B, row-major, GFLOP/s\n");
+  printf ("%6s %5s %5s %5s %5s %10s %10s %10s\n",
+          "n", "side", "uplo", "trans", "diag", "trsm", "trmm", "loop");
+
+  for (is = 0; is < sizeof (sizes) / sizeof (sizes[0]) && sizes[is] <= nmax; is++)
+    {
+      const int n = sizes[is];
+      const size_t nn = (size_t) n * n;
+      const double flops = n * (double) n * n;
+      double *A = malloc (nn * sizeof (double));
+      double *B = malloc (nn * sizeof (double));
+      double *B0 = malloc (nn * sizeof (double));
+      int i;
+
+      /* B is reset before each call, so that repeated solves do not
+         drive it into the subnormal range */
+      fill (B0, nn, 2);
+
+      /* a well conditioned triangular matrix */
+      fill (A, nn, 1);
+      for (i = 0; i < n; i++)
+        A[(size_t) n * i + i] += n;
+
+      for (side = CblasLeft; side <= CblasRight; side++)
+        for (uplo = CblasUpper; uplo <= CblasLower; uplo++)
+          for (trans = CblasNoTrans; trans <= CblasTrans; trans++)
+            for (diag = CblasNonUnit; diag <= CblasUnit; diag++)
+              {
+                double t_trsm, t_trmm, t_loop = 0.0;
+
+#define RESET memcpy (B, B0, nn * sizeof (double))
+                TIME_CALL (t_trsm, (RESET, cblas_dtrsm (CblasRowMajor, side, uplo, trans, diag,
+                                                        n, n, 1.0, A, n, B, n)));
+                TIME_CALL (t_trmm, (RESET, cblas_dtrmm (CblasRowMajor, side, uplo, trans, diag,
+                                                        n, n, 1.0, A, n, B, n)));
+
+                if (side == CblasLeft && uplo == CblasLower && trans == CblasNoTrans
+                    && diag == CblasNonUnit && n <= 1000)
+                  {
+                    TIME_CALL (t_loop, (RESET, loop_dtrsm (n, A, B)));
+                  }
+
+                printf ("%6d %5s %5s %5s %5s %10.3f %10.3f", n,
+                        side == CblasLeft ? "L" : "R", uplo == CblasUpper ? "U" : "L",
+                        trans == CblasNoTrans ? "N" : "T", diag == CblasNonUnit ? "N" : "U",
+                        flops / t_trsm * 1e-9, flops / t_trmm * 1e-9);
+
+                if (t_loop > 0.0)
+                  printf (" %10.3f", flops / t_loop * 1e-9);
+
+                printf ("\n");
+              }
+#undef RESET
+
+      free (A);
+      free (B);
+      free (B0);
+    }
+}
+
+static void
+bench_syrk (const int nmax)
+{
+  static const int ks[] = { 32, 256 };
+  size_t ik;
+  int n;
+
+  printf ("\ndsyrk: C := A*A' + C, n-by-k A, upper, row-major, GFLOP/s of n^2 k\n");
+  printf ("%6s %6s %10s %10s %10s %12s\n", "n", "k", "loop", "syrk", "gemm", "gemm/syrk");
+
+  for (n = 64; n <= nmax; n *= 2)
+    {
+      for (ik = 0; ik < sizeof (ks) / sizeof (ks[0]); ik++)
+        {
+          const int k = ks[ik];
+          const double flops = n * (double) n * k;
+          double *A = malloc ((size_t) n * k * sizeof (double));
+          double *C = malloc ((size_t) n * n * sizeof (double));
+          double t_loop = 0.0, t_syrk, t_gemm;
+
+          fill (A, (size_t) n * k, 1);
+          fill (C, (size_t) n * n, 3);
+
+          if (n <= 1024)
+            TIME_CALL (t_loop, loop_dsyrk (n, k, A, C));
+          TIME_CALL (t_syrk, cblas_dsyrk (CblasRowMajor, CblasUpper, CblasNoTrans,
+                                          n, k, 1.0, A, k, 1.0, C, n));
+          TIME_CALL (t_gemm, cblas_dgemm (CblasRowMajor, CblasNoTrans, CblasTrans,
+                                          n, n, k, 1.0, A, k, A, k, 1.0, C, n));
+
+          printf ("%6d %6d ", n, k);
+          if (t_loop > 0.0)
+            printf ("%10.3f ", flops / t_loop * 1e-9);
+          else
+            printf ("%10s ", "-");
+          printf ("%10.3f %10.3f %12.2f\n", flops / t_syrk * 1e-9,
+                  flops / t_gemm * 1e-9, t_gemm / t_syrk);
+
+          free (A);
+          free (C);
+        }
+    }
+}
+
+static void
+bench_gemv (const int nmax)
+{
+  int n;
+
+  printf ("\ndgemv and dger: n-by-n A, GB/s of matrix traffic, and fraction of memcpy\n");
+  printf ("%6s %8s %8s %8s %8s %8s %8s %6s %6s %6s\n", "n", "memcpy", "loop",
+          "row N", "row T", "col N", "ger", "N", "T", "ger");
+
+  for (n = 256; n <= 4 * nmax; n *= 2)
+    {
+      const size_t nn = (size_t) n * n;
+      const double bytes = nn * sizeof (double);
+      double *A = malloc (nn * sizeof (double));
+      double *B = malloc (nn * sizeof (double));
+      double *X = malloc (n * sizeof (double));
+      double *Y = malloc (n * sizeof (double));
+      double t_copy, t_loop, t_rn, t_rt, t_cn, t_ger;
+
+      fill (A, nn, 1);
+      fill (X, n, 2);
+      fill (Y, n, 3);
+
+      /* memcpy reads and writes the matrix, as dger does */
+      TIME_CALL (t_copy, memcpy (B, A, nn * sizeof (double)));
+      TIME_CALL (t_loop, loop_dgemv (n, A, X, Y));
+      TIME_CALL (t_rn, cblas_dgemv (CblasRowMajor, CblasNoTrans, n, n, 1.0,
+                                    A, n, X, 1, 1.0, Y, 1));
+      TIME_CALL (t_rt, cblas_dgemv (CblasRowMajor, CblasTrans, n, n, 1.0,
+                                    A, n, X, 1, 1.0, Y, 1));
+      TIME_CALL (t_cn, cblas_dgemv (CblasColMajor, CblasNoTrans, n, n, 1.0,
+                                    A, n, X, 1, 1.0, Y, 1));
+      TIME_CALL (t_ger, cblas_dger (CblasRowMajor, n, n, 1.0e-3, X, 1, Y, 1,
+                                    A, n));
+
+      printf ("%6d %8.2f %8.2f %8.2f %8.2f %8.2f %8.2f %6.2f %6.2f %6.2f\n", n,
+              2 * bytes / t_copy * 1e-9, bytes / t_loop * 1e-9,
+              bytes / t_rn * 1e-9, bytes / t_rt * 1e-9, bytes / t_cn * 1e-9,
+              2 * bytes / t_ger * 1e-9, 0.5 * t_copy / t_rn,
+              0.5 * t_copy / t_rt, t_copy / t_ger);
+
+      free (A);
+      free (B);
+      free (X);
+      free (Y);
+    }
+}
+
+int
+main (int argc, char *argv[])
+{
+  const int nmax = (argc > 1) ? atoi (argv[1]) : 1024;
+
+  bench_gemm (nmax);
+  bench_trxm (nmax);
+  bench_syrk (nmax);
+  bench_gemv (nmax);
+
+  return 0;
+}
@@ -2,6 +2,13 @@
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
 #include "error_cblas_l3.h"
+#include "thread.h"
+
+#define GEMM_BLOCK_RUN_ONLY
+#define BASE float
+#include "gemm_block_c.h"
+#undef BASE
+#undef GEMM_BLOCK_RUN_ONLY
 
 void
 cblas_cher2k (const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo,
@@ -2,6 +2,11 @@
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
 #include "error_cblas_l3.h"
+#include "thread.h"
+
+#define BASE float
+#include "gemm_block_c.h"
+#undef BASE
 
 void
 cblas_csyrk (const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo,
@@ -1,10 +1,17 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "kernels_l1.h"
 
 double
 cblas_dasum (const int N, const double *X, const int incX)
 {
+  if (incX == 1) {
+    double (*dasum) (const int, const double *) = CBLAS_L1_KERNEL(dasum, N);
+    if (dasum != NULL)
+      return dasum(N, X);
+  }
+
 #define BASE double
 #include "source_asum_r.h"
 #undef BASE
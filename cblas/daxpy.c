@@ -1,11 +1,20 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "kernels_l1.h"
 
 void
 cblas_daxpy (const int N, const double alpha, const double *X, const int incX,
              double *Y, const int incY)
 {
+  if (incX == 1 && incY == 1 && alpha != 0.0) {
+    void (*daxpy) (const int, const double, const double *, double *) = CBLAS_L1_KERNEL(daxpy, N);
+    if (daxpy != NULL) {
+      daxpy(N, alpha, X, Y);
+      return;
+    }
+  }
+
 #define BASE double
 #include "source_axpy_r.h"
 #undef BASE
@@ -1,11 +1,18 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "kernels_l1.h"
 
 double
 cblas_ddot (const int N, const double *X, const int incX, const double *Y,
             const int incY)
 {
+  if (incX == 1 && incY == 1) {
+    double (*ddot) (const int, const double *, const double *) = CBLAS_L1_KERNEL(ddot, N);
+    if (ddot != NULL)
+      return ddot(N, X, Y);
+  }
+
 #define INIT_VAL  0.0
 #define ACC_TYPE  double
 #define BASE double
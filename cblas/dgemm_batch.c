@@ -0,0 +1,42 @@
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_cblas.h>
+#include "cblas.h"
+#include "error_cblas_l3.h"
+#include "thread.h"
+
+#define BASE double
+#define GEMM cblas_dgemm
+#include "gemm_batch_r.h"
+#undef GEMM
+#undef BASE
+
+void
+cblas_dgemm_batch_strided (const enum CBLAS_ORDER Order,
+                            const enum CBLAS_TRANSPOSE TransA,
+                            const enum CBLAS_TRANSPOSE TransB, const int M,
+                            const int N, const int K, const double alpha,
+                            const double *A, const int lda, const int stridea,
+                            const double *B, const int ldb, const int strideb,
+                            const double beta, double *C, const int ldc,
+                            const int stridec, const int batch_size)
+{
+#define BASE double
+#include "source_gemm_batch_r.h"
+#undef BASE
+}
+
+void
+cblas_dgemm_batch (const enum CBLAS_ORDER Order,
+                   const enum CBLAS_TRANSPOSE *TransA_array,
+                   const enum CBLAS_TRANSPOSE *TransB_array,
+                   const int *M_array, const int *N_array, const int *K_array,
+                   const double *alpha_array, const double **A_array,
+                   const int *lda_array, const double **B_array,
+                   const int *ldb_array, const double *beta_array,
+                   double **C_array, const int *ldc_array,
+                   const int group_count, const int *group_size)
+{
+#define BASE double
+#include "source_gemm_group_r.h"
+#undef BASE
+}
@@ -3,6 +3,11 @@
 #include "cblas.h"
 #include "error_cblas_l2.h"
 
+#define BASE double
+#define GEMV_USE_KERNELS
+#include "gemv_block_r.h"
+#undef BASE
+
 void
 cblas_dgemv (const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE TransA,
              const int M, const int N, const double alpha, const double *A,
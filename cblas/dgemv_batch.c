@@ -0,0 +1,40 @@
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_cblas.h>
+#include "cblas.h"
+#include "error_cblas_l2.h"
+#include "thread.h"
+
+#define BASE double
+#define GEMV cblas_dgemv
+#include "gemv_batch_r.h"
+#undef GEMV
+#undef BASE
+
+void
+cblas_dgemv_batch_strided (const enum CBLAS_ORDER order,
+                            const enum CBLAS_TRANSPOSE TransA, const int M,
+                            const int N, const double alpha, const double *A,
+                            const int lda, const int stridea, const double *X,
+                            const int incX, const int stridex,
+                            const double beta, double *Y, const int incY,
+                            const int stridey, const int batch_size)
+{
+#define BASE double
+#include "source_gemv_batch_r.h"
+#undef BASE
+}
+
+void
+cblas_dgemv_batch (const enum CBLAS_ORDER order,
+                   const enum CBLAS_TRANSPOSE *TransA_array,
+                   const int *M_array, const int *N_array,
+                   const double *alpha_array, const double **A_array,
+                   const int *lda_array, const double **X_array,
+                   const int *incX_array, const double *beta_array,
+                   double **Y_array, const int *incY_array,
+                   const int group_count, const int *group_size)
+{
+#define BASE double
+#include "source_gemv_group_r.h"
+#undef BASE
+}
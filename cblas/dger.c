@@ -3,6 +3,13 @@
 #include "cblas.h"
 #include "error_cblas_l2.h"
 
+#define BASE double
+#define GEMV_USE_KERNELS
+#define GEMV_BLOCK_GER
+#include "gemv_block_r.h"
+#undef GEMV_BLOCK_GER
+#undef BASE
+
 void
 cblas_dger (const enum CBLAS_ORDER order, const int M, const int N,
             const double alpha, const double *X, const int incX,
@@ -1,10 +1,22 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "kernels_l1.h"
 
 double
 cblas_dnrm2 (const int N, const double *X, const int incX)
 {
+  /* use the unscaled sum of squares when it is safe from overflow and
+     from loss of accuracy through underflow */
+  if (incX == 1) {
+    double (*dssq) (const int, const double *) = CBLAS_L1_KERNEL(dssq, N);
+    if (dssq != NULL) {
+      const double ssq = dssq(N, X);
+      if (ssq >= N * (GSL_DBL_MIN / GSL_DBL_EPSILON) && ssq <= GSL_DBL_MAX)
+        return sqrt(ssq);
+    }
+  }
+
 #define BASE double
 #include "source_nrm2_r.h"
 #undef BASE
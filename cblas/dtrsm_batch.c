@@ -0,0 +1,43 @@
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_cblas.h>
+#include "cblas.h"
+#include "error_cblas_l3.h"
+#include "thread.h"
+
+#define BASE double
+#define TRSM cblas_dtrsm
+#include "trsm_batch_r.h"
+#undef TRSM
+#undef BASE
+
+void
+cblas_dtrsm_batch_strided (const enum CBLAS_ORDER Order,
+                            const enum CBLAS_SIDE Side,
+                            const enum CBLAS_UPLO Uplo,
+                            const enum CBLAS_TRANSPOSE TransA,
+                            const enum CBLAS_DIAG Diag, const int M,
+                            const int N, const double alpha, const double *A,
+                            const int lda, const int stridea, double *B,
+                            const int ldb, const int strideb,
+                            const int batch_size)
+{
+#define BASE double
+#include "source_trsm_batch_r.h"
+#undef BASE
+}
+
+void
+cblas_dtrsm_batch (const enum CBLAS_ORDER Order,
+                   const enum CBLAS_SIDE *Side_array,
+                   const enum CBLAS_UPLO *Uplo_array,
+                   const enum CBLAS_TRANSPOSE *TransA_array,
+                   const enum CBLAS_DIAG *Diag_array, const int *M_array,
+                   const int *N_array, const double *alpha_array,
+                   const double **A_array, const int *lda_array,
+                   double **B_array, const int *ldb_array,
+                   const int group_count, const int *group_size)
+{
+#define BASE double
+#include "source_trsm_group_r.h"
+#undef BASE
+}
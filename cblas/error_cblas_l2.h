@@ -49,6 +49,37 @@ if((order)==CblasRowMajor) { \
 CHECK_STRIDE(pos,9,incX); \
 CHECK_STRIDE(pos,12,incY);
 
+/* cblas_xgemv_batch_strided(): the arguments of xgemv with the stride
+   of each matrix and vector after its leading dimension or increment,
+   and the batch size last */
+#define CBLAS_ERROR_GEMV_BATCH(pos,order,TransA,M,N,alpha,A,lda,stridea,X,incX,stridex,beta,Y,incY,stridey,batch_size) \
+{ \
+    const int __lenY = ((TransA)==CblasNoTrans) ? (M) : (N); \
+    CBLAS_ERROR_GEMV(pos,order,TransA,M,N,alpha,A,lda,X,incX,beta,Y,incY) \
+    if((pos)>=10) { \
+        (pos) += 2; \
+    } else if((pos)>=8) { \
+        (pos) += 1; \
+    } \
+    CHECK_DIM(pos,8,stridea); \
+    CHECK_DIM(pos,11,stridex); \
+    if((batch_size)>1 && __lenY>0 \
+       && (stridey)<1+(__lenY-1)*(((incY)<0) ? -(incY) : (incY))) { \
+        (pos) = 15; \
+    } \
+    CHECK_DIM(pos,16,batch_size); \
+}
+
+/* cblas_xgemv_batch(): the arguments of xgemv as arrays over the
+   groups, then group_count and group_size; checked for each group g
+   with the parameters of that group */
+#define CBLAS_ERROR_GEMV_GROUP(pos,order,TransA,M,N,alpha,A,lda,X,incX,beta,Y,incY,group_count,group_size) \
+{ \
+    CBLAS_ERROR_GEMV(pos,order,TransA,M,N,alpha,A,lda,X,incX,beta,Y,incY) \
+    CHECK_DIM(pos,13,group_count); \
+    CHECK_DIM(pos,14,group_size); \
+}
+
 /* cblas_xgbmv() */
 #define CBLAS_ERROR_GBMV(pos,order,TransA,M,N,KL,KU,alpha,A,lda,X,incX,beta,Y,incY) \
 CHECK_ORDER(pos,1,order); \
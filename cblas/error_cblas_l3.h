@@ -227,6 +227,66 @@
 #define CBLAS_ERROR_TRSM(pos,Order,Side,Uplo,TransA,Diag,M,N,alpha,A,lda,B,ldb) \
 CBLAS_ERROR_TRMM(pos,Order,Side,Uplo,TransA,Diag,M,N,alpha,A,lda,B,ldb)
 
+/*
+ * Strided batch routines (S and D). The arguments are those of the
+ * single routine with the stride of each matrix after its leading
+ * dimension and the batch size last, so the positions reported by the
+ * checks of the single routine are shifted accordingly.
+ */
+
+/* cblas_xgemm_batch_strided() */
+#define CBLAS_ERROR_GEMM_BATCH(pos,Order,TransA,TransB,M,N,K,alpha,A,lda,stridea,B,ldb,strideb,beta,C,ldc,stridec,batch_size) \
+{ \
+    CBLAS_ERROR_GEMM(pos,Order,TransA,TransB,M,N,K,alpha,A,lda,B,ldb,beta,C,ldc) \
+    if((pos)>=12) { \
+        (pos) += 2; \
+    } else if((pos)>=10) { \
+        (pos) += 1; \
+    } \
+    CHECK_DIM(pos,10,stridea); \
+    CHECK_DIM(pos,13,strideb); \
+    if((batch_size)>1 && (stridec)<(((Order)==CblasRowMajor) ? (M) : (N))*(ldc)) { \
+        (pos) = 17; \
+    } \
+    CHECK_DIM(pos,18,batch_size); \
+}
+
+/* cblas_xtrsm_batch_strided() */
+#define CBLAS_ERROR_TRSM_BATCH(pos,Order,Side,Uplo,TransA,Diag,M,N,alpha,A,lda,stridea,B,ldb,strideb,batch_size) \
+{ \
+    CBLAS_ERROR_TRSM(pos,Order,Side,Uplo,TransA,Diag,M,N,alpha,A,lda,B,ldb) \
+    if((pos)>=11) { \
+        (pos) += 1; \
+    } \
+    CHECK_DIM(pos,11,stridea); \
+    if((batch_size)>1 && (strideb)<(((Order)==CblasRowMajor) ? (M) : (N))*(ldb)) { \
+        (pos) = 14; \
+    } \
+    CHECK_DIM(pos,15,batch_size); \
+}
+
+/*
+ * Group batch routines (S and D). The arguments are those of the
+ * single routine as arrays over the groups, then group_count and
+ * group_size; each group g is checked with its own parameters.
+ */
+
+/* cblas_xgemm_batch() */
+#define CBLAS_ERROR_GEMM_GROUP(pos,Order,TransA,TransB,M,N,K,alpha,A,lda,B,ldb,beta,C,ldc,group_count,group_size) \
+{ \
+    CBLAS_ERROR_GEMM(pos,Order,TransA,TransB,M,N,K,alpha,A,lda,B,ldb,beta,C,ldc) \
+    CHECK_DIM(pos,15,group_count); \
+    CHECK_DIM(pos,16,group_size); \
+}
+
+/* cblas_xtrsm_batch() */
+#define CBLAS_ERROR_TRSM_GROUP(pos,Order,Side,Uplo,TransA,Diag,M,N,alpha,A,lda,B,ldb,group_count,group_size) \
+{ \
+    CBLAS_ERROR_TRSM(pos,Order,Side,Uplo,TransA,Diag,M,N,alpha,A,lda,B,ldb) \
+    CHECK_DIM(pos,13,group_count); \
+    CHECK_DIM(pos,14,group_size); \
+}
+
 /*
  * Routines with prefixes C and Z only
  */
@@ -0,0 +1,69 @@
+/* cblas/gemm_batch_kernel_r.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* C := alpha*op(F)*op(G) + beta*C for a row-major n1-by-BATCH_N matrix
+   C, with op(F)(i,k) = F[rsf*i + csf*k] and op(G)(k,j) = G[rsg*k +
+   csg*j]. alpha must be nonzero. */
+
+static void
+BATCH_NAME (gemm_batch_kernel) (const int n1, const int n, const int K,
+                                const BASE alpha, const BASE * F,
+                                const int rsf, const int csf, const BASE * G,
+                                const int rsg, const int csg, const BASE beta,
+                                BASE * C, const int ldc)
+{
+  int i, j, k;
+  (void) n;                     /* used only as BATCH_N in the _any instance */
+
+  for (i = 0; i < n1; i++) {
+    BASE c[BATCH_NMAX];
+
+    for (j = 0; j < BATCH_N; j++) {
+      c[j] = 0.0;
+    }
+
+    if (csg == 1) {
+      for (k = 0; k < K; k++) {
+        const BASE f = F[rsf * i + csf * k];
+        const BASE *g = G + rsg * k;
+        for (j = 0; j < BATCH_N; j++) {
+          c[j] += f * g[j];
+        }
+      }
+    } else {
+      for (k = 0; k < K; k++) {
+        const BASE f = F[rsf * i + csf * k];
+        const BASE *g = G + rsg * k;
+        for (j = 0; j < BATCH_N; j++) {
+          c[j] += f * g[csg * j];
+        }
+      }
+    }
+
+    if (beta == 0.0) {
+      for (j = 0; j < BATCH_N; j++) {
+        C[ldc * i + j] = alpha * c[j];
+      }
+    } else {
+      for (j = 0; j < BATCH_N; j++) {
+        C[ldc * i + j] = alpha * c[j] + beta * C[ldc * i + j];
+      }
+    }
+  }
+}
@@ -0,0 +1,187 @@
+/* cblas/gemm_batch_r.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Batch GEMM for real types. This file is included at file scope with
+ * BASE defined and GEMM defined to the corresponding cblas_xgemm, and
+ * provides
+ *
+ * gemm_batch_task (arg, first, last)
+ *
+ * a task for gsl_cblas_parallel_batch which computes
+ * C_p := alpha*op(A_p)*op(B_p) + beta*C_p for problems p = first, ...,
+ * last - 1 of the batch described by arg, where X_p = Xp[p], or
+ * X_p = X + p*strideX for a strided batch (Xp null). Small problems
+ * (see batch.h) use kernels specialized for the number of columns of
+ * the row-major form of C; other problems call GEMM.
+ *
+ * gemm_group_task (arg, first, last)
+ *
+ * the same for problems first, ..., last - 1 of the groups described
+ * by arg, numbered consecutively through the groups.
+ */
+
+#include "batch.h"
+
+typedef struct
+{
+  enum CBLAS_ORDER Order;
+  enum CBLAS_TRANSPOSE TransA, TransB;
+  int M, N, K;
+  BASE alpha, beta;
+  const BASE *A;
+  int lda, stridea;
+  const BASE *B;
+  int ldb, strideb;
+  BASE *C;
+  int ldc, stridec;
+  const BASE *const *Ap;
+  const BASE *const *Bp;
+  BASE *const *Cp;
+} gemm_batch_args;
+
+typedef struct
+{
+  enum CBLAS_ORDER Order;
+  const enum CBLAS_TRANSPOSE *TransA, *TransB;
+  const int *M, *N, *K;
+  const BASE *alpha, *beta;
+  const BASE **A;
+  const int *lda;
+  const BASE **B;
+  const int *ldb;
+  BASE **C;
+  const int *ldc;
+  int group_count;
+  const int *group_size;
+} gemm_group_args;
+
+#define BATCH_KERNEL "gemm_batch_kernel_r.h"
+#include "batch_sizes.h"
+#undef BATCH_KERNEL
+
+static void
+gemm_batch_task (void *arg, const int first, const int last)
+{
+  const gemm_batch_args *p = (const gemm_batch_args *) arg;
+  const int small = (p->alpha != 0.0);
+  int n1, n2, ldf, ldg, TransF, TransG;
+  int rsf, csf, rsg, csg;
+  int stridef, strideg;
+  const BASE *F, *G;
+  const BASE *const *Fp, *const *Gp;
+  int b;
+
+  if (p->Order == CblasRowMajor) {
+    n1 = p->M;
+    n2 = p->N;
+    F = p->A;
+    Fp = p->Ap;
+    ldf = p->lda;
+    stridef = p->stridea;
+    TransF = (p->TransA == CblasConjTrans) ? CblasTrans : p->TransA;
+    G = p->B;
+    Gp = p->Bp;
+    ldg = p->ldb;
+    strideg = p->strideb;
+    TransG = (p->TransB == CblasConjTrans) ? CblasTrans : p->TransB;
+  } else {
+    n1 = p->N;
+    n2 = p->M;
+    F = p->B;
+    Fp = p->Bp;
+    ldf = p->ldb;
+    stridef = p->strideb;
+    TransF = (p->TransB == CblasConjTrans) ? CblasTrans : p->TransB;
+    G = p->A;
+    Gp = p->Ap;
+    ldg = p->lda;
+    strideg = p->stridea;
+    TransG = (p->TransA == CblasConjTrans) ? CblasTrans : p->TransA;
+  }
+
+  rsf = (TransF == CblasNoTrans) ? ldf : 1;
+  csf = (TransF == CblasNoTrans) ? 1 : ldf;
+  rsg = (TransG == CblasNoTrans) ? ldg : 1;
+  csg = (TransG == CblasNoTrans) ? 1 : ldg;
+
+  if (small && n2 <= BATCH_MAX && n1 <= BATCH_MAX_OUTER
+      && p->K <= BATCH_MAX_OUTER) {
+    for (b = first; b < last; b++) {
+      BATCH_CALL (gemm_batch_kernel, n2,
+                  (n1, n2, p->K, p->alpha, BATCH_PTR (Fp, F, stridef, b),
+                   rsf, csf, BATCH_PTR (Gp, G, strideg, b), rsg, csg,
+                   p->beta, BATCH_PTR (p->Cp, p->C, p->stridec, b),
+                   p->ldc));
+    }
+  } else {
+    for (b = first; b < last; b++) {
+      GEMM (p->Order, p->TransA, p->TransB, p->M, p->N, p->K, p->alpha,
+            BATCH_PTR (p->Ap, p->A, p->stridea, b), p->lda,
+            BATCH_PTR (p->Bp, p->B, p->strideb, b), p->ldb, p->beta,
+            BATCH_PTR (p->Cp, p->C, p->stridec, b), p->ldc);
+    }
+  }
+}
+
+static void
+gemm_group_task (void *arg, const int first, const int last)
+{
+  const gemm_group_args *p = (const gemm_group_args *) arg;
+  int g = 0, start = 0;
+
+  /* find the group of problem first */
+  while (g < p->group_count && start + p->group_size[g] <= first) {
+    start += p->group_size[g];
+    g++;
+  }
+
+  for (; g < p->group_count && start < last; g++) {
+    const int lo = GSL_MAX (first, start) - start;
+    const int hi = GSL_MIN (last, start + p->group_size[g]) - start;
+    gemm_batch_args q;
+
+    q.Order = p->Order;
+    q.TransA = p->TransA[g];
+    q.TransB = p->TransB[g];
+    q.M = p->M[g];
+    q.N = p->N[g];
+    q.K = p->K[g];
+    q.alpha = p->alpha[g];
+    q.beta = p->beta[g];
+    q.A = 0;
+    q.lda = p->lda[g];
+    q.stridea = 0;
+    q.B = 0;
+    q.ldb = p->ldb[g];
+    q.strideb = 0;
+    q.C = 0;
+    q.ldc = p->ldc[g];
+    q.stridec = 0;
+    q.Ap = p->A + start;
+    q.Bp = p->B + start;
+    q.Cp = p->C + start;
+
+    if (hi > lo && q.M != 0 && q.N != 0
+        && !(q.alpha == 0.0 && q.beta == 1.0))
+      gemm_batch_task (&q, lo, hi);
+
+    start += p->group_size[g];
+  }
+}
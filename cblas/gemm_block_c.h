@@ -0,0 +1,293 @@
+/* cblas/gemm_block_c.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Packed-panel GEMM engine for complex types, with the same blocking
+ * structure as gemm_block_r.h. This file is included at file scope with
+ * BASE defined as the underlying real type, and provides
+ *
+ * gemm_block (TransF, conjF, TransG, conjG, uplo, n1, n2, K, alpha_real,
+ *             alpha_imag, F, ldf, G, ldg, C, ldc)
+ *
+ * which computes C := alpha*op(F)*op(G) + C. The conjugation of F and G
+ * (conjF, conjG = -1) is applied while packing, so the micro-kernel only
+ * sees plain complex products. Packed panels store the real and
+ * imaginary parts of each element next to each other. As for the real
+ * engine, uplo = CblasUpper or CblasLower restricts the update to one
+ * triangle of C (syrk, herk, syr2k, her2k) and uplo = 0 updates all of C.
+ *
+ * The function returns 0 on success, or -1 if the packing buffers could
+ * not be allocated.
+ *
+ * As in gemm_block_r.h, callers that only use gemm_block_alloc and
+ * gemm_block_run (syr2k, her2k) define GEMM_BLOCK_RUN_ONLY before
+ * including this file, which then leaves out gemm_block.
+ */
+
+#include <stdlib.h>
+
+#ifndef GEMM_MR
+#define GEMM_MR 2
+#endif
+
+#ifndef GEMM_NR
+#define GEMM_NR 4
+#endif
+
+#ifndef GEMM_MC
+#define GEMM_MC 64
+#endif
+
+#ifndef GEMM_KC
+#define GEMM_KC 256
+#endif
+
+#ifndef GEMM_NC
+#define GEMM_NC 2048
+#endif
+
+/* use the packed engine when the product has at least this many flops */
+#ifndef GEMM_BLOCK_MIN
+#define GEMM_BLOCK_MIN (16 * 16 * 16)
+#endif
+
+#define GEMM_USE_BLOCK(n1,n2,K) \
+  ((n1) >= GEMM_MR && (n2) >= GEMM_NR && \
+   (double) (n1) * (double) (n2) * (double) (K) >= GEMM_BLOCK_MIN)
+
+/* triangle tests for a tile of C, as in gemm_block_r.h */
+#define GEMM_TILE_SKIP(uplo,d,mr,nr) \
+  (((uplo) == CblasUpper && (d) + (nr) <= 0) || \
+   ((uplo) == CblasLower && (d) >= (mr)))
+
+#define GEMM_ROW_FIRST(uplo,d,i) \
+  (((uplo) == CblasUpper && (i) > (d)) ? (i) - (d) : 0)
+
+#define GEMM_ROW_END(uplo,d,i,nr) \
+  (((uplo) == CblasLower && (i) - (d) + 1 < (nr)) ? (i) - (d) + 1 : (nr))
+
+static void
+gemm_pack_F (const int TransF, const int conjF, const INDEX mc,
+             const INDEX kc, const BASE *F, const INDEX ldf, BASE *Fp)
+{
+  INDEX i, ir, p;
+
+  for (ir = 0; ir < mc; ir += GEMM_MR)
+    {
+      const INDEX mr = GSL_MIN (GEMM_MR, mc - ir);
+
+      for (p = 0; p < kc; p++)
+        {
+          for (i = 0; i < mr; i++)
+            {
+              const INDEX row = ir + i;
+              const INDEX idx = (TransF == CblasNoTrans) ? ldf * row + p : ldf * p + row;
+              Fp[2 * i] = CONST_REAL (F, idx);
+              Fp[2 * i + 1] = conjF * CONST_IMAG (F, idx);
+            }
+
+          for (; i < GEMM_MR; i++)
+            {
+              Fp[2 * i] = 0.0;
+              Fp[2 * i + 1] = 0.0;
+            }
+
+          Fp += 2 * GEMM_MR;
+        }
+    }
+}
+
+static void
+gemm_pack_G (const int TransG, const int conjG, const INDEX kc,
+             const INDEX nc, const BASE *G, const INDEX ldg, BASE *Gp)
+{
+  INDEX j, jr, p;
+
+  for (jr = 0; jr < nc; jr += GEMM_NR)
+    {
+      const INDEX nr = GSL_MIN (GEMM_NR, nc - jr);
+
+      for (p = 0; p < kc; p++)
+        {
+          for (j = 0; j < nr; j++)
+            {
+              const INDEX col = jr + j;
+              const INDEX idx = (TransG == CblasNoTrans) ? ldg * p + col : ldg * col + p;
+              Gp[2 * j] = CONST_REAL (G, idx);
+              Gp[2 * j + 1] = conjG * CONST_IMAG (G, idx);
+            }
+
+          for (; j < GEMM_NR; j++)
+            {
+              Gp[2 * j] = 0.0;
+              Gp[2 * j + 1] = 0.0;
+            }
+
+          Gp += 2 * GEMM_NR;
+        }
+    }
+}
+
+static void
+gemm_kernel (const INDEX kc, const BASE alpha_real, const BASE alpha_imag,
+             const BASE *Fp, const BASE *Gp, BASE *C, const INDEX ldc,
+             const INDEX mr, const INDEX nr, const int uplo, const INDEX d)
+{
+  BASE ab_real[GEMM_MR * GEMM_NR];
+  BASE ab_imag[GEMM_MR * GEMM_NR];
+  INDEX i, j, p;
+
+  for (i = 0; i < GEMM_MR * GEMM_NR; i++)
+    {
+      ab_real[i] = 0.0;
+      ab_imag[i] = 0.0;
+    }
+
+  for (p = 0; p < kc; p++)
+    {
+      for (i = 0; i < GEMM_MR; i++)
+        {
+          const BASE f_real = Fp[2 * i];
+          const BASE f_imag = Fp[2 * i + 1];
+
+          for (j = 0; j < GEMM_NR; j++)
+            {
+              const BASE g_real = Gp[2 * j];
+              const BASE g_imag = Gp[2 * j + 1];
+              ab_real[i * GEMM_NR + j] += f_real * g_real - f_imag * g_imag;
+              ab_imag[i * GEMM_NR + j] += f_real * g_imag + f_imag * g_real;
+            }
+        }
+
+      Fp += 2 * GEMM_MR;
+      Gp += 2 * GEMM_NR;
+    }
+
+  for (i = 0; i < mr; i++)
+    {
+      const INDEX j0 = GEMM_ROW_FIRST (uplo, d, i);
+      const INDEX j1 = GEMM_ROW_END (uplo, d, i, nr);
+
+      for (j = j0; j < j1; j++)
+        {
+          const BASE t_real = ab_real[i * GEMM_NR + j];
+          const BASE t_imag = ab_imag[i * GEMM_NR + j];
+          REAL (C, ldc * i + j) += alpha_real * t_real - alpha_imag * t_imag;
+          IMAG (C, ldc * i + j) += alpha_real * t_imag + alpha_imag * t_real;
+        }
+    }
+}
+
+/* allocate packing buffers for products of size n1-by-n2-by-K; returns
+   -1 if they cannot be allocated */
+static int
+gemm_block_alloc (const INDEX n1, const INDEX n2, const INDEX K,
+                  BASE **Fp, BASE **Gp)
+{
+  const INDEX mcmax = ((GSL_MIN (GEMM_MC, n1) + GEMM_MR - 1) / GEMM_MR) * GEMM_MR;
+  const INDEX ncmax = ((GSL_MIN (GEMM_NC, n2) + GEMM_NR - 1) / GEMM_NR) * GEMM_NR;
+  const INDEX kcmax = GSL_MIN (GEMM_KC, K);
+
+  *Fp = malloc (2 * sizeof (BASE) * mcmax * kcmax);
+  *Gp = malloc (2 * sizeof (BASE) * ncmax * kcmax);
+
+  if (*Fp == NULL || *Gp == NULL)
+    {
+      free (*Fp);
+      free (*Gp);
+      return -1;
+    }
+
+  return 0;
+}
+
+/* the blocked product, using buffers from gemm_block_alloc */
+static void
+gemm_block_run (const int TransF, const int conjF, const int TransG,
+                const int conjG, const int uplo, const INDEX n1,
+                const INDEX n2, const INDEX K, const BASE alpha_real,
+                const BASE alpha_imag, const BASE *F, const INDEX ldf,
+                const BASE *G, const INDEX ldg, BASE *C, const INDEX ldc,
+                BASE *Fp, BASE *Gp)
+{
+  INDEX ic, jc, pc, ir, jr;
+
+  for (jc = 0; jc < n2; jc += GEMM_NC)
+    {
+      const INDEX nc = GSL_MIN (GEMM_NC, n2 - jc);
+
+      for (pc = 0; pc < K; pc += GEMM_KC)
+        {
+          const INDEX kc = GSL_MIN (GEMM_KC, K - pc);
+          const INDEX gidx = (TransG == CblasNoTrans) ? ldg * pc + jc : ldg * jc + pc;
+
+          gemm_pack_G (TransG, conjG, kc, nc, G + 2 * gidx, ldg, Gp);
+
+          for (ic = 0; ic < n1; ic += GEMM_MC)
+            {
+              const INDEX mc = GSL_MIN (GEMM_MC, n1 - ic);
+              const INDEX fidx = (TransF == CblasNoTrans) ? ldf * ic + pc : ldf * pc + ic;
+
+              gemm_pack_F (TransF, conjF, mc, kc, F + 2 * fidx, ldf, Fp);
+
+              for (jr = 0; jr < nc; jr += GEMM_NR)
+                {
+                  const INDEX nr = GSL_MIN (GEMM_NR, nc - jr);
+
+                  for (ir = 0; ir < mc; ir += GEMM_MR)
+                    {
+                      const INDEX mr = GSL_MIN (GEMM_MR, mc - ir);
+                      const INDEX d = (jc + jr) - (ic + ir);
+
+                      if (GEMM_TILE_SKIP (uplo, d, mr, nr))
+                        continue;
+
+                      gemm_kernel (kc, alpha_real, alpha_imag,
+                                   &Fp[2 * ir * kc], &Gp[2 * jr * kc],
+                                   C + 2 * (ldc * (ic + ir) + jc + jr), ldc,
+                                   mr, nr, uplo, d);
+                    }
+                }
+            }
+        }
+    }
+}
+
+#ifndef GEMM_BLOCK_RUN_ONLY
+static int
+gemm_block (const int TransF, const int conjF, const int TransG,
+            const int conjG, const int uplo, const INDEX n1, const INDEX n2,
+            const INDEX K, const BASE alpha_real, const BASE alpha_imag,
+            const BASE *F, const INDEX ldf, const BASE *G, const INDEX ldg,
+            BASE *C, const INDEX ldc)
+{
+  BASE *Fp, *Gp;
+
+  if (gemm_block_alloc (n1, n2, K, &Fp, &Gp) != 0)
+    return -1;
+
+  gemm_block_run (TransF, conjF, TransG, conjG, uplo, n1, n2, K,
+                  alpha_real, alpha_imag, F, ldf, G, ldg, C, ldc, Fp, Gp);
+
+  free (Fp);
+  free (Gp);
+
+  return 0;
+}
+#endif /* GEMM_BLOCK_RUN_ONLY */
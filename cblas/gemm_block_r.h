@@ -0,0 +1,306 @@
+/* cblas/gemm_block_r.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Packed-panel GEMM engine for real types. This file is included at
+ * file scope with BASE defined, and provides
+ *
+ * gemm_block (TransF, TransG, uplo, n1, n2, K, alpha, F, ldf, G, ldg, C, ldc)
+ *
+ * which computes C := alpha*op(F)*op(G) + C for row-major C (n1-by-n2),
+ * op(F) (n1-by-K) and op(G) (K-by-n2). The beta scaling of C must be
+ * done by the caller.
+ *
+ * With uplo = CblasUpper or CblasLower only that triangle of C is
+ * updated (the rank-k updates syrk and syr2k); tiles lying entirely in
+ * the other triangle are skipped, so the cost is about half that of
+ * the full product. uplo = 0 updates the whole of C.
+ *
+ * Callers that need several products of the same size (syr2k) can
+ * allocate the packing buffers once with gemm_block_alloc and run each
+ * product with gemm_block_run. Such callers define GEMM_BLOCK_RUN_ONLY
+ * before including this file, which then leaves out gemm_block.
+ *
+ * The algorithm follows Goto and van de Geijn, "Anatomy of
+ * High-Performance Matrix Multiplication", ACM TOMS 34(3), 2008:
+ *
+ * for each NC wide column panel of C:
+ *   for each KC deep slice of the inner dimension:
+ *     pack op(G)(KC, NC) into GEMM_NR wide slivers (L1/L3 resident)
+ *     for each MC tall row panel of C:
+ *       pack op(F)(MC, KC) into GEMM_MR tall slivers (L2 resident)
+ *       update each GEMM_MR-by-GEMM_NR tile of C with the micro-kernel
+ *
+ * The micro-kernel keeps the GEMM_MR*GEMM_NR tile in a local array with
+ * compile-time bounds so that the compiler can hold it in registers and
+ * vectorize the rank-1 updates. Partial tiles at the edges are handled
+ * by zero-padding the packed panels.
+ *
+ * The function returns 0 on success, or -1 if the packing buffers could
+ * not be allocated, in which case C is untouched and the caller should
+ * fall back to the unblocked loops.
+ */
+
+#include <stdlib.h>
+
+#ifndef GEMM_MR
+#define GEMM_MR 4
+#endif
+
+#ifndef GEMM_NR
+#define GEMM_NR 4
+#endif
+
+#ifndef GEMM_MC
+#define GEMM_MC 128
+#endif
+
+#ifndef GEMM_KC
+#define GEMM_KC 256
+#endif
+
+#ifndef GEMM_NC
+#define GEMM_NC 4096
+#endif
+
+/* use the packed engine when the product has at least this many flops */
+#ifndef GEMM_BLOCK_MIN
+#define GEMM_BLOCK_MIN (32 * 32 * 32)
+#endif
+
+#define GEMM_USE_BLOCK(n1,n2,K) \
+  ((n1) >= GEMM_MR && (n2) >= GEMM_NR && \
+   (double) (n1) * (double) (n2) * (double) (K) >= GEMM_BLOCK_MIN)
+
+/* Triangle tests for an mr-by-nr tile of C whose first column is d
+   columns to the right of the diagonal through its first row */
+#define GEMM_TILE_SKIP(uplo,d,mr,nr) \
+  (((uplo) == CblasUpper && (d) + (nr) <= 0) || \
+   ((uplo) == CblasLower && (d) >= (mr)))
+
+#define GEMM_TILE_FULL(uplo,d) \
+  ((uplo) == 0 || \
+   ((uplo) == CblasUpper && (d) >= GEMM_MR - 1) || \
+   ((uplo) == CblasLower && (d) <= 1 - GEMM_NR))
+
+/* range j0 <= j < j1 of columns of row i of the tile to be stored */
+#define GEMM_ROW_FIRST(uplo,d,i) \
+  (((uplo) == CblasUpper && (i) > (d)) ? (i) - (d) : 0)
+
+#define GEMM_ROW_END(uplo,d,i,nr) \
+  (((uplo) == CblasLower && (i) - (d) + 1 < (nr)) ? (i) - (d) + 1 : (nr))
+
+/* pack op(F)(i0:i0+mc-1, p0:p0+kc-1) into slivers of GEMM_MR rows; within
+ * a sliver, element (i,p) is stored at Fp[p*GEMM_MR + i] */
+static void
+gemm_pack_F (const int TransF, const INDEX mc, const INDEX kc,
+             const BASE *F, const INDEX ldf, BASE *Fp)
+{
+  INDEX i, ir, p;
+
+  for (ir = 0; ir < mc; ir += GEMM_MR)
+    {
+      const INDEX mr = GSL_MIN (GEMM_MR, mc - ir);
+
+      for (p = 0; p < kc; p++)
+        {
+          for (i = 0; i < mr; i++)
+            {
+              const INDEX row = ir + i;
+              Fp[i] = (TransF == CblasNoTrans) ? F[ldf * row + p] : F[ldf * p + row];
+            }
+
+          for (; i < GEMM_MR; i++)
+            Fp[i] = 0.0;
+
+          Fp += GEMM_MR;
+        }
+    }
+}
+
+/* pack op(G)(p0:p0+kc-1, j0:j0+nc-1) into slivers of GEMM_NR columns;
+ * within a sliver, element (p,j) is stored at Gp[p*GEMM_NR + j] */
+static void
+gemm_pack_G (const int TransG, const INDEX kc, const INDEX nc,
+             const BASE *G, const INDEX ldg, BASE *Gp)
+{
+  INDEX j, jr, p;
+
+  for (jr = 0; jr < nc; jr += GEMM_NR)
+    {
+      const INDEX nr = GSL_MIN (GEMM_NR, nc - jr);
+
+      for (p = 0; p < kc; p++)
+        {
+          for (j = 0; j < nr; j++)
+            {
+              const INDEX col = jr + j;
+              Gp[j] = (TransG == CblasNoTrans) ? G[ldg * p + col] : G[ldg * col + p];
+            }
+
+          for (; j < GEMM_NR; j++)
+            Gp[j] = 0.0;
+
+          Gp += GEMM_NR;
+        }
+    }
+}
+
+/* C(0:mr-1,0:nr-1) += alpha * Fp * Gp for one packed sliver pair. If
+ * uplo is CblasUpper (CblasLower) only the elements on or above (below)
+ * the diagonal of the full matrix are stored, where the tile starts d
+ * columns to the right of the diagonal. */
+static void
+gemm_kernel (const INDEX kc, const BASE alpha, const BASE *Fp,
+             const BASE *Gp, BASE *C, const INDEX ldc,
+             const INDEX mr, const INDEX nr, const int uplo, const INDEX d)
+{
+  BASE ab[GEMM_MR * GEMM_NR];
+  INDEX i, j, p;
+
+  for (i = 0; i < GEMM_MR * GEMM_NR; i++)
+    ab[i] = 0.0;
+
+  for (p = 0; p < kc; p++)
+    {
+      for (i = 0; i < GEMM_MR; i++)
+        {
+          const BASE f = Fp[i];
+
+          for (j = 0; j < GEMM_NR; j++)
+            ab[i * GEMM_NR + j] += f * Gp[j];
+        }
+
+      Fp += GEMM_MR;
+      Gp += GEMM_NR;
+    }
+
+  if (mr == GEMM_MR && nr == GEMM_NR && GEMM_TILE_FULL (uplo, d))
+    {
+      for (i = 0; i < GEMM_MR; i++)
+        for (j = 0; j < GEMM_NR; j++)
+          C[ldc * i + j] += alpha * ab[i * GEMM_NR + j];
+    }
+  else
+    {
+      for (i = 0; i < mr; i++)
+        {
+          const INDEX j0 = GEMM_ROW_FIRST (uplo, d, i);
+          const INDEX j1 = GEMM_ROW_END (uplo, d, i, nr);
+
+          for (j = j0; j < j1; j++)
+            C[ldc * i + j] += alpha * ab[i * GEMM_NR + j];
+        }
+    }
+}
+
+/* allocate packing buffers for products of size n1-by-n2-by-K; returns
+   -1 if they cannot be allocated */
+static int
+gemm_block_alloc (const INDEX n1, const INDEX n2, const INDEX K,
+                  BASE **Fp, BASE **Gp)
+{
+  const INDEX mcmax = ((GSL_MIN (GEMM_MC, n1) + GEMM_MR - 1) / GEMM_MR) * GEMM_MR;
+  const INDEX ncmax = ((GSL_MIN (GEMM_NC, n2) + GEMM_NR - 1) / GEMM_NR) * GEMM_NR;
+  const INDEX kcmax = GSL_MIN (GEMM_KC, K);
+
+  *Fp = malloc (sizeof (BASE) * mcmax * kcmax);
+  *Gp = malloc (sizeof (BASE) * ncmax * kcmax);
+
+  if (*Fp == NULL || *Gp == NULL)
+    {
+      free (*Fp);
+      free (*Gp);
+      return -1;
+    }
+
+  return 0;
+}
+
+/* the blocked product, using buffers from gemm_block_alloc */
+static void
+gemm_block_run (const int TransF, const int TransG, const int uplo,
+                const INDEX n1, const INDEX n2, const INDEX K,
+                const BASE alpha, const BASE *F, const INDEX ldf,
+                const BASE *G, const INDEX ldg, BASE *C, const INDEX ldc,
+                BASE *Fp, BASE *Gp)
+{
+  INDEX ic, jc, pc, ir, jr;
+
+  for (jc = 0; jc < n2; jc += GEMM_NC)
+    {
+      const INDEX nc = GSL_MIN (GEMM_NC, n2 - jc);
+
+      for (pc = 0; pc < K; pc += GEMM_KC)
+        {
+          const INDEX kc = GSL_MIN (GEMM_KC, K - pc);
+          const BASE *Gpc = (TransG == CblasNoTrans) ? &G[ldg * pc + jc] : &G[ldg * jc + pc];
+
+          gemm_pack_G (TransG, kc, nc, Gpc, ldg, Gp);
+
+          for (ic = 0; ic < n1; ic += GEMM_MC)
+            {
+              const INDEX mc = GSL_MIN (GEMM_MC, n1 - ic);
+              const BASE *Fic = (TransF == CblasNoTrans) ? &F[ldf * ic + pc] : &F[ldf * pc + ic];
+
+              gemm_pack_F (TransF, mc, kc, Fic, ldf, Fp);
+
+              for (jr = 0; jr < nc; jr += GEMM_NR)
+                {
+                  const INDEX nr = GSL_MIN (GEMM_NR, nc - jr);
+
+                  for (ir = 0; ir < mc; ir += GEMM_MR)
+                    {
+                      const INDEX mr = GSL_MIN (GEMM_MR, mc - ir);
+                      const INDEX d = (jc + jr) - (ic + ir);
+
+                      if (GEMM_TILE_SKIP (uplo, d, mr, nr))
+                        continue;
+
+                      gemm_kernel (kc, alpha, &Fp[ir * kc], &Gp[jr * kc],
+                                   &C[ldc * (ic + ir) + jc + jr], ldc, mr, nr,
+                                   uplo, d);
+                    }
+                }
+            }
+        }
+    }
+}
+
+#ifndef GEMM_BLOCK_RUN_ONLY
+static int
+gemm_block (const int TransF, const int TransG, const int uplo,
+            const INDEX n1, const INDEX n2, const INDEX K, const BASE alpha,
+            const BASE *F, const INDEX ldf, const BASE *G, const INDEX ldg,
+            BASE *C, const INDEX ldc)
+{
+  BASE *Fp, *Gp;
+
+  if (gemm_block_alloc (n1, n2, K, &Fp, &Gp) != 0)
+    return -1;
+
+  gemm_block_run (TransF, TransG, uplo, n1, n2, K, alpha, F, ldf, G, ldg,
+                  C, ldc, Fp, Gp);
+
+  free (Fp);
+  free (Gp);
+
+  return 0;
+}
+#endif /* GEMM_BLOCK_RUN_ONLY */
@@ -0,0 +1,55 @@
+/* cblas/gemv_batch_kernel_r.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* y := alpha*op(A)*x + beta*y for a vector y of length BATCH_N and x
+   of length m, with op(A)(i,j) = A[rsa*i + csa*j]. alpha must be
+   nonzero. */
+
+static void
+BATCH_NAME (gemv_batch_kernel) (const int n, const int m, const BASE alpha,
+                                const BASE * A, const int rsa, const int csa,
+                                const BASE * X, const int incX,
+                                const BASE beta, BASE * Y, const int incY)
+{
+  BASE c[BATCH_NMAX];
+  int i, j;
+  (void) n;                     /* used only as BATCH_N in the _any instance */
+
+  for (i = 0; i < BATCH_N; i++) {
+    c[i] = 0.0;
+  }
+
+  for (j = 0; j < m; j++) {
+    const BASE x = X[incX * j];
+    const BASE *a = A + csa * j;
+    for (i = 0; i < BATCH_N; i++) {
+      c[i] += a[rsa * i] * x;
+    }
+  }
+
+  if (beta == 0.0) {
+    for (i = 0; i < BATCH_N; i++) {
+      Y[incY * i] = alpha * c[i];
+    }
+  } else {
+    for (i = 0; i < BATCH_N; i++) {
+      Y[incY * i] = alpha * c[i] + beta * Y[incY * i];
+    }
+  }
+}
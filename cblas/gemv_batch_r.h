@@ -0,0 +1,161 @@
+/* cblas/gemv_batch_r.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Batch GEMV for real types. This file is included at file scope with
+ * BASE defined and GEMV defined to the corresponding cblas_xgemv, and
+ * provides
+ *
+ * gemv_batch_task (arg, first, last)
+ *
+ * a task for gsl_cblas_parallel_batch which computes
+ * y_p := alpha*op(A_p)*x_p + beta*y_p for problems p = first, ...,
+ * last - 1 of the batch described by arg, where X_p = Xp[p], or
+ * X_p = X + p*strideX for a strided batch (Xp null). Small problems
+ * (see batch.h) use kernels specialized for the length of y; other
+ * problems call GEMV.
+ *
+ * gemv_group_task (arg, first, last)
+ *
+ * the same for problems first, ..., last - 1 of the groups described
+ * by arg, numbered consecutively through the groups.
+ */
+
+#include "batch.h"
+
+typedef struct
+{
+  enum CBLAS_ORDER order;
+  enum CBLAS_TRANSPOSE TransA;
+  int M, N;
+  BASE alpha, beta;
+  const BASE *A;
+  int lda, stridea;
+  const BASE *X;
+  int incX, stridex;
+  BASE *Y;
+  int incY, stridey;
+  const BASE *const *Ap;
+  const BASE *const *Xp;
+  BASE *const *Yp;
+} gemv_batch_args;
+
+typedef struct
+{
+  enum CBLAS_ORDER order;
+  const enum CBLAS_TRANSPOSE *TransA;
+  const int *M, *N;
+  const BASE *alpha, *beta;
+  const BASE **A;
+  const int *lda;
+  const BASE **X;
+  const int *incX;
+  BASE **Y;
+  const int *incY;
+  int group_count;
+  const int *group_size;
+} gemv_group_args;
+
+#define BATCH_KERNEL "gemv_batch_kernel_r.h"
+#include "batch_sizes.h"
+#undef BATCH_KERNEL
+
+static void
+gemv_batch_task (void *arg, const int first, const int last)
+{
+  const gemv_batch_args *p = (const gemv_batch_args *) arg;
+  const int Trans = (p->TransA != CblasConjTrans) ? p->TransA : CblasTrans;
+  const int lenX = (Trans == CblasNoTrans) ? p->N : p->M;
+  const int lenY = (Trans == CblasNoTrans) ? p->M : p->N;
+  int rsa, csa;
+  int b;
+
+  if ((p->order == CblasRowMajor && Trans == CblasNoTrans)
+      || (p->order == CblasColMajor && Trans == CblasTrans)) {
+    rsa = p->lda;
+    csa = 1;
+  } else {
+    rsa = 1;
+    csa = p->lda;
+  }
+
+  if (p->alpha != 0.0 && lenY <= BATCH_MAX && lenX <= BATCH_MAX_OUTER) {
+    const int offx = OFFSET (lenX, p->incX);
+    const int offy = OFFSET (lenY, p->incY);
+
+    for (b = first; b < last; b++) {
+      BATCH_CALL (gemv_batch_kernel, lenY,
+                  (lenY, lenX, p->alpha, BATCH_PTR (p->Ap, p->A, p->stridea, b),
+                   rsa, csa, BATCH_PTR (p->Xp, p->X, p->stridex, b) + offx,
+                   p->incX, p->beta,
+                   BATCH_PTR (p->Yp, p->Y, p->stridey, b) + offy, p->incY));
+    }
+  } else {
+    for (b = first; b < last; b++) {
+      GEMV (p->order, p->TransA, p->M, p->N, p->alpha,
+            BATCH_PTR (p->Ap, p->A, p->stridea, b), p->lda,
+            BATCH_PTR (p->Xp, p->X, p->stridex, b), p->incX, p->beta,
+            BATCH_PTR (p->Yp, p->Y, p->stridey, b), p->incY);
+    }
+  }
+}
+
+static void
+gemv_group_task (void *arg, const int first, const int last)
+{
+  const gemv_group_args *p = (const gemv_group_args *) arg;
+  int g = 0, start = 0;
+
+  /* find the group of problem first */
+  while (g < p->group_count && start + p->group_size[g] <= first) {
+    start += p->group_size[g];
+    g++;
+  }
+
+  for (; g < p->group_count && start < last; g++) {
+    const int lo = GSL_MAX (first, start) - start;
+    const int hi = GSL_MIN (last, start + p->group_size[g]) - start;
+    gemv_batch_args q;
+
+    q.order = p->order;
+    q.TransA = p->TransA[g];
+    q.M = p->M[g];
+    q.N = p->N[g];
+    q.alpha = p->alpha[g];
+    q.beta = p->beta[g];
+    q.A = 0;
+    q.lda = p->lda[g];
+    q.stridea = 0;
+    q.X = 0;
+    q.incX = p->incX[g];
+    q.stridex = 0;
+    q.Y = 0;
+    q.incY = p->incY[g];
+    q.stridey = 0;
+    q.Ap = p->A + start;
+    q.Xp = p->X + start;
+    q.Yp = p->Y + start;
+
+    if (hi > lo && q.M != 0 && q.N != 0
+        && !(q.alpha == 0.0 && q.beta == 1.0))
+      gemv_batch_task (&q, lo, hi);
+
+    start += p->group_size[g];
+  }
+}
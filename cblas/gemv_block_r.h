@@ -0,0 +1,253 @@
+/* cblas/gemv_block_r.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Multi-row kernels for the real gemv and ger. This file is included
+ * at file scope with BASE defined, and provides
+ *
+ * gemv_dot (M, N, alpha, A, lda, X, incX, Y, incY)
+ *   y_i += alpha * sum_j A[i*lda + j] x_j        (i < M, j < N)
+ *
+ * gemv_axpy (M, N, alpha, A, lda, X, incX, Y, incY)
+ *   y_j += sum_i (alpha x_i) A[i*lda + j]        (i < M, j < N)
+ *
+ * ger_rows (M, N, alpha, X, incX, Y, incY, A, lda)
+ *   A[i*lda + j] += y_j (alpha x_i)              (i < M, j < N)
+ *
+ * which cover both orders and both transposes. X and Y point to the
+ * element of index 0, so that negative increments index backwards.
+ *
+ * gemv includes this file as it is and gets gemv_dot and gemv_axpy;
+ * ger defines GEMV_BLOCK_GER before including it and gets ger_rows.
+ *
+ * The rows of A are processed four at a time, so that each element of
+ * the shared vector is loaded once for four rows instead of once per
+ * row, and the columns in blocks of GEMV_NB so that the block of the
+ * shared vector stays in the L1 cache while it is used by all the rows.
+ * In gemv_dot the sums of a panel of GEMV_PANEL rows are carried across
+ * the column blocks.
+ *
+ * Each element is computed with the same operations in the same order
+ * as in the reference loops, so the results are identical. With
+ * GEMV_USE_KERNELS defined (double precision) the unit-stride blocks
+ * use the vectorized four-row kernels of kernels_l1.c, of which only
+ * the inner products of gemv_dot change the rounding.
+ */
+
+#include "kernels_l1.h"
+
+/* columns in a block */
+#ifndef GEMV_NB
+#define GEMV_NB 1024
+#endif
+
+/* rows of gemv_dot whose sums are carried across the column blocks */
+#ifndef GEMV_PANEL
+#define GEMV_PANEL 64
+#endif
+
+#ifdef GEMV_USE_KERNELS
+#define GEMV_KERNEL(f, n) CBLAS_L1_KERNEL (f, n)
+#else
+#define GEMV_KERNEL(f, n) NULL
+#endif
+
+#ifndef GEMV_BLOCK_GER
+static void
+gemv_dot (const INDEX M, const INDEX N, const BASE alpha, const BASE * A,
+          const int lda, const BASE * X, const int incX, BASE * Y,
+          const int incY)
+{
+  void (*dot4) (const int, const BASE *, const int, const BASE *, BASE *) =
+    (incX == 1) ? GEMV_KERNEL (ddot4, N) : NULL;
+  BASE sum[GEMV_PANEL];
+  INDEX i0, j0, i, j;
+
+  for (i0 = 0; i0 < M; i0 += GEMV_PANEL) {
+    const INDEX mb = (M - i0 < GEMV_PANEL) ? M - i0 : GEMV_PANEL;
+
+    for (i = 0; i < mb; i++) {
+      sum[i] = 0.0;
+    }
+
+    for (j0 = 0; j0 < N; j0 += GEMV_NB) {
+      const INDEX nb = (N - j0 < GEMV_NB) ? N - j0 : GEMV_NB;
+      const BASE *x = X + incX * j0;
+
+      for (i = 0; i + 4 <= mb; i += 4) {
+        const BASE *a0 = A + lda * (i0 + i) + j0;
+
+        if (dot4 != NULL && nb >= CBLAS_L1_MIN) {
+          dot4 (nb, a0, lda, x, sum + i);
+        } else {
+          const BASE *a1 = a0 + lda, *a2 = a1 + lda, *a3 = a2 + lda;
+          BASE s0 = sum[i], s1 = sum[i + 1], s2 = sum[i + 2], s3 = sum[i + 3];
+          INDEX ix = 0;
+          for (j = 0; j < nb; j++) {
+            const BASE xj = x[ix];
+            s0 += xj * a0[j];
+            s1 += xj * a1[j];
+            s2 += xj * a2[j];
+            s3 += xj * a3[j];
+            ix += incX;
+          }
+          sum[i] = s0;
+          sum[i + 1] = s1;
+          sum[i + 2] = s2;
+          sum[i + 3] = s3;
+        }
+      }
+
+      for (; i < mb; i++) {
+        const BASE *a = A + lda * (i0 + i) + j0;
+        BASE s = sum[i];
+        INDEX ix = 0;
+        for (j = 0; j < nb; j++) {
+          s += x[ix] * a[j];
+          ix += incX;
+        }
+        sum[i] = s;
+      }
+    }
+
+    for (i = 0; i < mb; i++) {
+      Y[incY * (i0 + i)] += alpha * sum[i];
+    }
+  }
+}
+
+static void
+gemv_axpy (const INDEX M, const INDEX N, const BASE alpha, const BASE * A,
+           const int lda, const BASE * X, const int incX, BASE * Y,
+           const int incY)
+{
+  void (*axpy4) (const int, const BASE *, const BASE *, const int, BASE *) =
+    (incY == 1) ? GEMV_KERNEL (daxpy4, N) : NULL;
+  INDEX i, j, j0, k;
+
+  for (j0 = 0; j0 < N; j0 += GEMV_NB) {
+    const INDEX nb = (N - j0 < GEMV_NB) ? N - j0 : GEMV_NB;
+    BASE *y = Y + incY * j0;
+
+    for (i = 0; i + 4 <= M; i += 4) {
+      const BASE *a0 = A + lda * i + j0;
+      BASE t[4];
+
+      for (k = 0; k < 4; k++) {
+        t[k] = alpha * X[incX * (i + k)];
+      }
+
+      if (t[0] != 0.0 && t[1] != 0.0 && t[2] != 0.0 && t[3] != 0.0) {
+        if (axpy4 != NULL && nb >= CBLAS_L1_MIN) {
+          axpy4 (nb, t, a0, lda, y);
+        } else {
+          const BASE *a1 = a0 + lda, *a2 = a1 + lda, *a3 = a2 + lda;
+          INDEX iy = 0;
+          for (j = 0; j < nb; j++) {
+            BASE yj = y[iy];
+            yj += t[0] * a0[j];
+            yj += t[1] * a1[j];
+            yj += t[2] * a2[j];
+            yj += t[3] * a3[j];
+            y[iy] = yj;
+            iy += incY;
+          }
+        }
+      } else {
+        /* as in the reference loop, rows with a zero multiplier are
+           skipped */
+        for (k = 0; k < 4; k++) {
+          if (t[k] != 0.0) {
+            const BASE *a = a0 + lda * k;
+            INDEX iy = 0;
+            for (j = 0; j < nb; j++) {
+              y[iy] += t[k] * a[j];
+              iy += incY;
+            }
+          }
+        }
+      }
+    }
+
+    for (; i < M; i++) {
+      const BASE temp = alpha * X[incX * i];
+      if (temp != 0.0) {
+        const BASE *a = A + lda * i + j0;
+        INDEX iy = 0;
+        for (j = 0; j < nb; j++) {
+          y[iy] += temp * a[j];
+          iy += incY;
+        }
+      }
+    }
+  }
+}
+
+#endif /* !GEMV_BLOCK_GER */
+
+#ifdef GEMV_BLOCK_GER
+static void
+ger_rows (const INDEX M, const INDEX N, const BASE alpha, const BASE * X,
+          const int incX, const BASE * Y, const int incY, BASE * A,
+          const int lda)
+{
+  void (*ger4) (const int, const BASE *, const BASE *, BASE *, const int) =
+    (incY == 1) ? GEMV_KERNEL (dger4, N) : NULL;
+  INDEX i, j, j0, k;
+
+  for (j0 = 0; j0 < N; j0 += GEMV_NB) {
+    const INDEX nb = (N - j0 < GEMV_NB) ? N - j0 : GEMV_NB;
+    const BASE *y = Y + incY * j0;
+
+    for (i = 0; i + 4 <= M; i += 4) {
+      BASE *a0 = A + lda * i + j0;
+      BASE t[4];
+
+      for (k = 0; k < 4; k++) {
+        t[k] = alpha * X[incX * (i + k)];
+      }
+
+      if (ger4 != NULL && nb >= CBLAS_L1_MIN) {
+        ger4 (nb, t, y, a0, lda);
+      } else {
+        BASE *a1 = a0 + lda, *a2 = a1 + lda, *a3 = a2 + lda;
+        INDEX jy = 0;
+        for (j = 0; j < nb; j++) {
+          const BASE yj = y[jy];
+          a0[j] += yj * t[0];
+          a1[j] += yj * t[1];
+          a2[j] += yj * t[2];
+          a3[j] += yj * t[3];
+          jy += incY;
+        }
+      }
+    }
+
+    for (; i < M; i++) {
+      const BASE tmp = alpha * X[incX * i];
+      BASE *a = A + lda * i + j0;
+      INDEX jy = 0;
+      for (j = 0; j < nb; j++) {
+        a[j] += y[jy] * tmp;
+        jy += incY;
+      }
+    }
+  }
+}
+#endif /* GEMV_BLOCK_GER */
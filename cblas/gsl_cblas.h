@@ -601,6 +601,96 @@ void cblas_zher2k(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo,
 
 void cblas_xerbla(int p, const char *rout, const char *form, ...);
 
+/*
+ * ===========================================================================
+ * GSL extensions: number of threads used by the level 3 BLAS functions
+ * ===========================================================================
+ */
+void gsl_cblas_set_num_threads(const int nthreads);
+int gsl_cblas_get_num_threads(void);
+
+/*
+ * ===========================================================================
+ * GSL extensions: strided batches of small problems
+ * ===========================================================================
+ */
+void cblas_sgemm_batch_strided(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA,
+                 const enum CBLAS_TRANSPOSE TransB, const int M, const int N,
+                 const int K, const float alpha, const float *A,
+                 const int lda, const int stridea, const float *B, const int ldb,
+                 const int strideb, const float beta, float *C, const int ldc,
+                 const int stridec, const int batch_size);
+void cblas_sgemv_batch_strided(const enum CBLAS_ORDER order,
+                 const enum CBLAS_TRANSPOSE TransA, const int M, const int N,
+                 const float alpha, const float *A, const int lda, const int stridea,
+                 const float *X, const int incX, const int stridex, const float beta,
+                 float *Y, const int incY, const int stridey, const int batch_size);
+void cblas_strsm_batch_strided(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side,
+                 const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA,
+                 const enum CBLAS_DIAG Diag, const int M, const int N,
+                 const float alpha, const float *A, const int lda, const int stridea,
+                 float *B, const int ldb, const int strideb, const int batch_size);
+
+void cblas_dgemm_batch_strided(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA,
+                 const enum CBLAS_TRANSPOSE TransB, const int M, const int N,
+                 const int K, const double alpha, const double *A,
+                 const int lda, const int stridea, const double *B, const int ldb,
+                 const int strideb, const double beta, double *C, const int ldc,
+                 const int stridec, const int batch_size);
+void cblas_dgemv_batch_strided(const enum CBLAS_ORDER order,
+                 const enum CBLAS_TRANSPOSE TransA, const int M, const int N,
+                 const double alpha, const double *A, const int lda, const int stridea,
+                 const double *X, const int incX, const int stridex, const double beta,
+                 double *Y, const int incY, const int stridey, const int batch_size);
+void cblas_dtrsm_batch_strided(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side,
+                 const enum CBLAS_UPLO Uplo, const enum CBLAS_TRANSPOSE TransA,
+                 const enum CBLAS_DIAG Diag, const int M, const int N,
+                 const double alpha, const double *A, const int lda, const int stridea,
+                 double *B, const int ldb, const int strideb, const int batch_size);
+
+/*
+ * ===========================================================================
+ * GSL extensions: groups of small problems given by arrays of pointers
+ * ===========================================================================
+ */
+void cblas_sgemm_batch(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE *TransA_array,
+                 const enum CBLAS_TRANSPOSE *TransB_array, const int *M_array,
+                 const int *N_array, const int *K_array, const float *alpha_array,
+                 const float **A_array, const int *lda_array, const float **B_array,
+                 const int *ldb_array, const float *beta_array, float **C_array,
+                 const int *ldc_array, const int group_count, const int *group_size);
+void cblas_sgemv_batch(const enum CBLAS_ORDER order,
+                 const enum CBLAS_TRANSPOSE *TransA_array, const int *M_array,
+                 const int *N_array, const float *alpha_array, const float **A_array,
+                 const int *lda_array, const float **X_array, const int *incX_array,
+                 const float *beta_array, float **Y_array, const int *incY_array,
+                 const int group_count, const int *group_size);
+void cblas_strsm_batch(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE *Side_array,
+                 const enum CBLAS_UPLO *Uplo_array, const enum CBLAS_TRANSPOSE *TransA_array,
+                 const enum CBLAS_DIAG *Diag_array, const int *M_array,
+                 const int *N_array, const float *alpha_array, const float **A_array,
+                 const int *lda_array, float **B_array, const int *ldb_array,
+                 const int group_count, const int *group_size);
+
+void cblas_dgemm_batch(const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE *TransA_array,
+                 const enum CBLAS_TRANSPOSE *TransB_array, const int *M_array,
+                 const int *N_array, const int *K_array, const double *alpha_array,
+                 const double **A_array, const int *lda_array, const double **B_array,
+                 const int *ldb_array, const double *beta_array, double **C_array,
+                 const int *ldc_array, const int group_count, const int *group_size);
+void cblas_dgemv_batch(const enum CBLAS_ORDER order,
+                 const enum CBLAS_TRANSPOSE *TransA_array, const int *M_array,
+                 const int *N_array, const double *alpha_array, const double **A_array,
+                 const int *lda_array, const double **X_array, const int *incX_array,
+                 const double *beta_array, double **Y_array, const int *incY_array,
+                 const int group_count, const int *group_size);
+void cblas_dtrsm_batch(const enum CBLAS_ORDER Order, const enum CBLAS_SIDE *Side_array,
+                 const enum CBLAS_UPLO *Uplo_array, const enum CBLAS_TRANSPOSE *TransA_array,
+                 const enum CBLAS_DIAG *Diag_array, const int *M_array,
+                 const int *N_array, const double *alpha_array, const double **A_array,
+                 const int *lda_array, double **B_array, const int *ldb_array,
+                 const int group_count, const int *group_size);
+
 __END_DECLS
 
 #endif /* __GSL_CBLAS_H__ */
@@ -1,10 +1,17 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "kernels_l1.h"
 
 CBLAS_INDEX
 cblas_idamax (const int N, const double *X, const int incX)
 {
+  if (incX == 1) {
+    int (*idamax) (const int, const double *) = CBLAS_L1_KERNEL(idamax, N);
+    if (idamax != NULL)
+      return idamax(N, X);
+  }
+
 #define BASE double
 #include "source_iamax_r.h"
 #undef BASE
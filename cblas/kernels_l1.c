@@ -0,0 +1,718 @@
+/* cblas/kernels_l1.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Run-time dispatch of the unit-stride Level-1 kernels.
+ *
+ * On x86 processors with a GNU-compatible compiler, SSE2, AVX2 and
+ * AVX-512 versions of ddot, daxpy, dnrm2 (sum of squares), dasum and
+ * idamax are compiled with per-function target attributes, and the
+ * best set supported by the processor is selected the first time a
+ * kernel is requested (or when the library is loaded, where the
+ * compiler supports constructors). On other platforms the table is
+ * empty and the portable loops are used.
+ *
+ * The environment variable GSL_CBLAS_SIMD can be set to one of "none",
+ * "sse2", "avx2" or "avx512" to limit the instruction set used. With
+ * "none" every routine gives results identical to the reference loops.
+ *
+ * Notes on the order of operations:
+ *
+ * daxpy: each element is computed as y + (alpha*x) without fused
+ * multiply-add, so the result is identical to the portable loop. The
+ * kernels which promise this are compiled with contraction of a*b + c
+ * disabled (EXACT below), since the compiler would otherwise fuse the
+ * multiplication and addition in the AVX-512 functions, whose target
+ * implies FMA.
+ *
+ * idamax: the largest |x| is found first and then the first index
+ * attaining it, so the result is identical to the portable loop
+ * (including NaN elements, which are skipped by both).
+ *
+ * ddot, dasum: partial sums are accumulated in several vector
+ * registers, which changes the rounding of the result.
+ *
+ * dnrm2: the kernel returns the unscaled sum of squares; the caller
+ * falls back to the scaled reference algorithm whenever the sum may
+ * have overflowed or lost accuracy through underflow.
+ *
+ * The multi-row kernels of dgemv and dger work on four rows of a
+ * matrix at a time:
+ *
+ * ddot4: r[k] += A_k . x for k = 0..3, with partial sums in vector
+ * registers as in ddot.
+ *
+ * daxpy4: y := (((y + t0*A_0) + t1*A_1) + t2*A_2) + t3*A_3, and
+ * dger4: A_k := A_k + y*t_k, both without fused multiply-add, so the
+ * results are identical to the reference loops.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <gsl/gsl_math.h>
+#include "kernels_l1.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    ((defined(__GNUC__) && __GNUC__ >= 7) || defined(__clang__))
+#define CBLAS_HAVE_X86_DISPATCH 1
+#endif
+
+#ifdef CBLAS_HAVE_X86_DISPATCH
+
+#include <immintrin.h>
+
+#define TARGET(x) __attribute__ ((target (x)))
+
+/* no fused multiply-add in the kernels identical to the reference loops */
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#define EXACT
+#else
+#define EXACT __attribute__ ((optimize ("fp-contract=off")))
+#endif
+
+/* SSE2 */
+
+TARGET("sse2") static double
+ddot_sse2 (const int N, const double *X, const double *Y)
+{
+  __m128d s0 = _mm_setzero_pd (), s1 = _mm_setzero_pd ();
+  __m128d s2 = _mm_setzero_pd (), s3 = _mm_setzero_pd ();
+  double r[2];
+  int i;
+
+  for (i = 0; i + 8 <= N; i += 8)
+    {
+      s0 = _mm_add_pd (s0, _mm_mul_pd (_mm_loadu_pd (X + i), _mm_loadu_pd (Y + i)));
+      s1 = _mm_add_pd (s1, _mm_mul_pd (_mm_loadu_pd (X + i + 2), _mm_loadu_pd (Y + i + 2)));
+      s2 = _mm_add_pd (s2, _mm_mul_pd (_mm_loadu_pd (X + i + 4), _mm_loadu_pd (Y + i + 4)));
+      s3 = _mm_add_pd (s3, _mm_mul_pd (_mm_loadu_pd (X + i + 6), _mm_loadu_pd (Y + i + 6)));
+    }
+
+  s0 = _mm_add_pd (_mm_add_pd (s0, s1), _mm_add_pd (s2, s3));
+  _mm_storeu_pd (r, s0);
+  r[0] += r[1];
+
+  for (; i < N; i++)
+    r[0] += X[i] * Y[i];
+
+  return r[0];
+}
+
+TARGET("sse2") EXACT static void
+daxpy_sse2 (const int N, const double alpha, const double *X, double *Y)
+{
+  const __m128d a = _mm_set1_pd (alpha);
+  int i;
+
+  for (i = 0; i + 4 <= N; i += 4)
+    {
+      _mm_storeu_pd (Y + i, _mm_add_pd (_mm_loadu_pd (Y + i), _mm_mul_pd (a, _mm_loadu_pd (X + i))));
+      _mm_storeu_pd (Y + i + 2, _mm_add_pd (_mm_loadu_pd (Y + i + 2), _mm_mul_pd (a, _mm_loadu_pd (X + i + 2))));
+    }
+
+  for (; i < N; i++)
+    Y[i] += alpha * X[i];
+}
+
+TARGET("sse2") static double
+dssq_sse2 (const int N, const double *X)
+{
+  __m128d s0 = _mm_setzero_pd (), s1 = _mm_setzero_pd ();
+  double r[2];
+  int i;
+
+  for (i = 0; i + 4 <= N; i += 4)
+    {
+      const __m128d x0 = _mm_loadu_pd (X + i);
+      const __m128d x1 = _mm_loadu_pd (X + i + 2);
+      s0 = _mm_add_pd (s0, _mm_mul_pd (x0, x0));
+      s1 = _mm_add_pd (s1, _mm_mul_pd (x1, x1));
+    }
+
+  _mm_storeu_pd (r, _mm_add_pd (s0, s1));
+  r[0] += r[1];
+
+  for (; i < N; i++)
+    r[0] += X[i] * X[i];
+
+  return r[0];
+}
+
+TARGET("sse2") static double
+dasum_sse2 (const int N, const double *X)
+{
+  const __m128d mask = _mm_castsi128_pd (_mm_set1_epi64x (0x7fffffffffffffffLL));
+  __m128d s0 = _mm_setzero_pd (), s1 = _mm_setzero_pd ();
+  double r[2];
+  int i;
+
+  for (i = 0; i + 4 <= N; i += 4)
+    {
+      s0 = _mm_add_pd (s0, _mm_and_pd (mask, _mm_loadu_pd (X + i)));
+      s1 = _mm_add_pd (s1, _mm_and_pd (mask, _mm_loadu_pd (X + i + 2)));
+    }
+
+  _mm_storeu_pd (r, _mm_add_pd (s0, s1));
+  r[0] += r[1];
+
+  for (; i < N; i++)
+    r[0] += fabs (X[i]);
+
+  return r[0];
+}
+
+/* index of the first element with |X[i]| == max, or 0 if max is zero */
+static int
+idamax_scan (const int N, const double *X, const double max)
+{
+  int i;
+
+  if (max == 0.0)
+    return 0;
+
+  for (i = 0; i < N; i++)
+    {
+      if (fabs (X[i]) == max)
+        return i;
+    }
+
+  return 0;
+}
+
+TARGET("sse2") static int
+idamax_sse2 (const int N, const double *X)
+{
+  const __m128d mask = _mm_castsi128_pd (_mm_set1_epi64x (0x7fffffffffffffffLL));
+  __m128d m = _mm_setzero_pd ();
+  double r[2];
+  int i;
+
+  /* _mm_max_pd returns its second operand if either is a NaN, so NaN
+     elements are skipped as in the portable loop */
+  for (i = 0; i + 2 <= N; i += 2)
+    m = _mm_max_pd (_mm_and_pd (mask, _mm_loadu_pd (X + i)), m);
+
+  _mm_storeu_pd (r, m);
+  r[0] = GSL_MAX (r[0], r[1]);
+
+  for (; i < N; i++)
+    {
+      if (fabs (X[i]) > r[0])
+        r[0] = fabs (X[i]);
+    }
+
+  return idamax_scan (N, X, r[0]);
+}
+
+TARGET("sse2") static void
+ddot4_sse2 (const int N, const double *A, const int lda, const double *X,
+            double *r)
+{
+  const double *a0 = A, *a1 = A + lda, *a2 = A + 2 * lda, *a3 = A + 3 * lda;
+  __m128d s0 = _mm_setzero_pd (), s1 = _mm_setzero_pd ();
+  __m128d s2 = _mm_setzero_pd (), s3 = _mm_setzero_pd ();
+  double t[2];
+  int i;
+
+  for (i = 0; i + 2 <= N; i += 2)
+    {
+      const __m128d x = _mm_loadu_pd (X + i);
+      s0 = _mm_add_pd (s0, _mm_mul_pd (_mm_loadu_pd (a0 + i), x));
+      s1 = _mm_add_pd (s1, _mm_mul_pd (_mm_loadu_pd (a1 + i), x));
+      s2 = _mm_add_pd (s2, _mm_mul_pd (_mm_loadu_pd (a2 + i), x));
+      s3 = _mm_add_pd (s3, _mm_mul_pd (_mm_loadu_pd (a3 + i), x));
+    }
+
+  _mm_storeu_pd (t, s0);
+  r[0] += t[0] + t[1];
+  _mm_storeu_pd (t, s1);
+  r[1] += t[0] + t[1];
+  _mm_storeu_pd (t, s2);
+  r[2] += t[0] + t[1];
+  _mm_storeu_pd (t, s3);
+  r[3] += t[0] + t[1];
+
+  for (; i < N; i++)
+    {
+      r[0] += a0[i] * X[i];
+      r[1] += a1[i] * X[i];
+      r[2] += a2[i] * X[i];
+      r[3] += a3[i] * X[i];
+    }
+}
+
+TARGET("sse2") EXACT static void
+daxpy4_sse2 (const int N, const double *t, const double *A, const int lda,
+             double *Y)
+{
+  const double *a0 = A, *a1 = A + lda, *a2 = A + 2 * lda, *a3 = A + 3 * lda;
+  const __m128d t0 = _mm_set1_pd (t[0]), t1 = _mm_set1_pd (t[1]);
+  const __m128d t2 = _mm_set1_pd (t[2]), t3 = _mm_set1_pd (t[3]);
+  int i;
+
+  for (i = 0; i + 2 <= N; i += 2)
+    {
+      __m128d y = _mm_loadu_pd (Y + i);
+      y = _mm_add_pd (y, _mm_mul_pd (t0, _mm_loadu_pd (a0 + i)));
+      y = _mm_add_pd (y, _mm_mul_pd (t1, _mm_loadu_pd (a1 + i)));
+      y = _mm_add_pd (y, _mm_mul_pd (t2, _mm_loadu_pd (a2 + i)));
+      y = _mm_add_pd (y, _mm_mul_pd (t3, _mm_loadu_pd (a3 + i)));
+      _mm_storeu_pd (Y + i, y);
+    }
+
+  for (; i < N; i++)
+    {
+      double y = Y[i];
+      y += t[0] * a0[i];
+      y += t[1] * a1[i];
+      y += t[2] * a2[i];
+      y += t[3] * a3[i];
+      Y[i] = y;
+    }
+}
+
+TARGET("sse2") EXACT static void
+dger4_sse2 (const int N, const double *t, const double *Y, double *A,
+            const int lda)
+{
+  double *a0 = A, *a1 = A + lda, *a2 = A + 2 * lda, *a3 = A + 3 * lda;
+  const __m128d t0 = _mm_set1_pd (t[0]), t1 = _mm_set1_pd (t[1]);
+  const __m128d t2 = _mm_set1_pd (t[2]), t3 = _mm_set1_pd (t[3]);
+  int i;
+
+  for (i = 0; i + 2 <= N; i += 2)
+    {
+      const __m128d y = _mm_loadu_pd (Y + i);
+      _mm_storeu_pd (a0 + i, _mm_add_pd (_mm_loadu_pd (a0 + i), _mm_mul_pd (y, t0)));
+      _mm_storeu_pd (a1 + i, _mm_add_pd (_mm_loadu_pd (a1 + i), _mm_mul_pd (y, t1)));
+      _mm_storeu_pd (a2 + i, _mm_add_pd (_mm_loadu_pd (a2 + i), _mm_mul_pd (y, t2)));
+      _mm_storeu_pd (a3 + i, _mm_add_pd (_mm_loadu_pd (a3 + i), _mm_mul_pd (y, t3)));
+    }
+
+  for (; i < N; i++)
+    {
+      a0[i] += Y[i] * t[0];
+      a1[i] += Y[i] * t[1];
+      a2[i] += Y[i] * t[2];
+      a3[i] += Y[i] * t[3];
+    }
+}
+
+/* AVX2 */
+
+TARGET("avx2,fma") static double
+ddot_avx2 (const int N, const double *X, const double *Y)
+{
+  __m256d s0 = _mm256_setzero_pd (), s1 = _mm256_setzero_pd ();
+  __m256d s2 = _mm256_setzero_pd (), s3 = _mm256_setzero_pd ();
+  double r[4];
+  int i;
+
+  for (i = 0; i + 16 <= N; i += 16)
+    {
+      s0 = _mm256_fmadd_pd (_mm256_loadu_pd (X + i), _mm256_loadu_pd (Y + i), s0);
+      s1 = _mm256_fmadd_pd (_mm256_loadu_pd (X + i + 4), _mm256_loadu_pd (Y + i + 4), s1);
+      s2 = _mm256_fmadd_pd (_mm256_loadu_pd (X + i + 8), _mm256_loadu_pd (Y + i + 8), s2);
+      s3 = _mm256_fmadd_pd (_mm256_loadu_pd (X + i + 12), _mm256_loadu_pd (Y + i + 12), s3);
+    }
+
+  for (; i + 4 <= N; i += 4)
+    s0 = _mm256_fmadd_pd (_mm256_loadu_pd (X + i), _mm256_loadu_pd (Y + i), s0);
+
+  s0 = _mm256_add_pd (_mm256_add_pd (s0, s1), _mm256_add_pd (s2, s3));
+  _mm256_storeu_pd (r, s0);
+  r[0] = (r[0] + r[1]) + (r[2] + r[3]);
+
+  for (; i < N; i++)
+    r[0] += X[i] * Y[i];
+
+  return r[0];
+}
+
+TARGET("avx2") EXACT static void
+daxpy_avx2 (const int N, const double alpha, const double *X, double *Y)
+{
+  const __m256d a = _mm256_set1_pd (alpha);
+  int i;
+
+  for (i = 0; i + 8 <= N; i += 8)
+    {
+      _mm256_storeu_pd (Y + i, _mm256_add_pd (_mm256_loadu_pd (Y + i), _mm256_mul_pd (a, _mm256_loadu_pd (X + i))));
+      _mm256_storeu_pd (Y + i + 4, _mm256_add_pd (_mm256_loadu_pd (Y + i + 4), _mm256_mul_pd (a, _mm256_loadu_pd (X + i + 4))));
+    }
+
+  for (; i < N; i++)
+    Y[i] += alpha * X[i];
+}
+
+TARGET("avx2,fma") static double
+dssq_avx2 (const int N, const double *X)
+{
+  __m256d s0 = _mm256_setzero_pd (), s1 = _mm256_setzero_pd ();
+  double r[4];
+  int i;
+
+  for (i = 0; i + 8 <= N; i += 8)
+    {
+      const __m256d x0 = _mm256_loadu_pd (X + i);
+      const __m256d x1 = _mm256_loadu_pd (X + i + 4);
+      s0 = _mm256_fmadd_pd (x0, x0, s0);
+      s1 = _mm256_fmadd_pd (x1, x1, s1);
+    }
+
+  _mm256_storeu_pd (r, _mm256_add_pd (s0, s1));
+  r[0] = (r[0] + r[1]) + (r[2] + r[3]);
+
+  for (; i < N; i++)
+    r[0] += X[i] * X[i];
+
+  return r[0];
+}
+
+TARGET("avx2") static double
+dasum_avx2 (const int N, const double *X)
+{
+  const __m256d mask = _mm256_castsi256_pd (_mm256_set1_epi64x (0x7fffffffffffffffLL));
+  __m256d s0 = _mm256_setzero_pd (), s1 = _mm256_setzero_pd ();
+  double r[4];
+  int i;
+
+  for (i = 0; i + 8 <= N; i += 8)
+    {
+      s0 = _mm256_add_pd (s0, _mm256_and_pd (mask, _mm256_loadu_pd (X + i)));
+      s1 = _mm256_add_pd (s1, _mm256_and_pd (mask, _mm256_loadu_pd (X + i + 4)));
+    }
+
+  _mm256_storeu_pd (r, _mm256_add_pd (s0, s1));
+  r[0] = (r[0] + r[1]) + (r[2] + r[3]);
+
+  for (; i < N; i++)
+    r[0] += fabs (X[i]);
+
+  return r[0];
+}
+
+TARGET("avx2") static int
+idamax_avx2 (const int N, const double *X)
+{
+  const __m256d mask = _mm256_castsi256_pd (_mm256_set1_epi64x (0x7fffffffffffffffLL));
+  __m256d m = _mm256_setzero_pd ();
+  double r[4];
+  int i;
+
+  for (i = 0; i + 4 <= N; i += 4)
+    m = _mm256_max_pd (_mm256_and_pd (mask, _mm256_loadu_pd (X + i)), m);
+
+  _mm256_storeu_pd (r, m);
+  r[0] = GSL_MAX (GSL_MAX (r[0], r[1]), GSL_MAX (r[2], r[3]));
+
+  for (; i < N; i++)
+    {
+      if (fabs (X[i]) > r[0])
+        r[0] = fabs (X[i]);
+    }
+
+  return idamax_scan (N, X, r[0]);
+}
+
+/* horizontal sum of the four elements of s */
+TARGET("avx2") static double
+hsum_avx2 (const __m256d s)
+{
+  double t[4];
+
+  _mm256_storeu_pd (t, s);
+
+  return (t[0] + t[1]) + (t[2] + t[3]);
+}
+
+TARGET("avx2,fma") static void
+ddot4_avx2 (const int N, const double *A, const int lda, const double *X,
+            double *r)
+{
+  const double *a0 = A, *a1 = A + lda, *a2 = A + 2 * lda, *a3 = A + 3 * lda;
+  __m256d s0 = _mm256_setzero_pd (), s1 = _mm256_setzero_pd ();
+  __m256d s2 = _mm256_setzero_pd (), s3 = _mm256_setzero_pd ();
+  int i;
+
+  for (i = 0; i + 4 <= N; i += 4)
+    {
+      const __m256d x = _mm256_loadu_pd (X + i);
+      s0 = _mm256_fmadd_pd (_mm256_loadu_pd (a0 + i), x, s0);
+      s1 = _mm256_fmadd_pd (_mm256_loadu_pd (a1 + i), x, s1);
+      s2 = _mm256_fmadd_pd (_mm256_loadu_pd (a2 + i), x, s2);
+      s3 = _mm256_fmadd_pd (_mm256_loadu_pd (a3 + i), x, s3);
+    }
+
+  r[0] += hsum_avx2 (s0);
+  r[1] += hsum_avx2 (s1);
+  r[2] += hsum_avx2 (s2);
+  r[3] += hsum_avx2 (s3);
+
+  for (; i < N; i++)
+    {
+      r[0] += a0[i] * X[i];
+      r[1] += a1[i] * X[i];
+      r[2] += a2[i] * X[i];
+      r[3] += a3[i] * X[i];
+    }
+}
+
+TARGET("avx2") EXACT static void
+daxpy4_avx2 (const int N, const double *t, const double *A, const int lda,
+             double *Y)
+{
+  const double *a0 = A, *a1 = A + lda, *a2 = A + 2 * lda, *a3 = A + 3 * lda;
+  const __m256d t0 = _mm256_set1_pd (t[0]), t1 = _mm256_set1_pd (t[1]);
+  const __m256d t2 = _mm256_set1_pd (t[2]), t3 = _mm256_set1_pd (t[3]);
+  int i;
+
+  for (i = 0; i + 4 <= N; i += 4)
+    {
+      __m256d y = _mm256_loadu_pd (Y + i);
+      y = _mm256_add_pd (y, _mm256_mul_pd (t0, _mm256_loadu_pd (a0 + i)));
+      y = _mm256_add_pd (y, _mm256_mul_pd (t1, _mm256_loadu_pd (a1 + i)));
+      y = _mm256_add_pd (y, _mm256_mul_pd (t2, _mm256_loadu_pd (a2 + i)));
+      y = _mm256_add_pd (y, _mm256_mul_pd (t3, _mm256_loadu_pd (a3 + i)));
+      _mm256_storeu_pd (Y + i, y);
+    }
+
+  for (; i < N; i++)
+    {
+      double y = Y[i];
+      y += t[0] * a0[i];
+      y += t[1] * a1[i];
+      y += t[2] * a2[i];
+      y += t[3] * a3[i];
+      Y[i] = y;
+    }
+}
+
+TARGET("avx2") EXACT static void
+dger4_avx2 (const int N, const double *t, const double *Y, double *A,
+            const int lda)
+{
+  double *a0 = A, *a1 = A + lda, *a2 = A + 2 * lda, *a3 = A + 3 * lda;
+  const __m256d t0 = _mm256_set1_pd (t[0]), t1 = _mm256_set1_pd (t[1]);
+  const __m256d t2 = _mm256_set1_pd (t[2]), t3 = _mm256_set1_pd (t[3]);
+  int i;
+
+  for (i = 0; i + 4 <= N; i += 4)
+    {
+      const __m256d y = _mm256_loadu_pd (Y + i);
+      _mm256_storeu_pd (a0 + i, _mm256_add_pd (_mm256_loadu_pd (a0 + i), _mm256_mul_pd (y, t0)));
+      _mm256_storeu_pd (a1 + i, _mm256_add_pd (_mm256_loadu_pd (a1 + i), _mm256_mul_pd (y, t1)));
+      _mm256_storeu_pd (a2 + i, _mm256_add_pd (_mm256_loadu_pd (a2 + i), _mm256_mul_pd (y, t2)));
+      _mm256_storeu_pd (a3 + i, _mm256_add_pd (_mm256_loadu_pd (a3 + i), _mm256_mul_pd (y, t3)));
+    }
+
+  for (; i < N; i++)
+    {
+      a0[i] += Y[i] * t[0];
+      a1[i] += Y[i] * t[1];
+      a2[i] += Y[i] * t[2];
+      a3[i] += Y[i] * t[3];
+    }
+}
+
+/* AVX-512 */
+
+TARGET("avx512f") static double
+ddot_avx512 (const int N, const double *X, const double *Y)
+{
+  __m512d s0 = _mm512_setzero_pd (), s1 = _mm512_setzero_pd ();
+  __m512d s2 = _mm512_setzero_pd (), s3 = _mm512_setzero_pd ();
+  double r;
+  int i;
+
+  for (i = 0; i + 32 <= N; i += 32)
+    {
+      s0 = _mm512_fmadd_pd (_mm512_loadu_pd (X + i), _mm512_loadu_pd (Y + i), s0);
+      s1 = _mm512_fmadd_pd (_mm512_loadu_pd (X + i + 8), _mm512_loadu_pd (Y + i + 8), s1);
+      s2 = _mm512_fmadd_pd (_mm512_loadu_pd (X + i + 16), _mm512_loadu_pd (Y + i + 16), s2);
+      s3 = _mm512_fmadd_pd (_mm512_loadu_pd (X + i + 24), _mm512_loadu_pd (Y + i + 24), s3);
+    }
+
+  for (; i + 8 <= N; i += 8)
+    s0 = _mm512_fmadd_pd (_mm512_loadu_pd (X + i), _mm512_loadu_pd (Y + i), s0);
+
+  r = _mm512_reduce_add_pd (_mm512_add_pd (_mm512_add_pd (s0, s1), _mm512_add_pd (s2, s3)));
+
+  for (; i < N; i++)
+    r += X[i] * Y[i];
+
+  return r;
+}
+
+TARGET("avx512f") EXACT static void
+daxpy_avx512 (const int N, const double alpha, const double *X, double *Y)
+{
+  const __m512d a = _mm512_set1_pd (alpha);
+  int i;
+
+  for (i = 0; i + 16 <= N; i += 16)
+    {
+      _mm512_storeu_pd (Y + i, _mm512_add_pd (_mm512_loadu_pd (Y + i), _mm512_mul_pd (a, _mm512_loadu_pd (X + i))));
+      _mm512_storeu_pd (Y + i + 8, _mm512_add_pd (_mm512_loadu_pd (Y + i + 8), _mm512_mul_pd (a, _mm512_loadu_pd (X + i + 8))));
+    }
+
+  for (; i < N; i++)
+    Y[i] += alpha * X[i];
+}
+
+TARGET("avx512f") static double
+dssq_avx512 (const int N, const double *X)
+{
+  __m512d s0 = _mm512_setzero_pd (), s1 = _mm512_setzero_pd ();
+  double r;
+  int i;
+
+  for (i = 0; i + 16 <= N; i += 16)
+    {
+      const __m512d x0 = _mm512_loadu_pd (X + i);
+      const __m512d x1 = _mm512_loadu_pd (X + i + 8);
+      s0 = _mm512_fmadd_pd (x0, x0, s0);
+      s1 = _mm512_fmadd_pd (x1, x1, s1);
+    }
+
+  r = _mm512_reduce_add_pd (_mm512_add_pd (s0, s1));
+
+  for (; i < N; i++)
+    r += X[i] * X[i];
+
+  return r;
+}
+
+TARGET("avx512f") static double
+dasum_avx512 (const int N, const double *X)
+{
+  __m512d s0 = _mm512_setzero_pd (), s1 = _mm512_setzero_pd ();
+  double r;
+  int i;
+
+  for (i = 0; i + 16 <= N; i += 16)
+    {
+      s0 = _mm512_add_pd (s0, _mm512_abs_pd (_mm512_loadu_pd (X + i)));
+      s1 = _mm512_add_pd (s1, _mm512_abs_pd (_mm512_loadu_pd (X + i + 8)));
+    }
+
+  r = _mm512_reduce_add_pd (_mm512_add_pd (s0, s1));
+
+  for (; i < N; i++)
+    r += fabs (X[i]);
+
+  return r;
+}
+
+TARGET("avx512f") static int
+idamax_avx512 (const int N, const double *X)
+{
+  __m512d m = _mm512_setzero_pd ();
+  double r;
+  int i;
+
+  for (i = 0; i + 8 <= N; i += 8)
+    m = _mm512_max_pd (_mm512_abs_pd (_mm512_loadu_pd (X + i)), m);
+
+  r = _mm512_reduce_max_pd (m);
+
+  for (; i < N; i++)
+    {
+      if (fabs (X[i]) > r)
+        r = fabs (X[i]);
+    }
+
+  return idamax_scan (N, X, r);
+}
+
+static const gsl_cblas_l1_kernels kernels_sse2 =
+  { "sse2", ddot_sse2, daxpy_sse2, dssq_sse2, dasum_sse2, idamax_sse2,
+    ddot4_sse2, daxpy4_sse2, dger4_sse2 };
+
+static const gsl_cblas_l1_kernels kernels_avx2 =
+  { "avx2", ddot_avx2, daxpy_avx2, dssq_avx2, dasum_avx2, idamax_avx2,
+    ddot4_avx2, daxpy4_avx2, dger4_avx2 };
+
+/* every processor with AVX-512 also has AVX2 and FMA */
+static const gsl_cblas_l1_kernels kernels_avx512 =
+  { "avx512", ddot_avx512, daxpy_avx512, dssq_avx512, dasum_avx512, idamax_avx512,
+    ddot4_avx2, daxpy4_avx2, dger4_avx2 };
+
+#endif /* CBLAS_HAVE_X86_DISPATCH */
+
+static const gsl_cblas_l1_kernels kernels_none =
+  { "none", NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL };
+
+static const gsl_cblas_l1_kernels *kernels_selected = NULL;
+
+static const gsl_cblas_l1_kernels *
+kernels_select (void)
+{
+  const gsl_cblas_l1_kernels *k = &kernels_none;
+
+#ifdef CBLAS_HAVE_X86_DISPATCH
+  {
+    const char *env = getenv ("GSL_CBLAS_SIMD");
+    int level = 3;
+
+    if (env != NULL)
+      {
+        if (strcmp (env, "none") == 0)
+          level = 0;
+        else if (strcmp (env, "sse2") == 0)
+          level = 1;
+        else if (strcmp (env, "avx2") == 0)
+          level = 2;
+      }
+
+    __builtin_cpu_init ();
+
+    if (level >= 3 && __builtin_cpu_supports ("avx512f"))
+      k = &kernels_avx512;
+    else if (level >= 2 && __builtin_cpu_supports ("avx2") && __builtin_cpu_supports ("fma"))
+      k = &kernels_avx2;
+    else if (level >= 1 && __builtin_cpu_supports ("sse2"))
+      k = &kernels_sse2;
+  }
+#endif
+
+  return k;
+}
+
+/* Selecting the kernels is idempotent, so concurrent first calls from
+   several threads store the same pointer. */
+const gsl_cblas_l1_kernels *
+gsl_cblas_l1_kernels_get (void)
+{
+  if (kernels_selected == NULL)
+    kernels_selected = kernels_select ();
+
+  return kernels_selected;
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+static void kernels_init (void) __attribute__ ((constructor));
+
+static void
+kernels_init (void)
+{
+  gsl_cblas_l1_kernels_get ();
+}
+#endif
@@ -0,0 +1,56 @@
+/* cblas/kernels_l1.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __CBLAS_KERNELS_L1_H__
+#define __CBLAS_KERNELS_L1_H__
+
+/* Unit-stride Level-1 kernels selected at run time according to the
+ * instruction set of the processor (see kernels_l1.c). A NULL entry
+ * means that no vectorized kernel is available and the caller should
+ * use its portable strided loop, which keeps the reference order of
+ * operations. */
+
+typedef struct
+{
+  const char *name;
+  double (*ddot) (const int N, const double *X, const double *Y);
+  void (*daxpy) (const int N, const double alpha, const double *X, double *Y);
+  double (*dssq) (const int N, const double *X);
+  double (*dasum) (const int N, const double *X);
+  int (*idamax) (const int N, const double *X);
+
+  /* multi-row kernels for gemv and ger (gemv_block_r.h), on four rows
+     A, A + lda, A + 2*lda, A + 3*lda of length N */
+  void (*ddot4) (const int N, const double *A, const int lda,
+                 const double *X, double *r);
+  void (*daxpy4) (const int N, const double *t, const double *A,
+                  const int lda, double *Y);
+  void (*dger4) (const int N, const double *t, const double *Y, double *A,
+                 const int lda);
+} gsl_cblas_l1_kernels;
+
+const gsl_cblas_l1_kernels * gsl_cblas_l1_kernels_get (void);
+
+/* vectors shorter than this always use the portable loops */
+#define CBLAS_L1_MIN 16
+
+#define CBLAS_L1_KERNEL(f, N) \
+  ((N) >= CBLAS_L1_MIN ? gsl_cblas_l1_kernels_get ()->f : NULL)
+
+#endif /* __CBLAS_KERNELS_L1_H__ */
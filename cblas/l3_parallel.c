@@ -0,0 +1,763 @@
+/* cblas/l3_parallel.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Splitting of the Level-3 routines into independent tiles which are
+ * run on the thread pool of thread.c.
+ *
+ * gemm:        C is divided into CBLAS_L3_TILE x CBLAS_L3_TILE tiles
+ * symm, hemm,
+ * trmm, trsm:  the columns of B (side = left) or the rows of B
+ *              (side = right) are divided into strips, which are
+ *              independent of each other
+ * syrk, herk,
+ * syr2k, her2k: C is divided into block rows; each task updates the
+ *              diagonal block with the routine itself and the
+ *              off-diagonal part of the block row with gemm
+ *
+ * trmm and trsm problems which are not split, or are a tile of a split
+ * problem, are blocked recursively along the triangular dimension so
+ * that most of the work is done by gemm (see l3_trxm_block below).
+ *
+ * Each tile is computed by calling the public routine on the
+ * sub-matrices. Since the call is made from a pool task it is not
+ * split again. The inner dimension K is never split, so each element of
+ * the result is computed with the same sequence of operations whatever
+ * the number of threads, and the tiling only depends on the problem
+ * dimensions.
+ */
+
+#include <config.h>
+#include <gsl/gsl_cblas.h>
+#include "thread.h"
+
+typedef struct
+{
+  char type;
+  int herm;
+  int solve;
+  enum CBLAS_ORDER Order;
+  enum CBLAS_SIDE Side;
+  enum CBLAS_UPLO Uplo;
+  enum CBLAS_TRANSPOSE TransA;
+  enum CBLAS_TRANSPOSE TransB;
+  enum CBLAS_DIAG Diag;
+  int M, N, K;
+  const void *alpha;
+  const void *beta;
+  const void *A;
+  int lda;
+  const void *B;
+  int ldb;
+  void *C;
+  int ldc;
+  int ntiles;                   /* number of tiles along N (gemm) */
+} l3_args;
+
+static size_t
+l3_size (const char type)
+{
+  switch (type)
+    {
+    case 's':
+      return sizeof (float);
+    case 'd':
+      return sizeof (double);
+    case 'c':
+      return 2 * sizeof (float);
+    default:
+      return 2 * sizeof (double);
+    }
+}
+
+/* pointer to element (i,j) of a matrix */
+static void *
+l3_ptr (const l3_args * p, const void *X, const int ld, const int i, const int j)
+{
+  const size_t offset = (p->Order == CblasRowMajor) ? (size_t) i * ld + j : (size_t) j * ld + i;
+  return (char *) X + offset * l3_size (p->type);
+}
+
+/* pointer to row r of op(X) */
+static void *
+l3_oprow (const l3_args * p, const enum CBLAS_TRANSPOSE Trans, const void *X,
+          const int ld, const int r)
+{
+  return (Trans == CblasNoTrans) ? l3_ptr (p, X, ld, r, 0) : l3_ptr (p, X, ld, 0, r);
+}
+
+static int
+l3_ntiles (const int n)
+{
+  return (n + CBLAS_L3_TILE - 1) / CBLAS_L3_TILE;
+}
+
+/* only split problems with enough work to be worth the overhead */
+static int
+l3_split (const int ntasks, const double work)
+{
+  return gsl_cblas_have_threads () && ntasks > 1 && !gsl_cblas_in_parallel ()
+    && work >= 0.125 * CBLAS_L3_TILE * CBLAS_L3_TILE * CBLAS_L3_TILE;
+}
+
+static void
+l3_call_gemm (const l3_args * p, const enum CBLAS_TRANSPOSE TransA,
+              const enum CBLAS_TRANSPOSE TransB, const int M, const int N,
+              const void *alpha, const void *A, const void *B,
+              const void *beta, void *C)
+{
+  switch (p->type)
+    {
+    case 's':
+      cblas_sgemm (p->Order, TransA, TransB, M, N, p->K, *(const float *) alpha,
+                   A, p->lda, B, p->ldb, *(const float *) beta, C, p->ldc);
+      break;
+    case 'd':
+      cblas_dgemm (p->Order, TransA, TransB, M, N, p->K, *(const double *) alpha,
+                   A, p->lda, B, p->ldb, *(const double *) beta, C, p->ldc);
+      break;
+    case 'c':
+      cblas_cgemm (p->Order, TransA, TransB, M, N, p->K, alpha,
+                   A, p->lda, B, p->ldb, beta, C, p->ldc);
+      break;
+    case 'z':
+      cblas_zgemm (p->Order, TransA, TransB, M, N, p->K, alpha,
+                   A, p->lda, B, p->ldb, beta, C, p->ldc);
+      break;
+    }
+}
+
+static void
+l3_task_gemm (void *arg, const int t)
+{
+  const l3_args *p = (const l3_args *) arg;
+  const int i0 = (t / p->ntiles) * CBLAS_L3_TILE;
+  const int j0 = (t % p->ntiles) * CBLAS_L3_TILE;
+  const int m = (p->M - i0 < CBLAS_L3_TILE) ? p->M - i0 : CBLAS_L3_TILE;
+  const int n = (p->N - j0 < CBLAS_L3_TILE) ? p->N - j0 : CBLAS_L3_TILE;
+  const void *A = l3_oprow (p, p->TransA, p->A, p->lda, i0);
+  const void *B = (p->TransB == CblasNoTrans) ? l3_ptr (p, p->B, p->ldb, 0, j0) : l3_ptr (p, p->B, p->ldb, j0, 0);
+
+  l3_call_gemm (p, p->TransA, p->TransB, m, n, p->alpha, A, B, p->beta,
+                l3_ptr (p, p->C, p->ldc, i0, j0));
+}
+
+int
+gsl_cblas_l3_gemm (const char type, const enum CBLAS_ORDER Order,
+                   const enum CBLAS_TRANSPOSE TransA,
+                   const enum CBLAS_TRANSPOSE TransB,
+                   const int M, const int N, const int K,
+                   const void *alpha, const void *A, const int lda,
+                   const void *B, const int ldb, const void *beta,
+                   void *C, const int ldc)
+{
+  const int ntasks = l3_ntiles (M) * l3_ntiles (N);
+  l3_args p;
+
+  if (!l3_split (ntasks, (double) M * N * K))
+    return 0;
+
+  p.type = type;
+  p.Order = Order;
+  p.TransA = TransA;
+  p.TransB = TransB;
+  p.M = M;
+  p.N = N;
+  p.K = K;
+  p.alpha = alpha;
+  p.beta = beta;
+  p.A = A;
+  p.lda = lda;
+  p.B = B;
+  p.ldb = ldb;
+  p.C = C;
+  p.ldc = ldc;
+  p.ntiles = l3_ntiles (N);
+
+  gsl_cblas_parallel_for (ntasks, l3_task_gemm, &p);
+
+  return 1;
+}
+
+/* symm, hemm */
+
+static void
+l3_task_symm (void *arg, const int t)
+{
+  const l3_args *p = (const l3_args *) arg;
+  const int k0 = t * CBLAS_L3_TILE;
+  const int left = (p->Side == CblasLeft);
+  const int n = (left ? p->N : p->M) - k0;
+  const int nk = (n < CBLAS_L3_TILE) ? n : CBLAS_L3_TILE;
+  const int M = left ? p->M : nk;
+  const int N = left ? nk : p->N;
+  const void *B = left ? l3_ptr (p, p->B, p->ldb, 0, k0) : l3_ptr (p, p->B, p->ldb, k0, 0);
+  void *C = left ? l3_ptr (p, p->C, p->ldc, 0, k0) : l3_ptr (p, p->C, p->ldc, k0, 0);
+
+  switch (p->type)
+    {
+    case 's':
+      cblas_ssymm (p->Order, p->Side, p->Uplo, M, N, *(const float *) p->alpha,
+                   p->A, p->lda, B, p->ldb, *(const float *) p->beta, C, p->ldc);
+      break;
+    case 'd':
+      cblas_dsymm (p->Order, p->Side, p->Uplo, M, N, *(const double *) p->alpha,
+                   p->A, p->lda, B, p->ldb, *(const double *) p->beta, C, p->ldc);
+      break;
+    case 'c':
+      if (p->herm)
+        cblas_chemm (p->Order, p->Side, p->Uplo, M, N, p->alpha,
+                     p->A, p->lda, B, p->ldb, p->beta, C, p->ldc);
+      else
+        cblas_csymm (p->Order, p->Side, p->Uplo, M, N, p->alpha,
+                     p->A, p->lda, B, p->ldb, p->beta, C, p->ldc);
+      break;
+    case 'z':
+      if (p->herm)
+        cblas_zhemm (p->Order, p->Side, p->Uplo, M, N, p->alpha,
+                     p->A, p->lda, B, p->ldb, p->beta, C, p->ldc);
+      else
+        cblas_zsymm (p->Order, p->Side, p->Uplo, M, N, p->alpha,
+                     p->A, p->lda, B, p->ldb, p->beta, C, p->ldc);
+      break;
+    }
+}
+
+int
+gsl_cblas_l3_symm (const char type, const int herm,
+                   const enum CBLAS_ORDER Order,
+                   const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo,
+                   const int M, const int N, const void *alpha,
+                   const void *A, const int lda, const void *B,
+                   const int ldb, const void *beta, void *C,
+                   const int ldc)
+{
+  const int left = (Side == CblasLeft);
+  const int ntasks = l3_ntiles (left ? N : M);
+  l3_args p;
+
+  if (!l3_split (ntasks, (double) M * N * (left ? M : N)))
+    return 0;
+
+  p.type = type;
+  p.herm = herm;
+  p.Order = Order;
+  p.Side = Side;
+  p.Uplo = Uplo;
+  p.M = M;
+  p.N = N;
+  p.alpha = alpha;
+  p.beta = beta;
+  p.A = A;
+  p.lda = lda;
+  p.B = B;
+  p.ldb = ldb;
+  p.C = C;
+  p.ldc = ldc;
+
+  gsl_cblas_parallel_for (ntasks, l3_task_symm, &p);
+
+  return 1;
+}
+
+/* trmm, trsm */
+
+static void
+l3_call_trxm (const l3_args * p, const int M, const int N, const void *alpha,
+              const void *A, void *B)
+{
+#define TRXM_ARGS(alpha) p->Order, p->Side, p->Uplo, p->TransA, p->Diag, M, N, \
+                         alpha, A, p->lda, B, p->ldc
+  switch (p->type)
+    {
+    case 's':
+      if (p->solve)
+        cblas_strsm (TRXM_ARGS (*(const float *) alpha));
+      else
+        cblas_strmm (TRXM_ARGS (*(const float *) alpha));
+      break;
+    case 'd':
+      if (p->solve)
+        cblas_dtrsm (TRXM_ARGS (*(const double *) alpha));
+      else
+        cblas_dtrmm (TRXM_ARGS (*(const double *) alpha));
+      break;
+    case 'c':
+      if (p->solve)
+        cblas_ctrsm (TRXM_ARGS (alpha));
+      else
+        cblas_ctrmm (TRXM_ARGS (alpha));
+      break;
+    case 'z':
+      if (p->solve)
+        cblas_ztrsm (TRXM_ARGS (alpha));
+      else
+        cblas_ztrmm (TRXM_ARGS (alpha));
+      break;
+    }
+#undef TRXM_ARGS
+}
+
+static void
+l3_task_trxm (void *arg, const int t)
+{
+  const l3_args *p = (const l3_args *) arg;
+  const int k0 = t * CBLAS_L3_TILE;
+  const int left = (p->Side == CblasLeft);
+  const int n = (left ? p->N : p->M) - k0;
+  const int nk = (n < CBLAS_L3_TILE) ? n : CBLAS_L3_TILE;
+  const int M = left ? p->M : nk;
+  const int N = left ? nk : p->N;
+  void *B = left ? l3_ptr (p, p->C, p->ldc, 0, k0) : l3_ptr (p, p->C, p->ldc, k0, 0);
+
+  l3_call_trxm (p, M, N, p->alpha, p->A, B);
+}
+
+/* Recursive blocking of trmm and trsm. The triangular dimension na of
+ * op(A) is split as na = n1 + n2,
+ *
+ *   op(A) = [ T11  0  ]   or   [ T11 T12 ]
+ *           [ T21 T22 ]        [  0  T22 ]
+ *
+ * and B is split conformally into B1, B2 (rows for side = left, columns
+ * for side = right). The diagonal blocks are handled by calls to the
+ * routine itself, which split them again until they are at most
+ * CBLAS_TRXM_BLOCK, and the off-diagonal block by a single gemm. For
+ * example a left lower solve is
+ *
+ *   B1 := alpha inv(T11) B1
+ *   B2 := alpha B2 - T21 B1
+ *   B2 := inv(T22) B2
+ *
+ * so that all but O(na^2 CBLAS_TRXM_BLOCK) of the work is done by the
+ * gemm kernel. The off-diagonal block of op(A) is op() of the stored
+ * block A12 (uplo = upper) or A21 (uplo = lower). */
+
+static const float l3_sone[2] = { 1.0f, 0.0f };
+static const float l3_sminus_one[2] = { -1.0f, 0.0f };
+static const double l3_done[2] = { 1.0, 0.0 };
+static const double l3_dminus_one[2] = { -1.0, 0.0 };
+
+static int
+l3_is_zero (const char type, const void *x)
+{
+  switch (type)
+    {
+    case 's':
+      return ((const float *) x)[0] == 0.0f;
+    case 'd':
+      return ((const double *) x)[0] == 0.0;
+    case 'c':
+      return ((const float *) x)[0] == 0.0f && ((const float *) x)[1] == 0.0f;
+    default:
+      return ((const double *) x)[0] == 0.0 && ((const double *) x)[1] == 0.0;
+    }
+}
+
+static void
+l3_trxm_block (const l3_args * p)
+{
+  const int left = (p->Side == CblasLeft);
+  const int na = left ? p->M : p->N;
+  const int lower = ((p->Uplo == CblasLower) == (p->TransA == CblasNoTrans));
+  const int sp = (p->type == 's' || p->type == 'c');
+  const void *one = sp ? (const void *) l3_sone : (const void *) l3_done;
+  const void *minus_one = sp ? (const void *) l3_sminus_one : (const void *) l3_dminus_one;
+  /* split near the middle, on a multiple of 16 */
+  const int n1 = ((na / 2 + 15) / 16) * 16;
+  const int n2 = na - n1;
+  const void *A11 = p->A;
+  const void *A22 = l3_ptr (p, p->A, p->lda, n1, n1);
+  const void *Aoff = (p->Uplo == CblasUpper) ? l3_ptr (p, p->A, p->lda, 0, n1)
+    : l3_ptr (p, p->A, p->lda, n1, 0);
+  void *B1 = p->C;
+  void *B2 = left ? l3_ptr (p, p->C, p->ldc, n1, 0) : l3_ptr (p, p->C, p->ldc, 0, n1);
+  /* B1 and B2 are m1-by-nb1 and m2-by-nb2 */
+  const int m1 = left ? n1 : p->M, nb1 = left ? p->N : n1;
+  const int m2 = left ? n2 : p->M, nb2 = left ? p->N : n2;
+  l3_args q = *p;
+
+  /* the block of B which is computed first, and the other one */
+  const int first1 = (p->solve == (left ? lower : !lower));
+
+  q.ldc = p->ldc;
+
+  if (left)
+    {
+      q.lda = p->lda;
+      q.ldb = p->ldc;
+    }
+  else
+    {
+      q.lda = p->ldc;
+      q.ldb = p->lda;
+    }
+
+  if (first1)
+    {
+      /* solve:    B1 := alpha inv(T11) B1, B2 := alpha B2 - T21 B1,
+                   B2 := inv(T22) B2  (left lower, right upper)
+         multiply: B1 := alpha T11 B1, B1 := B1 + alpha T12 B2,
+                   B2 := alpha T22 B2  (left upper, right lower) */
+      l3_call_trxm (p, m1, nb1, p->alpha, A11, B1);
+
+      if (p->solve)
+        {
+          q.K = n1;
+          if (left)
+            l3_call_gemm (&q, p->TransA, CblasNoTrans, m2, nb2, minus_one, Aoff, B1, p->alpha, B2);
+          else
+            l3_call_gemm (&q, CblasNoTrans, p->TransA, m2, nb2, minus_one, B1, Aoff, p->alpha, B2);
+          l3_call_trxm (p, m2, nb2, one, A22, B2);
+        }
+      else
+        {
+          q.K = n2;
+          if (left)
+            l3_call_gemm (&q, p->TransA, CblasNoTrans, m1, nb1, p->alpha, Aoff, B2, one, B1);
+          else
+            l3_call_gemm (&q, CblasNoTrans, p->TransA, m1, nb1, p->alpha, B2, Aoff, one, B1);
+          l3_call_trxm (p, m2, nb2, p->alpha, A22, B2);
+        }
+    }
+  else
+    {
+      /* solve:    B2 := alpha inv(T22) B2, B1 := alpha B1 - T12 B2,
+                   B1 := inv(T11) B1  (left upper, right lower)
+         multiply: B2 := alpha T22 B2, B2 := B2 + alpha T21 B1,
+                   B1 := alpha T11 B1  (left lower, right upper) */
+      l3_call_trxm (p, m2, nb2, p->alpha, A22, B2);
+
+      if (p->solve)
+        {
+          q.K = n2;
+          if (left)
+            l3_call_gemm (&q, p->TransA, CblasNoTrans, m1, nb1, minus_one, Aoff, B2, p->alpha, B1);
+          else
+            l3_call_gemm (&q, CblasNoTrans, p->TransA, m1, nb1, minus_one, B2, Aoff, p->alpha, B1);
+          l3_call_trxm (p, m1, nb1, one, A11, B1);
+        }
+      else
+        {
+          q.K = n1;
+          if (left)
+            l3_call_gemm (&q, p->TransA, CblasNoTrans, m2, nb2, p->alpha, Aoff, B1, one, B2);
+          else
+            l3_call_gemm (&q, CblasNoTrans, p->TransA, m2, nb2, p->alpha, B1, Aoff, one, B2);
+          l3_call_trxm (p, m1, nb1, p->alpha, A11, B1);
+        }
+    }
+}
+
+int
+gsl_cblas_l3_trxm (const char type, const int solve,
+                   const enum CBLAS_ORDER Order,
+                   const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo,
+                   const enum CBLAS_TRANSPOSE TransA,
+                   const enum CBLAS_DIAG Diag, const int M, const int N,
+                   const void *alpha, const void *A, const int lda,
+                   void *B, const int ldb)
+{
+  const int left = (Side == CblasLeft);
+  const int ntasks = l3_ntiles (left ? N : M);
+  l3_args p;
+
+  p.type = type;
+  p.solve = solve;
+  p.Order = Order;
+  p.Side = Side;
+  p.Uplo = Uplo;
+  p.TransA = TransA;
+  p.Diag = Diag;
+  p.M = M;
+  p.N = N;
+  p.alpha = alpha;
+  p.A = A;
+  p.lda = lda;
+  p.C = B;
+  p.ldc = ldb;
+
+  if (l3_split (ntasks, (double) M * N * (left ? M : N)))
+    {
+      gsl_cblas_parallel_for (ntasks, l3_task_trxm, &p);
+      return 1;
+    }
+
+  if ((left ? M : N) > CBLAS_TRXM_BLOCK && !l3_is_zero (type, alpha))
+    {
+      l3_trxm_block (&p);
+      return 1;
+    }
+
+  return 0;
+}
+
+/* syrk, herk, syr2k, her2k */
+
+/* off-diagonal part of block row [i0,i0+n) of C: columns [c0,c0+nc) */
+static void
+l3_offdiag (const l3_args * p, const int i0, const int n, int *c0, int *nc)
+{
+  if (p->Uplo == CblasUpper)
+    {
+      *c0 = i0 + n;
+      *nc = p->N - *c0;
+    }
+  else
+    {
+      *c0 = 0;
+      *nc = i0;
+    }
+}
+
+static void
+l3_task_syrk (void *arg, const int t)
+{
+  const l3_args *p = (const l3_args *) arg;
+  const int i0 = t * CBLAS_L3_TILE;
+  const int n = (p->N - i0 < CBLAS_L3_TILE) ? p->N - i0 : CBLAS_L3_TILE;
+  const enum CBLAS_TRANSPOSE Trans = p->TransA;
+  const void *Ai = l3_oprow (p, Trans, p->A, p->lda, i0);
+  void *Cii = l3_ptr (p, p->C, p->ldc, i0, i0);
+  int c0, nc;
+
+  switch (p->type)
+    {
+    case 's':
+      cblas_ssyrk (p->Order, p->Uplo, Trans, n, p->K, *(const float *) p->alpha,
+                   Ai, p->lda, *(const float *) p->beta, Cii, p->ldc);
+      break;
+    case 'd':
+      cblas_dsyrk (p->Order, p->Uplo, Trans, n, p->K, *(const double *) p->alpha,
+                   Ai, p->lda, *(const double *) p->beta, Cii, p->ldc);
+      break;
+    case 'c':
+      if (p->herm)
+        cblas_cherk (p->Order, p->Uplo, Trans, n, p->K, *(const float *) p->alpha,
+                     Ai, p->lda, *(const float *) p->beta, Cii, p->ldc);
+      else
+        cblas_csyrk (p->Order, p->Uplo, Trans, n, p->K, p->alpha,
+                     Ai, p->lda, p->beta, Cii, p->ldc);
+      break;
+    case 'z':
+      if (p->herm)
+        cblas_zherk (p->Order, p->Uplo, Trans, n, p->K, *(const double *) p->alpha,
+                     Ai, p->lda, *(const double *) p->beta, Cii, p->ldc);
+      else
+        cblas_zsyrk (p->Order, p->Uplo, Trans, n, p->K, p->alpha,
+                     Ai, p->lda, p->beta, Cii, p->ldc);
+      break;
+    }
+
+  l3_offdiag (p, i0, n, &c0, &nc);
+
+  if (nc > 0)
+    {
+      const enum CBLAS_TRANSPOSE T = p->herm ? CblasConjTrans : CblasTrans;
+      const enum CBLAS_TRANSPOSE TransA = (Trans == CblasNoTrans) ? CblasNoTrans : T;
+      const enum CBLAS_TRANSPOSE TransB = (Trans == CblasNoTrans) ? T : CblasNoTrans;
+      const void *Ac = l3_oprow (p, Trans, p->A, p->lda, c0);
+      void *Cic = l3_ptr (p, p->C, p->ldc, i0, c0);
+      l3_args q = *p;
+
+      q.ldb = p->lda;
+
+      if (p->herm && p->type == 'c')
+        {
+          const float alpha[2] = { *(const float *) p->alpha, 0.0f };
+          const float beta[2] = { *(const float *) p->beta, 0.0f };
+          l3_call_gemm (&q, TransA, TransB, n, nc, alpha, Ai, Ac, beta, Cic);
+        }
+      else if (p->herm && p->type == 'z')
+        {
+          const double alpha[2] = { *(const double *) p->alpha, 0.0 };
+          const double beta[2] = { *(const double *) p->beta, 0.0 };
+          l3_call_gemm (&q, TransA, TransB, n, nc, alpha, Ai, Ac, beta, Cic);
+        }
+      else
+        {
+          l3_call_gemm (&q, TransA, TransB, n, nc, p->alpha, Ai, Ac, p->beta, Cic);
+        }
+    }
+}
+
+int
+gsl_cblas_l3_syrk (const char type, const int herm,
+                   const enum CBLAS_ORDER Order,
+                   const enum CBLAS_UPLO Uplo,
+                   const enum CBLAS_TRANSPOSE Trans, const int N,
+                   const int K, const void *alpha, const void *A,
+                   const int lda, const void *beta, void *C,
+                   const int ldc)
+{
+  const int ntasks = l3_ntiles (N);
+  l3_args p;
+
+  if (!l3_split (ntasks, 0.5 * (double) N * N * K))
+    return 0;
+
+  p.type = type;
+  p.herm = herm;
+  p.Order = Order;
+  p.Uplo = Uplo;
+  p.TransA = Trans;
+  p.N = N;
+  p.K = K;
+  p.alpha = alpha;
+  p.beta = beta;
+  p.A = A;
+  p.lda = lda;
+  p.C = C;
+  p.ldc = ldc;
+
+  gsl_cblas_parallel_for (ntasks, l3_task_syrk, &p);
+
+  return 1;
+}
+
+static void
+l3_task_syr2k (void *arg, const int t)
+{
+  const l3_args *p = (const l3_args *) arg;
+  const int i0 = t * CBLAS_L3_TILE;
+  const int n = (p->N - i0 < CBLAS_L3_TILE) ? p->N - i0 : CBLAS_L3_TILE;
+  const enum CBLAS_TRANSPOSE Trans = p->TransA;
+  const void *Ai = l3_oprow (p, Trans, p->A, p->lda, i0);
+  const void *Bi = l3_oprow (p, Trans, p->B, p->ldb, i0);
+  void *Cii = l3_ptr (p, p->C, p->ldc, i0, i0);
+  int c0, nc;
+
+#define SYR2K_ARGS(alpha, beta) p->Order, p->Uplo, Trans, n, p->K, alpha, \
+                                Ai, p->lda, Bi, p->ldb, beta, Cii, p->ldc
+  switch (p->type)
+    {
+    case 's':
+      cblas_ssyr2k (SYR2K_ARGS (*(const float *) p->alpha, *(const float *) p->beta));
+      break;
+    case 'd':
+      cblas_dsyr2k (SYR2K_ARGS (*(const double *) p->alpha, *(const double *) p->beta));
+      break;
+    case 'c':
+      if (p->herm)
+        cblas_cher2k (SYR2K_ARGS (p->alpha, *(const float *) p->beta));
+      else
+        cblas_csyr2k (SYR2K_ARGS (p->alpha, p->beta));
+      break;
+    case 'z':
+      if (p->herm)
+        cblas_zher2k (SYR2K_ARGS (p->alpha, *(const double *) p->beta));
+      else
+        cblas_zsyr2k (SYR2K_ARGS (p->alpha, p->beta));
+      break;
+    }
+#undef SYR2K_ARGS
+
+  l3_offdiag (p, i0, n, &c0, &nc);
+
+  if (nc > 0)
+    {
+      const enum CBLAS_TRANSPOSE T = p->herm ? CblasConjTrans : CblasTrans;
+      const enum CBLAS_TRANSPOSE TransA = (Trans == CblasNoTrans) ? CblasNoTrans : T;
+      const enum CBLAS_TRANSPOSE TransB = (Trans == CblasNoTrans) ? T : CblasNoTrans;
+      const void *Ac = l3_oprow (p, Trans, p->A, p->lda, c0);
+      const void *Bc = l3_oprow (p, Trans, p->B, p->ldb, c0);
+      void *Cic = l3_ptr (p, p->C, p->ldc, i0, c0);
+      l3_args q = *p;
+
+      /* C := alpha op(A) op(B)' + beta C, then
+         C := alpha op(B) op(A)' + C  (conj(alpha) for her2k) */
+
+      if (p->type == 's')
+        {
+          const float one = 1.0f;
+          l3_call_gemm (&q, TransA, TransB, n, nc, p->alpha, Ai, Bc, p->beta, Cic);
+          q.lda = p->ldb;
+          q.ldb = p->lda;
+          l3_call_gemm (&q, TransA, TransB, n, nc, p->alpha, Bi, Ac, &one, Cic);
+        }
+      else if (p->type == 'd')
+        {
+          const double one = 1.0;
+          l3_call_gemm (&q, TransA, TransB, n, nc, p->alpha, Ai, Bc, p->beta, Cic);
+          q.lda = p->ldb;
+          q.ldb = p->lda;
+          l3_call_gemm (&q, TransA, TransB, n, nc, p->alpha, Bi, Ac, &one, Cic);
+        }
+      else if (p->type == 'c')
+        {
+          const float *a = (const float *) p->alpha;
+          const float *b = (const float *) p->beta;
+          const float alpha2[2] = { a[0], p->herm ? -a[1] : a[1] };
+          const float beta1[2] = { b[0], p->herm ? 0.0f : b[1] };
+          const float one[2] = { 1.0f, 0.0f };
+          l3_call_gemm (&q, TransA, TransB, n, nc, a, Ai, Bc, beta1, Cic);
+          q.lda = p->ldb;
+          q.ldb = p->lda;
+          l3_call_gemm (&q, TransA, TransB, n, nc, alpha2, Bi, Ac, one, Cic);
+        }
+      else
+        {
+          const double *a = (const double *) p->alpha;
+          const double *b = (const double *) p->beta;
+          const double alpha2[2] = { a[0], p->herm ? -a[1] : a[1] };
+          const double beta1[2] = { b[0], p->herm ? 0.0 : b[1] };
+          const double one[2] = { 1.0, 0.0 };
+          l3_call_gemm (&q, TransA, TransB, n, nc, a, Ai, Bc, beta1, Cic);
+          q.lda = p->ldb;
+          q.ldb = p->lda;
+          l3_call_gemm (&q, TransA, TransB, n, nc, alpha2, Bi, Ac, one, Cic);
+        }
+    }
+}
+
+int
+gsl_cblas_l3_syr2k (const char type, const int herm,
+                    const enum CBLAS_ORDER Order,
+                    const enum CBLAS_UPLO Uplo,
+                    const enum CBLAS_TRANSPOSE Trans, const int N,
+                    const int K, const void *alpha, const void *A,
+                    const int lda, const void *B, const int ldb,
+                    const void *beta, void *C, const int ldc)
+{
+  const int ntasks = l3_ntiles (N);
+  l3_args p;
+
+  if (!l3_split (ntasks, (double) N * N * K))
+    return 0;
+
+  p.type = type;
+  p.herm = herm;
+  p.Order = Order;
+  p.Uplo = Uplo;
+  p.TransA = Trans;
+  p.N = N;
+  p.K = K;
+  p.alpha = alpha;
+  p.beta = beta;
+  p.A = A;
+  p.lda = lda;
+  p.B = B;
+  p.ldb = ldb;
+  p.C = C;
+  p.ldc = ldc;
+
+  gsl_cblas_parallel_for (ntasks, l3_task_syr2k, &p);
+
+  return 1;
+}
@@ -2,6 +2,13 @@
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
 #include "error_cblas_l3.h"
+#include "thread.h"
+
+/* wider micro-kernel tile: twice as many floats fit in a vector register */
+#define GEMM_NR 8
+#define BASE float
+#include "gemm_block_r.h"
+#undef BASE
 
 void
 cblas_sgemm (const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA,
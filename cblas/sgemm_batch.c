@@ -0,0 +1,42 @@
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_cblas.h>
+#include "cblas.h"
+#include "error_cblas_l3.h"
+#include "thread.h"
+
+#define BASE float
+#define GEMM cblas_sgemm
+#include "gemm_batch_r.h"
+#undef GEMM
+#undef BASE
+
+void
+cblas_sgemm_batch_strided (const enum CBLAS_ORDER Order,
+                            const enum CBLAS_TRANSPOSE TransA,
+                            const enum CBLAS_TRANSPOSE TransB, const int M,
+                            const int N, const int K, const float alpha,
+                            const float *A, const int lda, const int stridea,
+                            const float *B, const int ldb, const int strideb,
+                            const float beta, float *C, const int ldc,
+                            const int stridec, const int batch_size)
+{
+#define BASE float
+#include "source_gemm_batch_r.h"
+#undef BASE
+}
+
+void
+cblas_sgemm_batch (const enum CBLAS_ORDER Order,
+                   const enum CBLAS_TRANSPOSE *TransA_array,
+                   const enum CBLAS_TRANSPOSE *TransB_array,
+                   const int *M_array, const int *N_array, const int *K_array,
+                   const float *alpha_array, const float **A_array,
+                   const int *lda_array, const float **B_array,
+                   const int *ldb_array, const float *beta_array,
+                   float **C_array, const int *ldc_array,
+                   const int group_count, const int *group_size)
+{
+#define BASE float
+#include "source_gemm_group_r.h"
+#undef BASE
+}
@@ -3,6 +3,10 @@
 #include "cblas.h"
 #include "error_cblas_l2.h"
 
+#define BASE float
+#include "gemv_block_r.h"
+#undef BASE
+
 void
 cblas_sgemv (const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE TransA,
              const int M, const int N, const float alpha, const float *A,
@@ -0,0 +1,40 @@
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_cblas.h>
+#include "cblas.h"
+#include "error_cblas_l2.h"
+#include "thread.h"
+
+#define BASE float
+#define GEMV cblas_sgemv
+#include "gemv_batch_r.h"
+#undef GEMV
+#undef BASE
+
+void
+cblas_sgemv_batch_strided (const enum CBLAS_ORDER order,
+                            const enum CBLAS_TRANSPOSE TransA, const int M,
+                            const int N, const float alpha, const float *A,
+                            const int lda, const int stridea, const float *X,
+                            const int incX, const int stridex,
+                            const float beta, float *Y, const int incY,
+                            const int stridey, const int batch_size)
+{
+#define BASE float
+#include "source_gemv_batch_r.h"
+#undef BASE
+}
+
+void
+cblas_sgemv_batch (const enum CBLAS_ORDER order,
+                   const enum CBLAS_TRANSPOSE *TransA_array,
+                   const int *M_array, const int *N_array,
+                   const float *alpha_array, const float **A_array,
+                   const int *lda_array, const float **X_array,
+                   const int *incX_array, const float *beta_array,
+                   float **Y_array, const int *incY_array,
+                   const int group_count, const int *group_size)
+{
+#define BASE float
+#include "source_gemv_group_r.h"
+#undef BASE
+}
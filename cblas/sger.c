@@ -3,6 +3,12 @@
 #include "cblas.h"
 #include "error_cblas_l2.h"
 
+#define BASE float
+#define GEMV_BLOCK_GER
+#include "gemv_block_r.h"
+#undef GEMV_BLOCK_GER
+#undef BASE
+
 void
 cblas_sger (const enum CBLAS_ORDER order, const int M, const int N,
             const float alpha, const float *X, const int incX, const float *Y,
@@ -0,0 +1,53 @@
+/* cblas/source_gemm_batch_r.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+{
+  gemm_batch_args p;
+
+  CHECK_ARGS_X(GEMM_BATCH,pos,(pos,Order,TransA,TransB,M,N,K,alpha,A,lda,stridea,B,ldb,strideb,beta,C,ldc,stridec,batch_size));
+
+  if (M == 0 || N == 0 || batch_size == 0)
+    return;
+
+  if (alpha == 0.0 && beta == 1.0)
+    return;
+
+  p.Order = Order;
+  p.TransA = TransA;
+  p.TransB = TransB;
+  p.M = M;
+  p.N = N;
+  p.K = K;
+  p.alpha = alpha;
+  p.beta = beta;
+  p.A = A;
+  p.lda = lda;
+  p.stridea = stridea;
+  p.B = B;
+  p.ldb = ldb;
+  p.strideb = strideb;
+  p.C = C;
+  p.ldc = ldc;
+  p.stridec = stridec;
+  p.Ap = 0;
+  p.Bp = 0;
+  p.Cp = 0;
+
+  gsl_cblas_parallel_batch (batch_size, 2.0 * M * N * K, gemm_batch_task, &p);
+}
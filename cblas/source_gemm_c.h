@@ -26,6 +26,9 @@
 
   CHECK_ARGS14(GEMM,Order,TransA,TransB,M,N,K,alpha,A,lda,B,ldb,beta,C,ldc);
 
+  if (gsl_cblas_l3_gemm(CBLAS_TYPE_C, Order, TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc))
+    return;
+
   {
     const BASE alpha_real = CONST_REAL0(alpha);
     const BASE alpha_imag = CONST_IMAG0(alpha);
@@ -83,6 +86,14 @@
     if (alpha_real == 0.0 && alpha_imag == 0.0)
       return;
 
+    /* large products go through the packed-panel engine in
+       gemm_block_c.h, falling back to the loops below if its buffers
+       cannot be allocated */
+    if (GEMM_USE_BLOCK(n1, n2, K)
+        && gemm_block(TransF, conjF, TransG, conjG, 0, n1, n2, K, alpha_real,
+                      alpha_imag, F, ldf, G, ldg, (BASE *) C, ldc) == 0)
+      return;
+
     if (TransF == CblasNoTrans && TransG == CblasNoTrans) {
 
       /* form  C := alpha*A*B + C */
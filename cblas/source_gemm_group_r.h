@@ -0,0 +1,58 @@
+/* cblas/source_gemm_group_r.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+{
+  gemm_group_args p;
+  double work = 0.0;
+  int g, total = 0;
+
+  {
+    int pos = 0;
+    CHECK_DIM(pos,15,group_count);
+    if (pos) cblas_xerbla(pos,__FILE__,"");
+  }
+
+  for (g = 0; g < group_count; g++) {
+    CHECK_ARGS_X(GEMM_GROUP,pos,(pos,Order,TransA_array[g],TransB_array[g],M_array[g],N_array[g],K_array[g],alpha_array[g],A_array,lda_array[g],B_array,ldb_array[g],beta_array[g],C_array,ldc_array[g],group_count,group_size[g]));
+    total += group_size[g];
+    work += 2.0 * M_array[g] * N_array[g] * K_array[g] * group_size[g];
+  }
+
+  if (total == 0)
+    return;
+
+  p.Order = Order;
+  p.TransA = TransA_array;
+  p.TransB = TransB_array;
+  p.M = M_array;
+  p.N = N_array;
+  p.K = K_array;
+  p.alpha = alpha_array;
+  p.beta = beta_array;
+  p.A = A_array;
+  p.lda = lda_array;
+  p.B = B_array;
+  p.ldb = ldb_array;
+  p.C = C_array;
+  p.ldc = ldc_array;
+  p.group_count = group_count;
+  p.group_size = group_size;
+
+  gsl_cblas_parallel_batch (total, work / total, gemm_group_task, &p);
+}
@@ -26,6 +26,9 @@
 
   CHECK_ARGS14(GEMM,Order,TransA,TransB,M,N,K,alpha,A,lda,B,ldb,beta,C,ldc);
 
+  if (gsl_cblas_l3_gemm(CBLAS_TYPE_R, Order, TransA, TransB, M, N, K, &alpha, A, lda, B, ldb, &beta, C, ldc))
+    return;
+
   if (alpha == 0.0 && beta == 1.0)
     return;
 
@@ -67,6 +70,12 @@
   if (alpha == 0.0)
     return;
 
+  /* large products go through the packed-panel engine in gemm_block_r.h,
+     falling back to the loops below if its buffers cannot be allocated */
+  if (GEMM_USE_BLOCK(n1, n2, K)
+      && gemm_block(TransF, TransG, 0, n1, n2, K, alpha, F, ldf, G, ldg, C, ldc) == 0)
+    return;
+
   if (TransF == CblasNoTrans && TransG == CblasNoTrans) {
 
     /* form  C := alpha*A*B + C */
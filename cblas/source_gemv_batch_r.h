@@ -0,0 +1,53 @@
+/* cblas/source_gemv_batch_r.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+{
+  gemv_batch_args p;
+  const int lenY = (TransA == CblasNoTrans) ? M : N;
+  const int lenX = (TransA == CblasNoTrans) ? N : M;
+
+  CHECK_ARGS_X(GEMV_BATCH,pos,(pos,order,TransA,M,N,alpha,A,lda,stridea,X,incX,stridex,beta,Y,incY,stridey,batch_size));
+
+  if (M == 0 || N == 0 || batch_size == 0)
+    return;
+
+  if (alpha == 0.0 && beta == 1.0)
+    return;
+
+  p.order = order;
+  p.TransA = TransA;
+  p.M = M;
+  p.N = N;
+  p.alpha = alpha;
+  p.beta = beta;
+  p.A = A;
+  p.lda = lda;
+  p.stridea = stridea;
+  p.X = X;
+  p.incX = incX;
+  p.stridex = stridex;
+  p.Y = Y;
+  p.incY = incY;
+  p.stridey = stridey;
+  p.Ap = 0;
+  p.Xp = 0;
+  p.Yp = 0;
+
+  gsl_cblas_parallel_batch (batch_size, 2.0 * lenX * lenY, gemv_batch_task, &p);
+}
@@ -0,0 +1,56 @@
+/* cblas/source_gemv_group_r.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+{
+  gemv_group_args p;
+  double work = 0.0;
+  int g, total = 0;
+
+  {
+    int pos = 0;
+    CHECK_DIM(pos,13,group_count);
+    if (pos) cblas_xerbla(pos,__FILE__,"");
+  }
+
+  for (g = 0; g < group_count; g++) {
+    CHECK_ARGS_X(GEMV_GROUP,pos,(pos,order,TransA_array[g],M_array[g],N_array[g],alpha_array[g],A_array,lda_array[g],X_array,incX_array[g],beta_array[g],Y_array,incY_array[g],group_count,group_size[g]));
+    total += group_size[g];
+    work += 2.0 * M_array[g] * N_array[g] * group_size[g];
+  }
+
+  if (total == 0)
+    return;
+
+  p.order = order;
+  p.TransA = TransA_array;
+  p.M = M_array;
+  p.N = N_array;
+  p.alpha = alpha_array;
+  p.beta = beta_array;
+  p.A = A_array;
+  p.lda = lda_array;
+  p.X = X_array;
+  p.incX = incX_array;
+  p.Y = Y_array;
+  p.incY = incY_array;
+  p.group_count = group_count;
+  p.group_size = group_size;
+
+  gsl_cblas_parallel_batch (total, work / total, gemv_group_task, &p);
+}
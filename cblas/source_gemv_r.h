@@ -18,7 +18,7 @@
  */
 
 {
-  INDEX i, j;
+  INDEX i;
   INDEX lenX, lenY;
 
   const int Trans = (TransA != CblasConjTrans) ? TransA : CblasTrans;
@@ -60,32 +60,13 @@
   if ((order == CblasRowMajor && Trans == CblasNoTrans)
       || (order == CblasColMajor && Trans == CblasTrans)) {
     /* form  y := alpha*A*x + y */
-    INDEX iy = OFFSET(lenY, incY);
-    for (i = 0; i < lenY; i++) {
-      BASE temp = 0.0;
-      INDEX ix = OFFSET(lenX, incX);
-      for (j = 0; j < lenX; j++) {
-        temp += X[ix] * A[lda * i + j];
-        ix += incX;
-      }
-      Y[iy] += alpha * temp;
-      iy += incY;
-    }
+    gemv_dot (lenY, lenX, alpha, A, lda, X + OFFSET(lenX, incX), incX,
+              Y + OFFSET(lenY, incY), incY);
   } else if ((order == CblasRowMajor && Trans == CblasTrans)
              || (order == CblasColMajor && Trans == CblasNoTrans)) {
     /* form  y := alpha*A'*x + y */
-    INDEX ix = OFFSET(lenX, incX);
-    for (j = 0; j < lenX; j++) {
-      const BASE temp = alpha * X[ix];
-      if (temp != 0.0) {
-        INDEX iy = OFFSET(lenY, incY);
-        for (i = 0; i < lenY; i++) {
-          Y[iy] += temp * A[lda * j + i];
-          iy += incY;
-        }
-      }
-      ix += incX;
-    }
+    gemv_axpy (lenX, lenY, alpha, A, lda, X + OFFSET(lenX, incX), incX,
+               Y + OFFSET(lenY, incY), incY);
   } else {
     BLAS_ERROR("unrecognized operation");
   }
@@ -18,32 +18,18 @@
  */
 
 {
-  INDEX i, j;
-
   CHECK_ARGS10(SD_GER,order,M,N,alpha,X,incX,Y,incY,A,lda);
 
+  if (M == 0 || N == 0)
+    return;
+
   if (order == CblasRowMajor) {
-    INDEX ix = OFFSET(M, incX);
-    for (i = 0; i < M; i++) {
-      const BASE tmp = alpha * X[ix];
-      INDEX jy = OFFSET(N, incY);
-      for (j = 0; j < N; j++) {
-        A[lda * i + j] += Y[jy] * tmp;
-        jy += incY;
-      }
-      ix += incX;
-    }
+    ger_rows (M, N, alpha, X + OFFSET(M, incX), incX, Y + OFFSET(N, incY),
+              incY, A, lda);
   } else if (order == CblasColMajor) {
-    INDEX jy = OFFSET(N, incY);
-    for (j = 0; j < N; j++) {
-      const BASE tmp = alpha * Y[jy];
-      INDEX ix = OFFSET(M, incX);
-      for (i = 0; i < M; i++) {
-        A[i + lda * j] += X[ix] * tmp;
-        ix += incX;
-      }
-      jy += incY;
-    }
+    /* the columns of A are the rows of its transpose */
+    ger_rows (N, M, alpha, Y + OFFSET(N, incY), incY, X + OFFSET(M, incX),
+              incX, A, lda);
   } else {
     BLAS_ERROR("unrecognized operation");
   }
@@ -24,6 +24,9 @@
 
   CHECK_ARGS13(HEMM,Order,Side,Uplo,M,N,alpha,A,lda,B,ldb,beta,C,ldc);
 
+  if (gsl_cblas_l3_symm(CBLAS_TYPE_C, 1, Order, Side, Uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc))
+    return;
+
   {
     const BASE alpha_real = CONST_REAL0(alpha);
     const BASE alpha_imag = CONST_IMAG0(alpha);
@@ -20,9 +20,13 @@
 {
   INDEX i, j, k;
   int uplo, trans;
+  BASE *Fp, *Gp;
 
   CHECK_ARGS13(HER2K,Order,Uplo,Trans,N,K,alpha,A,lda,B,ldb,beta,C,ldc);
 
+  if (gsl_cblas_l3_syr2k(CBLAS_TYPE_C, 1, Order, Uplo, Trans, N, K, alpha, A, lda, B, ldb, &beta, C, ldc))
+    return;
+
   {
     const BASE alpha_real = CONST_REAL0(alpha);
     BASE alpha_imag = CONST_IMAG0(alpha);
@@ -86,6 +90,29 @@
     if (alpha_real == 0.0 && alpha_imag == 0.0)
       return;
 
+    /* large updates go through the packed-panel engine in
+       gemm_block_c.h, as alpha*op(A)*op(B)^H + conj(alpha)*op(B)*op(A)^H
+       restricted to the requested triangle, with the imaginary part of
+       the diagonal reset afterwards */
+    if (GEMM_USE_BLOCK(N, N, K) && gemm_block_alloc(N, N, K, &Fp, &Gp) == 0) {
+      const int TransF = (trans == CblasNoTrans) ? CblasNoTrans : CblasTrans;
+      const int TransG = (trans == CblasNoTrans) ? CblasTrans : CblasNoTrans;
+      const int conjF = (trans == CblasNoTrans) ? 1 : -1;
+
+      gemm_block_run(TransF, conjF, TransG, -conjF, uplo, N, N, K, alpha_real, alpha_imag,
+                     (const BASE *) A, lda, (const BASE *) B, ldb, (BASE *) C, ldc, Fp, Gp);
+      gemm_block_run(TransF, conjF, TransG, -conjF, uplo, N, N, K, alpha_real, -alpha_imag,
+                     (const BASE *) B, ldb, (const BASE *) A, lda, (BASE *) C, ldc, Fp, Gp);
+
+      free(Fp);
+      free(Gp);
+
+      for (i = 0; i < N; i++) {
+        IMAG(C, ldc * i + i) = 0.0;
+      }
+      return;
+    }
+
     if (uplo == CblasUpper && trans == CblasNoTrans) {
 
       for (i = 0; i < N; i++) {
@@ -158,8 +185,8 @@
 
           /* Cii += alpha * conj(Aki) * Bki + conj(alpha) * conj(Bki) * Aki */
           {
-            REAL(C, i * lda + i) += 2 * (temp1_real * Bki_real - temp1_imag * Bki_imag);
-            IMAG(C, i * lda + i) = 0.0;
+            REAL(C, i * ldc + i) += 2 * (temp1_real * Bki_real - temp1_imag * Bki_imag);
+            IMAG(C, i * ldc + i) = 0.0;
           }
 
           for (j = i + 1; j < N; j++) {
@@ -168,9 +195,9 @@
             BASE Bkj_real = CONST_REAL(B, k * ldb + j);
             BASE Bkj_imag = CONST_IMAG(B, k * ldb + j);
             /* Cij += alpha * conj(Aki) * Bkj + conj(alpha) * conj(Bki) * Akj */
-            REAL(C, i * lda + j) += (temp1_real * Bkj_real - temp1_imag * Bkj_imag)
+            REAL(C, i * ldc + j) += (temp1_real * Bkj_real - temp1_imag * Bkj_imag)
               + (temp2_real * Akj_real - temp2_imag * Akj_imag);
-            IMAG(C, i * lda + j) += (temp1_real * Bkj_imag + temp1_imag * Bkj_real)
+            IMAG(C, i * ldc + j) += (temp1_real * Bkj_imag + temp1_imag * Bkj_real)
               + (temp2_real * Akj_imag + temp2_imag * Akj_real);
           }
         }
@@ -253,16 +280,16 @@
             BASE Bkj_real = CONST_REAL(B, k * ldb + j);
             BASE Bkj_imag = CONST_IMAG(B, k * ldb + j);
             /* Cij += alpha * conj(Aki) * Bkj + conj(alpha) * conj(Bki) * Akj */
-            REAL(C, i * lda + j) += (temp1_real * Bkj_real - temp1_imag * Bkj_imag)
+            REAL(C, i * ldc + j) += (temp1_real * Bkj_real - temp1_imag * Bkj_imag)
               + (temp2_real * Akj_real - temp2_imag * Akj_imag);
-            IMAG(C, i * lda + j) += (temp1_real * Bkj_imag + temp1_imag * Bkj_real)
+            IMAG(C, i * ldc + j) += (temp1_real * Bkj_imag + temp1_imag * Bkj_real)
               + (temp2_real * Akj_imag + temp2_imag * Akj_real);
           }
 
           /* Cii += alpha * conj(Aki) * Bki + conj(alpha) * conj(Bki) * Aki */
           {
-            REAL(C, i * lda + i) += 2 * (temp1_real * Bki_real - temp1_imag * Bki_imag);
-            IMAG(C, i * lda + i) = 0.0;
+            REAL(C, i * ldc + i) += 2 * (temp1_real * Bki_real - temp1_imag * Bki_imag);
+            IMAG(C, i * ldc + i) = 0.0;
           }
         }
       }
@@ -23,6 +23,9 @@
 
   CHECK_ARGS11(HERK,Order,Uplo,Trans,N,K,alpha,A,lda,beta,C,ldc);
 
+  if (gsl_cblas_l3_syrk(CBLAS_TYPE_C, 1, Order, Uplo, Trans, N, K, &alpha, A, lda, &beta, C, ldc))
+    return;
+
   if (beta == 1.0 && (alpha == 0.0 || K == 0))
     return;
 
@@ -81,6 +84,23 @@
   if (alpha == 0.0)
     return;
 
+  /* large updates go through the packed-panel engine in gemm_block_c.h,
+     restricted to the requested triangle. The engine does not make the
+     diagonal exactly real, so its imaginary part is reset afterwards. */
+  if (GEMM_USE_BLOCK(N, N, K)) {
+    const int TransF = (trans == CblasNoTrans) ? CblasNoTrans : CblasTrans;
+    const int TransG = (trans == CblasNoTrans) ? CblasTrans : CblasNoTrans;
+    const int conjF = (trans == CblasNoTrans) ? 1 : -1;
+
+    if (gemm_block(TransF, conjF, TransG, -conjF, uplo, N, N, K, alpha, 0.0,
+                   (const BASE *) A, lda, (const BASE *) A, lda, (BASE *) C, ldc) == 0) {
+      for (i = 0; i < N; i++) {
+        IMAG(C, ldc * i + i) = 0.0;
+      }
+      return;
+    }
+  }
+
   if (uplo == CblasUpper && trans == CblasNoTrans) {
 
     for (i = 0; i < N; i++) {
@@ -24,6 +24,9 @@
 
   CHECK_ARGS13(SYMM,Order,Side,Uplo,M,N,alpha,A,lda,B,ldb,beta,C,ldc);
 
+  if (gsl_cblas_l3_symm(CBLAS_TYPE_R, 0, Order, Side, Uplo, M, N, &alpha, A, lda, B, ldb, &beta, C, ldc))
+    return;
+
   if (alpha == 0.0 && beta == 1.0)
     return;
 
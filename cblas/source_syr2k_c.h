@@ -20,9 +20,13 @@
 {
   INDEX i, j, k;
   int uplo, trans;
+  BASE *Fp, *Gp;
 
   CHECK_ARGS13(SYR2K,Order,Uplo,Trans,N,K,alpha,A,lda,B,ldb,beta,C,ldc);
 
+  if (gsl_cblas_l3_syr2k(CBLAS_TYPE_C, 0, Order, Uplo, Trans, N, K, alpha, A, lda, B, ldb, beta, C, ldc))
+    return;
+
   {
     const BASE alpha_real = CONST_REAL0(alpha);
     const BASE alpha_imag = CONST_IMAG0(alpha);
@@ -85,6 +89,22 @@
     if (alpha_real == 0.0 && alpha_imag == 0.0)
       return;
 
+    /* large updates go through the packed-panel engine in
+       gemm_block_c.h, as the sum of two products restricted to the
+       requested triangle */
+    if (GEMM_USE_BLOCK(N, N, K) && gemm_block_alloc(N, N, K, &Fp, &Gp) == 0) {
+      const int transT = (trans == CblasNoTrans) ? CblasTrans : CblasNoTrans;
+
+      gemm_block_run(trans, 1, transT, 1, uplo, N, N, K, alpha_real, alpha_imag,
+                     (const BASE *) A, lda, (const BASE *) B, ldb, (BASE *) C, ldc, Fp, Gp);
+      gemm_block_run(trans, 1, transT, 1, uplo, N, N, K, alpha_real, alpha_imag,
+                     (const BASE *) B, ldb, (const BASE *) A, lda, (BASE *) C, ldc, Fp, Gp);
+
+      free(Fp);
+      free(Gp);
+      return;
+    }
+
     if (uplo == CblasUpper && trans == CblasNoTrans) {
 
       for (i = 0; i < N; i++) {
@@ -127,9 +147,9 @@
             BASE Akj_imag = CONST_IMAG(A, k * lda + j);
             BASE Bkj_real = CONST_REAL(B, k * ldb + j);
             BASE Bkj_imag = CONST_IMAG(B, k * ldb + j);
-            REAL(C, i * lda + j) += (temp1_real * Bkj_real - temp1_imag * Bkj_imag)
+            REAL(C, i * ldc + j) += (temp1_real * Bkj_real - temp1_imag * Bkj_imag)
               + (temp2_real * Akj_real - temp2_imag * Akj_imag);
-            IMAG(C, i * lda + j) += (temp1_real * Bkj_imag + temp1_imag * Bkj_real)
+            IMAG(C, i * ldc + j) += (temp1_real * Bkj_imag + temp1_imag * Bkj_real)
               + (temp2_real * Akj_imag + temp2_imag * Akj_real);
           }
         }
@@ -178,9 +198,9 @@
             BASE Akj_imag = CONST_IMAG(A, k * lda + j);
             BASE Bkj_real = CONST_REAL(B, k * ldb + j);
             BASE Bkj_imag = CONST_IMAG(B, k * ldb + j);
-            REAL(C, i * lda + j) += (temp1_real * Bkj_real - temp1_imag * Bkj_imag)
+            REAL(C, i * ldc + j) += (temp1_real * Bkj_real - temp1_imag * Bkj_imag)
               + (temp2_real * Akj_real - temp2_imag * Akj_imag);
-            IMAG(C, i * lda + j) += (temp1_real * Bkj_imag + temp1_imag * Bkj_real)
+            IMAG(C, i * ldc + j) += (temp1_real * Bkj_imag + temp1_imag * Bkj_real)
               + (temp2_real * Akj_imag + temp2_imag * Akj_real);
           }
         }
@@ -20,9 +20,13 @@
 {
   INDEX i, j, k;
   int uplo, trans;
+  BASE *Fp, *Gp;
 
   CHECK_ARGS13(SYR2K,Order,Uplo,Trans,N,K,alpha,A,lda,B,ldb,beta,C,ldc);
 
+  if (gsl_cblas_l3_syr2k(CBLAS_TYPE_R, 0, Order, Uplo, Trans, N, K, &alpha, A, lda, B, ldb, &beta, C, ldc))
+    return;
+
   if (alpha == 0.0 && beta == 1.0)
     return;
 
@@ -73,6 +77,19 @@
   if (alpha == 0.0)
     return;
 
+  /* large updates go through the packed-panel engine in gemm_block_r.h,
+     as the sum of two products restricted to the requested triangle */
+  if (GEMM_USE_BLOCK(N, N, K) && gemm_block_alloc(N, N, K, &Fp, &Gp) == 0) {
+    const int transT = (trans == CblasNoTrans) ? CblasTrans : CblasNoTrans;
+
+    gemm_block_run(trans, transT, uplo, N, N, K, alpha, A, lda, B, ldb, C, ldc, Fp, Gp);
+    gemm_block_run(trans, transT, uplo, N, N, K, alpha, B, ldb, A, lda, C, ldc, Fp, Gp);
+
+    free(Fp);
+    free(Gp);
+    return;
+  }
+
   if (uplo == CblasUpper && trans == CblasNoTrans) {
 
     for (i = 0; i < N; i++) {
@@ -93,7 +110,7 @@
         BASE temp1 = alpha * A[k * lda + i];
         BASE temp2 = alpha * B[k * ldb + i];
         for (j = i; j < N; j++) {
-          C[i * lda + j] += temp1 * B[k * ldb + j] + temp2 * A[k * lda + j];
+          C[i * ldc + j] += temp1 * B[k * ldb + j] + temp2 * A[k * lda + j];
         }
       }
     }
@@ -119,7 +136,7 @@
         BASE temp1 = alpha * A[k * lda + i];
         BASE temp2 = alpha * B[k * ldb + i];
         for (j = 0; j <= i; j++) {
-          C[i * lda + j] += temp1 * B[k * ldb + j] + temp2 * A[k * lda + j];
+          C[i * ldc + j] += temp1 * B[k * ldb + j] + temp2 * A[k * lda + j];
         }
       }
     }
@@ -23,6 +23,9 @@
 
   CHECK_ARGS11(SYRK,Order,Uplo,Trans,N,K,alpha,A,lda,beta,C,ldc);
 
+  if (gsl_cblas_l3_syrk(CBLAS_TYPE_C, 0, Order, Uplo, Trans, N, K, alpha, A, lda, beta, C, ldc))
+    return;
+
   {
     const BASE alpha_real = CONST_REAL0(alpha);
     const BASE alpha_imag = CONST_IMAG0(alpha);
@@ -85,6 +88,14 @@
     if (alpha_real == 0.0 && alpha_imag == 0.0)
       return;
 
+    /* large updates go through the packed-panel engine in
+       gemm_block_c.h, restricted to the requested triangle */
+    if (GEMM_USE_BLOCK(N, N, K)
+        && gemm_block(trans, 1, (trans == CblasNoTrans) ? CblasTrans : CblasNoTrans, 1,
+                      uplo, N, N, K, alpha_real, alpha_imag, (const BASE *) A, lda,
+                      (const BASE *) A, lda, (BASE *) C, ldc) == 0)
+      return;
+
     if (uplo == CblasUpper && trans == CblasNoTrans) {
 
       for (i = 0; i < N; i++) {
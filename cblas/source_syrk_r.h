@@ -23,6 +23,9 @@
 
   CHECK_ARGS11(SYRK,Order,Uplo,Trans,N,K,alpha,A,lda,beta,C,ldc);
 
+  if (gsl_cblas_l3_syrk(CBLAS_TYPE_R, 0, Order, Uplo, Trans, N, K, &alpha, A, lda, &beta, C, ldc))
+    return;
+
   if (alpha == 0.0 && beta == 1.0)
     return;
 
@@ -73,6 +76,13 @@
   if (alpha == 0.0)
     return;
 
+  /* large updates go through the packed-panel engine in gemm_block_r.h,
+     which only computes the tiles of C in the requested triangle */
+  if (GEMM_USE_BLOCK(N, N, K)
+      && gemm_block(trans, (trans == CblasNoTrans) ? CblasTrans : CblasNoTrans,
+                    uplo, N, N, K, alpha, A, lda, A, lda, C, ldc) == 0)
+    return;
+
   if (uplo == CblasUpper && trans == CblasNoTrans) {
 
     for (i = 0; i < N; i++) {
@@ -0,0 +1,47 @@
+/* cblas/source_trsm_batch_r.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+{
+  trsm_batch_args p;
+  const int na = (Side == CblasLeft) ? M : N;
+
+  CHECK_ARGS_X(TRSM_BATCH,pos,(pos,Order,Side,Uplo,TransA,Diag,M,N,alpha,A,lda,stridea,B,ldb,strideb,batch_size));
+
+  if (M == 0 || N == 0 || batch_size == 0)
+    return;
+
+  p.Order = Order;
+  p.Side = Side;
+  p.Uplo = Uplo;
+  p.TransA = TransA;
+  p.Diag = Diag;
+  p.M = M;
+  p.N = N;
+  p.alpha = alpha;
+  p.A = A;
+  p.lda = lda;
+  p.stridea = stridea;
+  p.B = B;
+  p.ldb = ldb;
+  p.strideb = strideb;
+  p.Ap = 0;
+  p.Bp = 0;
+
+  gsl_cblas_parallel_batch (batch_size, (double) na * M * N, trsm_batch_task, &p);
+}
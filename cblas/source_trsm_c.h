@@ -27,6 +27,9 @@
 
   CHECK_ARGS12(TRSM,Order,Side,Uplo,TransA,Diag,M,N,alpha,A,lda,B,ldb);
 
+  if (gsl_cblas_l3_trxm(CBLAS_TYPE_C, 1, Order, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb))
+    return;
+
   {
     const BASE alpha_real = CONST_REAL0(alpha);
     const BASE alpha_imag = CONST_IMAG0(alpha);
@@ -0,0 +1,57 @@
+/* cblas/source_trsm_group_r.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+{
+  trsm_group_args p;
+  double work = 0.0;
+  int g, total = 0;
+
+  {
+    int pos = 0;
+    CHECK_DIM(pos,13,group_count);
+    if (pos) cblas_xerbla(pos,__FILE__,"");
+  }
+
+  for (g = 0; g < group_count; g++) {
+    const int na = (Side_array[g] == CblasLeft) ? M_array[g] : N_array[g];
+    CHECK_ARGS_X(TRSM_GROUP,pos,(pos,Order,Side_array[g],Uplo_array[g],TransA_array[g],Diag_array[g],M_array[g],N_array[g],alpha_array[g],A_array,lda_array[g],B_array,ldb_array[g],group_count,group_size[g]));
+    total += group_size[g];
+    work += (double) na * M_array[g] * N_array[g] * group_size[g];
+  }
+
+  if (total == 0)
+    return;
+
+  p.Order = Order;
+  p.Side = Side_array;
+  p.Uplo = Uplo_array;
+  p.TransA = TransA_array;
+  p.Diag = Diag_array;
+  p.M = M_array;
+  p.N = N_array;
+  p.alpha = alpha_array;
+  p.A = A_array;
+  p.lda = lda_array;
+  p.B = B_array;
+  p.ldb = ldb_array;
+  p.group_count = group_count;
+  p.group_size = group_size;
+
+  gsl_cblas_parallel_batch (total, work / total, trsm_group_task, &p);
+}
@@ -26,6 +26,9 @@
 
   CHECK_ARGS12(TRSM,Order,Side,Uplo,TransA,Diag,M,N,alpha,A,lda,B,ldb);
 
+  if (gsl_cblas_l3_trxm(CBLAS_TYPE_R, 1, Order, Side, Uplo, TransA, Diag, M, N, &alpha, A, lda, B, ldb))
+    return;
+
   if (Order == CblasRowMajor) {
     n1 = M;
     n2 = N;
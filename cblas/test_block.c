@@ -0,0 +1,1288 @@
+/* cblas/test_block.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* The generated tests in test_*.c only use tiny vectors and matrices,
+ * which never reach the vectorized and blocked kernels. These tests
+ * compare those kernels against straightforward reference loops on
+ * operands large enough to cross the vector and block boundaries. */
+
+#include <stdlib.h>
+#include <string.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_cblas.h>
+
+#include "tests.h"
+
+static const enum CBLAS_ORDER block_orders[] = { CblasRowMajor, CblasColMajor };
+static const enum CBLAS_TRANSPOSE block_trans[] = { CblasNoTrans, CblasTrans, CblasConjTrans };
+
+static void
+block_random (double *x, const size_t n, unsigned long *seed)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      *seed = (*seed * 1103515245UL + 12345UL) & 0x7fffffffUL;
+      x[i] = 2.0 * ((double) *seed / 2147483648.0) - 1.0;
+    }
+}
+
+/* as block_random, with all 53 bits of the significand in use, so that
+   the rounding of a product is not exact */
+static void
+block_random_full (double *x, const size_t n, unsigned long *seed)
+{
+  size_t i;
+
+  block_random (x, n, seed);
+
+  for (i = 0; i < n; i++)
+    {
+      *seed = (*seed * 1103515245UL + 12345UL) & 0x7fffffffUL;
+      x[i] += ((double) *seed / 2147483648.0) * 0x1p-30;
+    }
+}
+
+/* index of element (i,j) of a matrix stored with the given order */
+static size_t
+block_idx (const enum CBLAS_ORDER order, const int lda, const int i, const int j)
+{
+  return (order == CblasRowMajor) ? (size_t) i * lda + j : (size_t) j * lda + i;
+}
+
+/* index of element (i,j) of op(A) */
+static size_t
+block_opidx (const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE trans,
+             const int lda, const int i, const int j)
+{
+  return (trans == CblasNoTrans) ? block_idx (order, lda, i, j) : block_idx (order, lda, j, i);
+}
+
+/* maximum of |x - y| / max(1,|y|) over n elements */
+static double
+block_maxerr (const double *x, const double *y, const size_t n)
+{
+  double err = 0.0;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      double e = fabs (x[i] - y[i]) / GSL_MAX (1.0, fabs (y[i]));
+      if (e > err)
+        err = e;
+    }
+
+  return err;
+}
+
+/* C := alpha op(A) op(B) + beta C, complex if cplx != 0 */
+static void
+block_ref_gemm (const int cplx, const enum CBLAS_ORDER order,
+                const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB,
+                const int M, const int N, const int K, const double *alpha,
+                const double *A, const int lda, const double *B, const int ldb,
+                const double *beta, double *C, const int ldc)
+{
+  const double sa = (transA == CblasConjTrans) ? -1.0 : 1.0;
+  const double sb = (transB == CblasConjTrans) ? -1.0 : 1.0;
+  int i, j, k;
+
+  for (i = 0; i < M; i++)
+    {
+      for (j = 0; j < N; j++)
+        {
+          const size_t c = block_idx (order, ldc, i, j);
+          double s_real = 0.0, s_imag = 0.0;
+
+          for (k = 0; k < K; k++)
+            {
+              const size_t a = block_opidx (order, transA, lda, i, k);
+              const size_t b = block_opidx (order, transB, ldb, k, j);
+
+              if (cplx)
+                {
+                  const double ar = A[2 * a], ai = sa * A[2 * a + 1];
+                  const double br = B[2 * b], bi = sb * B[2 * b + 1];
+                  s_real += ar * br - ai * bi;
+                  s_imag += ar * bi + ai * br;
+                }
+              else
+                {
+                  s_real += A[a] * B[b];
+                }
+            }
+
+          if (cplx)
+            {
+              const double cr = C[2 * c], ci = C[2 * c + 1];
+              C[2 * c] = alpha[0] * s_real - alpha[1] * s_imag + beta[0] * cr - beta[1] * ci;
+              C[2 * c + 1] = alpha[0] * s_imag + alpha[1] * s_real + beta[0] * ci + beta[1] * cr;
+            }
+          else
+            {
+              C[c] = alpha[0] * s_real + beta[0] * C[c];
+            }
+        }
+    }
+}
+
+static void
+test_gemm_block_dims (const int M, const int N, const int K, unsigned long *seed)
+{
+  const double alpha[2] = { 0.75, -0.5 };
+  const double beta[2] = { -1.25, 0.25 };
+  const size_t nmax = 2 * (size_t) GSL_MAX (M, GSL_MAX (N, K)) * GSL_MAX (M, GSL_MAX (N, K));
+  double *A = malloc (nmax * sizeof (double));
+  double *B = malloc (nmax * sizeof (double));
+  double *C = malloc (nmax * sizeof (double));
+  double *Cref = malloc (nmax * sizeof (double));
+  double *Cd = malloc (nmax * sizeof (double));
+  float *Af = malloc (nmax * sizeof (float));
+  float *Bf = malloc (nmax * sizeof (float));
+  float *Cf = malloc (nmax * sizeof (float));
+  size_t io, ia, ib, i;
+
+  for (io = 0; io < 2; io++)
+    {
+      const enum CBLAS_ORDER order = block_orders[io];
+      const int ldc = (order == CblasRowMajor) ? N : M;
+
+      for (ia = 0; ia < 3; ia++)
+        {
+          for (ib = 0; ib < 3; ib++)
+            {
+              const enum CBLAS_TRANSPOSE transA = block_trans[ia];
+              const enum CBLAS_TRANSPOSE transB = block_trans[ib];
+              const int rowsA = (transA == CblasNoTrans) ? M : K;
+              const int colsA = (transA == CblasNoTrans) ? K : M;
+              const int rowsB = (transB == CblasNoTrans) ? K : N;
+              const int colsB = (transB == CblasNoTrans) ? N : K;
+              const int lda = (order == CblasRowMajor) ? colsA : rowsA;
+              const int ldb = (order == CblasRowMajor) ? colsB : rowsB;
+              const size_t nC = (size_t) M * N;
+
+              block_random (A, 2 * (size_t) rowsA * colsA, seed);
+              block_random (B, 2 * (size_t) rowsB * colsB, seed);
+              block_random (C, 2 * nC, seed);
+
+              /* real */
+
+              for (i = 0; i < nC; i++)
+                Cref[i] = Cd[i] = C[i];
+
+              block_ref_gemm (0, order, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, Cref, ldc);
+              cblas_dgemm (order, transA, transB, M, N, K, alpha[0], A, lda, B, ldb, beta[0], Cd, ldc);
+              gsl_test (block_maxerr (Cd, Cref, nC) > 1e-12,
+                        "dgemm block M=%d N=%d K=%d order=%d transA=%d transB=%d",
+                        M, N, K, order, transA, transB);
+
+              for (i = 0; i < (size_t) rowsA * colsA; i++)
+                Af[i] = (float) A[i];
+              for (i = 0; i < (size_t) rowsB * colsB; i++)
+                Bf[i] = (float) B[i];
+              for (i = 0; i < nC; i++)
+                Cf[i] = (float) C[i];
+
+              cblas_sgemm (order, transA, transB, M, N, K, (float) alpha[0], Af, lda, Bf, ldb, (float) beta[0], Cf, ldc);
+              for (i = 0; i < nC; i++)
+                Cd[i] = Cf[i];
+              gsl_test (block_maxerr (Cd, Cref, nC) > 1e-3,
+                        "sgemm block M=%d N=%d K=%d order=%d transA=%d transB=%d",
+                        M, N, K, order, transA, transB);
+
+              /* complex */
+
+              for (i = 0; i < 2 * nC; i++)
+                Cref[i] = Cd[i] = C[i];
+
+              block_ref_gemm (1, order, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, Cref, ldc);
+              cblas_zgemm (order, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, Cd, ldc);
+              gsl_test (block_maxerr (Cd, Cref, 2 * nC) > 1e-12,
+                        "zgemm block M=%d N=%d K=%d order=%d transA=%d transB=%d",
+                        M, N, K, order, transA, transB);
+
+              {
+                const float alphaf[2] = { (float) alpha[0], (float) alpha[1] };
+                const float betaf[2] = { (float) beta[0], (float) beta[1] };
+
+                for (i = 0; i < 2 * (size_t) rowsA * colsA; i++)
+                  Af[i] = (float) A[i];
+                for (i = 0; i < 2 * (size_t) rowsB * colsB; i++)
+                  Bf[i] = (float) B[i];
+                for (i = 0; i < 2 * nC; i++)
+                  Cf[i] = (float) C[i];
+
+                cblas_cgemm (order, transA, transB, M, N, K, alphaf, Af, lda, Bf, ldb, betaf, Cf, ldc);
+              }
+
+              for (i = 0; i < 2 * nC; i++)
+                Cd[i] = Cf[i];
+              gsl_test (block_maxerr (Cd, Cref, 2 * nC) > 1e-3,
+                        "cgemm block M=%d N=%d K=%d order=%d transA=%d transB=%d",
+                        M, N, K, order, transA, transB);
+            }
+        }
+    }
+
+  free (A);
+  free (B);
+  free (C);
+  free (Cref);
+  free (Cd);
+  free (Af);
+  free (Bf);
+  free (Cf);
+}
+
+void
+test_gemm_block (void)
+{
+  unsigned long seed = 1;
+
+  test_gemm_block_dims (37, 41, 29, &seed);
+  test_gemm_block_dims (150, 70, 300, &seed);
+  test_gemm_block_dims (5, 257, 133, &seed);
+  test_gemm_block_dims (300, 270, 40, &seed);
+}
+
+/* Compare syrk, herk, syr2k and her2k with full reference products.
+ * The leading dimensions are padded so that writes outside the
+ * requested triangle (or outside the matrix) are detected. */
+
+static void
+test_syrk_block_dims (const int N, const int K, unsigned long *seed)
+{
+  const double alpha[2] = { 0.75, -0.5 };
+  const double beta[2] = { -1.25, 0.25 };
+  const double one[2] = { 1.0, 0.0 };
+  const int ld = GSL_MAX (N, K) + 3;
+  const int ldc = N + 2;
+  const size_t nA = 2 * (size_t) ld * ld;
+  const size_t nC = 2 * (size_t) ldc * N;
+  double *A = malloc (nA * sizeof (double));
+  double *B = malloc (nA * sizeof (double));
+  double *C = malloc (nC * sizeof (double));
+  double *F = malloc (nC * sizeof (double));
+  double *R = malloc (nC * sizeof (double));
+  double *X = malloc (nC * sizeof (double));
+  size_t io, i;
+  int cplx, herm, uplo, trans, j;
+
+  block_random (A, nA, seed);
+  block_random (B, nA, seed);
+  block_random (C, nC, seed);
+
+  for (io = 0; io < 2; io++)
+    {
+      const enum CBLAS_ORDER order = block_orders[io];
+
+      for (cplx = 0; cplx <= 1; cplx++)
+        for (herm = 0; herm <= cplx; herm++)
+          for (uplo = CblasUpper; uplo <= CblasLower; uplo++)
+            for (trans = CblasNoTrans; trans <= CblasConjTrans; trans++)
+              {
+                const int w = cplx ? 2 : 1;
+                const enum CBLAS_TRANSPOSE Tb =
+                  (trans != CblasNoTrans) ? CblasNoTrans : herm ? CblasConjTrans : CblasTrans;
+                const double a1[2] = { alpha[0], herm ? 0.0 : alpha[1] };
+                const double b1[2] = { beta[0], herm ? 0.0 : beta[1] };
+                const double a2[2] = { alpha[0], herm ? -alpha[1] : alpha[1] };
+                const char *name;
+                int pass;
+
+                if (cplx && (trans == (herm ? CblasTrans : CblasConjTrans)))
+                  continue;
+
+                for (pass = 0; pass < 2; pass++)
+                  {
+                    /* reference: full product, then keep the triangle */
+
+                    memcpy (F, C, w * nC / 2 * sizeof (double));
+                    if (pass == 0)
+                      {
+                        block_ref_gemm (cplx, order, trans, Tb, N, N, K, a1, A, ld, A, ld, b1, F, ldc);
+                      }
+                    else
+                      {
+                        block_ref_gemm (cplx, order, trans, Tb, N, N, K, alpha, A, ld, B, ld, b1, F, ldc);
+                        block_ref_gemm (cplx, order, trans, Tb, N, N, K, a2, B, ld, A, ld, one, F, ldc);
+                      }
+
+                    memcpy (R, C, w * nC / 2 * sizeof (double));
+                    for (i = 0; i < (size_t) N; i++)
+                      for (j = 0; j < N; j++)
+                        if ((uplo == CblasUpper) ? (j >= (int) i) : (j <= (int) i))
+                          {
+                            const size_t c = block_idx (order, ldc, i, j);
+                            R[w * c] = F[w * c];
+                            if (cplx)
+                              R[w * c + 1] = (herm && (int) i == j) ? 0.0 : F[w * c + 1];
+                          }
+
+                    memcpy (X, C, w * nC / 2 * sizeof (double));
+
+                    if (pass == 0)
+                      {
+                        if (!cplx)
+                          cblas_dsyrk (order, uplo, trans, N, K, alpha[0], A, ld, beta[0], X, ldc);
+                        else if (herm)
+                          cblas_zherk (order, uplo, trans, N, K, alpha[0], A, ld, beta[0], X, ldc);
+                        else
+                          cblas_zsyrk (order, uplo, trans, N, K, alpha, A, ld, beta, X, ldc);
+
+                        name = !cplx ? "dsyrk" : herm ? "zherk" : "zsyrk";
+                      }
+                    else
+                      {
+                        if (!cplx)
+                          cblas_dsyr2k (order, uplo, trans, N, K, alpha[0], A, ld, B, ld, beta[0], X, ldc);
+                        else if (herm)
+                          cblas_zher2k (order, uplo, trans, N, K, alpha, A, ld, B, ld, beta[0], X, ldc);
+                        else
+                          cblas_zsyr2k (order, uplo, trans, N, K, alpha, A, ld, B, ld, beta, X, ldc);
+
+                        name = !cplx ? "dsyr2k" : herm ? "zher2k" : "zsyr2k";
+                      }
+
+                    gsl_test (block_maxerr (X, R, w * nC / 2) > 1e-12,
+                              "%s block N=%d K=%d order=%d uplo=%d trans=%d",
+                              name, N, K, order, uplo, trans);
+                  }
+              }
+    }
+
+  free (A);
+  free (B);
+  free (C);
+  free (F);
+  free (R);
+  free (X);
+}
+
+void
+test_syrk_block (void)
+{
+  unsigned long seed = 4;
+
+  test_syrk_block_dims (9, 5, &seed);
+  test_syrk_block_dims (37, 29, &seed);
+  test_syrk_block_dims (130, 70, &seed);
+  test_syrk_block_dims (203, 300, &seed);
+}
+
+static void
+test_l1_kernels_dims (const int N, unsigned long *seed)
+{
+  double *X = malloc (N * sizeof (double));
+  double *Y = malloc (N * sizeof (double));
+  double *Z = malloc (N * sizeof (double));
+  const double alpha = 1.0 / 3.0;
+  double dot = 0.0, asum = 0.0, scale = 0.0, ssq = 1.0, amax = 0.0;
+  int i, imax = 0;
+
+  block_random_full (X, N, seed);
+  block_random_full (Y, N, seed);
+
+  /* plant a repeated maximum to check that the first index is returned */
+  X[N / 3] = 2.0;
+  X[N / 2] = -2.0;
+
+  for (i = 0; i < N; i++)
+    {
+      const double ax = fabs (X[i]);
+
+      dot += X[i] * Y[i];
+      asum += ax;
+
+      if (ax > amax)
+        {
+          amax = ax;
+          imax = i;
+        }
+
+      if (scale < ax)
+        {
+          ssq = 1.0 + ssq * (scale / ax) * (scale / ax);
+          scale = ax;
+        }
+      else
+        {
+          ssq += (ax / scale) * (ax / scale);
+        }
+
+      /* rounded product, as in the reference loop without FMA */
+      {
+        volatile double ax_alpha = alpha * X[i];
+        Z[i] = Y[i] + ax_alpha;
+      }
+    }
+
+  gsl_test_rel (cblas_ddot (N, X, 1, Y, 1), dot, 1e-12, "ddot kernel N=%d", N);
+  gsl_test_rel (cblas_dasum (N, X, 1), asum, 1e-12, "dasum kernel N=%d", N);
+  gsl_test_rel (cblas_dnrm2 (N, X, 1), scale * sqrt (ssq), 1e-12, "dnrm2 kernel N=%d", N);
+  gsl_test_int ((int) cblas_idamax (N, X, 1), imax, "idamax kernel N=%d", N);
+
+  cblas_daxpy (N, alpha, X, 1, Y, 1);
+  gsl_test (memcmp (Y, Z, N * sizeof (double)) != 0, "daxpy kernel N=%d bitwise", N);
+
+  /* dnrm2 must not overflow or underflow */
+  for (i = 0; i < N; i++)
+    Y[i] = X[i] * 1.0e300;
+  gsl_test_rel (cblas_dnrm2 (N, Y, 1), 1.0e300 * scale * sqrt (ssq), 1e-12, "dnrm2 kernel N=%d large", N);
+
+  for (i = 0; i < N; i++)
+    Y[i] = X[i] * 1.0e-300;
+  gsl_test_rel (cblas_dnrm2 (N, Y, 1), 1.0e-300 * scale * sqrt (ssq), 1e-12, "dnrm2 kernel N=%d small", N);
+
+  free (X);
+  free (Y);
+  free (Z);
+}
+
+void
+test_l1_kernels (void)
+{
+  unsigned long seed = 2;
+  int N;
+
+  for (N = 16; N < 80; N += 7)
+    test_l1_kernels_dims (N, &seed);
+
+  test_l1_kernels_dims (10007, &seed);
+}
+
+/* position of element k of a vector of length n with increment inc */
+static size_t
+block_vidx (const int n, const int inc, const int k)
+{
+  return (inc > 0) ? (size_t) k * inc : (size_t) (n - 1 - k) * (-inc);
+}
+
+static void
+test_gemv_block_dims (const int M, const int N, unsigned long *seed)
+{
+  static const int incs[][2] = { { 1, 1 }, { -2, 1 }, { 1, 3 }, { 2, -1 } };
+  const double alpha = 0.75, beta = -1.25;
+  const int nmax = GSL_MAX (M, N);
+  const int lda = nmax + 3;
+  const size_t nA = (size_t) lda * nmax;
+  const size_t nV = 3 * (size_t) nmax;
+  double *A = malloc (nA * sizeof (double));
+  double *R = malloc (nA * sizeof (double));
+  double *X = malloc (nV * sizeof (double));
+  double *Y = malloc (nV * sizeof (double));
+  double *Z = malloc (nV * sizeof (double));
+  double *G = malloc (nA * sizeof (double));
+  float *Af = malloc (nA * sizeof (float));
+  float *Xf = malloc (nV * sizeof (float));
+  float *Yf = malloc (nV * sizeof (float));
+  float *Gf = malloc (nA * sizeof (float));
+  size_t io, ii, k;
+  int trans, i, j;
+
+  block_random (A, nA, seed);
+  block_random (X, nV, seed);
+  block_random (Y, nV, seed);
+
+  /* zeros in x exercise the skipped rows of the transposed product */
+  for (k = 0; k < nV; k += 5)
+    X[k] = 0.0;
+
+  /* the single precision operands are exact copies, so that the same
+     reference serves both */
+  for (k = 0; k < nA; k++)
+    A[k] = Af[k] = (float) A[k];
+  for (k = 0; k < nV; k++)
+    {
+      X[k] = Xf[k] = (float) X[k];
+      Y[k] = (float) Y[k];
+    }
+
+  for (io = 0; io < 2; io++)
+    {
+      const enum CBLAS_ORDER order = block_orders[io];
+
+      for (ii = 0; ii < sizeof (incs) / sizeof (incs[0]); ii++)
+        {
+          const int incX = incs[ii][0], incY = incs[ii][1];
+
+          for (trans = CblasNoTrans; trans <= CblasTrans; trans++)
+            {
+              const int lenX = (trans == CblasNoTrans) ? N : M;
+              const int lenY = (trans == CblasNoTrans) ? M : N;
+
+              memcpy (Z, Y, nV * sizeof (double));
+              for (i = 0; i < lenY; i++)
+                {
+                  double s = 0.0;
+                  for (j = 0; j < lenX; j++)
+                    s += A[block_opidx (order, trans, lda, i, j)] * X[block_vidx (lenX, incX, j)];
+                  Z[block_vidx (lenY, incY, i)] = alpha * s + beta * Y[block_vidx (lenY, incY, i)];
+                }
+
+              memcpy (R, Y, nV * sizeof (double));
+              cblas_dgemv (order, trans, M, N, alpha, A, lda, X, incX, beta, R, incY);
+              gsl_test (block_maxerr (R, Z, nV) > 1e-12,
+                        "dgemv blocked M=%d N=%d order=%d trans=%d incX=%d incY=%d",
+                        M, N, order, trans, incX, incY);
+
+              for (k = 0; k < nV; k++)
+                Yf[k] = (float) Y[k];
+              cblas_sgemv (order, trans, M, N, (float) alpha, Af, lda, Xf, incX,
+                           (float) beta, Yf, incY);
+              for (k = 0; k < nV; k++)
+                R[k] = Yf[k];
+              gsl_test (block_maxerr (R, Z, nV) > 1e-4,
+                        "sgemv blocked M=%d N=%d order=%d trans=%d incX=%d incY=%d",
+                        M, N, order, trans, incX, incY);
+            }
+
+          /* A := alpha x y' + A, bitwise identical to the reference loop */
+          memcpy (R, A, nA * sizeof (double));
+          for (i = 0; i < M; i++)
+            {
+              const double tmp = alpha * X[block_vidx (M, incX, i)];
+              for (j = 0; j < N; j++)
+                R[block_idx (order, lda, i, j)] += Y[block_vidx (N, incY, j)] * tmp;
+            }
+
+          memcpy (G, A, nA * sizeof (double));
+          cblas_dger (order, M, N, alpha, X, incX, Y, incY, G, lda);
+          gsl_test (memcmp (G, R, nA * sizeof (double)) != 0,
+                    "dger blocked M=%d N=%d order=%d incX=%d incY=%d bitwise",
+                    M, N, order, incX, incY);
+
+          memcpy (Gf, Af, nA * sizeof (float));
+          for (k = 0; k < nV; k++)
+            Yf[k] = (float) Y[k];
+          cblas_sger (order, M, N, (float) alpha, Xf, incX, Yf, incY, Gf, lda);
+          for (k = 0; k < nA; k++)
+            G[k] = Gf[k];
+          gsl_test (block_maxerr (G, R, nA) > 1e-6,
+                    "sger blocked M=%d N=%d order=%d incX=%d incY=%d",
+                    M, N, order, incX, incY);
+        }
+    }
+
+  free (A);
+  free (R);
+  free (X);
+  free (Y);
+  free (Z);
+  free (G);
+  free (Af);
+  free (Xf);
+  free (Yf);
+  free (Gf);
+}
+
+void
+test_gemv_block (void)
+{
+  unsigned long seed = 6;
+
+  test_gemv_block_dims (7, 5, &seed);
+  test_gemv_block_dims (70, 33, &seed);
+  test_gemv_block_dims (131, 1030, &seed);
+  test_gemv_block_dims (2100, 67, &seed);
+}
+
+/* expand the triangle uplo of the n-by-n matrix A into a full matrix F
+ * (same order, leading dimension n). kind is 0 for symmetric, 1 for
+ * hermitian, 2 for triangular and 3 for unit triangular */
+static void
+l3_expand (const int cplx, const enum CBLAS_ORDER order, const enum CBLAS_UPLO uplo,
+           const int kind, const int n, const double *A, const int lda, double *F)
+{
+  const int w = cplx ? 2 : 1;
+  int i, j;
+
+  for (i = 0; i < n; i++)
+    {
+      for (j = 0; j < n; j++)
+        {
+          const int stored = (uplo == CblasUpper) ? (j >= i) : (j <= i);
+          const size_t f = block_idx (order, n, i, j);
+          double re = 0.0, im = 0.0;
+
+          if (stored)
+            {
+              const size_t a = block_idx (order, lda, i, j);
+              re = A[w * a];
+              im = cplx ? A[w * a + 1] : 0.0;
+            }
+          else if (kind < 2)
+            {
+              const size_t a = block_idx (order, lda, j, i);
+              re = A[w * a];
+              im = cplx ? ((kind == 1) ? -A[w * a + 1] : A[w * a + 1]) : 0.0;
+            }
+
+          if (i == j && kind == 1)
+            im = 0.0;
+
+          if (i == j && kind == 3)
+            {
+              re = 1.0;
+              im = 0.0;
+            }
+
+          F[w * f] = re;
+          if (cplx)
+            F[w * f + 1] = im;
+        }
+    }
+}
+
+static void
+l3_gemm (const int cplx, const enum CBLAS_ORDER order,
+         const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB,
+         const int M, const int N, const int K, const double *alpha,
+         const double *A, const int lda, const double *B, const int ldb,
+         const double *beta, double *C, const int ldc)
+{
+  if (cplx)
+    cblas_zgemm (order, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+  else
+    cblas_dgemm (order, transA, transB, M, N, K, alpha[0], A, lda, B, ldb, beta[0], C, ldc);
+}
+
+/* run the operation op with 1 and with 3 threads, check that the
+ * results are identical and compare them with the reference */
+#define L3_CHECK(op, X, Xref, nX, desc)                                        \
+  do {                                                                       \
+    memcpy (X1, X, (nX) * sizeof (double));                                  \
+    gsl_cblas_set_num_threads (1);                                           \
+    op (X1);                                                                 \
+    gsl_cblas_set_num_threads (3);                                           \
+    op (X);                                                                  \
+    gsl_test (memcmp (X, X1, (nX) * sizeof (double)) != 0,                   \
+              "%s threads reproducible", desc);                              \
+    gsl_test (block_maxerr (X, Xref, (nX)) > 1e-10, "%s threads", desc);     \
+  } while (0)
+
+static void
+test_l3_threads_type (const int cplx, unsigned long *seed)
+{
+  const int w = cplx ? 2 : 1;
+  const int n1 = 150, n2 = 300, n3 = 520, k = 40;
+  const double alpha[2] = { 0.5, 0.25 };
+  const double beta[2] = { -0.75, 0.125 };
+  const double one[2] = { 1.0, 0.0 };
+  const double zero[2] = { 0.0, 0.0 };
+  const size_t nmax = 2 * (size_t) n3 * n3;
+  double *A = malloc (nmax * sizeof (double));
+  double *B = malloc (nmax * sizeof (double));
+  double *C = malloc (nmax * sizeof (double));
+  double *X1 = malloc (nmax * sizeof (double));
+  double *F = malloc (nmax * sizeof (double));
+  double *R = malloc (nmax * sizeof (double));
+  char desc[128];
+  size_t io, i;
+  int side, uplo, trans, diag;
+
+  for (io = 0; io < 2; io++)
+    {
+      const enum CBLAS_ORDER order = block_orders[io];
+
+      for (uplo = CblasUpper; uplo <= CblasLower; uplo++)
+        {
+          /* symm, hemm */
+
+          for (side = CblasLeft; side <= CblasRight; side++)
+            {
+              const int herm = cplx && side == CblasLeft;
+              const int M = (side == CblasLeft) ? n1 : n2;
+              const int N = (side == CblasLeft) ? n2 : n1;
+              const int na = (side == CblasLeft) ? M : N;
+              const int ldc = (order == CblasRowMajor) ? N : M;
+
+              block_random (A, w * (size_t) na * na, seed);
+              block_random (B, w * (size_t) M * N, seed);
+              block_random (C, w * (size_t) M * N, seed);
+
+              l3_expand (cplx, order, uplo, herm, na, A, na, F);
+              memcpy (R, C, w * (size_t) M * N * sizeof (double));
+              if (side == CblasLeft)
+                l3_gemm (cplx, order, CblasNoTrans, CblasNoTrans, M, N, M, alpha, F, na, B, ldc, beta, R, ldc);
+              else
+                l3_gemm (cplx, order, CblasNoTrans, CblasNoTrans, M, N, N, alpha, B, ldc, F, na, beta, R, ldc);
+
+#define SYMM(X) do {                                                            \
+  if (!cplx)                                                                    \
+    cblas_dsymm (order, side, uplo, M, N, alpha[0], A, na, B, ldc, beta[0], X, ldc); \
+  else if (herm)                                                                \
+    cblas_zhemm (order, side, uplo, M, N, alpha, A, na, B, ldc, beta, X, ldc);  \
+  else                                                                          \
+    cblas_zsymm (order, side, uplo, M, N, alpha, A, na, B, ldc, beta, X, ldc);  \
+} while (0)
+
+              sprintf (desc, "%s order=%d side=%d uplo=%d", cplx ? (herm ? "zhemm" : "zsymm") : "dsymm",
+                       order, side, uplo);
+              L3_CHECK (SYMM, C, R, w * (size_t) M * N, desc);
+#undef SYMM
+            }
+
+          /* syrk, herk, syr2k, her2k */
+
+          for (trans = CblasNoTrans; trans <= CblasConjTrans; trans++)
+            {
+              const int N = n3;
+              const int rows = (trans == CblasNoTrans) ? N : k;
+              const int cols = (trans == CblasNoTrans) ? k : N;
+              const int lda = (order == CblasRowMajor) ? cols : rows;
+              const enum CBLAS_TRANSPOSE T = (trans == CblasNoTrans) ? CblasTrans : CblasNoTrans;
+              const int herm = cplx && trans != CblasTrans;
+              const enum CBLAS_TRANSPOSE Th = (trans == CblasNoTrans) ? CblasConjTrans : CblasNoTrans;
+              const enum CBLAS_TRANSPOSE Ta = (trans == CblasNoTrans) ? CblasNoTrans : trans;
+              const double herm_alpha[2] = { alpha[0], 0.0 };
+              const double herm_beta[2] = { beta[0], 0.0 };
+              const double *a1 = herm ? herm_alpha : alpha;
+              const double *b1 = herm ? herm_beta : beta;
+              double alpha2[2];
+              int j;
+
+              if (!cplx && trans == CblasConjTrans)
+                continue;
+
+              block_random (A, w * (size_t) N * k, seed);
+              block_random (B, w * (size_t) N * k, seed);
+              block_random (C, w * (size_t) N * N, seed);
+
+              if (herm)
+                {
+                  for (i = 0; i < (size_t) N; i++)
+                    C[2 * (i * N + i) + 1] = 0.0;
+                }
+
+              /* reference: full products, then keep the triangle */
+
+              memcpy (F, C, w * (size_t) N * N * sizeof (double));
+              l3_gemm (cplx, order, Ta, herm ? Th : T, N, N, k, a1, A, lda, A, lda, b1, F, N);
+              memcpy (R, C, w * (size_t) N * N * sizeof (double));
+              for (i = 0; i < (size_t) N; i++)
+                for (j = 0; j < N; j++)
+                  if ((uplo == CblasUpper) ? (j >= (int) i) : (j <= (int) i))
+                    {
+                      const size_t c = block_idx (order, N, i, j);
+                      R[w * c] = F[w * c];
+                      if (cplx)
+                        R[w * c + 1] = (herm && (int) i == j) ? 0.0 : F[w * c + 1];
+                    }
+
+#define SYRK(X) do {                                                              \
+  if (!cplx)                                                                      \
+    cblas_dsyrk (order, uplo, trans, N, k, alpha[0], A, lda, beta[0], X, N);      \
+  else if (herm)                                                                  \
+    cblas_zherk (order, uplo, trans, N, k, alpha[0], A, lda, beta[0], X, N);      \
+  else                                                                            \
+    cblas_zsyrk (order, uplo, trans, N, k, alpha, A, lda, beta, X, N);            \
+} while (0)
+
+              sprintf (desc, "%s order=%d uplo=%d trans=%d", cplx ? (herm ? "zherk" : "zsyrk") : "dsyrk",
+                       order, uplo, trans);
+              memcpy (F, C, w * (size_t) N * N * sizeof (double));
+              L3_CHECK (SYRK, F, R, w * (size_t) N * N, desc);
+#undef SYRK
+
+              alpha2[0] = alpha[0];
+              alpha2[1] = herm ? -alpha[1] : alpha[1];
+              memcpy (F, C, w * (size_t) N * N * sizeof (double));
+              l3_gemm (cplx, order, Ta, herm ? Th : T, N, N, k, alpha, A, lda, B, lda, b1, F, N);
+              l3_gemm (cplx, order, Ta, herm ? Th : T, N, N, k, alpha2, B, lda, A, lda, one, F, N);
+              memcpy (R, C, w * (size_t) N * N * sizeof (double));
+              for (i = 0; i < (size_t) N; i++)
+                for (j = 0; j < N; j++)
+                  if ((uplo == CblasUpper) ? (j >= (int) i) : (j <= (int) i))
+                    {
+                      const size_t c = block_idx (order, N, i, j);
+                      R[w * c] = F[w * c];
+                      if (cplx)
+                        R[w * c + 1] = (herm && (int) i == j) ? 0.0 : F[w * c + 1];
+                    }
+
+#define SYR2K(X) do {                                                                 \
+  if (!cplx)                                                                          \
+    cblas_dsyr2k (order, uplo, trans, N, k, alpha[0], A, lda, B, lda, beta[0], X, N); \
+  else if (herm)                                                                      \
+    cblas_zher2k (order, uplo, trans, N, k, alpha, A, lda, B, lda, beta[0], X, N);    \
+  else                                                                                \
+    cblas_zsyr2k (order, uplo, trans, N, k, alpha, A, lda, B, lda, beta, X, N);       \
+} while (0)
+
+              sprintf (desc, "%s order=%d uplo=%d trans=%d", cplx ? (herm ? "zher2k" : "zsyr2k") : "dsyr2k",
+                       order, uplo, trans);
+              memcpy (F, C, w * (size_t) N * N * sizeof (double));
+              L3_CHECK (SYR2K, F, R, w * (size_t) N * N, desc);
+#undef SYR2K
+            }
+
+          /* trmm, trsm */
+
+          for (side = CblasLeft; side <= CblasRight; side++)
+            {
+              for (trans = CblasNoTrans; trans <= CblasConjTrans; trans++)
+                {
+                  for (diag = CblasNonUnit; diag <= CblasUnit; diag++)
+                    {
+                      const int M = (side == CblasLeft) ? n1 : n2;
+                      const int N = (side == CblasLeft) ? n2 : n1;
+                      const int na = (side == CblasLeft) ? M : N;
+                      const int ldb = (order == CblasRowMajor) ? N : M;
+
+                      if (!cplx && trans == CblasConjTrans)
+                        continue;
+
+                      block_random (A, w * (size_t) na * na, seed);
+                      block_random (B, w * (size_t) M * N, seed);
+
+                      /* keep the triangular matrix well conditioned */
+                      for (i = 0; i < w * (size_t) na * na; i++)
+                        A[i] /= na;
+                      for (i = 0; i < (size_t) na; i++)
+                        A[w * (i * na + i)] += 1.0;
+
+                      l3_expand (cplx, order, uplo, diag == CblasUnit ? 3 : 2, na, A, na, F);
+                      memcpy (R, B, w * (size_t) M * N * sizeof (double));
+                      if (side == CblasLeft)
+                        l3_gemm (cplx, order, trans, CblasNoTrans, M, N, M, alpha, F, na, B, ldb, zero, R, ldb);
+                      else
+                        l3_gemm (cplx, order, CblasNoTrans, trans, M, N, N, alpha, B, ldb, F, na, zero, R, ldb);
+
+#define TRMM(X) do {                                                                        \
+  if (cplx)                                                                                 \
+    cblas_ztrmm (order, side, uplo, trans, diag, M, N, alpha, A, na, X, ldb);               \
+  else                                                                                      \
+    cblas_dtrmm (order, side, uplo, trans, diag, M, N, alpha[0], A, na, X, ldb);            \
+} while (0)
+#define TRSM(X) do {                                                                        \
+  if (cplx)                                                                                 \
+    cblas_ztrsm (order, side, uplo, trans, diag, M, N, alpha, A, na, X, ldb);               \
+  else                                                                                      \
+    cblas_dtrsm (order, side, uplo, trans, diag, M, N, alpha[0], A, na, X, ldb);            \
+} while (0)
+
+                      sprintf (desc, "%ctrmm order=%d side=%d uplo=%d trans=%d diag=%d", cplx ? 'z' : 'd',
+                               order, side, uplo, trans, diag);
+                      memcpy (C, B, w * (size_t) M * N * sizeof (double));
+                      L3_CHECK (TRMM, C, R, w * (size_t) M * N, desc);
+
+                      /* solving with the product must give back B */
+                      sprintf (desc, "%ctrsm order=%d side=%d uplo=%d trans=%d diag=%d", cplx ? 'z' : 'd',
+                               order, side, uplo, trans, diag);
+                      memcpy (C, R, w * (size_t) M * N * sizeof (double));
+                      memcpy (R, B, w * (size_t) M * N * sizeof (double));
+                      /* op(A) X = alpha C / alpha^2 = op(A) B */
+                      for (i = 0; i < (size_t) M * N; i++)
+                        {
+                          if (cplx)
+                            {
+                              const double d = alpha[0] * alpha[0] + alpha[1] * alpha[1];
+                              int pass;
+
+                              for (pass = 0; pass < 2; pass++)
+                                {
+                                  const double re = C[2 * i], im = C[2 * i + 1];
+                                  C[2 * i] = (re * alpha[0] + im * alpha[1]) / d;
+                                  C[2 * i + 1] = (im * alpha[0] - re * alpha[1]) / d;
+                                }
+                            }
+                          else
+                            {
+                              C[i] /= alpha[0] * alpha[0];
+                            }
+                        }
+                      L3_CHECK (TRSM, C, R, w * (size_t) M * N, desc);
+#undef TRMM
+#undef TRSM
+                    }
+                }
+            }
+        }
+    }
+
+  gsl_cblas_set_num_threads (1);
+
+  free (A);
+  free (B);
+  free (C);
+  free (X1);
+  free (F);
+  free (R);
+}
+
+void
+test_l3_threads (void)
+{
+  unsigned long seed = 3;
+
+  test_l3_threads_type (0, &seed);
+  test_l3_threads_type (1, &seed);
+}
+
+/* Compare the strided batch routines with a loop over the single
+ * routines. The sizes cover the kernels specialized for a fixed
+ * number of columns, the generic kernel, problems which are passed to
+ * the single routine, and a batch large enough to be split between
+ * threads. */
+static void
+test_batch_dims (const int M, const int N, const int K, const int nbatch,
+                 unsigned long *seed)
+{
+  const double alpha = 0.5, betas[2] = { 0.0, -0.75 };
+  const int nm = GSL_MAX (GSL_MAX (M, N), K);
+  const size_t smax = (size_t) (nm + 2) * nm + 5;
+  const size_t nmax = smax * nbatch;
+  double *A = malloc (nmax * sizeof (double));
+  double *B = malloc (nmax * sizeof (double));
+  double *C = malloc (nmax * sizeof (double));
+  double *X1 = malloc (nmax * sizeof (double));
+  double *R = malloc (nmax * sizeof (double));
+  char desc[128];
+  size_t io, ia, ib, i;
+  int p, ibeta, side, uplo, diag;
+
+  for (io = 0; io < 2; io++)
+    {
+      const enum CBLAS_ORDER order = block_orders[io];
+
+      /* gemm */
+
+      for (ia = 0; ia < 3; ia++)
+        {
+          for (ib = 0; ib < 3; ib++)
+            {
+              const enum CBLAS_TRANSPOSE transA = block_trans[ia];
+              const enum CBLAS_TRANSPOSE transB = block_trans[ib];
+              const int rowsA = ((order == CblasRowMajor) == (transA == CblasNoTrans)) ? M : K;
+              const int colsA = (rowsA == M) ? K : M;
+              const int rowsB = ((order == CblasRowMajor) == (transB == CblasNoTrans)) ? K : N;
+              const int colsB = (rowsB == K) ? N : K;
+              const int rowsC = (order == CblasRowMajor) ? M : N;
+              const int lda = colsA + 1, ldb = colsB, ldc = ((order == CblasRowMajor) ? N : M) + 2;
+              /* a zero stride uses the same A for every problem */
+              const int stridea = (ib == 1) ? 0 : rowsA * lda + 3;
+              const int strideb = rowsB * ldb + 1;
+              const int stridec = rowsC * ldc;
+
+              block_random (A, nmax, seed);
+              block_random (B, nmax, seed);
+
+              for (ibeta = 0; ibeta < 2; ibeta++)
+                {
+                  const double beta = betas[ibeta];
+
+                  block_random (C, nmax, seed);
+                  memcpy (R, C, nmax * sizeof (double));
+
+                  for (p = 0; p < nbatch; p++)
+                    cblas_dgemm (order, transA, transB, M, N, K, alpha,
+                                 A + (size_t) stridea * p, lda,
+                                 B + (size_t) strideb * p, ldb, beta,
+                                 R + (size_t) stridec * p, ldc);
+
+#define GEMM_BATCH(X) \
+  cblas_dgemm_batch_strided (order, transA, transB, M, N, K, alpha, A, lda, \
+                             stridea, B, ldb, strideb, beta, X, ldc, stridec, nbatch)
+
+                  sprintf (desc, "dgemm_batch_strided M=%d N=%d K=%d order=%d transA=%d transB=%d beta=%g",
+                           M, N, K, order, transA, transB, beta);
+                  L3_CHECK (GEMM_BATCH, C, R, nmax, desc);
+#undef GEMM_BATCH
+                }
+            }
+        }
+
+      /* gemv */
+
+      for (ia = 0; ia < 3; ia++)
+        {
+          const enum CBLAS_TRANSPOSE transA = block_trans[ia];
+          const int lenX = (transA == CblasNoTrans) ? N : M;
+          const int lenY = (transA == CblasNoTrans) ? M : N;
+          const int lda = ((order == CblasRowMajor) ? N : M) + 1;
+          const int stridea = ((order == CblasRowMajor) ? M : N) * lda;
+
+          for (ib = 0; ib < 2; ib++)
+            {
+              const int incX = ib ? -2 : 1, incY = ib ? -3 : 1;
+              const int stridex = (ib ? 0 : lenX + 1);
+              const int stridey = lenY * abs (incY) + 2;
+
+              block_random (A, nmax, seed);
+              block_random (B, nmax, seed);
+
+              for (ibeta = 0; ibeta < 2; ibeta++)
+                {
+                  const double beta = betas[ibeta];
+
+                  block_random (C, nmax, seed);
+                  memcpy (R, C, nmax * sizeof (double));
+
+                  for (p = 0; p < nbatch; p++)
+                    cblas_dgemv (order, transA, M, N, alpha,
+                                 A + (size_t) stridea * p, lda,
+                                 B + (size_t) stridex * p, incX, beta,
+                                 R + (size_t) stridey * p, incY);
+
+#define GEMV_BATCH(X) \
+  cblas_dgemv_batch_strided (order, transA, M, N, alpha, A, lda, stridea, \
+                             B, incX, stridex, beta, X, incY, stridey, nbatch)
+
+                  sprintf (desc, "dgemv_batch_strided M=%d N=%d order=%d trans=%d incX=%d incY=%d beta=%g",
+                           M, N, order, transA, incX, incY, beta);
+                  L3_CHECK (GEMV_BATCH, C, R, nmax, desc);
+#undef GEMV_BATCH
+                }
+            }
+        }
+
+      /* trsm */
+
+      for (side = CblasLeft; side <= CblasRight; side++)
+        {
+          for (uplo = CblasUpper; uplo <= CblasLower; uplo++)
+            {
+              for (ia = 0; ia < 3; ia++)
+                {
+                  for (diag = CblasNonUnit; diag <= CblasUnit; diag++)
+                    {
+                      const enum CBLAS_TRANSPOSE transA = block_trans[ia];
+                      const int na = (side == CblasLeft) ? M : N;
+                      const int lda = na + 1;
+                      const int ldb = ((order == CblasRowMajor) ? N : M) + 1;
+                      const int stridea = na * lda;
+                      const int strideb = ((order == CblasRowMajor) ? M : N) * ldb + 5;
+
+                      block_random (A, nmax, seed);
+
+                      /* keep the triangular matrices well conditioned */
+                      for (p = 0; p < nbatch; p++)
+                        {
+                          double *Ap = A + (size_t) stridea * p;
+
+                          for (i = 0; i < (size_t) na * lda; i++)
+                            Ap[i] /= na;
+                          for (i = 0; i < (size_t) na; i++)
+                            Ap[i * lda + i] += 1.0;
+                        }
+
+                      block_random (C, nmax, seed);
+                      memcpy (R, C, nmax * sizeof (double));
+
+                      for (p = 0; p < nbatch; p++)
+                        cblas_dtrsm (order, side, uplo, transA, diag, M, N,
+                                     alpha, A + (size_t) stridea * p, lda,
+                                     R + (size_t) strideb * p, ldb);
+
+#define TRSM_BATCH(X) \
+  cblas_dtrsm_batch_strided (order, side, uplo, transA, diag, M, N, alpha, \
+                             A, lda, stridea, X, ldb, strideb, nbatch)
+
+                      sprintf (desc, "dtrsm_batch_strided M=%d N=%d order=%d side=%d uplo=%d trans=%d diag=%d",
+                               M, N, order, side, uplo, transA, diag);
+                      L3_CHECK (TRSM_BATCH, C, R, nmax, desc);
+#undef TRSM_BATCH
+                    }
+                }
+            }
+        }
+    }
+
+  gsl_cblas_set_num_threads (1);
+
+  free (A);
+  free (B);
+  free (C);
+  free (X1);
+  free (R);
+}
+
+/* Compare the group routines with a loop over the single routines.
+ * One call handles groups with different dimensions and options,
+ * including an empty group and a group large enough to be split
+ * between threads, with the problems in decreasing order in memory. */
+#define NGROUP 4
+static void
+test_batch_group_order (const enum CBLAS_ORDER order, unsigned long *seed)
+{
+  const int Ms[NGROUP] = { 4, 5, 2, 17 };
+  const int Ns[NGROUP] = { 4, 3, 2, 8 };
+  const int Ks[NGROUP] = { 4, 7, 2, 6 };
+  const int gsize[NGROUP] = { 40, 25, 0, 3000 };
+  const enum CBLAS_TRANSPOSE transA[NGROUP] = { CblasNoTrans, CblasTrans, CblasNoTrans, CblasConjTrans };
+  const enum CBLAS_TRANSPOSE transB[NGROUP] = { CblasTrans, CblasNoTrans, CblasNoTrans, CblasNoTrans };
+  const enum CBLAS_SIDE side[NGROUP] = { CblasLeft, CblasRight, CblasLeft, CblasRight };
+  const enum CBLAS_UPLO uplo[NGROUP] = { CblasUpper, CblasLower, CblasUpper, CblasLower };
+  const enum CBLAS_DIAG diag[NGROUP] = { CblasNonUnit, CblasUnit, CblasNonUnit, CblasNonUnit };
+  const int incX[NGROUP] = { 1, -2, 1, 3 };
+  const int incY[NGROUP] = { 1, 1, -3, 2 };
+  const double alphas[NGROUP] = { 0.5, -1.0, 2.0, 0.25 };
+  const double betas[NGROUP] = { 0.0, -0.75, 1.0, 0.5 };
+  /* every matrix fits in ld x ld, every vector in ld*ld elements */
+  const int ld = 18;
+  const int lds[NGROUP] = { 18, 18, 18, 18 };
+  const size_t slot = (size_t) ld * ld;
+  const int total = 40 + 25 + 3000;
+  const size_t nmax = slot * total;
+  double *A = malloc (nmax * sizeof (double));
+  double *B = malloc (nmax * sizeof (double));
+  double *C = malloc (nmax * sizeof (double));
+  double *X1 = malloc (nmax * sizeof (double));
+  double *R = malloc (nmax * sizeof (double));
+  const double **Ap = malloc (total * sizeof (double *));
+  const double **Bp = malloc (total * sizeof (double *));
+  double **Cp = malloc (total * sizeof (double *));
+  int *grp = malloc (total * sizeof (int));
+  char desc[128];
+  size_t i;
+  int g, p;
+
+  for (g = 0, p = 0; g < NGROUP; g++)
+    {
+      int j;
+
+      for (j = 0; j < gsize[g]; j++)
+        grp[p++] = g;
+    }
+
+  /* problem p uses slot total - 1 - p of each array */
+  for (p = 0; p < total; p++)
+    {
+      Ap[p] = A + slot * (total - 1 - p);
+      Bp[p] = B + slot * (total - 1 - p);
+    }
+
+#define SET_C(X) \
+  for (p = 0; p < total; p++) \
+    Cp[p] = (X) + slot * (total - 1 - p)
+
+  /* gemm */
+
+  block_random (A, nmax, seed);
+  block_random (B, nmax, seed);
+  block_random (C, nmax, seed);
+  memcpy (R, C, nmax * sizeof (double));
+
+  SET_C (R);
+  for (p = 0; p < total; p++)
+    {
+      g = grp[p];
+      cblas_dgemm (order, transA[g], transB[g], Ms[g], Ns[g], Ks[g],
+                   alphas[g], Ap[p], ld, Bp[p], ld, betas[g], Cp[p], ld);
+    }
+
+#define GEMM_GROUP(X) \
+  do { \
+    SET_C (X); \
+    cblas_dgemm_batch (order, transA, transB, Ms, Ns, Ks, alphas, Ap, lds, \
+                       Bp, lds, betas, Cp, lds, NGROUP, gsize); \
+  } while (0)
+
+  sprintf (desc, "dgemm_batch order=%d", order);
+  L3_CHECK (GEMM_GROUP, C, R, nmax, desc);
+#undef GEMM_GROUP
+
+  /* gemv */
+
+  block_random (C, nmax, seed);
+  memcpy (R, C, nmax * sizeof (double));
+
+  SET_C (R);
+  for (p = 0; p < total; p++)
+    {
+      g = grp[p];
+      cblas_dgemv (order, transA[g], Ms[g], Ns[g], alphas[g], Ap[p], ld,
+                   Bp[p], incX[g], betas[g], Cp[p], incY[g]);
+    }
+
+#define GEMV_GROUP(X) \
+  do { \
+    SET_C (X); \
+    cblas_dgemv_batch (order, transA, Ms, Ns, alphas, Ap, lds, Bp, incX, \
+                       betas, Cp, incY, NGROUP, gsize); \
+  } while (0)
+
+  sprintf (desc, "dgemv_batch order=%d", order);
+  L3_CHECK (GEMV_GROUP, C, R, nmax, desc);
+#undef GEMV_GROUP
+
+  /* trsm */
+
+  /* keep the triangular matrices well conditioned */
+  for (i = 0; i < nmax; i++)
+    A[i] /= ld;
+  for (p = 0; p < total; p++)
+    for (i = 0; i < (size_t) ld; i++)
+      A[slot * p + i * ld + i] += 1.0;
+
+  block_random (C, nmax, seed);
+  memcpy (R, C, nmax * sizeof (double));
+
+  SET_C (R);
+  for (p = 0; p < total; p++)
+    {
+      g = grp[p];
+      cblas_dtrsm (order, side[g], uplo[g], transA[g], diag[g], Ms[g], Ns[g],
+                   alphas[g], Ap[p], ld, Cp[p], ld);
+    }
+
+#define TRSM_GROUP(X) \
+  do { \
+    SET_C (X); \
+    cblas_dtrsm_batch (order, side, uplo, transA, diag, Ms, Ns, alphas, Ap, \
+                       lds, Cp, lds, NGROUP, gsize); \
+  } while (0)
+
+  sprintf (desc, "dtrsm_batch order=%d", order);
+  L3_CHECK (TRSM_GROUP, C, R, nmax, desc);
+#undef TRSM_GROUP
+#undef SET_C
+
+  gsl_cblas_set_num_threads (1);
+
+  free (A);
+  free (B);
+  free (C);
+  free (X1);
+  free (R);
+  free (Ap);
+  free (Bp);
+  free (Cp);
+  free (grp);
+}
+#undef NGROUP
+
+void
+test_batch (void)
+{
+  unsigned long seed = 5;
+
+  test_batch_dims (4, 4, 4, 50, &seed);
+  test_batch_dims (5, 3, 7, 30, &seed);
+  test_batch_dims (17, 8, 6, 20, &seed);
+  test_batch_dims (3, 40, 70, 4, &seed);
+  test_batch_dims (6, 6, 6, 12000, &seed);
+
+  test_batch_group_order (CblasRowMajor, &seed);
+  test_batch_group_order (CblasColMajor, &seed);
+}
@@ -42,3 +42,9 @@
   test_her2k ();
   test_trmm ();
   test_trsm ();
+  test_gemm_block ();
+  test_syrk_block ();
+  test_l1_kernels ();
+  test_gemv_block ();
+  test_l3_threads ();
+  test_batch ();
@@ -42,3 +42,9 @@ void test_syr2k (void);
 void test_her2k (void);
 void test_trmm (void);
 void test_trsm (void);
+void test_gemm_block (void);
+void test_syrk_block (void);
+void test_l1_kernels (void);
+void test_gemv_block (void);
+void test_l3_threads (void);
+void test_batch (void);
@@ -0,0 +1,339 @@
+/* cblas/thread.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * A small persistent thread pool for the Level-3 routines.
+ *
+ * The pool has nthreads - 1 worker threads; the thread which submits a
+ * job takes part in it as well. A job is a set of independent tasks
+ * numbered 0..ntasks-1, which are handed out one at a time under the
+ * pool lock. Tasks are coarse (a tile of a matrix product), so the
+ * cost of the lock is negligible.
+ *
+ * Only one job runs on the pool at a time. If another thread submits a
+ * job while the pool is busy (for example when the application itself
+ * calls the BLAS from several threads), that thread runs its tasks
+ * serially instead of waiting. Tasks which call back into the library
+ * are detected with a thread-specific flag and also run serially.
+ *
+ * Jobs submitted from the tasks of a gsl_thread_pool of the main
+ * library (the parallel linalg and spblas routines) run serially as
+ * well, since the threads of that pool are already busy; they are cut
+ * into the same tiles, so that the results do not change. The CBLAS
+ * library does not depend on the main library, so
+ * gsl_thread_pool_in_worker is referenced weakly where the toolchain
+ * supports it, and is only called if the program is linked with the
+ * main library.
+ *
+ * The number of threads is taken from the environment variable
+ * GSL_CBLAS_NUM_THREADS the first time it is needed, and can be
+ * changed with gsl_cblas_set_num_threads. The default is 1.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_cblas.h>
+#include "thread.h"
+
+#ifdef HAVE_PTHREAD
+
+#include <pthread.h>
+
+#define POOL_MAX_THREADS 1024
+
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_wake = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t pool_done = PTHREAD_COND_INITIALIZER;
+static pthread_once_t pool_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t pool_key;
+
+static int pool_nthreads = 0;   /* requested threads, 0 = not yet read */
+static int pool_nworkers = 0;   /* worker threads created */
+static int pool_busy = 0;
+static unsigned long pool_generation = 0;
+
+/* current job, protected by pool_lock */
+static gsl_cblas_task job_task;
+static void *job_arg;
+static int job_ntasks;
+static int job_next;
+static int job_finished;
+
+#if defined(__GNUC__) && defined(__ELF__)
+extern int gsl_thread_pool_in_worker (void) __attribute__ ((weak));
+#define IN_GSL_THREAD_POOL() \
+  (gsl_thread_pool_in_worker != NULL && gsl_thread_pool_in_worker ())
+#else
+#define IN_GSL_THREAD_POOL() 0
+#endif
+
+static void
+pool_key_create (void)
+{
+  pthread_key_create (&pool_key, NULL);
+}
+
+int
+gsl_cblas_in_parallel (void)
+{
+  pthread_once (&pool_key_once, pool_key_create);
+  return pthread_getspecific (pool_key) != NULL;
+}
+
+/* execute tasks of the current job until none are left; called and
+   returns with pool_lock held */
+static void
+pool_run_tasks (void)
+{
+  static int marker;
+
+  while (job_next < job_ntasks)
+    {
+      const int t = job_next++;
+
+      pthread_mutex_unlock (&pool_lock);
+
+      pthread_setspecific (pool_key, &marker);
+      job_task (job_arg, t);
+      pthread_setspecific (pool_key, NULL);
+
+      pthread_mutex_lock (&pool_lock);
+
+      if (++job_finished == job_ntasks)
+        pthread_cond_signal (&pool_done);
+    }
+}
+
+static void *
+pool_worker (void *arg)
+{
+  const long id = (long) arg;
+  unsigned long seen;
+
+  pthread_mutex_lock (&pool_lock);
+  seen = pool_generation;
+
+  for (;;)
+    {
+      while (pool_generation == seen)
+        pthread_cond_wait (&pool_wake, &pool_lock);
+
+      seen = pool_generation;
+
+      /* workers beyond the current thread count stay idle */
+      if (id < pool_nthreads - 1)
+        pool_run_tasks ();
+    }
+
+  return NULL;
+}
+
+/* read GSL_CBLAS_NUM_THREADS; called with pool_lock held */
+static void
+pool_init (void)
+{
+  if (pool_nthreads == 0)
+    {
+      const char *env = getenv ("GSL_CBLAS_NUM_THREADS");
+      const int n = (env != NULL) ? atoi (env) : 1;
+      pool_nthreads = (n >= 1 && n <= POOL_MAX_THREADS) ? n : 1;
+    }
+}
+
+/* create worker threads up to the requested count; called with
+   pool_lock held */
+static void
+pool_start (void)
+{
+  while (pool_nworkers < pool_nthreads - 1)
+    {
+      pthread_t thread;
+      pthread_attr_t attr;
+      int status;
+
+      pthread_attr_init (&attr);
+      pthread_attr_setdetachstate (&attr, PTHREAD_CREATE_DETACHED);
+      status = pthread_create (&thread, &attr, pool_worker, (void *) (long) pool_nworkers);
+      pthread_attr_destroy (&attr);
+
+      if (status != 0)
+        {
+          /* run with the threads we have */
+          pool_nthreads = pool_nworkers + 1;
+          break;
+        }
+
+      pool_nworkers++;
+    }
+}
+
+void
+gsl_cblas_set_num_threads (const int nthreads)
+{
+  pthread_mutex_lock (&pool_lock);
+  pool_nthreads = (nthreads >= 1 && nthreads <= POOL_MAX_THREADS) ? nthreads : 1;
+  pthread_mutex_unlock (&pool_lock);
+}
+
+int
+gsl_cblas_get_num_threads (void)
+{
+  int n;
+
+  pthread_mutex_lock (&pool_lock);
+  pool_init ();
+  n = pool_nthreads;
+  pthread_mutex_unlock (&pool_lock);
+
+  return n;
+}
+
+int
+gsl_cblas_have_threads (void)
+{
+  return 1;
+}
+
+void
+gsl_cblas_parallel_for (const int ntasks, gsl_cblas_task task, void *arg)
+{
+  int t;
+
+  if (ntasks > 1 && !gsl_cblas_in_parallel () && !IN_GSL_THREAD_POOL ())
+    {
+      pthread_mutex_lock (&pool_lock);
+      pool_init ();
+
+      if (!pool_busy && pool_nthreads > 1)
+        {
+          pool_start ();
+
+          pool_busy = 1;
+          job_task = task;
+          job_arg = arg;
+          job_ntasks = ntasks;
+          job_next = 0;
+          job_finished = 0;
+          pool_generation++;
+          pthread_cond_broadcast (&pool_wake);
+
+          pool_run_tasks ();
+
+          while (job_finished < job_ntasks)
+            pthread_cond_wait (&pool_done, &pool_lock);
+
+          pool_busy = 0;
+          pthread_mutex_unlock (&pool_lock);
+          return;
+        }
+
+      pthread_mutex_unlock (&pool_lock);
+    }
+
+  for (t = 0; t < ntasks; t++)
+    task (arg, t);
+}
+
+#else /* !HAVE_PTHREAD */
+
+static int pool_nthreads = 1;
+
+void
+gsl_cblas_set_num_threads (const int nthreads)
+{
+  pool_nthreads = (nthreads >= 1) ? nthreads : 1;
+}
+
+int
+gsl_cblas_get_num_threads (void)
+{
+  return pool_nthreads;
+}
+
+int
+gsl_cblas_have_threads (void)
+{
+  return 0;
+}
+
+int
+gsl_cblas_in_parallel (void)
+{
+  return 0;
+}
+
+void
+gsl_cblas_parallel_for (const int ntasks, gsl_cblas_task task, void *arg)
+{
+  int t;
+
+  for (t = 0; t < ntasks; t++)
+    task (arg, t);
+}
+
+#endif /* HAVE_PTHREAD */
+
+/* Batches are cut into tasks of at least CBLAS_L3_TILE^3/8 flops, the
+   same granularity as the Level-3 tiles. */
+
+typedef struct
+{
+  gsl_cblas_batch_task f;
+  void *arg;
+  int nbatch;
+  int chunk;
+} batch_args;
+
+static void
+batch_run (void *arg, const int task)
+{
+  const batch_args *p = (const batch_args *) arg;
+  const int first = task * p->chunk;
+  const int last = (first + p->chunk < p->nbatch) ? first + p->chunk : p->nbatch;
+
+  p->f (p->arg, first, last);
+}
+
+void
+gsl_cblas_parallel_batch (const int nbatch, const double work,
+                          gsl_cblas_batch_task f, void *arg)
+{
+  const double grain = 0.125 * CBLAS_L3_TILE * CBLAS_L3_TILE * CBLAS_L3_TILE;
+  batch_args p;
+  int ntasks;
+
+  if (nbatch <= 0)
+    return;
+
+  p.f = f;
+  p.arg = arg;
+  p.nbatch = nbatch;
+  p.chunk = (work * nbatch <= grain) ? nbatch
+    : (work >= grain) ? 1 : (int) (grain / work + 1.0);
+
+  ntasks = (nbatch + p.chunk - 1) / p.chunk;
+
+  if (ntasks == 1 || !gsl_cblas_have_threads () || gsl_cblas_in_parallel ())
+    {
+      f (arg, 0, nbatch);
+      return;
+    }
+
+  gsl_cblas_parallel_for (ntasks, batch_run, &p);
+}
@@ -0,0 +1,103 @@
+/* cblas/thread.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __CBLAS_THREAD_H__
+#define __CBLAS_THREAD_H__
+
+/* Internal thread pool of the CBLAS library (thread.c) */
+
+typedef void (*gsl_cblas_task) (void *arg, const int task);
+
+/* run task(arg, t) for t = 0, ..., ntasks - 1, using the pool when it
+   is free and the caller is not a task of a gsl_thread_pool; returns
+   when all tasks are complete */
+void gsl_cblas_parallel_for (const int ntasks, gsl_cblas_task task, void *arg);
+
+/* nonzero if the calling thread is executing a pool task */
+int gsl_cblas_in_parallel (void);
+
+/* nonzero if the library was built with thread support */
+int gsl_cblas_have_threads (void);
+
+/* run a batch of nbatch independent problems of about work flops
+   each, as tasks of consecutive problems; f(arg, first, last) handles
+   problems first..last-1 */
+typedef void (*gsl_cblas_batch_task) (void *arg, const int first,
+                                      const int last);
+
+void gsl_cblas_parallel_batch (const int nbatch, const double work,
+                               gsl_cblas_batch_task f, void *arg);
+
+/* Splitting of the Level-3 routines into independent tiles
+   (l3_parallel.c). Each function returns 1 if the operation was
+   carried out in tiles (or for trmm and trsm in recursive blocks), or
+   0 if the caller should do it directly.
+   The tiling only depends on the dimensions of the problem, never on
+   the number of threads, so results are reproducible. */
+
+#define CBLAS_L3_TILE 256
+
+/* trmm and trsm are blocked down to this triangular dimension */
+#define CBLAS_TRXM_BLOCK 128
+
+/* type code of the current template instance */
+#define CBLAS_TYPE_R ((sizeof (BASE) == sizeof (float)) ? 's' : 'd')
+#define CBLAS_TYPE_C ((sizeof (BASE) == sizeof (float)) ? 'c' : 'z')
+
+int gsl_cblas_l3_gemm (const char type, const enum CBLAS_ORDER Order,
+                       const enum CBLAS_TRANSPOSE TransA,
+                       const enum CBLAS_TRANSPOSE TransB,
+                       const int M, const int N, const int K,
+                       const void *alpha, const void *A, const int lda,
+                       const void *B, const int ldb, const void *beta,
+                       void *C, const int ldc);
+
+int gsl_cblas_l3_symm (const char type, const int herm,
+                       const enum CBLAS_ORDER Order,
+                       const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo,
+                       const int M, const int N, const void *alpha,
+                       const void *A, const int lda, const void *B,
+                       const int ldb, const void *beta, void *C,
+                       const int ldc);
+
+int gsl_cblas_l3_syrk (const char type, const int herm,
+                       const enum CBLAS_ORDER Order,
+                       const enum CBLAS_UPLO Uplo,
+                       const enum CBLAS_TRANSPOSE Trans, const int N,
+                       const int K, const void *alpha, const void *A,
+                       const int lda, const void *beta, void *C,
+                       const int ldc);
+
+int gsl_cblas_l3_syr2k (const char type, const int herm,
+                        const enum CBLAS_ORDER Order,
+                        const enum CBLAS_UPLO Uplo,
+                        const enum CBLAS_TRANSPOSE Trans, const int N,
+                        const int K, const void *alpha, const void *A,
+                        const int lda, const void *B, const int ldb,
+                        const void *beta, void *C, const int ldc);
+
+int gsl_cblas_l3_trxm (const char type, const int solve,
+                       const enum CBLAS_ORDER Order,
+                       const enum CBLAS_SIDE Side, const enum CBLAS_UPLO Uplo,
+                       const enum CBLAS_TRANSPOSE TransA,
+                       const enum CBLAS_DIAG Diag, const int M, const int N,
+                       const void *alpha, const void *A, const int lda,
+                       void *B, const int ldb);
+
+#endif /* __CBLAS_THREAD_H__ */
@@ -0,0 +1,104 @@
+/* cblas/trsm_batch_kernel_r.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Solve op(A)*X = alpha*B (left) or X*op(A) = alpha*B (right) for a
+   row-major n1-by-BATCH_N matrix B, overwriting B with X. op(A) is
+   lower or upper triangular with op(A)(i,k) = A[rsa*i + csa*k]. */
+
+static void
+BATCH_NAME (trsm_batch_left) (const int n1, const int n, const int lower,
+                              const int nonunit, const BASE alpha,
+                              const BASE * A, const int rsa, const int csa,
+                              BASE * B, const int ldb)
+{
+  int ii, j, k;
+  (void) n;                     /* used only as BATCH_N in the _any instance */
+
+  for (ii = 0; ii < n1; ii++) {
+    const int i = lower ? ii : n1 - 1 - ii;
+    const int k0 = lower ? 0 : i + 1;
+    const int k1 = lower ? i : n1;
+    BASE c[BATCH_NMAX];
+
+    for (j = 0; j < BATCH_N; j++) {
+      c[j] = alpha * B[ldb * i + j];
+    }
+
+    for (k = k0; k < k1; k++) {
+      const BASE a = A[rsa * i + csa * k];
+      const BASE *x = B + ldb * k;
+      for (j = 0; j < BATCH_N; j++) {
+        c[j] -= a * x[j];
+      }
+    }
+
+    if (nonunit) {
+      const BASE d = A[(rsa + csa) * i];
+      for (j = 0; j < BATCH_N; j++) {
+        c[j] /= d;
+      }
+    }
+
+    for (j = 0; j < BATCH_N; j++) {
+      B[ldb * i + j] = c[j];
+    }
+  }
+}
+
+static void
+BATCH_NAME (trsm_batch_right) (const int n1, const int n, const int lower,
+                               const int nonunit, const BASE alpha,
+                               const BASE * A, const int rsa, const int csa,
+                               BASE * B, const int ldb)
+{
+  int i, j, k;
+  (void) n;                     /* used only as BATCH_N in the _any instance */
+
+  for (i = 0; i < n1; i++) {
+    BASE c[BATCH_NMAX];
+
+    for (j = 0; j < BATCH_N; j++) {
+      c[j] = alpha * B[ldb * i + j];
+    }
+
+    if (lower) {
+      for (j = BATCH_N; j > 0 && j--;) {
+        if (nonunit) {
+          c[j] /= A[(rsa + csa) * j];
+        }
+        for (k = 0; k < j; k++) {
+          c[k] -= c[j] * A[rsa * j + csa * k];
+        }
+      }
+    } else {
+      for (j = 0; j < BATCH_N; j++) {
+        if (nonunit) {
+          c[j] /= A[(rsa + csa) * j];
+        }
+        for (k = j + 1; k < BATCH_N; k++) {
+          c[k] -= c[j] * A[rsa * j + csa * k];
+        }
+      }
+    }
+
+    for (j = 0; j < BATCH_N; j++) {
+      B[ldb * i + j] = c[j];
+    }
+  }
+}
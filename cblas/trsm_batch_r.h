@@ -0,0 +1,169 @@
+/* cblas/trsm_batch_r.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Batch TRSM for real types. This file is included at file scope with
+ * BASE defined and TRSM defined to the corresponding cblas_xtrsm, and
+ * provides
+ *
+ * trsm_batch_task (arg, first, last)
+ *
+ * a task for gsl_cblas_parallel_batch which solves
+ * op(A_p)*X_p = alpha*B_p or X_p*op(A_p) = alpha*B_p for problems
+ * p = first, ..., last - 1 of the batch described by arg, where
+ * X_p = Xp[p], or X_p = X + p*strideX for a strided batch (Xp null).
+ * Small problems (see batch.h) use kernels specialized for the number
+ * of columns of the row-major form of B; other problems call TRSM.
+ *
+ * trsm_group_task (arg, first, last)
+ *
+ * the same for problems first, ..., last - 1 of the groups described
+ * by arg, numbered consecutively through the groups.
+ */
+
+#include "batch.h"
+
+typedef struct
+{
+  enum CBLAS_ORDER Order;
+  enum CBLAS_SIDE Side;
+  enum CBLAS_UPLO Uplo;
+  enum CBLAS_TRANSPOSE TransA;
+  enum CBLAS_DIAG Diag;
+  int M, N;
+  BASE alpha;
+  const BASE *A;
+  int lda, stridea;
+  BASE *B;
+  int ldb, strideb;
+  const BASE *const *Ap;
+  BASE *const *Bp;
+} trsm_batch_args;
+
+typedef struct
+{
+  enum CBLAS_ORDER Order;
+  const enum CBLAS_SIDE *Side;
+  const enum CBLAS_UPLO *Uplo;
+  const enum CBLAS_TRANSPOSE *TransA;
+  const enum CBLAS_DIAG *Diag;
+  const int *M, *N;
+  const BASE *alpha;
+  const BASE **A;
+  const int *lda;
+  BASE **B;
+  const int *ldb;
+  int group_count;
+  const int *group_size;
+} trsm_group_args;
+
+#define BATCH_KERNEL "trsm_batch_kernel_r.h"
+#include "batch_sizes.h"
+#undef BATCH_KERNEL
+
+static void
+trsm_batch_task (void *arg, const int first, const int last)
+{
+  const trsm_batch_args *p = (const trsm_batch_args *) arg;
+  const int nonunit = (p->Diag == CblasNonUnit);
+  const int trans = (p->TransA != CblasNoTrans);
+  int n1, n2, side, uplo, lower;
+  int rsa, csa;
+  int b;
+
+  if (p->Order == CblasRowMajor) {
+    n1 = p->M;
+    n2 = p->N;
+    side = p->Side;
+    uplo = p->Uplo;
+  } else {
+    n1 = p->N;
+    n2 = p->M;
+    side = (p->Side == CblasLeft) ? CblasRight : CblasLeft;
+    uplo = (p->Uplo == CblasUpper) ? CblasLower : CblasUpper;
+  }
+
+  /* shape of op(A) */
+  lower = ((uplo == CblasLower) != trans);
+
+  rsa = trans ? 1 : p->lda;
+  csa = trans ? p->lda : 1;
+
+  if (p->alpha != 0.0 && n2 <= BATCH_MAX && n1 <= BATCH_MAX_OUTER) {
+    for (b = first; b < last; b++) {
+      const BASE *A = BATCH_PTR (p->Ap, p->A, p->stridea, b);
+      BASE *B = BATCH_PTR (p->Bp, p->B, p->strideb, b);
+
+      if (side == CblasLeft) {
+        BATCH_CALL (trsm_batch_left, n2,
+                    (n1, n2, lower, nonunit, p->alpha, A, rsa, csa, B, p->ldb));
+      } else {
+        BATCH_CALL (trsm_batch_right, n2,
+                    (n1, n2, lower, nonunit, p->alpha, A, rsa, csa, B, p->ldb));
+      }
+    }
+  } else {
+    for (b = first; b < last; b++) {
+      TRSM (p->Order, p->Side, p->Uplo, p->TransA, p->Diag, p->M, p->N,
+            p->alpha, BATCH_PTR (p->Ap, p->A, p->stridea, b), p->lda,
+            BATCH_PTR (p->Bp, p->B, p->strideb, b), p->ldb);
+    }
+  }
+}
+
+static void
+trsm_group_task (void *arg, const int first, const int last)
+{
+  const trsm_group_args *p = (const trsm_group_args *) arg;
+  int g = 0, start = 0;
+
+  /* find the group of problem first */
+  while (g < p->group_count && start + p->group_size[g] <= first) {
+    start += p->group_size[g];
+    g++;
+  }
+
+  for (; g < p->group_count && start < last; g++) {
+    const int lo = GSL_MAX (first, start) - start;
+    const int hi = GSL_MIN (last, start + p->group_size[g]) - start;
+    trsm_batch_args q;
+
+    q.Order = p->Order;
+    q.Side = p->Side[g];
+    q.Uplo = p->Uplo[g];
+    q.TransA = p->TransA[g];
+    q.Diag = p->Diag[g];
+    q.M = p->M[g];
+    q.N = p->N[g];
+    q.alpha = p->alpha[g];
+    q.A = 0;
+    q.lda = p->lda[g];
+    q.stridea = 0;
+    q.B = 0;
+    q.ldb = p->ldb[g];
+    q.strideb = 0;
+    q.Ap = p->A + start;
+    q.Bp = p->B + start;
+
+    if (hi > lo && q.M != 0 && q.N != 0)
+      trsm_batch_task (&q, lo, hi);
+
+    start += p->group_size[g];
+  }
+}
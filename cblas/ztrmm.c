@@ -2,6 +2,7 @@
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
 #include "error_cblas_l3.h"
+#include "thread.h"
 
 void
 cblas_ztrmm (const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side,
@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+
+/* A = U0 diag(s0) V0^T with s0(i) = 1/(1+i)^2 and random orthonormal
+   U0, V0 */
+static void
+make_matrix (gsl_matrix * A, gsl_vector * s0, gsl_rng * r)
+{
+  const size_t M = A->size1, N = A->size2;
+  gsl_matrix * U0 = gsl_matrix_alloc (M, N);
+  gsl_matrix * V0 = gsl_matrix_alloc (N, N);
+  gsl_matrix * T = gsl_matrix_alloc (N, N);
+  size_t i, j;
+
+  for (i = 0; i < M; ++i)
+    for (j = 0; j < N; ++j)
+      gsl_matrix_set (U0, i, j, gsl_rng_uniform (r) - 0.5);
+
+  for (i = 0; i < N; ++i)
+    for (j = 0; j < N; ++j)
+      gsl_matrix_set (V0, i, j, gsl_rng_uniform (r) - 0.5);
+
+  gsl_linalg_QR_decomp_r (U0, T);
+  gsl_linalg_QR_Q1_r (U0, T, U0);
+  gsl_linalg_QR_decomp_r (V0, T);
+  gsl_linalg_QR_Q1_r (V0, T, V0);
+
+  for (j = 0; j < N; ++j)
+    {
+      gsl_vector_view c = gsl_matrix_column (U0, j);
+      double sj = 1.0 / ((1.0 + j) * (1.0 + j));
+
+      gsl_vector_set (s0, j, sj);
+      gsl_blas_dscal (sj, &c.vector);
+    }
+
+  gsl_blas_dgemm (CblasNoTrans, CblasTrans, 1.0, U0, V0, 0.0, A);
+
+  gsl_matrix_free (U0);
+  gsl_matrix_free (V0);
+  gsl_matrix_free (T);
+}
+
+int
+main (void)
+{
+  const size_t M = 2000, N = 500, k = 20, p = 10;
+  gsl_rng * r = gsl_rng_alloc (gsl_rng_default);
+  gsl_matrix * A = gsl_matrix_alloc (M, N);
+  gsl_matrix * B = gsl_matrix_alloc (M, N);
+  gsl_matrix * V = gsl_matrix_alloc (N, N);
+  gsl_vector * S = gsl_vector_alloc (N);
+  gsl_vector * s0 = gsl_vector_alloc (N);
+  gsl_vector * work = gsl_vector_alloc (N);
+  gsl_matrix * Uk = gsl_matrix_alloc (M, k);
+  gsl_matrix * Vk = gsl_matrix_alloc (N, k);
+  gsl_vector * Sk = gsl_vector_alloc (k);
+  gsl_linalg_rsvd_workspace * w = gsl_linalg_rsvd_alloc (M, N, k, p);
+  clock_t t0;
+  size_t i, q;
+
+  make_matrix (A, s0, r);
+
+  /* full SVD */
+  gsl_matrix_memcpy (B, A);
+  t0 = clock ();
+  gsl_linalg_SV_decomp (B, V, S, work);
+  printf ("full SVD:           time = %.3f s\n",
+          (double) (clock () - t0) / CLOCKS_PER_SEC);
+
+  /* randomized SVD with q power iterations */
+  for (q = 0; q <= 2; ++q)
+    {
+      double err = 0.0;
+
+      t0 = clock ();
+      gsl_linalg_rsvd_decomp (A, q, r, Uk, Sk, Vk, w);
+
+      for (i = 0; i < k; ++i)
+        {
+          double si = gsl_vector_get (s0, i);
+          err = GSL_MAX (err, fabs (gsl_vector_get (Sk, i) - si) / si);
+        }
+
+      printf ("randomized SVD q=%zu: time = %.3f s, "
+              "max relative error in S[0..%zu] = %.2e\n",
+              q, (double) (clock () - t0) / CLOCKS_PER_SEC, k - 1, err);
+    }
+
+  gsl_matrix_free (A);
+  gsl_matrix_free (B);
+  gsl_matrix_free (V);
+  gsl_vector_free (S);
+  gsl_vector_free (s0);
+  gsl_vector_free (work);
+  gsl_matrix_free (Uk);
+  gsl_matrix_free (Vk);
+  gsl_vector_free (Sk);
+  gsl_linalg_rsvd_free (w);
+  gsl_rng_free (r);
+
+  return 0;
+}
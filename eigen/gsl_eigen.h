@@ -22,6 +22,7 @@
 
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_matrix.h>
+#include <gsl/gsl_linalg.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -39,6 +40,7 @@ typedef struct {
   size_t size;
   double * d;
   double * sd;
+  gsl_linalg_workspace * linalg_workspace_p;
 } gsl_eigen_symm_workspace;
 
 gsl_eigen_symm_workspace * gsl_eigen_symm_alloc (const size_t n);
@@ -51,12 +53,31 @@ typedef struct {
   double * sd;
   double * gc;
   double * gs;
+  gsl_linalg_workspace * linalg_workspace_p;
 } gsl_eigen_symmv_workspace;
 
 gsl_eigen_symmv_workspace * gsl_eigen_symmv_alloc (const size_t n);
 void gsl_eigen_symmv_free (gsl_eigen_symmv_workspace * w);
 int gsl_eigen_symmv (gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec, gsl_eigen_symmv_workspace * w);
 
+typedef struct {
+  size_t size;
+  double * d;
+  double * sd;
+  double * tau;
+  double * work;
+  size_t * iwork;
+  gsl_matrix * Q;
+  gsl_matrix * Z;
+  gsl_matrix * U;
+  gsl_matrix * Y;
+} gsl_eigen_symmv_dc_workspace;
+
+gsl_eigen_symmv_dc_workspace * gsl_eigen_symmv_dc_alloc (const size_t n);
+void gsl_eigen_symmv_dc_free (gsl_eigen_symmv_dc_workspace * w);
+int gsl_eigen_symmv_dc (gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec, gsl_eigen_symmv_dc_workspace * w);
+int gsl_eigen_symmv_dc_top (gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec, gsl_eigen_symmv_dc_workspace * w);
+
 typedef struct {
   size_t size;
   double * d;
@@ -106,6 +127,45 @@ int gsl_eigen_francis_Z (gsl_matrix * H, gsl_vector_complex * eval,
                          gsl_matrix * Z,
                          gsl_eigen_francis_workspace * w);
 
+typedef struct {
+  size_t size;           /* matrix size */
+  size_t max_iterations; /* max iterations */
+  size_t n_iter;         /* number of iterations */
+  size_t n_evals;        /* number of eigenvalues found so far */
+
+  int compute_t;         /* compute Schur form T = Z^t A Z */
+
+  gsl_matrix *H;         /* pointer to Hessenberg matrix */
+  gsl_matrix *Z;         /* pointer to Schur vector matrix */
+
+  size_t nsmax;          /* maximum number of shifts per sweep */
+  size_t nwmax;          /* maximum deflation window size */
+  size_t nmax;           /* size of window matrices */
+
+  gsl_matrix *Hw;        /* deflation window, nmax-by-nmax */
+  gsl_matrix *V;         /* window transformations, nmax-by-nmax */
+  gsl_matrix *Q;         /* Hessenberg reduction of window, nmax-by-nmax */
+  gsl_vector *tau;       /* Householder coefficients, length nmax */
+  gsl_vector *v;         /* Householder vector, length nmax */
+  gsl_vector_complex *eval; /* window eigenvalues, length nmax */
+  double *sr;            /* real parts of shifts, length nmax */
+  double *si;            /* imaginary parts of shifts, length nmax */
+  double *work;          /* workspace for matrix updates, size * nmax */
+  gsl_linalg_workspace *linalg_workspace_p; /* for Hessenberg reduction of window */
+
+  gsl_eigen_francis_workspace *francis_workspace_p;
+} gsl_eigen_multishift_workspace;
+
+gsl_eigen_multishift_workspace * gsl_eigen_multishift_alloc (const size_t n);
+void gsl_eigen_multishift_free (gsl_eigen_multishift_workspace * w);
+void gsl_eigen_multishift_T (const int compute_t,
+                             gsl_eigen_multishift_workspace * w);
+int gsl_eigen_multishift (gsl_matrix * H, gsl_vector_complex * eval,
+                          gsl_eigen_multishift_workspace * w);
+int gsl_eigen_multishift_Z (gsl_matrix * H, gsl_vector_complex * eval,
+                            gsl_matrix * Z,
+                            gsl_eigen_multishift_workspace * w);
+
 typedef struct {
   size_t size;                 /* size of matrices */
   gsl_vector *diag;            /* diagonal matrix elements from balancing */
@@ -115,6 +175,8 @@ typedef struct {
   size_t n_evals;              /* number of eigenvalues found */
 
   gsl_eigen_francis_workspace *francis_workspace_p;
+  gsl_eigen_multishift_workspace *multishift_workspace_p;
+  gsl_linalg_workspace *linalg_workspace_p; /* for Hessenberg reduction */
 } gsl_eigen_nonsymm_workspace;
 
 gsl_eigen_nonsymm_workspace * gsl_eigen_nonsymm_alloc (const size_t n);
@@ -0,0 +1,1116 @@
+/* eigen/multishift.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_eigen.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_vector_complex.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_complex.h>
+
+/*
+ * This module computes the eigenvalues, and optionally the Schur form
+ * and Schur vectors, of a real upper Hessenberg matrix with the small
+ * bulge multishift QR algorithm and aggressive early deflation
+ * (Braman, Byers and Mathias, SIAM J. Matrix Anal. Appl. 23, 2002).
+ * The organisation follows LAPACK (dlaqr0, dlaqr3 and dlaqr5).
+ *
+ * Each iteration on the active block first looks for converged
+ * eigenvalues in a window at its bottom: the window is reduced to
+ * Schur form with the double shift Francis method (francis.c), and
+ * the eigenvalues whose component in the "spike" coupling the window
+ * to the rest of the block is negligible are deflated. The eigenvalues
+ * of the window which did not deflate are then used as the shifts of
+ * a QR sweep, which chases a chain of ns/2 tightly packed 3-by-3
+ * bulges down the block.
+ *
+ * The reflectors of the sweep are applied within a window which moves
+ * down the diagonal with the chain, and accumulated in a small
+ * orthogonal matrix U. The rest of H, and Z, are updated with U by
+ * matrix multiplication once per window, so that nearly all of the
+ * operations of the sweep and of the deflation windows are done by
+ * Level 3 BLAS (and by as many threads as the BLAS uses, see
+ * gsl_cblas_set_num_threads).
+ *
+ * Blocks smaller than MULTISHIFT_NMIN, and matrices smaller than
+ * MULTISHIFT_NMIN, are handled by the Francis method alone.
+ */
+
+/* size of the smallest block on which multishift sweeps are done */
+#define MULTISHIFT_NMIN           75
+
+/* largest number of shifts per sweep */
+#define MULTISHIFT_NSMAX          256
+
+/* a sweep is skipped if more than MULTISHIFT_NIBBLE percent of the
+   deflation window deflated */
+#define MULTISHIFT_NIBBLE         14
+
+/* exceptional deflation window size and shifts after this many
+   iterations without deflation */
+#define MULTISHIFT_KEXNW          5
+#define MULTISHIFT_KEXSH          6
+
+/* exceptional shift coefficients - these values are from LAPACK DLAQR0 */
+#define MULTISHIFT_WILK1          (0.75)
+#define MULTISHIFT_WILK2          (-0.4375)
+
+static size_t multishift_nshifts (const size_t n);
+static int multishift_block (gsl_matrix * H, const size_t ilo, const size_t ihi,
+                             gsl_eigen_multishift_workspace * w);
+static size_t multishift_aed (gsl_matrix * H, const size_t ktop, const size_t kbot,
+                              const size_t nw, size_t * nshift,
+                              gsl_eigen_multishift_workspace * w);
+static size_t multishift_pair_shifts (const size_t ns, double * sr, double * si);
+static void multishift_sweep (gsl_matrix * H, const size_t ktop, const size_t kbot,
+                              const size_t nshift, const double * sr, const double * si,
+                              gsl_eigen_multishift_workspace * w);
+static void multishift_update (gsl_matrix * H, const size_t top, const size_t bot,
+                               const size_t ktop, const size_t kbot, const gsl_matrix * U,
+                               gsl_eigen_multishift_workspace * w);
+static void multishift_eigenvalues (const gsl_matrix * H, const size_t ilo,
+                                    const size_t ihi, gsl_vector_complex * eval);
+static void multishift_converged (const gsl_matrix * H, const size_t kbot,
+                                  gsl_vector_complex * eval,
+                                  gsl_eigen_multishift_workspace * w);
+
+/*
+gsl_eigen_multishift_alloc()
+
+Allocate a workspace for computing the Schur decomposition of
+n-by-n Hessenberg matrices. For n >= MULTISHIFT_NMIN, the size of
+this workspace is O(n * ns), where ns <= 256 is the number of
+shifts per sweep.
+
+Inputs: n - size of matrix
+
+Return: pointer to workspace
+*/
+
+gsl_eigen_multishift_workspace *
+gsl_eigen_multishift_alloc (const size_t n)
+{
+  gsl_eigen_multishift_workspace *w;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("matrix dimension must be positive integer",
+                      GSL_EINVAL);
+    }
+
+  w = (gsl_eigen_multishift_workspace *)
+      calloc (1, sizeof (gsl_eigen_multishift_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->size = n;
+  w->compute_t = 0;
+  w->H = NULL;
+  w->Z = NULL;
+
+  w->francis_workspace_p = gsl_eigen_francis_alloc ();
+
+  if (w->francis_workspace_p == 0)
+    {
+      gsl_eigen_multishift_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for francis workspace", GSL_ENOMEM);
+    }
+
+  if (n >= MULTISHIFT_NMIN)
+    {
+      /* largest number of shifts, deflation window, and sweep window */
+      size_t nsmax = GSL_MIN (multishift_nshifts (n), (n - 3) / 6);
+      size_t nwmax = GSL_MIN ((n <= 500) ? nsmax : 3 * nsmax / 2, (n - 1) / 3);
+      size_t kmax;
+
+      nsmax -= nsmax % 2;
+      kmax = 3 * nsmax + 4;
+
+      w->nsmax = nsmax;
+      w->nwmax = nwmax;
+      w->nmax = GSL_MAX (GSL_MAX (nwmax, kmax), MULTISHIFT_NMIN - 1);
+
+      w->Hw = gsl_matrix_alloc (w->nmax, w->nmax);
+      w->V = gsl_matrix_alloc (w->nmax, w->nmax);
+      w->Q = gsl_matrix_alloc (w->nmax, w->nmax);
+      w->tau = gsl_vector_alloc (w->nmax);
+      w->v = gsl_vector_alloc (w->nmax);
+      w->eval = gsl_vector_complex_alloc (w->nmax);
+      w->sr = malloc (w->nmax * sizeof (double));
+      w->si = malloc (w->nmax * sizeof (double));
+      w->work = malloc (n * w->nmax * sizeof (double));
+      w->linalg_workspace_p = gsl_linalg_workspace_alloc (gsl_linalg_hessenberg_decomp_wsize (w->nmax));
+
+      if (w->Hw == 0 || w->V == 0 || w->Q == 0 || w->tau == 0 || w->v == 0 ||
+          w->eval == 0 || w->sr == 0 || w->si == 0 || w->work == 0 ||
+          w->linalg_workspace_p == 0)
+        {
+          gsl_eigen_multishift_free (w);
+          GSL_ERROR_NULL ("failed to allocate space for multishift workspace", GSL_ENOMEM);
+        }
+    }
+
+  return (w);
+} /* gsl_eigen_multishift_alloc() */
+
+/*
+gsl_eigen_multishift_free()
+  Free multishift workspace w
+*/
+
+void
+gsl_eigen_multishift_free (gsl_eigen_multishift_workspace *w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->Hw)
+    gsl_matrix_free (w->Hw);
+
+  if (w->V)
+    gsl_matrix_free (w->V);
+
+  if (w->Q)
+    gsl_matrix_free (w->Q);
+
+  if (w->tau)
+    gsl_vector_free (w->tau);
+
+  if (w->v)
+    gsl_vector_free (w->v);
+
+  if (w->eval)
+    gsl_vector_complex_free (w->eval);
+
+  if (w->sr)
+    free (w->sr);
+
+  if (w->si)
+    free (w->si);
+
+  if (w->work)
+    free (w->work);
+
+  if (w->linalg_workspace_p)
+    gsl_linalg_workspace_free (w->linalg_workspace_p);
+
+  if (w->francis_workspace_p)
+    gsl_eigen_francis_free (w->francis_workspace_p);
+
+  free (w);
+} /* gsl_eigen_multishift_free() */
+
+/*
+gsl_eigen_multishift_T()
+  Called when we want to compute the Schur form T, or no longer
+compute the Schur form T
+
+Inputs: compute_t - 1 to compute T, 0 to not compute T
+        w         - multishift workspace
+*/
+
+void
+gsl_eigen_multishift_T (const int compute_t, gsl_eigen_multishift_workspace *w)
+{
+  w->compute_t = compute_t;
+}
+
+/*
+gsl_eigen_multishift()
+
+Solve the nonsymmetric eigenvalue problem
+
+H x = \lambda x
+
+for the eigenvalues \lambda of the upper Hessenberg matrix H, using
+the small bulge multishift QR algorithm with aggressive early
+deflation.
+
+Inputs: H    - upper hessenberg matrix
+        eval - where to store eigenvalues
+        w    - workspace
+
+Return: success or error - if error code is returned,
+        then the QR procedure did not converge in the
+        allowed number of iterations. In the event of non-
+        convergence, the number of eigenvalues found will
+        still be stored in the beginning of eval,
+
+Notes: 1) On output, the diagonal of H contains 1-by-1 or 2-by-2
+          blocks containing the eigenvalues, the 2-by-2 blocks being
+          in the standard form of gsl_eigen_francis(). If T is
+          desired, H will contain the full Schur form on output.
+
+       2) For matrices of size MULTISHIFT_NMIN or more, the elements
+          of H below the subdiagonal are set to zero. The eigenvalues
+          are stored in eval in the order of the diagonal blocks.
+*/
+
+int
+gsl_eigen_multishift (gsl_matrix * H, gsl_vector_complex * eval,
+                      gsl_eigen_multishift_workspace * w)
+{
+  const size_t N = H->size1;
+
+  if (N != H->size2)
+    {
+      GSL_ERROR ("matrix must be square to compute eigenvalues", GSL_ENOTSQR);
+    }
+  else if (eval->size != N)
+    {
+      GSL_ERROR ("eigenvalue vector must match matrix size", GSL_EBADLEN);
+    }
+  else if (N != w->size)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else if (N < MULTISHIFT_NMIN)
+    {
+      gsl_eigen_francis_workspace *fw = w->francis_workspace_p;
+      int s;
+
+      /* small matrix - use the double shift Francis method */
+      gsl_eigen_francis_T (w->compute_t, fw);
+
+      if (w->Z)
+        s = gsl_eigen_francis_Z (H, eval, w->Z, fw);
+      else
+        s = gsl_eigen_francis (H, eval, fw);
+
+      w->n_iter = fw->n_iter;
+      w->n_evals = fw->n_evals;
+
+      return s;
+    }
+  else
+    {
+      const size_t nsr = GSL_MIN (w->nsmax, multishift_nshifts (N));
+      const size_t nwr = GSL_MIN (w->nwmax, (N <= 500) ? nsr : 3 * nsr / 2);
+      size_t nw = nwr;     /* size of deflation window */
+      size_t ndfl = 1;     /* iterations since last deflation */
+      size_t kbot = N - 1; /* bottom of active block */
+      int done = 0;
+
+      w->H = H;
+      w->max_iterations = 30 * GSL_MAX (10, N);
+      w->n_iter = 0;
+      w->n_evals = 0;
+
+      gsl_linalg_hessenberg_set_zero (H);
+
+      while (!done)
+        {
+          size_t ktop, nh, nd, nshift, k;
+
+          if (w->n_iter++ >= w->max_iterations)
+            {
+              multishift_converged (H, kbot, eval, w);
+
+              GSL_ERROR ("maximum iterations reached without finding all eigenvalues",
+                         GSL_EMAXITER);
+            }
+
+          /* locate the active block, ending at kbot */
+          for (k = kbot; k > 0; --k)
+            {
+              const double sel = gsl_matrix_get (H, k, k - 1);
+
+              if (sel == 0.0)
+                break;
+
+              if (fabs (sel) < GSL_DBL_EPSILON *
+                  (fabs (gsl_matrix_get (H, k, k)) + fabs (gsl_matrix_get (H, k - 1, k - 1))))
+                {
+                  gsl_matrix_set (H, k, k - 1, 0.0);
+                  break;
+                }
+            }
+
+          ktop = k;
+          nh = kbot - ktop + 1;
+
+          if (nh < MULTISHIFT_NMIN)
+            {
+              int s = multishift_block (H, ktop, kbot, w);
+
+              if (s)
+                {
+                  /* the error was reported by the Francis solver */
+                  multishift_converged (H, kbot, eval, w);
+                  return s;
+                }
+
+              ndfl = 1;
+              if (ktop == 0)
+                done = 1;
+              else
+                kbot = ktop - 1;
+
+              continue;
+            }
+
+          /* aggressive early deflation, with a larger window if there
+             was no deflation for a while */
+          if (ndfl < MULTISHIFT_KEXNW)
+            nw = GSL_MIN (nh, nwr);
+          else
+            nw = GSL_MIN (GSL_MIN (nh, w->nwmax), 2 * nw);
+
+          nd = multishift_aed (H, ktop, kbot, nw, &nshift, w);
+
+          if (nd > 0)
+            ndfl = 1;
+          else
+            ++ndfl;
+
+          if (nd > kbot - ktop)
+            {
+              /* the whole block deflated */
+              if (ktop == 0)
+                done = 1;
+              else
+                kbot = ktop - 1;
+
+              continue;
+            }
+
+          kbot -= nd;
+
+          /* skip the sweep if the deflation window was productive; the
+             next window is then tried right away */
+          if (nd == 0 || (100 * nd <= nw * MULTISHIFT_NIBBLE &&
+                          kbot - ktop + 1 > MULTISHIFT_NMIN))
+            {
+              size_t ns = GSL_MIN (nsr, GSL_MAX (2, kbot - ktop));
+              double *sr = w->sr, *si = w->si;
+
+              ns -= ns % 2;
+
+              if (ndfl % MULTISHIFT_KEXSH == 0)
+                {
+                  /* exceptional shifts */
+                  size_t i;
+
+                  for (i = 0; i + 1 < ns; i += 2)
+                    {
+                      const size_t j = kbot - i;
+                      double ss = fabs (gsl_matrix_get (H, j, j - 1));
+
+                      if (j >= ktop + 2)
+                        ss += fabs (gsl_matrix_get (H, j - 1, j - 2));
+
+                      sr[i] = sr[i + 1] = gsl_matrix_get (H, j, j) + MULTISHIFT_WILK1 * ss;
+                      si[i] = ss * sqrt (-MULTISHIFT_WILK2);
+                      si[i + 1] = -si[i];
+                    }
+                }
+              else if (nshift > ns / 2)
+                {
+                  /* use the eigenvalues of the deflation window which did
+                     not deflate, those closest to the bottom first */
+                  if (nshift > ns)
+                    {
+                      sr += nshift - ns;
+                      si += nshift - ns;
+                    }
+                  else
+                    {
+                      ns = nshift;
+                    }
+                }
+              else
+                {
+                  /* too few shifts from the window - use the eigenvalues
+                     of the trailing ns-by-ns submatrix */
+                  gsl_matrix_view Hs = gsl_matrix_submatrix (w->Hw, 0, 0, ns, ns);
+                  gsl_matrix_view Hb = gsl_matrix_submatrix (H, kbot - ns + 1, kbot - ns + 1, ns, ns);
+                  gsl_vector_complex_view ev = gsl_vector_complex_subvector (w->eval, 0, ns);
+                  size_t i;
+                  int s;
+
+                  gsl_matrix_memcpy (&Hs.matrix, &Hb.matrix);
+                  gsl_eigen_francis_T (0, w->francis_workspace_p);
+                  s = gsl_eigen_francis (&Hs.matrix, &ev.vector, w->francis_workspace_p);
+                  if (s)
+                    {
+                      multishift_converged (H, kbot, eval, w);
+                      return s;
+                    }
+
+                  for (i = 0; i < ns; ++i)
+                    {
+                      gsl_complex z = gsl_vector_complex_get (&ev.vector, i);
+                      sr[i] = GSL_REAL (z);
+                      si[i] = GSL_IMAG (z);
+                    }
+                }
+
+              ns = multishift_pair_shifts (ns, sr, si);
+
+              if (ns == 2 && si[0] == 0.0)
+                {
+                  /* two real shifts: use the one closest to H(kbot,kbot) twice */
+                  const double hnn = gsl_matrix_get (H, kbot, kbot);
+
+                  if (fabs (sr[0] - hnn) <= fabs (sr[1] - hnn))
+                    sr[1] = sr[0];
+                  else
+                    sr[0] = sr[1];
+                }
+
+              if (ns >= 2)
+                multishift_sweep (H, ktop, kbot, ns, sr, si, w);
+            }
+        }
+
+      multishift_eigenvalues (H, 0, N - 1, eval);
+      w->n_evals = N;
+      w->H = NULL;
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_eigen_multishift() */
+
+/*
+gsl_eigen_multishift_Z()
+
+Solve the nonsymmetric eigenvalue problem for a Hessenberg
+matrix
+
+H x = \lambda x
+
+for the eigenvalues \lambda, and accumulate the transformations
+into Z, as in gsl_eigen_francis_Z().
+
+Inputs: H    - upper hessenberg matrix
+        eval - where to store eigenvalues
+        Z    - where to store Schur vectors
+        w    - workspace
+
+Notes: 1) If T is computed, it is stored in H on output. Otherwise,
+          the diagonal of H will contain 1-by-1 and 2-by-2 blocks
+          containing the eigenvalues.
+
+       2) The matrix Z must be initialized to the Hessenberg
+          similarity matrix U. Or if you want the eigenvalues
+          of H, initialize Z to the identity matrix.
+*/
+
+int
+gsl_eigen_multishift_Z (gsl_matrix * H, gsl_vector_complex * eval,
+                        gsl_matrix * Z, gsl_eigen_multishift_workspace * w)
+{
+  int s;
+
+  if ((Z->size1 != Z->size2) || (Z->size1 != H->size1))
+    {
+      GSL_ERROR ("Z matrix has wrong dimensions", GSL_EBADLEN);
+    }
+
+  /* set internal Z pointer so we know to accumulate transformations */
+  w->Z = Z;
+
+  s = gsl_eigen_multishift (H, eval, w);
+
+  w->Z = NULL;
+
+  return s;
+} /* gsl_eigen_multishift_Z() */
+
+/********************************************
+ *           INTERNAL ROUTINES              *
+ ********************************************/
+
+/*
+multishift_nshifts()
+  Number of shifts per sweep for a matrix of size n (LAPACK IPARMQ)
+*/
+
+static size_t
+multishift_nshifts (const size_t n)
+{
+  size_t ns;
+
+  if (n < 30)
+    ns = 2;
+  else if (n < 60)
+    ns = 4;
+  else if (n < 150)
+    ns = 10;
+  else if (n < 590)
+    ns = GSL_MAX (10, (size_t) (n / floor (log ((double) n) / M_LN2 + 0.5)));
+  else if (n < 3000)
+    ns = 64;
+  else if (n < 6000)
+    ns = 128;
+  else
+    ns = MULTISHIFT_NSMAX;
+
+  return GSL_MAX (2, ns - ns % 2);
+}
+
+/*
+multishift_block()
+  Compute the Schur form of the diagonal block H(ilo:ihi,ilo:ihi),
+which is smaller than MULTISHIFT_NMIN, with the Francis method applied
+to a copy, and apply its Schur vectors to the rest of H and to Z
+*/
+
+static int
+multishift_block (gsl_matrix * H, const size_t ilo, const size_t ihi,
+                  gsl_eigen_multishift_workspace * w)
+{
+  const size_t nb = ihi - ilo + 1;
+  gsl_matrix_view Hb = gsl_matrix_submatrix (H, ilo, ilo, nb, nb);
+  gsl_matrix_view T = gsl_matrix_submatrix (w->Hw, 0, 0, nb, nb);
+  gsl_matrix_view V = gsl_matrix_submatrix (w->V, 0, 0, nb, nb);
+  gsl_vector_complex_view ev = gsl_vector_complex_subvector (w->eval, 0, nb);
+  int s;
+
+  if (nb == 1)
+    return GSL_SUCCESS;
+
+  gsl_matrix_memcpy (&T.matrix, &Hb.matrix);
+  gsl_matrix_set_identity (&V.matrix);
+
+  gsl_eigen_francis_T (1, w->francis_workspace_p);
+  s = gsl_eigen_francis_Z (&T.matrix, &ev.vector, &V.matrix, w->francis_workspace_p);
+  if (s)
+    return s;
+
+  gsl_linalg_hessenberg_set_zero (&T.matrix);
+  gsl_matrix_memcpy (&Hb.matrix, &T.matrix);
+
+  multishift_update (H, ilo, ihi, ilo, ihi, &V.matrix, w);
+
+  return GSL_SUCCESS;
+}
+
+/*
+multishift_aed()
+  Aggressive early deflation on the nw-by-nw window at the bottom of
+the active block H(ktop:kbot,ktop:kbot) (LAPACK dlaqr3)
+
+Inputs: H      - Hessenberg matrix
+        ktop   - top of active block
+        kbot   - bottom of active block
+        nw     - size of deflation window
+        nshift - (output) number of eigenvalues of the window which
+                 did not deflate
+        w      - workspace
+
+Return: number of deflated eigenvalues. The eigenvalues which did not
+deflate are stored in w->sr and w->si, in the order of the diagonal.
+
+Notes: 1) The window H(kwtop:kbot,kwtop:kbot) is reduced to Schur form
+          T = V^T H V. Its coupling to the rest of the block, the
+          subdiagonal element s = H(kwtop,kwtop-1), then becomes the
+          spike s V(0,:)^T in column kwtop-1. Working up from the
+          bottom of T, the eigenvalues whose spike elements are
+          negligible are deflated. Unlike LAPACK, the eigenvalues
+          which do not deflate are not moved out of the way, and the
+          search stops at the first of them.
+
+       2) If any eigenvalue deflated, the part of the spike which did
+          not is reduced to a multiple of e_0 with a reflector, the
+          corresponding part of T is returned to Hessenberg form, and
+          the window transformation is applied to H and Z.
+*/
+
+static size_t
+multishift_aed (gsl_matrix * H, const size_t ktop, const size_t kbot,
+                const size_t nw, size_t * nshift,
+                gsl_eigen_multishift_workspace * w)
+{
+  const size_t N = H->size1;
+  const size_t jw = GSL_MIN (nw, kbot - ktop + 1);
+  const size_t kwtop = kbot - jw + 1;
+  const double ulp = GSL_DBL_EPSILON;
+  const double smlnum = GSL_DBL_MIN * ((double) N / ulp);
+  const double s = (kwtop > ktop) ? gsl_matrix_get (H, kwtop, kwtop - 1) : 0.0;
+  gsl_matrix_view Hwin = gsl_matrix_submatrix (H, kwtop, kwtop, jw, jw);
+  gsl_matrix_view T = gsl_matrix_submatrix (w->Hw, 0, 0, jw, jw);
+  gsl_matrix_view V = gsl_matrix_submatrix (w->V, 0, 0, jw, jw);
+  gsl_vector_complex_view ev = gsl_vector_complex_subvector (w->eval, 0, jw);
+  size_t ns = jw, i;
+  double spike0;
+
+  *nshift = 0;
+
+  /* Schur form of the window */
+  gsl_matrix_memcpy (&T.matrix, &Hwin.matrix);
+  gsl_matrix_set_identity (&V.matrix);
+
+  gsl_eigen_francis_T (1, w->francis_workspace_p);
+  if (gsl_eigen_francis_Z (&T.matrix, &ev.vector, &V.matrix, w->francis_workspace_p))
+    return 0;
+
+  gsl_linalg_hessenberg_set_zero (&T.matrix);
+
+  /* deflation check, from the bottom of the window */
+  while (ns > 0)
+    {
+      const double tnn = gsl_matrix_get (&T.matrix, ns - 1, ns - 1);
+      double foo;
+
+      if (ns == 1 || gsl_matrix_get (&T.matrix, ns - 1, ns - 2) == 0.0)
+        {
+          /* 1-by-1 block */
+          foo = fabs (tnn);
+          if (foo == 0.0)
+            foo = fabs (s);
+
+          if (fabs (s * gsl_matrix_get (&V.matrix, 0, ns - 1)) <= GSL_MAX (smlnum, ulp * foo))
+            ns -= 1;
+          else
+            break;
+        }
+      else
+        {
+          /* 2-by-2 block */
+          foo = fabs (tnn) +
+                sqrt (fabs (gsl_matrix_get (&T.matrix, ns - 1, ns - 2))) *
+                sqrt (fabs (gsl_matrix_get (&T.matrix, ns - 2, ns - 1)));
+          if (foo == 0.0)
+            foo = fabs (s);
+
+          if (GSL_MAX (fabs (s * gsl_matrix_get (&V.matrix, 0, ns - 1)),
+                       fabs (s * gsl_matrix_get (&V.matrix, 0, ns - 2))) <= GSL_MAX (smlnum, ulp * foo))
+            ns -= 2;
+          else
+            break;
+        }
+    }
+
+  /* the eigenvalues which did not deflate are the shifts */
+  if (ns > 0)
+    {
+      gsl_vector_complex_view e = gsl_vector_complex_subvector (w->eval, 0, ns);
+      gsl_matrix_view T00 = gsl_matrix_submatrix (&T.matrix, 0, 0, ns, ns);
+
+      multishift_eigenvalues (&T00.matrix, 0, ns - 1, &e.vector);
+
+      for (i = 0; i < ns; ++i)
+        {
+          gsl_complex z = gsl_vector_complex_get (&e.vector, i);
+          w->sr[i] = GSL_REAL (z);
+          w->si[i] = GSL_IMAG (z);
+        }
+    }
+
+  *nshift = ns;
+
+  if (ns == jw)
+    {
+      /* nothing deflated - leave H unchanged */
+      return 0;
+    }
+
+  spike0 = (ns > 0) ? s * gsl_matrix_get (&V.matrix, 0, 0) : 0.0;
+
+  if (ns > 1 && s != 0.0)
+    {
+      gsl_vector_view x = gsl_vector_subvector (w->v, 0, ns);
+      gsl_matrix_view T0 = gsl_matrix_submatrix (&T.matrix, 0, 0, ns, jw);
+      gsl_matrix_view T00 = gsl_matrix_submatrix (&T.matrix, 0, 0, ns, ns);
+      gsl_matrix_view V0 = gsl_matrix_submatrix (&V.matrix, 0, 0, jw, ns);
+      double tau_s;
+
+      /* reduce the undeflated part of the spike, s V(0,0:ns-1)^T, to
+         a multiple of e_0 */
+      for (i = 0; i < ns; ++i)
+        gsl_vector_set (&x.vector, i, s * gsl_matrix_get (&V.matrix, 0, i));
+
+      tau_s = gsl_linalg_householder_transform (&x.vector);
+      spike0 = gsl_vector_get (&x.vector, 0);
+
+      gsl_linalg_householder_hm (tau_s, &x.vector, &T0.matrix);
+      gsl_linalg_householder_mh (tau_s, &x.vector, &T00.matrix);
+      gsl_linalg_householder_mh (tau_s, &x.vector, &V0.matrix);
+
+      if (ns > 2)
+        {
+          /* return T(0:ns-1,0:ns-1) to Hessenberg form */
+          gsl_vector_view tau = gsl_vector_subvector (w->tau, 0, ns);
+          gsl_matrix_view Qm = gsl_matrix_submatrix (w->Q, 0, 0, ns, ns);
+          gsl_matrix_view Wv;
+
+          gsl_linalg_hessenberg_decomp_ws (&T00.matrix, &tau.vector, w->linalg_workspace_p);
+          gsl_linalg_hessenberg_unpack (&T00.matrix, &tau.vector, &Qm.matrix);
+          gsl_linalg_hessenberg_set_zero (&T00.matrix);
+
+          if (jw > ns)
+            {
+              gsl_matrix_view T01 = gsl_matrix_submatrix (&T.matrix, 0, ns, ns, jw - ns);
+
+              Wv = gsl_matrix_view_array (w->work, ns, jw - ns);
+              gsl_blas_dgemm (CblasTrans, CblasNoTrans, 1.0, &Qm.matrix, &T01.matrix, 0.0, &Wv.matrix);
+              gsl_matrix_memcpy (&T01.matrix, &Wv.matrix);
+            }
+
+          Wv = gsl_matrix_view_array (w->work, jw, ns);
+          gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &V0.matrix, &Qm.matrix, 0.0, &Wv.matrix);
+          gsl_matrix_memcpy (&V0.matrix, &Wv.matrix);
+        }
+    }
+
+  /* copy the window back and apply its transformation to the rest of H and to Z */
+  gsl_matrix_memcpy (&Hwin.matrix, &T.matrix);
+
+  if (kwtop > ktop)
+    gsl_matrix_set (H, kwtop, kwtop - 1, spike0);
+
+  multishift_update (H, kwtop, kbot, ktop, kbot, &V.matrix, w);
+
+  return jw - ns;
+}
+
+/*
+multishift_pair_shifts()
+  Arrange the ns shifts in (sr,si) in pairs which are either complex
+conjugate or both real, as required by the double shift bulges.
+Complex conjugate pairs are assumed to be adjacent. The shifts are
+first sorted in decreasing order of magnitude, so that the smallest
+shifts are used by the first bulges (LAPACK dlaqr0).
+
+Return: number of shifts, which is even
+*/
+
+static size_t
+multishift_pair_shifts (const size_t ns, double * sr, double * si)
+{
+  double pr[MULTISHIFT_NSMAX], pi[MULTISHIFT_NSMAX];
+  double real_pending = 0.0;
+  int have_real = 0;
+  size_t i, k = 0;
+
+  /* sort by decreasing |sr| + |si|, keeping conjugate pairs together */
+  for (i = 1; i < ns; ++i)
+    {
+      const double xr = sr[i], xi = si[i];
+      size_t j = i;
+
+      while (j > 0 && fabs (sr[j - 1]) + fabs (si[j - 1]) < fabs (xr) + fabs (xi))
+        {
+          sr[j] = sr[j - 1];
+          si[j] = si[j - 1];
+          --j;
+        }
+
+      sr[j] = xr;
+      si[j] = xi;
+    }
+
+  for (i = 0; i < ns && k + 1 < MULTISHIFT_NSMAX; ++i)
+    {
+      if (si[i] == 0.0)
+        {
+          if (have_real)
+            {
+              pr[k] = real_pending;
+              pi[k++] = 0.0;
+              pr[k] = sr[i];
+              pi[k++] = 0.0;
+              have_real = 0;
+            }
+          else
+            {
+              real_pending = sr[i];
+              have_real = 1;
+            }
+        }
+      else if (i + 1 < ns && si[i + 1] == -si[i])
+        {
+          pr[k] = sr[i];
+          pi[k++] = si[i];
+          pr[k] = sr[i + 1];
+          pi[k++] = si[i + 1];
+          ++i;
+        }
+    }
+
+  for (i = 0; i < k; ++i)
+    {
+      sr[i] = pr[i];
+      si[i] = pi[i];
+    }
+
+  return k;
+}
+
+/*
+multishift_sweep()
+  Perform a small bulge multishift QR sweep on the active block
+H(ktop:kbot,ktop:kbot) (LAPACK dlaqr5)
+
+Inputs: H      - Hessenberg matrix
+        ktop   - top of active block
+        kbot   - bottom of active block
+        nshift - number of shifts (even)
+        sr     - real parts of shifts
+        si     - imaginary parts of shifts, in conjugate pairs
+        w      - workspace
+
+Notes: 1) Bulge m = 0, 1, ..., nshift/2 - 1 is introduced at step 3m
+          with the shifts (sr,si)[nshift - 2m - 2 : nshift - 2m - 1], and
+          at step t the reflector of bulge m acts on rows c + 1 to c + 3,
+          where c = ktop - 1 + t - 3m. At each step the bulges are moved
+          from the bottom of the chain up, so that a bulge only moves
+          into rows which the bulge below it has just left.
+
+       2) The steps are done in rounds. The reflectors of a round act
+          on the rows and columns r0:r1; they are applied to
+          H(r0:r1,r0:r1) as they are computed, and accumulated into U,
+          which is then applied to the rest of H and to Z by
+          multishift_update().
+*/
+
+static void
+multishift_sweep (gsl_matrix * H, const size_t ktop, const size_t kbot,
+                  const size_t nshift, const double * sr, const double * si,
+                  gsl_eigen_multishift_workspace * w)
+{
+  const size_t nbulge = nshift / 2;
+  const size_t nstep = GSL_MAX (3 * nbulge, 1);
+  const size_t last = 3 * (nbulge - 1) + (kbot - ktop - 1); /* last step */
+  double dat[3];
+  gsl_vector_view v3 = gsl_vector_view_array (dat, 3);
+  gsl_vector_view v2 = gsl_vector_view_array (dat, 2);
+  size_t t0;
+
+  for (t0 = 0; t0 <= last; t0 += nstep)
+    {
+      const size_t t1 = GSL_MIN (t0 + nstep, last + 1);
+      size_t r0 = kbot, r1 = ktop, t, m;
+      gsl_matrix_view U;
+
+      /* rows and columns touched by the reflectors of this round */
+      for (m = 0; m < nbulge; ++m)
+        {
+          /* steps of this round during which bulge m is active */
+          const size_t first = GSL_MAX (t0, 3 * m);
+          const size_t lastm = GSL_MIN (t1 - 1, 3 * m + kbot - ktop - 1);
+
+          if (first > lastm)
+            continue;
+
+          r0 = GSL_MIN (r0, ktop + first - 3 * m);
+          r1 = GSL_MAX (r1, GSL_MIN (kbot, ktop + lastm - 3 * m + 3));
+        }
+
+      if (r0 > r1)
+        continue;
+
+      U = gsl_matrix_submatrix (w->V, 0, 0, r1 - r0 + 1, r1 - r0 + 1);
+      gsl_matrix_set_identity (&U.matrix);
+
+      for (t = t0; t < t1; ++t)
+        {
+          for (m = 0; m < nbulge && 3 * m <= t; ++m)
+            {
+              const size_t c1 = ktop + t - 3 * m; /* first row of reflector, c + 1 */
+              const size_t len = (c1 + 2 <= kbot) ? 3 : 2;
+              gsl_vector * v = (len == 3) ? &v3.vector : &v2.vector;
+              gsl_matrix_view M;
+              double tau_i;
+
+              if (c1 + 1 > kbot)
+                continue; /* bulge m has left the block */
+
+              if (c1 == ktop)
+                {
+                  /* introduce bulge m from the first column of
+                     (H - s1 I) (H - s2 I) */
+                  const size_t p = nshift - 2 * m - 2;
+                  const double h11 = gsl_matrix_get (H, ktop, ktop);
+                  const double h21 = gsl_matrix_get (H, ktop + 1, ktop);
+                  const double h12 = gsl_matrix_get (H, ktop, ktop + 1);
+                  const double h22 = gsl_matrix_get (H, ktop + 1, ktop + 1);
+                  const double h32 = gsl_matrix_get (H, ktop + 2, ktop + 1);
+                  const double scale = fabs (h11 - sr[p + 1]) + fabs (si[p + 1]) + fabs (h21);
+
+                  if (scale == 0.0)
+                    continue;
+
+                  {
+                    const double h21s = h21 / scale;
+
+                    dat[0] = h21s * h12 + (h11 - sr[p]) * ((h11 - sr[p + 1]) / scale) -
+                             si[p] * (si[p + 1] / scale);
+                    dat[1] = h21s * (h11 + h22 - sr[p] - sr[p + 1]);
+                    dat[2] = h21s * h32;
+                  }
+
+                  tau_i = gsl_linalg_householder_transform (&v3.vector);
+                  v = &v3.vector;
+                }
+              else
+                {
+                  /* chase bulge m down from column c1 - 1 */
+                  const size_t c = c1 - 1;
+
+                  dat[0] = gsl_matrix_get (H, c1, c);
+                  dat[1] = gsl_matrix_get (H, c1 + 1, c);
+                  if (len == 3)
+                    dat[2] = gsl_matrix_get (H, c1 + 2, c);
+
+                  tau_i = gsl_linalg_householder_transform (v);
+
+                  gsl_matrix_set (H, c1, c, dat[0]);
+                  gsl_matrix_set (H, c1 + 1, c, 0.0);
+                  if (len == 3)
+                    gsl_matrix_set (H, c1 + 2, c, 0.0);
+                }
+
+              if (tau_i == 0.0)
+                continue;
+
+              /* H(c1:c1+len-1,c1:r1) := P H(c1:c1+len-1,c1:r1) */
+              M = gsl_matrix_submatrix (H, c1, c1, len, r1 - c1 + 1);
+              gsl_linalg_householder_hm (tau_i, v, &M.matrix);
+
+              /* H(r0:c1+len,c1:c1+len-1) := H(r0:c1+len,c1:c1+len-1) P */
+              M = gsl_matrix_submatrix (H, r0, c1, GSL_MIN (c1 + len, kbot) - r0 + 1, len);
+              gsl_linalg_householder_mh (tau_i, v, &M.matrix);
+
+              /* U := U P */
+              M = gsl_matrix_submatrix (&U.matrix, 0, c1 - r0, r1 - r0 + 1, len);
+              gsl_linalg_householder_mh (tau_i, v, &M.matrix);
+            }
+        }
+
+      multishift_update (H, r0, r1, ktop, kbot, &U.matrix, w);
+    }
+}
+
+/*
+multishift_update()
+  Apply the orthogonal transformation U of the rows and columns
+top:bot of H, which has already been applied to H(top:bot,top:bot),
+to the rest of H and to Z. If the Schur form is not wanted, only the
+active block ktop:kbot of H is updated.
+*/
+
+static void
+multishift_update (gsl_matrix * H, const size_t top, const size_t bot,
+                   const size_t ktop, const size_t kbot, const gsl_matrix * U,
+                   gsl_eigen_multishift_workspace * w)
+{
+  const size_t N = H->size1;
+  const size_t k = bot - top + 1;
+  const size_t rlo = w->compute_t ? 0 : ktop;  /* first row to update */
+  const size_t chi = w->compute_t ? N : kbot + 1; /* last column to update + 1 */
+  gsl_matrix_view M, Wv;
+
+  if (top > rlo)
+    {
+      /* H(rlo:top-1,top:bot) := H(rlo:top-1,top:bot) U */
+      M = gsl_matrix_submatrix (H, rlo, top, top - rlo, k);
+      Wv = gsl_matrix_view_array (w->work, top - rlo, k);
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &M.matrix, U, 0.0, &Wv.matrix);
+      gsl_matrix_memcpy (&M.matrix, &Wv.matrix);
+    }
+
+  if (chi > bot + 1)
+    {
+      /* H(top:bot,bot+1:chi-1) := U^T H(top:bot,bot+1:chi-1) */
+      M = gsl_matrix_submatrix (H, top, bot + 1, k, chi - bot - 1);
+      Wv = gsl_matrix_view_array (w->work, k, chi - bot - 1);
+      gsl_blas_dgemm (CblasTrans, CblasNoTrans, 1.0, U, &M.matrix, 0.0, &Wv.matrix);
+      gsl_matrix_memcpy (&M.matrix, &Wv.matrix);
+    }
+
+  if (w->Z)
+    {
+      /* Z(:,top:bot) := Z(:,top:bot) U */
+      M = gsl_matrix_submatrix (w->Z, 0, top, N, k);
+      Wv = gsl_matrix_view_array (w->work, N, k);
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &M.matrix, U, 0.0, &Wv.matrix);
+      gsl_matrix_memcpy (&M.matrix, &Wv.matrix);
+    }
+}
+
+/*
+multishift_eigenvalues()
+  Store the eigenvalues of the diagonal blocks of the quasi triangular
+matrix H(ilo:ihi,ilo:ihi), whose 2-by-2 blocks are in standard form,
+in eval, in the order of the diagonal
+*/
+
+static void
+multishift_eigenvalues (const gsl_matrix * H, const size_t ilo,
+                        const size_t ihi, gsl_vector_complex * eval)
+{
+  size_t i = ilo, k = 0;
+
+  while (i <= ihi)
+    {
+      gsl_complex z;
+
+      if (i < ihi && gsl_matrix_get (H, i + 1, i) != 0.0)
+        {
+          const double re = gsl_matrix_get (H, i, i);
+          const double im = sqrt (fabs (gsl_matrix_get (H, i, i + 1))) *
+                            sqrt (fabs (gsl_matrix_get (H, i + 1, i)));
+
+          GSL_SET_COMPLEX (&z, re, im);
+          gsl_vector_complex_set (eval, k++, z);
+          GSL_SET_COMPLEX (&z, re, -im);
+          gsl_vector_complex_set (eval, k++, z);
+          i += 2;
+        }
+      else
+        {
+          GSL_SET_COMPLEX (&z, gsl_matrix_get (H, i, i), 0.0);
+          gsl_vector_complex_set (eval, k++, z);
+          i += 1;
+        }
+    }
+}
+
+/*
+multishift_converged()
+  Store the eigenvalues which converged before a failure, those of
+H(kbot+1:N-1,kbot+1:N-1), in the beginning of eval
+*/
+
+static void
+multishift_converged (const gsl_matrix * H, const size_t kbot,
+                      gsl_vector_complex * eval,
+                      gsl_eigen_multishift_workspace * w)
+{
+  const size_t N = H->size1;
+
+  w->n_evals = N - kbot - 1;
+
+  if (w->n_evals > 0)
+    {
+      gsl_vector_complex_view v = gsl_vector_complex_subvector (eval, 0, w->n_evals);
+      multishift_eigenvalues (H, kbot + 1, N - 1, &v.vector);
+    }
+
+  w->H = NULL;
+}
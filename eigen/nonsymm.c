@@ -30,20 +30,24 @@
 
 /*
  * This module computes the eigenvalues of a real nonsymmetric
- * matrix, using the double shift Francis method.
+ * matrix, using the double shift Francis method for small
+ * matrices and the multishift QR algorithm with aggressive
+ * early deflation for large ones.
  *
- * See the references in francis.c.
+ * See the references in francis.c and multishift.c.
  *
  * This module gets the matrix ready by balancing it and
  * reducing it to Hessenberg form before passing it to the
- * francis module.
+ * multishift module.
  */
 
 /*
 gsl_eigen_nonsymm_alloc()
 
 Allocate a workspace for solving the nonsymmetric eigenvalue problem.
-The size of this workspace is O(2n)
+The size of this workspace is O(2n) for small matrices, and O(n * ns)
+for large matrices, where ns <= 256 is the number of shifts per QR
+sweep (see multishift.c)
 
 Inputs: n - size of matrix
 
@@ -89,14 +93,25 @@ gsl_eigen_nonsymm_alloc(const size_t n)
       GSL_ERROR_NULL ("failed to allocate space for hessenberg coefficients", GSL_ENOMEM);
     }
 
-  w->francis_workspace_p = gsl_eigen_francis_alloc();
+  w->linalg_workspace_p = gsl_linalg_workspace_alloc(gsl_linalg_hessenberg_decomp_wsize(n));
 
-  if (w->francis_workspace_p == 0)
+  if (w->linalg_workspace_p == 0)
     {
       gsl_eigen_nonsymm_free(w);
-      GSL_ERROR_NULL ("failed to allocate space for francis workspace", GSL_ENOMEM);
+      GSL_ERROR_NULL ("failed to allocate space for hessenberg reduction", GSL_ENOMEM);
     }
 
+  w->multishift_workspace_p = gsl_eigen_multishift_alloc(n);
+
+  if (w->multishift_workspace_p == 0)
+    {
+      gsl_eigen_nonsymm_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for multishift workspace", GSL_ENOMEM);
+    }
+
+  /* the francis workspace is owned by the multishift workspace */
+  w->francis_workspace_p = w->multishift_workspace_p->francis_workspace_p;
+
   return (w);
 } /* gsl_eigen_nonsymm_alloc() */
 
@@ -116,8 +131,11 @@ gsl_eigen_nonsymm_free (gsl_eigen_nonsymm_workspace * w)
   if (w->diag)
     gsl_vector_free(w->diag);
 
-  if (w->francis_workspace_p)
-    gsl_eigen_francis_free(w->francis_workspace_p);
+  if (w->multishift_workspace_p)
+    gsl_eigen_multishift_free(w->multishift_workspace_p);
+
+  if (w->linalg_workspace_p)
+    gsl_linalg_workspace_free(w->linalg_workspace_p);
 
   free(w);
 } /* gsl_eigen_nonsymm_free() */
@@ -136,7 +154,7 @@ void
 gsl_eigen_nonsymm_params (const int compute_t, const int balance,
                           gsl_eigen_nonsymm_workspace *w)
 {
-  gsl_eigen_francis_T(compute_t, w->francis_workspace_p);
+  gsl_eigen_multishift_T(compute_t, w->multishift_workspace_p);
   w->do_balance = balance;
 } /* gsl_eigen_nonsymm_params() */
 
@@ -147,7 +165,8 @@ Solve the nonsymmetric eigenvalue problem
 
 A x = \lambda x
 
-for the eigenvalues \lambda using the Francis method.
+for the eigenvalues \lambda using the Francis method, or for
+large matrices the multishift QR algorithm.
 
 Here we compute the real Schur form
 
@@ -195,7 +214,7 @@ gsl_eigen_nonsymm (gsl_matrix * A, gsl_vector_complex * eval,
         }
 
       /* compute the Hessenberg reduction of A */
-      gsl_linalg_hessenberg_decomp(A, w->tau);
+      gsl_linalg_hessenberg_decomp_ws(A, w->tau, w->linalg_workspace_p);
 
       if (w->Z)
         {
@@ -208,7 +227,7 @@ gsl_eigen_nonsymm (gsl_matrix * A, gsl_vector_complex * eval,
           gsl_linalg_hessenberg_unpack(A, w->tau, w->Z);
 
           /* find the eigenvalues and Schur vectors */
-          s = gsl_eigen_francis_Z(A, eval, w->Z, w->francis_workspace_p);
+          s = gsl_eigen_multishift_Z(A, eval, w->Z, w->multishift_workspace_p);
 
           if (w->do_balance)
             {
@@ -223,10 +242,10 @@ gsl_eigen_nonsymm (gsl_matrix * A, gsl_vector_complex * eval,
       else
         {
           /* find the eigenvalues only */
-          s = gsl_eigen_francis(A, eval, w->francis_workspace_p);
+          s = gsl_eigen_multishift(A, eval, w->multishift_workspace_p);
         }
 
-      w->n_evals = w->francis_workspace_p->n_evals;
+      w->n_evals = w->multishift_workspace_p->n_evals;
 
       return s;
     }
@@ -67,6 +67,13 @@ gsl_eigen_symm_alloc (const size_t n)
       GSL_ERROR_NULL ("failed to allocate space for subdiagonal", GSL_ENOMEM);
     }
 
+  w->linalg_workspace_p = gsl_linalg_workspace_alloc (gsl_linalg_symmtd_decomp_wsize (n));
+
+  if (w->linalg_workspace_p == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for tridiagonal reduction", GSL_ENOMEM);
+    }
+
   w->size = n;
 
   return w;
@@ -76,6 +83,7 @@ void
 gsl_eigen_symm_free (gsl_eigen_symm_workspace * w)
 {
   RETURN_IF_NULL (w);
+  gsl_linalg_workspace_free (w->linalg_workspace_p);
   free (w->sd);
   free (w->d);
   free (w);
@@ -123,7 +131,7 @@ gsl_eigen_symm (gsl_matrix * A, gsl_vector * eval,
         gsl_vector_view d_vec = gsl_vector_view_array (d, N);
         gsl_vector_view sd_vec = gsl_vector_view_array (sd, N - 1);
         gsl_vector_view tau = gsl_vector_view_array (sd, N - 1);
-        gsl_linalg_symmtd_decomp (A, &tau.vector);
+        gsl_linalg_symmtd_decomp_ws (A, &tau.vector, w->linalg_workspace_p);
         gsl_linalg_symmtd_unpack_T (A, &d_vec.vector, &sd_vec.vector);
       }
       
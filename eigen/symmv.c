@@ -79,6 +79,15 @@ gsl_eigen_symmv_alloc (const size_t n)
       GSL_ERROR_NULL ("failed to allocate space for sines", GSL_ENOMEM);
     }
 
+  w->linalg_workspace_p =
+    gsl_linalg_workspace_alloc (GSL_MAX (gsl_linalg_symmtd_decomp_wsize (n),
+                                         gsl_linalg_symmtd_unpack_wsize (n)));
+
+  if (w->linalg_workspace_p == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for tridiagonal reduction", GSL_ENOMEM);
+    }
+
   w->size = n;
 
   return w;
@@ -88,6 +97,7 @@ void
 gsl_eigen_symmv_free (gsl_eigen_symmv_workspace * w)
 {
   RETURN_IF_NULL (w);
+  gsl_linalg_workspace_free (w->linalg_workspace_p);
   free(w->gs);
   free(w->gc);
   free(w->sd);
@@ -136,8 +146,9 @@ gsl_eigen_symmv (gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec,
         gsl_vector_view d_vec = gsl_vector_view_array (d, N);
         gsl_vector_view sd_vec = gsl_vector_view_array (sd, N - 1);
         gsl_vector_view tau = gsl_vector_view_array (sd, N - 1);
-        gsl_linalg_symmtd_decomp (A, &tau.vector);
-        gsl_linalg_symmtd_unpack (A, &tau.vector, evec, &d_vec.vector, &sd_vec.vector);
+        gsl_linalg_symmtd_decomp_ws (A, &tau.vector, w->linalg_workspace_p);
+        gsl_linalg_symmtd_unpack_ws (A, &tau.vector, evec, &d_vec.vector, &sd_vec.vector,
+                                     w->linalg_workspace_p);
       }
 
       /* Make an initial pass through the tridiagonal decomposition
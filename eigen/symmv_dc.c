@@ -0,0 +1,946 @@
+/* eigen/symmv_dc.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_sort_double.h>
+#include <gsl/gsl_eigen.h>
+
+/* Compute eigenvalues/eigenvectors of real symmetric matrix using
+   reduction to tridiagonal form, followed by the divide and conquer
+   method for the tridiagonal matrix, and the back-transformation of
+   its eigenvectors.
+
+   The tridiagonal matrix T is split in two halves by a rank-one
+   modification,
+
+     T = diag(T1, T2) + rho u u^T
+
+   and the eigensystems T1 = Q1 D1 Q1^T and T2 = Q2 D2 Q2^T are found
+   recursively. The eigenvalues of T are then the roots of the
+   secular equation of D + rho z z^T, with D = diag(D1, D2) and
+   z = diag(Q1, Q2)^T u, and its eigenvectors are diag(Q1, Q2) U,
+   where U holds the eigenvectors of D + rho z z^T. This product is
+   computed with dgemm, and most of the work of the method is done
+   there. Subproblems of size DC_SMALL or less are solved by QR
+   iteration.
+
+   The components of z which are negligible, and the pairs of close
+   elements of D, are deflated: their eigenpairs are known directly
+   (Dongarra and Sorensen, SIAM J. Sci. Stat. Comput. 8, 1987). The
+   remaining vectors are computed from a vector z recomputed from the
+   computed roots, which makes them numerically orthogonal (Gu and
+   Eisenstat, SIAM J. Matrix Anal. Appl. 16, 1995).
+
+   The organisation follows LAPACK (dstedc, dlaed0-dlaed4). */
+
+#include "qrstep.c"
+
+/* size of the subproblems solved by QR iteration */
+#define DC_SMALL 25
+
+/* number of columns of U formed at a time */
+#define DC_NB 256
+
+/* maximum number of iterations for a root of the secular equation */
+#define DC_MAXITER 200
+
+static int dc_solve (const size_t n, double d[], double e[], gsl_matrix * Z,
+                     const size_t nwant, gsl_matrix * X,
+                     gsl_eigen_symmv_dc_workspace * w);
+static int dc_tridiag (const size_t nwant, gsl_matrix * evec,
+                       gsl_eigen_symmv_dc_workspace * w);
+
+gsl_eigen_symmv_dc_workspace *
+gsl_eigen_symmv_dc_alloc (const size_t n)
+{
+  gsl_eigen_symmv_dc_workspace * w;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("matrix dimension must be positive integer", GSL_EINVAL);
+    }
+
+  w = (gsl_eigen_symmv_dc_workspace *) calloc (1, sizeof (gsl_eigen_symmv_dc_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->size = n;
+
+  w->d = (double *) malloc (n * sizeof (double));
+  w->sd = (double *) malloc (n * sizeof (double));
+  w->tau = (double *) malloc (n * sizeof (double));
+  w->work = (double *) malloc (7 * n * sizeof (double));
+  w->iwork = (size_t *) malloc (7 * n * sizeof (size_t));
+
+  if (w->d == 0 || w->sd == 0 || w->tau == 0 || w->work == 0 || w->iwork == 0)
+    {
+      gsl_eigen_symmv_dc_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for vectors", GSL_ENOMEM);
+    }
+
+  w->Q = gsl_matrix_alloc (n, n);
+  w->Z = gsl_matrix_alloc (n, n);
+  w->U = gsl_matrix_alloc (n, GSL_MIN (n, DC_NB));
+  w->Y = gsl_matrix_alloc (n, GSL_MIN (n, DC_NB));
+
+  if (w->Q == 0 || w->Z == 0 || w->U == 0 || w->Y == 0)
+    {
+      gsl_eigen_symmv_dc_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for matrices", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_eigen_symmv_dc_free (gsl_eigen_symmv_dc_workspace * w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->Y)
+    gsl_matrix_free (w->Y);
+  if (w->U)
+    gsl_matrix_free (w->U);
+  if (w->Z)
+    gsl_matrix_free (w->Z);
+  if (w->Q)
+    gsl_matrix_free (w->Q);
+
+  free (w->iwork);
+  free (w->work);
+  free (w->tau);
+  free (w->sd);
+  free (w->d);
+  free (w);
+}
+
+/*
+gsl_eigen_symmv_dc()
+  Compute all eigenvalues and eigenvectors of the real symmetric
+matrix A. The eigenvalues are returned in ascending order.
+*/
+
+int
+gsl_eigen_symmv_dc (gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec,
+                    gsl_eigen_symmv_dc_workspace * w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square to compute eigenvalues", GSL_ENOTSQR);
+    }
+  else if (A->size1 != w->size)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else if (eval->size != A->size1)
+    {
+      GSL_ERROR ("eigenvalue vector must match matrix size", GSL_EBADLEN);
+    }
+  else if (evec->size1 != A->size1 || evec->size2 != A->size1)
+    {
+      GSL_ERROR ("eigenvector matrix must match matrix size", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t N = A->size1;
+      gsl_vector_view d = gsl_vector_view_array (w->d, N);
+      int status;
+
+      if (N == 1)
+        {
+          gsl_vector_set (eval, 0, gsl_matrix_get (A, 0, 0));
+          gsl_matrix_set (evec, 0, 0, 1.0);
+          return GSL_SUCCESS;
+        }
+
+      {
+        gsl_vector_view sd = gsl_vector_view_array (w->sd, N - 1);
+        gsl_vector_view tau = gsl_vector_view_array (w->tau, N - 1);
+
+        gsl_linalg_symmtd_decomp (A, &tau.vector);
+        gsl_linalg_symmtd_unpack_T (A, &d.vector, &sd.vector);
+      }
+
+      /* eigenvectors of T, then of A */
+
+      status = dc_tridiag (N, evec, w);
+      if (status)
+        return status;
+
+      {
+        gsl_vector_view tau = gsl_vector_view_array (w->tau, N - 1);
+        gsl_linalg_symmtd_Qmat (A, &tau.vector, evec);
+      }
+
+      gsl_vector_memcpy (eval, &d.vector);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_eigen_symmv_dc_top()
+  Compute the k largest eigenvalues of the real symmetric matrix A,
+and their eigenvectors, with k = eval->size. The eigenvalues are
+returned in descending order.
+
+Notes:
+1) All the eigenvalues of the tridiagonal matrix are computed, but the
+eigenvectors only for the k wanted eigenvalues in the final merge, and
+only these k vectors are transformed back, so the products with the
+largest matrices cost O(N^2 k) instead of O(N^3).
+*/
+
+int
+gsl_eigen_symmv_dc_top (gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec,
+                        gsl_eigen_symmv_dc_workspace * w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square to compute eigenvalues", GSL_ENOTSQR);
+    }
+  else if (A->size1 != w->size)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else if (eval->size == 0 || eval->size > A->size1)
+    {
+      GSL_ERROR ("number of eigenvalues must be between 1 and matrix size", GSL_EBADLEN);
+    }
+  else if (evec->size1 != A->size1 || evec->size2 != eval->size)
+    {
+      GSL_ERROR ("eigenvector matrix must be N-by-k", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t N = A->size1;
+      const size_t k = eval->size;
+      size_t i;
+      int status;
+
+      if (N == 1)
+        {
+          gsl_vector_set (eval, 0, gsl_matrix_get (A, 0, 0));
+          gsl_matrix_set (evec, 0, 0, 1.0);
+          return GSL_SUCCESS;
+        }
+
+      {
+        gsl_vector_view d = gsl_vector_view_array (w->d, N);
+        gsl_vector_view sd = gsl_vector_view_array (w->sd, N - 1);
+        gsl_vector_view tau = gsl_vector_view_array (w->tau, N - 1);
+
+        gsl_linalg_symmtd_decomp (A, &tau.vector);
+        gsl_linalg_symmtd_unpack_T (A, &d.vector, &sd.vector);
+      }
+
+      status = dc_tridiag (k, evec, w);
+      if (status)
+        return status;
+
+      {
+        gsl_vector_view tau = gsl_vector_view_array (w->tau, N - 1);
+        gsl_linalg_symmtd_Qmat (A, &tau.vector, evec);
+      }
+
+      /* the wanted eigenpairs are in ascending order in d[0:k] and
+         evec; reverse them */
+
+      for (i = 0; i < k; i++)
+        gsl_vector_set (eval, i, w->d[k - 1 - i]);
+
+      for (i = 0; i < k / 2; i++)
+        gsl_matrix_swap_columns (evec, i, k - 1 - i);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+dc_tridiag()
+  Compute the nwant largest eigenvalues of the tridiagonal matrix
+stored in w->d and w->sd, in ascending order in w->d[0:nwant], and
+their eigenvectors in the N-by-nwant matrix evec
+*/
+
+static int
+dc_tridiag (const size_t nwant, gsl_matrix * evec,
+            gsl_eigen_symmv_dc_workspace * w)
+{
+  const size_t N = w->size;
+  double *d = w->d;
+  double *e = w->sd;
+  double scale = 0.0;
+  gsl_matrix *Z = (nwant == N) ? evec : w->Z;
+  size_t i;
+  int status;
+
+  /* scale T to unit max norm to avoid overflow and underflow in the
+     secular equation */
+
+  for (i = 0; i < N; i++)
+    {
+      scale = GSL_MAX (scale, fabs (d[i]));
+      if (i + 1 < N)
+        scale = GSL_MAX (scale, fabs (e[i]));
+    }
+
+  if (scale == 0.0)
+    scale = 1.0;
+
+  for (i = 0; i < N; i++)
+    {
+      d[i] /= scale;
+      if (i + 1 < N)
+        e[i] /= scale;
+    }
+
+  gsl_matrix_set_zero (Z);
+
+  status = dc_solve (N, d, e, Z, nwant, evec, w);
+
+  for (i = 0; i < nwant; i++)
+    d[i] *= scale;
+
+  return status;
+}
+
+/*
+dc_small()
+  Compute the eigensystem of the n-by-n tridiagonal matrix (d,e) by QR
+iteration; on output d is in ascending order and Z holds the
+eigenvectors
+*/
+
+static void
+dc_small (const size_t n, double d[], double e[], gsl_matrix * Z,
+          gsl_eigen_symmv_dc_workspace * w)
+{
+  double * const gc = w->work;
+  double * const gs = w->work + n;
+  size_t a, b, i, j;
+
+  gsl_matrix_set_identity (Z);
+
+  if (n == 1)
+    return;
+
+  chop_small_elements (n, d, e);
+
+  b = n - 1;
+
+  while (b > 0)
+    {
+      if (e[b - 1] == 0.0 || isnan (e[b - 1]))
+        {
+          b--;
+          continue;
+        }
+
+      a = b - 1;
+
+      while (a > 0)
+        {
+          if (e[a - 1] == 0.0)
+            break;
+          a--;
+        }
+
+      {
+        const size_t n_block = b - a + 1;
+
+        qrstep (n_block, d + a, e + a, gc, gs);
+
+        for (i = 0; i < n_block - 1; i++)
+          {
+            gsl_vector_view c1 = gsl_matrix_column (Z, a + i);
+            gsl_vector_view c2 = gsl_matrix_column (Z, a + i + 1);
+
+            /* Q <- Q G, with G = [c s; -s c] */
+            gsl_blas_drot (&c1.vector, &c2.vector, gc[i], -gs[i]);
+          }
+
+        chop_small_elements (n, d, e);
+      }
+    }
+
+  /* sort into ascending order */
+
+  for (i = 0; i + 1 < n; i++)
+    {
+      size_t k = i;
+
+      for (j = i + 1; j < n; j++)
+        {
+          if (d[j] < d[k])
+            k = j;
+        }
+
+      if (k != i)
+        {
+          double t = d[i];
+          d[i] = d[k];
+          d[k] = t;
+          gsl_matrix_swap_columns (Z, i, k);
+        }
+    }
+}
+
+/*
+dc_secular()
+  Find root i of the secular equation
+
+  f(x) = 1 + rho sum_j z_j^2 / (d_j - x)
+
+with d_0 < d_1 < ... < d_{k-1}, rho > 0 and all z_j nonzero. Root i
+lies in (d_i, d_{i+1}), or in (d_{k-1}, d_{k-1} + rho z^T z] for the
+last one, and is returned as x = d_org + tau, where d_org is the
+nearer end of the interval, so that the differences d_j - x can be
+formed accurately as (d_j - d_org) - tau.
+
+Notes:
+1) Each step fits the sums over the poles on either side of the root
+with rational functions having a pole at the two nearest poles d_i and
+d_{i+1}, and takes the root of the fitted function. The root is kept
+inside a bracket, and the step is replaced by bisection if it falls
+outside.
+*/
+
+static void
+dc_secular (const size_t k, const double d[], const double z[],
+            const double rho, const size_t i, size_t * org, double * tau)
+{
+  double lo, hi, t;
+  size_t o, j, iter;
+
+  if (k == 1)
+    {
+      *org = 0;
+      *tau = rho * z[0] * z[0];
+      return;
+    }
+
+  if (i < k - 1)
+    {
+      const double mid = 0.5 * (d[i + 1] - d[i]);
+      double f = 1.0;
+
+      for (j = 0; j < k; j++)
+        f += rho * z[j] * z[j] / ((d[j] - d[i]) - mid);
+
+      /* f is increasing on the interval */
+      if (f >= 0.0)
+        {
+          o = i;
+          lo = 0.0;
+          hi = mid;
+        }
+      else
+        {
+          o = i + 1;
+          lo = -mid;
+          hi = 0.0;
+        }
+    }
+  else
+    {
+      double zz = 0.0;
+
+      for (j = 0; j < k; j++)
+        zz += z[j] * z[j];
+
+      o = k - 1;
+      lo = 0.0;
+      hi = rho * zz;
+    }
+
+  t = 0.5 * (lo + hi);
+
+  for (iter = 0; iter < DC_MAXITER; iter++)
+    {
+      double psi = 0.0, dpsi = 0.0, phi = 0.0, dphi = 0.0;
+      double f, err, tn;
+
+      /* psi and phi are the sums over the poles left and right of the
+         root */
+      for (j = 0; j < k; j++)
+        {
+          const double delta = (d[j] - d[o]) - t;
+          const double term = rho * z[j] * (z[j] / delta);
+
+          if (j <= i)
+            {
+              psi += term;
+              dpsi += term / delta;
+            }
+          else
+            {
+              phi += term;
+              dphi += term / delta;
+            }
+        }
+
+      f = 1.0 + psi + phi;
+      err = 8.0 * (phi - psi) + 2.0 + 3.0 * fabs (t) * (dpsi + dphi);
+
+      if (fabs (f) <= GSL_DBL_EPSILON * err)
+        break;
+
+      if (f < 0.0)
+        lo = t;
+      else
+        hi = t;
+
+      if (i < k - 1)
+        {
+          /* fit c + q / (a - s) + r / (b - s), with s = x - t and the
+             poles a < 0 < b, and solve the quadratic
+             c s^2 - (c (a + b) + q + r) s + a b f = 0 */
+          const double a = (d[i] - d[o]) - t;
+          const double b = (d[i + 1] - d[o]) - t;
+          const double q = dpsi * a * a;
+          const double r = dphi * b * b;
+          const double c = f - q / a - r / b;
+          const double B = c * (a + b) + q + r;
+          const double C = a * b * f;
+          double s;
+
+          if (c == 0.0)
+            {
+              s = C / B;
+            }
+          else
+            {
+              const double disc = GSL_MAX (B * B - 4.0 * c * C, 0.0);
+              const double sq = sqrt (disc);
+              double s1, s2;
+
+              if (B >= 0.0)
+                {
+                  s1 = (B + sq) / (2.0 * c);
+                  s2 = 2.0 * C / (B + sq);
+                }
+              else
+                {
+                  s1 = 2.0 * C / (B - sq);
+                  s2 = (B - sq) / (2.0 * c);
+                }
+
+              s = (s1 > a && s1 < b) ? s1 : s2;
+            }
+
+          tn = t + s;
+        }
+      else
+        {
+          /* fit c + q / (a - s), with the pole a at d_{k-1} */
+          const double a = -t;
+          const double q = dpsi * a * a;
+          const double c = f - q / a;
+
+          tn = (c > 0.0) ? t + a + q / c : lo;
+        }
+
+      if (!(tn > lo && tn < hi))
+        tn = 0.5 * (lo + hi);
+
+      if (tn == t || tn == lo || tn == hi)
+        break;
+
+      t = tn;
+    }
+
+  *org = o;
+  *tau = t;
+}
+
+/*
+dc_merge()
+  Compute the eigensystem of diag(Q1, Q2) (D + rho z z^T) diag(Q1, Q2)^T,
+where the n-by-n matrix Z holds diag(Q1, Q2) and d holds D, with Q1 of
+size n1. Only the nwant largest eigenvalues are kept: they are stored
+in ascending order in d[0:nwant], and their eigenvectors in the
+n-by-nwant matrix X, which may be Z if nwant = n.
+
+Inputs: beta - the element of T coupling the two halves; rho = |beta|
+               and z = (last row of Q1, sign(beta) first row of Q2)
+
+Notes:
+1) Columns of Z are classified as nonzero only in the first n1 rows
+(type 1), only in the last n - n1 rows (type 3), or both (type 2,
+created by the deflating rotations). The columns of the nondeflated
+eigenpairs are gathered in w->Q in that order, so that the product
+with U is done with two dgemm of half the rows each, over the columns
+of types 1-2 and 2-3.
+*/
+
+static int
+dc_merge (const size_t n, const size_t n1, double d[], const double beta,
+          gsl_matrix * Z, const size_t nwant, gsl_matrix * X,
+          gsl_eigen_symmv_dc_workspace * w)
+{
+  const size_t n2 = n - n1;
+  double *z = w->work;
+  double *dk = z + n;
+  double *zk = dk + n;
+  double *zh = zk + n;
+  double *taus = zh + n;
+  double *lam = taus + n;
+  double *dval = lam + n;
+  size_t *idx = w->iwork;
+  size_t *type = idx + n;
+  size_t *col = type + n;
+  size_t *pos = col + n;
+  size_t *org = pos + n;
+  size_t *perm = org + n;
+  size_t *dcol = perm + n;
+  double rho = fabs (beta);
+  double tol, dmax = 0.0, zmax = 0.0, znorm;
+  size_t i, j, p, k = 0, ndef = 0, pj = n, c1 = 0, c2 = 0, i1, i2;
+  gsl_matrix_view Qc;
+
+  /* form z and normalize it */
+
+  for (j = 0; j < n1; j++)
+    {
+      z[j] = gsl_matrix_get (Z, n1 - 1, j);
+      type[j] = 1;
+    }
+
+  for (j = n1; j < n; j++)
+    {
+      z[j] = (beta < 0.0) ? -gsl_matrix_get (Z, n1, j) : gsl_matrix_get (Z, n1, j);
+      type[j] = 3;
+    }
+
+  {
+    gsl_vector_view zv = gsl_vector_view_array (z, n);
+
+    znorm = gsl_blas_dnrm2 (&zv.vector);
+    gsl_blas_dscal (1.0 / znorm, &zv.vector);
+    rho *= znorm * znorm;
+  }
+
+  /* merge the two ascending halves of d */
+
+  for (i = 0, i1 = 0, i2 = n1; i < n; i++)
+    {
+      if (i2 == n || (i1 < n1 && d[i1] <= d[i2]))
+        idx[i] = i1++;
+      else
+        idx[i] = i2++;
+    }
+
+  for (j = 0; j < n; j++)
+    {
+      dmax = GSL_MAX (dmax, fabs (d[j]));
+      zmax = GSL_MAX (zmax, fabs (z[j]));
+    }
+
+  tol = 8.0 * GSL_DBL_EPSILON * GSL_MAX (dmax, zmax);
+
+  /* deflation, in ascending order of d */
+
+  for (i = 0; i < n; i++)
+    {
+      j = idx[i];
+
+      if (rho * fabs (z[j]) <= tol)
+        {
+          /* negligible component of z: d_j is an eigenvalue */
+          dval[ndef] = d[j];
+          dcol[ndef++] = j;
+        }
+      else if (pj == n)
+        {
+          pj = j;
+        }
+      else
+        {
+          const double tt = d[j] - d[pj];
+          const double h = gsl_hypot (z[j], z[pj]);
+          const double c = z[j] / h;
+          const double s = -z[pj] / h;
+
+          if (fabs (tt * c * s) <= tol)
+            {
+              /* d_pj and d_j are close: rotate z_pj to zero and
+                 deflate the first one */
+              gsl_vector_view x = gsl_matrix_column (Z, pj);
+              gsl_vector_view y = gsl_matrix_column (Z, j);
+              const double dp = d[pj] * c * c + d[j] * s * s;
+
+              gsl_blas_drot (&x.vector, &y.vector, c, s);
+
+              d[j] = d[pj] * s * s + d[j] * c * c;
+              d[pj] = dp;
+              z[j] = h;
+              z[pj] = 0.0;
+
+              if (type[pj] != type[j])
+                type[j] = 2;
+
+              dval[ndef] = d[pj];
+              dcol[ndef++] = pj;
+            }
+          else
+            {
+              dk[k] = d[pj];
+              zk[k] = z[pj];
+              col[k++] = pj;
+            }
+
+          pj = j;
+        }
+    }
+
+  if (pj != n)
+    {
+      dk[k] = d[pj];
+      zk[k] = z[pj];
+      col[k++] = pj;
+    }
+
+  /* roots of the secular equation */
+
+  for (i = 0; i < k; i++)
+    {
+      dc_secular (k, dk, zk, rho, i, &org[i], &taus[i]);
+      lam[i] = dk[org[i]] + taus[i];
+    }
+
+  /* recompute z from the roots (Gu and Eisenstat), with
+     d_p - lambda_j = (d_p - d_org_j) - tau_j */
+
+  for (p = 0; p < k; p++)
+    {
+      double prod = -((dk[p] - dk[org[p]]) - taus[p]) / rho;
+
+      for (j = 0; j < k; j++)
+        {
+          if (j != p)
+            prod *= ((dk[p] - dk[org[j]]) - taus[j]) / (dk[p] - dk[j]);
+        }
+
+      zh[p] = (zk[p] < 0.0) ? -sqrt (fabs (prod)) : sqrt (fabs (prod));
+    }
+
+  /* select the nwant largest eigenvalues; entries 0:k of lam are the
+     roots and k:n the deflated values */
+
+  for (j = 0; j < ndef; j++)
+    lam[k + j] = dval[j];
+
+  gsl_sort_index (perm, lam, 1, n);
+
+  /* gather the columns of Z: the nondeflated ones ordered by type, then
+     the wanted deflated ones */
+
+  for (p = 0; p < k; p++)
+    {
+      if (type[col[p]] == 1)
+        c1++;
+      else if (type[col[p]] == 2)
+        c2++;
+    }
+
+  {
+    size_t q1 = 0, q2 = c1, q3 = c1 + c2;
+
+    for (p = 0; p < k; p++)
+      {
+        const size_t t = type[col[p]];
+        pos[p] = (t == 1) ? q1++ : (t == 2) ? q2++ : q3++;
+      }
+  }
+
+  Qc = gsl_matrix_submatrix (w->Q, 0, 0, n, n);
+
+  for (p = 0; p < k; p++)
+    {
+      gsl_vector_view src = gsl_matrix_column (Z, col[p]);
+      gsl_vector_view dst = gsl_matrix_column (&Qc.matrix, pos[p]);
+      gsl_vector_memcpy (&dst.vector, &src.vector);
+    }
+
+  for (i = n - nwant, j = k; i < n; i++)
+    {
+      if (perm[i] >= k)
+        {
+          gsl_vector_view src = gsl_matrix_column (Z, dcol[perm[i] - k]);
+          gsl_vector_view dst = gsl_matrix_column (&Qc.matrix, j++);
+          gsl_vector_memcpy (&dst.vector, &src.vector);
+        }
+    }
+
+  /* eigenvectors of the wanted roots, DC_NB at a time: the columns of
+     U, u_j(p) = zh_p / (d_p - lambda_j), normalized, are stored with
+     their rows ordered as the columns of Qc */
+
+  {
+    const size_t nb = w->U->size2;
+    size_t i0 = n - nwant;
+
+    while (1)
+      {
+        size_t nc = 0;
+        size_t out[DC_NB];
+
+        for (; i0 < n && nc < nb; i0++)
+          {
+            const size_t jr = perm[i0];
+            gsl_vector_view u;
+
+            if (jr >= k)
+              continue;
+
+            u = gsl_matrix_subcolumn (w->U, nc, 0, k);
+
+            for (p = 0; p < k; p++)
+              gsl_vector_set (&u.vector, pos[p], zh[p] / ((dk[p] - dk[org[jr]]) - taus[jr]));
+
+            gsl_blas_dscal (1.0 / gsl_blas_dnrm2 (&u.vector), &u.vector);
+
+            out[nc++] = i0 - (n - nwant);
+          }
+
+        if (nc == 0)
+          break;
+
+        {
+          gsl_matrix_view Y = gsl_matrix_submatrix (w->Y, 0, 0, n, nc);
+          gsl_matrix_view Y1 = gsl_matrix_submatrix (w->Y, 0, 0, n1, nc);
+          gsl_matrix_view Y2 = gsl_matrix_submatrix (w->Y, n1, 0, n2, nc);
+
+          /* Y1 = Q(0:n1, types 1-2) U(types 1-2, :) */
+          if (c1 + c2 > 0)
+            {
+              gsl_matrix_const_view Q1 = gsl_matrix_const_submatrix (&Qc.matrix, 0, 0, n1, c1 + c2);
+              gsl_matrix_const_view U1 = gsl_matrix_const_submatrix (w->U, 0, 0, c1 + c2, nc);
+              gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &Q1.matrix, &U1.matrix, 0.0, &Y1.matrix);
+            }
+          else
+            {
+              gsl_matrix_set_zero (&Y1.matrix);
+            }
+
+          /* Y2 = Q(n1:n, types 2-3) U(types 2-3, :) */
+          if (k > c1)
+            {
+              gsl_matrix_const_view Q2 = gsl_matrix_const_submatrix (&Qc.matrix, n1, c1, n2, k - c1);
+              gsl_matrix_const_view U2 = gsl_matrix_const_submatrix (w->U, c1, 0, k - c1, nc);
+              gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &Q2.matrix, &U2.matrix, 0.0, &Y2.matrix);
+            }
+          else
+            {
+              gsl_matrix_set_zero (&Y2.matrix);
+            }
+
+          for (j = 0; j < nc; j++)
+            {
+              gsl_vector_view src = gsl_matrix_column (&Y.matrix, j);
+              gsl_vector_view dst = gsl_matrix_column (X, out[j]);
+              gsl_vector_memcpy (&dst.vector, &src.vector);
+            }
+        }
+      }
+  }
+
+  /* deflated eigenvectors, and the eigenvalues */
+
+  for (i = n - nwant, j = k; i < n; i++)
+    {
+      const size_t c = i - (n - nwant);
+
+      if (perm[i] >= k)
+        {
+          gsl_vector_view src = gsl_matrix_column (&Qc.matrix, j++);
+          gsl_vector_view dst = gsl_matrix_column (X, c);
+          gsl_vector_memcpy (&dst.vector, &src.vector);
+        }
+
+      d[c] = lam[perm[i]];
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+dc_solve()
+  Compute the eigensystem of the n-by-n tridiagonal matrix (d,e),
+with the nwant largest eigenvalues in ascending order in d[0:nwant]
+and their eigenvectors in the n-by-nwant matrix X. Z is n-by-n
+workspace, zero on input, and may be X if nwant = n.
+*/
+
+static int
+dc_solve (const size_t n, double d[], double e[], gsl_matrix * Z,
+          const size_t nwant, gsl_matrix * X,
+          gsl_eigen_symmv_dc_workspace * w)
+{
+  if (n <= DC_SMALL)
+    {
+      dc_small (n, d, e, Z, w);
+
+      if (nwant < n)
+        {
+          gsl_matrix_view Zw = gsl_matrix_submatrix (Z, 0, n - nwant, n, nwant);
+          size_t i;
+
+          gsl_matrix_memcpy (X, &Zw.matrix);
+
+          for (i = 0; i < nwant; i++)
+            d[i] = d[n - nwant + i];
+        }
+
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      const size_t n1 = n / 2;
+      const double beta = e[n1 - 1];
+      gsl_matrix_view Z1 = gsl_matrix_submatrix (Z, 0, 0, n1, n1);
+      gsl_matrix_view Z2 = gsl_matrix_submatrix (Z, n1, n1, n - n1, n - n1);
+      int status;
+
+      /* T = diag(T1, T2) + |beta| u u^T, u = e_{n1-1} + sign(beta) e_{n1} */
+
+      d[n1 - 1] -= fabs (beta);
+      d[n1] -= fabs (beta);
+
+      status = dc_solve (n1, d, e, &Z1.matrix, n1, &Z1.matrix, w);
+      if (status)
+        return status;
+
+      status = dc_solve (n - n1, d + n1, e + n1, &Z2.matrix, n - n1, &Z2.matrix, w);
+      if (status)
+        return status;
+
+      return dc_merge (n, n1, d, beta, Z, nwant, X, w);
+    }
+}
@@ -273,6 +273,7 @@ test_eigen_symm_results (const gsl_matrix * A,
                          const char * desc2)
 {
   const size_t N = A->size1;
+  const size_t K = eval->size; /* number of eigenpairs */
   size_t i, j;
   double emax = 0;
 
@@ -280,13 +281,13 @@ test_eigen_symm_results (const gsl_matrix * A,
   gsl_vector * y = gsl_vector_alloc(N);
 
   /* check eigenvalues */
-  for (i = 0; i < N; i++) 
+  for (i = 0; i < K; i++) 
     {
       double ei = gsl_vector_get (eval, i);
       if (fabs(ei) > emax) emax = fabs(ei);
     }
 
-  for (i = 0; i < N; i++)
+  for (i = 0; i < K; i++)
     {
       double ei = gsl_vector_get (eval, i);
       gsl_vector_const_view vi = gsl_matrix_const_column(evec, i);
@@ -305,7 +306,7 @@ test_eigen_symm_results (const gsl_matrix * A,
 
   /* check eigenvectors are orthonormal */
 
-  for (i = 0; i < N; i++)
+  for (i = 0; i < K; i++)
     {
       gsl_vector_const_view vi = gsl_matrix_const_column(evec, i);
       double nrm_v = gsl_blas_dnrm2(&vi.vector);
@@ -313,10 +314,10 @@ test_eigen_symm_results (const gsl_matrix * A,
                     desc, i, desc2);
     }
 
-  for (i = 0; i < N; i++)
+  for (i = 0; i < K; i++)
     {
       gsl_vector_const_view vi = gsl_matrix_const_column(evec, i);
-      for (j = i + 1; j < N; j++)
+      for (j = i + 1; j < K; j++)
         {
           gsl_vector_const_view vj = gsl_matrix_const_column(evec, j);
           double vivj;
@@ -330,6 +331,48 @@ test_eigen_symm_results (const gsl_matrix * A,
   gsl_vector_free(y);
 }
 
+/* test the divide and conquer solver, against the eigenvalues eval
+   in ascending order */
+void
+test_eigen_symm_dc(const gsl_matrix * m, const gsl_vector * eval,
+                   size_t count, const char * desc)
+{
+  const size_t N = m->size1;
+  const size_t K = (N + 1) / 2;
+  gsl_matrix * A = gsl_matrix_alloc(N, N);
+  gsl_vector * evalv = gsl_vector_alloc(N);
+  gsl_matrix * evec = gsl_matrix_alloc(N, N);
+  gsl_vector * evalk = gsl_vector_alloc(K);
+  gsl_matrix * eveck = gsl_matrix_alloc(N, K);
+  gsl_eigen_symmv_dc_workspace * w = gsl_eigen_symmv_dc_alloc(N);
+  size_t i;
+
+  gsl_matrix_memcpy(A, m);
+  gsl_eigen_symmv_dc(A, evalv, evec, w);
+  test_eigen_symm_results(m, evalv, evec, count, desc, "dc");
+  test_eigenvalues_real(evalv, eval, desc, "dc");
+
+  /* the K largest eigenvalues, in descending order */
+  gsl_matrix_memcpy(A, m);
+  gsl_eigen_symmv_dc_top(A, evalk, eveck, w);
+  test_eigen_symm_results(m, evalk, eveck, count, desc, "dc top");
+
+  for (i = 0; i < K; i++)
+    gsl_vector_set(evalv, i, gsl_vector_get(eval, N - 1 - i));
+
+  {
+    gsl_vector_view e = gsl_vector_subvector(evalv, 0, K);
+    test_eigenvalues_real(evalk, &e.vector, desc, "dc top");
+  }
+
+  gsl_matrix_free(A);
+  gsl_vector_free(evalv);
+  gsl_matrix_free(evec);
+  gsl_vector_free(evalk);
+  gsl_matrix_free(eveck);
+  gsl_eigen_symmv_dc_free(w);
+}
+
 void
 test_eigen_symm_matrix(const gsl_matrix * m, size_t count,
                        const char * desc)
@@ -372,6 +415,8 @@ test_eigen_symm_matrix(const gsl_matrix * m, size_t count,
   gsl_eigen_symmv_sort(evalv, evec, GSL_EIGEN_SORT_ABS_DESC);
   test_eigen_symm_results(m, evalv, evec, count, desc, "abs/desc");
 
+  test_eigen_symm_dc(m, x, count, desc);
+
   gsl_matrix_free(A);
   gsl_vector_free(eval);
   gsl_vector_free(evalv);
@@ -458,6 +503,60 @@ test_eigen_symm(void)
     test_eigen_symm_matrix(&m.matrix, 0, "symm(27)");
   };
 
+  /* larger matrices, for the divide and conquer solver */
+  {
+    const size_t dims[] = { 26, 51, 100, 150 };
+    r = gsl_rng_alloc(gsl_rng_default);
+
+    for (i = 0; i < sizeof(dims) / sizeof(dims[0]); ++i)
+      {
+        gsl_matrix * A = gsl_matrix_alloc(dims[i], dims[i]);
+
+        create_random_symm_matrix(A, r, -10, 10);
+        test_eigen_symm_matrix(A, i, "symm random");
+
+        gsl_matrix_free(A);
+      }
+
+    gsl_rng_free(r);
+  }
+
+  {
+    const size_t N = 100;
+    gsl_matrix * A = gsl_matrix_alloc(N, N);
+    size_t j;
+
+    /* I + u u^T, with eigenvalue 1 of multiplicity N - 1 */
+    for (i = 0; i < N; ++i)
+      for (j = 0; j < N; ++j)
+        gsl_matrix_set(A, i, j, (i == j) + 1.0 / (1.0 + i + j));
+
+    test_eigen_symm_matrix(A, 0, "symm rank-1");
+
+    /* second difference matrix */
+    gsl_matrix_set_zero(A);
+    for (i = 0; i < N; ++i)
+      {
+        gsl_matrix_set(A, i, i, 2.0);
+        if (i + 1 < N)
+          {
+            gsl_matrix_set(A, i, i + 1, -1.0);
+            gsl_matrix_set(A, i + 1, i, -1.0);
+          }
+      }
+
+    test_eigen_symm_matrix(A, 0, "symm laplacian");
+
+    /* diagonal, with repeated elements */
+    gsl_matrix_set_zero(A);
+    for (i = 0; i < N; ++i)
+      gsl_matrix_set(A, i, i, (double) (i % 7));
+
+    test_eigen_symm_matrix(A, 0, "symm diag");
+
+    gsl_matrix_free(A);
+  }
+
 } /* test_eigen_symm() */
 
 /******************************************
@@ -759,6 +858,32 @@ test_eigen_nonsymm(void)
       gsl_eigen_nonsymmv_free(w);
     }
 
+  /* large matrices use the multishift QR algorithm */
+  {
+    const size_t sizes[] = { 80, 150, 300 };
+
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+      {
+        n = sizes[i];
+
+        {
+          gsl_matrix * m = gsl_matrix_alloc(n, n);
+          gsl_eigen_nonsymmv_workspace * w = gsl_eigen_nonsymmv_alloc(n);
+
+          create_random_nonsymm_matrix(m, r, -10, 10);
+
+          gsl_eigen_nonsymmv_params(0, w);
+          test_eigen_nonsymm_matrix(m, i, "random, unbalanced", w);
+
+          gsl_eigen_nonsymmv_params(1, w);
+          test_eigen_nonsymm_matrix(m, i, "random, balanced", w);
+
+          gsl_matrix_free(m);
+          gsl_eigen_nonsymmv_free(w);
+        }
+      }
+  }
+
   gsl_rng_free(r);
 
   {
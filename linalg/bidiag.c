@@ -71,8 +71,62 @@
 
 #include <gsl/gsl_linalg.h>
 
+#include "householder_wy.h"
+#include "workspace.h"
+
+static int bidiag_decomp_L2 (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V,
+                             double * work);
+static void bidiag_panel (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V,
+                          gsl_matrix * X, gsl_matrix * Y, double * d, double * e);
+static void bidiag_unpack_V (const gsl_matrix * A, const gsl_vector * tau_V, gsl_matrix * V,
+                             double * work);
+
+/*
+ * For large matrices the reduction is blocked as in LAPACK (dgebrd):
+ * the reflectors of WY_BLOCK rows and columns are computed from a
+ * panel, together with matrices X and Y such that the trailing matrix
+ * is updated with two matrix products,
+ *
+ *   A22 := A22 - V Y^T - X U^T
+ *
+ * where V and U hold the column and row reflectors of the panel. Half
+ * of the operations are then done by Level 3 BLAS, the other half
+ * being the matrix-vector products with the trailing matrix needed to
+ * compute each reflector.
+ */
+
 int 
 gsl_linalg_bidiag_decomp (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V)  
+{
+  gsl_linalg_workspace w;
+  int status;
+
+  if (linalg_workspace_init (&w, gsl_linalg_bidiag_decomp_wsize (A->size1, A->size2)))
+    {
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  status = gsl_linalg_bidiag_decomp_ws (A, tau_U, tau_V, &w);
+
+  linalg_workspace_clear (&w);
+
+  return status;
+}
+
+/* size in doubles of the arena needed by gsl_linalg_bidiag_decomp_ws */
+
+size_t
+gsl_linalg_bidiag_decomp_wsize (const size_t M, const size_t N)
+{
+  if (N <= WY_CROSSOVER)
+    return M;
+  else
+    return M + (M + N) * WY_BLOCK;
+}
+
+int
+gsl_linalg_bidiag_decomp_ws (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V,
+                             gsl_linalg_workspace * w)
 {
   if (A->size1 < A->size2)
     {
@@ -86,55 +140,254 @@ gsl_linalg_bidiag_decomp (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V
     {
       GSL_ERROR ("size of tau_V must be (N - 1)", GSL_EBADLEN);
     }
+  else if (linalg_workspace_avail (w) < gsl_linalg_bidiag_decomp_wsize (A->size1, A->size2))
+    {
+      GSL_ERROR ("workspace is too small", GSL_EBADLEN);
+    }
+  else if (A->size2 <= WY_CROSSOVER)
+    {
+      double *work = linalg_workspace_get (w, A->size1);
+      int status = bidiag_decomp_L2 (A, tau_U, tau_V, work);
+
+      linalg_workspace_release (w, work);
+
+      return status;
+    }
   else
     {
       const size_t M = A->size1;
       const size_t N = A->size2;
-      gsl_vector * tmp = gsl_vector_alloc(M);
-      size_t j;
-  
-      for (j = 0 ; j < N; j++)
+      const size_t nb = WY_BLOCK;
+      double *work = linalg_workspace_get (w, gsl_linalg_bidiag_decomp_wsize (M, N));
+      gsl_matrix_view Xv = gsl_matrix_view_array (work + M, M, nb);
+      gsl_matrix_view Yv = gsl_matrix_view_array (work + M + M * nb, N, nb);
+      gsl_matrix *X = &Xv.matrix, *Y = &Yv.matrix;
+      double d[WY_BLOCK], e[WY_BLOCK];
+      size_t i, j = 0;
+      int status;
+
+      /* reduce nb rows and columns at a time until the trailing matrix
+         is small enough for the unblocked algorithm */
+
+      while (N - j > WY_CROSSOVER)
         {
-          /* apply Householder transformation to current column */
-          gsl_vector_view v = gsl_matrix_subcolumn(A, j, j, M - j);
-          double tau_j = gsl_linalg_householder_transform (&v.vector);
-
-          /* apply the transformation to the remaining columns */
-          if (j + 1 < N)
+          gsl_matrix_view Aj = gsl_matrix_submatrix (A, j, j, M - j, N - j);
+          gsl_vector_view tU = gsl_vector_subvector (tau_U, j, nb);
+          gsl_vector_view tV = gsl_vector_subvector (tau_V, j, nb);
+          gsl_matrix_view Xj = gsl_matrix_submatrix (X, 0, 0, M - j, nb);
+          gsl_matrix_view Yj = gsl_matrix_submatrix (Y, 0, 0, N - j, nb);
+          gsl_matrix_view A22 = gsl_matrix_submatrix (A, j + nb, j + nb, M - j - nb, N - j - nb);
+          gsl_matrix_view V = gsl_matrix_submatrix (A, j + nb, j, M - j - nb, nb);
+          gsl_matrix_view U = gsl_matrix_submatrix (A, j, j + nb, nb, N - j - nb);
+          gsl_matrix_view X2 = gsl_matrix_submatrix (X, nb, 0, M - j - nb, nb);
+          gsl_matrix_view Y2 = gsl_matrix_submatrix (Y, nb, 0, N - j - nb, nb);
+
+          bidiag_panel (&Aj.matrix, &tU.vector, &tV.vector, &Xj.matrix, &Yj.matrix, d, e);
+
+          /* A22 := A22 - V Y2^T - X2 U^T */
+          gsl_blas_dgemm (CblasNoTrans, CblasTrans, -1.0, &V.matrix, &Y2.matrix, 1.0, &A22.matrix);
+          gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, -1.0, &X2.matrix, &U.matrix, 1.0, &A22.matrix);
+
+          /* restore the bidiagonal elements, which hold the units of the
+             reflectors during the update */
+          for (i = 0; i < nb; i++)
             {
-              gsl_matrix_view m = gsl_matrix_submatrix (A, j, j + 1, M - j, N - j - 1);
-              gsl_vector_view work = gsl_vector_subvector(tau_U, j, N - j - 1);
-              double * ptr = gsl_vector_ptr(&v.vector, 0);
-              double tmp = *ptr;
-
-              *ptr = 1.0;
-              gsl_linalg_householder_left (tau_j, &v.vector, &m.matrix, &work.vector);
-              *ptr = tmp;
+              gsl_matrix_set (A, j + i, j + i, d[i]);
+              gsl_matrix_set (A, j + i, j + i + 1, e[i]);
             }
 
-          gsl_vector_set (tau_U, j, tau_j);            
+          j += nb;
+        }
+
+      {
+        gsl_matrix_view Aj = gsl_matrix_submatrix (A, j, j, M - j, N - j);
+        gsl_vector_view tU = gsl_vector_subvector (tau_U, j, N - j);
+        gsl_vector_view tV = gsl_vector_subvector (tau_V, j, N - j - 1);
+
+        status = bidiag_decomp_L2 (&Aj.matrix, &tU.vector, &tV.vector, work);
+      }
+
+      linalg_workspace_release (w, work);
+
+      return status;
+    }
+}
+
+/* unblocked bidiagonal decomposition, Golub & Van Loan Algorithm 5.4.2;
+   work has length M */
+static int
+bidiag_decomp_L2 (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V,
+                  double * work)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  size_t j;
+  
+  for (j = 0 ; j < N; j++)
+    {
+      /* apply Householder transformation to current column */
+      gsl_vector_view v = gsl_matrix_subcolumn(A, j, j, M - j);
+      double tau_j = gsl_linalg_householder_transform (&v.vector);
+
+      /* apply the transformation to the remaining columns */
+      if (j + 1 < N)
+        {
+          gsl_matrix_view m = gsl_matrix_submatrix (A, j, j + 1, M - j, N - j - 1);
+          gsl_vector_view work = gsl_vector_subvector(tau_U, j, N - j - 1);
+          double * ptr = gsl_vector_ptr(&v.vector, 0);
+          double tmp = *ptr;
+
+          *ptr = 1.0;
+          gsl_linalg_householder_left (tau_j, &v.vector, &m.matrix, &work.vector);
+          *ptr = tmp;
+        }
 
-          /* apply Householder transformation to current row */
-          if (j + 1 < N)
+      gsl_vector_set (tau_U, j, tau_j);            
+
+      /* apply Householder transformation to current row */
+      if (j + 1 < N)
+        {
+          v = gsl_matrix_subrow (A, j, j + 1, N - j - 1);
+          tau_j = gsl_linalg_householder_transform (&v.vector);
+          
+          /* apply the transformation to the remaining rows */
+          if (j + 1 < M)
             {
-              v = gsl_matrix_subrow (A, j, j + 1, N - j - 1);
-              tau_j = gsl_linalg_householder_transform (&v.vector);
-              
-              /* apply the transformation to the remaining rows */
-              if (j + 1 < M)
-                {
-                  gsl_matrix_view m = gsl_matrix_submatrix (A, j + 1, j + 1, M - j - 1, N - j - 1);
-                  gsl_vector_view work = gsl_vector_subvector(tmp, 0, M - j - 1);
-                  gsl_linalg_householder_right (tau_j, &v.vector, &m.matrix, &work.vector);
-                }
-
-              gsl_vector_set (tau_V, j, tau_j);
+              gsl_matrix_view m = gsl_matrix_submatrix (A, j + 1, j + 1, M - j - 1, N - j - 1);
+              gsl_vector_view tmp = gsl_vector_view_array (work, M - j - 1);
+              gsl_linalg_householder_right (tau_j, &v.vector, &m.matrix, &tmp.vector);
             }
+
+          gsl_vector_set (tau_V, j, tau_j);
         }
+    }
 
-      gsl_vector_free(tmp);
+  return GSL_SUCCESS;
+}
 
-      return GSL_SUCCESS;
+/*
+bidiag_panel()
+  Reduce the first nb rows and columns of the m-by-n matrix A, m >= n > nb,
+without updating the trailing matrix A(nb:m, nb:n) (LAPACK dlabrd)
+
+Inputs: A     - m-by-n matrix
+        tau_U - (output) coefficients of the column reflectors, length nb
+        tau_V - (output) coefficients of the row reflectors, length nb
+        X     - (output) m-by-nb matrix
+        Y     - (output) n-by-nb matrix
+        d     - (output) diagonal of B, length nb
+        e     - (output) superdiagonal of B, length nb
+
+Notes:
+1) On output the reflectors are stored in A as in gsl_linalg_bidiag_decomp,
+except that A(i,i) and A(i,i+1) are set to 1; the trailing matrix must
+then be updated as A22 := A22 - V Y(nb:n,:)^T - X(nb:m,:) U^T.
+
+2) Before reflector i is computed, its row or column is brought up to
+date with the products of the previous reflectors of the panel, which
+the columns of X and Y represent.
+*/
+
+static void
+bidiag_panel (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V,
+              gsl_matrix * X, gsl_matrix * Y, double * d, double * e)
+{
+  const size_t m = A->size1;
+  const size_t n = A->size2;
+  const size_t nb = X->size2;
+  size_t i;
+
+  for (i = 0; i < nb; i++)
+    {
+      gsl_vector_view ai = gsl_matrix_subcolumn (A, i, i, m - i);
+      gsl_vector_view bi = gsl_matrix_subrow (A, i, i + 1, n - i - 1);
+      gsl_vector_view yi = gsl_matrix_subcolumn (Y, i, i + 1, n - i - 1);
+      gsl_vector_view xi = gsl_matrix_subcolumn (X, i, i + 1, m - i - 1);
+      gsl_matrix_view A22 = gsl_matrix_submatrix (A, i, i + 1, m - i, n - i - 1);
+      double tau;
+
+      /* update column i: A(i:m,i) -= A(i:m,0:i) Y(i,0:i)^T + X(i:m,0:i) A(0:i,i) */
+      if (i > 0)
+        {
+          gsl_matrix_view Ai = gsl_matrix_submatrix (A, i, 0, m - i, i);
+          gsl_matrix_view Xi = gsl_matrix_submatrix (X, i, 0, m - i, i);
+          gsl_vector_view y = gsl_matrix_subrow (Y, i, 0, i);
+          gsl_vector_view a = gsl_matrix_subcolumn (A, i, 0, i);
+
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Ai.matrix, &y.vector, 1.0, &ai.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Xi.matrix, &a.vector, 1.0, &ai.vector);
+        }
+
+      /* reflector annihilating A(i+1:m,i) */
+      tau = gsl_linalg_householder_transform (&ai.vector);
+      gsl_vector_set (tau_U, i, tau);
+      d[i] = gsl_matrix_get (A, i, i);
+      gsl_matrix_set (A, i, i, 1.0);
+
+      /* Y(i+1:n,i) = tau (A22^T - Y(i+1:n,0:i) A(i:m,0:i)^T - A(0:i,i+1:n)^T X(i:m,0:i)^T) v */
+      gsl_blas_dgemv (CblasTrans, 1.0, &A22.matrix, &ai.vector, 0.0, &yi.vector);
+
+      if (i > 0)
+        {
+          gsl_matrix_view Ai = gsl_matrix_submatrix (A, i, 0, m - i, i);
+          gsl_matrix_view Xi = gsl_matrix_submatrix (X, i, 0, m - i, i);
+          gsl_matrix_view Yi = gsl_matrix_submatrix (Y, i + 1, 0, n - i - 1, i);
+          gsl_matrix_view U = gsl_matrix_submatrix (A, 0, i + 1, i, n - i - 1);
+          gsl_vector_view w = gsl_matrix_subcolumn (Y, i, 0, i);
+
+          gsl_blas_dgemv (CblasTrans, 1.0, &Ai.matrix, &ai.vector, 0.0, &w.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Yi.matrix, &w.vector, 1.0, &yi.vector);
+          gsl_blas_dgemv (CblasTrans, 1.0, &Xi.matrix, &ai.vector, 0.0, &w.vector);
+          gsl_blas_dgemv (CblasTrans, -1.0, &U.matrix, &w.vector, 1.0, &yi.vector);
+        }
+
+      gsl_blas_dscal (tau, &yi.vector);
+
+      /* update row i: A(i,i+1:n) -= Y(i+1:n,0:i+1) A(i,0:i+1)^T + A(0:i,i+1:n)^T X(i,0:i)^T */
+      {
+        gsl_matrix_view Yi = gsl_matrix_submatrix (Y, i + 1, 0, n - i - 1, i + 1);
+        gsl_vector_view a = gsl_matrix_subrow (A, i, 0, i + 1);
+
+        gsl_blas_dgemv (CblasNoTrans, -1.0, &Yi.matrix, &a.vector, 1.0, &bi.vector);
+      }
+
+      if (i > 0)
+        {
+          gsl_matrix_view U = gsl_matrix_submatrix (A, 0, i + 1, i, n - i - 1);
+          gsl_vector_view x = gsl_matrix_subrow (X, i, 0, i);
+
+          gsl_blas_dgemv (CblasTrans, -1.0, &U.matrix, &x.vector, 1.0, &bi.vector);
+        }
+
+      /* reflector annihilating A(i,i+2:n) */
+      tau = gsl_linalg_householder_transform (&bi.vector);
+      gsl_vector_set (tau_V, i, tau);
+      e[i] = gsl_matrix_get (A, i, i + 1);
+      gsl_matrix_set (A, i, i + 1, 1.0);
+
+      /* X(i+1:m,i) = tau (A22 - A(i+1:m,0:i+1) Y(i+1:n,0:i+1)^T - X(i+1:m,0:i) A(0:i,i+1:n)) u */
+      {
+        gsl_matrix_view A2 = gsl_matrix_submatrix (A, i + 1, i + 1, m - i - 1, n - i - 1);
+        gsl_matrix_view Ai = gsl_matrix_submatrix (A, i + 1, 0, m - i - 1, i + 1);
+        gsl_matrix_view Yi = gsl_matrix_submatrix (Y, i + 1, 0, n - i - 1, i + 1);
+        gsl_vector_view w = gsl_matrix_subcolumn (X, i, 0, i + 1);
+
+        gsl_blas_dgemv (CblasNoTrans, 1.0, &A2.matrix, &bi.vector, 0.0, &xi.vector);
+        gsl_blas_dgemv (CblasTrans, 1.0, &Yi.matrix, &bi.vector, 0.0, &w.vector);
+        gsl_blas_dgemv (CblasNoTrans, -1.0, &Ai.matrix, &w.vector, 1.0, &xi.vector);
+      }
+
+      if (i > 0)
+        {
+          gsl_matrix_view U = gsl_matrix_submatrix (A, 0, i + 1, i, n - i - 1);
+          gsl_matrix_view Xi = gsl_matrix_submatrix (X, i + 1, 0, m - i - 1, i);
+          gsl_vector_view w = gsl_matrix_subcolumn (X, i, 0, i);
+
+          gsl_blas_dgemv (CblasNoTrans, 1.0, &U.matrix, &bi.vector, 0.0, &w.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Xi.matrix, &w.vector, 1.0, &xi.vector);
+        }
+
+      gsl_blas_dscal (tau, &xi.vector);
     }
 }
 
@@ -149,6 +402,45 @@ gsl_linalg_bidiag_unpack (const gsl_matrix * A,
                           gsl_matrix * V,
                           gsl_vector * diag, 
                           gsl_vector * superdiag)
+{
+  gsl_linalg_workspace w;
+  int status;
+
+  if (linalg_workspace_init (&w, gsl_linalg_bidiag_unpack_wsize (A->size1, A->size2)))
+    {
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  status = gsl_linalg_bidiag_unpack_ws (A, tau_U, U, tau_V, V, diag, superdiag, &w);
+
+  linalg_workspace_clear (&w);
+
+  return status;
+}
+
+/* size in doubles of the arena needed by gsl_linalg_bidiag_unpack_ws
+   and gsl_linalg_bidiag_unpack2_ws */
+
+size_t
+gsl_linalg_bidiag_unpack_wsize (const size_t M, const size_t N)
+{
+  (void) M;
+
+  if (N <= WY_CROSSOVER)
+    return 0;
+  else
+    return WY_BLOCK * (WY_BLOCK + N);
+}
+
+int
+gsl_linalg_bidiag_unpack_ws (const gsl_matrix * A, 
+                             const gsl_vector * tau_U, 
+                             gsl_matrix * U, 
+                             const gsl_vector * tau_V,
+                             gsl_matrix * V,
+                             gsl_vector * diag, 
+                             gsl_vector * superdiag,
+                             gsl_linalg_workspace * w)
 {
   const size_t M = A->size1;
   const size_t N = A->size2;
@@ -183,8 +475,13 @@ gsl_linalg_bidiag_unpack (const gsl_matrix * A,
     {
       GSL_ERROR ("size of subdiagonal must be (diagonal size - 1)", GSL_EBADLEN);
     }
+  else if (linalg_workspace_avail (w) < gsl_linalg_bidiag_unpack_wsize (M, N))
+    {
+      GSL_ERROR ("workspace is too small", GSL_EBADLEN);
+    }
   else
     {
+      double *work = linalg_workspace_get (w, gsl_linalg_bidiag_unpack_wsize (M, N));
       size_t i, j;
 
       /* Copy diagonal into diag */
@@ -203,39 +500,52 @@ gsl_linalg_bidiag_unpack (const gsl_matrix * A,
           gsl_vector_set (superdiag, i, Aij);
         }
 
-      /* Initialize V to the identity */
-
-      gsl_matrix_set_identity (V);
-
-      for (i = N - 1; i-- > 0;)
-        {
-          /* Householder row transformation to accumulate V */
-          gsl_vector_const_view h = gsl_matrix_const_subrow (A, i, i + 1, N - i - 1);
-          double ti = gsl_vector_get (tau_V, i);
-          gsl_matrix_view m = gsl_matrix_submatrix (V, i + 1, i + 1, N- i - 1, N - i - 1);
-          gsl_vector_view work = gsl_matrix_subrow(U, 0, 0, N - i - 1);
-          double * ptr = gsl_vector_ptr((gsl_vector *) &h.vector, 0);
-          double tmp = *ptr;
-
-          *ptr = 1.0;
-          gsl_linalg_householder_left (ti, &h.vector, &m.matrix, &work.vector);
-          *ptr = tmp;
-        }
+      bidiag_unpack_V (A, tau_V, V, work);
 
       /* Initialize U to the identity */
 
       gsl_matrix_set_identity (U);
 
-      for (j = N; j-- > 0;)
+      if (N <= WY_CROSSOVER)
         {
-          /* Householder column transformation to accumulate U */
-          gsl_vector_const_view h = gsl_matrix_const_subcolumn (A, j, j, M - j);
-          double tj = gsl_vector_get (tau_U, j);
-          gsl_matrix_view m = gsl_matrix_submatrix (U, j, j, M - j, N - j);
-          
-          gsl_linalg_householder_hm (tj, &h.vector, &m.matrix);
+          for (j = N; j-- > 0;)
+            {
+              /* Householder column transformation to accumulate U */
+              gsl_vector_const_view h = gsl_matrix_const_subcolumn (A, j, j, M - j);
+              double tj = gsl_vector_get (tau_U, j);
+              gsl_matrix_view m = gsl_matrix_submatrix (U, j, j, M - j, N - j);
+
+              gsl_linalg_householder_hm (tj, &h.vector, &m.matrix);
+            }
+        }
+      else
+        {
+          /* apply the reflectors in blocks, from last to first */
+          const size_t nb = WY_BLOCK;
+          gsl_matrix_view Tv = gsl_matrix_view_array (work, nb, nb);
+          gsl_matrix_view Wv = gsl_matrix_view_array (work + nb * nb, nb, N);
+          gsl_matrix *T = &Tv.matrix, *W = &Wv.matrix;
+          size_t i0;
+
+          for (i0 = ((N - 1) / nb) * nb; ; i0 -= nb)
+            {
+              const size_t ib = GSL_MIN (nb, N - i0);
+              gsl_matrix_const_view Vb = gsl_matrix_const_submatrix (A, i0, i0, M - i0, ib);
+              gsl_vector_const_view t = gsl_vector_const_subvector (tau_U, i0, ib);
+              gsl_matrix_view Tb = gsl_matrix_submatrix (T, 0, 0, ib, ib);
+              gsl_matrix_view C = gsl_matrix_submatrix (U, i0, i0, M - i0, N - i0);
+              gsl_matrix_view Wb = gsl_matrix_submatrix (W, 0, 0, ib, N - i0);
+
+              linalg_wy_T_col (&Vb.matrix, &t.vector, &Tb.matrix);
+              linalg_wy_left_col (CblasNoTrans, &Vb.matrix, &Tb.matrix, &C.matrix, &Wb.matrix);
+
+              if (i0 == 0)
+                break;
+            }
         }
 
+      linalg_workspace_release (w, work);
+
       return GSL_SUCCESS;
     }
 }
@@ -245,6 +555,28 @@ gsl_linalg_bidiag_unpack2 (gsl_matrix * A,
                            gsl_vector * tau_U, 
                            gsl_vector * tau_V,
                            gsl_matrix * V)
+{
+  gsl_linalg_workspace w;
+  int status;
+
+  if (linalg_workspace_init (&w, gsl_linalg_bidiag_unpack_wsize (A->size1, A->size2)))
+    {
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  status = gsl_linalg_bidiag_unpack2_ws (A, tau_U, tau_V, V, &w);
+
+  linalg_workspace_clear (&w);
+
+  return status;
+}
+
+int
+gsl_linalg_bidiag_unpack2_ws (gsl_matrix * A, 
+                              gsl_vector * tau_U, 
+                              gsl_vector * tau_V,
+                              gsl_matrix * V,
+                              gsl_linalg_workspace * w)
 {
   const size_t M = A->size1;
   const size_t N = A->size2;
@@ -267,28 +599,17 @@ gsl_linalg_bidiag_unpack2 (gsl_matrix * A,
     {
       GSL_ERROR ("size of V must be N x N", GSL_EBADLEN);
     }
+  else if (linalg_workspace_avail (w) < gsl_linalg_bidiag_unpack_wsize (M, N))
+    {
+      GSL_ERROR ("workspace is too small", GSL_EBADLEN);
+    }
   else
     {
+      double *work = linalg_workspace_get (w, gsl_linalg_bidiag_unpack_wsize (M, N));
       size_t i, j;
+      int status;
 
-      /* Initialize V to the identity */
-
-      gsl_matrix_set_identity (V);
-
-      for (i = N - 1; i-- > 0;)
-        {
-          /* Householder row transformation to accumulate V */
-          gsl_vector_const_view r = gsl_matrix_const_row (A, i);
-          gsl_vector_const_view h = 
-            gsl_vector_const_subvector (&r.vector, i + 1, N - (i+1));
-          
-          double ti = gsl_vector_get (tau_V, i);
-          
-          gsl_matrix_view m = 
-            gsl_matrix_submatrix (V, i + 1, i + 1, N-(i+1), N-(i+1));
-          
-          gsl_linalg_householder_hm (ti, &h.vector, &m.matrix);
-        }
+      bidiag_unpack_V (A, tau_V, V, work);
 
       /* Copy superdiagonal into tau_v */
 
@@ -298,21 +619,27 @@ gsl_linalg_bidiag_unpack2 (gsl_matrix * A,
           gsl_vector_set (tau_V, i, Aij);
         }
 
-      /* Allow U to be unpacked into the same memory as A, copy
-         diagonal into tau_U */
+      /* Allow U to be unpacked into the same memory as A: exchange
+         tau_U with the diagonal, which is not part of the Householder
+         vectors, and form U from the coefficients stored there */
 
-      for (j = N; j-- > 0;)
+      for (j = 0; j < N; j++)
         {
-          /* Householder column transformation to accumulate U */
           double tj = gsl_vector_get (tau_U, j);
           double Ajj = gsl_matrix_get (A, j, j);
-          gsl_matrix_view m = gsl_matrix_submatrix (A, j, j, M-j, N-j);
 
           gsl_vector_set (tau_U, j, Ajj);
-          gsl_linalg_householder_hm1 (tj, &m.matrix);
+          gsl_matrix_set (A, j, j, tj);
         }
 
-      return GSL_SUCCESS;
+      {
+        gsl_vector_view tau = gsl_matrix_diagonal (A);
+        status = linalg_wy_unpack_col (A, &tau.vector, work);
+      }
+
+      linalg_workspace_release (w, work);
+
+      return status;
     }
 }
 
@@ -358,3 +685,56 @@ gsl_linalg_bidiag_unpack_B (const gsl_matrix * A,
       return GSL_SUCCESS;
     }
 }
+
+/* Form the N-by-N matrix V = V_0 V_1 ... V_{N-2} from the row
+   reflectors of the packed bidiagonal matrix A; work holds
+   gsl_linalg_bidiag_unpack_wsize(N, N) doubles */
+static void
+bidiag_unpack_V (const gsl_matrix * A, const gsl_vector * tau_V, gsl_matrix * V,
+                 double * work)
+{
+  const size_t N = V->size1;
+
+  gsl_matrix_set_identity (V);
+
+  if (N <= WY_CROSSOVER)
+    {
+      size_t i;
+
+      for (i = N - 1; i-- > 0;)
+        {
+          /* Householder row transformation to accumulate V */
+          gsl_vector_const_view h = gsl_matrix_const_subrow (A, i, i + 1, N - (i+1));
+          double ti = gsl_vector_get (tau_V, i);
+          gsl_matrix_view m = gsl_matrix_submatrix (V, i + 1, i + 1, N-(i+1), N-(i+1));
+
+          gsl_linalg_householder_hm (ti, &h.vector, &m.matrix);
+        }
+    }
+  else
+    {
+      /* apply the N - 1 reflectors in blocks, from last to first */
+      const size_t K = N - 1;
+      const size_t nb = WY_BLOCK;
+      gsl_matrix_view Tv = gsl_matrix_view_array (work, nb, nb);
+      gsl_matrix_view Wv = gsl_matrix_view_array (work + nb * nb, nb, N);
+      gsl_matrix *T = &Tv.matrix, *W = &Wv.matrix;
+      size_t i0;
+
+      for (i0 = ((K - 1) / nb) * nb; ; i0 -= nb)
+        {
+          const size_t ib = GSL_MIN (nb, K - i0);
+          gsl_matrix_const_view Yb = gsl_matrix_const_submatrix (A, i0, i0 + 1, ib, N - i0 - 1);
+          gsl_vector_const_view t = gsl_vector_const_subvector (tau_V, i0, ib);
+          gsl_matrix_view Tb = gsl_matrix_submatrix (T, 0, 0, ib, ib);
+          gsl_matrix_view C = gsl_matrix_submatrix (V, i0 + 1, i0 + 1, N - i0 - 1, N - i0 - 1);
+          gsl_matrix_view Wb = gsl_matrix_submatrix (W, 0, 0, ib, N - i0 - 1);
+
+          linalg_wy_T_row (&Yb.matrix, &t.vector, &Tb.matrix);
+          linalg_wy_left_row (&Yb.matrix, &Tb.matrix, &C.matrix, &Wb.matrix);
+
+          if (i0 == 0)
+            break;
+        }
+    }
+}
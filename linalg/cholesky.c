@@ -32,6 +32,7 @@
  */
 
 #include <config.h>
+#include <stdlib.h>
 
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
@@ -41,11 +42,20 @@
 #include <gsl/gsl_linalg.h>
 
 #include "recurse.h"
+#include "tile_common.c"
 
 static double cholesky_norm1(const gsl_matrix * LLT, gsl_vector * work);
 static int cholesky_Ainv(CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params);
+static int cholesky_AinvX(CBLAS_TRANSPOSE_t TransA, gsl_matrix * X, void * params);
 static int cholesky_decomp_L2 (gsl_matrix * A);
 static int cholesky_decomp_L3 (gsl_matrix * A);
+static int cholesky_tile_task (void * arg, const size_t id, const size_t thread);
+
+typedef struct
+{
+  gsl_matrix * A;
+  const tile_task * tasks;
+} cholesky_tile_params;
 
 /*
 In GSL 2.2, we decided to modify the behavior of the Cholesky decomposition
@@ -95,10 +105,87 @@ gsl_linalg_cholesky_decomp1 (gsl_matrix * A)
     }
   else
     {
+      int status;
+
       /* save original matrix in upper triangle for later rcond calculation */
       gsl_matrix_transpose_tricpy(CblasLower, CblasUnit, A, A);
 
-      return cholesky_decomp_L3(A);
+      status = cholesky_decomp_L3(A);
+      if (status == GSL_EDOM)
+        {
+          GSL_ERROR("matrix is not positive definite", GSL_EDOM);
+        }
+
+      return status;
+    }
+}
+
+/*
+gsl_linalg_cholesky_decomp_par()
+  Perform Cholesky decomposition of a symmetric positive
+definite matrix using lower triangle, with the tasks of a
+tiled algorithm run on a pool of threads
+
+Inputs: A    - (input) symmetric, positive definite matrix
+               (output) lower triangle contains Cholesky factor
+        pool - thread pool, or NULL to run in the calling thread
+
+Return: success/error
+
+Notes:
+1) original matrix is saved in upper triangle on output, as in
+gsl_linalg_cholesky_decomp1()
+
+2) the matrix is divided into tiles of size TILE_NB, and the
+factorization, triangular solves and updates of the tiles are
+scheduled as a task graph (tile_common.c). The result does not depend
+on the number of threads.
+*/
+
+int
+gsl_linalg_cholesky_decomp_par (gsl_matrix * A, gsl_thread_pool * pool)
+{
+  const size_t N = A->size1;
+
+  if (N != A->size2)
+    {
+      GSL_ERROR("Cholesky decomposition requires square matrix", GSL_ENOTSQR);
+    }
+  else if (N <= TILE_NB)
+    {
+      return gsl_linalg_cholesky_decomp1(A);
+    }
+  else
+    {
+      const size_t nt = (N + TILE_NB - 1) / TILE_NB;
+      cholesky_tile_params params;
+      thread_dag * dag;
+      tile_task * tasks;
+      size_t ntasks;
+      int status;
+
+      tasks = tile_sym_tasks(nt, &dag, &ntasks);
+      if (tasks == NULL)
+        {
+          GSL_ERROR("failed to allocate tasks", GSL_ENOMEM);
+        }
+
+      /* save original matrix in upper triangle for later rcond calculation */
+      gsl_matrix_transpose_tricpy(CblasLower, CblasUnit, A, A);
+
+      params.A = A;
+      params.tasks = tasks;
+      status = thread_dag_run(pool, dag, cholesky_tile_task, &params);
+
+      thread_dag_free(dag);
+      free(tasks);
+
+      if (status == GSL_EDOM)
+        {
+          GSL_ERROR("matrix is not positive definite", GSL_EDOM);
+        }
+
+      return status;
     }
 }
 
@@ -535,6 +622,47 @@ gsl_linalg_cholesky_rcond (const gsl_matrix * LLT, double * rcond,
     }
 }
 
+/* as gsl_linalg_cholesky_rcond, estimating ||A^{-1}||_1 with the block estimator */
+int
+gsl_linalg_cholesky_rcond_block (const gsl_matrix * LLT, double * rcond,
+                                 gsl_linalg_condest_workspace * w)
+{
+  const size_t M = LLT->size1;
+  const size_t N = LLT->size2;
+
+  if (M != N)
+    {
+      GSL_ERROR ("cholesky matrix must be square", GSL_ENOTSQR);
+    }
+  else if (N != w->N)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      int status;
+      double Anorm = cholesky_norm1(LLT, w->work); /* ||A||_1 */
+      double Ainvnorm;                             /* ||A^{-1}||_1 */
+
+      *rcond = 0.0;
+
+      /* don't continue if matrix is singular */
+      if (Anorm == 0.0)
+        return GSL_SUCCESS;
+
+      /* estimate ||A^{-1}||_1 */
+      status = gsl_linalg_invnorm1_block(cholesky_AinvX, (void *) LLT, &Ainvnorm, w);
+
+      if (status)
+        return status;
+
+      if (Ainvnorm != 0.0)
+        *rcond = (1.0 / Anorm) / Ainvnorm;
+
+      return GSL_SUCCESS;
+    }
+}
+
 /* compute 1-norm of original matrix, stored in upper triangle of LLT;
  * diagonal entries have to be reconstructed */
 static double
@@ -597,6 +725,28 @@ cholesky_Ainv(CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params)
   return GSL_SUCCESS;
 }
 
+/* X := A^{-1} X = L^{-t} L^{-1} X */
+static int
+cholesky_AinvX(CBLAS_TRANSPOSE_t TransA, gsl_matrix * X, void * params)
+{
+  int status;
+  gsl_matrix * A = (gsl_matrix * ) params;
+
+  (void) TransA; /* unused parameter warning */
+
+  /* compute L^{-1} X */
+  status = gsl_blas_dtrsm(CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit, 1.0, A, X);
+  if (status)
+    return status;
+
+  /* compute L^{-t} X */
+  status = gsl_blas_dtrsm(CblasLeft, CblasLower, CblasTrans, CblasNonUnit, 1.0, A, X);
+  if (status)
+    return status;
+
+  return GSL_SUCCESS;
+}
+
 /*
 cholesky_decomp_L2()
   Perform Cholesky decomposition of a symmetric positive
@@ -605,7 +755,9 @@ definite matrix using lower triangle
 Inputs: A - (input) symmetric, positive definite matrix
             (output) lower triangle contains Cholesky factor
 
-Return: success/error
+Return: success, or GSL_EDOM if A is not positive definite; the
+        error handler is not called, so the function may run in a
+        thread of a pool
 
 Notes:
 1) Based on algorithm 4.2.1 (Gaxpy Cholesky) of Golub and
@@ -641,9 +793,7 @@ cholesky_decomp_L2 (gsl_matrix * A)
           ajj = gsl_matrix_get(A, j, j);
 
           if (ajj <= 0.0)
-            {
-              GSL_ERROR("matrix is not positive definite", GSL_EDOM);
-            }
+            return GSL_EDOM; /* not positive definite, reported by the caller */
 
           ajj = sqrt(ajj);
           gsl_vector_scale(&v.vector, 1.0 / ajj);
@@ -722,3 +872,43 @@ cholesky_decomp_L3 (gsl_matrix * A)
     }
 }
 
+/* execute task id of the tiled Cholesky factorization */
+static int
+cholesky_tile_task (void * arg, const size_t id, const size_t thread)
+{
+  cholesky_tile_params * params = (cholesky_tile_params *) arg;
+  const tile_task * t = &params->tasks[id];
+  gsl_matrix_view Aij = tile_view(params->A, t->i, t->j);
+
+  (void) thread;
+
+  switch (t->op)
+    {
+      case TILE_DIAG:
+        return cholesky_decomp_L3(&Aij.matrix);
+
+      case TILE_TRSM:
+        {
+          gsl_matrix_view Akk = tile_view(params->A, t->k, t->k);
+          gsl_blas_dtrsm(CblasRight, CblasLower, CblasTrans, CblasNonUnit, 1.0, &Akk.matrix, &Aij.matrix);
+          break;
+        }
+
+      case TILE_SYRK:
+        {
+          gsl_matrix_view Aik = tile_view(params->A, t->i, t->k);
+          gsl_blas_dsyrk(CblasLower, CblasNoTrans, -1.0, &Aik.matrix, 1.0, &Aij.matrix);
+          break;
+        }
+
+      case TILE_GEMM:
+        {
+          gsl_matrix_view Aik = tile_view(params->A, t->i, t->k);
+          gsl_matrix_view Ajk = tile_view(params->A, t->j, t->k);
+          gsl_blas_dgemm(CblasNoTrans, CblasTrans, -1.0, &Aik.matrix, &Ajk.matrix, 1.0, &Aij.matrix);
+          break;
+        }
+    }
+
+  return GSL_SUCCESS;
+}
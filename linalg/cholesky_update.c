@@ -0,0 +1,1030 @@
+/* linalg/cholesky_update.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This module contains routines to modify the Cholesky factorization
+ * A = L L^T and the factorization A = L D L^T after a symmetric rank-k
+ * change of A,
+ *
+ * A~ = A + V V^T    (update)
+ * A~ = A - V V^T    (downdate)
+ *
+ * where V is N-by-k, in O(k N^2) operations.
+ *
+ * Rank-1 updates apply Givens rotations which annihilate v against the
+ * columns of L. Rank-k updates compute the LQ decomposition of [ L V ]
+ * one block of rows of L at a time, using the "triangle on top of
+ * rectangle" QR decomposition of gsl_linalg_QR_TR_decomp() for the block
+ * and Level 3 BLAS for the rows below it.
+ *
+ * Downdates use the method of LINPACK dchdd: with L p = v, the rotations
+ * which reduce [ p ; rho ], rho = sqrt(1 - p^T p), to [ 0 ; 1 ] transform
+ * L^T into the new factor. A~ is positive definite if and only if
+ * p^T p < 1, which is checked before L is modified; for rank-k downdates
+ * the equivalent condition is that I - P^T P is positive definite, with
+ * L P = V.
+ *
+ * An L D L^T factorization with positive D is modified as the Cholesky
+ * factor L D^{1/2}. Otherwise, rank-1 modifications use method C1 of
+ * Gill, Golub, Murray and Saunders, Math. Comp. 28 (1974).
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+
+/* rows of L per block of the rank-k update */
+#define CHOLESKY_UPDATE_NB 32
+
+static void cholesky_update_upper (gsl_matrix * LLT, const gsl_matrix * V, const double alpha);
+static void cholesky_update_L (gsl_matrix * L, gsl_vector * v);
+static int cholesky_update_blocked (gsl_matrix * L, gsl_matrix * V);
+static int cholesky_downdate_L (gsl_matrix * L, gsl_vector * v, const double tol);
+static int cholesky_downdate_check (const gsl_matrix * L, CBLAS_DIAG_t Diag,
+                                    const gsl_matrix * V, gsl_matrix * P, gsl_matrix * C);
+static int ldlt_to_cholesky (gsl_matrix * LDLT, gsl_vector * work);
+static void ldlt_from_cholesky (gsl_matrix * LDLT, gsl_vector * work);
+static int ldlt_update_C1 (gsl_matrix * LDLT, const double alpha, gsl_vector * v, gsl_vector * work);
+static int ldlt_update_norm (gsl_matrix * LDLT, gsl_vector * work);
+static int ldlt_Ax (CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params);
+static int ldlt_modify (gsl_matrix * LDLT, gsl_matrix * V, const int downdate);
+
+/*
+gsl_linalg_cholesky_update()
+  Update the Cholesky factorization of A to that of A + v v^T
+
+Inputs: LLT - on input, Cholesky factorization of A computed by
+              gsl_linalg_cholesky_decomp1()
+              on output, Cholesky factorization of A + v v^T
+        v   - on input, vector of length N
+              on output, overwritten
+
+Return: success/error
+
+Notes:
+1) The strict upper triangle of LLT, which holds the matrix A for
+gsl_linalg_cholesky_rcond(), is updated to A + v v^T
+*/
+
+int
+gsl_linalg_cholesky_update (gsl_matrix * LLT, gsl_vector * v)
+{
+  const size_t N = LLT->size1;
+
+  if (N != LLT->size2)
+    {
+      GSL_ERROR ("Cholesky matrix must be square", GSL_ENOTSQR);
+    }
+  else if (v->size != N)
+    {
+      GSL_ERROR ("v must have length N", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_matrix_view V = gsl_matrix_view_array_with_tda (v->data, N, 1, v->stride);
+
+      cholesky_update_upper (LLT, &V.matrix, 1.0);
+      cholesky_update_L (LLT, v);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_linalg_cholesky_downdate()
+  Update the Cholesky factorization of A to that of A - v v^T
+
+Inputs: LLT - on input, Cholesky factorization of A computed by
+              gsl_linalg_cholesky_decomp1()
+              on output, Cholesky factorization of A - v v^T
+        v   - on input, vector of length N
+              on output, overwritten
+
+Return: success, or GSL_EDOM if A - v v^T is not numerically positive
+definite, in which case LLT is not modified
+
+Notes:
+1) The strict upper triangle of LLT is updated to A - v v^T
+*/
+
+int
+gsl_linalg_cholesky_downdate (gsl_matrix * LLT, gsl_vector * v)
+{
+  const size_t N = LLT->size1;
+
+  if (N != LLT->size2)
+    {
+      GSL_ERROR ("Cholesky matrix must be square", GSL_ENOTSQR);
+    }
+  else if (v->size != N)
+    {
+      GSL_ERROR ("v must have length N", GSL_EBADLEN);
+    }
+  else
+    {
+      size_t i;
+      int status = cholesky_downdate_L (LLT, v, GSL_DBL_EPSILON);
+
+      if (status)
+        {
+          GSL_ERROR ("downdated matrix is not positive definite", GSL_EDOM);
+        }
+
+      /* on output of cholesky_downdate_L, v holds the original vector */
+      for (i = 0; i + 1 < N; ++i)
+        {
+          gsl_vector_view r = gsl_matrix_subrow (LLT, i, i + 1, N - i - 1);
+          gsl_vector_const_view w = gsl_vector_const_subvector (v, i + 1, N - i - 1);
+          gsl_blas_daxpy (-gsl_vector_get (v, i), &w.vector, &r.vector);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_linalg_cholesky_update_rankk()
+  Update the Cholesky factorization of A to that of A + V V^T
+
+Inputs: LLT - on input, Cholesky factorization of A computed by
+              gsl_linalg_cholesky_decomp1()
+              on output, Cholesky factorization of A + V V^T
+        V   - on input, N-by-k matrix
+              on output, overwritten
+
+Return: success/error
+*/
+
+int
+gsl_linalg_cholesky_update_rankk (gsl_matrix * LLT, gsl_matrix * V)
+{
+  const size_t N = LLT->size1;
+
+  if (N != LLT->size2)
+    {
+      GSL_ERROR ("Cholesky matrix must be square", GSL_ENOTSQR);
+    }
+  else if (V->size1 != N)
+    {
+      GSL_ERROR ("V must have N rows", GSL_EBADLEN);
+    }
+  else if (V->size2 == 0)
+    {
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      cholesky_update_upper (LLT, V, 1.0);
+
+      if (V->size2 == 1)
+        {
+          gsl_vector_view v = gsl_matrix_column (V, 0);
+          cholesky_update_L (LLT, &v.vector);
+          return GSL_SUCCESS;
+        }
+
+      return cholesky_update_blocked (LLT, V);
+    }
+}
+
+/*
+gsl_linalg_cholesky_downdate_rankk()
+  Update the Cholesky factorization of A to that of A - V V^T
+
+Inputs: LLT - on input, Cholesky factorization of A computed by
+              gsl_linalg_cholesky_decomp1()
+              on output, Cholesky factorization of A - V V^T
+        V   - on input, N-by-k matrix
+              on output, overwritten
+
+Return: success, or GSL_EDOM if A - V V^T is not numerically positive
+definite, in which case LLT is not modified
+*/
+
+int
+gsl_linalg_cholesky_downdate_rankk (gsl_matrix * LLT, gsl_matrix * V)
+{
+  const size_t N = LLT->size1;
+  const size_t k = V->size2;
+
+  if (N != LLT->size2)
+    {
+      GSL_ERROR ("Cholesky matrix must be square", GSL_ENOTSQR);
+    }
+  else if (V->size1 != N)
+    {
+      GSL_ERROR ("V must have N rows", GSL_EBADLEN);
+    }
+  else if (k == 0)
+    {
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      int status;
+      size_t j;
+      gsl_matrix *P = gsl_matrix_alloc (N, k);
+      gsl_matrix *C = gsl_matrix_alloc (k, k);
+      gsl_matrix *L0 = gsl_matrix_alloc (N, N);
+
+      if (P == NULL || C == NULL || L0 == NULL)
+        {
+          if (P)
+            gsl_matrix_free (P);
+          if (C)
+            gsl_matrix_free (C);
+          if (L0)
+            gsl_matrix_free (L0);
+          GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+        }
+
+      status = cholesky_downdate_check (LLT, CblasNonUnit, V, P, C);
+
+      gsl_matrix_free (P);
+      gsl_matrix_free (C);
+
+      if (status)
+        {
+          gsl_matrix_free (L0);
+          GSL_ERROR ("downdated matrix is not positive definite", GSL_EDOM);
+        }
+
+      gsl_matrix_memcpy (L0, LLT);
+
+      cholesky_update_upper (LLT, V, -1.0);
+
+      /*
+       * the check above guarantees that these succeed, up to rounding;
+       * if one fails anyway, the previous columns have already been
+       * applied, so LLT is restored from the copy
+       */
+      for (j = 0; j < k && status == GSL_SUCCESS; ++j)
+        {
+          gsl_vector_view v = gsl_matrix_column (V, j);
+          status = cholesky_downdate_L (LLT, &v.vector, 0.0);
+        }
+
+      if (status)
+        gsl_matrix_memcpy (LLT, L0);
+
+      gsl_matrix_free (L0);
+
+      if (status)
+        {
+          GSL_ERROR ("downdated matrix is not positive definite", GSL_EDOM);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_linalg_ldlt_update()
+  Update the L D L^T factorization of A to that of A + v v^T
+
+Inputs: LDLT - on input, L D L^T factorization of A computed by
+               gsl_linalg_ldlt_decomp()
+               on output, L D L^T factorization of A + v v^T
+        v    - on input, vector of length N
+               on output, overwritten
+
+Return: success, or GSL_EDOM if A + v v^T is singular, in which case
+LDLT is not modified
+
+Notes:
+1) The 1-norm of A stored in the upper right corner is replaced by an
+estimate of the 1-norm of A + v v^T
+*/
+
+int
+gsl_linalg_ldlt_update (gsl_matrix * LDLT, gsl_vector * v)
+{
+  const size_t N = LDLT->size1;
+
+  if (N != LDLT->size2)
+    {
+      GSL_ERROR ("LDLT matrix must be square", GSL_ENOTSQR);
+    }
+  else if (v->size != N)
+    {
+      GSL_ERROR ("v must have length N", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_matrix_view V = gsl_matrix_view_array_with_tda (v->data, N, 1, v->stride);
+      return ldlt_modify (LDLT, &V.matrix, 0);
+    }
+}
+
+/*
+gsl_linalg_ldlt_downdate()
+  Update the L D L^T factorization of A to that of A - v v^T
+
+Inputs: LDLT - on input, L D L^T factorization of A computed by
+               gsl_linalg_ldlt_decomp()
+               on output, L D L^T factorization of A - v v^T
+        v    - on input, vector of length N
+               on output, overwritten
+
+Return: success, or GSL_EDOM if the downdate fails, in which case LDLT
+is not modified. If D is positive, the downdate fails when A - v v^T
+is not numerically positive definite; otherwise when it is singular.
+*/
+
+int
+gsl_linalg_ldlt_downdate (gsl_matrix * LDLT, gsl_vector * v)
+{
+  const size_t N = LDLT->size1;
+
+  if (N != LDLT->size2)
+    {
+      GSL_ERROR ("LDLT matrix must be square", GSL_ENOTSQR);
+    }
+  else if (v->size != N)
+    {
+      GSL_ERROR ("v must have length N", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_matrix_view V = gsl_matrix_view_array_with_tda (v->data, N, 1, v->stride);
+      return ldlt_modify (LDLT, &V.matrix, 1);
+    }
+}
+
+/*
+gsl_linalg_ldlt_update_rankk()
+  Update the L D L^T factorization of A to that of A + V V^T
+
+Inputs: LDLT - on input, L D L^T factorization of A computed by
+               gsl_linalg_ldlt_decomp()
+               on output, L D L^T factorization of A + V V^T
+        V    - on input, N-by-k matrix
+               on output, overwritten
+
+Return: success/error
+
+Notes:
+1) If D is not positive, the columns of V are applied one at a time,
+and on failure LDLT holds the factorization after the preceding columns
+*/
+
+int
+gsl_linalg_ldlt_update_rankk (gsl_matrix * LDLT, gsl_matrix * V)
+{
+  const size_t N = LDLT->size1;
+
+  if (N != LDLT->size2)
+    {
+      GSL_ERROR ("LDLT matrix must be square", GSL_ENOTSQR);
+    }
+  else if (V->size1 != N)
+    {
+      GSL_ERROR ("V must have N rows", GSL_EBADLEN);
+    }
+  else
+    {
+      return ldlt_modify (LDLT, V, 0);
+    }
+}
+
+/*
+gsl_linalg_ldlt_downdate_rankk()
+  Update the L D L^T factorization of A to that of A - V V^T
+
+Inputs: LDLT - on input, L D L^T factorization of A computed by
+               gsl_linalg_ldlt_decomp()
+               on output, L D L^T factorization of A - V V^T
+        V    - on input, N-by-k matrix
+               on output, overwritten
+
+Return: success/error
+
+Notes:
+1) If D is positive, LDLT is not modified when A - V V^T is not
+numerically positive definite; otherwise the columns of V are applied
+one at a time, as for gsl_linalg_ldlt_update_rankk()
+*/
+
+int
+gsl_linalg_ldlt_downdate_rankk (gsl_matrix * LDLT, gsl_matrix * V)
+{
+  const size_t N = LDLT->size1;
+
+  if (N != LDLT->size2)
+    {
+      GSL_ERROR ("LDLT matrix must be square", GSL_ENOTSQR);
+    }
+  else if (V->size1 != N)
+    {
+      GSL_ERROR ("V must have N rows", GSL_EBADLEN);
+    }
+  else
+    {
+      return ldlt_modify (LDLT, V, 1);
+    }
+}
+
+/* A := A + alpha V V^T in the strict upper triangle of LLT */
+static void
+cholesky_update_upper (gsl_matrix * LLT, const gsl_matrix * V, const double alpha)
+{
+  const size_t N = LLT->size1;
+  size_t i;
+
+  for (i = 0; i + 1 < N; ++i)
+    {
+      gsl_vector_view r = gsl_matrix_subrow (LLT, i, i + 1, N - i - 1);
+      gsl_matrix_const_view W = gsl_matrix_const_submatrix (V, i + 1, 0, N - i - 1, V->size2);
+      gsl_vector_const_view vi = gsl_matrix_const_row (V, i);
+
+      gsl_blas_dgemv (CblasNoTrans, alpha, &W.matrix, &vi.vector, 1.0, &r.vector);
+    }
+}
+
+/*
+cholesky_update_L()
+  L := chol(L L^T + v v^T), using Givens rotations G_j which
+zero v_j against L_jj:
+
+[ L v ] G_0 ... G_{N-1} = [ L~ 0 ]
+
+Only the lower triangle of L is accessed; v is overwritten
+*/
+
+static void
+cholesky_update_L (gsl_matrix * L, gsl_vector * v)
+{
+  const size_t N = L->size1;
+  size_t j;
+
+  for (j = 0; j < N; ++j)
+    {
+      double *Ljj = gsl_matrix_ptr (L, j, j);
+      double vj = gsl_vector_get (v, j);
+      double r = hypot (*Ljj, vj);
+      double c, s;
+
+      if (r == 0.0)
+        continue;
+
+      c = *Ljj / r;
+      s = vj / r;
+
+      *Ljj = r;
+      gsl_vector_set (v, j, 0.0);
+
+      if (j + 1 < N)
+        {
+          gsl_vector_view lj = gsl_matrix_subcolumn (L, j, j + 1, N - j - 1);
+          gsl_vector_view w = gsl_vector_subvector (v, j + 1, N - j - 1);
+
+          /* l := c l + s w, w := c w - s l */
+          gsl_blas_drot (&lj.vector, &w.vector, c, s);
+        }
+    }
+}
+
+/*
+cholesky_update_blocked()
+  L := chol(L L^T + V V^T) for an N-by-k matrix V. For each block J
+of rows of L, with B the rows below J, the LQ decomposition
+
+[ L_JJ  V_J ] = [ R^T 0 ] Q^T
+
+is computed from the QR decomposition of [ L_JJ^T ; V_J^T ], with
+Q = I - U T U^T, U = [ I ; Y ]. The rows below are transformed as
+
+[ L_BJ  V_B ] := [ L_BJ  V_B ] Q,
+
+that is, with W = (L_BJ + V_B Y) T,
+
+L_BJ := L_BJ - W,  V_B := V_B - W Y^T
+
+Finally the columns of R^T and L_BJ are scaled by the signs of diag(R),
+so that the diagonal of L remains positive.
+*/
+
+static int
+cholesky_update_blocked (gsl_matrix * L, gsl_matrix * V)
+{
+  const size_t N = L->size1;
+  const size_t k = V->size2;
+  const size_t nb = GSL_MIN (N, CHOLESKY_UPDATE_NB);
+  gsl_matrix *S = gsl_matrix_alloc (nb, nb);
+  gsl_matrix *Y = gsl_matrix_alloc (k, nb);
+  gsl_matrix *T = gsl_matrix_alloc (nb, nb);
+  gsl_matrix *W = gsl_matrix_alloc (N, nb);
+  size_t j0;
+
+  if (S == NULL || Y == NULL || T == NULL || W == NULL)
+    {
+      if (S)
+        gsl_matrix_free (S);
+      if (Y)
+        gsl_matrix_free (Y);
+      if (T)
+        gsl_matrix_free (T);
+      if (W)
+        gsl_matrix_free (W);
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  for (j0 = 0; j0 < N; j0 += nb)
+    {
+      const size_t b = GSL_MIN (nb, N - j0);
+      const size_t m = N - j0 - b;
+      gsl_matrix_view Sb = gsl_matrix_submatrix (S, 0, 0, b, b);
+      gsl_matrix_view Yb = gsl_matrix_submatrix (Y, 0, 0, k, b);
+      gsl_matrix_view Tb = gsl_matrix_submatrix (T, 0, 0, b, b);
+      gsl_matrix_view LJJ = gsl_matrix_submatrix (L, j0, j0, b, b);
+      gsl_matrix_view VJ = gsl_matrix_submatrix (V, j0, 0, b, k);
+      size_t a, c;
+
+      /* S := L_JJ^T, Y := V_J^T */
+      for (a = 0; a < b; ++a)
+        {
+          for (c = a; c < b; ++c)
+            gsl_matrix_set (&Sb.matrix, a, c, gsl_matrix_get (&LJJ.matrix, c, a));
+        }
+
+      gsl_matrix_transpose_memcpy (&Yb.matrix, &VJ.matrix);
+
+      gsl_linalg_QR_TR_decomp (&Sb.matrix, &Yb.matrix, &Tb.matrix);
+
+      if (m > 0)
+        {
+          gsl_matrix_view LBJ = gsl_matrix_submatrix (L, j0 + b, j0, m, b);
+          gsl_matrix_view VB = gsl_matrix_submatrix (V, j0 + b, 0, m, k);
+          gsl_matrix_view Wb = gsl_matrix_submatrix (W, 0, 0, m, b);
+
+          gsl_matrix_memcpy (&Wb.matrix, &LBJ.matrix);
+          gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &VB.matrix, &Yb.matrix, 1.0, &Wb.matrix);
+          gsl_blas_dtrmm (CblasRight, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0, &Tb.matrix, &Wb.matrix);
+          gsl_matrix_sub (&LBJ.matrix, &Wb.matrix);
+          gsl_blas_dgemm (CblasNoTrans, CblasTrans, -1.0, &Wb.matrix, &Yb.matrix, 1.0, &VB.matrix);
+        }
+
+      /* L_JJ := R^T diag(sign(R)), L_BJ := L_BJ diag(sign(R)) */
+      for (a = 0; a < b; ++a)
+        {
+          const double sign = (gsl_matrix_get (&Sb.matrix, a, a) < 0.0) ? -1.0 : 1.0;
+
+          for (c = a; c < b; ++c)
+            gsl_matrix_set (&LJJ.matrix, c, a, sign * gsl_matrix_get (&Sb.matrix, a, c));
+
+          if (m > 0 && sign < 0.0)
+            {
+              gsl_vector_view l = gsl_matrix_subcolumn (L, j0 + a, j0 + b, m);
+              gsl_vector_scale (&l.vector, -1.0);
+            }
+        }
+    }
+
+  gsl_matrix_free (S);
+  gsl_matrix_free (Y);
+  gsl_matrix_free (T);
+  gsl_matrix_free (W);
+
+  return GSL_SUCCESS;
+}
+
+/*
+cholesky_downdate_L()
+  L := chol(L L^T - v v^T). With L p = v and rho = sqrt(1 - p^T p),
+the rotations G_j, j = N-1, ..., 0 reduce [ p ; rho ] to [ 0 ; 1 ]
+and transform
+
+[ L^T ]  into  [ L~^T ]
+[  0  ]        [  v^T ]
+
+Inputs: L   - Cholesky factor, lower triangle
+        v   - on input, vector v
+              on output, v recomputed from the rotations
+        tol - the downdate fails if 1 - p^T p <= tol
+
+Return: success, or GSL_EDOM if the downdate fails, in which case
+L is not modified
+*/
+
+static int
+cholesky_downdate_L (gsl_matrix * L, gsl_vector * v, const double tol)
+{
+  const size_t N = L->size1;
+  double pnorm, rho;
+  size_t i;
+
+  gsl_blas_dtrsv (CblasLower, CblasNoTrans, CblasNonUnit, L, v);
+
+  pnorm = gsl_blas_dnrm2 (v);
+  rho = (1.0 - pnorm) * (1.0 + pnorm);
+
+  if (!(rho > tol))
+    return GSL_EDOM;
+
+  rho = sqrt (rho);
+
+  for (i = N; i-- > 0; )
+    {
+      const double pi = gsl_vector_get (v, i);
+      const double t = hypot (rho, pi);
+      const double c = rho / t;
+      const double s = pi / t;
+      gsl_vector_view x = gsl_vector_subvector (v, i, N - i);
+      gsl_vector_view li = gsl_matrix_subcolumn (L, i, i, N - i);
+
+      rho = t;
+
+      /* x := c x + s l, l := c l - s x */
+      gsl_vector_set (v, i, 0.0);
+      gsl_blas_drot (&x.vector, &li.vector, c, s);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+cholesky_downdate_check()
+  Check that L L^T - V V^T is numerically positive definite, where
+L is the Cholesky factor (Diag = CblasNonUnit), or the unit lower
+triangular factor of L D L^T with D on the diagonal (Diag = CblasUnit).
+
+With L P = V (and P := D^{-1/2} P for L D L^T), this holds if and only if
+C = I - P^T P is positive definite, which is checked by computing its
+Cholesky factorization with pivots larger than GSL_DBL_EPSILON.
+
+Inputs: L - factorization
+        V - N-by-k matrix
+        P - workspace, N-by-k
+        C - workspace, k-by-k
+
+Return: success or GSL_EDOM
+*/
+
+static int
+cholesky_downdate_check (const gsl_matrix * L, CBLAS_DIAG_t Diag,
+                         const gsl_matrix * V, gsl_matrix * P, gsl_matrix * C)
+{
+  const size_t k = V->size2;
+  size_t i, j, l;
+
+  gsl_matrix_memcpy (P, V);
+  gsl_blas_dtrsm (CblasLeft, CblasLower, CblasNoTrans, Diag, 1.0, L, P);
+
+  if (Diag == CblasUnit)
+    {
+      for (i = 0; i < P->size1; ++i)
+        {
+          gsl_vector_view r = gsl_matrix_row (P, i);
+          gsl_vector_scale (&r.vector, 1.0 / sqrt (gsl_matrix_get (L, i, i)));
+        }
+    }
+
+  gsl_matrix_set_identity (C);
+  gsl_blas_dsyrk (CblasLower, CblasTrans, -1.0, P, 1.0, C);
+
+  /* unblocked Cholesky factorization of the small matrix C */
+  for (j = 0; j < k; ++j)
+    {
+      double cjj = gsl_matrix_get (C, j, j);
+
+      for (l = 0; l < j; ++l)
+        cjj -= gsl_matrix_get (C, j, l) * gsl_matrix_get (C, j, l);
+
+      if (!(cjj > GSL_DBL_EPSILON))
+        return GSL_EDOM;
+
+      cjj = sqrt (cjj);
+      gsl_matrix_set (C, j, j, cjj);
+
+      for (i = j + 1; i < k; ++i)
+        {
+          double cij = gsl_matrix_get (C, i, j);
+
+          for (l = 0; l < j; ++l)
+            cij -= gsl_matrix_get (C, i, l) * gsl_matrix_get (C, j, l);
+
+          gsl_matrix_set (C, i, j, cij / cjj);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+ldlt_to_cholesky()
+  If D > 0, replace L by L D^{1/2} in the lower triangle of LDLT;
+otherwise return GSL_EDOM without modifying LDLT.
+
+Inputs: LDLT - L D L^T factorization
+        work - workspace, length at least N
+*/
+
+static int
+ldlt_to_cholesky (gsl_matrix * LDLT, gsl_vector * work)
+{
+  const size_t N = LDLT->size1;
+  gsl_vector_view diag = gsl_matrix_diagonal (LDLT);
+  gsl_vector_view s = gsl_vector_subvector (work, 0, N);
+  size_t i;
+
+  if (!(gsl_vector_min (&diag.vector) > 0.0))
+    return GSL_EDOM;
+
+  for (i = 0; i < N; ++i)
+    gsl_vector_set (&s.vector, i, sqrt (gsl_vector_get (&diag.vector, i)));
+
+  for (i = 1; i < N; ++i)
+    {
+      gsl_vector_view r = gsl_matrix_subrow (LDLT, i, 0, i);
+      gsl_vector_view si = gsl_vector_subvector (&s.vector, 0, i);
+      gsl_vector_mul (&r.vector, &si.vector);
+    }
+
+  gsl_vector_memcpy (&diag.vector, &s.vector);
+
+  return GSL_SUCCESS;
+}
+
+/* inverse of ldlt_to_cholesky() */
+static void
+ldlt_from_cholesky (gsl_matrix * LDLT, gsl_vector * work)
+{
+  const size_t N = LDLT->size1;
+  gsl_vector_view diag = gsl_matrix_diagonal (LDLT);
+  gsl_vector_view s = gsl_vector_subvector (work, 0, N);
+  size_t i;
+
+  gsl_vector_memcpy (&s.vector, &diag.vector);
+
+  for (i = 1; i < N; ++i)
+    {
+      gsl_vector_view r = gsl_matrix_subrow (LDLT, i, 0, i);
+      gsl_vector_view si = gsl_vector_subvector (&s.vector, 0, i);
+      gsl_vector_div (&r.vector, &si.vector);
+    }
+
+  gsl_vector_mul (&diag.vector, &s.vector);
+}
+
+/*
+ldlt_update_C1()
+  L D L^T := L D L^T + alpha v v^T using method C1 of Gill et al:
+
+w := v
+for j = 0, ..., N-1
+  p = w_j
+  d~_j = d_j + alpha p^2
+  beta = p alpha / d~_j
+  alpha := d_j alpha / d~_j
+  w_i := w_i - p L_ij,  L_ij := L_ij + beta w_i,  i > j
+
+The diagonal of the result is first computed from p = L^{-1} v to
+check that it is nonsingular.
+
+Inputs: LDLT  - L D L^T factorization
+        alpha - +1 or -1
+        v     - on input, vector v
+                on output, overwritten
+        work  - workspace, length at least N
+
+Return: success, or GSL_EDOM if the result is singular, in which
+case LDLT is not modified
+*/
+
+static int
+ldlt_update_C1 (gsl_matrix * LDLT, const double alpha, gsl_vector * v, gsl_vector * work)
+{
+  const size_t N = LDLT->size1;
+  gsl_vector_view p = gsl_vector_subvector (work, 0, N);
+  double a = alpha;
+  size_t j;
+
+  gsl_vector_memcpy (&p.vector, v);
+  gsl_blas_dtrsv (CblasLower, CblasNoTrans, CblasUnit, LDLT, &p.vector);
+
+  for (j = 0; j < N; ++j)
+    {
+      const double dj = gsl_matrix_get (LDLT, j, j);
+      const double pj = gsl_vector_get (&p.vector, j);
+      const double dnew = dj + a * pj * pj;
+
+      if (dnew == 0.0 || !gsl_finite (dnew))
+        return GSL_EDOM;
+
+      a *= dj / dnew;
+    }
+
+  a = alpha;
+
+  for (j = 0; j < N; ++j)
+    {
+      double *dj = gsl_matrix_ptr (LDLT, j, j);
+      const double pj = gsl_vector_get (v, j);
+      const double dnew = *dj + a * pj * pj;
+      const double beta = pj * a / dnew;
+
+      a *= *dj / dnew;
+      *dj = dnew;
+
+      if (j + 1 < N)
+        {
+          gsl_vector_view lj = gsl_matrix_subcolumn (LDLT, j, j + 1, N - j - 1);
+          gsl_vector_view w = gsl_vector_subvector (v, j + 1, N - j - 1);
+
+          gsl_blas_daxpy (-pj, &lj.vector, &w.vector);
+          gsl_blas_daxpy (beta, &w.vector, &lj.vector);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+ldlt_modify()
+  L D L^T := L D L^T +/- V V^T
+
+Inputs: LDLT     - L D L^T factorization
+        V        - N-by-k matrix, overwritten
+        downdate - 0 for + V V^T, 1 for - V V^T
+*/
+
+static int
+ldlt_modify (gsl_matrix * LDLT, gsl_matrix * V, const int downdate)
+{
+  const size_t N = LDLT->size1;
+  const size_t k = V->size2;
+  int status = GSL_SUCCESS;
+  int modified = 1;
+  gsl_vector_view diag;
+  gsl_vector *work;
+
+  if (N == 0 || k == 0)
+    return GSL_SUCCESS;
+
+  work = gsl_vector_alloc (3 * N);
+  if (work == NULL)
+    {
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  diag = gsl_matrix_diagonal (LDLT);
+
+  if (gsl_vector_min (&diag.vector) > 0.0)
+    {
+      /* positive definite: modify the Cholesky factor L D^{1/2} */
+      if (downdate)
+        {
+          gsl_matrix *P = gsl_matrix_alloc (N, k);
+          gsl_matrix *C = gsl_matrix_alloc (k, k);
+          gsl_matrix *L0 = gsl_matrix_alloc (N, N);
+          size_t j;
+
+          if (P == NULL || C == NULL || L0 == NULL)
+            {
+              if (P)
+                gsl_matrix_free (P);
+              if (C)
+                gsl_matrix_free (C);
+              if (L0)
+                gsl_matrix_free (L0);
+              gsl_vector_free (work);
+              GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+            }
+
+          status = cholesky_downdate_check (LDLT, CblasUnit, V, P, C);
+
+          gsl_matrix_free (P);
+          gsl_matrix_free (C);
+
+          modified = (status == GSL_SUCCESS);
+
+          if (modified)
+            {
+              gsl_matrix_memcpy (L0, LDLT);
+              ldlt_to_cholesky (LDLT, work);
+
+              for (j = 0; j < k && status == GSL_SUCCESS; ++j)
+                {
+                  gsl_vector_view v = gsl_matrix_column (V, j);
+                  status = cholesky_downdate_L (LDLT, &v.vector, 0.0);
+                }
+
+              if (status)
+                {
+                  /* failed by rounding after the check: restore LDLT */
+                  gsl_matrix_memcpy (LDLT, L0);
+                  modified = 0;
+                }
+              else
+                ldlt_from_cholesky (LDLT, work);
+            }
+
+          gsl_matrix_free (L0);
+        }
+      else
+        {
+          ldlt_to_cholesky (LDLT, work);
+
+          if (k == 1)
+            {
+              gsl_vector_view v = gsl_matrix_column (V, 0);
+              cholesky_update_L (LDLT, &v.vector);
+            }
+          else
+            status = cholesky_update_blocked (LDLT, V);
+
+          ldlt_from_cholesky (LDLT, work);
+        }
+    }
+  else
+    {
+      size_t j;
+
+      for (j = 0; j < k && status == GSL_SUCCESS; ++j)
+        {
+          gsl_vector_view v = gsl_matrix_column (V, j);
+          status = ldlt_update_C1 (LDLT, downdate ? -1.0 : 1.0, &v.vector, work);
+        }
+
+      /* a failed column leaves LDLT as it was after the previous ones */
+      modified = (status == GSL_SUCCESS || j > 1);
+    }
+
+  if (modified)
+    ldlt_update_norm (LDLT, work);
+
+  gsl_vector_free (work);
+
+  if (status == GSL_EDOM)
+    {
+      if (downdate)
+        {
+          GSL_ERROR ("downdated matrix is not positive definite or is singular", GSL_EDOM);
+        }
+      else
+        {
+          GSL_ERROR ("updated matrix is singular", GSL_EDOM);
+        }
+    }
+
+  return status;
+}
+
+/* store an estimate of ||L D L^T||_1 in the upper right corner of LDLT */
+static int
+ldlt_update_norm (gsl_matrix * LDLT, gsl_vector * work)
+{
+  const size_t N = LDLT->size1;
+  double anorm;
+  int status;
+
+  if (N == 1)
+    return GSL_SUCCESS; /* gsl_linalg_ldlt_rcond() uses |d_0| */
+
+  status = gsl_linalg_invnorm1 (N, ldlt_Ax, LDLT, &anorm, work);
+  if (status)
+    return status;
+
+  gsl_matrix_set (LDLT, 0, N - 1, anorm);
+
+  return GSL_SUCCESS;
+}
+
+/* x := A x = A^T x, A = L D L^T */
+static int
+ldlt_Ax (CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params)
+{
+  gsl_matrix * LDLT = (gsl_matrix *) params;
+  gsl_vector_const_view diag = gsl_matrix_const_diagonal (LDLT);
+
+  (void) TransA; /* unused parameter warning */
+
+  gsl_blas_dtrmv (CblasLower, CblasTrans, CblasUnit, LDLT, x);
+  gsl_vector_mul (x, &diag.vector);
+  gsl_blas_dtrmv (CblasLower, CblasNoTrans, CblasUnit, LDLT, x);
+
+  return GSL_SUCCESS;
+}
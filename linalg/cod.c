@@ -27,6 +27,8 @@
 #include <gsl/gsl_blas.h>
 #include <gsl/gsl_linalg.h>
 
+#include "workspace.h"
+
 /*
  * This module contains routines for factoring an M-by-N matrix A as:
  *
@@ -292,6 +294,57 @@ gsl_linalg_COD_lssolve2 (const double lambda, const gsl_matrix * QRZT, const gsl
     }
 }
 
+/* size in doubles of the arena needed by gsl_linalg_COD_lssolve2_ws */
+
+size_t
+gsl_linalg_COD_lssolve2_wsize (const size_t rank)
+{
+  return rank * (rank + 1);
+}
+
+/*
+gsl_linalg_COD_lssolve2_ws()
+  As gsl_linalg_COD_lssolve2(), with the workspaces S and work taken
+from the arena w
+*/
+
+int
+gsl_linalg_COD_lssolve2_ws (const double lambda, const gsl_matrix * QRZT, const gsl_vector * tau_Q,
+                            const gsl_vector * tau_Z, const gsl_permutation * perm, const size_t rank,
+                            const gsl_vector * b, gsl_vector * x, gsl_vector * residual,
+                            gsl_linalg_workspace * w)
+{
+  if (linalg_workspace_avail (w) < gsl_linalg_COD_lssolve2_wsize (rank))
+    {
+      GSL_ERROR ("workspace is too small", GSL_EBADLEN);
+    }
+  else if (rank == 0)
+    {
+      /* A = 0, so the solution is x = 0 with residual b */
+      if (QRZT->size1 != b->size || QRZT->size2 != x->size || QRZT->size1 != residual->size)
+        {
+          GSL_ERROR ("matrix size must match b, x and residual sizes", GSL_EBADLEN);
+        }
+
+      gsl_vector_set_zero (x);
+      gsl_vector_memcpy (residual, b);
+
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      double *p = linalg_workspace_get (w, gsl_linalg_COD_lssolve2_wsize (rank));
+      gsl_matrix_view S = gsl_matrix_view_array (p, rank, rank);
+      gsl_vector_view work = gsl_vector_view_array (p + rank * rank, rank);
+      int status = gsl_linalg_COD_lssolve2 (lambda, QRZT, tau_Q, tau_Z, perm, rank, b, x, residual,
+                                            &S.matrix, &work.vector);
+
+      linalg_workspace_release (w, p);
+
+      return status;
+    }
+}
+
 /*
 gsl_linalg_COD_unpack()
   Unpack encoded COD decomposition into the matrices Q,R,Z,P
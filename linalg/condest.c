@@ -33,14 +33,48 @@
  * [1] N. J. Higham, "FORTRAN codes for estimating the one-norm of
  * a real or complex matrix, with applications to condition estimation",
  * ACM Trans. Math. Soft., vol. 14, no. 4, pp. 381-396, December 1988.
+ *
+ * The block version, which applies the inverse to t vectors at a time
+ * with Level 3 BLAS, is Algorithm 2.4 of
+ *
+ * [2] N. J. Higham and F. Tisseur, "A block algorithm for matrix
+ * 1-norm estimation, with an application to 1-norm pseudospectra",
+ * SIAM J. Matrix Anal. Appl., vol. 21, no. 4, pp. 1185-1201, 2000.
  */
 
+/* maximum number of iterations of the estimators */
+#define CONDEST_MAXIT 5
+
+/* the inverse applied to blocks of vectors, for gsl_linalg_invnorm1_block */
+typedef struct
+{
+  int (* AinvX)(CBLAS_TRANSPOSE_t TransA, gsl_matrix * X, void * params);
+  void * params;
+} condest_block_params;
+
+/* parameters of the operator diag(v) A^{-T} of gsl_linalg_ferr */
+typedef struct
+{
+  int (* Ainvx)(CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params);
+  void * params;
+  const gsl_vector * v;
+} condest_ferr_params;
+
 static double condest_tri_norm1(CBLAS_UPLO_t Uplo, const gsl_matrix * A);
 static int condest_tri_rcond(CBLAS_UPLO_t Uplo, const gsl_matrix * A,
                              double * rcond, gsl_vector * work);
 static int condest_same_sign(const gsl_vector * x, const gsl_vector * y);
 static int condest_invtriu(CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params);
 static int condest_invtril(CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params);
+static int condest_block_vec(CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params);
+static int condest_invtriu_block(CBLAS_TRANSPOSE_t TransA, gsl_matrix * X, void * params);
+static int condest_invtril_block(CBLAS_TRANSPOSE_t TransA, gsl_matrix * X, void * params);
+static int condest_ferr_op(CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params);
+static double condest_sign(gsl_linalg_condest_workspace * w);
+static int condest_parallel(const gsl_vector * x, const gsl_matrix * S, const size_t ncol);
+static void condest_largest(size_t * ind, const size_t k, const gsl_vector * h);
+static void condest_unparallel(gsl_matrix * S, const gsl_matrix * S_old, const int use_old,
+                               gsl_linalg_condest_workspace * w);
 
 int
 gsl_linalg_tri_rcond(CBLAS_UPLO_t Uplo, const gsl_matrix * A, double * rcond, gsl_vector * work)
@@ -48,6 +82,49 @@ gsl_linalg_tri_rcond(CBLAS_UPLO_t Uplo, const gsl_matrix * A, double * rcond, gs
   return condest_tri_rcond(Uplo, A, rcond, work);
 }
 
+/* as gsl_linalg_tri_rcond, estimating ||A^{-1}||_1 with the block estimator */
+int
+gsl_linalg_tri_rcond_block(CBLAS_UPLO_t Uplo, const gsl_matrix * A, double * rcond,
+                           gsl_linalg_condest_workspace * w)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+
+  if (M != N)
+    {
+      GSL_ERROR ("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (N != w->N)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      int status;
+      double Anorm = condest_tri_norm1(Uplo, A); /* ||A||_1 */
+      double Ainvnorm;                           /* ||A^{-1}||_1 */
+
+      *rcond = 0.0;
+
+      /* don't continue if matrix is singular */
+      if (Anorm == 0.0)
+        return GSL_SUCCESS;
+
+      if (Uplo == CblasUpper)
+        status = gsl_linalg_invnorm1_block(condest_invtriu_block, (void *) A, &Ainvnorm, w);
+      else
+        status = gsl_linalg_invnorm1_block(condest_invtril_block, (void *) A, &Ainvnorm, w);
+
+      if (status)
+        return status;
+
+      if (Ainvnorm != 0.0)
+        *rcond = (1.0 / Anorm) / Ainvnorm;
+
+      return GSL_SUCCESS;
+    }
+}
+
 /*
 gsl_linalg_invnorm1()
   Estimate the 1-norm of ||A^{-1}||, where A is a square
@@ -152,6 +229,420 @@ gsl_linalg_invnorm1(const size_t N,
     }
 }
 
+/*
+gsl_linalg_condest_alloc()
+  Allocate a workspace for estimating the 1-norm of the inverse
+of an N-by-N matrix, applying the inverse to t vectors at a time
+
+Inputs: N - size of matrix
+        t - number of vectors in a block, 1 <= t <= N; t = 2
+            is usually enough for an estimate within a factor of
+            3 of the true norm, and larger t give more reliable
+            estimates
+
+Return: pointer to workspace
+*/
+
+gsl_linalg_condest_workspace *
+gsl_linalg_condest_alloc (const size_t N, const size_t t)
+{
+  gsl_linalg_condest_workspace *w;
+
+  if (N == 0)
+    {
+      GSL_ERROR_NULL ("matrix dimension must be positive integer", GSL_EINVAL);
+    }
+  else if (t == 0 || t > N)
+    {
+      GSL_ERROR_NULL ("block size must be between 1 and N", GSL_EINVAL);
+    }
+
+  w = calloc (1, sizeof (gsl_linalg_condest_workspace));
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->N = N;
+  w->t = t;
+
+  w->X = gsl_matrix_alloc (N, t);
+  w->S = gsl_matrix_alloc (N, t);
+  w->S_old = gsl_matrix_alloc (N, t);
+  w->h = gsl_vector_alloc (N);
+  w->ind = malloc (N * sizeof (size_t));
+  w->hist = malloc (N * sizeof (unsigned char));
+  w->work = gsl_vector_alloc (3 * N);
+
+  if (w->X == NULL || w->S == NULL || w->S_old == NULL || w->h == NULL ||
+      w->ind == NULL || w->hist == NULL || w->work == NULL)
+    {
+      gsl_linalg_condest_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_linalg_condest_free (gsl_linalg_condest_workspace * w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->X)
+    gsl_matrix_free (w->X);
+
+  if (w->S)
+    gsl_matrix_free (w->S);
+
+  if (w->S_old)
+    gsl_matrix_free (w->S_old);
+
+  if (w->h)
+    gsl_vector_free (w->h);
+
+  if (w->ind)
+    free (w->ind);
+
+  if (w->hist)
+    free (w->hist);
+
+  if (w->work)
+    gsl_vector_free (w->work);
+
+  free (w);
+}
+
+/*
+gsl_linalg_invnorm1_block()
+  Estimate the 1-norm of ||A^{-1}||, where A is a square
+N-by-N matrix, applying A^{-1} to blocks of t vectors
+
+Inputs: AinvX    - pointer to function which calculates:
+                   X := A^{-1} X or X := A^{-t} X
+                   for an N-by-k matrix X, 1 <= k <= t
+        params   - parameters to pass to AinvX
+        Ainvnorm - (output) estimate of ||A^{-1}||_1
+        w        - workspace
+
+Notes:
+1) For t = 1 this is gsl_linalg_invnorm1.
+
+2) The estimate is never larger than ||A^{-1}||_1. Each iteration
+applies A^{-1} and A^{-t} once to a block of t vectors, and at most
+CONDEST_MAXIT + 1 iterations are done, so that the cost is that of
+solving with about 2 (CONDEST_MAXIT + 1) t right hand sides, with
+Level 3 BLAS if AinvX uses them.
+*/
+
+int
+gsl_linalg_invnorm1_block (int (* AinvX)(CBLAS_TRANSPOSE_t TransA, gsl_matrix * X, void * params),
+                           void * params, double * Ainvnorm, gsl_linalg_condest_workspace * w)
+{
+  const size_t N = w->N;
+  const size_t t = w->t;
+
+  if (t == 1)
+    {
+      condest_block_params bp;
+
+      bp.AinvX = AinvX;
+      bp.params = params;
+
+      return gsl_linalg_invnorm1 (N, condest_block_vec, &bp, Ainvnorm, w->work);
+    }
+  else
+    {
+      gsl_matrix *X = w->X;
+      gsl_matrix *S = w->S;
+      gsl_matrix *S_old = w->S_old;
+      double est = 0.0, est_old = 0.0, temp;
+      size_t ind_best = 0;
+      size_t i, j, k;
+      int status;
+
+      w->seed = 1;
+      memset (w->hist, 0, N * sizeof (unsigned char));
+
+      /* starting block: the vector of ones and t - 1 random sign
+         vectors, none parallel to another */
+      for (i = 0; i < N; ++i)
+        {
+          gsl_matrix_set (S, i, 0, 1.0);
+
+          for (j = 1; j < t; ++j)
+            gsl_matrix_set (S, i, j, condest_sign (w));
+        }
+
+      condest_unparallel (S, S_old, 0, w);
+
+      gsl_matrix_memcpy (X, S);
+      gsl_matrix_scale (X, 1.0 / (double) N);
+
+      for (k = 1; ; ++k)
+        {
+          size_t jmax = 0;
+          int all_parallel = 1;
+          gsl_matrix *tmp;
+
+          /* Y = A^{-1} X, stored in X */
+          status = (*AinvX) (CblasNoTrans, X, params);
+          if (status)
+            return status;
+
+          est = -1.0;
+          for (j = 0; j < t; ++j)
+            {
+              gsl_vector_view y = gsl_matrix_column (X, j);
+              double yj = gsl_blas_dasum (&y.vector);
+
+              if (yj > est)
+                {
+                  est = yj;
+                  jmax = j;
+                }
+            }
+
+          if (k >= 2 && est <= est_old)
+            {
+              est = est_old;
+              break;
+            }
+
+          /* for k >= 2 the columns of X were the unit vectors e_ind(j) */
+          if (k >= 2)
+            ind_best = w->ind[jmax];
+
+          est_old = est;
+
+          if (k > CONDEST_MAXIT)
+            break;
+
+          /* S = sign(Y) */
+          tmp = S_old;
+          S_old = S;
+          S = tmp;
+
+          for (j = 0; j < t; ++j)
+            {
+              for (i = 0; i < N; ++i)
+                {
+                  double yij = gsl_matrix_get (X, i, j);
+                  gsl_matrix_set (S, i, j, (yij >= 0.0) ? 1.0 : -1.0);
+                }
+
+              if (all_parallel)
+                {
+                  gsl_vector_const_view sj = gsl_matrix_const_column (S, j);
+                  all_parallel = condest_parallel (&sj.vector, S_old, t);
+                }
+            }
+
+          /* converged if every sign vector was already used */
+          if (k >= 2 && all_parallel)
+            break;
+
+          condest_unparallel (S, S_old, k >= 2, w);
+
+          /* Z = A^{-t} S, stored in X */
+          gsl_matrix_memcpy (X, S);
+          status = (*AinvX) (CblasTrans, X, params);
+          if (status)
+            return status;
+
+          /* h_i = max_j |Z_ij| */
+          for (i = 0; i < N; ++i)
+            {
+              gsl_vector_view zi = gsl_matrix_row (X, i);
+              size_t idx = gsl_blas_idamax (&zi.vector);
+              gsl_vector_set (w->h, i, fabs (gsl_vector_get (&zi.vector, idx)));
+            }
+
+          if (k >= 2 && gsl_vector_max (w->h) == gsl_vector_get (w->h, ind_best))
+            break;
+
+          /* stop if the t largest h_i correspond to unit vectors already used */
+          condest_largest (w->ind, t, w->h);
+
+          for (j = 0; j < t; ++j)
+            {
+              if (!w->hist[w->ind[j]])
+                break;
+            }
+
+          if (j == t)
+            break;
+
+          /* next block: unit vectors of the t largest h_i not yet used */
+          for (i = 0; i < N; ++i)
+            {
+              if (w->hist[i])
+                gsl_vector_set (w->h, i, -1.0);
+            }
+
+          condest_largest (w->ind, t, w->h);
+
+          if (gsl_vector_get (w->h, w->ind[t - 1]) < 0.0)
+            break; /* fewer than t unit vectors left */
+
+          gsl_matrix_set_zero (X);
+
+          for (j = 0; j < t; ++j)
+            {
+              gsl_matrix_set (X, w->ind[j], j, 1.0);
+              w->hist[w->ind[j]] = 1;
+            }
+        }
+
+      /* alternating sign vector, as in gsl_linalg_invnorm1 */
+      {
+        gsl_matrix_view x = gsl_matrix_submatrix (X, 0, 0, N, 1);
+        double sgn = 1.0;
+
+        for (i = 0; i < N; ++i)
+          {
+            double term = (N > 1) ? 1.0 + (double) i / (N - 1.0) : 1.0;
+            gsl_matrix_set (&x.matrix, i, 0, sgn * term);
+            sgn = -sgn;
+          }
+
+        status = (*AinvX) (CblasNoTrans, &x.matrix, params);
+        if (status)
+          return status;
+
+        {
+          gsl_vector_view xc = gsl_matrix_column (&x.matrix, 0);
+          temp = 2.0 * gsl_blas_dasum (&xc.vector) / (3.0 * N);
+        }
+
+        if (temp > est)
+          est = temp;
+      }
+
+      *Ainvnorm = est;
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_linalg_norm1()
+  Return the 1-norm ||A||_1 = max_j sum_i |A_ij| of the M-by-N matrix A
+*/
+
+double
+gsl_linalg_norm1 (const gsl_matrix * A)
+{
+  const size_t N = A->size2;
+  double max = 0.0;
+  size_t j;
+
+  for (j = 0; j < N; ++j)
+    {
+      gsl_vector_const_view aj = gsl_matrix_const_column (A, j);
+      double sum = gsl_blas_dasum (&aj.vector);
+
+      max = GSL_MAX (max, sum);
+    }
+
+  return max;
+}
+
+/*
+gsl_linalg_ferr()
+  Estimate a bound on the forward error of the computed solution x
+of A x = b, as in LAPACK (dgerfs),
+
+||x - x_true||_inf / ||x||_inf <= || |A^{-1}| v ||_inf / ||x||_inf
+
+where v = |b - A x| + (N + 1) eps (|A| |x| + |b|) bounds the residual
+including its rounding errors. The norm is estimated as
+||A^{-1} diag(v)||_inf = ||diag(v) A^{-t}||_1 with gsl_linalg_invnorm1.
+
+Inputs: A      - N-by-N matrix
+        b      - right hand side, length N
+        x      - computed solution, length N
+        Ainvx  - pointer to function which calculates:
+                 x := A^{-1} x or x := A^{-t} x
+                 from a factorization of A
+        params - parameters to pass to Ainvx
+        ferr   - (output) estimated forward error bound
+        work   - workspace, length 5*N
+*/
+
+int
+gsl_linalg_ferr (const gsl_matrix * A, const gsl_vector * b, const gsl_vector * x,
+                 int (* Ainvx)(CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params),
+                 void * params, double * ferr, gsl_vector * work)
+{
+  const size_t N = A->size1;
+
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (b->size != N)
+    {
+      GSL_ERROR ("matrix size must match b size", GSL_EBADLEN);
+    }
+  else if (x->size != N)
+    {
+      GSL_ERROR ("matrix size must match solution size", GSL_EBADLEN);
+    }
+  else if (work->size != 5 * N)
+    {
+      GSL_ERROR ("work vector must have length 5*N", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_vector_view r = gsl_vector_subvector (work, 0, N);
+      gsl_vector_view v = gsl_vector_subvector (work, N, N);
+      gsl_vector_view wk = gsl_vector_subvector (work, 2 * N, 3 * N);
+      const double eps = (N + 1.0) * GSL_DBL_EPSILON;
+      double xnorm, est;
+      size_t i, j;
+      int status;
+
+      /* r = b - A x */
+      gsl_vector_memcpy (&r.vector, b);
+      gsl_blas_dgemv (CblasNoTrans, -1.0, A, x, 1.0, &r.vector);
+
+      /* v = |r| + eps (|A| |x| + |b|) */
+      for (i = 0; i < N; ++i)
+        {
+          double sum = fabs (gsl_vector_get (b, i));
+
+          for (j = 0; j < N; ++j)
+            sum += fabs (gsl_matrix_get (A, i, j)) * fabs (gsl_vector_get (x, j));
+
+          gsl_vector_set (&v.vector, i, fabs (gsl_vector_get (&r.vector, i)) + eps * sum);
+        }
+
+      xnorm = fabs (gsl_vector_get (x, gsl_blas_idamax (x)));
+
+      *ferr = 0.0;
+
+      if (xnorm == 0.0)
+        return GSL_SUCCESS;
+
+      {
+        condest_ferr_params fp;
+
+        fp.Ainvx = Ainvx;
+        fp.params = params;
+        fp.v = &v.vector;
+
+        status = gsl_linalg_invnorm1 (N, condest_ferr_op, &fp, &est, &wk.vector);
+        if (status)
+          return status;
+      }
+
+      *ferr = est / xnorm;
+
+      return GSL_SUCCESS;
+    }
+}
+
 static int
 condest_tri_rcond(CBLAS_UPLO_t Uplo, const gsl_matrix * A, double * rcond, gsl_vector * work)
 {
@@ -268,6 +759,143 @@ condest_invtril(CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params)
   return gsl_blas_dtrsv(CblasLower, TransA, CblasNonUnit, A, x);
 }
 
+/* X := A^{-1} X, A upper triangular */
+static int
+condest_invtriu_block(CBLAS_TRANSPOSE_t TransA, gsl_matrix * X, void * params)
+{
+  gsl_matrix * A = (gsl_matrix *) params;
+  return gsl_blas_dtrsm(CblasLeft, CblasUpper, TransA, CblasNonUnit, 1.0, A, X);
+}
+
+/* X := A^{-1} X, A lower triangular */
+static int
+condest_invtril_block(CBLAS_TRANSPOSE_t TransA, gsl_matrix * X, void * params)
+{
+  gsl_matrix * A = (gsl_matrix *) params;
+  return gsl_blas_dtrsm(CblasLeft, CblasLower, TransA, CblasNonUnit, 1.0, A, X);
+}
+
+/* x := A^{-1} x through the block function, for t = 1 */
+static int
+condest_block_vec(CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params)
+{
+  condest_block_params * bp = (condest_block_params *) params;
+  gsl_matrix_view X = gsl_matrix_view_vector(x, x->size, 1);
+
+  if (x->stride != 1)
+    {
+      GSL_ERROR ("vector must have unit stride", GSL_EINVAL);
+    }
+
+  return (*bp->AinvX)(TransA, &X.matrix, bp->params);
+}
+
+/* x := diag(v) A^{-t} x, or its transpose x := A^{-1} diag(v) x */
+static int
+condest_ferr_op(CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params)
+{
+  condest_ferr_params * fp = (condest_ferr_params *) params;
+  int status;
+
+  if (TransA == CblasNoTrans)
+    {
+      status = (*fp->Ainvx)(CblasTrans, x, fp->params);
+      gsl_vector_mul(x, fp->v);
+    }
+  else
+    {
+      gsl_vector_mul(x, fp->v);
+      status = (*fp->Ainvx)(CblasNoTrans, x, fp->params);
+    }
+
+  return status;
+}
+
+/* random +1 or -1, from a linear congruential generator */
+static double
+condest_sign(gsl_linalg_condest_workspace * w)
+{
+  w->seed = (w->seed * 1103515245UL + 12345UL) & 0xffffffffUL;
+  return ((w->seed >> 16) & 1) ? 1.0 : -1.0;
+}
+
+/* store in ind the indices of the k largest elements of h, in
+   decreasing order; k is small so a selection by insertion is used */
+static void
+condest_largest(size_t * ind, const size_t k, const gsl_vector * h)
+{
+  const size_t N = h->size;
+  size_t i, j, n = 0;
+
+  for (i = 0; i < N; ++i)
+    {
+      double hi = gsl_vector_get(h, i);
+
+      if (n == k && hi <= gsl_vector_get(h, ind[k - 1]))
+        continue;
+
+      j = (n < k) ? n++ : k - 1;
+
+      while (j > 0 && gsl_vector_get(h, ind[j - 1]) < hi)
+        {
+          ind[j] = ind[j - 1];
+          --j;
+        }
+
+      ind[j] = i;
+    }
+}
+
+/* return 1 if the sign vector x is parallel to one of the first ncol
+   columns of S */
+static int
+condest_parallel(const gsl_vector * x, const gsl_matrix * S, const size_t ncol)
+{
+  const double N = (double) x->size;
+  size_t j;
+
+  for (j = 0; j < ncol; ++j)
+    {
+      gsl_vector_const_view sj = gsl_matrix_const_column(S, j);
+      double d;
+
+      gsl_blas_ddot(x, &sj.vector, &d);
+
+      if (fabs(d) == N)
+        return 1;
+    }
+
+  return 0;
+}
+
+/* replace the columns of S which are parallel to a previous column of
+   S, or to a column of S_old if use_old is set, by random sign vectors;
+   the number of attempts is limited since for small N there may not be
+   enough distinct sign vectors */
+static void
+condest_unparallel(gsl_matrix * S, const gsl_matrix * S_old, const int use_old,
+                   gsl_linalg_condest_workspace * w)
+{
+  const size_t N = S->size1;
+  const size_t t = S->size2;
+  size_t i, j, iter;
+
+  for (j = 0; j < t; ++j)
+    {
+      gsl_vector_view sj = gsl_matrix_column(S, j);
+
+      for (iter = 0; iter < N; ++iter)
+        {
+          if (!condest_parallel(&sj.vector, S, j) &&
+              !(use_old && condest_parallel(&sj.vector, S_old, t)))
+            break;
+
+          for (i = 0; i < N; ++i)
+            gsl_vector_set(&sj.vector, i, condest_sign(w));
+        }
+    }
+}
+
 #ifndef GSL_DISABLE_DEPRECATED
 
 int
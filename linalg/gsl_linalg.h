@@ -28,6 +28,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_inline.h>
 #include <gsl/gsl_blas.h>
+#include <gsl/gsl_thread_pool.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -49,6 +50,87 @@ typedef enum
   }
 gsl_linalg_matrix_mod_t;
 
+/* arena for the temporary storage of the _ws routines */
+
+typedef struct
+{
+  size_t size;                /* size of arena in doubles */
+  size_t used;                /* doubles in use by the running routines */
+  double * data;              /* arena, length size */
+} gsl_linalg_workspace;
+
+gsl_linalg_workspace * gsl_linalg_workspace_alloc (const size_t n);
+void gsl_linalg_workspace_free (gsl_linalg_workspace * w);
+
+/* workspace for the mixed precision solvers */
+
+typedef struct
+{
+  size_t N;                   /* matrix size */
+  int chol;                   /* 1 for Cholesky, 0 for LU */
+  int fallback;               /* 1 if the double precision factor is used */
+  gsl_matrix_float * LUf;     /* single precision factor */
+  gsl_vector_uint * ipiv;     /* row interchanges of LUf */
+  gsl_matrix * LU;            /* double precision factor, allocated on fallback */
+  gsl_permutation * p;        /* permutation of LU */
+  gsl_vector * work;          /* workspace, size 3*N */
+  gsl_vector_float * workf;   /* workspace, size N */
+  double anorm;               /* ||A||_inf */
+  double rcond;               /* reciprocal condition estimate of LUf */
+  size_t niter;               /* refinement iterations of the last solve */
+} gsl_linalg_mixed_workspace;
+
+/* workspace for the randomized SVD */
+
+typedef struct
+{
+  size_t M;                   /* rows of A */
+  size_t N;                   /* columns of A */
+  size_t k;                   /* rank of the approximation */
+  size_t l;                   /* k plus oversampling, size of the sketch */
+  gsl_matrix * Q;             /* range basis, M-by-l */
+  gsl_matrix * Z;             /* sketch of the row space, N-by-l */
+  gsl_matrix * T;             /* block reflector of QR, l-by-l */
+  gsl_matrix * V;             /* right singular vectors of Z^T, l-by-l */
+  gsl_vector * S;             /* singular values, size l */
+  gsl_vector * work;          /* workspace, size l */
+} gsl_linalg_rsvd_workspace;
+
+/* workspace for the matrix functions expm, sqrtm and logm */
+
+typedef struct gsl_linalg_matfunc_struct gsl_linalg_matfunc_workspace;
+
+/* workspace for the Krylov approximation of exp(tA) v */
+
+typedef struct
+{
+  size_t n;                   /* dimension of A */
+  size_t m;                   /* dimension of the Krylov subspaces */
+  size_t nstep;               /* time steps of the last call */
+  gsl_matrix * V;             /* Krylov basis, stored by rows, (m+1)-by-n */
+  gsl_matrix * H;             /* augmented Hessenberg matrix, (m+2)-by-(m+2) */
+  gsl_matrix * F;             /* exponential of H, (m+2)-by-(m+2) */
+  gsl_vector * h;             /* projections, size m+1 */
+  gsl_vector * work;          /* workspace, size n */
+  gsl_linalg_matfunc_workspace * expm_workspace_p;  /* for exp(H), size m+2 */
+} gsl_linalg_expmv_workspace;
+
+/* workspace for the block 1-norm estimator */
+
+typedef struct
+{
+  size_t N;                   /* matrix size */
+  size_t t;                   /* number of vectors in a block */
+  gsl_matrix * X;             /* current block, N-by-t */
+  gsl_matrix * S;             /* sign vectors, N-by-t */
+  gsl_matrix * S_old;         /* sign vectors of previous iteration, N-by-t */
+  gsl_vector * h;             /* row maxima of A^{-T} S, size N */
+  size_t * ind;               /* indices of largest h_i, size N */
+  unsigned char * hist;       /* unit vectors already used, size N */
+  gsl_vector * work;          /* workspace for t = 1, size 3*N */
+  unsigned long seed;         /* state of random sign generator */
+} gsl_linalg_condest_workspace;
+
 /* Note: You can now use the gsl_blas_dgemm function instead of matmult */
 
 /* Simple implementation of matrix multiply.
@@ -87,6 +169,23 @@ int gsl_linalg_exponential_ss(
   gsl_mode_t mode
   );
 
+/* Matrix functions */
+
+gsl_linalg_matfunc_workspace * gsl_linalg_matfunc_alloc (const size_t n);
+void gsl_linalg_matfunc_free (gsl_linalg_matfunc_workspace * w);
+int gsl_linalg_expm (const gsl_matrix * A, gsl_matrix * eA, gsl_linalg_matfunc_workspace * w);
+int gsl_linalg_sqrtm (const gsl_matrix * A, gsl_matrix * sqrtA, gsl_linalg_matfunc_workspace * w);
+int gsl_linalg_logm (const gsl_matrix * A, gsl_matrix * logA, gsl_linalg_matfunc_workspace * w);
+
+gsl_linalg_expmv_workspace * gsl_linalg_expmv_alloc (const size_t n, const size_t m);
+void gsl_linalg_expmv_free (gsl_linalg_expmv_workspace * w);
+size_t gsl_linalg_expmv_nstep (const gsl_linalg_expmv_workspace * w);
+int gsl_linalg_expmv (const double t, const gsl_matrix * A, const gsl_vector * v,
+                      const double tol, gsl_vector * y, gsl_linalg_expmv_workspace * w);
+int gsl_linalg_expmv_op (int (* matvec)(CBLAS_TRANSPOSE_t TransA, const gsl_vector * x, gsl_vector * y, void * params),
+                         void * params, const double t, const gsl_vector * v,
+                         const double tol, gsl_vector * y, gsl_linalg_expmv_workspace * w);
+
 
 /* Householder Transformations */
 
@@ -139,6 +238,9 @@ int gsl_linalg_complex_householder_left (const gsl_complex tau,
 /* Hessenberg reduction */
 
 int gsl_linalg_hessenberg_decomp(gsl_matrix *A, gsl_vector *tau);
+size_t gsl_linalg_hessenberg_decomp_wsize (const size_t N);
+int gsl_linalg_hessenberg_decomp_ws (gsl_matrix * A, gsl_vector * tau,
+                                     gsl_linalg_workspace * w);
 int gsl_linalg_hessenberg_unpack(gsl_matrix * H, gsl_vector * tau,
                                  gsl_matrix * U);
 int gsl_linalg_hessenberg_unpack_accum(gsl_matrix * H, gsl_vector * tau,
@@ -164,6 +266,13 @@ gsl_linalg_SV_decomp (gsl_matrix * A,
                       gsl_vector * S,
                       gsl_vector * work);
 
+size_t gsl_linalg_SV_decomp_wsize (const size_t M, const size_t N);
+int gsl_linalg_SV_decomp_ws (gsl_matrix * A,
+                             gsl_matrix * V,
+                             gsl_vector * S,
+                             gsl_vector * work,
+                             gsl_linalg_workspace * w);
+
 int
 gsl_linalg_SV_decomp_mod (gsl_matrix * A,
                           gsl_matrix * X,
@@ -175,6 +284,11 @@ int gsl_linalg_SV_decomp_jacobi (gsl_matrix * A,
                                  gsl_matrix * Q,
                                  gsl_vector * S);
 
+int gsl_linalg_SV_decomp_jacobi_par (gsl_matrix * A,
+                                     gsl_matrix * Q,
+                                     gsl_vector * S,
+                                     gsl_thread_pool * pool);
+
 int
 gsl_linalg_SV_solve (const gsl_matrix * U,
                      const gsl_matrix * Q,
@@ -182,13 +296,49 @@ gsl_linalg_SV_solve (const gsl_matrix * U,
                      const gsl_vector * b,
                      gsl_vector * x);
 
+size_t gsl_linalg_SV_solve_wsize (const size_t M, const size_t N);
+int gsl_linalg_SV_solve_ws (const gsl_matrix * U,
+                            const gsl_matrix * Q,
+                            const gsl_vector * S,
+                            const gsl_vector * b,
+                            gsl_vector * x,
+                            gsl_linalg_workspace * w);
+
 int gsl_linalg_SV_leverage(const gsl_matrix *U, gsl_vector *h);
 
+/* Randomized low-rank SVD; the generator is a gsl_rng, declared here as
+   an incomplete type so that this header does not include gsl_rng.h */
+
+struct gsl_rng_struct;
+
+
+gsl_linalg_rsvd_workspace * gsl_linalg_rsvd_alloc (const size_t M, const size_t N,
+                                                   const size_t k, const size_t p);
+void gsl_linalg_rsvd_free (gsl_linalg_rsvd_workspace * w);
+
+int gsl_linalg_rsvd_range (const gsl_matrix * A, const size_t q, struct gsl_rng_struct * r,
+                           gsl_matrix * Q, gsl_linalg_rsvd_workspace * w);
+
+int gsl_linalg_rsvd_range_op (int (* matvec)(CBLAS_TRANSPOSE_t TransA, const gsl_vector * x, gsl_vector * y, void * params),
+                              void * params, const size_t q, struct gsl_rng_struct * r,
+                              gsl_matrix * Q, gsl_linalg_rsvd_workspace * w);
+
+int gsl_linalg_rsvd_decomp (const gsl_matrix * A, const size_t q, struct gsl_rng_struct * r,
+                            gsl_matrix * U, gsl_vector * S, gsl_matrix * V,
+                            gsl_linalg_rsvd_workspace * w);
+
+int gsl_linalg_rsvd_decomp_op (int (* matvec)(CBLAS_TRANSPOSE_t TransA, const gsl_vector * x, gsl_vector * y, void * params),
+                               void * params, const size_t q, struct gsl_rng_struct * r,
+                               gsl_matrix * U, gsl_vector * S, gsl_matrix * V,
+                               gsl_linalg_rsvd_workspace * w);
+
 
 /* LU Decomposition, Gaussian elimination with partial pivoting
  */
 
 int gsl_linalg_LU_decomp (gsl_matrix * A, gsl_permutation * p, int *signum);
+int gsl_linalg_LU_decomp_par (gsl_matrix * A, gsl_permutation * p, int *signum,
+                              gsl_thread_pool * pool);
 
 int gsl_linalg_LU_solve (const gsl_matrix * LU,
                          const gsl_permutation * p,
@@ -215,6 +365,14 @@ double gsl_linalg_LU_det (gsl_matrix * LU, int signum);
 double gsl_linalg_LU_lndet (gsl_matrix * LU);
 int gsl_linalg_LU_sgndet (gsl_matrix * lu, int signum);
 
+int gsl_linalg_LU_rcond (const gsl_matrix * LU, const gsl_permutation * p, const double Anorm,
+                         double * rcond, gsl_vector * work);
+int gsl_linalg_LU_rcond_block (const gsl_matrix * LU, const gsl_permutation * p, const double Anorm,
+                               double * rcond, gsl_linalg_condest_workspace * w);
+int gsl_linalg_LU_ferr (const gsl_matrix * A, const gsl_matrix * LU, const gsl_permutation * p,
+                        const gsl_vector * b, const gsl_vector * x, double * ferr,
+                        gsl_vector * work);
+
 /* Complex LU Decomposition */
 
 int gsl_linalg_complex_LU_decomp (gsl_matrix_complex * A, 
@@ -258,6 +416,8 @@ int gsl_linalg_QR_decomp_old (gsl_matrix * A, gsl_vector * tau);
 
 int gsl_linalg_QR_decomp_r (gsl_matrix * A, gsl_matrix * T);
 
+int gsl_linalg_QR_decomp_tsqr (gsl_matrix * A, gsl_matrix * T, gsl_thread_pool * pool);
+
 int gsl_linalg_QR_solve (const gsl_matrix * QR, const gsl_vector * tau, const gsl_vector * b, gsl_vector * x);
 
 int gsl_linalg_QR_solve_r (const gsl_matrix * QR, const gsl_matrix * T, const gsl_vector * b, gsl_vector * x);
@@ -294,6 +454,8 @@ int gsl_linalg_QR_unpack (const gsl_matrix * QR, const gsl_vector * tau, gsl_mat
 
 int gsl_linalg_QR_unpack_r(const gsl_matrix * QR, const gsl_matrix * T, gsl_matrix * Q, gsl_matrix * R);
 
+int gsl_linalg_QR_Q1_r(const gsl_matrix * QR, const gsl_matrix * T, gsl_matrix * Q1);
+
 int gsl_linalg_R_solve (const gsl_matrix * R, const gsl_vector * b, gsl_vector * x);
 
 int gsl_linalg_R_svx (const gsl_matrix * R, gsl_vector * x);
@@ -427,6 +589,12 @@ gsl_linalg_COD_lssolve2 (const double lambda, const gsl_matrix * QRZT, const gsl
                          const gsl_permutation * perm, const size_t rank, const gsl_vector * b,
                          gsl_vector * x, gsl_vector * residual, gsl_matrix * S, gsl_vector * work);
 
+size_t gsl_linalg_COD_lssolve2_wsize (const size_t rank);
+int gsl_linalg_COD_lssolve2_ws (const double lambda, const gsl_matrix * QRZT, const gsl_vector * tau_Q,
+                                const gsl_vector * tau_Z, const gsl_permutation * perm, const size_t rank,
+                                const gsl_vector * b, gsl_vector * x, gsl_vector * residual,
+                                gsl_linalg_workspace * w);
+
 int gsl_linalg_COD_unpack(const gsl_matrix * QRZT, const gsl_vector * tau_Q,
                           const gsl_vector * tau_Z, const size_t rank, gsl_matrix * Q,
                           gsl_matrix * R, gsl_matrix * Z);
@@ -519,6 +687,7 @@ int gsl_linalg_PTLQ_update (gsl_matrix * Q, gsl_matrix * L,
 
 int gsl_linalg_cholesky_decomp (gsl_matrix * A);
 int gsl_linalg_cholesky_decomp1 (gsl_matrix * A);
+int gsl_linalg_cholesky_decomp_par (gsl_matrix * A, gsl_thread_pool * pool);
 
 int gsl_linalg_cholesky_solve (const gsl_matrix * cholesky,
                                const gsl_vector * b,
@@ -559,6 +728,26 @@ int gsl_linalg_cholesky_solve2 (const gsl_matrix * LLT,
 
 int gsl_linalg_cholesky_rcond (const gsl_matrix * LLT, double * rcond,
                                gsl_vector * work);
+int gsl_linalg_cholesky_rcond_block (const gsl_matrix * LLT, double * rcond,
+                                     gsl_linalg_condest_workspace * w);
+
+int gsl_linalg_cholesky_update (gsl_matrix * LLT, gsl_vector * v);
+int gsl_linalg_cholesky_downdate (gsl_matrix * LLT, gsl_vector * v);
+int gsl_linalg_cholesky_update_rankk (gsl_matrix * LLT, gsl_matrix * V);
+int gsl_linalg_cholesky_downdate_rankk (gsl_matrix * LLT, gsl_matrix * V);
+
+/* Mixed precision solvers */
+
+gsl_linalg_mixed_workspace * gsl_linalg_mixed_alloc (const size_t N);
+void gsl_linalg_mixed_free (gsl_linalg_mixed_workspace * w);
+size_t gsl_linalg_mixed_niter (const gsl_linalg_mixed_workspace * w);
+int gsl_linalg_mixed_fallback (const gsl_linalg_mixed_workspace * w);
+int gsl_linalg_LU_mixed_decomp (const gsl_matrix * A, gsl_linalg_mixed_workspace * w);
+int gsl_linalg_LU_mixed_solve (const gsl_matrix * A, const gsl_vector * b, gsl_vector * x,
+                               gsl_linalg_mixed_workspace * w);
+int gsl_linalg_cholesky_mixed_decomp (const gsl_matrix * A, gsl_linalg_mixed_workspace * w);
+int gsl_linalg_cholesky_mixed_solve (const gsl_matrix * A, const gsl_vector * b, gsl_vector * x,
+                                     gsl_linalg_mixed_workspace * w);
 
 /* Complex Cholesky Decomposition */
 
@@ -644,6 +833,7 @@ int gsl_linalg_cholesky_band_rcond (const gsl_matrix * LLT, double * rcond, gsl_
 /* L D L^T decomposition */
 
 int gsl_linalg_ldlt_decomp (gsl_matrix * A);
+int gsl_linalg_ldlt_decomp_par (gsl_matrix * A, gsl_thread_pool * pool);
 
 int gsl_linalg_ldlt_solve (const gsl_matrix * LDLT, const gsl_vector * b, gsl_vector * x);
 
@@ -651,6 +841,11 @@ int gsl_linalg_ldlt_svx (const gsl_matrix * LDLT, gsl_vector * x);
 
 int gsl_linalg_ldlt_rcond (const gsl_matrix * LDLT, double * rcond, gsl_vector * work);
 
+int gsl_linalg_ldlt_update (gsl_matrix * LDLT, gsl_vector * v);
+int gsl_linalg_ldlt_downdate (gsl_matrix * LDLT, gsl_vector * v);
+int gsl_linalg_ldlt_update_rankk (gsl_matrix * LDLT, gsl_matrix * V);
+int gsl_linalg_ldlt_downdate_rankk (gsl_matrix * LDLT, gsl_matrix * V);
+
 /* Banded L D L^T decomposition */
 
 int gsl_linalg_ldlt_band_decomp (gsl_matrix * A);
@@ -663,6 +858,21 @@ int gsl_linalg_ldlt_band_unpack (const gsl_matrix * LDLT, gsl_matrix * L, gsl_ve
 
 int gsl_linalg_ldlt_band_rcond (const gsl_matrix * LDLT, double * rcond, gsl_vector * work);
 
+/* Banded LU decomposition */
+
+int gsl_linalg_LU_band_decomp (const size_t M, const size_t lb, const size_t ub,
+                               gsl_matrix * AB, gsl_vector_uint * piv);
+
+int gsl_linalg_LU_band_solve (const size_t lb, const size_t ub, const gsl_matrix * LUB,
+                              const gsl_vector_uint * piv, const gsl_vector * b, gsl_vector * x);
+
+int gsl_linalg_LU_band_svx (const size_t lb, const size_t ub, const gsl_matrix * LUB,
+                            const gsl_vector_uint * piv, gsl_vector * x);
+
+int gsl_linalg_LU_band_unpack (const size_t M, const size_t lb, const size_t ub,
+                               const gsl_matrix * LUB, const gsl_vector_uint * piv,
+                               gsl_matrix * L, gsl_matrix * U);
+
 /* Symmetric to symmetric tridiagonal decomposition */
 
 int gsl_linalg_symmtd_decomp (gsl_matrix * A, 
@@ -678,6 +888,29 @@ int gsl_linalg_symmtd_unpack_T (const gsl_matrix * A,
                                 gsl_vector * diag, 
                                 gsl_vector * subdiag);
 
+int gsl_linalg_symmtd_Qmat (const gsl_matrix * A,
+                            const gsl_vector * tau,
+                            gsl_matrix * B);
+
+size_t gsl_linalg_symmtd_decomp_wsize (const size_t N);
+int gsl_linalg_symmtd_decomp_ws (gsl_matrix * A,
+                                 gsl_vector * tau,
+                                 gsl_linalg_workspace * w);
+
+size_t gsl_linalg_symmtd_unpack_wsize (const size_t N);
+int gsl_linalg_symmtd_unpack_ws (const gsl_matrix * A,
+                                 const gsl_vector * tau,
+                                 gsl_matrix * Q,
+                                 gsl_vector * diag,
+                                 gsl_vector * subdiag,
+                                 gsl_linalg_workspace * w);
+
+size_t gsl_linalg_symmtd_Qmat_wsize (const size_t N, const size_t K);
+int gsl_linalg_symmtd_Qmat_ws (const gsl_matrix * A,
+                               const gsl_vector * tau,
+                               gsl_matrix * B,
+                               gsl_linalg_workspace * w);
+
 /* Hermitian to symmetric tridiagonal decomposition */
 
 int gsl_linalg_hermtd_decomp (gsl_matrix_complex * A, 
@@ -700,6 +933,8 @@ int gsl_linalg_hermtd_unpack_T (const gsl_matrix_complex * A,
 
 int gsl_linalg_HH_solve (gsl_matrix * A, const gsl_vector * b, gsl_vector * x);
 int gsl_linalg_HH_svx (gsl_matrix * A, gsl_vector * x);
+size_t gsl_linalg_HH_svx_wsize (const size_t N);
+int gsl_linalg_HH_svx_ws (gsl_matrix * A, gsl_vector * x, gsl_linalg_workspace * w);
 
 /* Linear solve for a symmetric tridiagonal system.
 
@@ -766,6 +1001,52 @@ int gsl_linalg_solve_cyc_tridiag (const gsl_vector * diag,
                                   const gsl_vector * b,
                                   gsl_vector * x);
 
+/* The tridiagonal solvers above, with their temporary vectors taken
+   from w, which must have at least gsl_linalg_tridiag_wsize(N) doubles
+   available */
+size_t gsl_linalg_tridiag_wsize (const size_t N);
+
+int gsl_linalg_solve_symm_tridiag_ws (const gsl_vector * diag,
+                                      const gsl_vector * offdiag,
+                                      const gsl_vector * b,
+                                      gsl_vector * x,
+                                      gsl_linalg_workspace * w);
+
+int gsl_linalg_solve_tridiag_ws (const gsl_vector * diag,
+                                 const gsl_vector * abovediag,
+                                 const gsl_vector * belowdiag,
+                                 const gsl_vector * b,
+                                 gsl_vector * x,
+                                 gsl_linalg_workspace * w);
+
+int gsl_linalg_solve_symm_cyc_tridiag_ws (const gsl_vector * diag,
+                                          const gsl_vector * offdiag,
+                                          const gsl_vector * b,
+                                          gsl_vector * x,
+                                          gsl_linalg_workspace * w);
+
+int gsl_linalg_solve_cyc_tridiag_ws (const gsl_vector * diag,
+                                     const gsl_vector * abovediag,
+                                     const gsl_vector * belowdiag,
+                                     const gsl_vector * b,
+                                     gsl_vector * x,
+                                     gsl_linalg_workspace * w);
+
+/* Nonsymmetric tridiagonal systems: K systems stored in the columns
+   of N-by-K matrices, and one system on a thread pool */
+int gsl_linalg_solve_tridiag_batch (const gsl_matrix * diag,
+                                    const gsl_matrix * abovediag,
+                                    const gsl_matrix * belowdiag,
+                                    const gsl_matrix * B,
+                                    gsl_matrix * X);
+
+int gsl_linalg_solve_tridiag_par (const gsl_vector * diag,
+                                  const gsl_vector * abovediag,
+                                  const gsl_vector * belowdiag,
+                                  const gsl_vector * b,
+                                  gsl_vector * x,
+                                  gsl_thread_pool * pool);
+
 
 /* Bidiagonal decomposition */
 
@@ -790,6 +1071,27 @@ int gsl_linalg_bidiag_unpack_B (const gsl_matrix * A,
                                 gsl_vector * diag, 
                                 gsl_vector * superdiag);
 
+size_t gsl_linalg_bidiag_decomp_wsize (const size_t M, const size_t N);
+int gsl_linalg_bidiag_decomp_ws (gsl_matrix * A,
+                                 gsl_vector * tau_U,
+                                 gsl_vector * tau_V,
+                                 gsl_linalg_workspace * w);
+
+size_t gsl_linalg_bidiag_unpack_wsize (const size_t M, const size_t N);
+int gsl_linalg_bidiag_unpack_ws (const gsl_matrix * A,
+                                 const gsl_vector * tau_U,
+                                 gsl_matrix * U,
+                                 const gsl_vector * tau_V,
+                                 gsl_matrix * V,
+                                 gsl_vector * diag,
+                                 gsl_vector * superdiag,
+                                 gsl_linalg_workspace * w);
+int gsl_linalg_bidiag_unpack2_ws (gsl_matrix * A,
+                                  gsl_vector * tau_U,
+                                  gsl_vector * tau_V,
+                                  gsl_matrix * V,
+                                  gsl_linalg_workspace * w);
+
 /* Balancing */
 
 int gsl_linalg_balance_matrix (gsl_matrix * A, gsl_vector * D);
@@ -804,6 +1106,16 @@ int gsl_linalg_tri_lower_rcond(const gsl_matrix * A, double * rcond, gsl_vector
 int gsl_linalg_invnorm1(const size_t N,
                         int (* Ainvx)(CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params),
                         void * params, double * Ainvnorm, gsl_vector * work);
+gsl_linalg_condest_workspace * gsl_linalg_condest_alloc(const size_t N, const size_t t);
+void gsl_linalg_condest_free(gsl_linalg_condest_workspace * w);
+int gsl_linalg_invnorm1_block(int (* AinvX)(CBLAS_TRANSPOSE_t TransA, gsl_matrix * X, void * params),
+                              void * params, double * Ainvnorm, gsl_linalg_condest_workspace * w);
+int gsl_linalg_tri_rcond_block(CBLAS_UPLO_t Uplo, const gsl_matrix * A, double * rcond,
+                               gsl_linalg_condest_workspace * w);
+double gsl_linalg_norm1(const gsl_matrix * A);
+int gsl_linalg_ferr(const gsl_matrix * A, const gsl_vector * b, const gsl_vector * x,
+                    int (* Ainvx)(CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params),
+                    void * params, double * ferr, gsl_vector * work);
 
 /* triangular matrices */
 
@@ -18,10 +18,20 @@
  */
 
 #include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_blas.h>
 #include <gsl/gsl_linalg.h>
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_vector.h>
 
+#include "householder_wy.h"
+#include "workspace.h"
+
+static int hessenberg_decomp_L2 (gsl_matrix * A, gsl_vector * tau, const size_t k);
+static void hessenberg_panel (gsl_matrix * A, const size_t k, const size_t nb,
+                              gsl_vector * tau, gsl_matrix * T, gsl_matrix * Y);
+
 /*
 gsl_linalg_hessenberg_decomp()
   Compute the Householder reduction to Hessenberg form of a
@@ -61,10 +71,61 @@ row i + 3, column i, and so on.
 Also note that for the purposes of computing U(i),
 v(1:i) = 0, v(i + 1) = 1, and v(i+2:n) is what is stored in
 column i of A beneath the subdiagonal.
+
+For large matrices the reduction is blocked as in LAPACK (dgehrd):
+the reflectors of WY_BLOCK columns are computed from a panel, together
+with Y = A V T, where I - V T V^T is the product of the reflectors in
+compact WY form. The rest of the matrix is then updated with matrix
+products,
+
+A := (I - V T V^T)^T (A - Y V^T)
+
+so that most of the operations, apart from the matrix-vector products
+with the trailing matrix needed to form Y, are done by Level 3 BLAS.
 */
 
 int
 gsl_linalg_hessenberg_decomp(gsl_matrix *A, gsl_vector *tau)
+{
+  gsl_linalg_workspace w;
+  int status;
+
+  if (linalg_workspace_init (&w, gsl_linalg_hessenberg_decomp_wsize (A->size1)))
+    {
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  status = gsl_linalg_hessenberg_decomp_ws (A, tau, &w);
+
+  linalg_workspace_clear (&w);
+
+  return status;
+} /* gsl_linalg_hessenberg_decomp() */
+
+/*
+gsl_linalg_hessenberg_decomp_wsize()
+  Size in doubles of the arena needed by gsl_linalg_hessenberg_decomp_ws()
+for an N-by-N matrix
+*/
+
+size_t
+gsl_linalg_hessenberg_decomp_wsize (const size_t N)
+{
+  if (N <= WY_CROSSOVER)
+    return 0;
+  else
+    return WY_BLOCK * (WY_BLOCK + 2 * N);
+}
+
+/*
+gsl_linalg_hessenberg_decomp_ws()
+  Hessenberg reduction as in gsl_linalg_hessenberg_decomp(), with the
+temporary matrices of the blocked algorithm taken from the arena w
+*/
+
+int
+gsl_linalg_hessenberg_decomp_ws (gsl_matrix * A, gsl_vector * tau,
+                                 gsl_linalg_workspace * w)
 {
   const size_t N = A->size1;
 
@@ -77,58 +138,250 @@ gsl_linalg_hessenberg_decomp(gsl_matrix *A, gsl_vector *tau)
     {
       GSL_ERROR ("tau vector must match matrix size", GSL_EBADLEN);
     }
+  else if (linalg_workspace_avail (w) < gsl_linalg_hessenberg_decomp_wsize (N))
+    {
+      GSL_ERROR ("workspace is too small", GSL_EBADLEN);
+    }
   else if (N < 3)
     {
       /* nothing to do */
       return GSL_SUCCESS;
     }
+  else if (N <= WY_CROSSOVER)
+    {
+      return hessenberg_decomp_L2 (A, tau, 0);
+    }
   else
     {
-      size_t i;           /* looping */
-      gsl_vector_view c,  /* matrix column */
-                      hv; /* householder vector */
-      gsl_matrix_view m;
-      double tau_i;       /* beta in algorithm 7.4.2 */
-
-      for (i = 0; i < N - 2; ++i)
+      const size_t nb = WY_BLOCK;
+      double *work = linalg_workspace_get (w, gsl_linalg_hessenberg_decomp_wsize (N));
+      gsl_matrix_view Tv = gsl_matrix_view_array (work, nb, nb);
+      gsl_matrix_view Yv = gsl_matrix_view_array (work + nb * nb, N, nb);
+      gsl_matrix_view Wv = gsl_matrix_view_array (work + nb * (nb + N), nb, N);
+      gsl_matrix *T = &Tv.matrix, *Y = &Yv.matrix, *W = &Wv.matrix;
+      size_t j, k = 0;
+
+      /* reduce nb columns at a time until the trailing matrix is small
+         enough for the unblocked algorithm */
+
+      while (N - k > WY_CROSSOVER)
         {
-          /*
-           * make a copy of A(i + 1:n, i) and store it in the section
-           * of 'tau' that we haven't stored coefficients in yet
-           */
+          const size_t m = N - k - nb; /* number of trailing columns */
+          gsl_matrix_view V = gsl_matrix_submatrix (A, k + 1, k, N - k - 1, nb);
+          gsl_matrix_view Vb = gsl_matrix_submatrix (A, k + nb, k, m, nb);
+          gsl_matrix_view A2 = gsl_matrix_submatrix (A, 0, k + nb, N, m);
+          gsl_matrix_view C = gsl_matrix_submatrix (A, k + 1, k + nb, N - k - 1, m);
+          gsl_matrix_view Wm = gsl_matrix_submatrix (W, 0, 0, nb, m);
+          double ei;
+
+          hessenberg_panel (A, k, nb, tau, T, Y);
+
+          /* right update of the trailing columns, A2 := A2 - Y V^T, with
+             the unit element of the last reflector put in place */
+          ei = gsl_matrix_get (A, k + nb, k + nb - 1);
+          gsl_matrix_set (A, k + nb, k + nb - 1, 1.0);
+          gsl_blas_dgemm (CblasNoTrans, CblasTrans, -1.0, Y, &Vb.matrix, 1.0, &A2.matrix);
+          gsl_matrix_set (A, k + nb, k + nb - 1, ei);
+
+          /* right update of rows 0..k of the panel columns; the other
+             rows were updated as the panel was reduced */
+          {
+            gsl_matrix_view Y1 = gsl_matrix_submatrix (Y, 0, 0, k + 1, nb - 1);
+            gsl_matrix_view V1 = gsl_matrix_submatrix (A, k + 1, k, nb - 1, nb - 1);
+
+            gsl_blas_dtrmm (CblasRight, CblasLower, CblasTrans, CblasUnit, 1.0, &V1.matrix, &Y1.matrix);
+
+            for (j = 0; j < nb - 1; ++j)
+              {
+                gsl_vector_view a = gsl_matrix_subcolumn (A, k + j + 1, 0, k + 1);
+                gsl_vector_view y = gsl_matrix_column (&Y1.matrix, j);
+                gsl_vector_sub (&a.vector, &y.vector);
+              }
+          }
+
+          /* left update of the trailing columns, C := Q^T C */
+          linalg_wy_left_col (CblasTrans, &V.matrix, T, &C.matrix, &Wm.matrix);
+
+          k += nb;
+        }
 
-          c = gsl_matrix_subcolumn(A, i, i + 1, N - i - 1);
+      linalg_workspace_release (w, work);
 
-          hv = gsl_vector_subvector(tau, i + 1, N - (i + 1));
-          gsl_vector_memcpy(&hv.vector, &c.vector);
+      return hessenberg_decomp_L2 (A, tau, k);
+    }
+} /* gsl_linalg_hessenberg_decomp_ws() */
 
-          /* compute householder transformation of A(i+1:n,i) */
-          tau_i = gsl_linalg_householder_transform(&hv.vector);
+/*
+hessenberg_decomp_L2()
+  Reduce columns k, k + 1, ..., N - 3 of A with unblocked Householder
+transformations, applied to the whole matrix (algorithm 7.4.2 of
+Golub & Van Loan)
+*/
 
-          /* apply left householder matrix (I - tau_i v v') to A */
-          m = gsl_matrix_submatrix(A, i + 1, i, N - (i + 1), N - i);
-          gsl_linalg_householder_hm(tau_i, &hv.vector, &m.matrix);
+static int
+hessenberg_decomp_L2 (gsl_matrix * A, gsl_vector * tau, const size_t k)
+{
+  const size_t N = A->size1;
+  size_t i;           /* looping */
+  gsl_vector_view c,  /* matrix column */
+                  hv; /* householder vector */
+  gsl_matrix_view m;
+  double tau_i;       /* beta in algorithm 7.4.2 */
 
-          /* apply right householder matrix (I - tau_i v v') to A */
-          m = gsl_matrix_submatrix(A, 0, i + 1, N, N - (i + 1));
-          gsl_linalg_householder_mh(tau_i, &hv.vector, &m.matrix);
+  for (i = k; i < N - 2; ++i)
+    {
+      /*
+       * make a copy of A(i + 1:n, i) and store it in the section
+       * of 'tau' that we haven't stored coefficients in yet
+       */
+
+      c = gsl_matrix_subcolumn(A, i, i + 1, N - i - 1);
+
+      hv = gsl_vector_subvector(tau, i + 1, N - (i + 1));
+      gsl_vector_memcpy(&hv.vector, &c.vector);
+
+      /* compute householder transformation of A(i+1:n,i) */
+      tau_i = gsl_linalg_householder_transform(&hv.vector);
+
+      /* apply left householder matrix (I - tau_i v v') to A */
+      m = gsl_matrix_submatrix(A, i + 1, i, N - (i + 1), N - i);
+      gsl_linalg_householder_hm(tau_i, &hv.vector, &m.matrix);
+
+      /* apply right householder matrix (I - tau_i v v') to A */
+      m = gsl_matrix_submatrix(A, 0, i + 1, N, N - (i + 1));
+      gsl_linalg_householder_mh(tau_i, &hv.vector, &m.matrix);
+
+      /* save Householder coefficient */
+      gsl_vector_set(tau, i, tau_i);
+
+      /*
+       * store Householder vector below the subdiagonal in column
+       * i of the matrix. hv(1) does not need to be stored since
+       * it is always 1.
+       */
+      c = gsl_vector_subvector(&c.vector, 1, c.vector.size - 1);
+      hv = gsl_vector_subvector(&hv.vector, 1, hv.vector.size - 1);
+      gsl_vector_memcpy(&c.vector, &hv.vector);
+    }
 
-          /* save Householder coefficient */
-          gsl_vector_set(tau, i, tau_i);
+  return GSL_SUCCESS;
+}
 
-          /*
-           * store Householder vector below the subdiagonal in column
-           * i of the matrix. hv(1) does not need to be stored since
-           * it is always 1.
-           */
-          c = gsl_vector_subvector(&c.vector, 1, c.vector.size - 1);
-          hv = gsl_vector_subvector(&hv.vector, 1, hv.vector.size - 1);
-          gsl_vector_memcpy(&c.vector, &hv.vector);
+/*
+hessenberg_panel()
+  Reduce the nb columns k, ..., k + nb - 1 of the N-by-N matrix A, and
+form the triangular factor T of the block of reflectors and the
+N-by-nb matrix Y = A V T (LAPACK dlahr2)
+
+Notes:
+1) Rows k + 1 to N - 1 of the panel columns are updated with the
+previous reflectors of the panel just before each column is reduced.
+Rows 0 to k, and the columns to the right of the panel, are left
+for the caller to update with T and Y.
+
+2) On output, the unit element of the last reflector, A(k+nb,k+nb-1),
+holds the subdiagonal element as usual.
+*/
+
+static void
+hessenberg_panel (gsl_matrix * A, const size_t k, const size_t nb,
+                  gsl_vector * tau, gsl_matrix * T, gsl_matrix * Y)
+{
+  const size_t N = A->size1;
+  double ei = 0.0;
+  size_t i;
+
+  for (i = 0; i < nb; ++i)
+    {
+      const size_t c = k + i; /* column to reduce */
+      gsl_vector_view b = gsl_matrix_subcolumn (A, c, k + 1, N - k - 1);
+      gsl_vector_view v = gsl_matrix_subcolumn (A, c, c + 1, N - c - 1);
+      gsl_vector_view y = gsl_matrix_subcolumn (Y, i, k + 1, N - k - 1);
+      double tau_i;
+
+      if (i > 0)
+        {
+          gsl_matrix_view Yp = gsl_matrix_submatrix (Y, k + 1, 0, N - k - 1, i);
+          gsl_vector_view a = gsl_matrix_subrow (A, c, k, i);
+          gsl_matrix_view V1 = gsl_matrix_submatrix (A, k + 1, k, i, i);
+          gsl_matrix_view V2 = gsl_matrix_submatrix (A, c + 1, k, N - c - 1, i);
+          gsl_matrix_view T00 = gsl_matrix_submatrix (T, 0, 0, i, i);
+          gsl_vector_view b1 = gsl_vector_subvector (&b.vector, 0, i);
+          gsl_vector_view b2 = gsl_vector_subvector (&b.vector, i, N - c - 1);
+          gsl_vector_view wv = gsl_matrix_subcolumn (T, nb - 1, 0, i);
+
+          /* apply the previous reflectors from the right, b := b - Y V(c,:)^T,
+             where V(c,i-1) is the unit element of the last reflector */
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Yp.matrix, &a.vector, 1.0, &b.vector);
+
+          /* apply them from the left, b := (I - V T^T V^T) b, using the
+             last column of T as workspace */
+          gsl_vector_memcpy (&wv.vector, &b1.vector);
+          gsl_blas_dtrmv (CblasLower, CblasTrans, CblasUnit, &V1.matrix, &wv.vector);
+          gsl_blas_dgemv (CblasTrans, 1.0, &V2.matrix, &b2.vector, 1.0, &wv.vector);
+          gsl_blas_dtrmv (CblasUpper, CblasTrans, CblasNonUnit, &T00.matrix, &wv.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &V2.matrix, &wv.vector, 1.0, &b2.vector);
+          gsl_blas_dtrmv (CblasLower, CblasNoTrans, CblasUnit, &V1.matrix, &wv.vector);
+          gsl_vector_sub (&b1.vector, &wv.vector);
+
+          gsl_matrix_set (A, c, c - 1, ei);
         }
 
-      return GSL_SUCCESS;
+      /* reflector annihilating A(c+2:N-1,c) */
+      tau_i = gsl_linalg_householder_transform (&v.vector);
+      gsl_vector_set (tau, c, tau_i);
+      ei = gsl_vector_get (&v.vector, 0);
+      gsl_vector_set (&v.vector, 0, 1.0);
+
+      /* y := tau_i (A(k+1:N-1,c+1:N-1) v - Y T(0:i-1,i)), with
+         T(0:i-1,i) := V(c+1:N-1,:)^T v */
+      {
+        gsl_matrix_view A2 = gsl_matrix_submatrix (A, k + 1, c + 1, N - k - 1, N - c - 1);
+
+        gsl_blas_dgemv (CblasNoTrans, 1.0, &A2.matrix, &v.vector, 0.0, &y.vector);
+      }
+
+      if (i > 0)
+        {
+          gsl_matrix_view Yp = gsl_matrix_submatrix (Y, k + 1, 0, N - k - 1, i);
+          gsl_matrix_view V2 = gsl_matrix_submatrix (A, c + 1, k, N - c - 1, i);
+          gsl_matrix_view T00 = gsl_matrix_submatrix (T, 0, 0, i, i);
+          gsl_vector_view t = gsl_matrix_subcolumn (T, i, 0, i);
+
+          gsl_blas_dgemv (CblasTrans, 1.0, &V2.matrix, &v.vector, 0.0, &t.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Yp.matrix, &t.vector, 1.0, &y.vector);
+
+          /* T(0:i-1,i) := -tau_i T(0:i-1,0:i-1) V^T v */
+          gsl_blas_dscal (-tau_i, &t.vector);
+          gsl_blas_dtrmv (CblasUpper, CblasNoTrans, CblasNonUnit, &T00.matrix, &t.vector);
+        }
+
+      gsl_blas_dscal (tau_i, &y.vector);
+      gsl_matrix_set (T, i, i, tau_i);
     }
-} /* gsl_linalg_hessenberg_decomp() */
+
+  gsl_matrix_set (A, k + nb, k + nb - 1, ei);
+
+  /* Y(0:k,:) := A(0:k,k+1:N-1) V T */
+  {
+    gsl_matrix_view Y1 = gsl_matrix_submatrix (Y, 0, 0, k + 1, nb);
+    gsl_matrix_view A1 = gsl_matrix_submatrix (A, 0, k + 1, k + 1, nb);
+    gsl_matrix_view V1 = gsl_matrix_submatrix (A, k + 1, k, nb, nb);
+
+    gsl_matrix_memcpy (&Y1.matrix, &A1.matrix);
+    gsl_blas_dtrmm (CblasRight, CblasLower, CblasNoTrans, CblasUnit, 1.0, &V1.matrix, &Y1.matrix);
+
+    if (N > k + nb + 1)
+      {
+        gsl_matrix_view A2 = gsl_matrix_submatrix (A, 0, k + nb + 1, k + 1, N - k - nb - 1);
+        gsl_matrix_view V2 = gsl_matrix_submatrix (A, k + nb + 1, k, N - k - nb - 1, nb);
+
+        gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &A2.matrix, &V2.matrix, 1.0, &Y1.matrix);
+      }
+
+    gsl_blas_dtrmm (CblasRight, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0, T, &Y1.matrix);
+  }
+}
 
 /*
 gsl_linalg_hessenberg_unpack()
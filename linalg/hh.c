@@ -26,6 +26,8 @@
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_linalg.h>
 
+#include "workspace.h"
+
 #define REAL double
 
 /* [Engeln-Mullges + Uhlig, Alg. 4.42]
@@ -58,6 +60,32 @@ gsl_linalg_HH_solve (gsl_matrix * A, const gsl_vector * b, gsl_vector * x)
 
 int
 gsl_linalg_HH_svx (gsl_matrix * A, gsl_vector * x)
+{
+  gsl_linalg_workspace w;
+  int status;
+
+  if (linalg_workspace_init (&w, gsl_linalg_HH_svx_wsize (A->size1)))
+    {
+      GSL_ERROR ("could not allocate memory for workspace", GSL_ENOMEM);
+    }
+
+  status = gsl_linalg_HH_svx_ws (A, x, &w);
+
+  linalg_workspace_clear (&w);
+
+  return status;
+}
+
+/* size in doubles of the arena needed by gsl_linalg_HH_svx_ws */
+
+size_t
+gsl_linalg_HH_svx_wsize (const size_t N)
+{
+  return N;
+}
+
+int
+gsl_linalg_HH_svx_ws (gsl_matrix * A, gsl_vector * x, gsl_linalg_workspace * w)
 {
   if (A->size1 > A->size2)
     {
@@ -69,17 +97,16 @@ gsl_linalg_HH_svx (gsl_matrix * A, gsl_vector * x)
     {
       GSL_ERROR ("matrix and vector sizes must be equal", GSL_EBADLEN);
     }
+  else if (linalg_workspace_avail (w) < gsl_linalg_HH_svx_wsize (A->size1))
+    {
+      GSL_ERROR ("workspace is too small", GSL_EBADLEN);
+    }
   else
     {
       const size_t N = A->size1;
       const size_t M = A->size2;
       size_t i, j, k;
-      REAL *d = (REAL *) malloc (N * sizeof (REAL));
-
-      if (d == 0)
-        {
-          GSL_ERROR ("could not allocate memory for workspace", GSL_ENOMEM);
-        }
+      REAL *d = linalg_workspace_get (w, N);
 
       /* Perform Householder transformation. */
 
@@ -101,7 +128,7 @@ gsl_linalg_HH_svx (gsl_matrix * A, gsl_vector * x)
           if (r == 0.0)
             {
               /* Rank of matrix is less than size1. */
-              free (d);
+              linalg_workspace_release (w, d);
               GSL_ERROR ("matrix is rank deficient", GSL_ESING);
             }
 
@@ -138,7 +165,7 @@ gsl_linalg_HH_svx (gsl_matrix * A, gsl_vector * x)
           if (fabs (alpha) < 2.0 * GSL_DBL_EPSILON * sqrt (max_norm))
             {
               /* Apparent singularity. */
-              free (d);
+              linalg_workspace_release (w, d);
               GSL_ERROR("apparent singularity detected", GSL_ESING);
             }
 
@@ -172,7 +199,7 @@ gsl_linalg_HH_svx (gsl_matrix * A, gsl_vector * x)
           gsl_vector_set (x, i, (xi - sum) / d[i]);
         }
 
-      free (d);
+      linalg_workspace_release (w, d);
       return GSL_SUCCESS;
     }
 }
@@ -0,0 +1,316 @@
+/* linalg/householder_wy.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+
+#include "householder_wy.h"
+
+/* Blocks of Householder reflectors in compact WY form, see householder_wy.h */
+
+/*
+linalg_wy_T_col()
+  Form the triangular factor T of the k reflectors stored in the
+columns of the m-by-k matrix V, m >= k, with coefficients tau
+*/
+
+void
+linalg_wy_T_col (const gsl_matrix * V, const gsl_vector * tau, gsl_matrix * T)
+{
+  const size_t m = V->size1;
+  const size_t k = V->size2;
+  size_t j;
+
+  for (j = 0; j < k; j++)
+    {
+      const double tau_j = gsl_vector_get (tau, j);
+
+      gsl_matrix_set (T, j, j, tau_j);
+
+      if (j > 0)
+        {
+          gsl_vector_view t = gsl_matrix_subcolumn (T, j, 0, j);
+          gsl_vector_const_view vj = gsl_matrix_const_subrow (V, j, 0, j);
+          gsl_matrix_const_view T00 = gsl_matrix_const_submatrix (T, 0, 0, j, j);
+
+          /* t := V^T v_j, split at the unit element of v_j */
+          gsl_vector_memcpy (&t.vector, &vj.vector);
+
+          if (j + 1 < m)
+            {
+              gsl_matrix_const_view V2 = gsl_matrix_const_submatrix (V, j + 1, 0, m - j - 1, j);
+              gsl_vector_const_view x = gsl_matrix_const_subcolumn (V, j, j + 1, m - j - 1);
+              gsl_blas_dgemv (CblasTrans, 1.0, &V2.matrix, &x.vector, 1.0, &t.vector);
+            }
+
+          /* t := -tau_j T t */
+          gsl_blas_dtrmv (CblasUpper, CblasNoTrans, CblasNonUnit, &T00.matrix, &t.vector);
+          gsl_blas_dscal (-tau_j, &t.vector);
+        }
+    }
+}
+
+/*
+linalg_wy_T_row()
+  Form the triangular factor T of the k reflectors stored in the rows
+of the k-by-m matrix Y, m >= k, with coefficients tau
+*/
+
+void
+linalg_wy_T_row (const gsl_matrix * Y, const gsl_vector * tau, gsl_matrix * T)
+{
+  const size_t m = Y->size2;
+  const size_t k = Y->size1;
+  size_t j;
+
+  for (j = 0; j < k; j++)
+    {
+      const double tau_j = gsl_vector_get (tau, j);
+
+      gsl_matrix_set (T, j, j, tau_j);
+
+      if (j > 0)
+        {
+          gsl_vector_view t = gsl_matrix_subcolumn (T, j, 0, j);
+          gsl_vector_const_view yj = gsl_matrix_const_subcolumn (Y, j, 0, j);
+          gsl_matrix_const_view T00 = gsl_matrix_const_submatrix (T, 0, 0, j, j);
+
+          gsl_vector_memcpy (&t.vector, &yj.vector);
+
+          if (j + 1 < m)
+            {
+              gsl_matrix_const_view Y2 = gsl_matrix_const_submatrix (Y, 0, j + 1, j, m - j - 1);
+              gsl_vector_const_view x = gsl_matrix_const_subrow (Y, j, j + 1, m - j - 1);
+              gsl_blas_dgemv (CblasNoTrans, 1.0, &Y2.matrix, &x.vector, 1.0, &t.vector);
+            }
+
+          gsl_blas_dtrmv (CblasUpper, CblasNoTrans, CblasNonUnit, &T00.matrix, &t.vector);
+          gsl_blas_dscal (-tau_j, &t.vector);
+        }
+    }
+}
+
+/*
+linalg_wy_left_col()
+  Apply a block of reflectors stored in the columns of V (m-by-k) to
+the m-by-n matrix C from the left,
+
+C := (I - V op(T) V^T) C
+
+with op(T) = T for the product H_0 ... H_{k-1} and op(T) = T^T for
+its transpose. W is k-by-n workspace.
+*/
+
+void
+linalg_wy_left_col (CBLAS_TRANSPOSE_t TransT, const gsl_matrix * V,
+                    const gsl_matrix * T, gsl_matrix * C, gsl_matrix * W)
+{
+  const size_t m = V->size1;
+  const size_t k = V->size2;
+  const size_t n = C->size2;
+  gsl_matrix_const_view V1 = gsl_matrix_const_submatrix (V, 0, 0, k, k);
+  gsl_matrix_view C1 = gsl_matrix_submatrix (C, 0, 0, k, n);
+
+  /* W := V^T C = V1^T C1 + V2^T C2 */
+  gsl_matrix_memcpy (W, &C1.matrix);
+  gsl_blas_dtrmm (CblasLeft, CblasLower, CblasTrans, CblasUnit, 1.0, &V1.matrix, W);
+
+  if (m > k)
+    {
+      gsl_matrix_const_view V2 = gsl_matrix_const_submatrix (V, k, 0, m - k, k);
+      gsl_matrix_view C2 = gsl_matrix_submatrix (C, k, 0, m - k, n);
+
+      gsl_blas_dgemm (CblasTrans, CblasNoTrans, 1.0, &V2.matrix, &C2.matrix, 1.0, W);
+
+      /* W := op(T) W, C2 := C2 - V2 W */
+      gsl_blas_dtrmm (CblasLeft, CblasUpper, TransT, CblasNonUnit, 1.0, T, W);
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, -1.0, &V2.matrix, W, 1.0, &C2.matrix);
+    }
+  else
+    {
+      gsl_blas_dtrmm (CblasLeft, CblasUpper, TransT, CblasNonUnit, 1.0, T, W);
+    }
+
+  /* C1 := C1 - V1 W */
+  gsl_blas_dtrmm (CblasLeft, CblasLower, CblasNoTrans, CblasUnit, 1.0, &V1.matrix, W);
+  gsl_matrix_sub (&C1.matrix, W);
+}
+
+/*
+linalg_wy_left_row()
+  Apply the product H_0 ... H_{k-1} of a block of reflectors stored in
+the rows of Y (k-by-m) to the m-by-n matrix C from the left,
+
+C := (I - Y^T T Y) C
+
+W is k-by-n workspace.
+*/
+
+void
+linalg_wy_left_row (const gsl_matrix * Y, const gsl_matrix * T, gsl_matrix * C,
+                    gsl_matrix * W)
+{
+  const size_t m = Y->size2;
+  const size_t k = Y->size1;
+  const size_t n = C->size2;
+  gsl_matrix_const_view Y1 = gsl_matrix_const_submatrix (Y, 0, 0, k, k);
+  gsl_matrix_view C1 = gsl_matrix_submatrix (C, 0, 0, k, n);
+
+  /* W := Y C = Y1 C1 + Y2 C2 */
+  gsl_matrix_memcpy (W, &C1.matrix);
+  gsl_blas_dtrmm (CblasLeft, CblasUpper, CblasNoTrans, CblasUnit, 1.0, &Y1.matrix, W);
+
+  if (m > k)
+    {
+      gsl_matrix_const_view Y2 = gsl_matrix_const_submatrix (Y, 0, k, k, m - k);
+      gsl_matrix_view C2 = gsl_matrix_submatrix (C, k, 0, m - k, n);
+
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &Y2.matrix, &C2.matrix, 1.0, W);
+
+      /* W := T W, C2 := C2 - Y2^T W */
+      gsl_blas_dtrmm (CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0, T, W);
+      gsl_blas_dgemm (CblasTrans, CblasNoTrans, -1.0, &Y2.matrix, W, 1.0, &C2.matrix);
+    }
+  else
+    {
+      gsl_blas_dtrmm (CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0, T, W);
+    }
+
+  /* C1 := C1 - Y1^T W */
+  gsl_blas_dtrmm (CblasLeft, CblasUpper, CblasTrans, CblasUnit, 1.0, &Y1.matrix, W);
+  gsl_matrix_sub (&C1.matrix, W);
+}
+
+/*
+linalg_wy_unpack_col()
+  Overwrite the M-by-N matrix A, M >= N, which holds N reflectors in
+its columns below the diagonal, with the first N columns of
+
+Q = H_0 H_1 ... H_{N-1}
+
+The coefficient tau_j is read just before the reflectors of its block
+are applied, so tau may be stored in the diagonal of A.
+
+Notes:
+1) The blocks are processed from last to first. For each block, the
+rows of the block in the columns to its right are set to zero, which
+is their value in Q before the block is applied, the block is applied
+to those columns with Level 3 BLAS, and its own columns are formed
+one reflector at a time with gsl_linalg_householder_hm1.
+
+2) If work is not NULL, it holds WY_BLOCK * (WY_BLOCK + N) doubles
+which are used for T and W when N > WY_CROSSOVER; otherwise they
+are allocated.
+*/
+
+int
+linalg_wy_unpack_col (gsl_matrix * A, const gsl_vector * tau, double * work)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  gsl_matrix *T = NULL, *W = NULL;
+  gsl_matrix_view Tv, Wv;
+  size_t nb = N, i0, j;
+
+  if (N == 0)
+    return GSL_SUCCESS;
+
+  if (N > WY_CROSSOVER && work != NULL)
+    {
+      nb = WY_BLOCK;
+      Tv = gsl_matrix_view_array (work, nb, nb);
+      Wv = gsl_matrix_view_array (work + nb * nb, nb, N);
+      T = &Tv.matrix;
+      W = &Wv.matrix;
+    }
+  else if (N > WY_CROSSOVER)
+    {
+      nb = WY_BLOCK;
+      T = gsl_matrix_alloc (nb, nb);
+      W = gsl_matrix_alloc (nb, N);
+
+      if (T == NULL || W == NULL)
+        {
+          if (T != NULL)
+            gsl_matrix_free (T);
+          if (W != NULL)
+            gsl_matrix_free (W);
+          GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+        }
+    }
+
+  for (i0 = ((N - 1) / nb) * nb; ; i0 -= nb)
+    {
+      const size_t ib = GSL_MIN (nb, N - i0);
+      double tau_b[WY_BLOCK];
+
+      if (T != NULL)
+        {
+          gsl_matrix_view V = gsl_matrix_submatrix (A, i0, i0, M - i0, ib);
+          gsl_matrix_view Tb = gsl_matrix_submatrix (T, 0, 0, ib, ib);
+          gsl_vector_const_view t = gsl_vector_const_subvector (tau, i0, ib);
+
+          linalg_wy_T_col (&V.matrix, &t.vector, &Tb.matrix);
+
+          for (j = 0; j < ib; j++)
+            tau_b[j] = gsl_matrix_get (&Tb.matrix, j, j);
+
+          if (i0 + ib < N)
+            {
+              gsl_matrix_view A12 = gsl_matrix_submatrix (A, i0, i0 + ib, ib, N - i0 - ib);
+              gsl_matrix_view C = gsl_matrix_submatrix (A, i0, i0 + ib, M - i0, N - i0 - ib);
+              gsl_matrix_view Wb = gsl_matrix_submatrix (W, 0, 0, ib, N - i0 - ib);
+
+              gsl_matrix_set_zero (&A12.matrix);
+              linalg_wy_left_col (CblasNoTrans, &V.matrix, &Tb.matrix, &C.matrix, &Wb.matrix);
+            }
+
+          for (j = ib; j-- > 0;)
+            {
+              gsl_matrix_view m = gsl_matrix_submatrix (A, i0 + j, i0 + j, M - i0 - j, ib - j);
+              gsl_linalg_householder_hm1 (tau_b[j], &m.matrix);
+            }
+        }
+      else
+        {
+          /* unblocked */
+          for (j = N; j-- > 0;)
+            {
+              double tj = gsl_vector_get (tau, j);
+              gsl_matrix_view m = gsl_matrix_submatrix (A, j, j, M - j, N - j);
+              gsl_linalg_householder_hm1 (tj, &m.matrix);
+            }
+        }
+
+      if (i0 == 0)
+        break;
+    }
+
+  if (T != NULL && work == NULL)
+    {
+      gsl_matrix_free (T);
+      gsl_matrix_free (W);
+    }
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,67 @@
+/* linalg/householder_wy.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_LINALG_HOUSEHOLDER_WY_H__
+#define __GSL_LINALG_HOUSEHOLDER_WY_H__
+
+/*
+ * Blocks of Householder reflectors in compact WY form,
+ *
+ *   H_0 H_1 ... H_{k-1} = I - V T V^T
+ *
+ * where H_j = I - tau_j v_j v_j^T, the columns of V are the vectors v_j
+ * and T is a k-by-k upper triangular matrix (Schreiber and Van Loan,
+ * SIAM J. Sci. Stat. Comput. 10, 1989). Applying the block costs three
+ * matrix products instead of k rank-1 updates.
+ *
+ * The vectors are stored as by gsl_linalg_householder_transform: the
+ * first element of v_j is an implicit 1, which is not referenced, and
+ * the elements before it are implicit zeros. Stored in the columns of
+ * a matrix, V is unit lower trapezoidal (QR, and U of the bidiagonal
+ * decomposition); stored in the rows of a matrix Y = V^T, it is unit
+ * upper trapezoidal (V of the bidiagonal decomposition).
+ *
+ * Internal interface of householder_wy.c, used by the blocked
+ * bidiagonal, Hessenberg, tridiagonal and SVD routines.
+ */
+
+/* number of reflectors in a block */
+#define WY_BLOCK               32
+
+/* number of reflectors below which they are applied one at a time */
+#define WY_CROSSOVER           64
+
+/* triangular factor T of the reflectors in the columns of V */
+void linalg_wy_T_col (const gsl_matrix * V, const gsl_vector * tau, gsl_matrix * T);
+
+/* triangular factor T of the reflectors in the rows of Y */
+void linalg_wy_T_row (const gsl_matrix * Y, const gsl_vector * tau, gsl_matrix * T);
+
+/* C := (I - V op(T) V^T) C */
+void linalg_wy_left_col (CBLAS_TRANSPOSE_t TransT, const gsl_matrix * V,
+                         const gsl_matrix * T, gsl_matrix * C, gsl_matrix * W);
+
+/* C := (I - Y^T T Y) C */
+void linalg_wy_left_row (const gsl_matrix * Y, const gsl_matrix * T, gsl_matrix * C,
+                         gsl_matrix * W);
+
+/* overwrite A with the first columns of Q = H_0 ... H_{N-1} */
+int linalg_wy_unpack_col (gsl_matrix * A, const gsl_vector * tau, double * work);
+
+#endif /* __GSL_LINALG_HOUSEHOLDER_WY_H__ */
@@ -20,6 +20,7 @@
 /* L D L^T decomposition of a symmetric positive semi-definite matrix */
 
 #include <config.h>
+#include <stdlib.h>
 
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
@@ -28,8 +29,20 @@
 #include <gsl/gsl_blas.h>
 #include <gsl/gsl_linalg.h>
 
+#include "recurse.h"
+#include "tile_common.c"
+
 static double ldlt_norm1(const gsl_matrix * A);
 static int ldlt_Ainv(CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params);
+static int ldlt_tile_decomp(gsl_matrix * A);
+static int ldlt_tile_task(void * arg, const size_t id, const size_t thread);
+
+typedef struct
+{
+  gsl_matrix * A;
+  const tile_task * tasks;
+  gsl_matrix * work; /* TILE_NB-by-TILE_NB workspace for each thread */
+} ldlt_tile_params;
 
 /*
 gsl_linalg_ldlt_decomp()
@@ -124,6 +137,104 @@ gsl_linalg_ldlt_decomp (gsl_matrix * A)
     }
 }
 
+/*
+gsl_linalg_ldlt_decomp_par()
+  Perform L D L^T decomposition of a symmetric positive
+semi-definite matrix using lower triangle, with the tasks of a
+tiled algorithm run on a pool of threads
+
+Inputs: A    - (input) symmetric, positive semi-definite matrix
+               (output) lower triangle contains L factor;
+                        diagonal contains D
+        pool - thread pool, or NULL to run in the calling thread
+
+Return: success/error
+
+Notes:
+1) The matrix is divided into tiles of size TILE_NB, and the
+factorization, triangular solves and updates of the tiles are
+scheduled as a task graph (tile_common.c). The result does not
+depend on the number of threads.
+2) The output is that of gsl_linalg_ldlt_decomp(), including the
+1-norm ||A||_1 of the original matrix in the upper right corner and the
+workspace values which it leaves in the first subrow A(1, 2:end-1)
+*/
+
+int
+gsl_linalg_ldlt_decomp_par (gsl_matrix * A, gsl_thread_pool * pool)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+
+  if (M != N)
+    {
+      GSL_ERROR ("LDLT decomposition requires square matrix", GSL_ENOTSQR);
+    }
+  else if (N <= TILE_NB)
+    {
+      return gsl_linalg_ldlt_decomp(A);
+    }
+  else
+    {
+      const size_t nt = (N + TILE_NB - 1) / TILE_NB;
+      const size_t nthreads = thread_dag_nthreads(pool);
+      ldlt_tile_params params;
+      thread_dag * dag;
+      tile_task * tasks;
+      size_t ntasks;
+      double anorm;
+      int status;
+
+      params.work = gsl_matrix_alloc(nthreads * TILE_NB, TILE_NB);
+      if (params.work == NULL)
+        {
+          GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+        }
+
+      tasks = tile_sym_tasks(nt, &dag, &ntasks);
+      if (tasks == NULL)
+        {
+          gsl_matrix_free(params.work);
+          GSL_ERROR ("failed to allocate tasks", GSL_ENOMEM);
+        }
+
+      anorm = ldlt_norm1(A);
+
+      params.A = A;
+      params.tasks = tasks;
+      status = thread_dag_run(pool, dag, ldlt_tile_task, &params);
+
+      thread_dag_free(dag);
+      free(tasks);
+      gsl_matrix_free(params.work);
+
+      if (status == GSL_EDOM)
+        {
+          GSL_ERROR ("matrix is singular", GSL_EDOM);
+        }
+      else if (status)
+        return status;
+
+      /* gsl_linalg_ldlt_decomp() leaves A(j,i) D(i), j = N-1, in its
+         workspace A(1, 2:end) */
+      {
+        size_t i;
+
+        for (i = 0; i < N - 2; ++i)
+          {
+            const double lji = gsl_matrix_get(A, N - 1, i);
+            const double di = gsl_matrix_get(A, i, i);
+            gsl_matrix_set(A, 0, i + 1, lji * di);
+          }
+      }
+
+      /* save ||A||_1 in upper right corner */
+      gsl_matrix_set(A, 0, N - 1, anorm);
+
+      return GSL_SUCCESS;
+    }
+}
+
 int
 gsl_linalg_ldlt_solve (const gsl_matrix * LDLT,
                        const gsl_vector * b,
@@ -280,3 +391,117 @@ ldlt_Ainv(CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params)
 
   return GSL_SUCCESS;
 }
+
+/*
+ldlt_tile_decomp()
+  L D L^T decomposition of a diagonal tile, using the lower triangle
+and Level 2 BLAS. Returns GSL_EDOM for a zero pivot without calling
+the error handler
+*/
+
+static int
+ldlt_tile_decomp(gsl_matrix * A)
+{
+  const size_t N = A->size1;
+  size_t j;
+
+  for (j = 0; j < N; ++j)
+    {
+      const double ajj = gsl_matrix_get(A, j, j);
+
+      if (ajj == 0.0)
+        return GSL_EDOM;
+
+      if (j < N - 1)
+        {
+          gsl_vector_view v = gsl_matrix_subcolumn(A, j, j + 1, N - j - 1);
+          gsl_matrix_view A22 = gsl_matrix_submatrix(A, j + 1, j + 1, N - j - 1, N - j - 1);
+
+          /* A22 -= v v^T / ajj, then L(j+1:N, j) = v / ajj */
+          gsl_blas_dsyr(CblasLower, -1.0 / ajj, &v.vector, &A22.matrix);
+          gsl_vector_scale(&v.vector, 1.0 / ajj);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* execute task id of the tiled L D L^T factorization */
+static int
+ldlt_tile_task(void * arg, const size_t id, const size_t thread)
+{
+  ldlt_tile_params * params = (ldlt_tile_params *) arg;
+  const tile_task * t = &params->tasks[id];
+  gsl_matrix_view Aij = tile_view(params->A, t->i, t->j);
+  gsl_matrix_view Akk = tile_view(params->A, t->k, t->k);
+  gsl_vector_view D = gsl_matrix_diagonal(&Akk.matrix);
+
+  switch (t->op)
+    {
+      case TILE_DIAG:
+        return ldlt_tile_decomp(&Aij.matrix);
+
+      case TILE_TRSM:
+        {
+          /* L_ik = A_ik L_kk^{-T} D_k^{-1} */
+          size_t c;
+
+          gsl_blas_dtrsm(CblasRight, CblasLower, CblasTrans, CblasUnit, 1.0, &Akk.matrix, &Aij.matrix);
+
+          for (c = 0; c < D.vector.size; ++c)
+            {
+              gsl_vector_view col = gsl_matrix_column(&Aij.matrix, c);
+              gsl_vector_scale(&col.vector, 1.0 / gsl_vector_get(&D.vector, c));
+            }
+
+          break;
+        }
+
+      case TILE_SYRK:
+        {
+          gsl_matrix_view Aik = tile_view(params->A, t->i, t->k);
+          gsl_matrix_view W = gsl_matrix_submatrix(params->work, thread * TILE_NB, 0,
+                                                   Aik.matrix.size1, Aik.matrix.size2);
+          size_t c;
+
+          gsl_matrix_memcpy(&W.matrix, &Aik.matrix);
+
+          if (gsl_vector_min(&D.vector) > 0.0)
+            {
+              /* A_ii -= W W^T, W = L_ik D_k^{1/2} */
+              for (c = 0; c < D.vector.size; ++c)
+                {
+                  gsl_vector_view col = gsl_matrix_column(&W.matrix, c);
+                  gsl_vector_scale(&col.vector, sqrt(gsl_vector_get(&D.vector, c)));
+                }
+
+              gsl_blas_dsyrk(CblasLower, CblasNoTrans, -1.0, &W.matrix, 1.0, &Aij.matrix);
+            }
+          else
+            {
+              /* A_ii -= (L_ik W^T + W L_ik^T) / 2, W = L_ik D_k */
+              gsl_matrix_scale_columns(&W.matrix, &D.vector);
+              gsl_blas_dsyr2k(CblasLower, CblasNoTrans, -0.5, &Aik.matrix, &W.matrix, 1.0, &Aij.matrix);
+            }
+
+          break;
+        }
+
+      case TILE_GEMM:
+        {
+          /* A_ij -= L_ik W^T, W = L_jk D_k */
+          gsl_matrix_view Aik = tile_view(params->A, t->i, t->k);
+          gsl_matrix_view Ajk = tile_view(params->A, t->j, t->k);
+          gsl_matrix_view W = gsl_matrix_submatrix(params->work, thread * TILE_NB, 0,
+                                                   Ajk.matrix.size1, Ajk.matrix.size2);
+
+          gsl_matrix_memcpy(&W.matrix, &Ajk.matrix);
+          gsl_matrix_scale_columns(&W.matrix, &D.vector);
+          gsl_blas_dgemm(CblasNoTrans, CblasTrans, -1.0, &Aik.matrix, &W.matrix, 1.0, &Aij.matrix);
+
+          break;
+        }
+    }
+
+  return GSL_SUCCESS;
+}
@@ -29,11 +29,37 @@
 #include <gsl/gsl_linalg.h>
 
 #include "recurse.h"
+#include "../sys/thread_pool.h"
 
 static int LU_decomp_L2 (gsl_matrix * A, gsl_vector_uint * ipiv);
 static int LU_decomp_L3 (gsl_matrix * A, gsl_vector_uint * ipiv);
 static int singular (const gsl_matrix * LU);
 static int apply_pivots(gsl_matrix * A, const gsl_vector_uint * ipiv);
+static int LU_ipiv_permutation (const gsl_vector_uint * ipiv, gsl_permutation * p, int *signum);
+
+/* task graph of gsl_linalg_LU_decomp_par() */
+typedef struct
+{
+  gsl_matrix * A;
+  gsl_vector_uint * ipiv;
+  size_t npanel;          /* column blocks of A(:, 1:min(M,N)) */
+  size_t ncol;            /* column blocks of A */
+  size_t * panel;         /* panel[k] is the task id of panel k */
+} LU_par_params;
+
+static void LU_par_block (const LU_par_params * params, const size_t j, size_t * c0, size_t * nc);
+static int LU_par_task (void * arg, const size_t id, const size_t thread);
+static void LU_par_swap_left (void * arg, const size_t j);
+
+/* factorization passed to the inverse norm estimators */
+typedef struct
+{
+  const gsl_matrix * LU;
+  const gsl_permutation * p;
+} LU_condest_params;
+
+static int LU_Ainvx (CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params);
+static int LU_AinvX (CBLAS_TRANSPOSE_t TransA, gsl_matrix * X, void * params);
 
 /* Factorise a general N x N matrix A into,
  *
@@ -74,7 +100,6 @@ gsl_linalg_LU_decomp (gsl_matrix * A, gsl_permutation * p, int *signum)
       const size_t minMN = GSL_MIN(M, N);
       gsl_vector_uint * ipiv = gsl_vector_uint_alloc(minMN);
       gsl_matrix_view AL = gsl_matrix_submatrix(A, 0, 0, M, minMN);
-      size_t i;
 
       status = LU_decomp_L3 (&AL.matrix, ipiv);
 
@@ -91,24 +116,135 @@ gsl_linalg_LU_decomp (gsl_matrix * A, gsl_permutation * p, int *signum)
         }
 
       /* convert ipiv array to permutation */
+      LU_ipiv_permutation(ipiv, p, signum);
+
+      gsl_vector_uint_free(ipiv);
+
+      return status;
+    }
+}
+
+/*
+gsl_linalg_LU_decomp_par()
+  LU decomposition with partial pivoting, with the tasks of a
+blocked algorithm run on a pool of threads
+
+Inputs: A      - on input, M-by-N matrix to be factored; on output,
+                 L and U factors as in gsl_linalg_LU_decomp()
+        p      - (output) permutation, length M
+        signum - (output) sign of permutation
+        pool   - thread pool, or NULL to run in the calling thread
+
+Return: success/error
 
-      gsl_permutation_init(p);
-      *signum = 1;
+Notes:
+1) The columns of A are divided into blocks of TILE_NB columns. Each
+block of the first min(M,N) columns is a panel, factored with the
+recursive algorithm LU_decomp_L3 below the diagonal. The update of
+block j by panel k (row interchanges, triangular solve and matrix
+product) is a separate task, which depends on the panel and on the
+update of block j by panel k-1; panel k depends on the update of its
+block by panel k-1. Since the successors of a panel are scheduled
+with the next panel first, the factorization of panel k+1 overlaps
+with the remaining updates of panel k.
+
+2) The row interchanges of the later panels are applied to the L
+factor of each panel once all tasks are complete, since that part of
+L is read by the updates of the panel.
+
+3) The result does not depend on the number of threads.
+*/
+
+int
+gsl_linalg_LU_decomp_par (gsl_matrix * A, gsl_permutation * p, int *signum,
+                          gsl_thread_pool * pool)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  const size_t minMN = GSL_MIN(M, N);
 
-      for (i = 0; i < minMN; ++i)
+  if (p->size != M)
+    {
+      GSL_ERROR ("permutation length must match matrix size1", GSL_EBADLEN);
+    }
+  else if (minMN <= TILE_NB)
+    {
+      return gsl_linalg_LU_decomp(A, p, signum);
+    }
+  else
+    {
+      LU_par_params params;
+      thread_dag * dag;
+      size_t ntasks = 0, id = 0;
+      size_t j, k;
+      int status;
+
+      params.A = A;
+      params.npanel = (minMN + TILE_NB - 1) / TILE_NB;
+      params.ncol = params.npanel + (N - minMN + TILE_NB - 1) / TILE_NB;
+
+      for (k = 0; k < params.npanel; ++k)
+        ntasks += params.ncol - k; /* panel and updates of blocks k+1:ncol */
+
+      params.ipiv = gsl_vector_uint_alloc(minMN);
+      params.panel = malloc(params.npanel * sizeof(size_t));
+      dag = thread_dag_alloc(ntasks, 2 * ntasks);
+
+      if (params.ipiv == NULL || params.panel == NULL || dag == NULL)
         {
-          unsigned int pivi = gsl_vector_uint_get(ipiv, i);
+          if (params.ipiv)
+            gsl_vector_uint_free(params.ipiv);
+          free(params.panel);
+          thread_dag_free(dag);
+          GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+        }
 
-          if (p->data[pivi] != p->data[i])
+      /*
+       * task ids: panel k is followed by the updates of blocks
+       * k+1, ..., ncol-1 by panel k
+       */
+      for (k = 0; k < params.npanel; ++k)
+        {
+          params.panel[k] = id;
+
+          if (k > 0)
+            thread_dag_edge(dag, params.panel[k - 1] + 1, id);  /* update of block k by panel k-1 */
+
+          ++id;
+
+          for (j = k + 1; j < params.ncol; ++j)
             {
-              size_t tmp = p->data[pivi];
-              p->data[pivi] = p->data[i];
-              p->data[i] = tmp;
-              *signum = -(*signum);
+              thread_dag_edge(dag, params.panel[k], id);
+
+              if (k > 0)
+                thread_dag_edge(dag, params.panel[k - 1] + (j - k + 1), id);
+
+              ++id;
             }
         }
 
-      gsl_vector_uint_free(ipiv);
+      status = thread_dag_run(pool, dag, LU_par_task, &params);
+
+      if (status == GSL_SUCCESS)
+        {
+          thread_pool_run(pool, params.npanel - 1, LU_par_swap_left, &params);
+
+          /* shift pivots of the panels to rows of A */
+          for (k = 1; k < params.npanel; ++k)
+            {
+              for (j = k * TILE_NB; j < GSL_MIN((k + 1) * TILE_NB, minMN); ++j)
+                {
+                  unsigned int * ptr = gsl_vector_uint_ptr(params.ipiv, j);
+                  *ptr += k * TILE_NB;
+                }
+            }
+
+          LU_ipiv_permutation(params.ipiv, p, signum);
+        }
+
+      thread_dag_free(dag);
+      gsl_vector_uint_free(params.ipiv);
+      free(params.panel);
 
       return status;
     }
@@ -536,6 +672,250 @@ gsl_linalg_LU_sgndet (gsl_matrix * LU, int signum)
   return s;
 }
 
+/*
+gsl_linalg_LU_rcond()
+  Estimate the reciprocal condition number in the 1-norm,
+1 / (||A||_1 ||A^{-1}||_1), of a matrix A from its LU decomposition
+
+Inputs: LU    - LU decomposition of A from gsl_linalg_LU_decomp
+        p     - permutation from gsl_linalg_LU_decomp
+        Anorm - ||A||_1 of the original matrix, for example from
+                gsl_linalg_norm1 called before the decomposition
+        rcond - (output) reciprocal condition estimate
+        work  - workspace, length 3*N
+
+Notes:
+1) As in LAPACK (dgecon), ||A||_1 cannot be recovered cheaply from the
+factors and must be supplied by the caller
+
+2) rcond = 0 if U has a zero diagonal element
+*/
+
+int
+gsl_linalg_LU_rcond (const gsl_matrix * LU, const gsl_permutation * p, const double Anorm,
+                     double * rcond, gsl_vector * work)
+{
+  const size_t N = LU->size1;
+
+  if (N != LU->size2)
+    {
+      GSL_ERROR ("LU matrix must be square", GSL_ENOTSQR);
+    }
+  else if (N != p->size)
+    {
+      GSL_ERROR ("permutation length must match matrix size", GSL_EBADLEN);
+    }
+  else if (work->size != 3 * N)
+    {
+      GSL_ERROR ("work vector length must be 3*N", GSL_EBADLEN);
+    }
+  else
+    {
+      int status;
+      double Ainvnorm;
+      LU_condest_params params;
+
+      *rcond = 0.0;
+
+      /* don't continue if matrix is singular */
+      if (Anorm == 0.0 || singular (LU))
+        return GSL_SUCCESS;
+
+      params.LU = LU;
+      params.p = p;
+
+      status = gsl_linalg_invnorm1 (N, LU_Ainvx, &params, &Ainvnorm, work);
+      if (status)
+        return status;
+
+      if (Ainvnorm != 0.0)
+        *rcond = (1.0 / Anorm) / Ainvnorm;
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_linalg_LU_rcond_block()
+  As gsl_linalg_LU_rcond, using the block estimator
+gsl_linalg_invnorm1_block, which solves with several right hand
+sides at a time with Level 3 BLAS
+*/
+
+int
+gsl_linalg_LU_rcond_block (const gsl_matrix * LU, const gsl_permutation * p, const double Anorm,
+                           double * rcond, gsl_linalg_condest_workspace * w)
+{
+  const size_t N = LU->size1;
+
+  if (N != LU->size2)
+    {
+      GSL_ERROR ("LU matrix must be square", GSL_ENOTSQR);
+    }
+  else if (N != p->size)
+    {
+      GSL_ERROR ("permutation length must match matrix size", GSL_EBADLEN);
+    }
+  else if (N != w->N)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      int status;
+      double Ainvnorm;
+      LU_condest_params params;
+
+      *rcond = 0.0;
+
+      /* don't continue if matrix is singular */
+      if (Anorm == 0.0 || singular (LU))
+        return GSL_SUCCESS;
+
+      params.LU = LU;
+      params.p = p;
+
+      status = gsl_linalg_invnorm1_block (LU_AinvX, &params, &Ainvnorm, w);
+      if (status)
+        return status;
+
+      if (Ainvnorm != 0.0)
+        *rcond = (1.0 / Anorm) / Ainvnorm;
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_linalg_LU_ferr()
+  Estimate a bound on the relative forward error
+||x - x_true||_inf / ||x||_inf of a solution x of A x = b computed
+from the LU decomposition of A, see gsl_linalg_ferr
+
+Inputs: A    - original matrix
+        LU   - LU decomposition of A from gsl_linalg_LU_decomp
+        p    - permutation from gsl_linalg_LU_decomp
+        b    - right hand side
+        x    - computed solution, for example from gsl_linalg_LU_solve
+               or gsl_linalg_LU_refine
+        ferr - (output) forward error bound
+        work - workspace, length 5*N
+*/
+
+int
+gsl_linalg_LU_ferr (const gsl_matrix * A, const gsl_matrix * LU, const gsl_permutation * p,
+                    const gsl_vector * b, const gsl_vector * x, double * ferr,
+                    gsl_vector * work)
+{
+  const size_t N = LU->size1;
+
+  if (N != LU->size2)
+    {
+      GSL_ERROR ("LU matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != N || A->size2 != N)
+    {
+      GSL_ERROR ("matrix size must match LU size", GSL_EBADLEN);
+    }
+  else if (N != p->size)
+    {
+      GSL_ERROR ("permutation length must match matrix size", GSL_EBADLEN);
+    }
+  else if (singular (LU))
+    {
+      GSL_ERROR ("matrix is singular", GSL_EDOM);
+    }
+  else
+    {
+      LU_condest_params params;
+
+      params.LU = LU;
+      params.p = p;
+
+      return gsl_linalg_ferr (A, b, x, LU_Ainvx, &params, ferr, work);
+    }
+}
+
+/* x := A^{-1} x or x := A^{-t} x, with A = P^T L U */
+static int
+LU_Ainvx (CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params)
+{
+  LU_condest_params * par = (LU_condest_params *) params;
+  int status;
+
+  if (TransA == CblasNoTrans)
+    {
+      gsl_permute_vector (par->p, x);
+
+      status = gsl_blas_dtrsv (CblasLower, CblasNoTrans, CblasUnit, par->LU, x);
+      if (status)
+        return status;
+
+      status = gsl_blas_dtrsv (CblasUpper, CblasNoTrans, CblasNonUnit, par->LU, x);
+      if (status)
+        return status;
+    }
+  else
+    {
+      status = gsl_blas_dtrsv (CblasUpper, CblasTrans, CblasNonUnit, par->LU, x);
+      if (status)
+        return status;
+
+      status = gsl_blas_dtrsv (CblasLower, CblasTrans, CblasUnit, par->LU, x);
+      if (status)
+        return status;
+
+      gsl_permute_vector_inverse (par->p, x);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* X := A^{-1} X or X := A^{-t} X, with A = P^T L U */
+static int
+LU_AinvX (CBLAS_TRANSPOSE_t TransA, gsl_matrix * X, void * params)
+{
+  LU_condest_params * par = (LU_condest_params *) params;
+  const size_t ncol = X->size2;
+  size_t j;
+  int status;
+
+  if (TransA == CblasNoTrans)
+    {
+      for (j = 0; j < ncol; ++j)
+        {
+          gsl_vector_view xj = gsl_matrix_column (X, j);
+          gsl_permute_vector (par->p, &xj.vector);
+        }
+
+      status = gsl_blas_dtrsm (CblasLeft, CblasLower, CblasNoTrans, CblasUnit, 1.0, par->LU, X);
+      if (status)
+        return status;
+
+      status = gsl_blas_dtrsm (CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0, par->LU, X);
+      if (status)
+        return status;
+    }
+  else
+    {
+      status = gsl_blas_dtrsm (CblasLeft, CblasUpper, CblasTrans, CblasNonUnit, 1.0, par->LU, X);
+      if (status)
+        return status;
+
+      status = gsl_blas_dtrsm (CblasLeft, CblasLower, CblasTrans, CblasUnit, 1.0, par->LU, X);
+      if (status)
+        return status;
+
+      for (j = 0; j < ncol; ++j)
+        {
+          gsl_vector_view xj = gsl_matrix_column (X, j);
+          gsl_permute_vector_inverse (par->p, &xj.vector);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
 static int
 singular (const gsl_matrix * LU)
 {
@@ -576,3 +956,113 @@ apply_pivots(gsl_matrix * A, const gsl_vector_uint * ipiv)
       return GSL_SUCCESS;
     }
 }
+
+/* convert row interchanges to a permutation */
+static int
+LU_ipiv_permutation (const gsl_vector_uint * ipiv, gsl_permutation * p, int *signum)
+{
+  size_t i;
+
+  gsl_permutation_init(p);
+  *signum = 1;
+
+  for (i = 0; i < ipiv->size; ++i)
+    {
+      unsigned int pivi = gsl_vector_uint_get(ipiv, i);
+
+      if (p->data[pivi] != p->data[i])
+        {
+          size_t tmp = p->data[pivi];
+          p->data[pivi] = p->data[i];
+          p->data[i] = tmp;
+          *signum = -(*signum);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* first column and number of columns of block j */
+static void
+LU_par_block (const LU_par_params * params, const size_t j, size_t * c0, size_t * nc)
+{
+  const size_t minMN = GSL_MIN(params->A->size1, params->A->size2);
+  const size_t end = (j < params->npanel) ? minMN : params->A->size2;
+
+  *c0 = (j < params->npanel) ? j * TILE_NB : minMN + (j - params->npanel) * TILE_NB;
+  *nc = GSL_MIN(TILE_NB, end - *c0);
+}
+
+/* execute task id of gsl_linalg_LU_decomp_par() */
+static int
+LU_par_task (void * arg, const size_t id, const size_t thread)
+{
+  LU_par_params * params = (LU_par_params *) arg;
+  gsl_matrix * A = params->A;
+  const size_t M = A->size1;
+  size_t k = 0, k0, kb, c0, nc;
+  gsl_matrix_view P;
+  gsl_vector_uint_view ipiv;
+
+  (void) thread;
+
+  /* find panel k of the task */
+  while (k + 1 < params->npanel && params->panel[k + 1] <= id)
+    ++k;
+
+  LU_par_block(params, k, &k0, &kb);
+  P = gsl_matrix_submatrix(A, k0, k0, M - k0, kb);
+  ipiv = gsl_vector_uint_subvector(params->ipiv, k0, kb);
+
+  if (id == params->panel[k])
+    {
+      /* factor panel k */
+      return LU_decomp_L3(&P.matrix, &ipiv.vector);
+    }
+  else
+    {
+      /* update block j by panel k */
+      const size_t j = k + (id - params->panel[k]);
+      gsl_matrix_view Aj, A1, A2, L11, L21;
+
+      LU_par_block(params, j, &c0, &nc);
+      Aj = gsl_matrix_submatrix(A, k0, c0, M - k0, nc);
+      A1 = gsl_matrix_submatrix(A, k0, c0, kb, nc);
+      L11 = gsl_matrix_submatrix(A, k0, k0, kb, kb);
+
+      apply_pivots(&Aj.matrix, &ipiv.vector);
+      gsl_blas_dtrsm(CblasLeft, CblasLower, CblasNoTrans, CblasUnit, 1.0, &L11.matrix, &A1.matrix);
+
+      if (M > k0 + kb)
+        {
+          A2 = gsl_matrix_submatrix(A, k0 + kb, c0, M - k0 - kb, nc);
+          L21 = gsl_matrix_submatrix(A, k0 + kb, k0, M - k0 - kb, kb);
+          gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, -1.0, &L21.matrix, &A1.matrix, 1.0, &A2.matrix);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* apply the row interchanges of panels j+1, ... to the L factor of panel j */
+static void
+LU_par_swap_left (void * arg, const size_t j)
+{
+  LU_par_params * params = (LU_par_params *) arg;
+  const size_t M = params->A->size1;
+  size_t c0, nc, k;
+
+  LU_par_block(params, j, &c0, &nc);
+
+  for (k = j + 1; k < params->npanel; ++k)
+    {
+      size_t k0, kb;
+      gsl_matrix_view Ak;
+      gsl_vector_uint_view ipiv;
+
+      LU_par_block(params, k, &k0, &kb);
+      Ak = gsl_matrix_submatrix(params->A, k0, c0, M - k0, nc);
+      ipiv = gsl_vector_uint_subvector(params->ipiv, k0, kb);
+      apply_pivots(&Ak.matrix, &ipiv.vector);
+    }
+}
@@ -0,0 +1,306 @@
+/* linalg/lu_band.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_cblas.h>
+
+/*
+gsl_linalg_LU_band_decomp()
+  LU decomposition with partial pivoting of an M-by-N banded matrix
+with lower bandwidth lb and upper bandwidth ub
+
+Inputs: M  - number of rows of A
+        lb - lower bandwidth
+        ub - upper bandwidth
+        AB - on input, matrix A in banded format, N-by-(2*lb+ub+1);
+             on output, the LU factors
+        piv - (output) pivot indices, length min(M,N)
+
+Notes:
+1) Row j of AB holds column j of A, with A(i,j) stored in
+AB(j, lb + ub + i - j), so that the main diagonal is in column lb+ub of
+AB, the superdiagonals to its left and the subdiagonals to its right.
+The first lb columns of AB are workspace for the fill-in of U due to
+the row interchanges, and need not be set on input. This is the
+transpose of the LAPACK DGBTRF storage, so that a column of A is
+contiguous in memory.
+
+2) On output U, with upper bandwidth lb+ub, is stored in columns
+0..lb+ub of AB and the multipliers of L in columns lb+ub+1..2*lb+ub.
+Row j was interchanged with row piv[j] at step j.
+
+3) This is the unblocked algorithm DGBTF2: at step j the pivot is the
+largest of the at most lb+1 elements of column j on or below the
+diagonal, and the rank-1 update is restricted to the columns j+1..ju
+which the pivot rows reach.
+
+Return: success, or GSL_EDOM if U has a zero diagonal element; the
+factorization is completed in that case
+*/
+
+int
+gsl_linalg_LU_band_decomp (const size_t M, const size_t lb, const size_t ub,
+                           gsl_matrix * AB, gsl_vector_uint * piv)
+{
+  const size_t N = AB->size1;
+  const size_t minMN = GSL_MIN (M, N);
+
+  if (lb >= M)
+    {
+      GSL_ERROR ("lower bandwidth must be less than M", GSL_EDOM);
+    }
+  else if (ub >= N)
+    {
+      GSL_ERROR ("upper bandwidth must be less than N", GSL_EDOM);
+    }
+  else if (AB->size2 != 2 * lb + ub + 1)
+    {
+      GSL_ERROR ("matrix size inconsistent with bandwidths", GSL_EBADLEN);
+    }
+  else if (piv->size != minMN)
+    {
+      GSL_ERROR ("pivot vector must have length MIN(M,N)", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t kv = lb + ub;       /* column of the diagonal in AB */
+      const size_t ldm = AB->tda - 1;  /* stride along a row of A */
+      int status = GSL_SUCCESS;
+      size_t ju = 0;                   /* last column reached by the pivot rows */
+      size_t j;
+
+      /* clear the fill-in workspace */
+      if (lb > 0)
+        {
+          gsl_matrix_view W = gsl_matrix_submatrix (AB, 0, 0, N, lb);
+          gsl_matrix_set_zero (&W.matrix);
+        }
+
+      for (j = 0; j < minMN; ++j)
+        {
+          const size_t km = GSL_MIN (lb, M - j - 1); /* subdiagonal elements in column j */
+          gsl_vector_view c = gsl_matrix_subrow (AB, j, kv, km + 1);
+          const size_t jp = gsl_blas_idamax (&c.vector);
+          const double pivot = gsl_vector_get (&c.vector, jp);
+
+          gsl_vector_uint_set (piv, j, (unsigned int) (j + jp));
+
+          if (pivot == 0.0)
+            {
+              /* column j is already zero below the diagonal */
+              status = GSL_EDOM;
+              continue;
+            }
+
+          ju = GSL_MAX (ju, GSL_MIN (j + ub + jp, N - 1));
+
+          if (jp != 0)
+            {
+              /* interchange rows j and j+jp in columns j..ju */
+              gsl_vector_view r1 = gsl_vector_view_array_with_stride (gsl_matrix_ptr (AB, j, kv), ldm, ju - j + 1);
+              gsl_vector_view r2 = gsl_vector_view_array_with_stride (gsl_matrix_ptr (AB, j, kv + jp), ldm, ju - j + 1);
+
+              gsl_blas_dswap (&r1.vector, &r2.vector);
+            }
+
+          if (km > 0)
+            {
+              gsl_vector_view l = gsl_matrix_subrow (AB, j, kv + 1, km);
+
+              gsl_blas_dscal (1.0 / pivot, &l.vector);
+
+              if (ju > j)
+                {
+                  /* A(j+1:j+km, j+1:ju) -= l * A(j, j+1:ju), with the
+                     columns of A as the rows of the view */
+                  gsl_matrix_view A22 = gsl_matrix_view_array_with_tda (gsl_matrix_ptr (AB, j + 1, kv),
+                                                                        ju - j, km, ldm);
+                  gsl_vector_view u = gsl_vector_view_array_with_stride (gsl_matrix_ptr (AB, j + 1, kv - 1),
+                                                                         ldm, ju - j);
+
+                  gsl_blas_dger (-1.0, &u.vector, &l.vector, &A22.matrix);
+                }
+            }
+        }
+
+      return status;
+    }
+}
+
+int
+gsl_linalg_LU_band_solve (const size_t lb, const size_t ub, const gsl_matrix * LUB,
+                          const gsl_vector_uint * piv, const gsl_vector * b, gsl_vector * x)
+{
+  if (LUB->size1 != b->size)
+    {
+      GSL_ERROR ("matrix size must match b size", GSL_EBADLEN);
+    }
+  else if (LUB->size1 != x->size)
+    {
+      GSL_ERROR ("matrix size must match solution size", GSL_EBADLEN);
+    }
+  else
+    {
+      /* copy x <- b */
+      gsl_vector_memcpy (x, b);
+
+      return gsl_linalg_LU_band_svx (lb, ub, LUB, piv, x);
+    }
+}
+
+int
+gsl_linalg_LU_band_svx (const size_t lb, const size_t ub, const gsl_matrix * LUB,
+                        const gsl_vector_uint * piv, gsl_vector * x)
+{
+  const size_t N = LUB->size1;
+
+  if (LUB->size2 != 2 * lb + ub + 1)
+    {
+      GSL_ERROR ("matrix size inconsistent with bandwidths", GSL_EBADLEN);
+    }
+  else if (piv->size != N)
+    {
+      GSL_ERROR ("pivot vector must have length N", GSL_EBADLEN);
+    }
+  else if (N != x->size)
+    {
+      GSL_ERROR ("matrix size must match solution size", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t kv = lb + ub;
+      size_t j;
+
+      /* solve L c = P b, applying the interchanges as L was computed */
+      if (lb > 0)
+        {
+          for (j = 0; j + 1 < N; ++j)
+            {
+              const size_t lm = GSL_MIN (lb, N - j - 1);
+              const size_t pj = gsl_vector_uint_get (piv, j);
+              gsl_vector_const_view l = gsl_matrix_const_subrow (LUB, j, kv + 1, lm);
+              gsl_vector_view xj = gsl_vector_subvector (x, j + 1, lm);
+              double xp;
+
+              if (pj != j)
+                gsl_vector_swap_elements (x, j, pj);
+
+              xp = gsl_vector_get (x, j);
+              gsl_blas_daxpy (-xp, &l.vector, &xj.vector);
+            }
+        }
+
+      /* solve U x = c; the rows of LUB are the columns of U */
+      cblas_dtbsv (CblasColMajor, CblasUpper, CblasNoTrans, CblasNonUnit,
+                   (int) N, (int) kv, LUB->data, (int) LUB->tda,
+                   x->data, (int) x->stride);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_linalg_LU_band_unpack()
+  Unpack the band LU factors into dense matrices
+
+Inputs: M   - number of rows of A
+        lb  - lower bandwidth
+        ub  - upper bandwidth
+        LUB - LU factors from gsl_linalg_LU_band_decomp(), N-by-(2*lb+ub+1)
+        piv - pivot indices from gsl_linalg_LU_band_decomp()
+        L   - (output) M-by-MIN(M,N) unit lower triangular matrix
+        U   - (output) MIN(M,N)-by-N upper triangular matrix
+
+Notes:
+1) On output P A = L U, where P is the permutation of the interchanges
+recorded in piv; the multipliers are in the order of the final rows,
+as for gsl_linalg_LU_decomp
+*/
+
+int
+gsl_linalg_LU_band_unpack (const size_t M, const size_t lb, const size_t ub, const gsl_matrix * LUB,
+                           const gsl_vector_uint * piv, gsl_matrix * L, gsl_matrix * U)
+{
+  const size_t N = LUB->size1;
+  const size_t minMN = GSL_MIN (M, N);
+
+  if (LUB->size2 != 2 * lb + ub + 1)
+    {
+      GSL_ERROR ("matrix size inconsistent with bandwidths", GSL_EBADLEN);
+    }
+  else if (piv->size != minMN)
+    {
+      GSL_ERROR ("pivot vector must have length MIN(M,N)", GSL_EBADLEN);
+    }
+  else if (L->size1 != M || L->size2 != minMN)
+    {
+      GSL_ERROR ("L matrix has wrong dimensions", GSL_EBADLEN);
+    }
+  else if (U->size1 != minMN || U->size2 != N)
+    {
+      GSL_ERROR ("U matrix has wrong dimensions", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t kv = lb + ub;
+      size_t i, j;
+
+      gsl_matrix_set_identity (L);
+      gsl_matrix_set_zero (U);
+
+      for (j = 0; j < N; ++j)
+        {
+          const size_t i0 = (j > kv) ? j - kv : 0;
+          const size_t i1 = GSL_MIN (j, minMN - 1);
+
+          for (i = i0; i <= i1; ++i)
+            gsl_matrix_set (U, i, j, gsl_matrix_get (LUB, j, kv + i - j));
+        }
+
+      /* column j of L holds the multipliers of step j, with the
+         interchanges of the later steps applied to its rows */
+      for (j = 0; j < minMN; ++j)
+        {
+          const size_t lm = GSL_MIN (lb, M - j - 1);
+          const size_t pj = gsl_vector_uint_get (piv, j);
+
+          if (pj != j)
+            {
+              for (i = 0; i < j; ++i)
+                {
+                  double tmp = gsl_matrix_get (L, j, i);
+                  gsl_matrix_set (L, j, i, gsl_matrix_get (L, pj, i));
+                  gsl_matrix_set (L, pj, i, tmp);
+                }
+            }
+
+          for (i = 0; i < lm; ++i)
+            gsl_matrix_set (L, j + 1 + i, j, gsl_matrix_get (LUB, j, kv + 1 + i));
+        }
+
+      return GSL_SUCCESS;
+    }
+}
@@ -0,0 +1,1595 @@
+/* linalg/matfunc.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Functions of a general real square matrix:
+ *
+ * expm  - scaling and squaring with a Pade approximant of degree
+ *         3, 5, 7, 9 or 13 chosen from ||A||_1 (Higham, SIAM J. Matrix
+ *         Anal. Appl. 26 (2005), algorithm 2.3)
+ * sqrtm - real Schur method (Higham, Linear Algebra Appl. 88/89 (1987))
+ * logm  - inverse scaling and squaring on the real Schur form, with the
+ *         [8/8] Pade approximant of log(1+x) evaluated as an 8 point
+ *         Gauss-Legendre rule (Higham, SIAM J. Matrix Anal. Appl. 22 (2001))
+ * expmv - exp(tA) v by Krylov projection with time stepping and the
+ *         local error estimate of Sidje, ACM Trans. Math. Softw. 24 (1998)
+ *
+ * Apart from the Schur decomposition and the quasi-triangular
+ * recurrences of sqrtm, the work is in matrix products and in LU
+ * solves with many right hand sides, all done with Level 3 BLAS.
+ *
+ * The real Schur form is computed here, by Hessenberg reduction and
+ * the Francis double shift QR iteration, rather than with
+ * gsl_eigen_nonsymm, since the eigen library depends on linalg.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_permutation.h>
+#include <gsl/gsl_permute_vector.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+
+/* number of scratch matrices in the workspace */
+#define MATFUNC_NWORK 6
+
+/* largest number of square roots taken by logm */
+#define MATFUNC_MAX_SQRT 64
+
+/* ||T - I||_1 below which the Pade approximant of logm is used */
+#define MATFUNC_LOG_THETA 0.25
+
+struct gsl_linalg_matfunc_struct
+{
+  size_t n;
+  gsl_matrix * W[MATFUNC_NWORK];      /* scratch matrices, n-by-n */
+  gsl_matrix * Z;                     /* Schur vectors, n-by-n */
+  gsl_permutation * p;                /* LU permutation */
+  gsl_vector * tau;                   /* Householder coefficients */
+};
+
+/* the operator A, either a matrix or a matrix-vector product */
+typedef struct
+{
+  const gsl_matrix * A;
+  int (* matvec)(CBLAS_TRANSPOSE_t TransA, const gsl_vector * x, gsl_vector * y, void * params);
+  void * params;
+} expmv_op;
+
+static int matfunc_expm (const gsl_matrix * A, gsl_matrix * eA, gsl_matrix * W[],
+                         gsl_permutation * p);
+static int matfunc_schur (const gsl_matrix * A, gsl_linalg_matfunc_workspace * w);
+static int matfunc_francis (gsl_matrix * H, gsl_matrix * Z);
+static int matfunc_sqrt_quasi (const gsl_matrix * T, gsl_matrix * R);
+static void matfunc_unschur (const gsl_matrix * Z, const gsl_matrix * F, gsl_matrix * work,
+                             gsl_matrix * B);
+static int matfunc_solve (gsl_matrix * M, gsl_permutation * p, gsl_matrix * X);
+static void matfunc_axpy (const double alpha, const gsl_matrix * X, gsl_matrix * Y);
+static double matfunc_norm1 (const gsl_matrix * A);
+static int expmv (const expmv_op * op, const double t, const gsl_vector * v,
+                  const double tol, gsl_vector * y, gsl_linalg_expmv_workspace * w);
+
+/*
+gsl_linalg_matfunc_alloc()
+  Allocate a workspace for the functions of an n-by-n matrix
+*/
+
+gsl_linalg_matfunc_workspace *
+gsl_linalg_matfunc_alloc (const size_t n)
+{
+  gsl_linalg_matfunc_workspace *w;
+  size_t i;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("matrix dimension must be positive", GSL_EINVAL);
+    }
+
+  w = calloc (1, sizeof (gsl_linalg_matfunc_workspace));
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  for (i = 0; i < MATFUNC_NWORK; ++i)
+    {
+      w->W[i] = gsl_matrix_alloc (n, n);
+      if (w->W[i] == NULL)
+        {
+          gsl_linalg_matfunc_free (w);
+          GSL_ERROR_NULL ("failed to allocate workspace", GSL_ENOMEM);
+        }
+    }
+
+  w->Z = gsl_matrix_alloc (n, n);
+  w->p = gsl_permutation_alloc (n);
+  w->tau = gsl_vector_alloc (n);
+
+  if (w->Z == NULL || w->p == NULL || w->tau == NULL)
+    {
+      gsl_linalg_matfunc_free (w);
+      GSL_ERROR_NULL ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  w->n = n;
+
+  return w;
+}
+
+void
+gsl_linalg_matfunc_free (gsl_linalg_matfunc_workspace * w)
+{
+  size_t i;
+
+  RETURN_IF_NULL (w);
+
+  for (i = 0; i < MATFUNC_NWORK; ++i)
+    {
+      if (w->W[i])
+        gsl_matrix_free (w->W[i]);
+    }
+
+  if (w->Z)
+    gsl_matrix_free (w->Z);
+
+  if (w->p)
+    gsl_permutation_free (w->p);
+
+  if (w->tau)
+    gsl_vector_free (w->tau);
+
+  free (w);
+}
+
+/*
+gsl_linalg_expm()
+  Compute the exponential of a square matrix by scaling and squaring
+
+Inputs: A  - n-by-n matrix
+        eA - (output) exp(A); may be the same matrix as A
+        w  - workspace, size n
+*/
+
+int
+gsl_linalg_expm (const gsl_matrix * A, gsl_matrix * eA, gsl_linalg_matfunc_workspace * w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (eA->size1 != A->size1 || eA->size2 != A->size2)
+    {
+      GSL_ERROR ("exponential of matrix must have same dimension as matrix", GSL_EBADLEN);
+    }
+  else if (A->size1 != w->n)
+    {
+      GSL_ERROR ("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      /* matfunc_expm overwrites eA before the last use of A */
+      gsl_matrix_memcpy (w->W[0], A);
+      return matfunc_expm (w->W[0], eA, w->W + 1, w->p);
+    }
+}
+
+/*
+gsl_linalg_sqrtm()
+  Compute the principal square root of a square matrix
+
+Inputs: A     - n-by-n matrix
+        sqrtA - (output) X with X^2 = A; may be the same matrix as A
+        w     - workspace, size n
+
+Return: GSL_EDOM if A has a negative real eigenvalue, so that there
+is no real principal square root; GSL_ESING if the square root of a
+singular A could not be computed
+*/
+
+int
+gsl_linalg_sqrtm (const gsl_matrix * A, gsl_matrix * sqrtA, gsl_linalg_matfunc_workspace * w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (sqrtA->size1 != A->size1 || sqrtA->size2 != A->size2)
+    {
+      GSL_ERROR ("square root of matrix must have same dimension as matrix", GSL_EBADLEN);
+    }
+  else if (A->size1 != w->n)
+    {
+      GSL_ERROR ("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_matrix * T = w->W[0];
+      gsl_matrix * R = w->W[1];
+      int status;
+
+      status = matfunc_schur (A, w);
+      if (status)
+        return status;
+
+      status = matfunc_sqrt_quasi (T, R);
+      if (status)
+        return status;
+
+      /* sqrt(A) = Z R Z^T */
+      matfunc_unschur (w->Z, R, w->W[2], sqrtA);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_linalg_logm()
+  Compute the principal logarithm of a square matrix by inverse
+scaling and squaring
+
+Inputs: A    - n-by-n matrix
+        logA - (output) X with exp(X) = A; may be the same matrix as A
+        w    - workspace, size n
+
+Return: GSL_EDOM if A has an eigenvalue on the closed negative real
+axis, so that there is no real principal logarithm
+
+Notes:
+1) With the real Schur form A = Z T Z^T, square roots of T are taken
+until ||T^{1/2^k} - I||_1 <= MATFUNC_LOG_THETA, and
+
+log(A) = 2^k Z log(I + X) Z^T,  X = T^{1/2^k} - I
+
+with log(I + X) = \int_0^1 X (I + s X)^{-1} ds approximated by the
+8 point Gauss-Legendre rule, which is the [8/8] Pade approximant.
+*/
+
+int
+gsl_linalg_logm (const gsl_matrix * A, gsl_matrix * logA, gsl_linalg_matfunc_workspace * w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (logA->size1 != A->size1 || logA->size2 != A->size2)
+    {
+      GSL_ERROR ("logarithm of matrix must have same dimension as matrix", GSL_EBADLEN);
+    }
+  else if (A->size1 != w->n)
+    {
+      GSL_ERROR ("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      /* nodes and weights of the Gauss-Legendre rule on [-1,1] */
+      static const double xgl[4] = { 0.1834346424956498049394761, 0.5255324099163289858177390,
+                                     0.7966664774136267395915539, 0.9602898564975362316835609 };
+      static const double wgl[4] = { 0.3626837833783619829651504, 0.3137066458778872873379622,
+                                     0.2223810344533744705443560, 0.1012285362903762591525314 };
+      const size_t n = A->size1;
+      gsl_matrix * T = w->W[0];
+      gsl_matrix * R = w->W[1];
+      gsl_matrix * X = w->W[2];
+      gsl_matrix * M = w->W[3];
+      gsl_matrix * Y = w->W[4];
+      gsl_matrix * L = w->W[5];
+      size_t i, k = 0;
+      int status;
+
+      status = matfunc_schur (A, w);
+      if (status)
+        return status;
+
+      /* real eigenvalues must be positive */
+      for (i = 0; i < n; ++i)
+        {
+          const double a = gsl_matrix_get (T, i, i);
+          int nonpos;
+
+          if (i + 1 < n && gsl_matrix_get (T, i + 1, i) != 0.0)
+            {
+              const double b = gsl_matrix_get (T, i, i + 1);
+              const double c = gsl_matrix_get (T, i + 1, i);
+              const double d = gsl_matrix_get (T, i + 1, i + 1);
+              const double disc = 0.25 * (a - d) * (a - d) + b * c;
+
+              nonpos = (disc >= 0.0 && 0.5 * (a + d) <= sqrt (disc));
+              ++i;
+            }
+          else
+            {
+              nonpos = (a <= 0.0);
+            }
+
+          if (nonpos)
+            {
+              GSL_ERROR ("matrix has an eigenvalue on the closed negative real axis",
+                         GSL_EDOM);
+            }
+        }
+
+      /* T <- T^{1/2^k} */
+      while (1)
+        {
+          gsl_matrix_memcpy (X, T);
+          gsl_matrix_add_diagonal (X, -1.0);
+
+          if (matfunc_norm1 (X) <= MATFUNC_LOG_THETA)
+            break;
+
+          if (k == MATFUNC_MAX_SQRT)
+            {
+              GSL_ERROR ("too many square roots in inverse scaling and squaring",
+                         GSL_EMAXITER);
+            }
+
+          status = matfunc_sqrt_quasi (T, R);
+          if (status)
+            return status;
+
+          gsl_matrix_memcpy (T, R);
+          ++k;
+        }
+
+      /* L = sum_j w_j X (I + s_j X)^{-1}, s_j = (1 + x_j)/2, using that
+         X commutes with (I + s_j X)^{-1} */
+      gsl_matrix_set_zero (L);
+
+      for (i = 0; i < 8; ++i)
+        {
+          const double xi = (i % 2) ? xgl[i / 2] : -xgl[i / 2];
+          const double wi = wgl[i / 2];
+          const double s = 0.5 * (1.0 + xi);
+
+          gsl_matrix_memcpy (M, X);
+          gsl_matrix_scale (M, s);
+          gsl_matrix_add_diagonal (M, 1.0);
+          gsl_matrix_memcpy (Y, X);
+
+          status = matfunc_solve (M, w->p, Y);
+          if (status)
+            return status;
+
+          matfunc_axpy (0.5 * wi, Y, L);
+        }
+
+      gsl_matrix_scale (L, ldexp (1.0, (int) k));
+
+      /* log(A) = Z L Z^T */
+      matfunc_unschur (w->Z, L, M, logA);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_linalg_expmv_alloc()
+  Allocate a workspace for exp(tA) v
+
+Inputs: n - dimension of A
+        m - dimension of the Krylov subspaces, m <= n; 30 is a
+            typical value
+*/
+
+gsl_linalg_expmv_workspace *
+gsl_linalg_expmv_alloc (const size_t n, const size_t m)
+{
+  gsl_linalg_expmv_workspace *w;
+
+  if (m == 0)
+    {
+      GSL_ERROR_NULL ("Krylov dimension must be positive", GSL_EINVAL);
+    }
+  else if (m > n)
+    {
+      GSL_ERROR_NULL ("Krylov dimension must not exceed matrix dimension", GSL_EBADLEN);
+    }
+
+  w = calloc (1, sizeof (gsl_linalg_expmv_workspace));
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  w->V = gsl_matrix_alloc (m + 1, n);
+  w->H = gsl_matrix_alloc (m + 2, m + 2);
+  w->F = gsl_matrix_alloc (m + 2, m + 2);
+  w->h = gsl_vector_alloc (m + 1);
+  w->work = gsl_vector_alloc (n);
+  w->expm_workspace_p = gsl_linalg_matfunc_alloc (m + 2);
+
+  if (w->V == NULL || w->H == NULL || w->F == NULL || w->h == NULL ||
+      w->work == NULL || w->expm_workspace_p == NULL)
+    {
+      gsl_linalg_expmv_free (w);
+      GSL_ERROR_NULL ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  w->n = n;
+  w->m = m;
+  w->nstep = 0;
+
+  return w;
+}
+
+void
+gsl_linalg_expmv_free (gsl_linalg_expmv_workspace * w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->V)
+    gsl_matrix_free (w->V);
+
+  if (w->H)
+    gsl_matrix_free (w->H);
+
+  if (w->F)
+    gsl_matrix_free (w->F);
+
+  if (w->h)
+    gsl_vector_free (w->h);
+
+  if (w->work)
+    gsl_vector_free (w->work);
+
+  if (w->expm_workspace_p)
+    gsl_linalg_matfunc_free (w->expm_workspace_p);
+
+  free (w);
+}
+
+size_t
+gsl_linalg_expmv_nstep (const gsl_linalg_expmv_workspace * w)
+{
+  return w->nstep;
+}
+
+/*
+gsl_linalg_expmv()
+  Compute y = exp(tA) v by Krylov projection
+
+Inputs: t   - time
+        A   - n-by-n matrix
+        v   - vector of length n
+        tol - local error tolerance per unit time, relative to the
+              norm of the solution
+        y   - (output) exp(tA) v; may be the same vector as v
+        w   - workspace
+*/
+
+int
+gsl_linalg_expmv (const double t, const gsl_matrix * A, const gsl_vector * v,
+                  const double tol, gsl_vector * y, gsl_linalg_expmv_workspace * w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != w->n)
+    {
+      GSL_ERROR ("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      expmv_op op;
+
+      op.A = A;
+      op.matvec = NULL;
+      op.params = NULL;
+
+      return expmv (&op, t, v, tol, y, w);
+    }
+}
+
+int
+gsl_linalg_expmv_op (int (* matvec)(CBLAS_TRANSPOSE_t TransA, const gsl_vector * x, gsl_vector * y, void * params),
+                     void * params, const double t, const gsl_vector * v,
+                     const double tol, gsl_vector * y, gsl_linalg_expmv_workspace * w)
+{
+  expmv_op op;
+
+  op.A = NULL;
+  op.matvec = matvec;
+  op.params = params;
+
+  return expmv (&op, t, v, tol, y, w);
+}
+
+/*
+matfunc_expm()
+  Pade scaling and squaring
+
+Inputs: A - n-by-n matrix, destroyed on output
+        eA - (output) exp(A)
+        W  - 5 scratch matrices of at least n-by-n
+        p  - permutation of at least size n
+*/
+
+static int
+matfunc_expm (const gsl_matrix * A, gsl_matrix * eA, gsl_matrix * W[], gsl_permutation * p)
+{
+  /* Pade coefficients b_0, ..., b_m */
+  static const double b3[] = { 120.0, 60.0, 12.0, 1.0 };
+  static const double b5[] = { 30240.0, 15120.0, 3360.0, 420.0, 30.0, 1.0 };
+  static const double b7[] = { 17297280.0, 8648640.0, 1995840.0, 277200.0, 25200.0,
+                               1512.0, 56.0, 1.0 };
+  static const double b9[] = { 17643225600.0, 8821612800.0, 2075673600.0, 302702400.0,
+                               30270240.0, 2162160.0, 110880.0, 3960.0, 90.0, 1.0 };
+  static const double b13[] = { 64764752532480000.0, 32382376266240000.0,
+                                7771770303897600.0, 1187353796428800.0, 129060195264000.0,
+                                10559470521600.0, 670442572800.0, 33522128640.0,
+                                1323241920.0, 40840800.0, 960960.0, 16380.0, 182.0, 1.0 };
+
+  /* ||A||_1 up to which the degree m approximant is accurate to unit
+     roundoff, m = 3, 5, 7, 9, 13 */
+  static const double theta[] = { 1.495585217958292e-2, 2.539398330063230e-1,
+                                  9.504178996162932e-1, 2.097847961257068e0,
+                                  5.371920351148152e0 };
+  static const double * const bm[] = { b3, b5, b7, b9 };
+  const size_t n = A->size1;
+  gsl_matrix_view Xv = gsl_matrix_submatrix ((gsl_matrix *) A, 0, 0, n, n);
+  gsl_matrix_view A2v = gsl_matrix_submatrix (W[0], 0, 0, n, n);
+  gsl_matrix_view A4v = gsl_matrix_submatrix (W[1], 0, 0, n, n);
+  gsl_matrix_view A6v = gsl_matrix_submatrix (W[2], 0, 0, n, n);
+  gsl_matrix_view Uv = gsl_matrix_submatrix (W[3], 0, 0, n, n);
+  gsl_matrix_view Pv = gsl_matrix_submatrix (W[4], 0, 0, n, n);
+  gsl_matrix * X = &Xv.matrix;
+  gsl_matrix * A2 = &A2v.matrix;
+  gsl_matrix * A4 = &A4v.matrix;
+  gsl_matrix * A6 = &A6v.matrix;
+  gsl_matrix * U = &Uv.matrix;
+  gsl_matrix * P = &Pv.matrix;
+  gsl_matrix * V = eA;
+  gsl_permutation perm;
+  const double anorm = matfunc_norm1 (A);
+  int s = 0;
+  int i, j, status;
+
+  perm.size = n;
+  perm.data = p->data;
+
+  if (!gsl_finite (anorm))
+    {
+      GSL_ERROR ("matrix contains non-finite elements", GSL_EDOM);
+    }
+
+  for (i = 0; i < 4; ++i)
+    {
+      if (anorm <= theta[i])
+        break;
+    }
+
+  gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, X, X, 0.0, A2);
+
+  if (i < 4)
+    {
+      /* degree m = 2i + 3 <= 9:
+         U = A (b_1 I + b_3 A^2 + ...), V = b_0 I + b_2 A^2 + ... */
+      const int m = 2 * i + 3;
+      const double * b = bm[i];
+      gsl_matrix * Ak[5];
+
+      Ak[0] = NULL;
+      Ak[1] = A2;
+      Ak[2] = A4;
+      Ak[3] = A6;
+      Ak[4] = P;
+
+      for (j = 2; 2 * j <= m; ++j)
+        gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, Ak[j - 1], A2, 0.0, Ak[j]);
+
+      /* P = b_1 I + b_3 A^2 + ..., V = b_0 I + b_2 A^2 + ... */
+      gsl_matrix_set_zero (V);
+      gsl_matrix_set_identity (U);
+      gsl_matrix_scale (U, b[1]);
+      gsl_matrix_add_diagonal (V, b[0]);
+
+      for (j = 1; 2 * j <= m; ++j)
+        {
+          matfunc_axpy (b[2 * j + 1], Ak[j], U);
+          matfunc_axpy (b[2 * j], Ak[j], V);
+        }
+
+      gsl_matrix_memcpy (P, U);
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, X, P, 0.0, U);
+    }
+  else
+    {
+      /* degree 13 with scaling A <- A / 2^s */
+      const double * b = b13;
+
+      if (anorm > theta[4])
+        {
+          s = (int) ceil (log (anorm / theta[4]) / M_LN2);
+          gsl_matrix_scale (X, ldexp (1.0, -s));
+          gsl_matrix_scale (A2, ldexp (1.0, -2 * s));
+        }
+
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, A2, A2, 0.0, A4);
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, A4, A2, 0.0, A6);
+
+      /* U = A [A6 (b13 A6 + b11 A4 + b9 A2) + b7 A6 + b5 A4 + b3 A2 + b1 I] */
+      gsl_matrix_memcpy (P, A6);
+      gsl_matrix_scale (P, b[13]);
+      matfunc_axpy (b[11], A4, P);
+      matfunc_axpy (b[9], A2, P);
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, A6, P, 0.0, V);
+      matfunc_axpy (b[7], A6, V);
+      matfunc_axpy (b[5], A4, V);
+      matfunc_axpy (b[3], A2, V);
+      gsl_matrix_add_diagonal (V, b[1]);
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, X, V, 0.0, U);
+
+      /* V = A6 (b12 A6 + b10 A4 + b8 A2) + b6 A6 + b4 A4 + b2 A2 + b0 I */
+      gsl_matrix_memcpy (P, A6);
+      gsl_matrix_scale (P, b[12]);
+      matfunc_axpy (b[10], A4, P);
+      matfunc_axpy (b[8], A2, P);
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, A6, P, 0.0, V);
+      matfunc_axpy (b[6], A6, V);
+      matfunc_axpy (b[4], A4, V);
+      matfunc_axpy (b[2], A2, V);
+      gsl_matrix_add_diagonal (V, b[0]);
+    }
+
+  /* solve (V - U) R = V + U, with R stored in eA = V */
+  gsl_matrix_memcpy (P, V);
+  matfunc_axpy (-1.0, U, P);
+  matfunc_axpy (1.0, U, V);
+
+  status = matfunc_solve (P, &perm, eA);
+  if (status)
+    return status;
+
+  /* undo the scaling by repeated squaring */
+  for (j = 0; j < s; ++j)
+    {
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, eA, eA, 0.0, P);
+      gsl_matrix_memcpy (eA, P);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* compute the real Schur form A = Z T Z^T, with T in w->W[0] and Z
+   in w->Z; A is not balanced, so that Z is orthogonal */
+static int
+matfunc_schur (const gsl_matrix * A, gsl_linalg_matfunc_workspace * w)
+{
+  gsl_matrix * T = w->W[0];
+  int status;
+
+  gsl_matrix_memcpy (T, A);
+
+  status = gsl_linalg_hessenberg_decomp (T, w->tau);
+  if (status)
+    return status;
+
+  gsl_linalg_hessenberg_unpack (T, w->tau, w->Z);
+  gsl_linalg_hessenberg_set_zero (T);
+
+  return matfunc_francis (T, w->Z);
+}
+
+/* apply the plane rotation [c s; -s c] to the vectors x and y */
+static void
+matfunc_rot (gsl_vector * x, gsl_vector * y, const double c, const double s)
+{
+  size_t i;
+
+  for (i = 0; i < x->size; ++i)
+    {
+      const double xi = gsl_vector_get (x, i);
+      const double yi = gsl_vector_get (y, i);
+
+      gsl_vector_set (x, i, c * xi + s * yi);
+      gsl_vector_set (y, i, c * yi - s * xi);
+    }
+}
+
+/*
+matfunc_lanv2()
+  Standardize the 2-by-2 block [a b; c d] (LAPACK dlanv2): on output
+
+[a b; c d]_in = [cs -sn; sn cs] [a b; c d]_out [cs sn; -sn cs]
+
+where the output block is upper triangular if its eigenvalues are
+real, and has a = d and b c < 0 if they are complex.
+*/
+
+static void
+matfunc_lanv2 (double *a, double *b, double *c, double *d, double *cs,
+               double *sn)
+{
+  *cs = 1.0;
+  *sn = 0.0;
+
+  if (*c == 0.0)
+    {
+      return;
+    }
+  else if (*b == 0.0)
+    {
+      /* swap the rows and columns */
+      const double tmp = *d;
+
+      *cs = 0.0;
+      *sn = 1.0;
+      *d = *a;
+      *a = tmp;
+      *b = -*c;
+      *c = 0.0;
+    }
+  else if (*a - *d == 0.0 && GSL_SIGN (*b) != GSL_SIGN (*c))
+    {
+      return;
+    }
+  else
+    {
+      const double temp = *a - *d;
+      const double bcmax = GSL_MAX (fabs (*b), fabs (*c));
+      const double bcmis = GSL_MIN (fabs (*b), fabs (*c)) * GSL_SIGN (*b) * GSL_SIGN (*c);
+      double p = 0.5 * temp;
+      double scale = GSL_MAX (fabs (p), bcmax);
+      double z = p / scale * p + bcmax / scale * bcmis;
+
+      if (z >= 4.0 * GSL_DBL_EPSILON)
+        {
+          /* real eigenvalues */
+          double tau;
+
+          z = p + GSL_SIGN (p) * sqrt (scale) * sqrt (z);
+          *a = *d + z;
+          *d -= bcmax / z * bcmis;
+          tau = gsl_hypot (*c, z);
+          *cs = z / tau;
+          *sn = *c / tau;
+          *b -= *c;
+          *c = 0.0;
+        }
+      else
+        {
+          /* complex or almost equal real eigenvalues: make the
+             diagonal elements equal */
+          const double sigma = *b + *c;
+          const double tau = gsl_hypot (sigma, temp);
+          double aa, bb, cc, dd, mid;
+
+          *cs = sqrt (0.5 * (1.0 + fabs (sigma) / tau));
+          *sn = -(p / (tau * *cs)) * GSL_SIGN (sigma);
+
+          aa = *a * *cs + *b * *sn;
+          bb = -*a * *sn + *b * *cs;
+          cc = *c * *cs + *d * *sn;
+          dd = -*c * *sn + *d * *cs;
+
+          *a = aa * *cs + cc * *sn;
+          *b = bb * *cs + dd * *sn;
+          *c = -aa * *sn + cc * *cs;
+          *d = -bb * *sn + dd * *cs;
+
+          mid = 0.5 * (*a + *d);
+          *a = mid;
+          *d = mid;
+
+          if (*c != 0.0)
+            {
+              if (*b != 0.0)
+                {
+                  if (GSL_SIGN (*b) == GSL_SIGN (*c))
+                    {
+                      /* real eigenvalues after all: triangularize */
+                      const double sab = sqrt (fabs (*b));
+                      const double sac = sqrt (fabs (*c));
+                      const double t = 1.0 / sqrt (fabs (*b + *c));
+                      const double cs1 = sab * t;
+                      const double sn1 = sac * t;
+                      double tmp;
+
+                      p = GSL_SIGN (*c) * sab * sac;
+                      *a = mid + p;
+                      *d = mid - p;
+                      *b -= *c;
+                      *c = 0.0;
+
+                      tmp = *cs * cs1 - *sn * sn1;
+                      *sn = *cs * sn1 + *sn * cs1;
+                      *cs = tmp;
+                    }
+                }
+              else
+                {
+                  const double tmp = *cs;
+
+                  *b = -*c;
+                  *c = 0.0;
+                  *cs = -*sn;
+                  *sn = tmp;
+                }
+            }
+        }
+    }
+}
+
+/* apply the reflector I - beta v v^T, v of length nv = 2 or 3, to rows
+   k, ..., k+nv-1 of columns c0..n-1 of H from the left, to columns
+   k, ..., k+nv-1 of rows 0..r1 of H from the right, and to the same
+   columns of Z */
+static void
+matfunc_reflect (gsl_matrix * H, gsl_matrix * Z, const size_t k,
+                 const size_t nv, const double v[3], const double beta,
+                 const size_t c0, const size_t r1)
+{
+  const size_t n = H->size1;
+  size_t i, j, l;
+
+  for (j = c0; j < n; ++j)
+    {
+      double sum = 0.0;
+
+      for (l = 0; l < nv; ++l)
+        sum += v[l] * gsl_matrix_get (H, k + l, j);
+
+      sum *= beta;
+
+      for (l = 0; l < nv; ++l)
+        gsl_matrix_set (H, k + l, j, gsl_matrix_get (H, k + l, j) - sum * v[l]);
+    }
+
+  for (i = 0; i <= r1; ++i)
+    {
+      double sum = 0.0;
+
+      for (l = 0; l < nv; ++l)
+        sum += gsl_matrix_get (H, i, k + l) * v[l];
+
+      sum *= beta;
+
+      for (l = 0; l < nv; ++l)
+        gsl_matrix_set (H, i, k + l, gsl_matrix_get (H, i, k + l) - sum * v[l]);
+    }
+
+  for (i = 0; i < n; ++i)
+    {
+      double sum = 0.0;
+
+      for (l = 0; l < nv; ++l)
+        sum += gsl_matrix_get (Z, i, k + l) * v[l];
+
+      sum *= beta;
+
+      for (l = 0; l < nv; ++l)
+        gsl_matrix_set (Z, i, k + l, gsl_matrix_get (Z, i, k + l) - sum * v[l]);
+    }
+}
+
+/* reflector I - beta v v^T with v[0] = x[0] - alpha, v[i] = x[i],
+   mapping x to alpha e_1; returns 0 if x = 0 */
+static int
+matfunc_house (const double x[3], const size_t nv, double v[3], double *beta)
+{
+  double norm = 0.0, vtv;
+  size_t l;
+
+  for (l = 0; l < nv; ++l)
+    norm = gsl_hypot (norm, x[l]);
+
+  if (norm == 0.0)
+    return 0;
+
+  v[0] = x[0] + GSL_SIGN (x[0]) * norm;
+
+  for (l = 1; l < nv; ++l)
+    v[l] = x[l];
+
+  vtv = 0.0;
+  for (l = 0; l < nv; ++l)
+    vtv += v[l] * v[l];
+
+  *beta = 2.0 / vtv;
+
+  return 1;
+}
+
+/*
+matfunc_francis()
+  Reduce the upper Hessenberg H to real Schur form T = Q^T H Q by the
+Francis double shift QR iteration (Golub and Van Loan, algorithm
+7.5.2), accumulating Z := Z Q. The 2-by-2 blocks of T are
+standardized, so that they have complex conjugate eigenvalues.
+
+Return: success, or GSL_EMAXITER if the iteration does not converge
+*/
+
+static int
+matfunc_francis (gsl_matrix * H, gsl_matrix * Z)
+{
+  const size_t n = H->size1;
+  const size_t max_iter = 30 * n;
+  size_t iter = 0, its = 0;
+  int hi = (int) n - 1;
+
+  while (hi >= 0)
+    {
+      int l, k;
+      double s, t, x[3], v[3], beta;
+
+      /* find the top l of the active block [l, hi], where the
+         subdiagonal element H(l,l-1) is negligible */
+      for (l = hi; l > 0; --l)
+        {
+          const double h = fabs (gsl_matrix_get (H, l, l - 1));
+          double tst = fabs (gsl_matrix_get (H, l - 1, l - 1))
+                       + fabs (gsl_matrix_get (H, l, l));
+
+          if (tst == 0.0)
+            tst = matfunc_norm1 (H);
+
+          if (h <= GSL_DBL_EPSILON * tst)
+            {
+              gsl_matrix_set (H, l, l - 1, 0.0);
+              break;
+            }
+        }
+
+      if (l == hi)
+        {
+          /* 1-by-1 block */
+          --hi;
+          its = 0;
+          continue;
+        }
+      else if (l == hi - 1)
+        {
+          /* 2-by-2 block: standardize */
+          double a = gsl_matrix_get (H, l, l);
+          double b = gsl_matrix_get (H, l, hi);
+          double c = gsl_matrix_get (H, hi, l);
+          double d = gsl_matrix_get (H, hi, hi);
+          double cs, sn;
+
+          matfunc_lanv2 (&a, &b, &c, &d, &cs, &sn);
+
+          gsl_matrix_set (H, l, l, a);
+          gsl_matrix_set (H, l, hi, b);
+          gsl_matrix_set (H, hi, l, c);
+          gsl_matrix_set (H, hi, hi, d);
+
+          if (hi + 1 < (int) n)
+            {
+              gsl_vector_view r1 = gsl_matrix_subrow (H, l, hi + 1, n - hi - 1);
+              gsl_vector_view r2 = gsl_matrix_subrow (H, hi, hi + 1, n - hi - 1);
+              matfunc_rot (&r1.vector, &r2.vector, cs, sn);
+            }
+
+          if (l > 0)
+            {
+              gsl_vector_view c1 = gsl_matrix_subcolumn (H, l, 0, l);
+              gsl_vector_view c2 = gsl_matrix_subcolumn (H, hi, 0, l);
+              matfunc_rot (&c1.vector, &c2.vector, cs, sn);
+            }
+
+          {
+            gsl_vector_view z1 = gsl_matrix_column (Z, l);
+            gsl_vector_view z2 = gsl_matrix_column (Z, hi);
+            matfunc_rot (&z1.vector, &z2.vector, cs, sn);
+          }
+
+          hi -= 2;
+          its = 0;
+          continue;
+        }
+
+      if (++iter > max_iter)
+        {
+          GSL_ERROR ("Schur decomposition did not converge", GSL_EMAXITER);
+        }
+
+      ++its;
+
+      /* shifts: the eigenvalues of the trailing 2-by-2 block, through
+         their sum s and product t, or exceptional shifts */
+      if (its % 10 == 0)
+        {
+          const double ss = fabs (gsl_matrix_get (H, hi, hi - 1))
+                            + fabs (gsl_matrix_get (H, hi - 1, hi - 2));
+          const double h11 = 0.75 * ss + gsl_matrix_get (H, hi, hi);
+
+          s = 2.0 * h11;
+          t = h11 * h11 + 0.4375 * ss * ss;
+        }
+      else
+        {
+          const double a = gsl_matrix_get (H, hi - 1, hi - 1);
+          const double b = gsl_matrix_get (H, hi - 1, hi);
+          const double c = gsl_matrix_get (H, hi, hi - 1);
+          const double d = gsl_matrix_get (H, hi, hi);
+
+          s = a + d;
+          t = a * d - b * c;
+        }
+
+      /* first column of (H - s1 I)(H - s2 I) */
+      {
+        const double h00 = gsl_matrix_get (H, l, l);
+        const double h01 = gsl_matrix_get (H, l, l + 1);
+        const double h10 = gsl_matrix_get (H, l + 1, l);
+        const double h11 = gsl_matrix_get (H, l + 1, l + 1);
+        const double h21 = gsl_matrix_get (H, l + 2, l + 1);
+
+        x[0] = h00 * h00 + h01 * h10 - s * h00 + t;
+        x[1] = h10 * (h00 + h11 - s);
+        x[2] = h10 * h21;
+      }
+
+      /* chase the bulge down the active block */
+      for (k = l; k <= hi - 2; ++k)
+        {
+          if (matfunc_house (x, 3, v, &beta))
+            {
+              matfunc_reflect (H, Z, k, 3, v, beta, (k > l) ? k - 1 : l,
+                               GSL_MIN (k + 3, hi));
+
+              if (k > l)
+                {
+                  gsl_matrix_set (H, k + 1, k - 1, 0.0);
+                  gsl_matrix_set (H, k + 2, k - 1, 0.0);
+                }
+            }
+
+          x[0] = gsl_matrix_get (H, k + 1, k);
+          x[1] = gsl_matrix_get (H, k + 2, k);
+          if (k + 3 <= hi)
+            x[2] = gsl_matrix_get (H, k + 3, k);
+        }
+
+      if (matfunc_house (x, 2, v, &beta))
+        {
+          matfunc_reflect (H, Z, hi - 1, 2, v, beta, hi - 2, hi);
+          gsl_matrix_set (H, hi, hi - 2, 0.0);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* solve the p-by-q Sylvester equation A X + X B = C, p,q <= 2, in
+   place in C by Gaussian elimination on the Kronecker form; returns
+   GSL_ESING if A and -B have a common eigenvalue */
+static int
+matfunc_sylvester_small (const gsl_matrix * A, const gsl_matrix * B, gsl_matrix * C)
+{
+  const size_t p = A->size1;
+  const size_t q = B->size1;
+  const size_t nk = p * q;
+  double K[4][4], x[4];
+  size_t i, j, k, l;
+
+  /* K = I_q (x) A + B^T (x) I_p, vec in column major order */
+  for (i = 0; i < nk; ++i)
+    {
+      for (j = 0; j < nk; ++j)
+        K[i][j] = 0.0;
+    }
+
+  for (l = 0; l < q; ++l)
+    {
+      for (i = 0; i < p; ++i)
+        {
+          for (k = 0; k < p; ++k)
+            K[l * p + i][l * p + k] += gsl_matrix_get (A, i, k);
+
+          for (k = 0; k < q; ++k)
+            K[l * p + i][k * p + i] += gsl_matrix_get (B, k, l);
+        }
+
+      for (i = 0; i < p; ++i)
+        x[l * p + i] = gsl_matrix_get (C, i, l);
+    }
+
+  for (k = 0; k < nk; ++k)
+    {
+      size_t piv = k;
+
+      for (i = k + 1; i < nk; ++i)
+        {
+          if (fabs (K[i][k]) > fabs (K[piv][k]))
+            piv = i;
+        }
+
+      if (K[piv][k] == 0.0)
+        return GSL_ESING;
+
+      if (piv != k)
+        {
+          double tmp;
+
+          for (j = 0; j < nk; ++j)
+            {
+              tmp = K[k][j];
+              K[k][j] = K[piv][j];
+              K[piv][j] = tmp;
+            }
+
+          tmp = x[k];
+          x[k] = x[piv];
+          x[piv] = tmp;
+        }
+
+      for (i = k + 1; i < nk; ++i)
+        {
+          const double f = K[i][k] / K[k][k];
+
+          for (j = k; j < nk; ++j)
+            K[i][j] -= f * K[k][j];
+
+          x[i] -= f * x[k];
+        }
+    }
+
+  for (k = nk; k-- > 0; )
+    {
+      for (j = k + 1; j < nk; ++j)
+        x[k] -= K[k][j] * x[j];
+
+      x[k] /= K[k][k];
+    }
+
+  for (l = 0; l < q; ++l)
+    {
+      for (i = 0; i < p; ++i)
+        gsl_matrix_set (C, i, l, x[l * p + i]);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+matfunc_sqrt_quasi()
+  Principal square root R of the quasi upper triangular T, by the
+recurrence of Higham (1987) over the 1-by-1 and 2-by-2 diagonal blocks:
+
+R_jj = sqrt(T_jj)
+R_ii R_ij + R_ij R_jj = T_ij - sum_{i<k<j} R_ik R_kj
+*/
+
+static int
+matfunc_sqrt_quasi (const gsl_matrix * T, gsl_matrix * R)
+{
+  const size_t n = T->size1;
+  size_t *start = malloc ((n + 1) * sizeof (size_t));
+  size_t nblk = 0;
+  size_t i, j;
+
+  if (start == NULL)
+    {
+      GSL_ERROR ("failed to allocate block indices", GSL_ENOMEM);
+    }
+
+  /* diagonal blocks [start[k], start[k+1]) */
+  for (i = 0; i < n; )
+    {
+      start[nblk++] = i;
+      i += (i + 1 < n && gsl_matrix_get (T, i + 1, i) != 0.0) ? 2 : 1;
+    }
+
+  start[nblk] = n;
+
+  gsl_matrix_set_zero (R);
+
+  for (j = 0; j < nblk; ++j)
+    {
+      const size_t j0 = start[j];
+      const size_t nj = start[j + 1] - j0;
+      gsl_matrix_const_view Tjj = gsl_matrix_const_submatrix (T, j0, j0, nj, nj);
+      gsl_matrix_view Rjj = gsl_matrix_submatrix (R, j0, j0, nj, nj);
+
+      if (nj == 1)
+        {
+          const double tjj = gsl_matrix_get (&Tjj.matrix, 0, 0);
+
+          if (tjj < 0.0)
+            {
+              free (start);
+              GSL_ERROR ("matrix has a negative real eigenvalue", GSL_EDOM);
+            }
+
+          gsl_matrix_set (&Rjj.matrix, 0, 0, sqrt (tjj));
+        }
+      else
+        {
+          /* sqrt(B) = (B + sqrt(det B) I) / sqrt(tr B + 2 sqrt(det B)),
+             which is the principal square root when B has no
+             eigenvalue on the closed negative real axis */
+          const double a = gsl_matrix_get (&Tjj.matrix, 0, 0);
+          const double b = gsl_matrix_get (&Tjj.matrix, 0, 1);
+          const double c = gsl_matrix_get (&Tjj.matrix, 1, 0);
+          const double d = gsl_matrix_get (&Tjj.matrix, 1, 1);
+          const double det = a * d - b * c;
+          const double disc = 0.25 * (a - d) * (a - d) + b * c;
+          double sdet, tau;
+
+          if (disc >= 0.0 && (a + d) * 0.5 - sqrt (disc) < 0.0)
+            {
+              free (start);
+              GSL_ERROR ("matrix has a negative real eigenvalue", GSL_EDOM);
+            }
+
+          sdet = sqrt (det);
+          tau = sqrt (a + d + 2.0 * sdet);
+
+          if (tau == 0.0)
+            {
+              free (start);
+              GSL_ERROR ("matrix has a defective zero eigenvalue", GSL_ESING);
+            }
+
+          gsl_matrix_set (&Rjj.matrix, 0, 0, (a + sdet) / tau);
+          gsl_matrix_set (&Rjj.matrix, 0, 1, b / tau);
+          gsl_matrix_set (&Rjj.matrix, 1, 0, c / tau);
+          gsl_matrix_set (&Rjj.matrix, 1, 1, (d + sdet) / tau);
+        }
+
+      for (i = j; i-- > 0; )
+        {
+          const size_t i0 = start[i];
+          const size_t ni = start[i + 1] - i0;
+          const size_t i1 = start[i + 1];
+          gsl_matrix_view Rii = gsl_matrix_submatrix (R, i0, i0, ni, ni);
+          gsl_matrix_view Rij = gsl_matrix_submatrix (R, i0, j0, ni, nj);
+          gsl_matrix_const_view Tij = gsl_matrix_const_submatrix (T, i0, j0, ni, nj);
+          int status;
+
+          gsl_matrix_memcpy (&Rij.matrix, &Tij.matrix);
+
+          if (j0 > i1)
+            {
+              /* R_ij -= R(i, i1:j0) R(i1:j0, j) */
+              gsl_matrix_view Rik = gsl_matrix_submatrix (R, i0, i1, ni, j0 - i1);
+              gsl_matrix_view Rkj = gsl_matrix_submatrix (R, i1, j0, j0 - i1, nj);
+
+              gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, -1.0, &Rik.matrix, &Rkj.matrix,
+                              1.0, &Rij.matrix);
+            }
+
+          status = matfunc_sylvester_small (&Rii.matrix, &Rjj.matrix, &Rij.matrix);
+          if (status)
+            {
+              free (start);
+              GSL_ERROR ("matrix is singular and has no computable square root", GSL_ESING);
+            }
+        }
+    }
+
+  free (start);
+
+  return GSL_SUCCESS;
+}
+
+/* B = Z F Z^T */
+static void
+matfunc_unschur (const gsl_matrix * Z, const gsl_matrix * F, gsl_matrix * work,
+                 gsl_matrix * B)
+{
+  gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, Z, F, 0.0, work);
+  gsl_blas_dgemm (CblasNoTrans, CblasTrans, 1.0, work, Z, 0.0, B);
+}
+
+/* solve M Y = X in place in X, destroying M */
+static int
+matfunc_solve (gsl_matrix * M, gsl_permutation * p, gsl_matrix * X)
+{
+  const size_t n = M->size1;
+  int signum, status;
+  size_t j;
+
+  status = gsl_linalg_LU_decomp (M, p, &signum);
+  if (status)
+    return status;
+
+  for (j = 0; j < n; ++j)
+    {
+      if (gsl_matrix_get (M, j, j) == 0.0)
+        {
+          GSL_ERROR ("matrix is singular", GSL_ESING);
+        }
+    }
+
+  for (j = 0; j < X->size2; ++j)
+    {
+      gsl_vector_view c = gsl_matrix_column (X, j);
+      gsl_permute_vector (p, &c.vector);
+    }
+
+  gsl_blas_dtrsm (CblasLeft, CblasLower, CblasNoTrans, CblasUnit, 1.0, M, X);
+  gsl_blas_dtrsm (CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0, M, X);
+
+  return GSL_SUCCESS;
+}
+
+/* Y += alpha X */
+static void
+matfunc_axpy (const double alpha, const gsl_matrix * X, gsl_matrix * Y)
+{
+  size_t i;
+
+  for (i = 0; i < X->size1; ++i)
+    {
+      gsl_vector_const_view x = gsl_matrix_const_row (X, i);
+      gsl_vector_view y = gsl_matrix_row (Y, i);
+      gsl_blas_daxpy (alpha, &x.vector, &y.vector);
+    }
+}
+
+/* ||A||_1 = max_j sum_i |A_ij| */
+static double
+matfunc_norm1 (const gsl_matrix * A)
+{
+  const size_t N = A->size2;
+  double norm = 0.0;
+  size_t j;
+
+  for (j = 0; j < N; ++j)
+    {
+      gsl_vector_const_view c = gsl_matrix_const_column (A, j);
+      double cnorm = gsl_blas_dasum (&c.vector);
+
+      if (cnorm > norm || gsl_isnan (cnorm))
+        norm = cnorm;
+    }
+
+  return norm;
+}
+
+/* y = A x */
+static int
+expmv_apply (const expmv_op * op, const gsl_vector * x, gsl_vector * y)
+{
+  if (op->A != NULL)
+    return gsl_blas_dgemv (CblasNoTrans, 1.0, op->A, x, 0.0, y);
+  else
+    return op->matvec (CblasNoTrans, x, y, op->params);
+}
+
+/* round a step size down to two significant digits, as in Sidje's
+   EXPOKIT */
+static double
+expmv_round (const double tau)
+{
+  const double s = pow (10.0, floor (log10 (tau)) - 1.0);
+  return ceil (tau / s) * s;
+}
+
+/*
+expmv()
+  Krylov time stepping for y = exp(tA) v
+
+Notes:
+1) At each step the Arnoldi process builds an orthonormal basis V of
+K_m(A, w) with A V_m = V_m H_m + h_{m+1,m} v_{m+1} e_m^T, using
+classical Gram-Schmidt with reorthogonalization so that the
+projections are matrix-vector products with V.
+
+2) exp(tau A) w ~ beta V_{m+1} exp(tau Hbar) e_1, where Hbar is H_m
+augmented by h_{m+1,m} and a unit entry (Sidje 1998), and the last
+two entries of exp(tau Hbar) e_1 give the local error estimate used
+to accept the step and choose the next one.
+
+3) If h_{j+1,j} vanishes the subspace is invariant and the remaining
+interval is covered in one step.
+*/
+
+static int
+expmv (const expmv_op * op, const double t, const gsl_vector * v,
+       const double tol, gsl_vector * y, gsl_linalg_expmv_workspace * w)
+{
+  const size_t n = w->n;
+  const size_t m = w->m;
+
+  if (v->size != n)
+    {
+      GSL_ERROR ("vector v does not match workspace", GSL_EBADLEN);
+    }
+  else if (y->size != n)
+    {
+      GSL_ERROR ("vector y does not match workspace", GSL_EBADLEN);
+    }
+  else if (tol <= 0.0)
+    {
+      GSL_ERROR ("tolerance must be positive", GSL_EINVAL);
+    }
+  else
+    {
+      const double gamma = 0.9;
+      const double delta = 1.2;
+      const size_t max_reject = 10;
+      const double tabs = fabs (t);
+      const double sgn = (t < 0.0) ? -1.0 : 1.0;
+      gsl_vector * p = w->work;
+      double beta = gsl_blas_dnrm2 (v);
+      double tnow = 0.0, tnew = 0.0;
+      double hnorm = 0.0;
+      int status;
+
+      gsl_vector_memcpy (y, v);
+      w->nstep = 0;
+
+      if (beta == 0.0 || t == 0.0)
+        return GSL_SUCCESS;
+
+      while (tnow < tabs)
+        {
+          gsl_vector_view v0 = gsl_matrix_row (w->V, 0);
+          size_t mb = m, mx, nrej, j;
+          int breakdown = 0;
+          double tau, err = 0.0, xm = 1.0 / m, avnorm = 0.0;
+
+          /* Arnoldi */
+          gsl_matrix_set_zero (w->H);
+          gsl_vector_memcpy (&v0.vector, y);
+          gsl_vector_scale (&v0.vector, 1.0 / beta);
+
+          for (j = 0; j < m; ++j)
+            {
+              gsl_vector_const_view vj = gsl_matrix_const_row (w->V, j);
+              gsl_matrix_view Vj = gsl_matrix_submatrix (w->V, 0, 0, j + 1, n);
+              gsl_vector_view hj = gsl_vector_subvector (w->h, 0, j + 1);
+              gsl_vector_view Hj = gsl_matrix_subcolumn (w->H, j, 0, j + 1);
+              double s;
+              int pass;
+
+              status = expmv_apply (op, &vj.vector, p);
+              if (status)
+                return status;
+
+              for (pass = 0; pass < 2; ++pass)
+                {
+                  gsl_blas_dgemv (CblasNoTrans, 1.0, &Vj.matrix, p, 0.0, &hj.vector);
+                  gsl_blas_dgemv (CblasTrans, -1.0, &Vj.matrix, &hj.vector, 1.0, p);
+                  gsl_vector_add (&Hj.vector, &hj.vector);
+                }
+
+              s = gsl_blas_dnrm2 (p);
+              hnorm = GSL_MAX (hnorm, gsl_blas_dasum (&Hj.vector) + s);
+
+              if (s <= GSL_DBL_EPSILON * hnorm)
+                {
+                  /* invariant subspace */
+                  breakdown = 1;
+                  mb = j + 1;
+                  break;
+                }
+
+              gsl_matrix_set (w->H, j + 1, j, s);
+
+              {
+                gsl_vector_view vj1 = gsl_matrix_row (w->V, j + 1);
+                gsl_vector_memcpy (&vj1.vector, p);
+                gsl_vector_scale (&vj1.vector, 1.0 / s);
+              }
+            }
+
+          if (!breakdown)
+            {
+              gsl_vector_const_view vm = gsl_matrix_const_row (w->V, m);
+
+              gsl_matrix_set (w->H, m + 1, m, 1.0);
+
+              status = expmv_apply (op, &vm.vector, p);
+              if (status)
+                return status;
+
+              avnorm = gsl_blas_dnrm2 (p);
+            }
+
+          if (w->nstep == 0 && !breakdown)
+            {
+              /* initial step from the a priori error bound, with
+                 ||A|| estimated by ||H||_1 */
+              const double fact = pow ((m + 1.0) / M_E, m + 1.0) * sqrt (2.0 * M_PI * (m + 1.0));
+
+              tnew = (1.0 / hnorm) * pow ((fact * tol) / (4.0 * hnorm), xm);
+              tnew = expmv_round (tnew);
+            }
+
+          tau = breakdown ? tabs - tnow : GSL_MIN (tabs - tnow, tnew);
+          mx = breakdown ? mb : m + 2;
+
+          for (nrej = 0; ; ++nrej)
+            {
+              gsl_matrix_view Hs = gsl_matrix_submatrix (w->H, 0, 0, mx, mx);
+              gsl_matrix_view Fs = gsl_matrix_submatrix (w->F, 0, 0, mx, mx);
+              gsl_linalg_matfunc_workspace * ew = w->expm_workspace_p;
+              gsl_matrix_view Xs = gsl_matrix_submatrix (ew->W[0], 0, 0, mx, mx);
+
+              gsl_matrix_memcpy (&Xs.matrix, &Hs.matrix);
+              gsl_matrix_scale (&Xs.matrix, sgn * tau);
+
+              status = matfunc_expm (&Xs.matrix, &Fs.matrix, ew->W + 1, ew->p);
+              if (status)
+                return status;
+
+              if (breakdown)
+                {
+                  err = 0.0;
+                  break;
+                }
+              else
+                {
+                  const double phi1 = fabs (beta * gsl_matrix_get (w->F, m, 0));
+                  const double phi2 = fabs (beta * gsl_matrix_get (w->F, m + 1, 0) * avnorm);
+
+                  if (phi1 > 10.0 * phi2)
+                    {
+                      err = phi2;
+                      xm = 1.0 / m;
+                    }
+                  else if (phi1 > phi2)
+                    {
+                      err = (phi1 * phi2) / (phi1 - phi2);
+                      xm = 1.0 / m;
+                    }
+                  else
+                    {
+                      err = phi1;
+                      xm = (m > 1) ? 1.0 / (m - 1.0) : 1.0;
+                    }
+                }
+
+              if (err <= delta * tau * tol * beta)
+                break;
+
+              if (nrej == max_reject || !gsl_finite (err))
+                {
+                  GSL_ERROR ("requested tolerance could not be reached", GSL_ETOL);
+                }
+
+              tau = expmv_round (gamma * tau * pow (tau * tol * beta / err, xm));
+            }
+
+          /* y = beta V_{mx} F(:,0) */
+          mx = breakdown ? mb : m + 1;
+
+          {
+            gsl_matrix_view Vx = gsl_matrix_submatrix (w->V, 0, 0, mx, n);
+            gsl_vector_view f = gsl_matrix_subcolumn (w->F, 0, 0, mx);
+
+            gsl_blas_dgemv (CblasTrans, beta, &Vx.matrix, &f.vector, 0.0, y);
+          }
+
+          beta = gsl_blas_dnrm2 (y);
+          tnow += tau;
+          ++(w->nstep);
+
+          if (breakdown || beta == 0.0)
+            break;
+
+          if (err > 0.0)
+            tnew = expmv_round (gamma * tau * pow (tau * tol * beta / err, xm));
+          else
+            tnew = tabs - tnow;
+        }
+
+      return GSL_SUCCESS;
+    }
+}
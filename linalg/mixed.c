@@ -0,0 +1,696 @@
+/* linalg/mixed.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Mixed precision solution of dense linear systems A x = b.
+ *
+ * A is factored in single precision (LU with partial pivoting, or
+ * Cholesky), with the recursive Level 3 algorithms of lu.c and cholesky.c
+ * on gsl_matrix_float, so that the O(N^3) work is done by sgemm and
+ * strsm. The solution is then refined in double precision,
+ *
+ * x_0 = A_f^{-1} b,  r_i = b - A x_i,  x_{i+1} = x_i + A_f^{-1} r_i
+ *
+ * until ||r_i||_inf <= ||x_i||_inf ||A||_inf eps sqrt(N), as in LAPACK
+ * DSGESV. The iteration converges when cond(A) is small compared to
+ * 1 / GSL_FLT_EPSILON. If the single precision factorization fails,
+ * its condition estimate is too large or the refinement does not
+ * converge, A is factored in double precision instead.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_machine.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+
+#include "recurse.h"
+
+/* smallest reciprocal condition number for which the single precision
+   factorization is used */
+#define MIXED_RCOND_MIN    (GSL_FLT_EPSILON)
+
+/* maximum number of refinement iterations */
+#define MIXED_MAXITER      30
+
+static int mixed_decomp (const gsl_matrix * A, const int chol, gsl_linalg_mixed_workspace * w);
+static int mixed_solve (const gsl_matrix * A, const int chol, const gsl_vector * b,
+                        gsl_vector * x, gsl_linalg_mixed_workspace * w);
+static int mixed_fallback (const gsl_matrix * A, gsl_linalg_mixed_workspace * w);
+static int mixed_solve_float (CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params);
+static int mixed_convert (const gsl_matrix * A, gsl_matrix_float * Af);
+static double norminf (const gsl_vector * v);
+static void mixed_norms (const gsl_matrix * A, const int chol, gsl_vector * work,
+                         double * norm1, double * norminf);
+static int LU_float_L2 (gsl_matrix_float * A, gsl_vector_uint * ipiv);
+static int LU_float_L3 (gsl_matrix_float * A, gsl_vector_uint * ipiv);
+static void apply_pivots_float (gsl_matrix_float * A, const gsl_vector_uint * ipiv);
+static int cholesky_float_L2 (gsl_matrix_float * A);
+static int cholesky_float_L3 (gsl_matrix_float * A);
+
+gsl_linalg_mixed_workspace *
+gsl_linalg_mixed_alloc (const size_t N)
+{
+  gsl_linalg_mixed_workspace *w;
+
+  if (N == 0)
+    {
+      GSL_ERROR_NULL ("matrix dimension must be positive", GSL_EINVAL);
+    }
+
+  w = calloc (1, sizeof (gsl_linalg_mixed_workspace));
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  w->LUf = gsl_matrix_float_alloc (N, N);
+  w->ipiv = gsl_vector_uint_alloc (N);
+  w->p = gsl_permutation_alloc (N);
+  w->work = gsl_vector_alloc (3 * N);
+  w->workf = gsl_vector_float_alloc (N);
+
+  if (w->LUf == NULL || w->ipiv == NULL || w->p == NULL || w->work == NULL || w->workf == NULL)
+    {
+      gsl_linalg_mixed_free (w);
+      GSL_ERROR_NULL ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  w->N = N;
+  w->chol = -1; /* no factorization yet */
+
+  return w;
+}
+
+void
+gsl_linalg_mixed_free (gsl_linalg_mixed_workspace * w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->LUf)
+    gsl_matrix_float_free (w->LUf);
+
+  if (w->ipiv)
+    gsl_vector_uint_free (w->ipiv);
+
+  if (w->LU)
+    gsl_matrix_free (w->LU);
+
+  if (w->p)
+    gsl_permutation_free (w->p);
+
+  if (w->work)
+    gsl_vector_free (w->work);
+
+  if (w->workf)
+    gsl_vector_float_free (w->workf);
+
+  free (w);
+}
+
+/*
+gsl_linalg_LU_mixed_decomp()
+  Factor a general square matrix for gsl_linalg_LU_mixed_solve()
+
+Inputs: A - N-by-N matrix, not modified
+        w - workspace
+
+Return: success/error
+*/
+
+int
+gsl_linalg_LU_mixed_decomp (const gsl_matrix * A, gsl_linalg_mixed_workspace * w)
+{
+  return mixed_decomp (A, 0, w);
+}
+
+/*
+gsl_linalg_LU_mixed_solve()
+  Solve A x = b using the factorization of A computed by
+gsl_linalg_LU_mixed_decomp()
+
+Inputs: A - N-by-N matrix passed to gsl_linalg_LU_mixed_decomp()
+        b - right hand side, length N
+        x - (output) solution, length N
+        w - workspace
+
+Return: success/error
+*/
+
+int
+gsl_linalg_LU_mixed_solve (const gsl_matrix * A, const gsl_vector * b, gsl_vector * x,
+                           gsl_linalg_mixed_workspace * w)
+{
+  return mixed_solve (A, 0, b, x, w);
+}
+
+/*
+gsl_linalg_cholesky_mixed_decomp()
+  Factor a symmetric positive definite matrix for
+gsl_linalg_cholesky_mixed_solve()
+
+Inputs: A - N-by-N matrix, lower triangle used, not modified
+        w - workspace
+
+Return: success/error
+*/
+
+int
+gsl_linalg_cholesky_mixed_decomp (const gsl_matrix * A, gsl_linalg_mixed_workspace * w)
+{
+  return mixed_decomp (A, 1, w);
+}
+
+/*
+gsl_linalg_cholesky_mixed_solve()
+  Solve A x = b using the factorization of A computed by
+gsl_linalg_cholesky_mixed_decomp()
+
+Inputs: A - N-by-N matrix passed to gsl_linalg_cholesky_mixed_decomp()
+        b - right hand side, length N
+        x - (output) solution, length N
+        w - workspace
+
+Return: success/error
+*/
+
+int
+gsl_linalg_cholesky_mixed_solve (const gsl_matrix * A, const gsl_vector * b, gsl_vector * x,
+                                 gsl_linalg_mixed_workspace * w)
+{
+  return mixed_solve (A, 1, b, x, w);
+}
+
+/* number of refinement iterations of the last solve */
+size_t
+gsl_linalg_mixed_niter (const gsl_linalg_mixed_workspace * w)
+{
+  return w->niter;
+}
+
+/* 1 if the factorization is in double precision */
+int
+gsl_linalg_mixed_fallback (const gsl_linalg_mixed_workspace * w)
+{
+  return w->fallback;
+}
+
+/*
+mixed_decomp()
+  Compute the single precision factorization of A and estimate its
+reciprocal condition number; factor A in double precision if the
+single precision factorization fails or is too ill-conditioned
+
+Inputs: A    - N-by-N matrix
+        chol - 1 for Cholesky, 0 for LU
+        w    - workspace
+*/
+
+static int
+mixed_decomp (const gsl_matrix * A, const int chol, gsl_linalg_mixed_workspace * w)
+{
+  const size_t N = w->N;
+
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != N)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      int status;
+      double anorm1, ainvnorm;
+
+      w->chol = chol;
+      w->fallback = 0;
+      w->niter = 0;
+      w->rcond = 0.0;
+
+      mixed_norms (A, chol, w->work, &anorm1, &w->anorm);
+
+      status = mixed_convert (A, w->LUf);
+
+      if (status == GSL_SUCCESS)
+        {
+          if (chol)
+            status = cholesky_float_L3 (w->LUf);
+          else
+            status = LU_float_L3 (w->LUf, w->ipiv);
+        }
+
+      if (status == GSL_SUCCESS && anorm1 > 0.0)
+        {
+          status = gsl_linalg_invnorm1 (N, mixed_solve_float, w, &ainvnorm, w->work);
+
+          if (status == GSL_SUCCESS && ainvnorm > 0.0 && gsl_finite (ainvnorm))
+            w->rcond = (1.0 / anorm1) / ainvnorm;
+        }
+
+      if (status || !(w->rcond >= MIXED_RCOND_MIN))
+        return mixed_fallback (A, w);
+
+      return GSL_SUCCESS;
+    }
+}
+
+static int
+mixed_solve (const gsl_matrix * A, const int chol, const gsl_vector * b,
+             gsl_vector * x, gsl_linalg_mixed_workspace * w)
+{
+  const size_t N = w->N;
+
+  if (w->chol != chol)
+    {
+      GSL_ERROR ("workspace does not hold a factorization of this type", GSL_EINVAL);
+    }
+  else if (A->size1 != N || A->size2 != N)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else if (b->size != N)
+    {
+      GSL_ERROR ("matrix size must match b size", GSL_EBADLEN);
+    }
+  else if (x->size != N)
+    {
+      GSL_ERROR ("matrix size must match solution size", GSL_EBADLEN);
+    }
+  else
+    {
+      const double tol = w->anorm * GSL_DBL_EPSILON * sqrt ((double) N);
+      gsl_vector_view r = gsl_vector_subvector (w->work, 0, N);
+      size_t iter;
+      int status;
+
+      w->niter = 0;
+
+      if (!w->fallback)
+        {
+          gsl_vector_memcpy (x, b);
+          status = mixed_solve_float (CblasNoTrans, x, w);
+
+          for (iter = 0; status == GSL_SUCCESS && iter <= MIXED_MAXITER; ++iter)
+            {
+              /* r = b - A x */
+              gsl_vector_memcpy (&r.vector, b);
+
+              if (chol)
+                gsl_blas_dsymv (CblasLower, -1.0, A, x, 1.0, &r.vector);
+              else
+                gsl_blas_dgemv (CblasNoTrans, -1.0, A, x, 1.0, &r.vector);
+
+              if (norminf (&r.vector) <= norminf (x) * tol)
+                {
+                  w->niter = iter;
+                  return GSL_SUCCESS;
+                }
+
+              if (iter == MIXED_MAXITER)
+                break;
+
+              /* x := x + A_f^{-1} r */
+              status = mixed_solve_float (CblasNoTrans, &r.vector, w);
+              gsl_vector_add (x, &r.vector);
+            }
+
+          /* no convergence: factor A in double precision */
+          status = mixed_fallback (A, w);
+          if (status)
+            return status;
+        }
+
+      if (chol)
+        return gsl_linalg_cholesky_solve (w->LU, b, x);
+      else
+        return gsl_linalg_LU_solve (w->LU, w->p, b, x);
+    }
+}
+
+/* factor A in double precision in w->LU */
+static int
+mixed_fallback (const gsl_matrix * A, gsl_linalg_mixed_workspace * w)
+{
+  int signum;
+
+  if (w->LU == NULL)
+    {
+      w->LU = gsl_matrix_alloc (w->N, w->N);
+      if (w->LU == NULL)
+        {
+          GSL_ERROR ("failed to allocate double precision factor", GSL_ENOMEM);
+        }
+    }
+
+  w->fallback = 1;
+  gsl_matrix_memcpy (w->LU, A);
+
+  if (w->chol)
+    return gsl_linalg_cholesky_decomp1 (w->LU);
+  else
+    return gsl_linalg_LU_decomp (w->LU, w->p, &signum);
+}
+
+/*
+mixed_solve_float()
+  x := A_f^{-1} x or x := A_f^{-T} x using the single precision
+factorization. x is scaled by 1/||x||_inf before it is rounded to
+single precision, to avoid underflow of small residuals.
+
+Return: success, or GSL_EDOM if the solution is not finite
+*/
+
+static int
+mixed_solve_float (CBLAS_TRANSPOSE_t TransA, gsl_vector * x, void * params)
+{
+  gsl_linalg_mixed_workspace * w = (gsl_linalg_mixed_workspace *) params;
+  gsl_vector_float * xf = w->workf;
+  const size_t N = w->N;
+  const double xnorm = norminf (x);
+  size_t i;
+
+  if (xnorm == 0.0)
+    return GSL_SUCCESS;
+
+  for (i = 0; i < N; ++i)
+    gsl_vector_float_set (xf, i, (float) (gsl_vector_get (x, i) / xnorm));
+
+  if (w->chol)
+    {
+      /* A = L L^T */
+      gsl_blas_strsv (CblasLower, CblasNoTrans, CblasNonUnit, w->LUf, xf);
+      gsl_blas_strsv (CblasLower, CblasTrans, CblasNonUnit, w->LUf, xf);
+    }
+  else if (TransA == CblasNoTrans)
+    {
+      /* P A = L U */
+      for (i = 0; i < N; ++i)
+        {
+          size_t pi = gsl_vector_uint_get (w->ipiv, i);
+          if (pi != i)
+            gsl_vector_float_swap_elements (xf, i, pi);
+        }
+
+      gsl_blas_strsv (CblasLower, CblasNoTrans, CblasUnit, w->LUf, xf);
+      gsl_blas_strsv (CblasUpper, CblasNoTrans, CblasNonUnit, w->LUf, xf);
+    }
+  else
+    {
+      /* A^T = U^T L^T P */
+      gsl_blas_strsv (CblasUpper, CblasTrans, CblasNonUnit, w->LUf, xf);
+      gsl_blas_strsv (CblasLower, CblasTrans, CblasUnit, w->LUf, xf);
+
+      for (i = N; i-- > 0; )
+        {
+          size_t pi = gsl_vector_uint_get (w->ipiv, i);
+          if (pi != i)
+            gsl_vector_float_swap_elements (xf, i, pi);
+        }
+    }
+
+  for (i = 0; i < N; ++i)
+    {
+      double xi = xnorm * gsl_vector_float_get (xf, i);
+
+      if (!gsl_finite (xi))
+        return GSL_EDOM;
+
+      gsl_vector_set (x, i, xi);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* Af := A rounded to single precision; GSL_EOVRFLW if out of range */
+static int
+mixed_convert (const gsl_matrix * A, gsl_matrix_float * Af)
+{
+  const size_t N = A->size1;
+  size_t i, j;
+
+  for (i = 0; i < N; ++i)
+    {
+      const double * a = gsl_matrix_const_ptr (A, i, 0);
+      float * af = gsl_matrix_float_ptr (Af, i, 0);
+
+      for (j = 0; j < N; ++j)
+        {
+          if (fabs (a[j]) > GSL_FLT_MAX)
+            return GSL_EOVRFLW;
+
+          af[j] = (float) a[j];
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+static double
+norminf (const gsl_vector * v)
+{
+  return fabs (gsl_vector_get (v, gsl_blas_idamax (v)));
+}
+
+/* compute ||A||_1 and ||A||_inf; if chol, A is symmetric and stored in
+   its lower triangle */
+static void
+mixed_norms (const gsl_matrix * A, const int chol, gsl_vector * work,
+             double * norm1, double * norminf)
+{
+  const size_t N = A->size1;
+  gsl_vector_view colsum = gsl_vector_subvector (work, 0, N);
+  double rowmax = 0.0;
+  size_t i, j;
+
+  gsl_vector_set_zero (&colsum.vector);
+
+  for (i = 0; i < N; ++i)
+    {
+      const size_t n = chol ? i + 1 : N;
+      const double * a = gsl_matrix_const_ptr (A, i, 0);
+      double rowsum = 0.0;
+
+      for (j = 0; j < n; ++j)
+        {
+          const double aij = fabs (a[j]);
+
+          rowsum += aij;
+          *gsl_vector_ptr (&colsum.vector, j) += aij;
+
+          /* symmetric element above the diagonal */
+          if (chol && j < i)
+            *gsl_vector_ptr (&colsum.vector, i) += aij;
+        }
+
+      rowmax = GSL_MAX (rowmax, rowsum);
+    }
+
+  *norm1 = gsl_vector_max (&colsum.vector);
+  *norminf = chol ? *norm1 : rowmax;
+}
+
+/* single precision version of LU_decomp_L2 in lu.c */
+static int
+LU_float_L2 (gsl_matrix_float * A, gsl_vector_uint * ipiv)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  size_t j;
+
+  for (j = 0; j < N; ++j)
+    {
+      gsl_vector_float_view v = gsl_matrix_float_subcolumn (A, j, j, M - j);
+      size_t j_pivot = j + gsl_blas_isamax (&v.vector);
+      gsl_vector_float_view v1, v2;
+      float Ajj;
+
+      gsl_vector_uint_set (ipiv, j, j_pivot);
+
+      if (j_pivot != j)
+        {
+          v1 = gsl_matrix_float_row (A, j);
+          v2 = gsl_matrix_float_row (A, j_pivot);
+          gsl_blas_sswap (&v1.vector, &v2.vector);
+        }
+
+      Ajj = gsl_matrix_float_get (A, j, j);
+
+      if (Ajj == 0.0f)
+        return GSL_EDOM; /* singular in single precision */
+
+      if (j < M - 1)
+        {
+          v1 = gsl_matrix_float_subcolumn (A, j, j + 1, M - j - 1);
+          gsl_blas_sscal (1.0f / Ajj, &v1.vector);
+        }
+
+      if (j < N - 1)
+        {
+          gsl_matrix_float_view A22 = gsl_matrix_float_submatrix (A, j + 1, j + 1, M - j - 1, N - j - 1);
+          v1 = gsl_matrix_float_subcolumn (A, j, j + 1, M - j - 1);
+          v2 = gsl_matrix_float_subrow (A, j, j + 1, N - j - 1);
+
+          gsl_blas_sger (-1.0f, &v1.vector, &v2.vector, &A22.matrix);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* single precision version of LU_decomp_L3 in lu.c, for M >= N */
+static int
+LU_float_L3 (gsl_matrix_float * A, gsl_vector_uint * ipiv)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+
+  if (N <= CROSSOVER_LU)
+    {
+      return LU_float_L2 (A, ipiv);
+    }
+  else
+    {
+      int status;
+      const size_t N1 = GSL_LINALG_SPLIT (N);
+      const size_t N2 = N - N1;
+      const size_t M2 = M - N1;
+      gsl_matrix_float_view A11 = gsl_matrix_float_submatrix (A, 0, 0, N1, N1);
+      gsl_matrix_float_view A12 = gsl_matrix_float_submatrix (A, 0, N1, N1, N2);
+      gsl_matrix_float_view A21 = gsl_matrix_float_submatrix (A, N1, 0, M2, N1);
+      gsl_matrix_float_view A22 = gsl_matrix_float_submatrix (A, N1, N1, M2, N2);
+      gsl_matrix_float_view AL = gsl_matrix_float_submatrix (A, 0, 0, M, N1);
+      gsl_matrix_float_view AR = gsl_matrix_float_submatrix (A, 0, N1, M, N2);
+      gsl_vector_uint_view ipiv1 = gsl_vector_uint_subvector (ipiv, 0, N1);
+      gsl_vector_uint_view ipiv2 = gsl_vector_uint_subvector (ipiv, N1, N2);
+      size_t i;
+
+      status = LU_float_L3 (&AL.matrix, &ipiv1.vector);
+      if (status)
+        return status;
+
+      apply_pivots_float (&AR.matrix, &ipiv1.vector);
+
+      /* A12 = A11^{-1} A12, A22 = A22 - A21 * A12 */
+      gsl_blas_strsm (CblasLeft, CblasLower, CblasNoTrans, CblasUnit, 1.0f, &A11.matrix, &A12.matrix);
+      gsl_blas_sgemm (CblasNoTrans, CblasNoTrans, -1.0f, &A21.matrix, &A12.matrix, 1.0f, &A22.matrix);
+
+      status = LU_float_L3 (&A22.matrix, &ipiv2.vector);
+      if (status)
+        return status;
+
+      apply_pivots_float (&A21.matrix, &ipiv2.vector);
+
+      for (i = 0; i < N2; ++i)
+        {
+          unsigned int * ptr = gsl_vector_uint_ptr (&ipiv2.vector, i);
+          *ptr += N1;
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+static void
+apply_pivots_float (gsl_matrix_float * A, const gsl_vector_uint * ipiv)
+{
+  size_t i;
+
+  for (i = 0; i < ipiv->size; ++i)
+    {
+      size_t pi = gsl_vector_uint_get (ipiv, i);
+
+      if (i != pi)
+        {
+          gsl_vector_float_view v1 = gsl_matrix_float_row (A, i);
+          gsl_vector_float_view v2 = gsl_matrix_float_row (A, pi);
+          gsl_blas_sswap (&v1.vector, &v2.vector);
+        }
+    }
+}
+
+/* single precision version of cholesky_decomp_L2 in cholesky.c */
+static int
+cholesky_float_L2 (gsl_matrix_float * A)
+{
+  const size_t N = A->size1;
+  size_t j;
+
+  for (j = 0; j < N; ++j)
+    {
+      float ajj;
+      gsl_vector_float_view v = gsl_matrix_float_subcolumn (A, j, j, N - j);
+
+      if (j > 0)
+        {
+          gsl_vector_float_view w = gsl_matrix_float_subrow (A, j, 0, j);
+          gsl_matrix_float_view m = gsl_matrix_float_submatrix (A, j, 0, N - j, j);
+
+          gsl_blas_sgemv (CblasNoTrans, -1.0f, &m.matrix, &w.vector, 1.0f, &v.vector);
+        }
+
+      ajj = gsl_matrix_float_get (A, j, j);
+
+      if (ajj <= 0.0f)
+        return GSL_EDOM;
+
+      ajj = (float) sqrt (ajj);
+      gsl_blas_sscal (1.0f / ajj, &v.vector);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* single precision version of cholesky_decomp_L3 in cholesky.c */
+static int
+cholesky_float_L3 (gsl_matrix_float * A)
+{
+  const size_t N = A->size1;
+
+  if (N <= CROSSOVER_CHOLESKY)
+    {
+      return cholesky_float_L2 (A);
+    }
+  else
+    {
+      int status;
+      const size_t N1 = GSL_LINALG_SPLIT (N);
+      const size_t N2 = N - N1;
+      gsl_matrix_float_view A11 = gsl_matrix_float_submatrix (A, 0, 0, N1, N1);
+      gsl_matrix_float_view A21 = gsl_matrix_float_submatrix (A, N1, 0, N2, N1);
+      gsl_matrix_float_view A22 = gsl_matrix_float_submatrix (A, N1, N1, N2, N2);
+
+      status = cholesky_float_L3 (&A11.matrix);
+      if (status)
+        return status;
+
+      /* A21 = A21 * L11^{-T}, A22 -= L21 L21^T */
+      gsl_blas_strsm (CblasRight, CblasLower, CblasTrans, CblasNonUnit, 1.0f, &A11.matrix, &A21.matrix);
+      gsl_blas_ssyrk (CblasLower, CblasNoTrans, -1.0f, &A21.matrix, 1.0f, &A22.matrix);
+
+      return cholesky_float_L3 (&A22.matrix);
+    }
+}
@@ -0,0 +1,421 @@
+/* linalg/qr_tsqr.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_errno.h>
+
+#include "../sys/thread_pool.h"
+
+/*
+ * this module contains routines for the QR factorization of a tall
+ * and skinny matrix using the TSQR algorithm of
+ *
+ * Demmel, J., Grigori, L., Hoemmen, M. and Langou, J., 2012.
+ *   Communication-optimal parallel and sequential QR and LU
+ *   factorizations. SIAM Journal on Scientific Computing, 34(1).
+ *
+ * with the Householder reconstruction of
+ *
+ * Ballard, G., Demmel, J., Grigori, L., Jacquelin, M., Nguyen, H.D.
+ *   and Solomonik, E., 2014. Reconstructing Householder vectors from
+ *   tall-skinny QR. IPDPS 2014, pp. 1159-1170.
+ */
+
+/* minimum number of rows in a leaf block; the number of rows of the
+   leaves depends only on the dimensions of A, so the result does not
+   depend on the number of threads */
+#define TSQR_ROWS 2048
+
+/* leaves have at least TSQR_RATIO * N rows */
+#define TSQR_RATIO 8
+
+typedef struct
+{
+  gsl_matrix *A;
+  size_t N;
+  size_t nleaf;
+  size_t mb;            /* rows in a leaf, the last leaf takes the remainder */
+  size_t stride;        /* distance between merged nodes at current level */
+  gsl_matrix *TL;       /* leaf T factors, then -Q(1:N,:) of the leaves */
+  gsl_matrix *R;        /* R factors of the tree nodes, then V~ of the merges */
+  gsl_matrix *TN;       /* T factors of the merges, then leaf W matrices */
+  gsl_matrix *C;        /* leaf blocks of Q [I; 0] */
+} tsqr_state;
+
+static gsl_matrix_view tsqr_leaf (tsqr_state * s, const size_t i);
+static gsl_matrix_view tsqr_block (gsl_matrix * B, const size_t i, const size_t N);
+static void tsqr_task_factor (void * arg, const size_t i);
+static void tsqr_task_merge (void * arg, const size_t k);
+static void tsqr_task_apply (void * arg, const size_t k);
+static void tsqr_task_leafQ (void * arg, const size_t i);
+static void tsqr_task_leafV (void * arg, const size_t i);
+static void tsqr_signLU (gsl_matrix * B, gsl_vector * sgn);
+
+/*
+gsl_linalg_QR_decomp_tsqr()
+  QR decomposition of a tall and skinny matrix with the parallel TSQR
+algorithm
+
+Inputs: A    - matrix to be factored, M-by-N with M >= N
+        T    - N-by-N upper triangular factor of block reflector
+        pool - thread pool, or NULL to run in the calling thread
+
+Return: success/error
+
+Notes:
+1) the output has the same format as gsl_linalg_QR_decomp_r(): the
+upper triangle of A contains R, the elements below the diagonal are the
+columns of V, and
+
+Q = I - V T V^T
+
+so the result may be passed to gsl_linalg_QR_lssolve_r(),
+gsl_linalg_QR_QTvec_r(), gsl_linalg_QR_unpack_r() etc.
+
+2) the rows of A are divided into blocks of at least
+max(TSQR_ROWS, TSQR_RATIO*N) rows, which are factored independently with
+gsl_linalg_QR_decomp_r(). The R factors are merged pairwise in a binary
+tree with gsl_linalg_QR_TR_decomp(). If A has fewer than two blocks,
+gsl_linalg_QR_decomp_r() is called directly.
+
+3) the Householder vectors of the whole matrix are then reconstructed
+from the explicit Q factor of the tree: with S = diag(s_i), the LU
+factorization
+
+[S; 0] - Q = L U
+
+computed without pivoting and with s_i = sign of the i-th pivot, has
+L = V and T = U S L_1^{-T}, and the R factor is S R (Ballard et al).
+The diagonal elements of U have magnitude at least 1.
+
+4) the blocks and the merges of one level of the tree are processed in
+parallel on the threads of the pool. The result does not depend on the
+number of threads.
+*/
+
+int
+gsl_linalg_QR_decomp_tsqr (gsl_matrix * A, gsl_matrix * T, gsl_thread_pool * pool)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+
+  if (M < N)
+    {
+      GSL_ERROR ("M must be >= N", GSL_EBADLEN);
+    }
+  else if (T->size1 != T->size2)
+    {
+      GSL_ERROR ("T matrix must be square", GSL_ENOTSQR);
+    }
+  else if (T->size1 != N)
+    {
+      GSL_ERROR ("T matrix does not match dimensions of A", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t mb = GSL_MAX (TSQR_ROWS, TSQR_RATIO * N);
+      const size_t nleaf = M / mb;
+      tsqr_state state;
+      gsl_vector *sgn;
+      gsl_matrix_view Q1, R, V1;
+      size_t stride, i, j;
+
+      if (nleaf < 2)
+        return gsl_linalg_QR_decomp_r (A, T);
+
+      state.A = A;
+      state.N = N;
+      state.nleaf = nleaf;
+      state.mb = mb;
+      state.TL = gsl_matrix_alloc (nleaf * N, N);
+      state.R = gsl_matrix_alloc (nleaf * N, N);
+      state.TN = gsl_matrix_alloc (nleaf * N, N);
+      state.C = gsl_matrix_alloc (nleaf * N, N);
+      sgn = gsl_vector_alloc (N);
+
+      if (state.TL == NULL || state.R == NULL || state.TN == NULL ||
+          state.C == NULL || sgn == NULL)
+        {
+          if (state.TL)
+            gsl_matrix_free (state.TL);
+          if (state.R)
+            gsl_matrix_free (state.R);
+          if (state.TN)
+            gsl_matrix_free (state.TN);
+          if (state.C)
+            gsl_matrix_free (state.C);
+          if (sgn)
+            gsl_vector_free (sgn);
+
+          GSL_ERROR ("failed to allocate TSQR workspace", GSL_ENOMEM);
+        }
+
+      /* factor the leaves: A_i = Q_i R_i */
+      thread_pool_run (pool, nleaf, tsqr_task_factor, &state);
+
+      /* merge the R factors up the tree; R_0 becomes the R factor of A */
+      for (stride = 1; stride < nleaf; stride *= 2)
+        {
+          state.stride = stride;
+          thread_pool_run (pool, (nleaf - stride + 2 * stride - 1) / (2 * stride),
+                           tsqr_task_merge, &state);
+        }
+
+      /* apply the tree to [I; 0] down to the leaves */
+      gsl_matrix_set_zero (state.C);
+      Q1 = tsqr_block (state.C, 0, N);
+      gsl_matrix_set_identity (&Q1.matrix);
+
+      while (stride > 1)
+        {
+          stride /= 2;
+          state.stride = stride;
+          thread_pool_run (pool, (nleaf - stride + 2 * stride - 1) / (2 * stride),
+                           tsqr_task_apply, &state);
+        }
+
+      /* leaf W matrices and -Q(1:N,:) of each leaf */
+      thread_pool_run (pool, nleaf, tsqr_task_leafQ, &state);
+
+      /* S - Q_1 = L_1 U */
+      Q1 = tsqr_block (state.TL, 0, N);
+      tsqr_signLU (&Q1.matrix, sgn);
+
+      /* V in the rows of A below the first N */
+      thread_pool_run (pool, nleaf, tsqr_task_leafV, &state);
+
+      /* T = U S L_1^{-T} */
+      gsl_matrix_set_zero (T);
+      gsl_matrix_tricpy (CblasUpper, CblasNonUnit, T, &Q1.matrix);
+
+      for (j = 0; j < N; j++)
+        {
+          gsl_vector_view c = gsl_matrix_column (T, j);
+          gsl_vector_scale (&c.vector, gsl_vector_get (sgn, j));
+        }
+
+      gsl_blas_dtrsm (CblasRight, CblasLower, CblasTrans, CblasUnit, 1.0, &Q1.matrix, T);
+
+      /* R = S R_0 in the upper triangle of A, L_1 below it */
+      R = tsqr_block (state.R, 0, N);
+      V1 = gsl_matrix_submatrix (A, 0, 0, N, N);
+
+      for (i = 0; i < N; i++)
+        {
+          const double si = gsl_vector_get (sgn, i);
+
+          for (j = 0; j < i; j++)
+            {
+              gsl_matrix_set (T, i, j, 0.0);
+              gsl_matrix_set (&V1.matrix, i, j, gsl_matrix_get (&Q1.matrix, i, j));
+            }
+
+          for (j = i; j < N; j++)
+            gsl_matrix_set (&V1.matrix, i, j, si * gsl_matrix_get (&R.matrix, i, j));
+        }
+
+      gsl_matrix_free (state.TL);
+      gsl_matrix_free (state.R);
+      gsl_matrix_free (state.TN);
+      gsl_matrix_free (state.C);
+      gsl_vector_free (sgn);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* rows of leaf i of A */
+static gsl_matrix_view
+tsqr_leaf (tsqr_state * s, const size_t i)
+{
+  const size_t M = s->A->size1;
+  const size_t r0 = i * s->mb;
+  const size_t m = (i == s->nleaf - 1) ? M - r0 : s->mb;
+
+  return gsl_matrix_submatrix (s->A, r0, 0, m, s->N);
+}
+
+/* block i of a stack of N-by-N matrices */
+static gsl_matrix_view
+tsqr_block (gsl_matrix * B, const size_t i, const size_t N)
+{
+  return gsl_matrix_submatrix (B, i * N, 0, N, N);
+}
+
+/* A_i = Q_i R_i, with R_i copied to the tree */
+static void
+tsqr_task_factor (void * arg, const size_t i)
+{
+  tsqr_state *s = (tsqr_state *) arg;
+  gsl_matrix_view Ai = tsqr_leaf (s, i);
+  gsl_matrix_view Ti = tsqr_block (s->TL, i, s->N);
+  gsl_matrix_view Ri = tsqr_block (s->R, i, s->N);
+  gsl_matrix_view Ai1 = gsl_matrix_submatrix (&Ai.matrix, 0, 0, s->N, s->N);
+
+  gsl_linalg_QR_decomp_r (&Ai.matrix, &Ti.matrix);
+
+  gsl_matrix_set_zero (&Ri.matrix);
+  gsl_matrix_tricpy (CblasUpper, CblasNonUnit, &Ri.matrix, &Ai1.matrix);
+}
+
+/*
+ * [ R_i ] = Q_node [ R ],  Q_node = I - [ I  ] T_j [ I  ]^T
+ * [ R_j ]          [ 0 ]                [ V~ ]     [ V~ ]
+ *
+ * with j = i + stride; R is stored in R_i, V~ in R_j and T_j in TN
+ */
+static void
+tsqr_task_merge (void * arg, const size_t k)
+{
+  tsqr_state *s = (tsqr_state *) arg;
+  const size_t i = 2 * s->stride * k;
+  const size_t j = i + s->stride;
+  gsl_matrix_view Ri = tsqr_block (s->R, i, s->N);
+  gsl_matrix_view Rj = tsqr_block (s->R, j, s->N);
+  gsl_matrix_view Tj = tsqr_block (s->TN, j, s->N);
+
+  gsl_linalg_QR_TR_decomp (&Ri.matrix, &Rj.matrix, &Tj.matrix);
+}
+
+/*
+ * [ C_i ] := Q_node [ C_i ] = [ C_i - W ],  W = T_j C_i
+ * [ C_j ]           [  0  ]   [  -V~ W  ]
+ */
+static void
+tsqr_task_apply (void * arg, const size_t k)
+{
+  tsqr_state *s = (tsqr_state *) arg;
+  const size_t i = 2 * s->stride * k;
+  const size_t j = i + s->stride;
+  gsl_matrix_view Ci = tsqr_block (s->C, i, s->N);
+  gsl_matrix_view Cj = tsqr_block (s->C, j, s->N);
+  gsl_matrix_view Vj = tsqr_block (s->R, j, s->N);
+  gsl_matrix_view Tj = tsqr_block (s->TN, j, s->N);
+
+  gsl_matrix_memcpy (&Cj.matrix, &Ci.matrix);
+  gsl_blas_dtrmm (CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0, &Tj.matrix, &Cj.matrix); /* W := T_j C_i */
+  gsl_matrix_sub (&Ci.matrix, &Cj.matrix);                                                       /* C_i := C_i - W */
+  gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, -1.0, &Vj.matrix, &Cj.matrix, 0.0, &Tj.matrix);  /* T_j := -V~ W */
+  gsl_matrix_memcpy (&Cj.matrix, &Tj.matrix);
+}
+
+/*
+ * the rows of Q belonging to leaf i are
+ *
+ * Q_i [ C_i ] = [ C_i ] - V_i W_i,  W_i = T_i V_i1^T C_i
+ *     [  0  ]   [  0  ]
+ *
+ * store W_i in TN and -Q_i(1:N,:) = V_i1 W_i - C_i in TL
+ */
+static void
+tsqr_task_leafQ (void * arg, const size_t i)
+{
+  tsqr_state *s = (tsqr_state *) arg;
+  gsl_matrix_view Ai = tsqr_leaf (s, i);
+  gsl_matrix_view V1 = gsl_matrix_submatrix (&Ai.matrix, 0, 0, s->N, s->N);
+  gsl_matrix_view Ci = tsqr_block (s->C, i, s->N);
+  gsl_matrix_view Ti = tsqr_block (s->TL, i, s->N);
+  gsl_matrix_view Wi = tsqr_block (s->TN, i, s->N);
+
+  gsl_matrix_memcpy (&Wi.matrix, &Ci.matrix);
+  gsl_blas_dtrmm (CblasLeft, CblasLower, CblasTrans, CblasUnit, 1.0, &V1.matrix, &Wi.matrix);
+  gsl_blas_dtrmm (CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0, &Ti.matrix, &Wi.matrix);
+
+  gsl_matrix_memcpy (&Ti.matrix, &Wi.matrix);
+  gsl_blas_dtrmm (CblasLeft, CblasLower, CblasNoTrans, CblasUnit, 1.0, &V1.matrix, &Ti.matrix);
+  gsl_matrix_sub (&Ti.matrix, &Ci.matrix);
+}
+
+/*
+ * rows of L = -Q U^{-1} in leaf i; below the first N rows of the leaf
+ * these are V_i2 W_i U^{-1}, computed in blocks of N rows using C_i as
+ * workspace. For i > 0 the first N rows are -Q_i(1:N,:) U^{-1}
+ */
+static void
+tsqr_task_leafV (void * arg, const size_t i)
+{
+  tsqr_state *s = (tsqr_state *) arg;
+  const size_t N = s->N;
+  gsl_matrix_view Ai = tsqr_leaf (s, i);
+  gsl_matrix_view U = tsqr_block (s->TL, 0, N);
+  gsl_matrix_view Wi = tsqr_block (s->TN, i, N);
+  gsl_matrix_view work = tsqr_block (s->C, i, N);
+  const size_t m = Ai.matrix.size1;
+  size_t r;
+
+  /* G_i = W_i U^{-1} */
+  gsl_blas_dtrsm (CblasRight, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0, &U.matrix, &Wi.matrix);
+
+  for (r = N; r < m; r += N)
+    {
+      const size_t nr = GSL_MIN (N, m - r);
+      gsl_matrix_view Ar = gsl_matrix_submatrix (&Ai.matrix, r, 0, nr, N);
+      gsl_matrix_view Br = gsl_matrix_submatrix (&work.matrix, 0, 0, nr, N);
+
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &Ar.matrix, &Wi.matrix, 0.0, &Br.matrix);
+      gsl_matrix_memcpy (&Ar.matrix, &Br.matrix);
+    }
+
+  if (i > 0)
+    {
+      gsl_matrix_view Q1 = tsqr_block (s->TL, i, N);
+      gsl_matrix_view A1 = gsl_matrix_submatrix (&Ai.matrix, 0, 0, N, N);
+
+      gsl_blas_dtrsm (CblasRight, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0, &U.matrix, &Q1.matrix);
+      gsl_matrix_memcpy (&A1.matrix, &Q1.matrix);
+    }
+}
+
+/*
+ * LU factorization without pivoting of S + B, where S = diag(s_i) and
+ * s_i = sign of the i-th pivot before s_i is added, so each pivot has
+ * magnitude at least 1. On output B contains L (unit diagonal not
+ * stored) and U, and sgn contains s_i
+ */
+static void
+tsqr_signLU (gsl_matrix * B, gsl_vector * sgn)
+{
+  const size_t N = B->size1;
+  size_t i;
+
+  for (i = 0; i < N; i++)
+    {
+      double *Bii = gsl_matrix_ptr (B, i, i);
+      const double si = (*Bii >= 0.0) ? 1.0 : -1.0;
+
+      gsl_vector_set (sgn, i, si);
+      *Bii += si;
+
+      if (i < N - 1)
+        {
+          gsl_vector_view l = gsl_matrix_subcolumn (B, i, i + 1, N - i - 1);
+          gsl_vector_view u = gsl_matrix_subrow (B, i, i + 1, N - i - 1);
+          gsl_matrix_view B22 = gsl_matrix_submatrix (B, i + 1, i + 1, N - i - 1, N - i - 1);
+
+          gsl_vector_scale (&l.vector, 1.0 / *Bii);
+          gsl_blas_dger (-1.0, &l.vector, &u.vector, &B22.matrix);
+        }
+    }
+}
@@ -8,3 +8,6 @@
 #define CROSSOVER_CHOLESKY     CROSSOVER
 #define CROSSOVER_INVTRI       CROSSOVER
 #define CROSSOVER_TRIMULT      CROSSOVER
+
+/* tile size of the task graph factorizations */
+#define TILE_NB                256
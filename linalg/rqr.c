@@ -382,6 +382,68 @@ gsl_linalg_QR_unpack_r(const gsl_matrix * QR, const gsl_matrix * T, gsl_matrix *
     }
 }
 
+/*
+gsl_linalg_QR_Q1_r()
+  Unpack the first N columns of Q
+
+Inputs: QR - packed QR format, M-by-N
+        T  - block reflector matrix, N-by-N
+        Q1 - (output) Q_1 matrix, M-by-N
+
+Return: success/error
+
+Notes:
+1) Q1 has orthonormal columns spanning the range of the original
+matrix; only O(M N^2) operations and no M-by-M storage are needed
+
+2) Q1 may be the same matrix as QR, in which case R is destroyed
+*/
+
+int
+gsl_linalg_QR_Q1_r(const gsl_matrix * QR, const gsl_matrix * T, gsl_matrix * Q1)
+{
+  const size_t M = QR->size1;
+  const size_t N = QR->size2;
+
+  if (M < N)
+    {
+      GSL_ERROR ("M must be >= N", GSL_EBADLEN);
+    }
+  else if (Q1->size1 != M || Q1->size2 != N)
+    {
+      GSL_ERROR ("Q1 matrix must be M-by-N", GSL_EBADLEN);
+    }
+  else if (T->size1 != N || T->size2 != N)
+    {
+      GSL_ERROR ("T matrix must be N-by-N", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_matrix_const_view V1 = gsl_matrix_const_submatrix(QR, 0, 0, N, N);
+      gsl_matrix_view m = gsl_matrix_submatrix(Q1, 0, 0, N, N);
+
+      /*
+       * set Q1 = [ T ]
+       *          [ V ]
+       */
+      if (Q1 != QR)
+        {
+          gsl_matrix_tricpy(CblasLower, CblasUnit, &m.matrix, &V1.matrix);
+
+          if (M > N)
+            {
+              gsl_matrix_const_view V2 = gsl_matrix_const_submatrix(QR, N, 0, M - N, N);
+              gsl_matrix_view Q2 = gsl_matrix_submatrix(Q1, N, 0, M - N, N);
+              gsl_matrix_memcpy(&Q2.matrix, &V2.matrix);
+            }
+        }
+
+      gsl_matrix_tricpy(CblasUpper, CblasNonUnit, &m.matrix, T);
+
+      return unpack_Q1(Q1);
+    }
+}
+
 /*
 gsl_linalg_QR_QTvec_r()
   Apply M-by-M Q^T to the M-by-1 vector b
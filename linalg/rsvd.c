@@ -0,0 +1,401 @@
+/* linalg/rsvd.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Randomized low-rank SVD of an M-by-N matrix A, following Halko,
+ * Martinsson and Tropp, "Finding structure with randomness", SIAM
+ * Review 53 (2011), algorithms 4.4 and 5.1:
+ *
+ * 1. Draw an N-by-l Gaussian matrix Omega, l = k + p
+ * 2. Q = orth(A Omega), followed by q power iterations
+ *    Q = orth(A orth(A^T Q)), which sharpen the decay of the spectrum
+ *    seen by the sketch
+ * 3. Z = A^T Q = B^T, N-by-l, and the small SVD Z = U_Z S V_Z^T
+ * 4. A ~ Q B = (Q V_Z) S U_Z^T, so U = Q V_Z, V = U_Z
+ *
+ * A is only accessed through products A X and A^T X, with either a
+ * gsl_matrix (Level 3 BLAS) or a user function computing one
+ * matrix-vector product at a time, so that the matrix may be sparse or
+ * never stored. The cost is O(M N l) for the 2q + 2 products and
+ * O((M + N) l^2) for the orthogonalizations and the small SVD.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_linalg.h>
+
+/* the operator A, either a matrix or a matrix-vector product */
+typedef struct
+{
+  const gsl_matrix * A;
+  int (* matvec)(CBLAS_TRANSPOSE_t TransA, const gsl_vector * x, gsl_vector * y, void * params);
+  void * params;
+} rsvd_op;
+
+static int rsvd_range (const rsvd_op * op, const size_t q, gsl_rng * r,
+                       gsl_matrix * Q, gsl_linalg_rsvd_workspace * w);
+static int rsvd_decomp (const rsvd_op * op, const size_t q, gsl_rng * r,
+                        gsl_matrix * U, gsl_vector * S, gsl_matrix * V,
+                        gsl_linalg_rsvd_workspace * w);
+static int rsvd_apply (const rsvd_op * op, CBLAS_TRANSPOSE_t TransA,
+                       const gsl_matrix * X, gsl_matrix * Y);
+static int rsvd_orth (gsl_matrix * Y, gsl_matrix * T);
+
+/*
+gsl_linalg_rsvd_alloc()
+  Allocate a workspace for the randomized SVD
+
+Inputs: M - number of rows of A
+        N - number of columns of A
+        k - rank of the approximation
+        p - oversampling; the sketch has l = k + p columns, and
+            p = 5 to 10 is usually sufficient
+
+Notes:
+1) l must not exceed M or N
+*/
+
+gsl_linalg_rsvd_workspace *
+gsl_linalg_rsvd_alloc (const size_t M, const size_t N, const size_t k, const size_t p)
+{
+  gsl_linalg_rsvd_workspace *w;
+  const size_t l = k + p;
+
+  if (k == 0)
+    {
+      GSL_ERROR_NULL ("rank must be positive", GSL_EINVAL);
+    }
+  else if (l > M || l > N)
+    {
+      GSL_ERROR_NULL ("k + p must not exceed the matrix dimensions", GSL_EBADLEN);
+    }
+
+  w = calloc (1, sizeof (gsl_linalg_rsvd_workspace));
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  w->Q = gsl_matrix_alloc (M, l);
+  w->Z = gsl_matrix_alloc (N, l);
+  w->T = gsl_matrix_alloc (l, l);
+  w->V = gsl_matrix_alloc (l, l);
+  w->S = gsl_vector_alloc (l);
+  w->work = gsl_vector_alloc (l);
+
+  if (w->Q == NULL || w->Z == NULL || w->T == NULL || w->V == NULL ||
+      w->S == NULL || w->work == NULL)
+    {
+      gsl_linalg_rsvd_free (w);
+      GSL_ERROR_NULL ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  w->M = M;
+  w->N = N;
+  w->k = k;
+  w->l = l;
+
+  return w;
+}
+
+void
+gsl_linalg_rsvd_free (gsl_linalg_rsvd_workspace * w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->Q)
+    gsl_matrix_free (w->Q);
+
+  if (w->Z)
+    gsl_matrix_free (w->Z);
+
+  if (w->T)
+    gsl_matrix_free (w->T);
+
+  if (w->V)
+    gsl_matrix_free (w->V);
+
+  if (w->S)
+    gsl_vector_free (w->S);
+
+  if (w->work)
+    gsl_vector_free (w->work);
+
+  free (w);
+}
+
+/*
+gsl_linalg_rsvd_range()
+  Compute an orthonormal basis for the approximate range of A
+
+Inputs: A - M-by-N matrix
+        q - number of power iterations
+        r - random number generator for the sketch
+        Q - (output) M-by-l matrix with orthonormal columns
+        w - workspace
+*/
+
+int
+gsl_linalg_rsvd_range (const gsl_matrix * A, const size_t q, gsl_rng * r,
+                       gsl_matrix * Q, gsl_linalg_rsvd_workspace * w)
+{
+  if (A->size1 != w->M || A->size2 != w->N)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      rsvd_op op;
+
+      op.A = A;
+      op.matvec = NULL;
+      op.params = NULL;
+
+      return rsvd_range (&op, q, r, Q, w);
+    }
+}
+
+/*
+gsl_linalg_rsvd_range_op()
+  Compute an orthonormal basis for the approximate range of an operator
+
+Inputs: matvec - function computing y = A x (TransA = CblasNoTrans)
+                 or y = A^T x (TransA = CblasTrans)
+        params - parameters passed to matvec
+        q      - number of power iterations
+        r      - random number generator for the sketch
+        Q      - (output) M-by-l matrix with orthonormal columns
+        w      - workspace
+*/
+
+int
+gsl_linalg_rsvd_range_op (int (* matvec)(CBLAS_TRANSPOSE_t TransA, const gsl_vector * x, gsl_vector * y, void * params),
+                          void * params, const size_t q, gsl_rng * r,
+                          gsl_matrix * Q, gsl_linalg_rsvd_workspace * w)
+{
+  rsvd_op op;
+
+  op.A = NULL;
+  op.matvec = matvec;
+  op.params = params;
+
+  return rsvd_range (&op, q, r, Q, w);
+}
+
+/*
+gsl_linalg_rsvd_decomp()
+  Compute a rank-k approximation A ~ U diag(S) V^T
+
+Inputs: A - M-by-N matrix, not modified
+        q - number of power iterations
+        r - random number generator for the sketch
+        U - (output) M-by-k left singular vectors
+        S - (output) k largest singular values, in decreasing order
+        V - (output) N-by-k right singular vectors
+        w - workspace
+*/
+
+int
+gsl_linalg_rsvd_decomp (const gsl_matrix * A, const size_t q, gsl_rng * r,
+                        gsl_matrix * U, gsl_vector * S, gsl_matrix * V,
+                        gsl_linalg_rsvd_workspace * w)
+{
+  if (A->size1 != w->M || A->size2 != w->N)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      rsvd_op op;
+
+      op.A = A;
+      op.matvec = NULL;
+      op.params = NULL;
+
+      return rsvd_decomp (&op, q, r, U, S, V, w);
+    }
+}
+
+/*
+gsl_linalg_rsvd_decomp_op()
+  Compute a rank-k approximation A ~ U diag(S) V^T of an operator
+
+Inputs: matvec - function computing y = A x (TransA = CblasNoTrans)
+                 or y = A^T x (TransA = CblasTrans)
+        params - parameters passed to matvec
+        q      - number of power iterations
+        r      - random number generator for the sketch
+        U      - (output) M-by-k left singular vectors
+        S      - (output) k largest singular values, in decreasing order
+        V      - (output) N-by-k right singular vectors
+        w      - workspace
+*/
+
+int
+gsl_linalg_rsvd_decomp_op (int (* matvec)(CBLAS_TRANSPOSE_t TransA, const gsl_vector * x, gsl_vector * y, void * params),
+                           void * params, const size_t q, gsl_rng * r,
+                           gsl_matrix * U, gsl_vector * S, gsl_matrix * V,
+                           gsl_linalg_rsvd_workspace * w)
+{
+  rsvd_op op;
+
+  op.A = NULL;
+  op.matvec = matvec;
+  op.params = params;
+
+  return rsvd_decomp (&op, q, r, U, S, V, w);
+}
+
+static int
+rsvd_range (const rsvd_op * op, const size_t q, gsl_rng * r,
+            gsl_matrix * Q, gsl_linalg_rsvd_workspace * w)
+{
+  if (Q->size1 != w->M || Q->size2 != w->l)
+    {
+      GSL_ERROR ("Q matrix must be M-by-(k+p)", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_matrix * Omega = w->Z;
+      size_t i, j;
+      int status;
+
+      for (i = 0; i < w->N; ++i)
+        {
+          for (j = 0; j < w->l; ++j)
+            gsl_matrix_set (Omega, i, j, gsl_ran_gaussian (r, 1.0));
+        }
+
+      /* Q = orth(A Omega) */
+      status = rsvd_apply (op, CblasNoTrans, Omega, Q);
+      if (status)
+        return status;
+
+      rsvd_orth (Q, w->T);
+
+      for (i = 0; i < q; ++i)
+        {
+          /* Z = orth(A^T Q), Q = orth(A Z) */
+          status = rsvd_apply (op, CblasTrans, Q, w->Z);
+          if (status)
+            return status;
+
+          rsvd_orth (w->Z, w->T);
+
+          status = rsvd_apply (op, CblasNoTrans, w->Z, Q);
+          if (status)
+            return status;
+
+          rsvd_orth (Q, w->T);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+static int
+rsvd_decomp (const rsvd_op * op, const size_t q, gsl_rng * r,
+             gsl_matrix * U, gsl_vector * S, gsl_matrix * V,
+             gsl_linalg_rsvd_workspace * w)
+{
+  const size_t k = w->k;
+
+  if (U->size1 != w->M || U->size2 != k)
+    {
+      GSL_ERROR ("U matrix must be M-by-k", GSL_EBADLEN);
+    }
+  else if (S->size != k)
+    {
+      GSL_ERROR ("S vector must have length k", GSL_EBADLEN);
+    }
+  else if (V->size1 != w->N || V->size2 != k)
+    {
+      GSL_ERROR ("V matrix must be N-by-k", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_matrix_view Vk = gsl_matrix_submatrix (w->V, 0, 0, w->l, k);
+      gsl_matrix_view Zk = gsl_matrix_submatrix (w->Z, 0, 0, w->N, k);
+      gsl_vector_view Sk = gsl_vector_subvector (w->S, 0, k);
+      int status;
+
+      status = rsvd_range (op, q, r, w->Q, w);
+      if (status)
+        return status;
+
+      /* Z = A^T Q = B^T */
+      status = rsvd_apply (op, CblasTrans, w->Q, w->Z);
+      if (status)
+        return status;
+
+      /* Z = U_Z S V_Z^T */
+      status = gsl_linalg_SV_decomp (w->Z, w->V, w->S, w->work);
+      if (status)
+        return status;
+
+      /* U = Q V_Z, V = U_Z */
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, w->Q, &Vk.matrix, 0.0, U);
+      gsl_matrix_memcpy (V, &Zk.matrix);
+      gsl_vector_memcpy (S, &Sk.vector);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* Y = op(A) X */
+static int
+rsvd_apply (const rsvd_op * op, CBLAS_TRANSPOSE_t TransA,
+            const gsl_matrix * X, gsl_matrix * Y)
+{
+  if (op->A != NULL)
+    {
+      return gsl_blas_dgemm (TransA, CblasNoTrans, 1.0, op->A, X, 0.0, Y);
+    }
+  else
+    {
+      size_t j;
+
+      for (j = 0; j < X->size2; ++j)
+        {
+          gsl_vector_const_view x = gsl_matrix_const_column (X, j);
+          gsl_vector_view y = gsl_matrix_column (Y, j);
+          int status = op->matvec (TransA, &x.vector, &y.vector, op->params);
+
+          if (status)
+            return status;
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* Y := orthonormal basis of the columns of Y; T is workspace */
+static int
+rsvd_orth (gsl_matrix * Y, gsl_matrix * T)
+{
+  gsl_linalg_QR_decomp_r (Y, T);
+  return gsl_linalg_QR_Q1_r (Y, T, Y);
+}
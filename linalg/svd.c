@@ -27,7 +27,19 @@
 
 #include <gsl/gsl_linalg.h>
 
+#include "../sys/thread_pool.h"
 #include "svdstep.c"
+#include "householder_wy.h"
+#include "workspace.h"
+
+/* rows of U formed at a time by gsl_linalg_SV_decomp_mod */
+#define SVD_ROWS 64
+
+/* columns per block of gsl_linalg_SV_decomp_jacobi_par */
+#define SVD_JACOBI_BLOCK 32
+
+static int svd_QR_decomp (gsl_matrix * A, gsl_vector * tau);
+static void jacobi_normalize (gsl_matrix * A, gsl_vector * S, const double tolerance);
 
 /* Factorise a general M x N matrix A into,
  *
@@ -48,6 +60,36 @@
 int
 gsl_linalg_SV_decomp (gsl_matrix * A, gsl_matrix * V, gsl_vector * S, 
                       gsl_vector * work)
+{
+  gsl_linalg_workspace w;
+  int status;
+
+  if (linalg_workspace_init (&w, gsl_linalg_SV_decomp_wsize (A->size1, A->size2)))
+    {
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  status = gsl_linalg_SV_decomp_ws (A, V, S, work, &w);
+
+  linalg_workspace_clear (&w);
+
+  return status;
+}
+
+/* size in doubles of the arena needed by gsl_linalg_SV_decomp_ws */
+
+size_t
+gsl_linalg_SV_decomp_wsize (const size_t M, const size_t N)
+{
+  const size_t n1 = gsl_linalg_bidiag_decomp_wsize (M, N);
+  const size_t n2 = gsl_linalg_bidiag_unpack_wsize (M, N);
+
+  return GSL_MAX (n1, n2);
+}
+
+int
+gsl_linalg_SV_decomp_ws (gsl_matrix * A, gsl_matrix * V, gsl_vector * S, 
+                         gsl_vector * work, gsl_linalg_workspace * w)
 {
   size_t a, b, i, j, iter;
 
@@ -78,6 +120,10 @@ gsl_linalg_SV_decomp (gsl_matrix * A, gsl_matrix * V, gsl_vector * S,
       GSL_ERROR ("length of workspace must match second dimension of matrix A",
                  GSL_EBADLEN);
     }
+  else if (linalg_workspace_avail (w) < gsl_linalg_SV_decomp_wsize (M, N))
+    {
+      GSL_ERROR ("workspace is too small", GSL_EBADLEN);
+    }
 
   /* Handle the case of N = 1 (SVD of a column vector) */
 
@@ -102,8 +148,8 @@ gsl_linalg_SV_decomp (gsl_matrix * A, gsl_matrix * V, gsl_vector * S,
     
     /* bidiagonalize matrix A, unpack A into U S V */
     
-    gsl_linalg_bidiag_decomp (A, S, &f.vector);
-    gsl_linalg_bidiag_unpack2 (A, S, &f.vector, V);
+    gsl_linalg_bidiag_decomp_ws (A, S, &f.vector, w);
+    gsl_linalg_bidiag_unpack2_ws (A, S, &f.vector, V, w);
     
     /* apply reduction steps to B=(S,Sd) */
     
@@ -276,6 +322,7 @@ gsl_linalg_SV_decomp_mod (gsl_matrix * A,
                           gsl_matrix * V, gsl_vector * S, gsl_vector * work)
 {
   size_t i, j;
+  int status;
 
   const size_t M = A->size1;
   const size_t N = A->size2;
@@ -331,23 +378,9 @@ gsl_linalg_SV_decomp_mod (gsl_matrix * A,
 
   /* Convert A into an upper triangular matrix R */
 
-  for (i = 0; i < N; i++)
-    {
-      gsl_vector_view c = gsl_matrix_column (A, i);
-      gsl_vector_view v = gsl_vector_subvector (&c.vector, i, M - i);
-      double tau_i = gsl_linalg_householder_transform (&v.vector);
-
-      /* Apply the transformation to the remaining columns */
-
-      if (i + 1 < N)
-        {
-          gsl_matrix_view m =
-            gsl_matrix_submatrix (A, i, i + 1, M - i, N - (i + 1));
-          gsl_linalg_householder_hm (tau_i, &v.vector, &m.matrix);
-        }
-
-      gsl_vector_set (S, i, tau_i);
-    }
+  status = svd_QR_decomp (A, S);
+  if (status)
+    return status;
 
   /* Copy the upper triangular part of A into X */
 
@@ -372,42 +405,116 @@ gsl_linalg_SV_decomp_mod (gsl_matrix * A,
 
   /* Convert A into an orthogonal matrix L */
 
-  for (j = N; j-- > 0;)
-    {
-      /* Householder column transformation to accumulate L */
-      double tj = gsl_vector_get (S, j);
-      gsl_matrix_view m = gsl_matrix_submatrix (A, j, j, M - j, N - j);
-      gsl_linalg_householder_hm1 (tj, &m.matrix);
-    }
+  status = linalg_wy_unpack_col (A, S, NULL);
+  if (status)
+    return status;
 
   /* unpack R into X V S */
 
   gsl_linalg_SV_decomp (X, V, S, work);
 
-  /* Multiply L by X, to obtain U = L X, stored in U */
+  /* Multiply L by X, to obtain U = L X, stored in U, a block of rows
+     at a time */
 
   {
-    gsl_vector_view sum = gsl_vector_subvector (work, 0, N);
+    const size_t nb = GSL_MIN (M, SVD_ROWS);
+    gsl_matrix *B = gsl_matrix_alloc (nb, N);
 
-    for (i = 0; i < M; i++)
+    if (B == NULL)
       {
-        gsl_vector_view L_i = gsl_matrix_row (A, i);
-        gsl_vector_set_zero (&sum.vector);
+        GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+      }
 
-        for (j = 0; j < N; j++)
-          {
-            double Lij = gsl_vector_get (&L_i.vector, j);
-            gsl_vector_view X_j = gsl_matrix_row (X, j);
-            gsl_blas_daxpy (Lij, &X_j.vector, &sum.vector);
-          }
+    for (i = 0; i < M; i += nb)
+      {
+        const size_t mb = GSL_MIN (nb, M - i);
+        gsl_matrix_view L_i = gsl_matrix_submatrix (A, i, 0, mb, N);
+        gsl_matrix_view B_i = gsl_matrix_submatrix (B, 0, 0, mb, N);
 
-        gsl_vector_memcpy (&L_i.vector, &sum.vector);
+        gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &L_i.matrix, X, 0.0, &B_i.matrix);
+        gsl_matrix_memcpy (&L_i.matrix, &B_i.matrix);
       }
+
+    gsl_matrix_free (B);
   }
 
   return GSL_SUCCESS;
 }
 
+/* QR decomposition of A, M >= N, in the format of
+   gsl_linalg_QR_decomp. The columns are factored in panels of
+   WY_BLOCK, and each panel is applied to the trailing columns in
+   compact WY form */
+static int
+svd_QR_decomp (gsl_matrix * A, gsl_vector * tau)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  const size_t nb = (N > WY_CROSSOVER) ? WY_BLOCK : N;
+  gsl_matrix *T = NULL, *W = NULL;
+  size_t i, i0;
+
+  if (nb < N)
+    {
+      T = gsl_matrix_alloc (nb, nb);
+      W = gsl_matrix_alloc (nb, N);
+
+      if (T == NULL || W == NULL)
+        {
+          if (T != NULL)
+            gsl_matrix_free (T);
+          if (W != NULL)
+            gsl_matrix_free (W);
+          GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+        }
+    }
+
+  for (i0 = 0; i0 < N; i0 += nb)
+    {
+      const size_t ib = GSL_MIN (nb, N - i0);
+
+      for (i = i0; i < i0 + ib; i++)
+        {
+          gsl_vector_view c = gsl_matrix_column (A, i);
+          gsl_vector_view v = gsl_vector_subvector (&c.vector, i, M - i);
+          double tau_i = gsl_linalg_householder_transform (&v.vector);
+
+          /* Apply the transformation to the remaining columns of the
+             panel */
+
+          if (i + 1 < i0 + ib)
+            {
+              gsl_matrix_view m =
+                gsl_matrix_submatrix (A, i, i + 1, M - i, i0 + ib - (i + 1));
+              gsl_linalg_householder_hm (tau_i, &v.vector, &m.matrix);
+            }
+
+          gsl_vector_set (tau, i, tau_i);
+        }
+
+      /* Apply the panel to the trailing columns */
+
+      if (i0 + ib < N)
+        {
+          gsl_matrix_view V = gsl_matrix_submatrix (A, i0, i0, M - i0, ib);
+          gsl_vector_view t = gsl_vector_subvector (tau, i0, ib);
+          gsl_matrix_view C = gsl_matrix_submatrix (A, i0, i0 + ib, M - i0, N - i0 - ib);
+          gsl_matrix_view Tb = gsl_matrix_submatrix (T, 0, 0, ib, ib);
+          gsl_matrix_view Wb = gsl_matrix_submatrix (W, 0, 0, ib, N - i0 - ib);
+
+          linalg_wy_T_col (&V.matrix, &t.vector, &Tb.matrix);
+          linalg_wy_left_col (CblasTrans, &V.matrix, &Tb.matrix, &C.matrix, &Wb.matrix);
+        }
+    }
+
+  if (T != NULL)
+    {
+      gsl_matrix_free (T);
+      gsl_matrix_free (W);
+    }
+
+  return GSL_SUCCESS;
+}
 
 /*  Solves the system A x = b using the SVD factorization
  *
@@ -422,6 +529,37 @@ gsl_linalg_SV_solve (const gsl_matrix * U,
                      const gsl_matrix * V,
                      const gsl_vector * S,
                      const gsl_vector * b, gsl_vector * x)
+{
+  gsl_linalg_workspace w;
+  int status;
+
+  if (linalg_workspace_init (&w, gsl_linalg_SV_solve_wsize (U->size1, U->size2)))
+    {
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  status = gsl_linalg_SV_solve_ws (U, V, S, b, x, &w);
+
+  linalg_workspace_clear (&w);
+
+  return status;
+}
+
+/* size in doubles of the arena needed by gsl_linalg_SV_solve_ws */
+
+size_t
+gsl_linalg_SV_solve_wsize (const size_t M, const size_t N)
+{
+  (void) M;
+  return N;
+}
+
+int
+gsl_linalg_SV_solve_ws (const gsl_matrix * U,
+                        const gsl_matrix * V,
+                        const gsl_vector * S,
+                        const gsl_vector * b, gsl_vector * x,
+                        gsl_linalg_workspace * work)
 {
   if (U->size1 != b->size)
     {
@@ -446,13 +584,22 @@ gsl_linalg_SV_solve (const gsl_matrix * U,
     {
       GSL_ERROR ("size of matrix V must match size of vector x", GSL_EBADLEN);
     }
+  else if (linalg_workspace_avail (work) < gsl_linalg_SV_solve_wsize (U->size1, U->size2))
+    {
+      GSL_ERROR ("workspace is too small", GSL_EBADLEN);
+    }
+  else if (U->size2 == 0)
+    {
+      return GSL_SUCCESS;
+    }
   else
     {
       const size_t N = U->size2;
+      double *p = linalg_workspace_get (work, N);
+      gsl_vector_view wv = gsl_vector_view_array (p, N);
+      gsl_vector *w = &wv.vector;
       size_t i;
 
-      gsl_vector *w = gsl_vector_calloc (N);
-
       gsl_blas_dgemv (CblasTrans, 1.0, U, b, 0.0, w);
 
       for (i = 0; i < N; i++)
@@ -466,7 +613,7 @@ gsl_linalg_SV_solve (const gsl_matrix * U,
 
       gsl_blas_dgemv (CblasNoTrans, 1.0, V, w, 0.0, x);
 
-      gsl_vector_free (w);
+      linalg_workspace_release (work, p);
 
       return GSL_SUCCESS;
     }
@@ -653,8 +800,8 @@ gsl_linalg_SV_decomp_jacobi (gsl_matrix * A, gsl_matrix * Q, gsl_vector * S)
                       gsl_matrix_set (A, i, k, -Aij * sine + Aik * cosine);
                     }
 
-                  gsl_vector_set(S, j, fabs(cosine) * abserr_a + fabs(sine) * abserr_b);
-                  gsl_vector_set(S, k, fabs(sine) * abserr_a + fabs(cosine) * abserr_b);
+                  gsl_vector_set(S, j, hypot(cosine * abserr_a, sine * abserr_b));
+                  gsl_vector_set(S, k, hypot(sine * abserr_a, cosine * abserr_b));
 
                   /* apply rotation to Q */
                   for (i = 0; i < N; i++)
@@ -675,37 +822,355 @@ gsl_linalg_SV_decomp_jacobi (gsl_matrix * A, gsl_matrix * Q, gsl_vector * S)
        * Orthogonalization complete. Compute singular values.
        */
 
-      {
-        double prev_norm = -1.0;
+      jacobi_normalize (A, S, tolerance);
 
-        for (j = 0; j < N; j++)
-          {
-            gsl_vector_view column = gsl_matrix_column (A, j);
-            double norm = gsl_blas_dnrm2 (&column.vector);
+      if (count > 0)
+        {
+          /* reached sweep limit */
+          GSL_ERROR ("Jacobi iterations did not reach desired tolerance",
+                     GSL_ETOL);
+        }
 
-            /* Determine if singular value is zero, according to the
-               criteria used in the main loop above (i.e. comparison
-               with norm of previous column). */
+      return GSL_SUCCESS;
+    }
+}
 
-            if (norm == 0.0 || prev_norm == 0.0 
-                || (j > 0 && norm <= tolerance * prev_norm))
-              {
-                gsl_vector_set (S, j, 0.0);     /* singular */
-                gsl_vector_set_zero (&column.vector);   /* annihilate column */
+/*
+gsl_linalg_SV_decomp_jacobi_par()
+  One-sided Jacobi SVD with the rotations of each sweep applied in
+parallel
+
+Inputs: A    - M-by-N matrix, M >= N; on output, U
+        Q    - (output) N-by-N orthogonal matrix V
+        S    - (output) singular values, length N
+        pool - thread pool, or NULL to run in the calling thread
+
+Notes:
+1) The columns are divided into 2*nblk blocks of at most
+SVD_JACOBI_BLOCK columns. A sweep consists of 2*nblk - 1 rounds of a
+round-robin tournament between the blocks, so that the nblk pairs of
+blocks of a round are disjoint and are processed concurrently. In the
+first round each block also orthogonalizes its own columns. Every pair
+of columns is therefore rotated once per sweep, and the rotations of a
+block pair reuse the same 2*SVD_JACOBI_BLOCK columns while they are in
+cache.
+
+2) The columns of A and V are stored in the rows of transposed copies,
+so that each rotation is applied to two contiguous vectors, and the
+norms and inner product of a pair are computed in one pass.
+
+3) The rotation angles and the convergence test are those of
+gsl_linalg_SV_decomp_jacobi(), with the pairs (j,k), j < k, sorted so
+that the singular values are in decreasing order on output. Only the
+order of the rotations differs, so the results agree with
+gsl_linalg_SV_decomp_jacobi() to within rounding errors.
+*/
 
-                prev_norm = 0.0;
-              }
-            else
-              {
-                gsl_vector_set (S, j, norm);    /* non-singular */
-                gsl_vector_scale (&column.vector, 1.0 / norm);  /* normalize column */
+typedef struct
+{
+  size_t M, N;
+  size_t bs;                /* columns per block */
+  size_t nb;                /* number of blocks, even */
+  size_t round;             /* current round of the tournament */
+  double tolerance;
+  double *At;               /* A^T, N-by-M */
+  double *Qt;               /* Q^T, N-by-N */
+  double *nrm;              /* squared norms of the columns of A */
+  double *err;              /* error estimates of the columns of A */
+  size_t *count;            /* rotations per task */
+} jacobi_params;
+
+/* x^T y, with four partial sums */
+static double
+jacobi_dot (const double * x, const double * y, const size_t n)
+{
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  size_t i;
 
-                prev_norm = norm;
-              }
-          }
-      }
+  for (i = 0; i + 4 <= n; i += 4)
+    {
+      s0 += x[i] * y[i];
+      s1 += x[i + 1] * y[i + 1];
+      s2 += x[i + 2] * y[i + 2];
+      s3 += x[i + 3] * y[i + 3];
+    }
 
-      if (count > 0)
+  for (; i < n; ++i)
+    s0 += x[i] * y[i];
+
+  return (s0 + s1) + (s2 + s3);
+}
+
+/* apply the rotation (c,s) to the vectors x and y; if xx is not NULL,
+   store the new x^T x and y^T y in xx and yy */
+static void
+jacobi_rot (double * x, double * y, const size_t n, const double c, const double s,
+            double * xx, double * yy)
+{
+  double x0 = 0.0, x1 = 0.0, y0 = 0.0, y1 = 0.0;
+  size_t i;
+
+  for (i = 0; i + 2 <= n; i += 2)
+    {
+      const double xi = x[i] * c + y[i] * s;
+      const double yi = -x[i] * s + y[i] * c;
+      const double xj = x[i + 1] * c + y[i + 1] * s;
+      const double yj = -x[i + 1] * s + y[i + 1] * c;
+
+      x[i] = xi;
+      y[i] = yi;
+      x[i + 1] = xj;
+      y[i + 1] = yj;
+      x0 += xi * xi;
+      y0 += yi * yi;
+      x1 += xj * xj;
+      y1 += yj * yj;
+    }
+
+  for (; i < n; ++i)
+    {
+      const double xi = x[i] * c + y[i] * s;
+      const double yi = -x[i] * s + y[i] * c;
+
+      x[i] = xi;
+      y[i] = yi;
+      x0 += xi * xi;
+      y0 += yi * yi;
+    }
+
+  if (xx != NULL)
+    {
+      *xx = x0 + x1;
+      *yy = y0 + y1;
+    }
+}
+
+/* rotate columns j < k of A and Q; returns 1 if a rotation was applied */
+static int
+jacobi_rotate (jacobi_params * p, const size_t j, const size_t k)
+{
+  const size_t M = p->M;
+  const size_t N = p->N;
+  const double aa = p->nrm[j];
+  const double bb = p->nrm[k];
+  const double abserr_a = p->err[j];
+  const double abserr_b = p->err[k];
+  double a, b, pp, q, v, cosine, sine;
+  int sorted, orthog, noisya, noisyb;
+
+  a = sqrt (aa);
+  b = sqrt (bb);
+  sorted = (GSL_COERCE_DBL(a) >= GSL_COERCE_DBL(b));
+  noisya = (a < abserr_a);
+  noisyb = (b < abserr_b);
+
+  if (sorted && (noisya || noisyb))
+    return 0;
+
+  pp = 2.0 * jacobi_dot (p->At + j * M, p->At + k * M, M);
+  q = aa - bb;
+  v = hypot (pp, q);
+  orthog = (fabs (pp) <= p->tolerance * GSL_COERCE_DBL(a * b));
+
+  if (sorted && orthog)
+    return 0;
+
+  if (v == 0 || !sorted)
+    {
+      cosine = 0.0;
+      sine = 1.0;
+    }
+  else
+    {
+      cosine = sqrt ((v + q) / (2.0 * v));
+      sine = pp / (2.0 * v * cosine);
+    }
+
+  /* the column norms are recomputed from the rotated columns */
+  jacobi_rot (p->At + j * M, p->At + k * M, M, cosine, sine, &p->nrm[j], &p->nrm[k]);
+  jacobi_rot (p->Qt + j * N, p->Qt + k * N, N, cosine, sine, NULL, NULL);
+
+  p->err[j] = hypot (cosine * abserr_a, sine * abserr_b);
+  p->err[k] = hypot (sine * abserr_a, cosine * abserr_b);
+
+  return 1;
+}
+
+/* column range [*j0, *j1) of block b */
+static void
+jacobi_block (const jacobi_params * p, const size_t b, size_t * j0, size_t * j1)
+{
+  *j0 = GSL_MIN (b * p->bs, p->N);
+  *j1 = GSL_MIN (*j0 + p->bs, p->N);
+}
+
+/* rotate all pairs of columns within block b */
+static size_t
+jacobi_inner (jacobi_params * p, const size_t b)
+{
+  size_t j0, j1, j, k;
+  size_t count = 0;
+
+  jacobi_block (p, b, &j0, &j1);
+
+  for (j = j0; j + 1 < j1; ++j)
+    {
+      for (k = j + 1; k < j1; ++k)
+        count += jacobi_rotate (p, j, k);
+    }
+
+  return count;
+}
+
+/* task t of a round: the t-th pair of blocks of the round robin
+   tournament between nb blocks, with block 0 fixed */
+static void
+jacobi_task (void * arg, const size_t t)
+{
+  jacobi_params * p = (jacobi_params *) arg;
+  const size_t n = p->nb - 1;
+  const size_t r = p->round;
+  size_t b1, b2, i0, i1, j0, j1, i, j;
+  size_t count = 0;
+
+  if (t == 0)
+    {
+      b1 = 0;
+      b2 = 1 + r % n;
+    }
+  else
+    {
+      b1 = 1 + (r + t) % n;
+      b2 = 1 + (r + n - t) % n;
+    }
+
+  if (b1 > b2)
+    {
+      size_t tmp = b1;
+      b1 = b2;
+      b2 = tmp;
+    }
+
+  if (r == 0)
+    {
+      count += jacobi_inner (p, b1);
+      count += jacobi_inner (p, b2);
+    }
+
+  /* all columns of b1 precede those of b2 */
+  jacobi_block (p, b1, &i0, &i1);
+  jacobi_block (p, b2, &j0, &j1);
+
+  for (i = i0; i < i1; ++i)
+    {
+      for (j = j0; j < j1; ++j)
+        count += jacobi_rotate (p, i, j);
+    }
+
+  p->count[t] += count;
+}
+
+int
+gsl_linalg_SV_decomp_jacobi_par (gsl_matrix * A, gsl_matrix * Q, gsl_vector * S,
+                                 gsl_thread_pool * pool)
+{
+  if (A->size1 < A->size2)
+    {
+      GSL_ERROR ("svd of MxN matrix, M<N, is not implemented", GSL_EUNIMPL);
+    }
+  else if (Q->size1 != A->size2)
+    {
+      GSL_ERROR ("square matrix Q must match second dimension of matrix A",
+                 GSL_EBADLEN);
+    }
+  else if (Q->size1 != Q->size2)
+    {
+      GSL_ERROR ("matrix Q must be square", GSL_ENOTSQR);
+    }
+  else if (S->size != A->size2)
+    {
+      GSL_ERROR ("length of vector S must match second dimension of matrix A",
+                 GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t M = A->size1;
+      const size_t N = A->size2;
+      const size_t nthreads = thread_dag_nthreads (pool);
+      jacobi_params params;
+      gsl_matrix_view At, Qt;
+      size_t nblk, ntot, t;
+      int sweep = 0;
+      int sweepmax = GSL_MAX (5 * (int) N, 12);
+
+      /* blocks of at most SVD_JACOBI_BLOCK columns, and at least two
+         per thread if N permits */
+      nblk = (N + 2 * SVD_JACOBI_BLOCK - 1) / (2 * SVD_JACOBI_BLOCK);
+      nblk = GSL_MAX (nblk, GSL_MIN (nthreads, N / 2));
+      nblk = GSL_MAX (nblk, 1);
+
+      params.M = M;
+      params.N = N;
+      params.nb = 2 * nblk;
+      params.bs = (N + params.nb - 1) / params.nb;
+      params.tolerance = 10 * M * GSL_DBL_EPSILON;
+      params.At = malloc (N * M * sizeof (double));
+      params.Qt = malloc (N * N * sizeof (double));
+      params.nrm = malloc (N * sizeof (double));
+      params.err = malloc (N * sizeof (double));
+      params.count = malloc (nblk * sizeof (size_t));
+
+      if (params.At == NULL || params.Qt == NULL || params.nrm == NULL ||
+          params.err == NULL || params.count == NULL)
+        {
+          free (params.At);
+          free (params.Qt);
+          free (params.nrm);
+          free (params.err);
+          free (params.count);
+          GSL_ERROR ("failed to allocate working space", GSL_ENOMEM);
+        }
+
+      At = gsl_matrix_view_array (params.At, N, M);
+      Qt = gsl_matrix_view_array (params.Qt, N, N);
+
+      gsl_matrix_transpose_memcpy (&At.matrix, A);
+      gsl_matrix_set_identity (&Qt.matrix);
+
+      for (t = 0; t < N; ++t)
+        {
+          const double * x = params.At + t * M;
+          params.nrm[t] = jacobi_dot (x, x, M);
+          params.err[t] = GSL_DBL_EPSILON * sqrt (params.nrm[t]);
+        }
+
+      do
+        {
+          for (t = 0; t < nblk; ++t)
+            params.count[t] = 0;
+
+          for (params.round = 0; params.round < params.nb - 1; ++params.round)
+            thread_pool_run (pool, nblk, jacobi_task, &params);
+
+          for (t = 0, ntot = 0; t < nblk; ++t)
+            ntot += params.count[t];
+
+          sweep++;
+        }
+      while (ntot > 0 && sweep <= sweepmax);
+
+      gsl_matrix_transpose_memcpy (A, &At.matrix);
+      gsl_matrix_transpose_memcpy (Q, &Qt.matrix);
+
+      jacobi_normalize (A, S, params.tolerance);
+
+      free (params.At);
+      free (params.Qt);
+      free (params.nrm);
+      free (params.err);
+      free (params.count);
+
+      if (ntot > 0)
         {
           /* reached sweep limit */
           GSL_ERROR ("Jacobi iterations did not reach desired tolerance",
@@ -715,3 +1180,39 @@ gsl_linalg_SV_decomp_jacobi (gsl_matrix * A, gsl_matrix * Q, gsl_vector * S)
       return GSL_SUCCESS;
     }
 }
+
+/* normalize the orthogonalized columns of A and store their norms in S;
+   negligible columns are set to zero */
+static void
+jacobi_normalize (gsl_matrix * A, gsl_vector * S, const double tolerance)
+{
+  const size_t N = A->size2;
+  double prev_norm = -1.0;
+  size_t j;
+
+  for (j = 0; j < N; j++)
+    {
+      gsl_vector_view column = gsl_matrix_column (A, j);
+      double norm = gsl_blas_dnrm2 (&column.vector);
+
+      /* Determine if singular value is zero, according to the
+         criteria used in the main loop above (i.e. comparison
+         with norm of previous column). */
+
+      if (norm == 0.0 || prev_norm == 0.0 
+          || (j > 0 && norm <= tolerance * prev_norm))
+        {
+          gsl_vector_set (S, j, 0.0);     /* singular */
+          gsl_vector_set_zero (&column.vector);   /* annihilate column */
+
+          prev_norm = 0.0;
+        }
+      else
+        {
+          gsl_vector_set (S, j, norm);    /* non-singular */
+          gsl_vector_scale (&column.vector, 1.0 / norm);  /* normalize column */
+
+          prev_norm = norm;
+        }
+    }
+}
@@ -412,17 +412,78 @@ chase_out_trailing_zero (gsl_vector * d, gsl_vector * f, gsl_matrix * V)
     }
 }
 
+/* The rotations of a QR sweep are applied to U and V in batches of up
+   to SVD_NROT consecutive rotations. A batch is applied one row at a
+   time, so that each row is traversed once per batch instead of once
+   per rotation, and four rows are processed together to overlap their
+   dependency chains. Each element goes through the same operations in
+   the same order as when the rotations are applied one by one. */
+
+#define SVD_NROT 64
+
+/* A(:,k0:k0+n+1) := A(:,k0:k0+n+1) G_0 G_1 ... G_{n-1}, where G_j
+   rotates columns k0+j and k0+j+1 by (c[j], s[j]) */
+static void
+apply_rotations (gsl_matrix * A, const size_t k0, const size_t n,
+                 const double * c, const double * s)
+{
+  const size_t M = A->size1;
+  const size_t tda = A->tda;
+  size_t i, j;
+
+  for (i = 0; i + 4 <= M; i += 4)
+    {
+      double *a0 = A->data + i * tda + k0;
+      double *a1 = a0 + tda, *a2 = a1 + tda, *a3 = a2 + tda;
+      double x0 = a0[0], x1 = a1[0], x2 = a2[0], x3 = a3[0];
+
+      for (j = 0; j < n; j++)
+        {
+          const double cj = c[j], sj = s[j];
+          const double y0 = a0[j + 1], y1 = a1[j + 1];
+          const double y2 = a2[j + 1], y3 = a3[j + 1];
+
+          a0[j] = cj * x0 - sj * y0;
+          a1[j] = cj * x1 - sj * y1;
+          a2[j] = cj * x2 - sj * y2;
+          a3[j] = cj * x3 - sj * y3;
+
+          x0 = sj * x0 + cj * y0;
+          x1 = sj * x1 + cj * y1;
+          x2 = sj * x2 + cj * y2;
+          x3 = sj * x3 + cj * y3;
+        }
+
+      a0[n] = x0;
+      a1[n] = x1;
+      a2[n] = x2;
+      a3[n] = x3;
+    }
+
+  for (; i < M; i++)
+    {
+      double *a = A->data + i * tda + k0;
+      double x = a[0];
+
+      for (j = 0; j < n; j++)
+        {
+          const double y = a[j + 1];
+          a[j] = c[j] * x - s[j] * y;
+          x = s[j] * x + c[j] * y;
+        }
+
+      a[n] = x;
+    }
+}
+
 static void
 qrstep (gsl_vector * d, gsl_vector * f, gsl_matrix * U, gsl_matrix * V)
 {
-#if !USE_BLAS
-  const size_t M = U->size1;
-  const size_t N = V->size1;
-#endif
   const size_t n = d->size;
   double y, z;
   double ak, bk, zk, ap, bp, aq;
-  size_t i, k;
+  double cv[SVD_NROT], sv[SVD_NROT], cu[SVD_NROT], su[SVD_NROT];
+  size_t i, k, k0 = 0, nrot = 0;
 
   if (n == 1)
     return;  /* shouldn't happen */
@@ -492,23 +553,10 @@ qrstep (gsl_vector * d, gsl_vector * f, gsl_matrix * U, gsl_matrix * V)
       double c, s;
       gsl_linalg_givens (y, z, &c, &s);
 
-      /* Compute V <= V G */
+      /* Compute V <= V G, deferred */
 
-#ifdef USE_BLAS
-      {
-        gsl_vector_view Vk = gsl_matrix_column(V,k);
-        gsl_vector_view Vkp1 = gsl_matrix_column(V,k+1);
-        gsl_blas_drot(&Vk.vector, &Vkp1.vector, c, -s);
-      }
-#else
-      for (i = 0; i < N; i++)
-        {
-          double Vip = gsl_matrix_get (V, i, k);
-          double Viq = gsl_matrix_get (V, i, k + 1);
-          gsl_matrix_set (V, i, k, c * Vip - s * Viq);
-          gsl_matrix_set (V, i, k + 1, s * Vip + c * Viq);
-        }
-#endif
+      cv[nrot] = c;
+      sv[nrot] = s;
 
       /* compute B <= B G */
 
@@ -547,23 +595,19 @@ qrstep (gsl_vector * d, gsl_vector * f, gsl_matrix * U, gsl_matrix * V)
 
       gsl_linalg_givens (y, z, &c, &s);
 
-      /* Compute U <= U G */
+      /* Compute U <= U G, deferred */
 
-#ifdef USE_BLAS
-      {
-        gsl_vector_view Uk = gsl_matrix_column(U,k);
-        gsl_vector_view Ukp1 = gsl_matrix_column(U,k+1);
-        gsl_blas_drot(&Uk.vector, &Ukp1.vector, c, -s);
-      }
-#else
-      for (i = 0; i < M; i++)
+      cu[nrot] = c;
+      su[nrot] = s;
+      nrot++;
+
+      if (nrot == SVD_NROT || k == n - 2)
         {
-          double Uip = gsl_matrix_get (U, i, k);
-          double Uiq = gsl_matrix_get (U, i, k + 1);
-          gsl_matrix_set (U, i, k, c * Uip - s * Uiq);
-          gsl_matrix_set (U, i, k + 1, s * Uip + c * Uiq);
+          apply_rotations (V, k0, nrot, cv, sv);
+          apply_rotations (U, k0, nrot, cu, su);
+          k0 += nrot;
+          nrot = 0;
         }
-#endif
 
       /* compute B <= G^T B */
 
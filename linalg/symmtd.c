@@ -61,8 +61,58 @@
 
 #include <gsl/gsl_linalg.h>
 
+#include "householder_wy.h"
+#include "workspace.h"
+
+static int symmtd_decomp_L2 (gsl_matrix * A, gsl_vector * tau);
+static void symmtd_panel (gsl_matrix * A, gsl_vector * tau, gsl_matrix * W, double * e);
+static int symmtd_Q_left (const gsl_matrix * A, const gsl_vector * tau, gsl_matrix * B,
+                          const int identity, double * work);
+
+/*
+ * For large matrices the reduction is blocked as in LAPACK (dsytrd):
+ * the reflectors of WY_BLOCK columns are computed from a panel,
+ * together with a matrix W such that the trailing matrix is updated
+ * with a symmetric rank-2k update,
+ *
+ *   A22 := A22 - V W^T - W V^T
+ *
+ * where V holds the reflectors of the panel. Half of the operations
+ * are then done by Level 3 BLAS, the other half being the symmetric
+ * matrix-vector products needed to compute each reflector.
+ */
+
 int 
 gsl_linalg_symmtd_decomp (gsl_matrix * A, gsl_vector * tau)  
+{
+  gsl_linalg_workspace w;
+  int status;
+
+  if (linalg_workspace_init (&w, gsl_linalg_symmtd_decomp_wsize (A->size1)))
+    {
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  status = gsl_linalg_symmtd_decomp_ws (A, tau, &w);
+
+  linalg_workspace_clear (&w);
+
+  return status;
+}
+
+/* size in doubles of the arena needed by gsl_linalg_symmtd_decomp_ws */
+
+size_t
+gsl_linalg_symmtd_decomp_wsize (const size_t N)
+{
+  if (N <= WY_CROSSOVER)
+    return 0;
+  else
+    return N * WY_BLOCK;
+}
+
+int
+gsl_linalg_symmtd_decomp_ws (gsl_matrix * A, gsl_vector * tau, gsl_linalg_workspace * w)
 {
   if (A->size1 != A->size2)
     {
@@ -73,50 +123,181 @@ gsl_linalg_symmtd_decomp (gsl_matrix * A, gsl_vector * tau)
     {
       GSL_ERROR ("size of tau must be N-1", GSL_EBADLEN);
     }
+  else if (linalg_workspace_avail (w) < gsl_linalg_symmtd_decomp_wsize (A->size1))
+    {
+      GSL_ERROR ("workspace is too small", GSL_EBADLEN);
+    }
+  else if (A->size1 <= WY_CROSSOVER)
+    {
+      return symmtd_decomp_L2 (A, tau);
+    }
   else
     {
       const size_t N = A->size1;
-      size_t i;
+      const size_t nb = WY_BLOCK;
+      double *work = linalg_workspace_get (w, N * nb);
+      gsl_matrix_view Wv = gsl_matrix_view_array (work, N, nb);
+      gsl_matrix *W = &Wv.matrix;
+      double e[WY_BLOCK];
+      size_t i, j = 0;
+
+      /* reduce nb columns at a time until the trailing matrix is small
+         enough for the unblocked algorithm */
+
+      while (N - j > WY_CROSSOVER)
+        {
+          gsl_matrix_view Aj = gsl_matrix_submatrix (A, j, j, N - j, N - j);
+          gsl_vector_view tj = gsl_vector_subvector (tau, j, nb);
+          gsl_matrix_view Wj = gsl_matrix_submatrix (W, 0, 0, N - j, nb);
+          gsl_matrix_view A22 = gsl_matrix_submatrix (A, j + nb, j + nb, N - j - nb, N - j - nb);
+          gsl_matrix_view V = gsl_matrix_submatrix (A, j + nb, j, N - j - nb, nb);
+          gsl_matrix_view W2 = gsl_matrix_submatrix (W, nb, 0, N - j - nb, nb);
+
+          symmtd_panel (&Aj.matrix, &tj.vector, &Wj.matrix, e);
+
+          /* A22 := A22 - V W2^T - W2 V^T */
+          gsl_blas_dsyr2k (CblasLower, CblasNoTrans, -1.0, &V.matrix, &W2.matrix, 1.0, &A22.matrix);
+
+          /* restore the subdiagonal, which holds the units of the
+             reflectors during the update */
+          for (i = 0; i < nb; i++)
+            gsl_matrix_set (A, j + i + 1, j + i, e[i]);
+
+          j += nb;
+        }
+
+      linalg_workspace_release (w, work);
+
+      {
+        gsl_matrix_view Aj = gsl_matrix_submatrix (A, j, j, N - j, N - j);
+        gsl_vector_view tj = gsl_vector_subvector (tau, j, N - j - 1);
+
+        return symmtd_decomp_L2 (&Aj.matrix, &tj.vector);
+      }
+    }
+}
+
+/* unblocked tridiagonal decomposition (LAPACK dsytd2) */
+static int
+symmtd_decomp_L2 (gsl_matrix * A, gsl_vector * tau)
+{
+  const size_t N = A->size1;
+  size_t i;
   
-      for (i = 0 ; i < N - 2; i++)
+  for (i = 0 ; i < N - 2; i++)
+    {
+      gsl_vector_view v = gsl_matrix_subcolumn (A, i, i + 1, N - i - 1);
+      double tau_i = gsl_linalg_householder_transform (&v.vector);
+      
+      /* Apply the transformation H^T A H to the remaining columns */
+
+      if (tau_i != 0.0) 
         {
-          gsl_vector_view v = gsl_matrix_subcolumn (A, i, i + 1, N - i - 1);
-          double tau_i = gsl_linalg_householder_transform (&v.vector);
+          gsl_matrix_view m = gsl_matrix_submatrix (A, i + 1, i + 1, N - i - 1, N - i - 1);
+          double ei = gsl_vector_get(&v.vector, 0);
+          gsl_vector_view x = gsl_vector_subvector (tau, i, N - i - 1);
+
+          gsl_vector_set (&v.vector, 0, 1.0);
           
-          /* Apply the transformation H^T A H to the remaining columns */
-
-          if (tau_i != 0.0) 
-            {
-              gsl_matrix_view m = gsl_matrix_submatrix (A, i + 1, i + 1, N - i - 1, N - i - 1);
-              double ei = gsl_vector_get(&v.vector, 0);
-              gsl_vector_view x = gsl_vector_subvector (tau, i, N - i - 1);
-
-              gsl_vector_set (&v.vector, 0, 1.0);
-              
-              /* x = tau * A * v */
-              gsl_blas_dsymv (CblasLower, tau_i, &m.matrix, &v.vector, 0.0, &x.vector);
-
-              /* w = x - (1/2) tau * (x' * v) * v  */
-              {
-                double xv, alpha;
-                gsl_blas_ddot(&x.vector, &v.vector, &xv);
-                alpha = -0.5 * tau_i * xv;
-                gsl_blas_daxpy(alpha, &v.vector, &x.vector);
-              }
-              
-              /* apply the transformation A = A - v w' - w v' */
-              gsl_blas_dsyr2(CblasLower, -1.0, &v.vector, &x.vector, &m.matrix);
-
-              gsl_vector_set (&v.vector, 0, ei);
-            }
+          /* x = tau * A * v */
+          gsl_blas_dsymv (CblasLower, tau_i, &m.matrix, &v.vector, 0.0, &x.vector);
+
+          /* w = x - (1/2) tau * (x' * v) * v  */
+          {
+            double xv, alpha;
+            gsl_blas_ddot(&x.vector, &v.vector, &xv);
+            alpha = -0.5 * tau_i * xv;
+            gsl_blas_daxpy(alpha, &v.vector, &x.vector);
+          }
           
-          gsl_vector_set (tau, i, tau_i);
+          /* apply the transformation A = A - v w' - w v' */
+          gsl_blas_dsyr2(CblasLower, -1.0, &v.vector, &x.vector, &m.matrix);
+
+          gsl_vector_set (&v.vector, 0, ei);
         }
       
-      return GSL_SUCCESS;
+      gsl_vector_set (tau, i, tau_i);
     }
+  
+  return GSL_SUCCESS;
 }  
 
+/*
+symmtd_panel()
+  Reduce the first nb columns of the n-by-n symmetric matrix A, n > nb + 1,
+without updating the trailing matrix A(nb:n, nb:n) (LAPACK dlatrd)
+
+Inputs: A   - n-by-n matrix, lower triangle referenced
+        tau - (output) coefficients of the reflectors, length nb
+        W   - (output) n-by-nb matrix
+        e   - (output) subdiagonal of T, length nb
+
+Notes:
+1) On output the reflectors are stored in A as in gsl_linalg_symmtd_decomp,
+except that A(i+1,i) is set to 1; the trailing matrix must then be
+updated as A22 := A22 - V W(nb:n,:)^T - W(nb:n,:) V^T.
+
+2) Before reflector i is computed, column i is brought up to date with
+the products of the previous reflectors of the panel, which the columns
+of W represent. Elements W(0:i,i) are used as workspace.
+*/
+
+static void
+symmtd_panel (gsl_matrix * A, gsl_vector * tau, gsl_matrix * W, double * e)
+{
+  const size_t n = A->size1;
+  const size_t nb = W->size2;
+  size_t i;
+
+  for (i = 0; i < nb; i++)
+    {
+      gsl_vector_view ai = gsl_matrix_subcolumn (A, i, i, n - i);
+      gsl_vector_view v = gsl_matrix_subcolumn (A, i, i + 1, n - i - 1);
+      gsl_vector_view wi = gsl_matrix_subcolumn (W, i, i + 1, n - i - 1);
+      gsl_matrix_view A22 = gsl_matrix_submatrix (A, i + 1, i + 1, n - i - 1, n - i - 1);
+      double tau_i, vw;
+
+      /* update column i: A(i:n,i) -= A(i:n,0:i) W(i,0:i)^T + W(i:n,0:i) A(i,0:i)^T */
+      if (i > 0)
+        {
+          gsl_matrix_view Ai = gsl_matrix_submatrix (A, i, 0, n - i, i);
+          gsl_matrix_view Wi = gsl_matrix_submatrix (W, i, 0, n - i, i);
+          gsl_vector_view w = gsl_matrix_subrow (W, i, 0, i);
+          gsl_vector_view a = gsl_matrix_subrow (A, i, 0, i);
+
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Ai.matrix, &w.vector, 1.0, &ai.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Wi.matrix, &a.vector, 1.0, &ai.vector);
+        }
+
+      /* reflector annihilating A(i+2:n,i) */
+      tau_i = gsl_linalg_householder_transform (&v.vector);
+      gsl_vector_set (tau, i, tau_i);
+      e[i] = gsl_vector_get (&v.vector, 0);
+      gsl_vector_set (&v.vector, 0, 1.0);
+
+      /* W(i+1:n,i) = tau (A22 - V W^T - W V^T) v, over the previous
+         reflectors V = A(i+1:n,0:i) of the panel */
+      gsl_blas_dsymv (CblasLower, 1.0, &A22.matrix, &v.vector, 0.0, &wi.vector);
+
+      if (i > 0)
+        {
+          gsl_matrix_view V = gsl_matrix_submatrix (A, i + 1, 0, n - i - 1, i);
+          gsl_matrix_view Wi = gsl_matrix_submatrix (W, i + 1, 0, n - i - 1, i);
+          gsl_vector_view t = gsl_matrix_subcolumn (W, i, 0, i);
+
+          gsl_blas_dgemv (CblasTrans, 1.0, &Wi.matrix, &v.vector, 0.0, &t.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &V.matrix, &t.vector, 1.0, &wi.vector);
+          gsl_blas_dgemv (CblasTrans, 1.0, &V.matrix, &v.vector, 0.0, &t.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Wi.matrix, &t.vector, 1.0, &wi.vector);
+        }
+
+      gsl_blas_dscal (tau_i, &wi.vector);
+
+      /* w := w - (1/2) tau (w' v) v */
+      gsl_blas_ddot (&wi.vector, &v.vector, &vw);
+      gsl_blas_daxpy (-0.5 * tau_i * vw, &v.vector, &wi.vector);
+    }
+}
 
 /*  Form the orthogonal matrix Q from the packed QR matrix */
 
@@ -126,6 +307,37 @@ gsl_linalg_symmtd_unpack (const gsl_matrix * A,
                           gsl_matrix * Q, 
                           gsl_vector * diag, 
                           gsl_vector * sdiag)
+{
+  gsl_linalg_workspace w;
+  int status;
+
+  if (linalg_workspace_init (&w, gsl_linalg_symmtd_unpack_wsize (A->size1)))
+    {
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  status = gsl_linalg_symmtd_unpack_ws (A, tau, Q, diag, sdiag, &w);
+
+  linalg_workspace_clear (&w);
+
+  return status;
+}
+
+/* size in doubles of the arena needed by gsl_linalg_symmtd_unpack_ws */
+
+size_t
+gsl_linalg_symmtd_unpack_wsize (const size_t N)
+{
+  return gsl_linalg_symmtd_Qmat_wsize (N, N);
+}
+
+int
+gsl_linalg_symmtd_unpack_ws (const gsl_matrix * A, 
+                             const gsl_vector * tau,
+                             gsl_matrix * Q, 
+                             gsl_vector * diag, 
+                             gsl_vector * sdiag,
+                             gsl_linalg_workspace * w)
 {
   if (A->size1 !=  A->size2)
     {
@@ -147,30 +359,23 @@ gsl_linalg_symmtd_unpack (const gsl_matrix * A,
     {
       GSL_ERROR ("size of subdiagonal must be (matrix size - 1)", GSL_EBADLEN);
     }
+  else if (linalg_workspace_avail (w) < gsl_linalg_symmtd_unpack_wsize (A->size1))
+    {
+      GSL_ERROR ("workspace is too small", GSL_EBADLEN);
+    }
   else
     {
-      const size_t N = A->size1;
       gsl_vector_const_view d = gsl_matrix_const_diagonal(A);;
       gsl_vector_const_view sd = gsl_matrix_const_subdiagonal(A, 1);;
-      size_t i;
+      double *work = linalg_workspace_get (w, gsl_linalg_symmtd_unpack_wsize (A->size1));
 
       /* Initialize Q to the identity */
 
       gsl_matrix_set_identity (Q);
 
-      for (i = N - 2; i-- > 0;)
-        {
-          gsl_vector_const_view h = gsl_matrix_const_subcolumn (A, i, i + 1, N - i - 1);
-          double ti = gsl_vector_get (tau, i);
-          gsl_matrix_view m = gsl_matrix_submatrix (Q, i + 1, i + 1, N - i - 1, N - i - 1);
-          gsl_vector_view work = gsl_vector_subvector(diag, 0, N - i - 1);
-          double * ptr = gsl_vector_ptr((gsl_vector *) &h.vector, 0);
-          double tmp = *ptr;
-
-          *ptr = 1.0;
-          gsl_linalg_householder_left (ti, &h.vector, &m.matrix, &work.vector);
-          *ptr = tmp;
-        }
+      symmtd_Q_left (A, tau, Q, 1, work);
+
+      linalg_workspace_release (w, work);
 
       /* copy diagonal into diag */
       gsl_vector_memcpy(diag, &d.vector);
@@ -182,6 +387,137 @@ gsl_linalg_symmtd_unpack (const gsl_matrix * A,
     }
 }
 
+/* B := Q B, with Q stored as the packed Householder vectors of
+   gsl_linalg_symmtd_decomp */
+
+int
+gsl_linalg_symmtd_Qmat (const gsl_matrix * A, const gsl_vector * tau, gsl_matrix * B)
+{
+  gsl_linalg_workspace w;
+  int status;
+
+  if (linalg_workspace_init (&w, gsl_linalg_symmtd_Qmat_wsize (A->size1, B->size2)))
+    {
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  status = gsl_linalg_symmtd_Qmat_ws (A, tau, B, &w);
+
+  linalg_workspace_clear (&w);
+
+  return status;
+}
+
+/* size in doubles of the arena needed by gsl_linalg_symmtd_Qmat_ws for
+   an N-by-K matrix B */
+
+size_t
+gsl_linalg_symmtd_Qmat_wsize (const size_t N, const size_t K)
+{
+  if (N < 3 || N - 2 <= WY_CROSSOVER || K == 0)
+    return 0;
+  else
+    return WY_BLOCK * (WY_BLOCK + K);
+}
+
+int
+gsl_linalg_symmtd_Qmat_ws (const gsl_matrix * A, const gsl_vector * tau, gsl_matrix * B,
+                           gsl_linalg_workspace * w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix A must be square", GSL_ENOTSQR);
+    }
+  else if (tau->size + 1 != A->size1)
+    {
+      GSL_ERROR ("size of tau must be (matrix size - 1)", GSL_EBADLEN);
+    }
+  else if (B->size1 != A->size1)
+    {
+      GSL_ERROR ("number of rows of B must match size of A", GSL_EBADLEN);
+    }
+  else if (linalg_workspace_avail (w) < gsl_linalg_symmtd_Qmat_wsize (A->size1, B->size2))
+    {
+      GSL_ERROR ("workspace is too small", GSL_EBADLEN);
+    }
+  else
+    {
+      double *work = linalg_workspace_get (w, gsl_linalg_symmtd_Qmat_wsize (A->size1, B->size2));
+      int status = symmtd_Q_left (A, tau, B, 0, work);
+
+      linalg_workspace_release (w, work);
+
+      return status;
+    }
+}
+
+/*
+symmtd_Q_left()
+  Compute B := Q B, where Q = H_0 ... H_{N-3} is stored in A and tau
+
+Notes:
+1) The reflectors are applied from last to first, in blocks of WY_BLOCK
+in the compact WY form when there are more than WY_CROSSOVER of them.
+
+2) If identity is set, B is the identity on input. Block i0 then only
+needs to be applied to the columns from i0 + 1, the others being unit
+vectors which it leaves unchanged (LAPACK dorgtr).
+
+3) work holds gsl_linalg_symmtd_Qmat_wsize(N, K) doubles.
+*/
+
+static int
+symmtd_Q_left (const gsl_matrix * A, const gsl_vector * tau, gsl_matrix * B,
+               const int identity, double * work)
+{
+  const size_t N = A->size1;
+  const size_t K = B->size2;
+  size_t i;
+
+  if (N < 3 || K == 0)
+    return GSL_SUCCESS;
+
+  if (N - 2 <= WY_CROSSOVER)
+    {
+      for (i = N - 2; i-- > 0;)
+        {
+          gsl_vector_const_view h = gsl_matrix_const_subcolumn (A, i, i + 1, N - i - 1);
+          double ti = gsl_vector_get (tau, i);
+          const size_t j0 = identity ? i + 1 : 0;
+          gsl_matrix_view m = gsl_matrix_submatrix (B, i + 1, j0, N - i - 1, K - j0);
+
+          gsl_linalg_householder_hm (ti, &h.vector, &m.matrix);
+        }
+    }
+  else
+    {
+      const size_t nb = WY_BLOCK;
+      gsl_matrix_view Tv = gsl_matrix_view_array (work, nb, nb);
+      gsl_matrix_view Wv = gsl_matrix_view_array (work + nb * nb, nb, K);
+      gsl_matrix *T = &Tv.matrix, *W = &Wv.matrix;
+      size_t i0;
+
+      for (i0 = ((N - 3) / nb) * nb; ; i0 -= nb)
+        {
+          const size_t ib = GSL_MIN (nb, N - 2 - i0);
+          const size_t j0 = identity ? i0 + 1 : 0;
+          gsl_matrix_const_view Vb = gsl_matrix_const_submatrix (A, i0 + 1, i0, N - i0 - 1, ib);
+          gsl_vector_const_view t = gsl_vector_const_subvector (tau, i0, ib);
+          gsl_matrix_view Tb = gsl_matrix_submatrix (T, 0, 0, ib, ib);
+          gsl_matrix_view C = gsl_matrix_submatrix (B, i0 + 1, j0, N - i0 - 1, K - j0);
+          gsl_matrix_view Wb = gsl_matrix_submatrix (W, 0, 0, ib, K - j0);
+
+          linalg_wy_T_col (&Vb.matrix, &t.vector, &Tb.matrix);
+          linalg_wy_left_col (CblasNoTrans, &Vb.matrix, &Tb.matrix, &C.matrix, &Wb.matrix);
+
+          if (i0 == 0)
+            break;
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
 int
 gsl_linalg_symmtd_unpack_T (const gsl_matrix * A, 
                             gsl_vector * diag, 
@@ -31,6 +31,14 @@
 #include <gsl/gsl_complex_math.h>
 #include <gsl/gsl_linalg.h>
 #include <gsl/gsl_rng.h>
+#include <gsl/gsl_cblas.h>
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+#include "../sys/thread_pool.h"
+#include "../cblas/thread.h"
 
 #define TEST_SVD_4X4 1
 
@@ -73,8 +81,11 @@ int test_SV_decomp_dim(const gsl_matrix * m, double eps);
 int test_SV_decomp(void);
 int test_SV_decomp_mod_dim(const gsl_matrix * m, double eps);
 int test_SV_decomp_mod(void);
+int test_SV_decomp_random(void);
 int test_SV_decomp_jacobi_dim(const gsl_matrix * m, double eps);
 int test_SV_decomp_jacobi(void);
+int test_SV_decomp_jacobi_par(void);
+int test_rsvd(void);
 int test_cholesky_solve_dim(const gsl_matrix * m, const double * actual, double eps);
 int test_cholesky_solve(void);
 int test_HH_solve_dim(const gsl_matrix * m, const double * actual, double eps);
@@ -88,6 +99,8 @@ int test_TDS_cyc_solve_one(const unsigned long dim, const double * d, const doub
 int test_TDS_cyc_solve(void);
 int test_TDN_cyc_solve_dim(unsigned long dim, double d, double a, double b, const double * actual, double eps);
 int test_TDN_cyc_solve(void);
+int test_TDN_batch(void);
+int test_TDN_par(void);
 int test_bidiag_decomp_dim(const gsl_matrix * m, double eps);
 int test_bidiag_decomp(void);
 
@@ -393,6 +406,7 @@ gsl_matrix * moler10;
 #include "test_ldlt.c"
 #include "test_lu.c"
 #include "test_luc.c"
+#include "test_matfunc.c"
 #include "test_lq.c"
 #include "test_tri.c"
 #include "test_ql.c"
@@ -2055,6 +2069,38 @@ int test_SV_decomp_mod(void)
   return s;
 }
 
+/* random matrices large enough for the blocked reductions */
+int test_SV_decomp_random(void)
+{
+  const size_t dims[][2] = { { 150, 100 }, { 200, 200 }, { 400, 90 } };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  int f;
+  int s = 0;
+  size_t i;
+
+  for (i = 0; i < sizeof (dims) / sizeof (dims[0]); i++)
+    {
+      const size_t M = dims[i][0], N = dims[i][1];
+      gsl_matrix * A = gsl_matrix_alloc (M, N);
+
+      create_random_matrix (A, r);
+
+      f = test_SV_decomp_dim(A, 1.0e6 * M * GSL_DBL_EPSILON);
+      gsl_test(f, "  SV_decomp random(%zu,%zu)", M, N);
+      s += f;
+
+      f = test_SV_decomp_mod_dim(A, 1.0e6 * M * GSL_DBL_EPSILON);
+      gsl_test(f, "  SV_decomp_mod random(%zu,%zu)", M, N);
+      s += f;
+
+      gsl_matrix_free (A);
+    }
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
 
 int
 test_SV_decomp_jacobi_dim(const gsl_matrix * m, double eps)
@@ -2987,15 +3033,534 @@ int test_TDN_cyc_solve(void)
   return s;
 }
 
+/* fill a diagonally dominant tridiagonal system */
+static void
+create_tridiag_system(gsl_vector * diag, gsl_vector * abovediag, gsl_vector * belowdiag,
+                      gsl_vector * rhs, gsl_rng * r)
+{
+  const size_t N = diag->size;
+  size_t i;
+
+  for (i = 0; i < N; i++)
+    {
+      gsl_vector_set(diag, i, 2.5 + gsl_rng_uniform(r));
+      gsl_vector_set(rhs, i, 2.0 * gsl_rng_uniform(r) - 1.0);
+
+      if (i < N - 1)
+        {
+          gsl_vector_set(abovediag, i, 2.0 * gsl_rng_uniform(r) - 1.0);
+          gsl_vector_set(belowdiag, i, 2.0 * gsl_rng_uniform(r) - 1.0);
+        }
+    }
+}
+
+/* compare the batched solver with gsl_linalg_solve_tridiag on each column */
+int
+test_TDN_batch(void)
+{
+  int s = 0;
+  const size_t N[] = { 1, 2, 5, 100 };
+  const size_t K[] = { 1, 7, 64 };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  size_t in, ik, i, k;
+
+  for (in = 0; in < sizeof(N) / sizeof(N[0]); ++in)
+    {
+      for (ik = 0; ik < sizeof(K) / sizeof(K[0]); ++ik)
+        {
+          const size_t n = N[in];
+          const size_t nk = K[ik];
+          const size_t n1 = GSL_MAX(n - 1, 1);
+          gsl_matrix * diag = gsl_matrix_alloc(n, nk);
+          gsl_matrix * above = gsl_matrix_alloc(n1, nk);
+          gsl_matrix * below = gsl_matrix_alloc(n1, nk);
+          gsl_matrix * B = gsl_matrix_alloc(n, nk);
+          gsl_matrix * X = gsl_matrix_alloc(n, nk);
+          gsl_vector * x = gsl_vector_alloc(n);
+          double dmax = 0.0;
+
+          for (k = 0; k < nk; ++k)
+            {
+              gsl_vector_view d = gsl_matrix_column(diag, k);
+              gsl_vector_view a = gsl_matrix_column(above, k);
+              gsl_vector_view b = gsl_matrix_column(below, k);
+              gsl_vector_view rhs = gsl_matrix_column(B, k);
+
+              if (n > 1)
+                create_tridiag_system(&d.vector, &a.vector, &b.vector, &rhs.vector, r);
+              else
+                {
+                  gsl_vector_set(&d.vector, 0, 2.5 + gsl_rng_uniform(r));
+                  gsl_vector_set(&rhs.vector, 0, gsl_rng_uniform(r));
+                }
+            }
+
+          s += gsl_linalg_solve_tridiag_batch(diag, above, below, B, X);
+
+          for (k = 0; k < nk; ++k)
+            {
+              gsl_vector_view d = gsl_matrix_column(diag, k);
+              gsl_vector_view rhs = gsl_matrix_column(B, k);
+
+              if (n > 1)
+                {
+                  gsl_vector_view a = gsl_matrix_subcolumn(above, k, 0, n - 1);
+                  gsl_vector_view b = gsl_matrix_subcolumn(below, k, 0, n - 1);
+                  s += gsl_linalg_solve_tridiag(&d.vector, &a.vector, &b.vector, &rhs.vector, x);
+                }
+              else
+                gsl_vector_set(x, 0, gsl_vector_get(&rhs.vector, 0) / gsl_vector_get(&d.vector, 0));
+
+              for (i = 0; i < n; ++i)
+                dmax = GSL_MAX(dmax, fabs(gsl_matrix_get(X, i, k) - gsl_vector_get(x, i)));
+            }
+
+          gsl_test(dmax > 16.0 * GSL_DBL_EPSILON, "  solve_tridiag_batch N=%lu K=%lu", n, nk);
+          s += dmax > 16.0 * GSL_DBL_EPSILON;
+
+          /* in place */
+          s += gsl_linalg_solve_tridiag_batch(diag, above, below, B, B);
+          gsl_test(!gsl_matrix_equal(B, X), "  solve_tridiag_batch in place N=%lu K=%lu", n, nk);
+
+          gsl_matrix_free(diag);
+          gsl_matrix_free(above);
+          gsl_matrix_free(below);
+          gsl_matrix_free(B);
+          gsl_matrix_free(X);
+          gsl_vector_free(x);
+        }
+    }
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
+/* compare gsl_linalg_SV_decomp_jacobi_par with the serial Jacobi SVD,
+   and check A = U S V^T and V^T V = I */
+static int
+test_SV_decomp_jacobi_par_dim(const gsl_matrix * m, gsl_thread_pool * pool,
+                              const double eps, const char * desc)
+{
+  int s = 0;
+  const size_t M = m->size1, N = m->size2;
+  gsl_matrix * u = gsl_matrix_alloc(M, N);
+  gsl_matrix * a = gsl_matrix_alloc(M, N);
+  gsl_matrix * q = gsl_matrix_alloc(N, N);
+  gsl_matrix * qtq = gsl_matrix_alloc(N, N);
+  gsl_vector * d = gsl_vector_alloc(N);
+  gsl_vector * d0 = gsl_vector_alloc(N);
+  double dmax;
+  size_t i, j;
+
+  gsl_matrix_memcpy(a, m);
+  gsl_linalg_SV_decomp_jacobi(a, q, d0);
+
+  gsl_matrix_memcpy(u, m);
+  s += gsl_linalg_SV_decomp_jacobi_par(u, q, d, pool);
+
+  dmax = gsl_vector_get(d0, 0);
+
+  for (i = 0; i < N; i++)
+    {
+      double di = gsl_vector_get(d, i);
+
+      gsl_test_abs(di, gsl_vector_get(d0, i), eps * dmax, "%s (%lu,%lu) S[%lu]", desc, M, N, i);
+
+      if (i > 0 && di > gsl_vector_get(d, i - 1))
+        {
+          s++;
+          printf("singular value %lu = %22.18g vs previous %22.18g\n", i, di, gsl_vector_get(d, i - 1));
+        }
+    }
+
+  /* V^T V = I */
+  gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, q, q, 0.0, qtq);
+
+  for (i = 0; i < N; i++)
+    {
+      for (j = 0; j < N; j++)
+        gsl_test_abs(gsl_matrix_get(qtq, i, j), (double) (i == j), eps,
+                     "%s (%lu,%lu) V^T V [%lu,%lu]", desc, M, N, i, j);
+    }
+
+  /* A = U S V^T */
+  for (j = 0; j < N; j++)
+    {
+      gsl_vector_view c = gsl_matrix_column(u, j);
+      gsl_blas_dscal(gsl_vector_get(d, j), &c.vector);
+    }
+
+  gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, u, q, 0.0, a);
+
+  for (i = 0; i < M; i++)
+    {
+      for (j = 0; j < N; j++)
+        gsl_test_abs(gsl_matrix_get(a, i, j), gsl_matrix_get(m, i, j), eps * dmax,
+                     "%s (%lu,%lu) A [%lu,%lu]", desc, M, N, i, j);
+    }
+
+  gsl_matrix_free(u);
+  gsl_matrix_free(a);
+  gsl_matrix_free(q);
+  gsl_matrix_free(qtq);
+  gsl_vector_free(d);
+  gsl_vector_free(d0);
+
+  return s;
+}
+
+/* CBLAS task: record whether it runs in the thread which submitted
+   the job */
+static void
+test_thread_pool_cblas_task(void * arg, const int t)
+{
+#ifdef HAVE_PTHREAD
+  pthread_t * caller = (pthread_t *) arg;
+  volatile double x = 0.0;
+  int i;
+
+  /* long enough for the CBLAS workers to take some of the tasks */
+  for (i = 0; i < 100000 * (t + 1); ++i)
+    x += 1.0;
+
+  caller[1] = pthread_equal(pthread_self(), caller[0]) ? caller[1] : pthread_self();
+#else
+  (void) arg;
+  (void) t;
+#endif
+}
+
+/* record, for each task, whether it runs on a pool worker and, if so,
+   whether the CBLAS jobs it submits stay in its thread */
+static void
+test_thread_pool_task(void * arg, const size_t t)
+{
+  int * flags = (int *) arg;
+
+  flags[2 * t] = gsl_thread_pool_in_worker();
+  flags[2 * t + 1] = 1;
+
+#ifdef HAVE_PTHREAD
+  if (flags[2 * t])
+    {
+      pthread_t caller[2];
+
+      caller[0] = caller[1] = pthread_self();
+      gsl_cblas_parallel_for(16, test_thread_pool_cblas_task, caller);
+      flags[2 * t + 1] = pthread_equal(caller[0], caller[1]);
+    }
+#endif
+}
+
+int
+test_thread_pool(void)
+{
+  int s = 0;
+  gsl_thread_pool * pool = gsl_thread_pool_alloc(4);
+  const int cblas_nthreads = gsl_cblas_get_num_threads();
+  const int expected = (gsl_thread_pool_nthreads(pool) > 1);
+  int flags[16];
+  size_t t;
+
+  gsl_cblas_set_num_threads(4);
+
+  s += gsl_thread_pool_in_worker();
+
+  /* a parallel job marks its threads, and the CBLAS jobs submitted
+     from them do not use the CBLAS threads */
+  thread_pool_run(pool, 8, test_thread_pool_task, flags);
+
+  for (t = 0; t < 8; ++t)
+    {
+      gsl_test(flags[2 * t] != expected, "thread_pool in_worker task %zu", t);
+      gsl_test(!flags[2 * t + 1], "thread_pool serial CBLAS job task %zu", t);
+      s += (flags[2 * t] != expected) + !flags[2 * t + 1];
+    }
+
+  /* jobs run serially by the calling thread are not marked */
+  thread_pool_run(NULL, 8, test_thread_pool_task, flags);
+
+  for (t = 0; t < 8; ++t)
+    s += flags[2 * t];
+
+  s += gsl_thread_pool_in_worker();
+
+  gsl_cblas_set_num_threads(cblas_nthreads);
+  gsl_thread_pool_free(pool);
+
+  return s;
+}
+
+int
+test_SV_decomp_jacobi_par(void)
+{
+  int s = 0;
+  const size_t dims[][2] = { { 1, 1 }, { 5, 3 }, { 64, 64 }, { 100, 70 }, { 200, 137 }, { 300, 300 } };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  gsl_thread_pool * pool = gsl_thread_pool_alloc(4);
+  size_t i;
+
+  s += test_SV_decomp_jacobi_par_dim(m53, pool, 1.0e3 * GSL_DBL_EPSILON, "SV_decomp_jacobi_par m(5,3)");
+  s += test_SV_decomp_jacobi_par_dim(moler10, NULL, 1.0e3 * GSL_DBL_EPSILON, "SV_decomp_jacobi_par moler(10)");
+  s += test_SV_decomp_jacobi_par_dim(hilb12, pool, 1.0e3 * GSL_DBL_EPSILON, "SV_decomp_jacobi_par hilbert(12)");
+  s += test_SV_decomp_jacobi_par_dim(vander12, pool, 1.0e3 * GSL_DBL_EPSILON, "SV_decomp_jacobi_par vander(12)");
+  s += test_SV_decomp_jacobi_par_dim(row5, pool, 1.0e3 * GSL_DBL_EPSILON, "SV_decomp_jacobi_par row5");
+
+  for (i = 0; i < sizeof(dims) / sizeof(dims[0]); ++i)
+    {
+      gsl_matrix * m = gsl_matrix_alloc(dims[i][0], dims[i][1]);
+
+      create_random_matrix(m, r);
+      s += test_SV_decomp_jacobi_par_dim(m, pool, 1.0e4 * GSL_DBL_EPSILON, "SV_decomp_jacobi_par random");
+      s += test_SV_decomp_jacobi_par_dim(m, NULL, 1.0e4 * GSL_DBL_EPSILON, "SV_decomp_jacobi_par random serial");
+
+      gsl_matrix_free(m);
+    }
+
+  gsl_thread_pool_free(pool);
+  gsl_rng_free(r);
+
+  return s;
+}
+
+/* y = op(A) x for the operator form of the randomized SVD */
+static int
+rsvd_matvec(CBLAS_TRANSPOSE_t TransA, const gsl_vector * x, gsl_vector * y, void * params)
+{
+  const gsl_matrix * A = (const gsl_matrix *) params;
+  return gsl_blas_dgemv(TransA, 1.0, A, x, 0.0, y);
+}
+
+/* max |Q^T Q - I| for a matrix Q with orthonormal columns */
+static double
+rsvd_orth_err(const gsl_matrix * Q)
+{
+  const size_t n = Q->size2;
+  gsl_matrix * QTQ = gsl_matrix_alloc(n, n);
+  double err = 0.0;
+  size_t i, j;
+
+  gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, Q, Q, 0.0, QTQ);
+
+  for (i = 0; i < n; ++i)
+    {
+      for (j = 0; j < n; ++j)
+        err = GSL_MAX(err, fabs(gsl_matrix_get(QTQ, i, j) - (i == j)));
+    }
+
+  gsl_matrix_free(QTQ);
+
+  return err;
+}
+
+static double
+rsvd_maxabs(const gsl_matrix * A)
+{
+  double amin, amax;
+  gsl_matrix_minmax(A, &amin, &amax);
+  return GSL_MAX(fabs(amin), fabs(amax));
+}
+
+/*
+ * A = U0 diag(s0) V0^T with random orthonormal U0, V0 and s0(i) = 2^{-i},
+ * i < rank; the rank k approximation must reproduce the k largest
+ * singular values, and A itself when k >= rank
+ */
+static int
+test_rsvd_eps(const size_t M, const size_t N, const size_t rank, const size_t k,
+              const size_t q, const double eps, gsl_rng * r)
+{
+  int s = 0;
+  const size_t p = 6;
+  gsl_matrix * A = gsl_matrix_alloc(M, N);
+  gsl_matrix * U0 = gsl_matrix_alloc(M, rank);
+  gsl_matrix * V0 = gsl_matrix_alloc(N, rank);
+  gsl_matrix * T = gsl_matrix_alloc(rank, rank);
+  gsl_matrix * U = gsl_matrix_alloc(M, k);
+  gsl_matrix * V = gsl_matrix_alloc(N, k);
+  gsl_vector * S = gsl_vector_alloc(k);
+  gsl_matrix * U2 = gsl_matrix_alloc(M, k);
+  gsl_matrix * V2 = gsl_matrix_alloc(N, k);
+  gsl_vector * S2 = gsl_vector_alloc(k);
+  gsl_matrix * Q = gsl_matrix_alloc(M, k + p);
+  gsl_linalg_rsvd_workspace * w = gsl_linalg_rsvd_alloc(M, N, k, p);
+  gsl_rng * r2 = gsl_rng_clone(r);
+  double err;
+  size_t i, j;
+
+  create_random_matrix(U0, r);
+  gsl_linalg_QR_decomp_r(U0, T);
+  gsl_linalg_QR_Q1_r(U0, T, U0);
+
+  create_random_matrix(V0, r);
+  gsl_linalg_QR_decomp_r(V0, T);
+  gsl_linalg_QR_Q1_r(V0, T, V0);
+
+  for (j = 0; j < rank; ++j)
+    {
+      gsl_vector_view c = gsl_matrix_column(U0, j);
+      gsl_blas_dscal(pow(2.0, -(double) j), &c.vector);
+    }
+
+  gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, U0, V0, 0.0, A);
+
+  /* matrix and operator forms with the same random sketch */
+  gsl_rng_memcpy(r2, r);
+  s += gsl_linalg_rsvd_decomp(A, q, r, U, S, V, w);
+  s += gsl_linalg_rsvd_decomp_op(rsvd_matvec, A, q, r2, U2, S2, V2, w);
+
+  for (i = 0; i < k; ++i)
+    {
+      double si = gsl_vector_get(S, i);
+      double s2i = gsl_vector_get(S2, i);
+      double ei = (i < rank) ? pow(2.0, -(double) i) : 0.0;
+
+      gsl_test_abs(si, ei, eps, "rsvd (%lu,%lu) rank=%lu k=%lu q=%lu S[%lu]",
+                   M, N, rank, k, q, i);
+      gsl_test_abs(s2i, si, 1.0e3 * GSL_DBL_EPSILON, "rsvd_op (%lu,%lu) rank=%lu k=%lu q=%lu S[%lu]",
+                   M, N, rank, k, q, i);
+    }
+
+  err = rsvd_orth_err(U);
+  gsl_test(err > 1.0e3 * GSL_DBL_EPSILON, "rsvd (%lu,%lu) k=%lu U orthonormal: %e", M, N, k, err);
+  s += err > 1.0e3 * GSL_DBL_EPSILON;
+
+  err = rsvd_orth_err(V);
+  gsl_test(err > 1.0e3 * GSL_DBL_EPSILON, "rsvd (%lu,%lu) k=%lu V orthonormal: %e", M, N, k, err);
+  s += err > 1.0e3 * GSL_DBL_EPSILON;
+
+  if (k >= rank)
+    {
+      /* A = U S V^T */
+      for (j = 0; j < k; ++j)
+        {
+          gsl_vector_view c = gsl_matrix_column(U, j);
+          gsl_blas_dscal(gsl_vector_get(S, j), &c.vector);
+        }
+
+      gsl_blas_dgemm(CblasNoTrans, CblasTrans, -1.0, U, V, 1.0, A);
+
+      err = rsvd_maxabs(A);
+      gsl_test(err > eps, "rsvd (%lu,%lu) rank=%lu k=%lu reconstruction: %e", M, N, rank, k, err);
+      s += err > eps;
+
+      /* range finder: A = Q Q^T A */
+      gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, U0, V0, 0.0, A);
+      s += gsl_linalg_rsvd_range(A, q, r, Q, w);
+
+      err = rsvd_orth_err(Q);
+      gsl_test(err > 1.0e3 * GSL_DBL_EPSILON, "rsvd_range (%lu,%lu) Q orthonormal: %e", M, N, err);
+      s += err > 1.0e3 * GSL_DBL_EPSILON;
+
+      {
+        gsl_matrix * B = gsl_matrix_alloc(k + p, N);
+
+        gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, Q, A, 0.0, B);
+        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, -1.0, Q, B, 1.0, A);
+
+        err = rsvd_maxabs(A);
+        gsl_test(err > eps, "rsvd_range (%lu,%lu) rank=%lu A - Q Q^T A: %e", M, N, rank, err);
+        s += err > eps;
+
+        gsl_matrix_free(B);
+      }
+    }
+
+  gsl_matrix_free(A);
+  gsl_matrix_free(U0);
+  gsl_matrix_free(V0);
+  gsl_matrix_free(T);
+  gsl_matrix_free(U);
+  gsl_matrix_free(V);
+  gsl_vector_free(S);
+  gsl_matrix_free(U2);
+  gsl_matrix_free(V2);
+  gsl_vector_free(S2);
+  gsl_matrix_free(Q);
+  gsl_linalg_rsvd_free(w);
+  gsl_rng_free(r2);
+
+  return s;
+}
+
+int
+test_rsvd(void)
+{
+  int s = 0;
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+
+  /* exact low rank */
+  s += test_rsvd_eps(300, 120, 8, 8, 0, 1.0e-12, r);
+  s += test_rsvd_eps(120, 300, 8, 10, 1, 1.0e-12, r);
+  s += test_rsvd_eps(50, 50, 1, 1, 0, 1.0e-12, r);
+
+  /* truncation of a decaying spectrum: the error in S(i) is bounded by
+     about S(k+1) = 2^{-k}, and decreases with power iterations */
+  s += test_rsvd_eps(400, 200, 40, 10, 2, 1.0e-4, r);
+  s += test_rsvd_eps(200, 400, 40, 10, 4, 1.0e-6, r);
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
+/* compare the partitioned solver with gsl_linalg_solve_tridiag */
+int
+test_TDN_par(void)
+{
+  int s = 0;
+  const size_t N[] = { 100, 2048, 5000, 100003 };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  gsl_thread_pool * pool = gsl_thread_pool_alloc(4);
+  size_t in, i;
+
+  for (in = 0; in < sizeof(N) / sizeof(N[0]); ++in)
+    {
+      const size_t n = N[in];
+      gsl_vector * diag = gsl_vector_alloc(n);
+      gsl_vector * above = gsl_vector_alloc(n - 1);
+      gsl_vector * below = gsl_vector_alloc(n - 1);
+      gsl_vector * rhs = gsl_vector_alloc(n);
+      gsl_vector * x = gsl_vector_alloc(n);
+      gsl_vector * y = gsl_vector_alloc(n);
+      double dmax = 0.0;
+
+      create_tridiag_system(diag, above, below, rhs, r);
+
+      s += gsl_linalg_solve_tridiag(diag, above, below, rhs, x);
+      s += gsl_linalg_solve_tridiag_par(diag, above, below, rhs, y, pool);
+
+      for (i = 0; i < n; ++i)
+        dmax = GSL_MAX(dmax, fabs(gsl_vector_get(x, i) - gsl_vector_get(y, i)));
+
+      gsl_test(dmax > 64.0 * GSL_DBL_EPSILON, "  solve_tridiag_par N=%lu", n);
+      s += dmax > 64.0 * GSL_DBL_EPSILON;
+
+      gsl_vector_free(diag);
+      gsl_vector_free(above);
+      gsl_vector_free(below);
+      gsl_vector_free(rhs);
+      gsl_vector_free(x);
+      gsl_vector_free(y);
+    }
+
+  gsl_thread_pool_free(pool);
+  gsl_rng_free(r);
+
+  return s;
+}
+
 int
 test_bidiag_decomp_dim(const gsl_matrix * m, double eps)
 {
   int s = 0;
-  unsigned long i,j,k,r, M = m->size1, N = m->size2;
+  unsigned long i,j, M = m->size1, N = m->size2;
 
   gsl_matrix * A  = gsl_matrix_alloc(M,N);
   gsl_matrix * a  = gsl_matrix_alloc(M,N);
   gsl_matrix * b  = gsl_matrix_alloc(N,N);
+  gsl_matrix * c  = gsl_matrix_alloc(N,N);
 
   gsl_matrix * u  = gsl_matrix_alloc(M,N);
   gsl_matrix * v  = gsl_matrix_alloc(N,N);
@@ -3015,24 +3580,9 @@ test_bidiag_decomp_dim(const gsl_matrix * m, double eps)
   for (i = 0; i < N-1; i++) gsl_matrix_set(b, i,i+1, gsl_vector_get(sd,i));
   
   /* Compute A = U B V^T */
-  
-  for (i = 0; i < M ; i++)
-    {
-      for (j = 0; j < N; j++)
-        {
-          double sum = 0;
 
-          for (k = 0; k < N; k++)
-            {
-              for (r = 0; r < N; r++)
-                {
-                  sum += gsl_matrix_get(u, i, k) * gsl_matrix_get (b, k, r)
-                    * gsl_matrix_get(v, j, r);
-                }
-            }
-          gsl_matrix_set (a, i, j, sum);
-        }
-    }
+  gsl_blas_dgemm (CblasNoTrans, CblasTrans, 1.0, b, v, 0.0, c);
+  gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, u, c, 0.0, a);
 
   for(i=0; i<M; i++) {
     for(j=0; j<N; j++) {
@@ -3051,6 +3601,7 @@ test_bidiag_decomp_dim(const gsl_matrix * m, double eps)
   gsl_matrix_free(u);
   gsl_matrix_free(v);
   gsl_matrix_free(b);
+  gsl_matrix_free(c);
   gsl_vector_free(tau1);
   gsl_vector_free(tau2);
   gsl_vector_free(d);
@@ -3061,8 +3612,25 @@ test_bidiag_decomp_dim(const gsl_matrix * m, double eps)
 
 int test_bidiag_decomp(void)
 {
+  /* the larger sizes use the blocked algorithm */
+  const size_t dims[][2] = { { 130, 100 }, { 200, 200 }, { 301, 97 } };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
   int f;
   int s = 0;
+  size_t i;
+
+  for (i = 0; i < sizeof (dims) / sizeof (dims[0]); i++)
+    {
+      const size_t M = dims[i][0], N = dims[i][1];
+      gsl_matrix * A = gsl_matrix_alloc (M, N);
+
+      create_random_matrix (A, r);
+      f = test_bidiag_decomp_dim(A, 1.0e6 * M * GSL_DBL_EPSILON);
+      gsl_test(f, "  bidiag_decomp random(%zu,%zu)", M, N);
+      s += f;
+
+      gsl_matrix_free (A);
+    }
 
   f = test_bidiag_decomp_dim(m53, 2 * 64.0 * GSL_DBL_EPSILON);
   gsl_test(f, "  bidiag_decomp m(5,3)");
@@ -3088,6 +3656,8 @@ int test_bidiag_decomp(void)
   gsl_test(f, "  bidiag_decomp hilbert(12)");
   s += f;
 
+  gsl_rng_free(r);
+
   return s;
 }
 
@@ -3176,6 +3746,133 @@ test_tri_invert(gsl_rng * r)
   return s;
 }
 
+/* compare the _ws variants, sharing one arena, with the routines which
+   allocate their own workspace */
+static int
+test_ws_eps(const size_t M, const size_t N, gsl_linalg_workspace * w, gsl_rng * r)
+{
+  int s = 0;
+  gsl_matrix *A = gsl_matrix_alloc(M, N);
+  gsl_matrix *B = gsl_matrix_alloc(M, N);
+  gsl_matrix *S = gsl_matrix_alloc(N, N);
+  gsl_matrix *T = gsl_matrix_alloc(N, N);
+  gsl_matrix *Q = gsl_matrix_alloc(N, N);
+  gsl_matrix *V = gsl_matrix_alloc(N, N);
+  gsl_matrix *V2 = gsl_matrix_alloc(N, N);
+  gsl_vector *tau = gsl_vector_alloc(N);
+  gsl_vector *tau2 = gsl_vector_alloc(N);
+  gsl_vector *d = gsl_vector_alloc(N);
+  gsl_vector *e = gsl_vector_alloc(N - 1);
+  gsl_vector *e2 = gsl_vector_alloc(N - 1);
+  gsl_vector *b = gsl_vector_alloc(M);
+  gsl_vector *x = gsl_vector_alloc(N);
+  gsl_vector *x2 = gsl_vector_alloc(N);
+  gsl_vector *work = gsl_vector_alloc(N);
+  gsl_vector_view tau1 = gsl_vector_subvector(tau, 0, N - 1);
+  gsl_vector_view tau21 = gsl_vector_subvector(tau2, 0, N - 1);
+  gsl_matrix_view AN = gsl_matrix_submatrix(A, 0, 0, N, N);
+
+  create_random_matrix(A, r);
+  create_random_vector(b, r);
+
+  /* Hessenberg */
+  gsl_matrix_memcpy(S, &AN.matrix);
+  gsl_matrix_memcpy(T, S);
+  gsl_linalg_hessenberg_decomp(S, tau);
+  s += gsl_linalg_hessenberg_decomp_ws(T, tau2, w);
+  s += !gsl_matrix_equal(S, T) || !gsl_vector_equal(tau, tau2);
+  gsl_test(s, "  hessenberg_decomp_ws N=%zu", N);
+
+  /* symmetric tridiagonal */
+  create_symm_matrix(S, r);
+  gsl_matrix_memcpy(T, S);
+  gsl_linalg_symmtd_decomp(S, &tau1.vector);
+  s += gsl_linalg_symmtd_decomp_ws(T, &tau21.vector, w);
+  gsl_linalg_symmtd_unpack(S, &tau1.vector, Q, d, e);
+  s += gsl_linalg_symmtd_unpack_ws(T, &tau21.vector, V, x, e2, w);
+  s += !gsl_matrix_equal(Q, V) || !gsl_vector_equal(d, x) || !gsl_vector_equal(e, e2);
+  gsl_test(s, "  symmtd_ws N=%zu", N);
+
+  /* SVD and solve */
+  gsl_matrix_memcpy(B, A);
+  gsl_linalg_SV_decomp(A, V, d, work);
+  s += gsl_linalg_SV_decomp_ws(B, V2, x, work, w);
+  s += !gsl_matrix_equal(A, B) || !gsl_matrix_equal(V, V2) || !gsl_vector_equal(d, x);
+  gsl_linalg_SV_solve(A, V, d, b, x);
+  s += gsl_linalg_SV_solve_ws(B, V2, d, b, x2, w);
+  s += !gsl_vector_equal(x, x2);
+  gsl_test(s, "  SV_decomp_ws M=%zu N=%zu", M, N);
+
+  /* tridiagonal systems */
+  {
+    gsl_vector_view dd = gsl_matrix_diagonal(Q);
+    gsl_vector_view bb = gsl_vector_subvector(b, 0, N);
+
+    gsl_vector_set_all(&dd.vector, 4.0);
+    create_random_vector(e, r);
+    create_random_vector(e2, r);
+    gsl_linalg_solve_tridiag(&dd.vector, e, e2, &bb.vector, x);
+    s += gsl_linalg_solve_tridiag_ws(&dd.vector, e, e2, &bb.vector, x2, w);
+    s += !gsl_vector_equal(x, x2);
+    gsl_test(s, "  solve_tridiag_ws N=%zu", N);
+  }
+
+  /* the arena is now empty again; check that one too small is rejected */
+  s += (w->used != 0);
+  {
+    gsl_linalg_workspace w0 = { 0, 0, NULL };
+
+    if (gsl_linalg_HH_svx_wsize(N) > 0)
+      s += (gsl_linalg_HH_svx_ws(S, x, &w0) != GSL_EBADLEN);
+  }
+  gsl_test(s, "  workspace too small N=%zu", N);
+
+  gsl_matrix_free(A);
+  gsl_matrix_free(B);
+  gsl_matrix_free(S);
+  gsl_matrix_free(T);
+  gsl_matrix_free(Q);
+  gsl_matrix_free(V);
+  gsl_matrix_free(V2);
+  gsl_vector_free(tau);
+  gsl_vector_free(tau2);
+  gsl_vector_free(d);
+  gsl_vector_free(e);
+  gsl_vector_free(e2);
+  gsl_vector_free(b);
+  gsl_vector_free(x);
+  gsl_vector_free(x2);
+  gsl_vector_free(work);
+
+  return s;
+}
+
+int
+test_ws(gsl_rng * r)
+{
+  const size_t Mmax = 150, Nmax = 100;
+  size_t n = gsl_linalg_hessenberg_decomp_wsize(Nmax);
+  gsl_linalg_workspace *w;
+  int s = 0;
+
+  n = GSL_MAX(n, gsl_linalg_symmtd_decomp_wsize(Nmax));
+  n = GSL_MAX(n, gsl_linalg_symmtd_unpack_wsize(Nmax));
+  n = GSL_MAX(n, gsl_linalg_SV_decomp_wsize(Mmax, Nmax));
+  n = GSL_MAX(n, gsl_linalg_SV_solve_wsize(Mmax, Nmax));
+  n = GSL_MAX(n, gsl_linalg_tridiag_wsize(Nmax));
+
+  w = gsl_linalg_workspace_alloc(n);
+
+  s += test_ws_eps(5, 3, w, r);
+  s += test_ws_eps(20, 20, w, r);
+  s += test_ws_eps(Mmax, Nmax, w, r);
+  s += test_ws_eps(Nmax, Nmax, w, r);
+
+  gsl_linalg_workspace_free(w);
+
+  return s;
+}
+
 void
 my_error_handler (const char *reason, const char *file, int line, int err)
 {
@@ -3251,8 +3948,13 @@ main(void)
 
   gsl_test(test_bidiag_decomp(),         "Bidiagonal Decomposition");
   gsl_test(test_LU_decomp(r),            "LU Decomposition");
+  gsl_test(test_LU_decomp_par(),         "LU Decomposition (parallel)");
+  gsl_test(test_LU_mixed(),              "LU Mixed Precision Solve");
+  gsl_test(test_LU_band(),               "Banded LU Decomposition");
   gsl_test(test_LU_solve(r),             "LU Solve");
   gsl_test(test_LU_invert(r),            "LU Inverse");
+  gsl_test(test_LU_rcond(),              "LU Condition Estimate");
+  gsl_test(test_LU_ferr(),               "LU Forward Error Bound");
   gsl_test(test_LUc_decomp(r),           "Complex LU Decomposition");
   gsl_test(test_LUc_solve(r),            "Complex LU Solve");
   gsl_test(test_LUc_invert(r),           "Complex LU Inverse");
@@ -3268,6 +3970,7 @@ main(void)
   gsl_test(test_QR_QTmat_r(r),           "QR QTmat (recursive)");
   gsl_test(test_QR_solve_r(r),           "QR Solve (recursive)");
   gsl_test(test_QR_lssolve_r(r),         "QR LS Solve (recursive)");
+  gsl_test(test_QR_decomp_tsqr(),        "QR Decomposition (TSQR)");
 
   gsl_test(test_QRc_decomp_r(r),         "Complex QR Decomposition (recursive)");
   gsl_test(test_QRc_solve_r(r),          "Complex QR Solve (recursive)");
@@ -3301,13 +4004,25 @@ main(void)
 
   gsl_test(test_SV_decomp(),             "Singular Value Decomposition");
   gsl_test(test_SV_decomp_jacobi(),      "Singular Value Decomposition (Jacobi)");
+  gsl_test(test_thread_pool(),           "Thread pool workers");
+  gsl_test(test_SV_decomp_jacobi_par(),  "Singular Value Decomposition (parallel Jacobi)");
   gsl_test(test_SV_decomp_mod(),         "Singular Value Decomposition (Mod)");
+  gsl_test(test_SV_decomp_random(),      "Singular Value Decomposition (random)");
   gsl_test(test_SV_solve(),              "SVD Solve");
+  gsl_test(test_ws(r),                   "Workspace arena variants");
+  gsl_test(test_rsvd(),                  "Randomized SVD");
+  gsl_test(test_expm(),                  "Matrix Exponential");
+  gsl_test(test_expmv(),                 "Matrix Exponential Krylov Action");
+  gsl_test(test_sqrtm_logm(),            "Matrix Square Root and Logarithm");
 
   gsl_test(test_cholesky_decomp_unit(),  "Cholesky Decomposition [unit triangular]");
   gsl_test(test_cholesky_solve(),        "Cholesky Solve");
   gsl_test(test_cholesky_decomp(r),      "Cholesky Decomposition");
+  gsl_test(test_cholesky_decomp_par(),   "Cholesky Decomposition (parallel)");
+  gsl_test(test_cholesky_update(),       "Cholesky Update");
+  gsl_test(test_cholesky_mixed(),        "Cholesky Mixed Precision Solve");
   gsl_test(test_cholesky_invert(r),      "Cholesky Inverse");
+  gsl_test(test_cholesky_rcond_block(),  "Cholesky Block Condition Estimate");
 
   gsl_test(test_pcholesky_decomp(r),     "Pivoted Cholesky Decomposition");
   gsl_test(test_pcholesky_solve(r),      "Pivoted Cholesky Solve");
@@ -3326,12 +4041,15 @@ main(void)
   gsl_test(test_cholesky_band_invert(r), "Banded Cholesky Inverse");
 
   gsl_test(test_ldlt_decomp(r),          "LDLT Decomposition");
+  gsl_test(test_ldlt_decomp_par(),       "LDLT Decomposition (parallel)");
+  gsl_test(test_ldlt_update(),           "LDLT Update");
   gsl_test(test_ldlt_solve(r),           "LDLT Solve");
 
   gsl_test(test_ldlt_band_decomp(r),     "Banded LDLT Decomposition");
   gsl_test(test_ldlt_band_solve(r),      "Banded LDLT Solve");
 
   gsl_test(test_symmtd_decomp(r),        "Symmetric Tridiagonal Decomposition");
+  gsl_test(test_hessenberg_decomp(r),    "Hessenberg Decomposition");
   gsl_test(test_hermtd_decomp(r),        "Hermitian Tridiagonal Decomposition");
 
   gsl_test(test_HH_solve(),              "Householder solve");
@@ -3339,6 +4057,8 @@ main(void)
   gsl_test(test_TDS_cyc_solve(),         "Tridiagonal symmetric cyclic solve");
   gsl_test(test_TDN_solve(),             "Tridiagonal nonsymmetric solve");
   gsl_test(test_TDN_cyc_solve(),         "Tridiagonal nonsymmetric cyclic solve");
+  gsl_test(test_TDN_batch(),             "Tridiagonal nonsymmetric batched solve");
+  gsl_test(test_TDN_par(),               "Tridiagonal nonsymmetric parallel solve");
 
   gsl_matrix_free(m11);
   gsl_matrix_free(m35);
@@ -183,6 +183,284 @@ test_cholesky_decomp(gsl_rng * r)
   return s;
 }
 
+/* compare the factor of gsl_linalg_cholesky_decomp_par with gsl_linalg_cholesky_decomp1 */
+static int
+test_cholesky_decomp_par(void)
+{
+  int s = 0;
+  const size_t N[] = { 200, 257, 600, 777 };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  gsl_thread_pool * pool = gsl_thread_pool_alloc(4);
+  size_t k, i, j;
+
+  for (k = 0; k < sizeof(N) / sizeof(N[0]); ++k)
+    {
+      const size_t n = N[k];
+      const double eps = 1.0e3 * n * GSL_DBL_EPSILON;
+      gsl_matrix * m = gsl_matrix_alloc(n, n);
+      gsl_matrix * A = gsl_matrix_alloc(n, n);
+      gsl_matrix * A1 = gsl_matrix_alloc(n, n);
+      gsl_matrix * LLT = gsl_matrix_alloc(n, n);
+
+      create_posdef_matrix(m, r);
+
+      gsl_matrix_memcpy(LLT, m);
+      s += gsl_linalg_cholesky_decomp1(LLT);
+
+      gsl_matrix_memcpy(A, m);
+      s += gsl_linalg_cholesky_decomp_par(A, pool);
+
+      /* the result must not depend on the number of threads */
+      gsl_matrix_memcpy(A1, m);
+      s += gsl_linalg_cholesky_decomp_par(A1, NULL);
+      gsl_test(!gsl_matrix_equal(A, A1), "cholesky_decomp_par threads (%3lu,%3lu)", n, n);
+
+      /* lower triangle holds L, upper triangle the original matrix */
+      for (i = 0; i < n; i++)
+        {
+          for (j = 0; j < n; j++)
+            {
+              double aij = gsl_matrix_get(A, i, j);
+              double bij = gsl_matrix_get(LLT, i, j);
+
+              gsl_test_rel(aij, bij, eps,
+                           "cholesky_decomp_par random: (%3lu,%3lu)[%lu,%lu]: %22.18g   %22.18g\n",
+                           n, n, i, j, aij, bij);
+            }
+        }
+
+      gsl_matrix_free(m);
+      gsl_matrix_free(A);
+      gsl_matrix_free(A1);
+      gsl_matrix_free(LLT);
+    }
+
+  /* not positive definite */
+  {
+    const size_t n = 600;
+    gsl_matrix * A = gsl_matrix_alloc(n, n);
+    int status;
+
+    create_posdef_matrix(A, r);
+    gsl_matrix_set(A, 500, 500, -1.0);
+
+    status = gsl_linalg_cholesky_decomp_par(A, pool);
+    gsl_test(status != GSL_EDOM, "cholesky_decomp_par indefinite status %d", status);
+
+    gsl_matrix_free(A);
+  }
+
+  gsl_thread_pool_free(pool);
+  gsl_rng_free(r);
+
+  return s;
+}
+
+/* max |A_ij - B_ij| / max |B_ij| over the lower triangle, or the whole matrix */
+static double
+test_update_diff(const gsl_matrix * A, const gsl_matrix * B, const int lower_only)
+{
+  const size_t N = A->size1;
+  double dmax = 0.0, bmax = 0.0;
+  size_t i, j;
+
+  for (i = 0; i < N; ++i)
+    {
+      for (j = 0; j < (lower_only ? i + 1 : N); ++j)
+        {
+          double bij = gsl_matrix_get(B, i, j);
+          dmax = GSL_MAX(dmax, fabs(gsl_matrix_get(A, i, j) - bij));
+          bmax = GSL_MAX(bmax, fabs(bij));
+        }
+    }
+
+  return (bmax > 0.0) ? dmax / bmax : dmax;
+}
+
+/* compare updated and downdated factors with the factors of A + V V^T and A */
+static int
+test_cholesky_update(void)
+{
+  int s = 0;
+  const size_t N[] = { 1, 7, 50, 150 };
+  const size_t K[] = { 1, 3, 40 };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  size_t in, ik, j;
+
+  for (in = 0; in < sizeof(N) / sizeof(N[0]); ++in)
+    {
+      for (ik = 0; ik < sizeof(K) / sizeof(K[0]); ++ik)
+        {
+          const size_t n = N[in];
+          const size_t k = K[ik];
+          const double eps = 1.0e2 * n * GSL_DBL_EPSILON;
+          gsl_matrix * A = gsl_matrix_alloc(n, n);
+          gsl_matrix * B = gsl_matrix_alloc(n, n);
+          gsl_matrix * L = gsl_matrix_alloc(n, n);
+          gsl_matrix * V = gsl_matrix_alloc(n, k);
+          gsl_matrix * W = gsl_matrix_alloc(n, k);
+          gsl_vector * v = gsl_vector_alloc(n);
+
+          create_posdef_matrix(A, r);
+          create_random_matrix(V, r);
+
+          /* B = A + V V^T */
+          gsl_matrix_memcpy(B, A);
+          gsl_blas_dsyrk(CblasLower, CblasNoTrans, 1.0, V, 1.0, B);
+          gsl_matrix_transpose_tricpy(CblasLower, CblasUnit, B, B);
+
+          s += gsl_linalg_cholesky_decomp1(A);
+          s += gsl_linalg_cholesky_decomp1(B);
+
+          gsl_matrix_memcpy(L, A);
+          gsl_matrix_memcpy(W, V);
+          s += gsl_linalg_cholesky_update_rankk(L, W);
+          gsl_test(test_update_diff(L, B, 0) > eps, "cholesky_update_rankk (%3lu,%3lu)", n, k);
+
+          gsl_matrix_memcpy(L, B);
+          gsl_matrix_memcpy(W, V);
+          s += gsl_linalg_cholesky_downdate_rankk(L, W);
+          gsl_test(test_update_diff(L, A, 0) > eps, "cholesky_downdate_rankk (%3lu,%3lu)", n, k);
+
+          gsl_matrix_memcpy(L, A);
+          for (j = 0; j < k; ++j)
+            {
+              gsl_matrix_get_col(v, V, j);
+              s += gsl_linalg_cholesky_update(L, v);
+            }
+          gsl_test(test_update_diff(L, B, 0) > eps, "cholesky_update (%3lu,%3lu)", n, k);
+
+          gsl_matrix_memcpy(L, B);
+          for (j = 0; j < k; ++j)
+            {
+              gsl_matrix_get_col(v, V, j);
+              s += gsl_linalg_cholesky_downdate(L, v);
+            }
+          gsl_test(test_update_diff(L, A, 0) > eps, "cholesky_downdate (%3lu,%3lu)", n, k);
+
+          gsl_matrix_free(A);
+          gsl_matrix_free(B);
+          gsl_matrix_free(L);
+          gsl_matrix_free(V);
+          gsl_matrix_free(W);
+          gsl_vector_free(v);
+        }
+    }
+
+  /* downdates which are not positive definite must leave the factor unchanged */
+  {
+    const size_t n = 50;
+    gsl_matrix * A = gsl_matrix_alloc(n, n);
+    gsl_matrix * L = gsl_matrix_alloc(n, n);
+    gsl_matrix * V = gsl_matrix_calloc(n, 2);
+    gsl_vector_view v = gsl_matrix_column(V, 1);
+    int status;
+
+    create_posdef_matrix(A, r);
+    s += gsl_linalg_cholesky_decomp1(A);
+
+    gsl_matrix_set(V, 0, 0, 1.0);
+    gsl_matrix_set(V, 10, 1, 2.0 * gsl_matrix_get(A, 10, 10));
+
+    gsl_matrix_memcpy(L, A);
+    status = gsl_linalg_cholesky_downdate(L, &v.vector);
+    gsl_test(status != GSL_EDOM, "cholesky_downdate indefinite status %d", status);
+    gsl_test(!gsl_matrix_equal(L, A), "cholesky_downdate indefinite unchanged");
+
+    gsl_matrix_set(V, 10, 1, 2.0 * gsl_matrix_get(A, 10, 10));
+    status = gsl_linalg_cholesky_downdate_rankk(L, V);
+    gsl_test(status != GSL_EDOM, "cholesky_downdate_rankk indefinite status %d", status);
+    gsl_test(!gsl_matrix_equal(L, A), "cholesky_downdate_rankk indefinite unchanged");
+
+    gsl_matrix_free(A);
+    gsl_matrix_free(L);
+    gsl_matrix_free(V);
+  }
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
+/* mixed precision solve; the upper triangle of A is not referenced */
+static int
+test_cholesky_mixed(void)
+{
+  int s = 0;
+  const size_t N[] = { 1, 2, 7, 50, 300 };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  size_t k, i, j;
+
+  for (k = 0; k < sizeof(N) / sizeof(N[0]); ++k)
+    {
+      const size_t n = N[k];
+      const double eps = 1024.0 * n * GSL_DBL_EPSILON;
+      gsl_matrix * m = gsl_matrix_alloc(n, n);
+      gsl_vector * rhs = gsl_vector_alloc(n);
+      gsl_vector * sol = gsl_vector_alloc(n);
+      gsl_vector * x = gsl_vector_alloc(n);
+      gsl_linalg_mixed_workspace * w = gsl_linalg_mixed_alloc(n);
+
+      create_posdef_matrix(m, r);
+      create_random_vector(sol, r);
+      gsl_blas_dsymv(CblasLower, 1.0, m, sol, 0.0, rhs);
+
+      for (i = 0; i < n; ++i)
+        for (j = i + 1; j < n; ++j)
+          gsl_matrix_set(m, i, j, -1.0);
+
+      s += gsl_linalg_cholesky_mixed_decomp(m, w);
+      s += gsl_linalg_cholesky_mixed_solve(m, rhs, x, w);
+
+      for (i = 0; i < n; ++i)
+        {
+          double xi = gsl_vector_get(x, i);
+          double yi = gsl_vector_get(sol, i);
+
+          gsl_test_rel(xi, yi, eps, "cholesky_mixed random: %3lu[%lu]: %22.18g    %22.18g\n",
+                       n, i, xi, yi);
+        }
+
+      gsl_test(gsl_linalg_mixed_fallback(w), "cholesky_mixed random: %3lu fallback", n);
+
+      if (n >= 50)
+        {
+          /* ill conditioned: solved in double precision */
+          gsl_matrix_view h = gsl_matrix_submatrix(m, 0, 0, 8, 8);
+          gsl_vector_view hrhs = gsl_vector_subvector(rhs, 0, 8);
+          gsl_vector_view hx = gsl_vector_subvector(x, 0, 8);
+          gsl_linalg_mixed_workspace * hw = gsl_linalg_mixed_alloc(8);
+
+          create_hilbert_matrix2(&h.matrix);
+          gsl_vector_set_all(&hx.vector, 1.0);
+          gsl_blas_dsymv(CblasLower, 1.0, &h.matrix, &hx.vector, 0.0, &hrhs.vector);
+          s += gsl_linalg_cholesky_mixed_decomp(&h.matrix, hw);
+          s += gsl_linalg_cholesky_mixed_solve(&h.matrix, &hrhs.vector, &hx.vector, hw);
+
+          for (i = 0; i < 8; ++i)
+            {
+              double xi = gsl_vector_get(&hx.vector, i);
+
+              gsl_test_rel(xi, 1.0, 1.0e-4, "cholesky_mixed hilbert: [%lu]: %22.18g", i, xi);
+            }
+
+          gsl_test(!gsl_linalg_mixed_fallback(hw), "cholesky_mixed hilbert: fallback");
+
+          gsl_linalg_mixed_free(hw);
+        }
+
+      gsl_matrix_free(m);
+      gsl_vector_free(rhs);
+      gsl_vector_free(sol);
+      gsl_vector_free(x);
+      gsl_linalg_mixed_free(w);
+    }
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
 int
 test_cholesky_invert_eps(const gsl_matrix * m, const double eps, const char *desc)
 {
@@ -1103,3 +1381,51 @@ test_cholesky_band_invert(gsl_rng * r)
 
   return s;
 }
+
+/* compare the block rcond estimate with the exact 1 / (||A||_1 ||A^{-1}||_1) */
+static int
+test_cholesky_rcond_block(void)
+{
+  int s = 0;
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  size_t n, t;
+
+  for (n = 1; n <= 40; ++n)
+    {
+      gsl_matrix * m = gsl_matrix_alloc(n, n);
+      gsl_matrix * LLT = gsl_matrix_alloc(n, n);
+      gsl_matrix * Ainv = gsl_matrix_alloc(n, n);
+
+      create_posdef_matrix(m, r);
+
+      gsl_matrix_memcpy(LLT, m);
+      gsl_linalg_cholesky_decomp1(LLT);
+      gsl_matrix_memcpy(Ainv, LLT);
+      gsl_linalg_cholesky_invert(Ainv);
+
+      for (t = 1; t <= GSL_MIN(n, 4); ++t)
+        {
+          gsl_linalg_condest_workspace * w = gsl_linalg_condest_alloc(n, t);
+          double rcond_exact = 1.0 / (gsl_linalg_norm1(m) * gsl_linalg_norm1(Ainv));
+          double rcond;
+          int status = 0;
+
+          gsl_linalg_cholesky_rcond_block(LLT, &rcond, w);
+
+          status = (rcond < rcond_exact * (1.0 - 1.0e-8) || rcond > 10.0 * rcond_exact);
+          gsl_test(status, "cholesky_rcond_block (%3lu,%3lu) t=%lu: %22.18g   %22.18g\n",
+                   n, n, t, rcond, rcond_exact);
+          s += status;
+
+          gsl_linalg_condest_free(w);
+        }
+
+      gsl_matrix_free(m);
+      gsl_matrix_free(LLT);
+      gsl_matrix_free(Ainv);
+    }
+
+  gsl_rng_free(r);
+
+  return s;
+}
@@ -145,6 +145,187 @@ test_ldlt_decomp(gsl_rng * r)
   return s;
 }
 
+/* compare the factor of gsl_linalg_ldlt_decomp_par with gsl_linalg_ldlt_decomp */
+static int
+test_ldlt_decomp_par(void)
+{
+  int s = 0;
+  const size_t N[] = { 200, 300, 600 };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  gsl_thread_pool * pool = gsl_thread_pool_alloc(4);
+  size_t k, i, j;
+
+  for (k = 0; k < sizeof(N) / sizeof(N[0]); ++k)
+    {
+      const size_t n = N[k];
+      const double eps = 1.0e3 * n * GSL_DBL_EPSILON;
+      gsl_matrix * m = gsl_matrix_alloc(n, n);
+      gsl_matrix * A = gsl_matrix_alloc(n, n);
+      gsl_matrix * A1 = gsl_matrix_alloc(n, n);
+      gsl_matrix * LDLT = gsl_matrix_alloc(n, n);
+
+      create_posdef_matrix(m, r);
+
+      gsl_matrix_memcpy(LDLT, m);
+      s += gsl_linalg_ldlt_decomp(LDLT);
+
+      gsl_matrix_memcpy(A, m);
+      s += gsl_linalg_ldlt_decomp_par(A, pool);
+
+      /* the result must not depend on the number of threads */
+      gsl_matrix_memcpy(A1, m);
+      s += gsl_linalg_ldlt_decomp_par(A1, NULL);
+      gsl_test(!gsl_matrix_equal(A, A1), "ldlt_decomp_par threads (%3lu,%3lu)", n, n);
+
+      /* the whole output, including the upper triangle */
+      for (i = 0; i < n; i++)
+        {
+          for (j = 0; j < n; j++)
+            {
+              double aij = gsl_matrix_get(A, i, j);
+              double bij = gsl_matrix_get(LDLT, i, j);
+
+              gsl_test_rel(aij, bij, eps,
+                           "ldlt_decomp_par random: (%3lu,%3lu)[%lu,%lu]: %22.18g   %22.18g\n",
+                           n, n, i, j, aij, bij);
+            }
+        }
+
+      /* ||A||_1 in the upper right corner */
+      gsl_test_rel(gsl_matrix_get(A, 0, n - 1), gsl_matrix_get(LDLT, 0, n - 1), GSL_DBL_EPSILON,
+                   "ldlt_decomp_par norm1: (%3lu,%3lu)", n, n);
+
+      gsl_matrix_free(m);
+      gsl_matrix_free(A);
+      gsl_matrix_free(A1);
+      gsl_matrix_free(LDLT);
+    }
+
+  gsl_thread_pool_free(pool);
+  gsl_rng_free(r);
+
+  return s;
+}
+
+/* compare updated and downdated factors with the factors of A + V V^T and A,
+ * for positive definite and indefinite A */
+static int
+test_ldlt_update(void)
+{
+  int s = 0;
+  const size_t N[] = { 1, 7, 50, 150 };
+  const size_t K[] = { 1, 3, 40 };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  size_t in, ik, i, j;
+  int posdef;
+
+  for (posdef = 0; posdef < 2; ++posdef)
+    {
+      for (in = 0; in < sizeof(N) / sizeof(N[0]); ++in)
+        {
+          for (ik = 0; ik < sizeof(K) / sizeof(K[0]); ++ik)
+            {
+              const size_t n = N[in];
+              const size_t k = K[ik];
+              const double eps = 1.0e2 * n * GSL_DBL_EPSILON;
+              gsl_matrix * A = gsl_matrix_alloc(n, n);
+              gsl_matrix * B = gsl_matrix_alloc(n, n);
+              gsl_matrix * L = gsl_matrix_alloc(n, n);
+              gsl_matrix * V = gsl_matrix_alloc(n, k);
+              gsl_matrix * W = gsl_matrix_alloc(n, k);
+              gsl_vector * v = gsl_vector_alloc(n);
+              double anorm;
+
+              create_posdef_matrix(A, r);
+              create_random_matrix(V, r);
+
+              if (!posdef)
+                {
+                  /* diagonally dominant with diagonal of both signs */
+                  for (i = 0; i < n; i += 2)
+                    gsl_matrix_set(A, i, i, -gsl_matrix_get(A, i, i));
+                }
+
+              /* B = A + V V^T */
+              gsl_matrix_memcpy(B, A);
+              gsl_blas_dsyrk(CblasLower, CblasNoTrans, 1.0, V, 1.0, B);
+              gsl_matrix_transpose_tricpy(CblasLower, CblasUnit, B, B);
+
+              s += gsl_linalg_ldlt_decomp(A);
+              s += gsl_linalg_ldlt_decomp(B);
+
+              gsl_matrix_memcpy(L, A);
+              gsl_matrix_memcpy(W, V);
+              s += gsl_linalg_ldlt_update_rankk(L, W);
+              gsl_test(test_update_diff(L, B, 1) > eps, "ldlt_update_rankk posdef=%d (%3lu,%3lu)", posdef, n, k);
+
+              /* the stored norm is an estimate of ||B||_1 */
+              if (n > 1)
+                {
+                  anorm = gsl_matrix_get(B, 0, n - 1);
+                  gsl_test(gsl_matrix_get(L, 0, n - 1) > anorm * (1.0 + eps) ||
+                           gsl_matrix_get(L, 0, n - 1) < 0.5 * anorm,
+                           "ldlt_update_rankk norm1 posdef=%d (%3lu,%3lu)", posdef, n, k);
+                }
+
+              gsl_matrix_memcpy(L, B);
+              gsl_matrix_memcpy(W, V);
+              s += gsl_linalg_ldlt_downdate_rankk(L, W);
+              gsl_test(test_update_diff(L, A, 1) > eps, "ldlt_downdate_rankk posdef=%d (%3lu,%3lu)", posdef, n, k);
+
+              gsl_matrix_memcpy(L, A);
+              for (j = 0; j < k; ++j)
+                {
+                  gsl_matrix_get_col(v, V, j);
+                  s += gsl_linalg_ldlt_update(L, v);
+                }
+              gsl_test(test_update_diff(L, B, 1) > eps, "ldlt_update posdef=%d (%3lu,%3lu)", posdef, n, k);
+
+              gsl_matrix_memcpy(L, B);
+              for (j = 0; j < k; ++j)
+                {
+                  gsl_matrix_get_col(v, V, j);
+                  s += gsl_linalg_ldlt_downdate(L, v);
+                }
+              gsl_test(test_update_diff(L, A, 1) > eps, "ldlt_downdate posdef=%d (%3lu,%3lu)", posdef, n, k);
+
+              gsl_matrix_free(A);
+              gsl_matrix_free(B);
+              gsl_matrix_free(L);
+              gsl_matrix_free(V);
+              gsl_matrix_free(W);
+              gsl_vector_free(v);
+            }
+        }
+    }
+
+  /* downdates which are not positive definite must leave the factor unchanged */
+  {
+    const size_t n = 50;
+    gsl_matrix * A = gsl_matrix_alloc(n, n);
+    gsl_matrix * L = gsl_matrix_alloc(n, n);
+    gsl_vector * v = gsl_vector_calloc(n);
+    int status;
+
+    create_posdef_matrix(A, r);
+    s += gsl_linalg_ldlt_decomp(A);
+    gsl_matrix_memcpy(L, A);
+
+    gsl_vector_set(v, 10, 2.0 * sqrt(gsl_matrix_get(A, 10, 10)));
+    status = gsl_linalg_ldlt_downdate(L, v);
+    gsl_test(status != GSL_EDOM, "ldlt_downdate indefinite status %d", status);
+    gsl_test(!gsl_matrix_equal(L, A), "ldlt_downdate indefinite unchanged");
+
+    gsl_matrix_free(A);
+    gsl_matrix_free(L);
+    gsl_vector_free(v);
+  }
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
 int
 test_ldlt_solve_eps(const gsl_matrix * m, const gsl_vector * rhs,
                     const gsl_vector * sol, const double eps,
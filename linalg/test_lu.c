@@ -28,30 +28,26 @@
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_permutation.h>
 
+/* test m = P L U with the factors (A, p) */
 static int
-test_LU_decomp_eps(const gsl_matrix * m, const double eps, const char * desc)
+test_LU_decomp_check(const gsl_matrix * m, const gsl_matrix * A, const gsl_permutation * p,
+                     const double eps, const char * desc)
 {
   int s = 0;
   const size_t M = m->size1;
   const size_t N = m->size2;
 
-  gsl_matrix * A = gsl_matrix_alloc(M, N);
   gsl_matrix * PLU = gsl_matrix_calloc(M, N);
-  gsl_permutation * p = gsl_permutation_alloc(M);
   size_t i, j;
-  int signum;
-
-  gsl_matrix_memcpy(A, m);
-  gsl_linalg_LU_decomp(A, p, &signum);
 
   if (M >= N)
     {
-      gsl_matrix_view U = gsl_matrix_submatrix(A, 0, 0, N, N);
+      gsl_matrix_const_view U = gsl_matrix_const_submatrix(A, 0, 0, N, N);
 
       /* copy L factor into PLU */
       for (j = 0; j < GSL_MIN(M, N); ++j)
         {
-          gsl_vector_view v1 = gsl_matrix_subcolumn(A, j, j, M - j);
+          gsl_vector_const_view v1 = gsl_matrix_const_subcolumn(A, j, j, M - j);
           gsl_vector_view v2 = gsl_matrix_subcolumn(PLU, j, j, M - j);
 
           gsl_vector_memcpy(&v2.vector, &v1.vector);
@@ -63,12 +59,12 @@ test_LU_decomp_eps(const gsl_matrix * m, const double eps, const char * desc)
     }
   else
     {
-      gsl_matrix_view L = gsl_matrix_submatrix(A, 0, 0, M, M);
+      gsl_matrix_const_view L = gsl_matrix_const_submatrix(A, 0, 0, M, M);
 
       /* copy U factor into PLU */
       for (i = 0; i < GSL_MIN(M, N); ++i)
         {
-          gsl_vector_view v1 = gsl_matrix_subrow(A, i, i, N - i);
+          gsl_vector_const_view v1 = gsl_matrix_const_subrow(A, i, i, N - i);
           gsl_vector_view v2 = gsl_matrix_subrow(PLU, i, i, N - i);
           gsl_vector_memcpy(&v2.vector, &v1.vector);
         }
@@ -98,8 +94,27 @@ test_LU_decomp_eps(const gsl_matrix * m, const double eps, const char * desc)
         }
     }
 
-  gsl_matrix_free(A);
   gsl_matrix_free(PLU);
+
+  return s;
+}
+
+static int
+test_LU_decomp_eps(const gsl_matrix * m, const double eps, const char * desc)
+{
+  int s = 0;
+  const size_t M = m->size1;
+  const size_t N = m->size2;
+
+  gsl_matrix * A = gsl_matrix_alloc(M, N);
+  gsl_permutation * p = gsl_permutation_alloc(M);
+  int signum;
+
+  gsl_matrix_memcpy(A, m);
+  s += gsl_linalg_LU_decomp(A, p, &signum);
+  s += test_LU_decomp_check(m, A, p, eps, desc);
+
+  gsl_matrix_free(A);
   gsl_permutation_free(p);
 
   return s;
@@ -149,6 +164,255 @@ test_LU_decomp(gsl_rng * r)
   return s;
 }
 
+static int
+test_LU_decomp_par(void)
+{
+  int s = 0;
+  const size_t M[] = { 300, 600, 900, 513 };
+  const size_t N[] = { 300, 600, 513, 900 };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  gsl_thread_pool * pool = gsl_thread_pool_alloc(4);
+  size_t k, i;
+
+  for (k = 0; k < sizeof(M) / sizeof(M[0]); ++k)
+    {
+      gsl_matrix * m = gsl_matrix_alloc(M[k], N[k]);
+      gsl_matrix * A = gsl_matrix_alloc(M[k], N[k]);
+      gsl_matrix * A1 = gsl_matrix_alloc(M[k], N[k]);
+      gsl_permutation * p = gsl_permutation_alloc(M[k]);
+      gsl_permutation * p1 = gsl_permutation_alloc(M[k]);
+      int signum, signum1;
+
+      create_random_matrix(m, r);
+
+      gsl_matrix_memcpy(A, m);
+      s += gsl_linalg_LU_decomp_par(A, p, &signum, pool);
+      s += test_LU_decomp_check(m, A, p, 4096.0 * M[k] * GSL_DBL_EPSILON, "LU_decomp_par random");
+
+      /* the result must not depend on the number of threads */
+      gsl_matrix_memcpy(A1, m);
+      s += gsl_linalg_LU_decomp_par(A1, p1, &signum1, NULL);
+      for (i = 0; i < M[k]; ++i)
+        signum1 *= (gsl_permutation_get(p, i) == gsl_permutation_get(p1, i)) ? 1 : 0;
+
+      gsl_test(!gsl_matrix_equal(A, A1) || signum != signum1,
+               "LU_decomp_par threads (%3lu,%3lu)", M[k], N[k]);
+
+      gsl_matrix_free(m);
+      gsl_matrix_free(A);
+      gsl_matrix_free(A1);
+      gsl_permutation_free(p);
+      gsl_permutation_free(p1);
+    }
+
+  gsl_thread_pool_free(pool);
+  gsl_rng_free(r);
+
+  return s;
+}
+
+/* check P A = L U for the banded LU decomposition, and compare the
+   banded and dense solutions for square A */
+static int
+test_LU_band(void)
+{
+  int s = 0;
+  const size_t M[]  = { 1, 5, 10, 50, 50, 30, 20, 100, 200 };
+  const size_t N[]  = { 1, 5, 10, 50, 50, 20, 30, 100, 200 };
+  const size_t LB[] = { 0, 1, 2,  3,  0,  4,  3,  10,  1 };
+  const size_t UB[] = { 0, 1, 3,  1,  4,  2,  5,  10,  1 };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  size_t t, i, j;
+
+  for (t = 0; t < sizeof(M) / sizeof(M[0]); ++t)
+    {
+      const size_t m = M[t], n = N[t], lb = LB[t], ub = UB[t];
+      const size_t minMN = GSL_MIN(m, n);
+      const double eps = 1.0e3 * GSL_DBL_EPSILON;
+      gsl_matrix * A = gsl_matrix_calloc(m, n);
+      gsl_matrix * AB = gsl_matrix_alloc(n, 2 * lb + ub + 1);
+      gsl_matrix * L = gsl_matrix_alloc(m, minMN);
+      gsl_matrix * U = gsl_matrix_alloc(minMN, n);
+      gsl_matrix * LU = gsl_matrix_alloc(m, n);
+      gsl_vector_uint * piv = gsl_vector_uint_alloc(minMN);
+      double dmax = 0.0;
+
+      /* the fill-in columns of AB need not be set */
+      gsl_matrix_set_all(AB, 99.0);
+
+      for (j = 0; j < n; ++j)
+        {
+          const size_t i0 = (j > ub) ? j - ub : 0;
+          const size_t i1 = GSL_MIN(m - 1, j + lb);
+
+          for (i = i0; i <= i1; ++i)
+            {
+              double aij = 2.0 * gsl_rng_uniform(r) - 1.0;
+              gsl_matrix_set(A, i, j, aij);
+              gsl_matrix_set(AB, j, lb + ub + i - j, aij);
+            }
+        }
+
+      s += gsl_linalg_LU_band_decomp(m, lb, ub, AB, piv);
+      s += gsl_linalg_LU_band_unpack(m, lb, ub, AB, piv, L, U);
+
+      gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, L, U, 0.0, LU);
+
+      /* LU := P^T L U */
+      for (j = minMN; j-- > 0; )
+        {
+          size_t pj = gsl_vector_uint_get(piv, j);
+
+          if (pj != j)
+            gsl_matrix_swap_rows(LU, j, pj);
+        }
+
+      for (i = 0; i < m; ++i)
+        for (j = 0; j < n; ++j)
+          dmax = GSL_MAX(dmax, fabs(gsl_matrix_get(LU, i, j) - gsl_matrix_get(A, i, j)));
+
+      gsl_test(dmax > eps, "LU_band decomp (%3lu,%3lu) lb=%lu ub=%lu: %g", m, n, lb, ub, dmax);
+      s += dmax > eps;
+
+      if (m == n)
+        {
+          gsl_permutation * p = gsl_permutation_alloc(n);
+          gsl_vector * b = gsl_vector_alloc(n);
+          gsl_vector * x = gsl_vector_alloc(n);
+          gsl_vector * y = gsl_vector_alloc(n);
+          int signum;
+
+          create_random_vector(b, r);
+
+          s += gsl_linalg_LU_band_solve(lb, ub, AB, piv, b, x);
+
+          s += gsl_linalg_LU_decomp(A, p, &signum);
+          s += gsl_linalg_LU_solve(A, p, b, y);
+
+          dmax = 0.0;
+          for (i = 0; i < n; ++i)
+            dmax = GSL_MAX(dmax, fabs(gsl_vector_get(x, i) - gsl_vector_get(y, i)) /
+                                 GSL_MAX(1.0, fabs(gsl_vector_get(y, i))));
+
+          gsl_test(dmax > 1.0e4 * n * GSL_DBL_EPSILON, "LU_band solve (%3lu,%3lu) lb=%lu ub=%lu: %g",
+                   m, n, lb, ub, dmax);
+          s += dmax > 1.0e4 * n * GSL_DBL_EPSILON;
+
+          gsl_permutation_free(p);
+          gsl_vector_free(b);
+          gsl_vector_free(x);
+          gsl_vector_free(y);
+        }
+
+      gsl_matrix_free(A);
+      gsl_matrix_free(AB);
+      gsl_matrix_free(L);
+      gsl_matrix_free(U);
+      gsl_matrix_free(LU);
+      gsl_vector_uint_free(piv);
+    }
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
+/* check x against sol and the number of refinement steps / fallback of w */
+static int
+test_LU_mixed_check(const gsl_vector * x, const gsl_vector * sol, const double eps,
+                    const gsl_linalg_mixed_workspace * w, const int fallback,
+                    const char * desc)
+{
+  int s = 0;
+  const size_t N = x->size;
+  size_t i;
+
+  for (i = 0; i < N; i++)
+    {
+      double xi = gsl_vector_get(x, i);
+      double yi = gsl_vector_get(sol, i);
+
+      gsl_test_rel(xi, yi, eps, "%s: %3lu[%lu]: %22.18g    %22.18g\n",
+                   desc, N, i, xi, yi);
+    }
+
+  s = gsl_linalg_mixed_fallback(w) != fallback;
+  gsl_test(s, "%s: %3lu fallback=%d niter=%lu", desc, N,
+           gsl_linalg_mixed_fallback(w), gsl_linalg_mixed_niter(w));
+
+  return s;
+}
+
+static int
+test_LU_mixed(void)
+{
+  int s = 0;
+  const size_t N[] = { 1, 2, 7, 50, 300 };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  size_t k, i;
+
+  for (k = 0; k < sizeof(N) / sizeof(N[0]); ++k)
+    {
+      const size_t n = N[k];
+      gsl_matrix * m = gsl_matrix_alloc(n, n);
+      gsl_vector * rhs = gsl_vector_alloc(n);
+      gsl_vector * sol = gsl_vector_alloc(n);
+      gsl_vector * x = gsl_vector_alloc(n);
+      gsl_linalg_mixed_workspace * w = gsl_linalg_mixed_alloc(n);
+
+      /* well conditioned: refined to double precision accuracy */
+      create_random_matrix(m, r);
+      for (i = 0; i < n; ++i)
+        *gsl_matrix_ptr(m, i, i) += sqrt((double) n);
+
+      s += gsl_linalg_LU_mixed_decomp(m, w);
+
+      for (i = 0; i < 2; ++i)
+        {
+          create_random_vector(sol, r);
+          gsl_blas_dgemv(CblasNoTrans, 1.0, m, sol, 0.0, rhs);
+          s += gsl_linalg_LU_mixed_solve(m, rhs, x, w);
+          s += test_LU_mixed_check(x, sol, 1024.0 * n * GSL_DBL_EPSILON, w, 0, "LU_mixed random");
+        }
+
+      /* too large for single precision */
+      gsl_matrix_scale(m, 1.0e40);
+      gsl_vector_scale(rhs, 1.0e40);
+      s += gsl_linalg_LU_mixed_decomp(m, w);
+      s += gsl_linalg_LU_mixed_solve(m, rhs, x, w);
+      s += test_LU_mixed_check(x, sol, 1024.0 * n * GSL_DBL_EPSILON, w, 1, "LU_mixed overflow");
+
+      /* ill conditioned: solved in double precision */
+      if (n >= 50)
+        {
+          gsl_matrix_view h = gsl_matrix_submatrix(m, 0, 0, 8, 8);
+          gsl_vector_view hsol = gsl_vector_subvector(sol, 0, 8);
+          gsl_vector_view hrhs = gsl_vector_subvector(rhs, 0, 8);
+          gsl_vector_view hx = gsl_vector_subvector(x, 0, 8);
+          gsl_linalg_mixed_workspace * hw = gsl_linalg_mixed_alloc(8);
+
+          create_hilbert_matrix2(&h.matrix);
+          gsl_vector_set_all(&hsol.vector, 1.0);
+          gsl_blas_dgemv(CblasNoTrans, 1.0, &h.matrix, &hsol.vector, 0.0, &hrhs.vector);
+          s += gsl_linalg_LU_mixed_decomp(&h.matrix, hw);
+          s += gsl_linalg_LU_mixed_solve(&h.matrix, &hrhs.vector, &hx.vector, hw);
+          s += test_LU_mixed_check(&hx.vector, &hsol.vector, 1.0e-4, hw, 1, "LU_mixed hilbert");
+
+          gsl_linalg_mixed_free(hw);
+        }
+
+      gsl_matrix_free(m);
+      gsl_vector_free(rhs);
+      gsl_vector_free(sol);
+      gsl_vector_free(x);
+      gsl_linalg_mixed_free(w);
+    }
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
 static int
 test_LU_solve_eps(const gsl_matrix * m, const gsl_vector * rhs, const gsl_vector * sol, const double eps, const char * desc)
 {
@@ -286,3 +550,158 @@ test_LU_invert(gsl_rng * r)
 
   return s;
 }
+
+/* compare the rcond estimates with the exact 1 / (||A||_1 ||A^{-1}||_1),
+   which they may not underestimate */
+static int
+test_LU_rcond_eps(const gsl_matrix * m, const double tol, const char * desc)
+{
+  int s = 0;
+  const size_t N = m->size1;
+  const size_t t = GSL_MIN(N, 2);
+  gsl_matrix * LU = gsl_matrix_alloc(N, N);
+  gsl_matrix * Ainv = gsl_matrix_alloc(N, N);
+  gsl_permutation * perm = gsl_permutation_alloc(N);
+  gsl_vector * work = gsl_vector_alloc(3 * N);
+  gsl_linalg_condest_workspace * w = gsl_linalg_condest_alloc(N, t);
+  double Anorm = gsl_linalg_norm1(m);
+  double rcond, rcond_block, rcond_exact;
+  int signum;
+
+  gsl_matrix_memcpy(LU, m);
+  gsl_linalg_LU_decomp(LU, perm, &signum);
+  gsl_linalg_LU_invert(LU, perm, Ainv);
+
+  rcond_exact = 1.0 / (Anorm * gsl_linalg_norm1(Ainv));
+
+  gsl_linalg_LU_rcond(LU, perm, Anorm, &rcond, work);
+  gsl_linalg_LU_rcond_block(LU, perm, Anorm, &rcond_block, w);
+
+  s += (rcond < rcond_exact * (1.0 - 1.0e-8) || rcond > tol * rcond_exact);
+  gsl_test(s, "%s LU_rcond (%3lu,%3lu): %22.18g   %22.18g\n",
+           desc, N, N, rcond, rcond_exact);
+
+  s += (rcond_block < rcond_exact * (1.0 - 1.0e-8) || rcond_block > tol * rcond_exact);
+  gsl_test(s, "%s LU_rcond_block (%3lu,%3lu) t=%lu: %22.18g   %22.18g\n",
+           desc, N, N, t, rcond_block, rcond_exact);
+
+  gsl_matrix_free(LU);
+  gsl_matrix_free(Ainv);
+  gsl_permutation_free(perm);
+  gsl_vector_free(work);
+  gsl_linalg_condest_free(w);
+
+  return s;
+}
+
+static int
+test_LU_rcond(void)
+{
+  int s = 0;
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  size_t n;
+
+  for (n = 1; n <= 40; ++n)
+    {
+      gsl_matrix * m = gsl_matrix_alloc(n, n);
+
+      create_random_matrix(m, r);
+      s += test_LU_rcond_eps(m, 10.0, "random");
+
+      if (n <= 10)
+        {
+          create_hilbert_matrix2(m);
+          s += test_LU_rcond_eps(m, 10.0, "hilbert");
+        }
+
+      gsl_matrix_free(m);
+    }
+
+  /* singular matrix */
+  {
+    gsl_matrix * m = gsl_matrix_calloc(5, 5);
+    gsl_permutation * perm = gsl_permutation_alloc(5);
+    gsl_vector * work = gsl_vector_alloc(15);
+    double rcond = 1.0;
+    int signum;
+
+    gsl_matrix_set(m, 0, 0, 1.0);
+    gsl_linalg_LU_decomp(m, perm, &signum);
+    gsl_linalg_LU_rcond(m, perm, 1.0, &rcond, work);
+    gsl_test(rcond != 0.0, "LU_rcond singular: %g", rcond);
+    s += (rcond != 0.0);
+
+    gsl_matrix_free(m);
+    gsl_permutation_free(perm);
+    gsl_vector_free(work);
+  }
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
+/* check that the forward error bound holds for the computed solution */
+static int
+test_LU_ferr(void)
+{
+  int s = 0;
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  size_t n;
+
+  for (n = 1; n <= 40; ++n)
+    {
+      gsl_matrix * m = gsl_matrix_alloc(n, n);
+      gsl_matrix * LU = gsl_matrix_alloc(n, n);
+      gsl_permutation * perm = gsl_permutation_alloc(n);
+      gsl_vector * sol = gsl_vector_alloc(n);
+      gsl_vector * rhs = gsl_vector_alloc(n);
+      gsl_vector * x = gsl_vector_alloc(n);
+      gsl_vector * work = gsl_vector_alloc(5 * n);
+      size_t k;
+
+      for (k = 0; k < 2; ++k)
+        {
+          double ferr, err, xnorm;
+          int signum;
+
+          if (k == 0)
+            create_random_matrix(m, r);
+          else
+            create_hilbert_matrix2(m);
+
+          create_random_vector(sol, r);
+          gsl_blas_dgemv(CblasNoTrans, 1.0, m, sol, 0.0, rhs);
+
+          gsl_matrix_memcpy(LU, m);
+          gsl_linalg_LU_decomp(LU, perm, &signum);
+          gsl_linalg_LU_solve(LU, perm, rhs, x);
+          gsl_linalg_LU_ferr(m, LU, perm, rhs, x, &ferr, work);
+
+          xnorm = gsl_vector_max(x) > -gsl_vector_min(x) ? gsl_vector_max(x) : -gsl_vector_min(x);
+          gsl_vector_sub(x, sol);
+          err = (gsl_vector_max(x) > -gsl_vector_min(x) ? gsl_vector_max(x) : -gsl_vector_min(x)) / xnorm;
+
+          /* the true error is at most the bound, which is not too pessimistic */
+          gsl_test(err > ferr || (k == 0 && ferr > 1.0e-8),
+                   "LU_ferr %s (%3lu,%3lu): err=%g ferr=%g",
+                   (k == 0) ? "random" : "hilbert", n, n, err, ferr);
+          s += (err > ferr || (k == 0 && ferr > 1.0e-8));
+
+          if (n > 12)
+            break; /* hilbert matrices too ill-conditioned */
+        }
+
+      gsl_matrix_free(m);
+      gsl_matrix_free(LU);
+      gsl_permutation_free(perm);
+      gsl_vector_free(sol);
+      gsl_vector_free(rhs);
+      gsl_vector_free(x);
+      gsl_vector_free(work);
+    }
+
+  gsl_rng_free(r);
+
+  return s;
+}
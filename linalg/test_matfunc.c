@@ -0,0 +1,423 @@
+/* linalg/test_matfunc.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_ieee_utils.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_rng.h>
+
+/* test that A and B agree to within eps * max(||B||_max, 1) */
+static int
+test_matfunc_compare(const gsl_matrix * A, const gsl_matrix * B, const double eps,
+                     const char * desc)
+{
+  int s = 0;
+  const size_t N = A->size1;
+  double bmax = 1.0;
+  size_t i, j;
+
+  for (i = 0; i < N; ++i)
+    {
+      for (j = 0; j < N; ++j)
+        bmax = GSL_MAX(bmax, fabs(gsl_matrix_get(B, i, j)));
+    }
+
+  for (i = 0; i < N; ++i)
+    {
+      for (j = 0; j < N; ++j)
+        {
+          double aij = gsl_matrix_get(A, i, j);
+          double bij = gsl_matrix_get(B, i, j);
+
+          gsl_test_abs(aij, bij, eps * bmax, "%s N=%zu [%zu,%zu]", desc, N, i, j);
+        }
+    }
+
+  return s;
+}
+
+/* compare gsl_linalg_expm of the symmetric matrix A = Q D Q^T, with Q
+ * a random orthogonal matrix and the elements of D uniform in
+ * [-scale, scale], with Q exp(D) Q^T */
+static int
+test_expm_symm_eps(const size_t N, const double scale, gsl_rng * r,
+                   const double eps, const char * desc)
+{
+  int s = 0;
+  gsl_matrix * A = gsl_matrix_alloc(N, N);
+  gsl_matrix * eA = gsl_matrix_alloc(N, N);
+  gsl_matrix * work = gsl_matrix_alloc(N, N);
+  gsl_matrix * Q = gsl_matrix_alloc(N, N);
+  gsl_matrix * expected = gsl_matrix_alloc(N, N);
+  gsl_vector * tau = gsl_vector_alloc(N);
+  gsl_vector * d = gsl_vector_alloc(N);
+  gsl_linalg_matfunc_workspace * w = gsl_linalg_matfunc_alloc(N);
+  size_t j;
+
+  create_random_matrix(work, r);
+  gsl_linalg_QR_decomp(work, tau);
+  gsl_linalg_QR_unpack(work, tau, Q, expected);
+
+  for (j = 0; j < N; ++j)
+    gsl_vector_set(d, j, scale * (2.0 * gsl_rng_uniform(r) - 1.0));
+
+  /* A = Q D Q^T */
+  gsl_matrix_memcpy(work, Q);
+  for (j = 0; j < N; ++j)
+    {
+      gsl_vector_view c = gsl_matrix_column(work, j);
+      gsl_blas_dscal(gsl_vector_get(d, j), &c.vector);
+    }
+
+  gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, work, Q, 0.0, A);
+
+  gsl_matrix_memcpy(work, Q);
+  for (j = 0; j < N; ++j)
+    {
+      gsl_vector_view c = gsl_matrix_column(work, j);
+      gsl_blas_dscal(exp(gsl_vector_get(d, j)), &c.vector);
+    }
+
+  gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, work, Q, 0.0, expected);
+
+  s += gsl_linalg_expm(A, eA, w);
+  s += test_matfunc_compare(eA, expected, eps, desc);
+
+  gsl_matrix_free(A);
+  gsl_matrix_free(eA);
+  gsl_matrix_free(work);
+  gsl_matrix_free(Q);
+  gsl_matrix_free(expected);
+  gsl_vector_free(tau);
+  gsl_vector_free(d);
+  gsl_linalg_matfunc_free(w);
+
+  return s;
+}
+
+/* test exp(A) exp(-A) = I and, if compare_ss is set, exp(A) against
+ * gsl_linalg_exponential_ss, which loses accuracy for large ||A|| */
+static int
+test_expm_eps(const gsl_matrix * A, const int compare_ss, const double eps,
+              const char * desc)
+{
+  int s = 0;
+  const size_t N = A->size1;
+  gsl_matrix * eA = gsl_matrix_alloc(N, N);
+  gsl_matrix * emA = gsl_matrix_alloc(N, N);
+  gsl_matrix * B = gsl_matrix_alloc(N, N);
+  gsl_matrix * I = gsl_matrix_alloc(N, N);
+  gsl_linalg_matfunc_workspace * w = gsl_linalg_matfunc_alloc(N);
+  double cond;
+
+  s += gsl_linalg_expm(A, eA, w);
+
+  gsl_matrix_memcpy(B, A);
+  gsl_matrix_scale(B, -1.0);
+  s += gsl_linalg_expm(B, emA, w);
+
+  /* the residual of exp(A) exp(-A) = I grows with ||exp(A)|| ||exp(-A)|| */
+  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, eA, emA, 0.0, B);
+  gsl_matrix_set_identity(I);
+  cond = GSL_MAX(fabs(gsl_matrix_max(eA)), fabs(gsl_matrix_min(eA))) *
+         GSL_MAX(fabs(gsl_matrix_max(emA)), fabs(gsl_matrix_min(emA)));
+  s += test_matfunc_compare(B, I, eps * GSL_MAX(cond, 1.0), desc);
+
+  if (compare_ss)
+    {
+      s += gsl_linalg_exponential_ss(A, B, GSL_PREC_DOUBLE);
+      s += test_matfunc_compare(eA, B, eps, desc);
+    }
+
+  /* in place */
+  gsl_matrix_memcpy(B, A);
+  s += gsl_linalg_expm(B, B, w);
+  s += test_matfunc_compare(B, eA, GSL_DBL_EPSILON, desc);
+
+  gsl_matrix_free(eA);
+  gsl_matrix_free(emA);
+  gsl_matrix_free(B);
+  gsl_matrix_free(I);
+  gsl_linalg_matfunc_free(w);
+
+  return s;
+}
+
+static int
+test_expm(void)
+{
+  int s = 0;
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  const double scale[] = { 1.0e-3, 1.0e-1, 0.5, 1.5, 4.0, 20.0 };
+  const size_t N[] = { 1, 2, 5, 20, 64 };
+  size_t i, k;
+
+  /* rotation generator, exp = [ cos -sin ; sin cos ] */
+  {
+    const double theta = 2.5;
+    gsl_matrix * A = gsl_matrix_calloc(2, 2);
+    gsl_matrix * eA = gsl_matrix_alloc(2, 2);
+    gsl_matrix * expected = gsl_matrix_alloc(2, 2);
+    gsl_linalg_matfunc_workspace * w = gsl_linalg_matfunc_alloc(2);
+
+    gsl_matrix_set(A, 0, 1, -theta);
+    gsl_matrix_set(A, 1, 0, theta);
+    gsl_matrix_set(expected, 0, 0, cos(theta));
+    gsl_matrix_set(expected, 0, 1, -sin(theta));
+    gsl_matrix_set(expected, 1, 0, sin(theta));
+    gsl_matrix_set(expected, 1, 1, cos(theta));
+
+    s += gsl_linalg_expm(A, eA, w);
+    s += test_matfunc_compare(eA, expected, 10.0 * GSL_DBL_EPSILON, "expm rotation");
+
+    gsl_matrix_free(A);
+    gsl_matrix_free(eA);
+    gsl_matrix_free(expected);
+    gsl_linalg_matfunc_free(w);
+  }
+
+  for (i = 0; i < sizeof(N) / sizeof(N[0]); ++i)
+    {
+      gsl_matrix * A = gsl_matrix_alloc(N[i], N[i]);
+
+      for (k = 0; k < sizeof(scale) / sizeof(scale[0]); ++k)
+        {
+          /* ||A||_1 of about scale[k], selecting each Pade degree */
+          create_random_matrix(A, r);
+          gsl_matrix_scale(A, scale[k] / N[i]);
+          s += test_expm_eps(A, scale[k] <= 0.1, 1.0e4 * N[i] * GSL_DBL_EPSILON, "expm random");
+
+          s += test_expm_symm_eps(N[i], scale[k], r, 1.0e2 * N[i] * GSL_DBL_EPSILON, "expm symmetric");
+        }
+
+      gsl_matrix_free(A);
+    }
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
+/* test sqrtm(A)^2 = A and exp(logm(A)) = A */
+static int
+test_sqrtm_logm_eps(const gsl_matrix * A, const double eps, const char * desc)
+{
+  int s = 0;
+  const size_t N = A->size1;
+  gsl_matrix * X = gsl_matrix_alloc(N, N);
+  gsl_matrix * B = gsl_matrix_alloc(N, N);
+  gsl_linalg_matfunc_workspace * w = gsl_linalg_matfunc_alloc(N);
+
+  s += gsl_linalg_sqrtm(A, X, w);
+  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, X, X, 0.0, B);
+  s += test_matfunc_compare(B, A, eps, desc);
+
+  s += gsl_linalg_logm(A, X, w);
+  s += gsl_linalg_expm(X, B, w);
+  s += test_matfunc_compare(B, A, eps, desc);
+
+  gsl_matrix_free(X);
+  gsl_matrix_free(B);
+  gsl_linalg_matfunc_free(w);
+
+  return s;
+}
+
+static int
+test_sqrtm_logm(void)
+{
+  int s = 0;
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  const size_t N[] = { 1, 2, 3, 10, 50, 120 };
+  size_t i;
+
+  /* logm of a rotation matrix is its generator */
+  {
+    const double theta = 2.0;
+    gsl_matrix * A = gsl_matrix_alloc(2, 2);
+    gsl_matrix * X = gsl_matrix_alloc(2, 2);
+    gsl_matrix * expected = gsl_matrix_calloc(2, 2);
+    gsl_linalg_matfunc_workspace * w = gsl_linalg_matfunc_alloc(2);
+
+    gsl_matrix_set(A, 0, 0, cos(theta));
+    gsl_matrix_set(A, 0, 1, -sin(theta));
+    gsl_matrix_set(A, 1, 0, sin(theta));
+    gsl_matrix_set(A, 1, 1, cos(theta));
+    gsl_matrix_set(expected, 0, 1, -theta);
+    gsl_matrix_set(expected, 1, 0, theta);
+
+    s += gsl_linalg_logm(A, X, w);
+    s += test_matfunc_compare(X, expected, 1.0e2 * GSL_DBL_EPSILON, "logm rotation");
+
+    gsl_matrix_free(A);
+    gsl_matrix_free(X);
+    gsl_matrix_free(expected);
+    gsl_linalg_matfunc_free(w);
+  }
+
+  /* no real square root or logarithm with a negative eigenvalue */
+  {
+    gsl_matrix * A = gsl_matrix_calloc(3, 3);
+    gsl_matrix * X = gsl_matrix_alloc(3, 3);
+    gsl_linalg_matfunc_workspace * w = gsl_linalg_matfunc_alloc(3);
+    gsl_error_handler_t * old_handler = gsl_set_error_handler_off();
+    int status;
+
+    gsl_matrix_set(A, 0, 0, 2.0);
+    gsl_matrix_set(A, 1, 1, -1.0);
+    gsl_matrix_set(A, 2, 2, 3.0);
+    gsl_matrix_set(A, 0, 2, 1.0);
+
+    status = gsl_linalg_sqrtm(A, X, w);
+    gsl_test(status != GSL_EDOM, "sqrtm negative eigenvalue status=%d", status);
+
+    status = gsl_linalg_logm(A, X, w);
+    gsl_test(status != GSL_EDOM, "logm negative eigenvalue status=%d", status);
+
+    gsl_set_error_handler(old_handler);
+
+    gsl_matrix_free(A);
+    gsl_matrix_free(X);
+    gsl_linalg_matfunc_free(w);
+  }
+
+  for (i = 0; i < sizeof(N) / sizeof(N[0]); ++i)
+    {
+      gsl_matrix * A = gsl_matrix_alloc(N[i], N[i]);
+
+      /* eigenvalues in the right half plane, mostly complex */
+      create_random_matrix(A, r);
+      gsl_matrix_add_diagonal(A, (double) N[i]);
+      s += test_sqrtm_logm_eps(A, 1.0e3 * N[i] * GSL_DBL_EPSILON, "sqrtm/logm random");
+
+      create_posdef_matrix(A, r);
+      s += test_sqrtm_logm_eps(A, 1.0e3 * N[i] * GSL_DBL_EPSILON, "sqrtm/logm posdef");
+
+      gsl_matrix_free(A);
+    }
+
+  gsl_rng_free(r);
+
+  return s;
+}
+
+/* y = A x through the operator interface */
+static int
+test_expmv_matvec(CBLAS_TRANSPOSE_t TransA, const gsl_vector * x, gsl_vector * y, void * params)
+{
+  const gsl_matrix * A = (const gsl_matrix *) params;
+  return gsl_blas_dgemv(TransA, 1.0, A, x, 0.0, y);
+}
+
+/* compare exp(tA) v from gsl_linalg_expmv with gsl_linalg_expm */
+static int
+test_expmv_eps(const double t, const gsl_matrix * A, const size_t m, gsl_rng * r,
+               const double eps, const char * desc)
+{
+  int s = 0;
+  const size_t N = A->size1;
+  gsl_matrix * tA = gsl_matrix_alloc(N, N);
+  gsl_matrix * etA = gsl_matrix_alloc(N, N);
+  gsl_vector * v = gsl_vector_alloc(N);
+  gsl_vector * y = gsl_vector_alloc(N);
+  gsl_vector * expected = gsl_vector_alloc(N);
+  gsl_linalg_matfunc_workspace * w = gsl_linalg_matfunc_alloc(N);
+  gsl_linalg_expmv_workspace * wv = gsl_linalg_expmv_alloc(N, m);
+  double ynorm;
+  size_t i;
+
+  create_random_vector(v, r);
+
+  gsl_matrix_memcpy(tA, A);
+  gsl_matrix_scale(tA, t);
+  gsl_linalg_expm(tA, etA, w);
+  gsl_blas_dgemv(CblasNoTrans, 1.0, etA, v, 0.0, expected);
+  ynorm = GSL_MAX(gsl_blas_dnrm2(expected), 1.0);
+
+  s += gsl_linalg_expmv(t, A, v, 1.0e-12, y, wv);
+
+  for (i = 0; i < N; ++i)
+    gsl_test_abs(gsl_vector_get(y, i), gsl_vector_get(expected, i), eps * ynorm,
+                 "%s N=%zu m=%zu t=%g [%zu]", desc, N, m, t, i);
+
+  /* operator form, in place */
+  gsl_vector_memcpy(y, v);
+  s += gsl_linalg_expmv_op(test_expmv_matvec, (void *) A, t, y, 1.0e-12, y, wv);
+
+  for (i = 0; i < N; ++i)
+    gsl_test_abs(gsl_vector_get(y, i), gsl_vector_get(expected, i), eps * ynorm,
+                 "%s op N=%zu m=%zu t=%g [%zu]", desc, N, m, t, i);
+
+  gsl_matrix_free(tA);
+  gsl_matrix_free(etA);
+  gsl_vector_free(v);
+  gsl_vector_free(y);
+  gsl_vector_free(expected);
+  gsl_linalg_matfunc_free(w);
+  gsl_linalg_expmv_free(wv);
+
+  return s;
+}
+
+static int
+test_expmv(void)
+{
+  int s = 0;
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  const double t[] = { 0.1, 1.0, -2.0, 10.0 };
+  size_t k;
+
+  {
+    const size_t N = 150;
+    gsl_matrix * A = gsl_matrix_alloc(N, N);
+
+    /* a stable generator with ||A|| of order 1 */
+    create_random_matrix(A, r);
+    gsl_matrix_scale(A, 1.0 / sqrt((double) N));
+    gsl_matrix_add_diagonal(A, -1.0);
+
+    for (k = 0; k < sizeof(t) / sizeof(t[0]); ++k)
+      {
+        s += test_expmv_eps(t[k], A, 30, r, 1.0e-9, "expmv random");
+        s += test_expmv_eps(t[k], A, 10, r, 1.0e-9, "expmv random");
+      }
+
+    gsl_matrix_free(A);
+  }
+
+  {
+    /* Krylov space equal to the whole space */
+    const size_t N = 8;
+    gsl_matrix * A = gsl_matrix_alloc(N, N);
+
+    create_random_matrix(A, r);
+    s += test_expmv_eps(1.0, A, N, r, 1.0e-10, "expmv invariant");
+    s += test_expmv_eps(1.0, A, 3, r, 1.0e-10, "expmv small");
+
+    gsl_matrix_free(A);
+  }
+
+  gsl_rng_free(r);
+
+  return s;
+}
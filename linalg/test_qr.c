@@ -156,6 +156,35 @@ test_QR_decomp_r_eps(const gsl_matrix * m, const double eps, const char * desc)
         }
     }
 
+  /* test Q_1 = Q(:,1:N), computed separately and in place */
+  {
+    gsl_matrix * Q1_alt = gsl_matrix_alloc(M, N);
+
+    s += gsl_linalg_QR_Q1_r(QR, T, Q1_alt);
+    s += gsl_linalg_QR_Q1_r(QR, T, QR);
+
+    for (i = 0; i < M; i++)
+      {
+        for (j = 0; j < N; j++)
+          {
+            double aij = gsl_matrix_get(&Q1.matrix, i, j);
+            double bij = gsl_matrix_get(Q1_alt, i, j);
+            double cij = gsl_matrix_get(QR, i, j);
+
+            gsl_test_rel(bij, aij, eps, "%s Q1 (%3lu,%3lu)[%lu,%lu]: %22.18g   %22.18g\n",
+                         desc, M, N, i, j, bij, aij);
+            gsl_test_rel(cij, aij, eps, "%s Q1 in place (%3lu,%3lu)[%lu,%lu]: %22.18g   %22.18g\n",
+                         desc, M, N, i, j, cij, aij);
+          }
+      }
+
+    /* restore QR for the comparison below */
+    gsl_matrix_memcpy(QR, m);
+    gsl_linalg_QR_decomp_r(QR, T);
+
+    gsl_matrix_free(Q1_alt);
+  }
+
   if (M > N)
     {
       gsl_matrix * R_alt  = gsl_matrix_alloc(M, N);
@@ -447,6 +476,159 @@ test_QR_lssolve_r(gsl_rng * r)
   return s;
 }
 
+static int
+test_QR_decomp_tsqr_eps(const gsl_matrix * A, gsl_thread_pool * pool, const double eps, const char * desc)
+{
+  int s = 0;
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  size_t i, j;
+
+  gsl_matrix * QR = gsl_matrix_alloc(M, N);
+  gsl_matrix * T = gsl_matrix_alloc(N, N);
+  gsl_matrix * QR_r = gsl_matrix_alloc(M, N);
+  gsl_matrix * T_r = gsl_matrix_alloc(N, N);
+  gsl_matrix * QR_1 = gsl_matrix_alloc(M, N);
+  gsl_matrix * T_1 = gsl_matrix_alloc(N, N);
+  gsl_matrix * V = gsl_matrix_alloc(M, N);
+  gsl_matrix * Q = gsl_matrix_alloc(M, N);
+  gsl_matrix * W = gsl_matrix_alloc(N, N);
+  gsl_matrix * QTQ = gsl_matrix_alloc(N, N);
+  gsl_vector * b = gsl_vector_alloc(M);
+  gsl_vector * x = gsl_vector_alloc(M);
+  gsl_vector * x_r = gsl_vector_alloc(M);
+  gsl_vector * work = gsl_vector_alloc(N);
+  gsl_matrix_view V1 = gsl_matrix_submatrix(V, 0, 0, N, N);
+  gsl_matrix_view Q1 = gsl_matrix_submatrix(Q, 0, 0, N, N);
+  gsl_matrix_view R = gsl_matrix_submatrix(QR, 0, 0, N, N);
+
+  /* the lower triangle of T is not referenced */
+  gsl_matrix_set_zero(T);
+  gsl_matrix_set_zero(T_1);
+
+  gsl_matrix_memcpy(QR, A);
+  s += gsl_linalg_QR_decomp_tsqr(QR, T, pool);
+
+  /* the result must not depend on the number of threads */
+  gsl_matrix_memcpy(QR_1, A);
+  s += gsl_linalg_QR_decomp_tsqr(QR_1, T_1, NULL);
+  gsl_test(!gsl_matrix_equal(QR, QR_1) || !gsl_matrix_equal(T, T_1),
+           "%s (%3lu,%3lu) threads", desc, M, N);
+
+  /* Q(:,1:N) = [I; 0] - V T V_1^T */
+  gsl_matrix_set_zero(V);
+  gsl_matrix_tricpy(CblasLower, CblasUnit, V, QR);
+  for (i = 0; i < N; i++)
+    gsl_matrix_set(V, i, i, 1.0);
+
+  gsl_matrix_transpose_memcpy(W, &V1.matrix);
+  gsl_blas_dtrmm(CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0, T, W);
+  gsl_matrix_set_zero(Q);
+  gsl_matrix_set_identity(&Q1.matrix);
+  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, -1.0, V, W, 1.0, Q);
+
+  /* Q^T Q = I */
+  gsl_blas_dsyrk(CblasLower, CblasTrans, 1.0, Q, 0.0, QTQ);
+  for (i = 0; i < N; i++)
+    {
+      for (j = 0; j <= i; j++)
+        {
+          double aij = gsl_matrix_get(QTQ, i, j);
+
+          gsl_test_abs(aij, (i == j) ? 1.0 : 0.0, eps, "%s Q^T Q (%3lu,%3lu)[%lu,%lu]: %22.18g\n",
+                       desc, M, N, i, j, aij);
+        }
+    }
+
+  /* Q R = A */
+  gsl_blas_dtrmm(CblasRight, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0, &R.matrix, Q);
+  for (i = 0; i < M; i++)
+    {
+      for (j = 0; j < N; j++)
+        {
+          double aij = gsl_matrix_get(Q, i, j);
+          double mij = gsl_matrix_get(A, i, j);
+
+          gsl_test_abs(aij, mij, eps, "%s QR (%3lu,%3lu)[%lu,%lu]: %22.18g   %22.18g\n",
+                       desc, M, N, i, j, aij, mij);
+        }
+    }
+
+  /* least squares solution agrees with gsl_linalg_QR_decomp_r */
+  for (i = 0; i < M; i++)
+    gsl_vector_set(b, i, sin(i + 1.0));
+
+  gsl_matrix_memcpy(QR_r, A);
+  s += gsl_linalg_QR_decomp_r(QR_r, T_r);
+  s += gsl_linalg_QR_lssolve_r(QR_r, T_r, b, x_r, work);
+  s += gsl_linalg_QR_lssolve_r(QR, T, b, x, work);
+
+  for (i = 0; i < M; i++)
+    {
+      double xi = gsl_vector_get(x, i);
+      double yi = gsl_vector_get(x_r, i);
+
+      /* the residual part of x depends on the signs of R */
+      if (i >= N)
+        {
+          xi = fabs(xi);
+          yi = fabs(yi);
+        }
+
+      gsl_test_abs(xi, yi, eps, "%s lssolve (%3lu,%3lu)[%lu]: %22.18g   %22.18g\n",
+                   desc, M, N, i, xi, yi);
+    }
+
+  gsl_matrix_free(QR);
+  gsl_matrix_free(T);
+  gsl_matrix_free(QR_r);
+  gsl_matrix_free(T_r);
+  gsl_matrix_free(QR_1);
+  gsl_matrix_free(T_1);
+  gsl_matrix_free(V);
+  gsl_matrix_free(Q);
+  gsl_matrix_free(W);
+  gsl_matrix_free(QTQ);
+  gsl_vector_free(b);
+  gsl_vector_free(x);
+  gsl_vector_free(x_r);
+  gsl_vector_free(work);
+
+  return s;
+}
+
+static int
+test_QR_decomp_tsqr(void)
+{
+  int s = 0;
+  const size_t M[] = { 100, 4096, 4099, 7000, 9000 };
+  const size_t N[] = { 1, 3, 17, 40, 260 };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  gsl_thread_pool * pool = gsl_thread_pool_alloc(4);
+  size_t i, j;
+
+  for (i = 0; i < sizeof(M) / sizeof(M[0]); ++i)
+    {
+      for (j = 0; j < sizeof(N) / sizeof(N[0]); ++j)
+        {
+          gsl_matrix * A;
+
+          if (N[j] > M[i])
+            continue;
+
+          A = gsl_matrix_alloc(M[i], N[j]);
+          create_random_matrix(A, r);
+          s += test_QR_decomp_tsqr_eps(A, pool, 1.0e4 * GSL_DBL_EPSILON, "QR_decomp_tsqr random");
+          gsl_matrix_free(A);
+        }
+    }
+
+  gsl_thread_pool_free(pool);
+  gsl_rng_free(r);
+
+  return s;
+}
+
 static int
 test_QR_TR_decomp_eps(const gsl_matrix * S, const gsl_matrix * A, const double eps, const char * desc)
 {
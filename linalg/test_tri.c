@@ -48,6 +48,22 @@ test_symmtd_decomp_eps(const gsl_matrix * m, const double eps, const char * desc
   s += gsl_linalg_symmtd_unpack(A, tau, Q, &diag.vector, &subdiag.vector);
   gsl_vector_memcpy(&superdiag.vector, &subdiag.vector);
   
+  /* check Q I computed by gsl_linalg_symmtd_Qmat against Q */
+  gsl_matrix_set_identity(B);
+  s += gsl_linalg_symmtd_Qmat(A, tau, B);
+
+  for (i = 0; i < N; i++)
+    {
+      for (j = 0; j < N; j++)
+        {
+          double bij = gsl_matrix_get(B, i, j);
+          double qij = gsl_matrix_get(Q, i, j);
+
+          gsl_test_abs(bij, qij, eps, "%s Qmat (%3lu)[%lu,%lu]: %22.18g   %22.18g\n",
+                       desc, N, i, j, bij, qij);
+        }
+    }
+
   gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, Q, T, 0.0, A); /* A := Q T */
   gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, A, Q, 0.0, B);   /* B := Q T Q^T */
 
@@ -75,8 +91,11 @@ test_symmtd_decomp_eps(const gsl_matrix * m, const double eps, const char * desc
 static int
 test_symmtd_decomp(gsl_rng * r)
 {
+  /* the larger sizes use the blocked algorithm */
+  const size_t large[] = { 100, 131, 200 };
+  gsl_rng * r2 = gsl_rng_alloc(gsl_rng_default);
   int s = 0;
-  size_t N;
+  size_t N, i;
 
   for (N = 2; N <= 50; ++N)
     {
@@ -88,6 +107,95 @@ test_symmtd_decomp(gsl_rng * r)
       gsl_matrix_free(A);
     }
 
+  for (i = 0; i < sizeof(large) / sizeof(large[0]); ++i)
+    {
+      gsl_matrix * A;
+
+      N = large[i];
+      A = gsl_matrix_alloc(N, N);
+
+      create_symm_matrix(A, r2);
+      s += test_symmtd_decomp_eps(A, 1.0e5 * N * GSL_DBL_EPSILON, "symmtd_decomp random");
+
+      gsl_matrix_free(A);
+    }
+
+  gsl_rng_free(r2);
+
+  return s;
+}
+
+static int
+test_hessenberg_decomp_eps(const gsl_matrix * m, const double eps, const char * desc)
+{
+  int s = 0;
+  const size_t N = m->size1;
+  size_t i, j;
+
+  gsl_matrix * U = gsl_matrix_alloc(N, N);
+  gsl_matrix * A  = gsl_matrix_alloc(N, N);
+  gsl_matrix * B  = gsl_matrix_alloc(N, N);
+  gsl_vector * tau = gsl_vector_alloc(N);
+
+  gsl_matrix_memcpy(A, m);
+  s += gsl_linalg_hessenberg_decomp(A, tau);
+  s += gsl_linalg_hessenberg_unpack(A, tau, U);
+  s += gsl_linalg_hessenberg_set_zero(A);
+
+  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, U, A, 0.0, B); /* B := U H */
+  gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, B, U, 0.0, A);   /* A := U H U^T */
+
+  for (i = 0; i < N; i++)
+    {
+      for (j = 0; j < N; j++)
+        {
+          double aij = gsl_matrix_get(A, i, j);
+          double mij = gsl_matrix_get(m, i, j);
+
+          gsl_test_abs(aij, mij, eps, "%s (%3lu)[%lu,%lu]: %22.18g   %22.18g\n",
+                       desc, N, i, j, aij, mij);
+        }
+    }
+
+  gsl_matrix_free(U);
+  gsl_matrix_free(A);
+  gsl_matrix_free(B);
+  gsl_vector_free(tau);
+
+  return s;
+}
+
+static int
+test_hessenberg_decomp(gsl_rng * r)
+{
+  /* the larger sizes use the blocked algorithm */
+  const size_t large[] = { 65, 96, 97, 131, 200 };
+  int s = 0;
+  size_t N, i;
+
+  for (N = 1; N <= 20; ++N)
+    {
+      gsl_matrix * A = gsl_matrix_alloc(N, N);
+
+      create_random_matrix(A, r);
+      s += test_hessenberg_decomp_eps(A, 1.0e3 * N * GSL_DBL_EPSILON, "hessenberg_decomp random");
+
+      gsl_matrix_free(A);
+    }
+
+  for (i = 0; i < sizeof(large) / sizeof(large[0]); ++i)
+    {
+      gsl_matrix * A;
+
+      N = large[i];
+      A = gsl_matrix_alloc(N, N);
+
+      create_random_matrix(A, r);
+      s += test_hessenberg_decomp_eps(A, 1.0e3 * N * GSL_DBL_EPSILON, "hessenberg_decomp random");
+
+      gsl_matrix_free(A);
+    }
+
   return s;
 }
 
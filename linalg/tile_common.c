@@ -0,0 +1,177 @@
+/* linalg/tile_common.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Task graph of the tiled right-looking factorization of a symmetric
+ * matrix stored in the lower triangle (Cholesky and LDLT). With the
+ * matrix divided into nt-by-nt tiles of size TILE_NB, step k consists of
+ *
+ * TILE_DIAG(k)      factor A_kk
+ * TILE_TRSM(i,k)    A_ik := A_ik solved with the factor of A_kk, i > k
+ * TILE_SYRK(i,k)    A_ii -= L_ik D_k L_ik^T, i > k
+ * TILE_GEMM(i,j,k)  A_ij -= L_ik D_k L_jk^T, i > j > k
+ *
+ * (D_k = I for Cholesky). Each task depends on the last task which
+ * wrote one of the tiles it accesses. Tiles are never written after
+ * they are read by a later step, so these are the only dependencies.
+ * The tasks of a step are created with the critical path first, which
+ * is the order in which thread_dag_run() schedules the successors
+ * of a task.
+ */
+
+#include "../sys/thread_pool.h"
+
+enum
+{
+  TILE_DIAG,
+  TILE_TRSM,
+  TILE_SYRK,
+  TILE_GEMM
+};
+
+typedef struct
+{
+  int op;
+  size_t i, j, k;
+} tile_task;
+
+/* tile (i,j) of A */
+static gsl_matrix_view
+tile_view (gsl_matrix * A, const size_t i, const size_t j)
+{
+  const size_t N = A->size1;
+  const size_t r0 = i * TILE_NB;
+  const size_t c0 = j * TILE_NB;
+
+  return gsl_matrix_submatrix (A, r0, c0, GSL_MIN (TILE_NB, N - r0),
+                               GSL_MIN (TILE_NB, A->size2 - c0));
+}
+
+/* add the edge from the last writer of tile t, unless already added */
+static void
+tile_dep (thread_dag * dag, const size_t * last, const size_t t,
+          const size_t id, size_t * prev, size_t * nprev)
+{
+  const size_t from = last[t];
+  size_t m;
+
+  if (from == (size_t) -1)
+    return;
+
+  for (m = 0; m < *nprev; m++)
+    {
+      if (prev[m] == from)
+        return;
+    }
+
+  prev[(*nprev)++] = from;
+  thread_dag_edge (dag, from, id);
+}
+
+/* build the task graph for nt-by-nt tiles; returns NULL on error */
+static tile_task *
+tile_sym_tasks (const size_t nt, thread_dag ** dag_out, size_t * ntasks_out)
+{
+  size_t ntasks = 0, id = 0;
+  size_t i, j, k;
+  tile_task *tasks;
+  size_t *last;
+  thread_dag *dag;
+
+  for (k = 0; k < nt; k++)
+    {
+      const size_t m = nt - k - 1;
+      ntasks += 1 + 2 * m + m * (m - 1) / 2;
+    }
+
+  tasks = malloc (ntasks * sizeof (tile_task));
+  last = malloc (nt * nt * sizeof (size_t));
+  dag = thread_dag_alloc (ntasks, 3 * ntasks);
+
+  if (tasks == NULL || last == NULL || dag == NULL)
+    {
+      free (tasks);
+      free (last);
+      thread_dag_free (dag);
+      GSL_ERROR_NULL ("failed to allocate tile tasks", GSL_ENOMEM);
+    }
+
+  for (i = 0; i < nt * nt; i++)
+    last[i] = (size_t) -1;
+
+  for (k = 0; k < nt; k++)
+    {
+      size_t prev[3], nprev;
+
+      /* A_kk */
+      nprev = 0;
+      tile_dep (dag, last, k * nt + k, id, prev, &nprev);
+      tasks[id].op = TILE_DIAG;
+      tasks[id].i = tasks[id].j = tasks[id].k = k;
+      last[k * nt + k] = id++;
+
+      for (i = k + 1; i < nt; i++)
+        {
+          /* A_ik */
+          nprev = 0;
+          tile_dep (dag, last, k * nt + k, id, prev, &nprev);
+          tile_dep (dag, last, i * nt + k, id, prev, &nprev);
+          tasks[id].op = TILE_TRSM;
+          tasks[id].i = i;
+          tasks[id].j = tasks[id].k = k;
+          last[i * nt + k] = id++;
+        }
+
+      for (i = k + 1; i < nt; i++)
+        {
+          /* A_ii */
+          nprev = 0;
+          tile_dep (dag, last, i * nt + k, id, prev, &nprev);
+          tile_dep (dag, last, i * nt + i, id, prev, &nprev);
+          tasks[id].op = TILE_SYRK;
+          tasks[id].i = tasks[id].j = i;
+          tasks[id].k = k;
+          last[i * nt + i] = id++;
+        }
+
+      for (j = k + 1; j < nt; j++)
+        {
+          for (i = j + 1; i < nt; i++)
+            {
+              /* A_ij */
+              nprev = 0;
+              tile_dep (dag, last, i * nt + k, id, prev, &nprev);
+              tile_dep (dag, last, j * nt + k, id, prev, &nprev);
+              tile_dep (dag, last, i * nt + j, id, prev, &nprev);
+              tasks[id].op = TILE_GEMM;
+              tasks[id].i = i;
+              tasks[id].j = j;
+              tasks[id].k = k;
+              last[i * nt + j] = id++;
+            }
+        }
+    }
+
+  free (last);
+
+  *dag_out = dag;
+  *ntasks_out = ntasks;
+
+  return tasks;
+}
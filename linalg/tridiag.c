@@ -26,6 +26,8 @@
 #include "tridiag.h"
 #include <gsl/gsl_linalg.h>
 
+#include "workspace.h"
+
 /* for description of method see [Engeln-Mullges + Uhlig, p. 92]
  *
  *     diag[0]  offdiag[0]             0   .....
@@ -40,79 +42,63 @@ solve_tridiag(
   const double offdiag[], size_t o_stride,
   const double b[], size_t b_stride,
   double x[], size_t x_stride,
-  size_t N)
+  size_t N,
+  double work[])
 {
   int status = GSL_SUCCESS;
-  double *gamma = (double *) malloc (N * sizeof (double));
-  double *alpha = (double *) malloc (N * sizeof (double));
-  double *c = (double *) malloc (N * sizeof (double));
-  double *z = (double *) malloc (N * sizeof (double));
+  double *gamma = work;
+  double *alpha = work + N;
+  double *c = work + 2 * N;
+  double *z = work + 3 * N;
+  size_t i, j;
+
+  /* Cholesky decomposition
+     A = L.D.L^t
+     lower_diag(L) = gamma
+     diag(D) = alpha
+   */
+  alpha[0] = diag[0];
+  gamma[0] = offdiag[0] / alpha[0];
+
+  if (alpha[0] == 0) {
+    status = GSL_EZERODIV;
+  }
 
-  if (gamma == 0 || alpha == 0 || c == 0 || z == 0)
-    {
-      GSL_ERROR("failed to allocate working space", GSL_ENOMEM);
-    }
-  else
+  for (i = 1; i < N - 1; i++)
     {
-      size_t i, j;
-
-      /* Cholesky decomposition
-         A = L.D.L^t
-         lower_diag(L) = gamma
-         diag(D) = alpha
-       */
-      alpha[0] = diag[0];
-      gamma[0] = offdiag[0] / alpha[0];
-
-      if (alpha[0] == 0) {
+      alpha[i] = diag[d_stride * i] - offdiag[o_stride*(i - 1)] * gamma[i - 1];
+      gamma[i] = offdiag[o_stride * i] / alpha[i];
+      if (alpha[i] == 0) {
         status = GSL_EZERODIV;
       }
+    }
 
-      for (i = 1; i < N - 1; i++)
-        {
-          alpha[i] = diag[d_stride * i] - offdiag[o_stride*(i - 1)] * gamma[i - 1];
-          gamma[i] = offdiag[o_stride * i] / alpha[i];
-          if (alpha[i] == 0) {
-            status = GSL_EZERODIV;
-          }
-        }
-
-      if (N > 1) 
-        {
-          alpha[N - 1] = diag[d_stride * (N - 1)] - offdiag[o_stride*(N - 2)] * gamma[N - 2];
-        }
+  if (N > 1) 
+    {
+      alpha[N - 1] = diag[d_stride * (N - 1)] - offdiag[o_stride*(N - 2)] * gamma[N - 2];
+    }
 
-      /* update RHS */
-      z[0] = b[0];
-      for (i = 1; i < N; i++)
-        {
-          z[i] = b[b_stride * i] - gamma[i - 1] * z[i - 1];
-        }
-      for (i = 0; i < N; i++)
-        {
-          c[i] = z[i] / alpha[i];
-        }
+  /* update RHS */
+  z[0] = b[0];
+  for (i = 1; i < N; i++)
+    {
+      z[i] = b[b_stride * i] - gamma[i - 1] * z[i - 1];
+    }
+  for (i = 0; i < N; i++)
+    {
+      c[i] = z[i] / alpha[i];
+    }
 
-      /* backsubstitution */
-      x[x_stride * (N - 1)] = c[N - 1];
-      if (N >= 2)
+  /* backsubstitution */
+  x[x_stride * (N - 1)] = c[N - 1];
+  if (N >= 2)
+    {
+      for (i = N - 2, j = 0; j <= N - 2; j++, i--)
         {
-          for (i = N - 2, j = 0; j <= N - 2; j++, i--)
-            {
-              x[x_stride * i] = c[i] - gamma[i] * x[x_stride * (i + 1)];
-            }
+          x[x_stride * i] = c[i] - gamma[i] * x[x_stride * (i + 1)];
         }
     }
 
-  if (z != 0)
-    free (z);
-  if (c != 0)
-    free (c);
-  if (alpha != 0)
-    free (alpha);
-  if (gamma != 0)
-    free (gamma);
-
   if (status == GSL_EZERODIV) {
     GSL_ERROR ("matrix must be positive definite", status);
   }
@@ -135,58 +121,46 @@ solve_tridiag_nonsym(
   const double belowdiag[], size_t b_stride,
   const double rhs[], size_t r_stride,
   double x[], size_t x_stride,
-  size_t N)
+  size_t N,
+  double work[])
 {
   int status = GSL_SUCCESS;
-  double *alpha = (double *) malloc (N * sizeof (double));
-  double *z = (double *) malloc (N * sizeof (double));
+  double *alpha = work;
+  double *z = work + N;
+  size_t i, j;
+
+  /* Bidiagonalization (eliminating belowdiag)
+     & rhs update
+     diag' = alpha
+     rhs' = z
+   */
+  alpha[0] = diag[0];
+  z[0] = rhs[0];
+  
+  if (alpha[0] == 0) {
+    status = GSL_EZERODIV;
+  }
 
-  if (alpha == 0 || z == 0)
-    {
-      GSL_ERROR("failed to allocate working space", GSL_ENOMEM);
-    }
-  else
+  for (i = 1; i < N; i++)
     {
-      size_t i, j;
-
-      /* Bidiagonalization (eliminating belowdiag)
-         & rhs update
-         diag' = alpha
-         rhs' = z
-       */
-      alpha[0] = diag[0];
-      z[0] = rhs[0];
-      
-      if (alpha[0] == 0) {
+      const double t = belowdiag[b_stride*(i - 1)]/alpha[i-1];
+      alpha[i] = diag[d_stride*i] - t*abovediag[a_stride*(i - 1)];
+      z[i] = rhs[r_stride*i] - t*z[i-1];
+      if (alpha[i] == 0) {
         status = GSL_EZERODIV;
       }
+    }
 
-      for (i = 1; i < N; i++)
-        {
-          const double t = belowdiag[b_stride*(i - 1)]/alpha[i-1];
-          alpha[i] = diag[d_stride*i] - t*abovediag[a_stride*(i - 1)];
-          z[i] = rhs[r_stride*i] - t*z[i-1];
-          if (alpha[i] == 0) {
-            status = GSL_EZERODIV;
-          }
-        }
-
-      /* backsubstitution */
-      x[x_stride * (N - 1)] = z[N - 1]/alpha[N - 1];
-      if (N >= 2)
+  /* backsubstitution */
+  x[x_stride * (N - 1)] = z[N - 1]/alpha[N - 1];
+  if (N >= 2)
+    {
+      for (i = N - 2, j = 0; j <= N - 2; j++, i--)
         {
-          for (i = N - 2, j = 0; j <= N - 2; j++, i--)
-            {
-              x[x_stride * i] = (z[i] - abovediag[a_stride*i] * x[x_stride * (i + 1)])/alpha[i];
-            }
+          x[x_stride * i] = (z[i] - abovediag[a_stride*i] * x[x_stride * (i + 1)])/alpha[i];
         }
     }
 
-  if (z != 0)
-    free (z);
-  if (alpha != 0)
-    free (alpha);
-
   if (status == GSL_EZERODIV) {
     GSL_ERROR ("matrix must be positive definite", status);
   }
@@ -211,106 +185,83 @@ solve_cyc_tridiag(
   const double offdiag[], size_t o_stride,
   const double b[], size_t b_stride,
   double x[], size_t x_stride,
-  size_t N)
+  size_t N,
+  double work[])
 {
   int status = GSL_SUCCESS;
-  double * delta = (double *) malloc (N * sizeof (double));
-  double * gamma = (double *) malloc (N * sizeof (double));
-  double * alpha = (double *) malloc (N * sizeof (double));
-  double * c = (double *) malloc (N * sizeof (double));
-  double * z = (double *) malloc (N * sizeof (double));
+  double * delta = work;
+  double * gamma = work + N;
+  double * alpha = work + 2 * N;
+  double * c = work + 3 * N;
+  double * z = work + 4 * N;
+  size_t i, j;
+  double sum = 0.0;
+
+  /* factor */
 
-  if (delta == 0 || gamma == 0 || alpha == 0 || c == 0 || z == 0)
+  if (N == 1) 
     {
-      GSL_ERROR("failed to allocate working space", GSL_ENOMEM);
+      x[0] = b[0] / diag[0];
+      return GSL_SUCCESS;
     }
-  else
-    {
-      size_t i, j;
-      double sum = 0.0;
 
-      /* factor */
+  alpha[0] = diag[0];
+  gamma[0] = offdiag[0] / alpha[0];
+  delta[0] = offdiag[o_stride * (N-1)] / alpha[0];
 
-      if (N == 1) 
-        {
-          x[0] = b[0] / diag[0];
-          free(delta);
-          free(gamma);
-          free(alpha);
-          free(c);
-          free(z);
-          return GSL_SUCCESS;
-        }
-
-      alpha[0] = diag[0];
-      gamma[0] = offdiag[0] / alpha[0];
-      delta[0] = offdiag[o_stride * (N-1)] / alpha[0];
+  if (alpha[0] == 0) {
+    status = GSL_EZERODIV;
+  }
 
-      if (alpha[0] == 0) {
+  for (i = 1; i < N - 2; i++)
+    {
+      alpha[i] = diag[d_stride * i] - offdiag[o_stride * (i-1)] * gamma[i - 1];
+      gamma[i] = offdiag[o_stride * i] / alpha[i];
+      delta[i] = -delta[i - 1] * offdiag[o_stride * (i-1)] / alpha[i];
+      if (alpha[i] == 0) {
         status = GSL_EZERODIV;
       }
+    }
 
-      for (i = 1; i < N - 2; i++)
-        {
-          alpha[i] = diag[d_stride * i] - offdiag[o_stride * (i-1)] * gamma[i - 1];
-          gamma[i] = offdiag[o_stride * i] / alpha[i];
-          delta[i] = -delta[i - 1] * offdiag[o_stride * (i-1)] / alpha[i];
-          if (alpha[i] == 0) {
-            status = GSL_EZERODIV;
-          }
-        }
-
-      for (i = 0; i < N - 2; i++)
-        {
-          sum += alpha[i] * delta[i] * delta[i];
-        }
+  for (i = 0; i < N - 2; i++)
+    {
+      sum += alpha[i] * delta[i] * delta[i];
+    }
 
-      alpha[N - 2] = diag[d_stride * (N - 2)] - offdiag[o_stride * (N - 3)] * gamma[N - 3];
+  alpha[N - 2] = diag[d_stride * (N - 2)] - offdiag[o_stride * (N - 3)] * gamma[N - 3];
 
-      gamma[N - 2] = (offdiag[o_stride * (N - 2)] - offdiag[o_stride * (N - 3)] * delta[N - 3]) / alpha[N - 2];
+  gamma[N - 2] = (offdiag[o_stride * (N - 2)] - offdiag[o_stride * (N - 3)] * delta[N - 3]) / alpha[N - 2];
 
-      alpha[N - 1] = diag[d_stride * (N - 1)] - sum - alpha[(N - 2)] * gamma[N - 2] * gamma[N - 2];
+  alpha[N - 1] = diag[d_stride * (N - 1)] - sum - alpha[(N - 2)] * gamma[N - 2] * gamma[N - 2];
 
-      /* update */
-      z[0] = b[0];
-      for (i = 1; i < N - 1; i++)
-        {
-          z[i] = b[b_stride * i] - z[i - 1] * gamma[i - 1];
-        }
-      sum = 0.0;
-      for (i = 0; i < N - 2; i++)
-        {
-          sum += delta[i] * z[i];
-        }
-      z[N - 1] = b[b_stride * (N - 1)] - sum - gamma[N - 2] * z[N - 2];
-      for (i = 0; i < N; i++)
-        {
-          c[i] = z[i] / alpha[i];
-        }
+  /* update */
+  z[0] = b[0];
+  for (i = 1; i < N - 1; i++)
+    {
+      z[i] = b[b_stride * i] - z[i - 1] * gamma[i - 1];
+    }
+  sum = 0.0;
+  for (i = 0; i < N - 2; i++)
+    {
+      sum += delta[i] * z[i];
+    }
+  z[N - 1] = b[b_stride * (N - 1)] - sum - gamma[N - 2] * z[N - 2];
+  for (i = 0; i < N; i++)
+    {
+      c[i] = z[i] / alpha[i];
+    }
 
-      /* backsubstitution */
-      x[x_stride * (N - 1)] = c[N - 1];
-      x[x_stride * (N - 2)] = c[N - 2] - gamma[N - 2] * x[x_stride * (N - 1)];
-      if (N >= 3)
+  /* backsubstitution */
+  x[x_stride * (N - 1)] = c[N - 1];
+  x[x_stride * (N - 2)] = c[N - 2] - gamma[N - 2] * x[x_stride * (N - 1)];
+  if (N >= 3)
+    {
+      for (i = N - 3, j = 0; j <= N - 3; j++, i--)
         {
-          for (i = N - 3, j = 0; j <= N - 3; j++, i--)
-            {
-              x[x_stride * i] = c[i] - gamma[i] * x[x_stride * (i + 1)] - delta[i] * x[x_stride * (N - 1)];
-            }
+          x[x_stride * i] = c[i] - gamma[i] * x[x_stride * (i + 1)] - delta[i] * x[x_stride * (N - 1)];
         }
     }
 
-  if (z != 0)
-    free (z);
-  if (c != 0)
-    free (c);
-  if (alpha != 0)
-    free (alpha);
-  if (gamma != 0)
-    free (gamma);
-  if (delta != 0)
-    free (delta);
-
   if (status == GSL_EZERODIV) {
     GSL_ERROR ("matrix must be positive definite", status);
   }
@@ -335,109 +286,93 @@ int solve_cyc_tridiag_nonsym(
   const double belowdiag[], size_t b_stride,
   const double rhs[], size_t r_stride,
   double x[], size_t x_stride,
-  size_t N)
+  size_t N,
+  double work[])
 {
   int status = GSL_SUCCESS;
-  double *alpha = (double *) malloc (N * sizeof (double));
-  double *zb = (double *) malloc (N * sizeof (double));
-  double *zu = (double *) malloc (N * sizeof (double));
-  double *w = (double *) malloc (N * sizeof (double));
-
-  if (alpha == 0 || zb == 0 || zu == 0 || w == 0)
-    {
-      GSL_ERROR("failed to allocate working space", GSL_ENOMEM);
+  double *alpha = work;
+  double *zb = work + N;
+  double *zu = work + 2 * N;
+  double *w = work + 3 * N;
+  double beta;
+
+  /* Bidiagonalization (eliminating belowdiag)
+     & rhs update
+     diag' = alpha
+     rhs' = zb
+     rhs' for Aq=u is zu
+   */
+  zb[0] = rhs[0];
+  if (diag[0] != 0) beta = -diag[0]; else beta = 1;
+  {
+    const double q = 1 - abovediag[0]*belowdiag[0]/(diag[0]*diag[d_stride]);
+    if (fabs(q/beta) > 0.5 && fabs(q/beta) < 2) {
+      beta *= (fabs(q/beta) < 1) ? 0.5 : 2;
     }
-  else
-    {
-      double beta;
+  }
+  zu[0] = beta;
+  alpha[0] = diag[0] - beta;
 
-      /* Bidiagonalization (eliminating belowdiag)
-         & rhs update
-         diag' = alpha
-         rhs' = zb
-         rhs' for Aq=u is zu
-       */
-      zb[0] = rhs[0];
-      if (diag[0] != 0) beta = -diag[0]; else beta = 1;
-      {
-        const double q = 1 - abovediag[0]*belowdiag[0]/(diag[0]*diag[d_stride]);
-        if (fabs(q/beta) > 0.5 && fabs(q/beta) < 2) {
-          beta *= (fabs(q/beta) < 1) ? 0.5 : 2;
-        }
-      }
-      zu[0] = beta;
-      alpha[0] = diag[0] - beta;
+  if (alpha[0] == 0) {
+    status = GSL_EZERODIV;
+  }
 
-      if (alpha[0] == 0) {
+  { 
+    size_t i;
+    for (i = 1; i+1 < N; i++)
+    {
+      const double t = belowdiag[b_stride*(i - 1)]/alpha[i-1];
+      alpha[i] = diag[d_stride*i] - t*abovediag[a_stride*(i - 1)];
+      zb[i] = rhs[r_stride*i] - t*zb[i-1];
+      zu[i] = -t*zu[i-1];
+      /* FIXME!!! */
+      if (alpha[i] == 0) {
         status = GSL_EZERODIV;
       }
+    }
+  }
 
-      { 
-        size_t i;
-        for (i = 1; i+1 < N; i++)
-        {
-          const double t = belowdiag[b_stride*(i - 1)]/alpha[i-1];
-          alpha[i] = diag[d_stride*i] - t*abovediag[a_stride*(i - 1)];
-          zb[i] = rhs[r_stride*i] - t*zb[i-1];
-          zu[i] = -t*zu[i-1];
-          /* FIXME!!! */
-          if (alpha[i] == 0) {
-            status = GSL_EZERODIV;
-          }
-        }
-      }
-
-      {
-        const size_t i = N-1;
-        const double t = belowdiag[b_stride*(i - 1)]/alpha[i-1];
-        alpha[i] = diag[d_stride*i]
-                   - abovediag[a_stride*i]*belowdiag[b_stride*i]/beta
-                   - t*abovediag[a_stride*(i - 1)];
-        zb[i] = rhs[r_stride*i] - t*zb[i-1];
-        zu[i] = abovediag[a_stride*i] - t*zu[i-1];
-        /* FIXME!!! */
-        if (alpha[i] == 0) {
-          status = GSL_EZERODIV;
-        }
-      }
+  {
+    const size_t i = N-1;
+    const double t = belowdiag[b_stride*(i - 1)]/alpha[i-1];
+    alpha[i] = diag[d_stride*i]
+               - abovediag[a_stride*i]*belowdiag[b_stride*i]/beta
+               - t*abovediag[a_stride*(i - 1)];
+    zb[i] = rhs[r_stride*i] - t*zb[i-1];
+    zu[i] = abovediag[a_stride*i] - t*zu[i-1];
+    /* FIXME!!! */
+    if (alpha[i] == 0) {
+      status = GSL_EZERODIV;
+    }
+  }
 
-      /* backsubstitution */
-      {
-        size_t i, j;
-        w[N-1] = zu[N-1]/alpha[N-1];
-        x[x_stride*(N-1)] = zb[N-1]/alpha[N-1];
-        for (i = N - 2, j = 0; j <= N - 2; j++, i--)
-          {
-            w[i] = (zu[i] - abovediag[a_stride*i] * w[i+1])/alpha[i];
-            x[i*x_stride] = (zb[i] - abovediag[a_stride*i] * x[x_stride*(i + 1)])/alpha[i];
-          }
-      }
-      
-      /* Sherman-Morrison */
+  /* backsubstitution */
+  {
+    size_t i, j;
+    w[N-1] = zu[N-1]/alpha[N-1];
+    x[x_stride*(N-1)] = zb[N-1]/alpha[N-1];
+    for (i = N - 2, j = 0; j <= N - 2; j++, i--)
       {
-        const double vw = w[0] + belowdiag[b_stride*(N - 1)]/beta * w[N-1];
-        const double vx = x[0] + belowdiag[b_stride*(N - 1)]/beta * x[x_stride*(N - 1)];
-        /* FIXME!!! */
-        if (vw + 1 == 0) {
-          status = GSL_EZERODIV;
-        }
-
-        {
-          size_t i;
-          for (i = 0; i < N; i++)
-            x[i*x_stride] -= vx/(1 + vw)*w[i];
-        }
+        w[i] = (zu[i] - abovediag[a_stride*i] * w[i+1])/alpha[i];
+        x[i*x_stride] = (zb[i] - abovediag[a_stride*i] * x[x_stride*(i + 1)])/alpha[i];
       }
+  }
+  
+  /* Sherman-Morrison */
+  {
+    const double vw = w[0] + belowdiag[b_stride*(N - 1)]/beta * w[N-1];
+    const double vx = x[0] + belowdiag[b_stride*(N - 1)]/beta * x[x_stride*(N - 1)];
+    /* FIXME!!! */
+    if (vw + 1 == 0) {
+      status = GSL_EZERODIV;
     }
 
-  if (zb != 0)
-    free (zb);
-  if (zu != 0)
-    free (zu);
-  if (w != 0)
-    free (w);
-  if (alpha != 0)
-    free (alpha);
+    {
+      size_t i;
+      for (i = 0; i < N; i++)
+        x[i*x_stride] -= vx/(1 + vw)*w[i];
+    }
+  }
 
   if (status == GSL_EZERODIV) {
     GSL_ERROR ("matrix must be positive definite", status);
@@ -446,12 +381,43 @@ int solve_cyc_tridiag_nonsym(
   return status;
 }
 
+/* size in doubles of the arena needed by the _ws tridiagonal solvers */
+
+size_t
+gsl_linalg_tridiag_wsize (const size_t N)
+{
+  return 5 * N;
+}
+
 int
 gsl_linalg_solve_symm_tridiag(
   const gsl_vector * diag,
   const gsl_vector * offdiag,
   const gsl_vector * rhs,
   gsl_vector * solution)
+{
+  gsl_linalg_workspace w;
+  int status;
+
+  if (linalg_workspace_init (&w, gsl_linalg_tridiag_wsize (diag->size)))
+    {
+      GSL_ERROR ("failed to allocate working space", GSL_ENOMEM);
+    }
+
+  status = gsl_linalg_solve_symm_tridiag_ws (diag, offdiag, rhs, solution, &w);
+
+  linalg_workspace_clear (&w);
+
+  return status;
+}
+
+int
+gsl_linalg_solve_symm_tridiag_ws(
+  const gsl_vector * diag,
+  const gsl_vector * offdiag,
+  const gsl_vector * rhs,
+  gsl_vector * solution,
+  gsl_linalg_workspace * w)
 {
   if(diag->size != rhs->size)
     {
@@ -465,14 +431,22 @@ gsl_linalg_solve_symm_tridiag(
     {
       GSL_ERROR ("size of solution must match rhs", GSL_EBADLEN);
     }
+  else if (linalg_workspace_avail (w) < gsl_linalg_tridiag_wsize (diag->size))
+    {
+      GSL_ERROR ("workspace is too small", GSL_EBADLEN);
+    }
   else 
     {
-      return solve_tridiag(diag->data, diag->stride,
-                           offdiag->data, offdiag->stride,
-                           rhs->data, rhs->stride,
-                           solution->data, solution->stride,
-                           diag->size);
+      double *work = linalg_workspace_get (w, gsl_linalg_tridiag_wsize (diag->size));
+      int status = solve_tridiag(diag->data, diag->stride,
+                                 offdiag->data, offdiag->stride,
+                                 rhs->data, rhs->stride,
+                                 solution->data, solution->stride,
+                                 diag->size, work);
+
+      linalg_workspace_release (w, work);
 
+      return status;
     }
 }
 
@@ -483,6 +457,30 @@ gsl_linalg_solve_tridiag(
   const gsl_vector * belowdiag,
   const gsl_vector * rhs,
   gsl_vector * solution)
+{
+  gsl_linalg_workspace w;
+  int status;
+
+  if (linalg_workspace_init (&w, gsl_linalg_tridiag_wsize (diag->size)))
+    {
+      GSL_ERROR ("failed to allocate working space", GSL_ENOMEM);
+    }
+
+  status = gsl_linalg_solve_tridiag_ws (diag, abovediag, belowdiag, rhs, solution, &w);
+
+  linalg_workspace_clear (&w);
+
+  return status;
+}
+
+int
+gsl_linalg_solve_tridiag_ws(
+  const gsl_vector * diag,
+  const gsl_vector * abovediag,
+  const gsl_vector * belowdiag,
+  const gsl_vector * rhs,
+  gsl_vector * solution,
+  gsl_linalg_workspace * w)
 {
   if(diag->size != rhs->size)
     {
@@ -500,24 +498,55 @@ gsl_linalg_solve_tridiag(
     {
       GSL_ERROR ("size of solution must match rhs", GSL_EBADLEN);
     }
+  else if (linalg_workspace_avail (w) < gsl_linalg_tridiag_wsize (diag->size))
+    {
+      GSL_ERROR ("workspace is too small", GSL_EBADLEN);
+    }
   else 
     {
-      return solve_tridiag_nonsym(diag->data, diag->stride,
-                                  abovediag->data, abovediag->stride,
-                                  belowdiag->data, belowdiag->stride,
-                                  rhs->data, rhs->stride,
-                                  solution->data, solution->stride,
-                                  diag->size);
+      double *work = linalg_workspace_get (w, gsl_linalg_tridiag_wsize (diag->size));
+      int status = solve_tridiag_nonsym(diag->data, diag->stride,
+                                        abovediag->data, abovediag->stride,
+                                        belowdiag->data, belowdiag->stride,
+                                        rhs->data, rhs->stride,
+                                        solution->data, solution->stride,
+                                        diag->size, work);
+
+      linalg_workspace_release (w, work);
+
+      return status;
     }
 }
 
-
 int
 gsl_linalg_solve_symm_cyc_tridiag(
   const gsl_vector * diag,
   const gsl_vector * offdiag,
   const gsl_vector * rhs,
   gsl_vector * solution)
+{
+  gsl_linalg_workspace w;
+  int status;
+
+  if (linalg_workspace_init (&w, gsl_linalg_tridiag_wsize (diag->size)))
+    {
+      GSL_ERROR ("failed to allocate working space", GSL_ENOMEM);
+    }
+
+  status = gsl_linalg_solve_symm_cyc_tridiag_ws (diag, offdiag, rhs, solution, &w);
+
+  linalg_workspace_clear (&w);
+
+  return status;
+}
+
+int
+gsl_linalg_solve_symm_cyc_tridiag_ws(
+  const gsl_vector * diag,
+  const gsl_vector * offdiag,
+  const gsl_vector * rhs,
+  gsl_vector * solution,
+  gsl_linalg_workspace * w)
 {
   if(diag->size != rhs->size)
     {
@@ -535,13 +564,22 @@ gsl_linalg_solve_symm_cyc_tridiag(
     {
       GSL_ERROR ("size of cyclic system must be 3 or more", GSL_EBADLEN);
     }
+  else if (linalg_workspace_avail (w) < gsl_linalg_tridiag_wsize (diag->size))
+    {
+      GSL_ERROR ("workspace is too small", GSL_EBADLEN);
+    }
   else 
     {
-      return solve_cyc_tridiag(diag->data, diag->stride,
-                               offdiag->data, offdiag->stride,
-                               rhs->data, rhs->stride,
-                               solution->data, solution->stride,
-                               diag->size);
+      double *work = linalg_workspace_get (w, gsl_linalg_tridiag_wsize (diag->size));
+      int status = solve_cyc_tridiag(diag->data, diag->stride,
+                                     offdiag->data, offdiag->stride,
+                                     rhs->data, rhs->stride,
+                                     solution->data, solution->stride,
+                                     diag->size, work);
+
+      linalg_workspace_release (w, work);
+
+      return status;
     }
 }
 
@@ -552,6 +590,30 @@ gsl_linalg_solve_cyc_tridiag(
   const gsl_vector * belowdiag,
   const gsl_vector * rhs,
   gsl_vector * solution)
+{
+  gsl_linalg_workspace w;
+  int status;
+
+  if (linalg_workspace_init (&w, gsl_linalg_tridiag_wsize (diag->size)))
+    {
+      GSL_ERROR ("failed to allocate working space", GSL_ENOMEM);
+    }
+
+  status = gsl_linalg_solve_cyc_tridiag_ws (diag, abovediag, belowdiag, rhs, solution, &w);
+
+  linalg_workspace_clear (&w);
+
+  return status;
+}
+
+int
+gsl_linalg_solve_cyc_tridiag_ws(
+  const gsl_vector * diag,
+  const gsl_vector * abovediag,
+  const gsl_vector * belowdiag,
+  const gsl_vector * rhs,
+  gsl_vector * solution,
+  gsl_linalg_workspace * w)
 {
   if(diag->size != rhs->size)
     {
@@ -573,13 +635,22 @@ gsl_linalg_solve_cyc_tridiag(
     {
       GSL_ERROR ("size of cyclic system must be 3 or more", GSL_EBADLEN);
     }
+  else if (linalg_workspace_avail (w) < gsl_linalg_tridiag_wsize (diag->size))
+    {
+      GSL_ERROR ("workspace is too small", GSL_EBADLEN);
+    }
   else 
     {
-      return solve_cyc_tridiag_nonsym(diag->data, diag->stride,
-                                      abovediag->data, abovediag->stride,
-                                      belowdiag->data, belowdiag->stride,
-                                      rhs->data, rhs->stride,
-                                      solution->data, solution->stride,
-                                      diag->size);
+      double *work = linalg_workspace_get (w, gsl_linalg_tridiag_wsize (diag->size));
+      int status = solve_cyc_tridiag_nonsym(diag->data, diag->stride,
+                                            abovediag->data, abovediag->stride,
+                                            belowdiag->data, belowdiag->stride,
+                                            rhs->data, rhs->stride,
+                                            solution->data, solution->stride,
+                                            diag->size, work);
+
+      linalg_workspace_release (w, work);
+
+      return status;
     }
 }
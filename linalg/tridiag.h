@@ -35,8 +35,8 @@ int solve_tridiag_nonsym(
   const double belowdiag[], size_t b_stride,
   const double rhs[], size_t r_stride,
   double x[], size_t x_stride,
-  size_t N
-  );
+  size_t N,
+  double work[]);
 
 static
 int solve_tridiag(
@@ -44,7 +44,8 @@ int solve_tridiag(
   const double offdiag[], size_t o_stride,
   const double b[], size_t b_stride,
   double x[], size_t x_stride,
-  size_t N);
+  size_t N,
+  double work[]);
 
 static
 int solve_cyc_tridiag(
@@ -52,8 +53,8 @@ int solve_cyc_tridiag(
   const double offdiag[], size_t o_stride,
   const double b[], size_t b_stride,
   double x[], size_t x_stride,
-  size_t N
-  );
+  size_t N,
+  double work[]);
 
 static
 int solve_cyc_tridiag_nonsym(
@@ -62,6 +63,7 @@ int solve_cyc_tridiag_nonsym(
   const double belowdiag[], size_t b_stride,
   const double rhs[], size_t r_stride,
   double x[], size_t x_stride,
-  size_t N);
+  size_t N,
+  double work[]);
 
 #endif /* __GSL_TRIDIAG_H__ */
@@ -0,0 +1,438 @@
+/* linalg/tridiag_par.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Tridiagonal solvers for many systems at once and for one long system
+ * on a thread pool. The matrices are stored as for
+ * gsl_linalg_solve_tridiag(),
+ *
+ *       diag[0]  abovediag[0]              0    ...
+ *  belowdiag[0]       diag[1]   abovediag[1]    ...
+ *             0  belowdiag[1]        diag[2]    ...
+ *
+ * and, like it, the solvers do not pivot, so they are intended for
+ * diagonally dominant or positive definite systems.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_machine.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_linalg.h>
+
+#include "../sys/thread_pool.h"
+
+/* minimum number of rows per block of gsl_linalg_solve_tridiag_par() */
+#define TRIDIAG_PAR_MIN    1024
+
+/*
+gsl_linalg_solve_tridiag_batch()
+  Solve K independent tridiagonal systems of size N
+
+Inputs: diag      - N-by-K, column k is the diagonal of system k
+        abovediag - (N-1)-by-K, superdiagonals
+        belowdiag - (N-1)-by-K, subdiagonals
+        B         - N-by-K, right hand sides
+        X         - (output) N-by-K, solutions
+
+Notes:
+1) Each step of the Thomas algorithm is applied to all K systems in a
+loop over a row of the matrices, which the compiler can vectorize, so
+that K should be large and the rows contiguous.
+
+2) For N = 1 abovediag and belowdiag are not referenced.
+
+3) X may be the same matrix as B.
+*/
+
+int
+gsl_linalg_solve_tridiag_batch (const gsl_matrix * diag,
+                                const gsl_matrix * abovediag,
+                                const gsl_matrix * belowdiag,
+                                const gsl_matrix * B,
+                                gsl_matrix * X)
+{
+  const size_t N = diag->size1;
+  const size_t K = diag->size2;
+
+  if (B->size1 != N || B->size2 != K)
+    {
+      GSL_ERROR ("size of diag must match B", GSL_EBADLEN);
+    }
+  else if (X->size1 != N || X->size2 != K)
+    {
+      GSL_ERROR ("size of X must match B", GSL_EBADLEN);
+    }
+  else if (N > 1 && (abovediag->size1 != N - 1 || abovediag->size2 != K))
+    {
+      GSL_ERROR ("abovediag must be (N-1)-by-K", GSL_EBADLEN);
+    }
+  else if (N > 1 && (belowdiag->size1 != N - 1 || belowdiag->size2 != K))
+    {
+      GSL_ERROR ("belowdiag must be (N-1)-by-K", GSL_EBADLEN);
+    }
+  else
+    {
+      /* gamma(i,k) = abovediag(i,k) / alpha(i,k), where alpha is the
+         diagonal after the elimination of belowdiag */
+      double *gamma = malloc (N * K * sizeof (double));
+      int zero = 0;
+      size_t i, k;
+
+      if (gamma == NULL)
+        {
+          GSL_ERROR ("failed to allocate working space", GSL_ENOMEM);
+        }
+
+      for (i = 0; i < N; ++i)
+        {
+          const double *d = gsl_matrix_const_ptr (diag, i, 0);
+          const double *b = gsl_matrix_const_ptr (B, i, 0);
+          double *g = gamma + i * K;
+          double *x = gsl_matrix_ptr (X, i, 0);
+
+          if (i == 0)
+            {
+              for (k = 0; k < K && !zero; ++k)
+                zero = (d[k] == 0.0);
+
+              for (k = 0; k < K; ++k)
+                x[k] = b[k] / d[k];
+
+              if (N > 1)
+                {
+                  const double *c = gsl_matrix_const_ptr (abovediag, 0, 0);
+
+                  for (k = 0; k < K; ++k)
+                    g[k] = c[k] / d[k];
+                }
+            }
+          else
+            {
+              const double *a = gsl_matrix_const_ptr (belowdiag, i - 1, 0);
+              const double *gp = gamma + (i - 1) * K;
+              const double *xp = gsl_matrix_const_ptr (X, i - 1, 0);
+
+              /* separate loops, so that each has few enough pointers to
+                 be vectorized */
+              for (k = 0; k < K; ++k)
+                g[k] = 1.0 / (d[k] - a[k] * gp[k]);
+
+              for (k = 0; k < K; ++k)
+                x[k] = (b[k] - a[k] * xp[k]) * g[k];
+
+              /* a zero pivot gives an infinite 1 / alpha */
+              for (k = 0; k < K && !zero; ++k)
+                zero = (fabs (g[k]) > GSL_DBL_MAX);
+
+              if (i < N - 1)
+                {
+                  const double *c = gsl_matrix_const_ptr (abovediag, i, 0);
+
+                  for (k = 0; k < K; ++k)
+                    g[k] *= c[k];
+                }
+            }
+        }
+
+      /* back substitution */
+      for (i = N - 1; i-- > 0; )
+        {
+          const double *g = gamma + i * K;
+          const double *xn = gsl_matrix_const_ptr (X, i + 1, 0);
+          double *x = gsl_matrix_ptr (X, i, 0);
+
+          for (k = 0; k < K; ++k)
+            x[k] -= g[k] * xn[k];
+        }
+
+      free (gamma);
+
+      if (zero)
+        {
+          GSL_ERROR ("zero pivot in tridiagonal system", GSL_EZERODIV);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+ * gsl_linalg_solve_tridiag_par() divides the rows into one block per
+ * thread. Each block [s,e] is reduced independently, by an elimination
+ * down and then up the block, to equations
+ *
+ *   ga(s) x(s-1) + x(s) + gc(s) x(e)   = gb(s)
+ *   ga(i) x(s)   + x(i) + gc(i) x(e)   = gb(i),  s < i < e
+ *   ga(e) x(s)   + x(e) + gc(e) x(e+1) = gb(e)
+ *
+ * The first and last equations of all blocks form a tridiagonal system
+ * for the 2*nblk unknowns x(s), x(e), which is solved serially, and the
+ * remaining unknowns then follow independently in each block. This is
+ * the partitioned form of cyclic reduction of Laszlo, Giles and
+ * Appleyard (2016), with about twice the operations of the serial
+ * solver.
+ */
+
+typedef struct
+{
+  size_t N;
+  size_t nblk;
+  const double *d, *c, *a, *b;   /* diag, abovediag, belowdiag, rhs */
+  size_t d_stride, c_stride, a_stride, b_stride;
+  double *x;
+  size_t x_stride;
+  double *ga, *gc, *gb;          /* reduced equations, length N */
+  int *status;                   /* per block */
+} tridiag_par_work;
+
+/* first row of block k */
+static size_t
+tridiag_block_start (const tridiag_par_work * w, const size_t k)
+{
+  return k * w->N / w->nblk;
+}
+
+/* reduce block t to the equations above */
+static void
+tridiag_par_reduce (void *arg, const size_t t)
+{
+  tridiag_par_work *w = (tridiag_par_work *) arg;
+  const size_t s = tridiag_block_start (w, t);
+  const size_t e = tridiag_block_start (w, t + 1) - 1;
+  const double *d = w->d, *c = w->c, *a = w->a, *b = w->b;
+  double *ga = w->ga, *gc = w->gc, *gb = w->gb;
+  int status = GSL_SUCCESS;
+  size_t i;
+
+  /* downward elimination; row i couples x(s) and x(i+1) */
+  for (i = s; i <= s + 1; ++i)
+    {
+      const double di = d[w->d_stride * i];
+      const double r = 1.0 / di;
+
+      if (di == 0.0)
+        status = GSL_EZERODIV;
+
+      ga[i] = (i > 0) ? a[w->a_stride * (i - 1)] * r : 0.0;
+      gc[i] = (i < w->N - 1) ? c[w->c_stride * i] * r : 0.0;
+      gb[i] = b[w->b_stride * i] * r;
+    }
+
+  for (i = s + 2; i <= e; ++i)
+    {
+      const double ai = a[w->a_stride * (i - 1)];
+      const double alpha = d[w->d_stride * i] - ai * gc[i - 1];
+      const double r = 1.0 / alpha;
+
+      if (alpha == 0.0)
+        status = GSL_EZERODIV;
+
+      gb[i] = r * (b[w->b_stride * i] - ai * gb[i - 1]);
+      gc[i] = (i < w->N - 1) ? r * c[w->c_stride * i] : 0.0;
+      ga[i] = -r * ai * ga[i - 1];
+    }
+
+  /* upward elimination; row i couples x(s) and x(e) */
+  for (i = e - 1; i-- > s + 1; )
+    {
+      gb[i] -= gc[i] * gb[i + 1];
+      ga[i] -= gc[i] * ga[i + 1];
+      gc[i] = -gc[i] * gc[i + 1];
+    }
+
+  /* eliminate x(s+1) from row s */
+  {
+    const double alpha = 1.0 - gc[s] * ga[s + 1];
+    const double r = 1.0 / alpha;
+
+    if (alpha == 0.0)
+      status = GSL_EZERODIV;
+
+    gb[s] = r * (gb[s] - gc[s] * gb[s + 1]);
+    ga[s] = r * ga[s];
+    gc[s] = -r * gc[s] * gc[s + 1];
+  }
+
+  w->status[t] = status;
+}
+
+/* recover the interior unknowns of block t */
+static void
+tridiag_par_subst (void *arg, const size_t t)
+{
+  tridiag_par_work *w = (tridiag_par_work *) arg;
+  const size_t s = tridiag_block_start (w, t);
+  const size_t e = tridiag_block_start (w, t + 1) - 1;
+  double *x = w->x;
+  const size_t xs = w->x_stride;
+  const double xstart = x[xs * s];
+  const double xend = x[xs * e];
+  size_t i;
+
+  for (i = s + 1; i < e; ++i)
+    x[xs * i] = w->gb[i] - w->ga[i] * xstart - w->gc[i] * xend;
+}
+
+/*
+gsl_linalg_solve_tridiag_par()
+  Solve a tridiagonal system with the arguments of gsl_linalg_solve_tridiag(),
+dividing the work between the threads of pool
+*/
+
+int
+gsl_linalg_solve_tridiag_par (const gsl_vector * diag,
+                              const gsl_vector * abovediag,
+                              const gsl_vector * belowdiag,
+                              const gsl_vector * rhs,
+                              gsl_vector * solution,
+                              gsl_thread_pool * pool)
+{
+  const size_t N = diag->size;
+  const size_t nthreads = thread_dag_nthreads (pool);
+  const size_t nblk = GSL_MIN (nthreads, N / TRIDIAG_PAR_MIN);
+
+  if (nblk < 2)
+    {
+      return gsl_linalg_solve_tridiag (diag, abovediag, belowdiag, rhs, solution);
+    }
+  else if (rhs->size != N)
+    {
+      GSL_ERROR ("size of diag must match rhs", GSL_EBADLEN);
+    }
+  else if (abovediag->size != N - 1)
+    {
+      GSL_ERROR ("size of abovediag must match rhs-1", GSL_EBADLEN);
+    }
+  else if (belowdiag->size != N - 1)
+    {
+      GSL_ERROR ("size of belowdiag must match rhs-1", GSL_EBADLEN);
+    }
+  else if (solution->size != N)
+    {
+      GSL_ERROR ("size of solution must match rhs", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t nr = 2 * nblk;  /* size of the reduced system */
+      tridiag_par_work w;
+      double *red;
+      int status = GSL_SUCCESS;
+      size_t k;
+
+      w.N = N;
+      w.nblk = nblk;
+      w.d = diag->data;
+      w.d_stride = diag->stride;
+      w.c = abovediag->data;
+      w.c_stride = abovediag->stride;
+      w.a = belowdiag->data;
+      w.a_stride = belowdiag->stride;
+      w.b = rhs->data;
+      w.b_stride = rhs->stride;
+      w.x = solution->data;
+      w.x_stride = solution->stride;
+      w.ga = malloc (3 * N * sizeof (double));
+      w.status = malloc (nblk * sizeof (int));
+      red = malloc ((5 * nr - 2) * sizeof (double));
+
+      if (w.ga == NULL || w.status == NULL || red == NULL)
+        {
+          free (w.ga);
+          free (w.status);
+          free (red);
+          GSL_ERROR ("failed to allocate working space", GSL_ENOMEM);
+        }
+
+      w.gc = w.ga + N;
+      w.gb = w.gc + N;
+
+      thread_pool_run (pool, nblk, tridiag_par_reduce, &w);
+
+      for (k = 0; k < nblk; ++k)
+        {
+          if (w.status[k])
+            status = w.status[k];
+        }
+
+      if (status)
+        {
+          free (w.ga);
+          free (w.status);
+          free (red);
+          GSL_ERROR ("zero pivot in tridiagonal system", status);
+        }
+      else
+        {
+          /* reduced system in the unknowns x(s_0), x(e_0), x(s_1), ... */
+          gsl_vector_view rd = gsl_vector_view_array (red, nr);
+          gsl_vector_view ra = gsl_vector_view_array (red + nr, nr - 1);
+          gsl_vector_view rb = gsl_vector_view_array (red + 2 * nr - 1, nr - 1);
+          gsl_vector_view rr = gsl_vector_view_array (red + 3 * nr - 2, nr);
+          gsl_vector_view ry = gsl_vector_view_array (red + 4 * nr - 2, nr);
+
+          gsl_vector_set_all (&rd.vector, 1.0);
+
+          for (k = 0; k < nblk; ++k)
+            {
+              const size_t s = tridiag_block_start (&w, k);
+              const size_t e = tridiag_block_start (&w, k + 1) - 1;
+
+              gsl_vector_set (&rr.vector, 2 * k, w.gb[s]);
+              gsl_vector_set (&rr.vector, 2 * k + 1, w.gb[e]);
+              gsl_vector_set (&ra.vector, 2 * k, w.gc[s]);
+
+              if (k > 0)
+                gsl_vector_set (&rb.vector, 2 * k - 1, w.ga[s]);
+
+              gsl_vector_set (&rb.vector, 2 * k, w.ga[e]);
+
+              if (k < nblk - 1)
+                gsl_vector_set (&ra.vector, 2 * k + 1, w.gc[e]);
+            }
+
+          status = gsl_linalg_solve_tridiag (&rd.vector, &ra.vector, &rb.vector,
+                                             &rr.vector, &ry.vector);
+
+          if (status == GSL_SUCCESS)
+            {
+              for (k = 0; k < nblk; ++k)
+                {
+                  const size_t s = tridiag_block_start (&w, k);
+                  const size_t e = tridiag_block_start (&w, k + 1) - 1;
+
+                  gsl_vector_set (solution, s, gsl_vector_get (&ry.vector, 2 * k));
+                  gsl_vector_set (solution, e, gsl_vector_get (&ry.vector, 2 * k + 1));
+                }
+
+              thread_pool_run (pool, nblk, tridiag_par_subst, &w);
+            }
+        }
+
+      free (w.ga);
+      free (w.status);
+      free (red);
+
+      return status;
+    }
+}
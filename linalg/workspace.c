@@ -0,0 +1,128 @@
+/* linalg/workspace.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_linalg.h>
+
+#include "workspace.h"
+
+/*
+ * A gsl_linalg_workspace is a block of memory from which the _ws
+ * variants of the linalg routines take their temporary vectors and
+ * matrices, instead of allocating them on each call. The space a
+ * routine needs is given by the matching _wsize function, so that an
+ * arena large enough for all the routines of a computation can be
+ * allocated once, in advance.
+ */
+
+/*
+gsl_linalg_workspace_alloc()
+  Allocate an arena of n doubles
+
+Inputs: n - size of arena in doubles; may be 0 for routines
+            whose _wsize is 0
+
+Return: pointer to arena
+*/
+
+gsl_linalg_workspace *
+gsl_linalg_workspace_alloc (const size_t n)
+{
+  gsl_linalg_workspace *w;
+
+  w = calloc (1, sizeof (gsl_linalg_workspace));
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  if (linalg_workspace_init (w, n))
+    {
+      free (w);
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_linalg_workspace_free (gsl_linalg_workspace * w)
+{
+  RETURN_IF_NULL (w);
+  linalg_workspace_clear (w);
+  free (w);
+}
+
+size_t
+linalg_workspace_avail (const gsl_linalg_workspace * w)
+{
+  if (w == NULL)
+    return 0;
+
+  return w->size - w->used;
+}
+
+double *
+linalg_workspace_get (gsl_linalg_workspace * w, const size_t n)
+{
+  double *p;
+
+  if (n == 0 || linalg_workspace_avail (w) < n)
+    return NULL;
+
+  p = w->data + w->used;
+  w->used += n;
+
+  return p;
+}
+
+void
+linalg_workspace_release (gsl_linalg_workspace * w, double * p)
+{
+  if (p != NULL)
+    w->used = (size_t) (p - w->data);
+}
+
+int
+linalg_workspace_init (gsl_linalg_workspace * w, const size_t n)
+{
+  w->size = n;
+  w->used = 0;
+  w->data = NULL;
+
+  if (n > 0)
+    {
+      w->data = malloc (n * sizeof (double));
+      if (w->data == NULL)
+        return GSL_ENOMEM;
+    }
+
+  return GSL_SUCCESS;
+}
+
+void
+linalg_workspace_clear (gsl_linalg_workspace * w)
+{
+  free (w->data);
+  w->data = NULL;
+  w->size = 0;
+  w->used = 0;
+}
@@ -0,0 +1,49 @@
+/* linalg/workspace.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_LINALG_WORKSPACE_H__
+#define __GSL_LINALG_WORKSPACE_H__
+
+/*
+ * Internal interface of the workspace arena (workspace.c)
+ *
+ * Memory is taken from the arena in last in, first out order: a
+ * routine gets the space it needs on entry with
+ * linalg_workspace_get() and gives it back with
+ * linalg_workspace_release() before returning, so that the
+ * routines it calls can use the space above it.
+ */
+
+/* number of doubles available in w; a NULL arena is empty */
+size_t linalg_workspace_avail (const gsl_linalg_workspace * w);
+
+/* take n doubles from w, returning NULL if n == 0 or if fewer than n
+   are available */
+double * linalg_workspace_get (gsl_linalg_workspace * w, const size_t n);
+
+/* give back the space taken by the call which returned p, and all
+   space taken after it */
+void linalg_workspace_release (gsl_linalg_workspace * w, double * p);
+
+/* initialize an arena of n doubles in a structure owned by the caller,
+   for the routines which allocate their own workspace */
+int linalg_workspace_init (gsl_linalg_workspace * w, const size_t n);
+void linalg_workspace_clear (gsl_linalg_workspace * w);
+
+#endif /* __GSL_LINALG_WORKSPACE_H__ */
@@ -195,8 +195,7 @@ dogleg_preloop(const void * vtrust_state, void * vstate)
   alpha = u * u;
 
   /* dx_sd = -alpha D^{-2} g */
-  gsl_vector_memcpy(state->dx_sd, state->workp);
-  gsl_vector_scale(state->dx_sd, -alpha);
+  gsl_blas_daxpby(-alpha, state->workp, 0.0, state->dx_sd);
 
   state->norm_Dsd = scaled_enorm(trust_state->diag, state->dx_sd);
   state->norm_Dgn = -1.0; /* computed later if needed */
@@ -221,8 +220,7 @@ dogleg_step(const void * vtrust_state, const double delta,
     {
       /* steepest descent step is outside trust region;
        * truncate steepest descent step to trust region boundary */
-      gsl_vector_memcpy(dx, state->dx_sd);
-      gsl_vector_scale(dx, delta / state->norm_Dsd);
+      gsl_blas_daxpby(delta / state->norm_Dsd, state->dx_sd, 0.0, dx);
     }
   else
     {
@@ -281,8 +279,7 @@ dogleg_double_step(const void * vtrust_state, const double delta,
     {
       /* steepest descent step is outside trust region;
        * truncate steepest descent step to trust region boundary */
-      gsl_vector_memcpy(dx, state->dx_sd);
-      gsl_vector_scale(dx, delta / state->norm_Dsd);
+      gsl_blas_daxpby(delta / state->norm_Dsd, state->dx_sd, 0.0, dx);
     }
   else
     {
@@ -324,8 +321,7 @@ dogleg_double_step(const void * vtrust_state, const double delta,
           if (t * state->norm_Dgn <= delta)
             {
               /* set dx = (delta / ||D dx_gn||) dx_gn */
-              gsl_vector_memcpy(dx, state->dx_gn);
-              gsl_vector_scale(dx, delta / state->norm_Dgn);
+              gsl_blas_daxpby(delta / state->norm_Dgn, state->dx_gn, 0.0, dx);
             }
           else
             {
@@ -691,8 +691,7 @@ subspace2D_calc_sd(const gsl_multifit_nlinear_trust_state * trust_state, gsl_vec
   alpha = u * u;
 
   /* dx_sd = -alpha D^{-2} g */
-  gsl_vector_memcpy(dx, state->workp);
-  gsl_vector_scale(dx, -alpha);
+  gsl_blas_daxpby(-alpha, state->workp, 0.0, dx);
 
   return GSL_SUCCESS;
 }
@@ -231,8 +231,9 @@ cgst_step(const void * vtrust_state, const double delta,
       gsl_vector_set(state->workp, i, gi / di);
     }
 
-  /* compute || g~ || */
+  /* compute || g~ || = || r_0 || */
   state->norm_g = gsl_blas_dnrm2(state->workp);
+  norm_r = state->norm_g;
 
   for (i = 0; i < state->cgmaxit; ++i)
     {
@@ -264,7 +265,6 @@ cgst_step(const void * vtrust_state, const double delta,
 
       /* Step 3 of [1], section 2 */
 
-      norm_r = gsl_blas_dnrm2(state->r);
       u = norm_r / norm_Jd;
       alpha = u * u;
 
@@ -297,11 +297,9 @@ cgst_step(const void * vtrust_state, const double delta,
         return status;
 
       gsl_vector_div(state->workp, trust_state->diag);
-      gsl_vector_scale(state->workp, alpha);
 
-      /* r_{i+1} = r_i - alpha*B*d_i */
-      gsl_vector_sub(state->r, state->workp);
-      norm_rp1 = gsl_blas_dnrm2(state->r);
+      /* r_{i+1} = r_i - alpha*B*d_i and its norm, in one pass */
+      gsl_blas_daxpy_nrm2(-alpha, state->workp, state->r, &norm_rp1);
 
       u = norm_rp1 / state->norm_g;
       if (u < state->cgtol)
@@ -318,7 +316,9 @@ cgst_step(const void * vtrust_state, const double delta,
       beta = u * u;
 
       /* compute: d_{i+1} = rt_{i+1} + beta*d_i */
-      scaled_addition(1.0, state->r, beta, state->d, state->d);
+      gsl_blas_daxpby(1.0, state->r, beta, state->d);
+
+      norm_r = norm_rp1;
     }
 
   /* failed to converge, return current estimate */
@@ -352,16 +352,16 @@ static double
 cgst_calc_tau(const gsl_vector * p, const gsl_vector * d,
               const double delta)
 {
-  double norm_p, norm_d, u;
+  double norm_p, norm_d, dd, u;
   double t1, t2, tau;
 
   norm_p = gsl_blas_dnrm2(p);
-  norm_d = gsl_blas_dnrm2(d);
 
-  /* compute (p, d) */
-  gsl_blas_ddot(p, d, &u);
+  /* compute (d, d) and (d, p) in one pass */
+  gsl_blas_ddot2(d, d, p, &dd, &u);
+  norm_d = sqrt(dd);
 
-  t1 = u / (norm_d * norm_d);
+  t1 = u / dd;
   t2 = t1*u + (delta + norm_p) * (delta - norm_p);
   tau = -t1 + sqrt(t2) / norm_d;
 
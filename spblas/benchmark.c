@@ -0,0 +1,311 @@
+/* spblas/benchmark.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Timing of the sparse matrix-vector product. Build with
+ * "make benchmark" and run
+ *
+ *   ./benchmark [scale [nthreads]]
+ *
+ * The test matrices are generated with the structure of typical
+ * members of the SuiteSparse collection:
+ *
+ *   lap2d  - 5-point Laplacian on a square grid (2D PDE)
+ *   lap3d  - 27-point stencil on a cubic grid (3D FEM)
+ *   band   - random band matrix with 2*40+1 diagonals, half full
+ *   graph  - power-law row lengths, as in web and social graphs,
+ *            with a few very long rows
+ *   fem    - 5-point grid with 3 unknowns per node coupled by dense
+ *            3-by-3 blocks (2D elasticity)
+ *
+ * For each matrix and format the product y := A x is timed with
+ * gsl_spblas_dgemv, and with gsl_spblas_dgemv_par on pools of 1, 2,
+ * 4, ... nthreads threads (default 4). The CSR line also times
+ * gsl_spblas_dgemv_sell with slices of 4 and 8 rows (sigma = 32 C) and
+ * gsl_spblas_dgemv_bsr with blocks of 2, 3 and 4, to pick the fastest
+ * layout of each matrix. The rate is reported in GB/s
+ * of the memory traffic of the product: the values and indices of
+ * the CSR matrix, its pointer array, x and y, also for the other
+ * formats so that the rates compare times. The scale (default 1)
+ * multiplies the number of rows of every matrix, of about 10^6. */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+
+static double
+seconds (void)
+{
+#ifdef HAVE_CLOCK_GETTIME
+  struct timespec t;
+  clock_gettime (CLOCK_MONOTONIC, &t);
+  return t.tv_sec + 1.0e-9 * t.tv_nsec;
+#else
+  return (double) clock () / CLOCKS_PER_SEC;
+#endif
+}
+
+static unsigned long seed = 1;
+
+static double
+uniform (void)
+{
+  seed = (seed * 1103515245UL + 12345UL) & 0x7fffffffUL;
+  return (double) seed / 2147483648.0;
+}
+
+static gsl_spmatrix *
+make_lap2d (const size_t n)
+{
+  gsl_spmatrix *T = gsl_spmatrix_alloc_nzmax (n * n, n * n, 5 * n * n, GSL_SPMATRIX_COO);
+  size_t i, j;
+
+  for (i = 0; i < n; ++i)
+    {
+      for (j = 0; j < n; ++j)
+        {
+          size_t r = i * n + j;
+
+          gsl_spmatrix_set (T, r, r, 4.0);
+          if (i > 0)
+            gsl_spmatrix_set (T, r, r - n, -1.0);
+          if (i < n - 1)
+            gsl_spmatrix_set (T, r, r + n, -1.0);
+          if (j > 0)
+            gsl_spmatrix_set (T, r, r - 1, -1.0);
+          if (j < n - 1)
+            gsl_spmatrix_set (T, r, r + 1, -1.0);
+        }
+    }
+
+  return T;
+}
+
+static gsl_spmatrix *
+make_lap3d (const size_t n)
+{
+  gsl_spmatrix *T = gsl_spmatrix_alloc_nzmax (n * n * n, n * n * n, 27 * n * n * n, GSL_SPMATRIX_COO);
+  int i, j, k, di, dj, dk;
+  const int m = (int) n;
+
+  for (i = 0; i < m; ++i)
+    for (j = 0; j < m; ++j)
+      for (k = 0; k < m; ++k)
+        for (di = -1; di <= 1; ++di)
+          for (dj = -1; dj <= 1; ++dj)
+            for (dk = -1; dk <= 1; ++dk)
+              {
+                int ii = i + di, jj = j + dj, kk = k + dk;
+
+                if (ii < 0 || jj < 0 || kk < 0 || ii >= m || jj >= m || kk >= m)
+                  continue;
+
+                gsl_spmatrix_set (T, (i * m + j) * m + k, (ii * m + jj) * m + kk,
+                                  (di == 0 && dj == 0 && dk == 0) ? 26.0 : -1.0);
+              }
+
+  return T;
+}
+
+static gsl_spmatrix *
+make_band (const size_t n, const size_t bw)
+{
+  gsl_spmatrix *T = gsl_spmatrix_alloc_nzmax (n, n, (bw + 1) * n, GSL_SPMATRIX_COO);
+  size_t i, j;
+
+  for (i = 0; i < n; ++i)
+    {
+      size_t j0 = (i > bw) ? i - bw : 0;
+      size_t j1 = GSL_MIN (i + bw + 1, n);
+
+      for (j = j0; j < j1; ++j)
+        {
+          if (j == i || uniform () < 0.5)
+            gsl_spmatrix_set (T, i, j, uniform () - 0.5);
+        }
+    }
+
+  return T;
+}
+
+/* lap2d on an n-by-n grid with each element replaced by a dense
+   3-by-3 block */
+static gsl_spmatrix *
+make_fem (const size_t n)
+{
+  gsl_spmatrix *L = make_lap2d (n);
+  gsl_spmatrix *T = gsl_spmatrix_alloc_nzmax (3 * n * n, 3 * n * n, 9 * L->nz, GSL_SPMATRIX_COO);
+  size_t k, a, b;
+
+  for (k = 0; k < L->nz; ++k)
+    for (a = 0; a < 3; ++a)
+      for (b = 0; b < 3; ++b)
+        gsl_spmatrix_set (T, 3 * L->i[k] + a, 3 * L->p[k] + b,
+                          L->data[k] * ((a == b) ? 1.0 : 0.25));
+
+  gsl_spmatrix_free (L);
+
+  return T;
+}
+
+/* row i has about 4 / u elements for u uniform in (0,1], capped at
+   n / 10, at random columns */
+static gsl_spmatrix *
+make_graph (const size_t n)
+{
+  gsl_spmatrix *T = gsl_spmatrix_alloc_nzmax (n, n, 16 * n, GSL_SPMATRIX_COO);
+  size_t i, k;
+
+  for (i = 0; i < n; ++i)
+    {
+      double len = 4.0 / (uniform () + 1.0e-6);
+      size_t nr = (size_t) GSL_MIN (len, n / 10.0);
+
+      gsl_spmatrix_set (T, i, i, 1.0);
+
+      for (k = 0; k < nr; ++k)
+        gsl_spmatrix_set (T, i, (size_t) (uniform () * n), 1.0);
+    }
+
+  return T;
+}
+
+/* repeat each product for about 0.2 seconds and return the time of one */
+#define TIME(stmt, t)                                   \
+  do {                                                  \
+    size_t nrep_ = 0;                                   \
+    double t0_ = seconds (), t1_;                       \
+    do { stmt; ++nrep_; t1_ = seconds (); }             \
+    while (t1_ - t0_ < 0.2);                            \
+    (t) = (t1_ - t0_) / nrep_;                          \
+  } while (0)
+
+static void
+run (const char *name, gsl_spmatrix *T, const size_t nthreads_max)
+{
+  const size_t M = T->size1, N = T->size2;
+  const size_t nnz = gsl_spmatrix_nnz (T);
+  const double bytes = nnz * (sizeof (double) + sizeof (int))
+                       + (N + 1) * sizeof (int) + N * sizeof (double)
+                       + M * sizeof (double);
+  gsl_vector *x = gsl_vector_alloc (N);
+  gsl_vector *y = gsl_vector_alloc (M);
+  int fmt;
+  size_t i;
+
+  for (i = 0; i < N; ++i)
+    gsl_vector_set (x, i, uniform ());
+
+  for (fmt = 0; fmt < 2; ++fmt)
+    {
+      gsl_spmatrix *A = gsl_spmatrix_compress (T, (fmt == 0) ? GSL_SPMATRIX_CSR : GSL_SPMATRIX_CSC);
+      double t;
+      size_t nthreads;
+
+      printf ("%-6s %s %9zu %10zu", name, (fmt == 0) ? "CSR" : "CSC", M, nnz);
+
+      TIME (gsl_spblas_dgemv (CblasNoTrans, 1.0, A, x, 0.0, y), t);
+      printf (" %7.2f", bytes / t * 1.0e-9);
+
+      for (nthreads = 1; nthreads <= nthreads_max; nthreads *= 2)
+        {
+          gsl_thread_pool *pool = gsl_thread_pool_alloc (nthreads);
+          gsl_spblas_dgemv_workspace *w = gsl_spblas_dgemv_alloc (CblasNoTrans, A, pool);
+
+          TIME (gsl_spblas_dgemv_par (1.0, A, x, 0.0, y, w), t);
+          printf (" %7.2f", bytes / t * 1.0e-9);
+
+          gsl_spblas_dgemv_free (w);
+          gsl_thread_pool_free (pool);
+        }
+
+      if (fmt == 0)
+        {
+          const size_t C[] = { 4, 8 };
+          const size_t b[] = { 2, 3, 4 };
+
+          for (i = 0; i < 2; ++i)
+            {
+              gsl_spmatrix_sell *S = gsl_spmatrix_sell_compress (A, C[i], 32 * C[i]);
+
+              TIME (gsl_spblas_dgemv_sell (CblasNoTrans, 1.0, S, x, 0.0, y), t);
+              printf (" %7.2f", bytes / t * 1.0e-9);
+
+              gsl_spmatrix_sell_free (S);
+            }
+
+          for (i = 0; i < 3; ++i)
+            {
+              gsl_spmatrix_bsr *B = gsl_spmatrix_bsr_compress (A, b[i]);
+
+              TIME (gsl_spblas_dgemv_bsr (CblasNoTrans, 1.0, B, x, 0.0, y), t);
+              printf (" %7.2f", bytes / t * 1.0e-9);
+
+              gsl_spmatrix_bsr_free (B);
+            }
+        }
+
+      printf ("\n");
+      gsl_spmatrix_free (A);
+    }
+
+  gsl_vector_free (x);
+  gsl_vector_free (y);
+}
+
+int
+main (int argc, char *argv[])
+{
+  const double scale = (argc > 1) ? atof (argv[1]) : 1.0;
+  const size_t nthreads_max = (argc > 2) ? (size_t) atoi (argv[2]) : 4;
+  size_t nthreads;
+  gsl_spmatrix *T;
+
+  printf ("y := A x, GB/s of matrix and vector traffic\n");
+  printf ("%-6s %s %9s %10s %7s", "matrix", "fmt", "rows", "nnz", "dgemv");
+  for (nthreads = 1; nthreads <= nthreads_max; nthreads *= 2)
+    printf ("   par%-2zu", nthreads);
+  printf (" %7s %7s %7s %7s %7s\n", "sell4", "sell8", "bsr2", "bsr3", "bsr4");
+
+  T = make_lap2d ((size_t) (1000 * sqrt (scale)));
+  run ("lap2d", T, nthreads_max);
+  gsl_spmatrix_free (T);
+
+  T = make_lap3d ((size_t) (100 * cbrt (scale)));
+  run ("lap3d", T, nthreads_max);
+  gsl_spmatrix_free (T);
+
+  T = make_band ((size_t) (1000000 * scale), 40);
+  run ("band", T, nthreads_max);
+  gsl_spmatrix_free (T);
+
+  T = make_graph ((size_t) (1000000 * scale));
+  run ("graph", T, nthreads_max);
+  gsl_spmatrix_free (T);
+
+  T = make_fem ((size_t) (600 * sqrt (scale)));
+  run ("fem", T, nthreads_max);
+  gsl_spmatrix_free (T);
+
+  return 0;
+}
@@ -27,6 +27,7 @@
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_spmatrix.h>
 #include <gsl/gsl_blas.h>
+#include <gsl/gsl_thread_pool.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -40,6 +41,21 @@
 
 __BEGIN_DECLS
 
+/* workspace of the parallel sparse matrix-vector product */
+
+typedef struct
+{
+  CBLAS_TRANSPOSE_t TransA;   /* op(A) */
+  size_t size1;               /* rows of A */
+  size_t size2;               /* columns of A */
+  int sptype;                 /* storage format of A */
+  size_t nnz;                 /* non-zero elements of A at the last update */
+  gsl_spmatrix * At;          /* compressed rows of op(A), if A is not stored by rows of op(A) */
+  size_t nblocks;             /* number of row blocks of op(A) */
+  size_t * block;             /* first row of each block, size nblocks + 1 */
+  gsl_thread_pool * pool;     /* thread pool, or NULL */
+} gsl_spblas_dgemv_workspace;
+
 /*
  * Prototypes
  */
@@ -47,6 +63,20 @@ __BEGIN_DECLS
 int gsl_spblas_dgemv(const CBLAS_TRANSPOSE_t TransA, const double alpha,
                      const gsl_spmatrix *A, const gsl_vector *x,
                      const double beta, gsl_vector *y);
+gsl_spblas_dgemv_workspace *gsl_spblas_dgemv_alloc(const CBLAS_TRANSPOSE_t TransA,
+                                                   const gsl_spmatrix *A,
+                                                   gsl_thread_pool *pool);
+void gsl_spblas_dgemv_free(gsl_spblas_dgemv_workspace *w);
+int gsl_spblas_dgemv_update(const gsl_spmatrix *A, gsl_spblas_dgemv_workspace *w);
+int gsl_spblas_dgemv_sell(const CBLAS_TRANSPOSE_t TransA, const double alpha,
+                          const gsl_spmatrix_sell *A, const gsl_vector *x,
+                          const double beta, gsl_vector *y);
+int gsl_spblas_dgemv_bsr(const CBLAS_TRANSPOSE_t TransA, const double alpha,
+                         const gsl_spmatrix_bsr *A, const gsl_vector *x,
+                         const double beta, gsl_vector *y);
+int gsl_spblas_dgemv_par(const double alpha, const gsl_spmatrix *A,
+                         const gsl_vector *x, const double beta, gsl_vector *y,
+                         gsl_spblas_dgemv_workspace *w);
 int gsl_spblas_dgemm(const double alpha, const gsl_spmatrix *A,
                      const gsl_spmatrix *B, gsl_spmatrix *C);
 size_t gsl_spblas_scatter(const gsl_spmatrix *A, const size_t j,
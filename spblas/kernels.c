@@ -0,0 +1,459 @@
+/* spblas/kernels.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Kernels of the sparse matrix-vector product for matrices stored by
+ * rows, in the CSR, SELL-C-sigma and BSR formats.
+ *
+ * The inner loop of the product is the sparse dot product of a row of
+ * the matrix with the vector x, sum_k Ad[k] x[Aj[k]], which is limited
+ * by the memory traffic of Ad and Aj. On x86 processors with AVX2 the
+ * elements of x are loaded with gather instructions, four at a time,
+ * and the products accumulated in two vector registers; the version is
+ * selected at run time as for the Level-1 CBLAS kernels, and the
+ * environment variable GSL_CBLAS_SIMD set to "none" or "sse2" disables
+ * it. Otherwise, and for non-unit stride x, the products are summed in
+ * order as in the reference loop.
+ *
+ * A slice of a SELL-C-sigma matrix holds C rows side by side, so that
+ * with C a multiple of 4 the vector kernel computes four rows at once
+ * from contiguous loads of the values and column indices, with the
+ * lanes past the end of a shorter row masked off. The BSR kernel keeps
+ * a block row of up to 8 rows of y in two registers and adds each
+ * column of a block times a broadcast element of x, with no gather.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gsl/gsl_math.h>
+
+#include <gsl/gsl_spmatrix.h>
+
+#include "kernels.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    ((defined(__GNUC__) && __GNUC__ >= 7) || defined(__clang__))
+#define SPBLAS_HAVE_X86_DISPATCH 1
+#endif
+
+/* sparse dot product of a row of length n with a unit stride x */
+typedef double (*spblas_ddoti) (const int n, const double *a, const int *ja,
+                                const double *x);
+
+/* rows shorter than this use the reference loop */
+#define SPBLAS_DDOTI_MIN 8
+
+/* rows of y held in registers by the BSR kernels */
+#define SPBLAS_BSR_ROWS 8
+
+static inline void
+spblas_yupdate (double * y, const double alpha, const double sum, const double beta)
+{
+  if (beta == 0.0)
+    *y = alpha * sum;
+  else if (beta == 1.0)
+    *y += alpha * sum;
+  else
+    *y = beta * (*y) + alpha * sum;
+}
+
+/* rows of slice s of a SELL-C-sigma matrix, over the real elements only */
+static void
+sell_slice_ref (const gsl_spmatrix_sell * A, const size_t s, const double alpha,
+                const double * X, const size_t incX, const double beta,
+                double * Y, const size_t incY)
+{
+  const size_t C = A->C;
+  const size_t r0 = s * C;
+  const size_t r1 = GSL_MIN (r0 + C, A->size1);
+  const int *col = A->col + A->slice[s];
+  const double *data = A->data + A->slice[s];
+  size_t r;
+
+  for (r = r0; r < r1; ++r)
+    {
+      const size_t q = r - r0;
+      const int n = A->len[r];
+      double sum = 0.0;
+      int k;
+
+      for (k = 0; k < n; ++k)
+        sum += data[k * C + q] * X[col[k * C + q] * incX];
+
+      spblas_yupdate (Y + A->perm[r] * incY, alpha, sum, beta);
+    }
+}
+
+/* block row I of a BSR matrix, SPBLAS_BSR_ROWS rows of y at a time */
+static void
+bsr_row_ref (const gsl_spmatrix_bsr * A, const size_t I, const double alpha,
+             const double * X, const size_t incX, const double beta,
+             double * Y, const size_t incY)
+{
+  const size_t b = A->b;
+  const size_t bb = b * b;
+  const size_t nr = GSL_MIN (b, A->size1 - I * b);
+  double *yI = Y + I * b * incY;
+  size_t i0;
+
+  for (i0 = 0; i0 < nr; i0 += SPBLAS_BSR_ROWS)
+    {
+      const size_t m = GSL_MIN (SPBLAS_BSR_ROWS, nr - i0);
+      double sum[SPBLAS_BSR_ROWS] = { 0.0 };
+      size_t i;
+      int k;
+
+      for (k = A->p[I]; k < A->p[I + 1]; ++k)
+        {
+          const size_t J = (size_t) A->j[k];
+          const size_t nc = GSL_MIN (b, A->size2 - J * b);
+          const double *xJ = X + J * b * incX;
+          const double *blk = A->data + (size_t) k * bb + i0;
+          size_t c;
+
+          for (c = 0; c < nc; ++c)
+            {
+              const double xc = xJ[c * incX];
+              const double *a = blk + c * b;
+
+              for (i = 0; i < m; ++i)
+                sum[i] += a[i] * xc;
+            }
+        }
+
+      for (i = 0; i < m; ++i)
+        spblas_yupdate (yI + (i0 + i) * incY, alpha, sum[i], beta);
+    }
+}
+
+static double
+ddoti_ref (const int n, const double *a, const int *ja, const double *x)
+{
+  double r = 0.0;
+  int k;
+
+  for (k = 0; k < n; ++k)
+    r += a[k] * x[ja[k]];
+
+  return r;
+}
+
+#ifdef SPBLAS_HAVE_X86_DISPATCH
+
+#include <immintrin.h>
+
+__attribute__ ((target ("avx2,fma"))) static double
+ddoti_avx2 (const int n, const double *a, const int *ja, const double *x)
+{
+  __m256d s0 = _mm256_setzero_pd (), s1 = _mm256_setzero_pd ();
+  double r[4];
+  int k;
+
+  for (k = 0; k + 8 <= n; k += 8)
+    {
+      __m128i j0 = _mm_loadu_si128 ((const __m128i *) (ja + k));
+      __m128i j1 = _mm_loadu_si128 ((const __m128i *) (ja + k + 4));
+
+      s0 = _mm256_fmadd_pd (_mm256_loadu_pd (a + k), _mm256_i32gather_pd (x, j0, 8), s0);
+      s1 = _mm256_fmadd_pd (_mm256_loadu_pd (a + k + 4), _mm256_i32gather_pd (x, j1, 8), s1);
+    }
+
+  if (k + 4 <= n)
+    {
+      __m128i j0 = _mm_loadu_si128 ((const __m128i *) (ja + k));
+
+      s0 = _mm256_fmadd_pd (_mm256_loadu_pd (a + k), _mm256_i32gather_pd (x, j0, 8), s0);
+      k += 4;
+    }
+
+  _mm256_storeu_pd (r, _mm256_add_pd (s0, s1));
+  r[0] = (r[0] + r[1]) + (r[2] + r[3]);
+
+  for (; k < n; ++k)
+    r[0] += a[k] * x[ja[k]];
+
+  return r[0];
+}
+
+/* mask of the lanes of row q < len[q] at element k of a slice */
+#define SELL_MASK(l,kk) _mm256_castsi256_pd (_mm256_cvtepi32_epi64 (_mm_cmpgt_epi32 ((l), (kk))))
+
+/* full slice s of a SELL-C-sigma matrix with C a multiple of 4 and a
+   unit stride x */
+__attribute__ ((target ("avx2,fma"))) static void
+sell_slice_avx2 (const gsl_spmatrix_sell * A, const size_t s, const double alpha,
+                 const double * X, const double beta,
+                 double * Y, const size_t incY)
+{
+  const size_t C = A->C;
+  const size_t r0 = s * C;
+  const size_t width = (A->slice[s + 1] - A->slice[s]) / C;
+  const int *col = A->col + A->slice[s];
+  const double *data = A->data + A->slice[s];
+  const int *len = A->len + r0;
+  const int *perm = A->perm + r0;
+  const __m256d zero = _mm256_setzero_pd ();
+  double sum[8];
+  size_t q, k;
+
+  if (C == 8)
+    {
+      /* both halves of the slice in one pass over its elements */
+      const __m128i l0 = _mm_loadu_si128 ((const __m128i *) len);
+      const __m128i l1 = _mm_loadu_si128 ((const __m128i *) (len + 4));
+      __m256d s0 = zero, s1 = zero;
+
+      for (k = 0; k < width; ++k)
+        {
+          const __m128i kk = _mm_set1_epi32 ((int) k);
+          const __m128i j0 = _mm_loadu_si128 ((const __m128i *) (col + 8 * k));
+          const __m128i j1 = _mm_loadu_si128 ((const __m128i *) (col + 8 * k + 4));
+
+          s0 = _mm256_fmadd_pd (_mm256_loadu_pd (data + 8 * k),
+                                _mm256_mask_i32gather_pd (zero, X, j0, SELL_MASK (l0, kk), 8), s0);
+          s1 = _mm256_fmadd_pd (_mm256_loadu_pd (data + 8 * k + 4),
+                                _mm256_mask_i32gather_pd (zero, X, j1, SELL_MASK (l1, kk), 8), s1);
+        }
+
+      _mm256_storeu_pd (sum, s0);
+      _mm256_storeu_pd (sum + 4, s1);
+
+      for (q = 0; q < 8; ++q)
+        spblas_yupdate (Y + perm[q] * incY, alpha, sum[q], beta);
+
+      return;
+    }
+
+  for (q = 0; q < C; q += 4)
+    {
+      const __m128i l0 = _mm_loadu_si128 ((const __m128i *) (len + q));
+      __m256d s0 = zero;
+      size_t i;
+
+      for (k = 0; k < width; ++k)
+        {
+          const __m128i kk = _mm_set1_epi32 ((int) k);
+          const __m128i j0 = _mm_loadu_si128 ((const __m128i *) (col + k * C + q));
+
+          s0 = _mm256_fmadd_pd (_mm256_loadu_pd (data + k * C + q),
+                                _mm256_mask_i32gather_pd (zero, X, j0, SELL_MASK (l0, kk), 8), s0);
+        }
+
+      _mm256_storeu_pd (sum, s0);
+
+      for (i = 0; i < 4; ++i)
+        spblas_yupdate (Y + perm[q + i] * incY, alpha, sum[i], beta);
+    }
+}
+
+#undef SELL_MASK
+
+/* block row I of a BSR matrix with 2 <= b <= 8 and a unit stride x; the
+   masked loads read only the b rows of each column of a block */
+__attribute__ ((target ("avx2,fma"))) static void
+bsr_row_avx2 (const gsl_spmatrix_bsr * A, const size_t I, const double alpha,
+              const double * X, const double beta,
+              double * Y, const size_t incY)
+{
+  const size_t b = A->b;
+  const size_t bb = b * b;
+  const size_t nr = GSL_MIN (b, A->size1 - I * b);
+  const __m256i lane = _mm256_set_epi64x (3, 2, 1, 0);
+  const __m256i m0 = _mm256_cmpgt_epi64 (_mm256_set1_epi64x ((long long) b), lane);
+  const __m256i m1 = _mm256_cmpgt_epi64 (_mm256_set1_epi64x ((long long) b - 4), lane);
+  __m256d s0 = _mm256_setzero_pd (), s1 = _mm256_setzero_pd ();
+  double sum[SPBLAS_BSR_ROWS];
+  size_t i;
+  int k;
+
+  for (k = A->p[I]; k < A->p[I + 1]; ++k)
+    {
+      const size_t J = (size_t) A->j[k];
+      const size_t nc = GSL_MIN (b, A->size2 - J * b);
+      const double *xJ = X + J * b;
+      const double *blk = A->data + (size_t) k * bb;
+      size_t c;
+
+      if (b <= 4)
+        {
+          for (c = 0; c < nc; ++c)
+            s0 = _mm256_fmadd_pd (_mm256_maskload_pd (blk + c * b, m0),
+                                  _mm256_broadcast_sd (xJ + c), s0);
+        }
+      else
+        {
+          for (c = 0; c < nc; ++c)
+            {
+              const __m256d xc = _mm256_broadcast_sd (xJ + c);
+
+              s0 = _mm256_fmadd_pd (_mm256_maskload_pd (blk + c * b, m0), xc, s0);
+              s1 = _mm256_fmadd_pd (_mm256_maskload_pd (blk + c * b + 4, m1), xc, s1);
+            }
+        }
+    }
+
+  _mm256_storeu_pd (sum, s0);
+  _mm256_storeu_pd (sum + 4, s1);
+
+  for (i = 0; i < nr; ++i)
+    spblas_yupdate (Y + (I * b + i) * incY, alpha, sum[i], beta);
+}
+
+#endif /* SPBLAS_HAVE_X86_DISPATCH */
+
+static spblas_ddoti ddoti_selected = NULL;
+static const char *ddoti_name = NULL;
+static int kernels_avx2 = 0;
+
+static void
+kernels_select (void)
+{
+  spblas_ddoti f = ddoti_ref;
+  const char *name = "none";
+
+#ifdef SPBLAS_HAVE_X86_DISPATCH
+  {
+    const char *env = getenv ("GSL_CBLAS_SIMD");
+
+    __builtin_cpu_init ();
+
+    if ((env == NULL || (strcmp (env, "none") != 0 && strcmp (env, "sse2") != 0)) &&
+        __builtin_cpu_supports ("avx2") && __builtin_cpu_supports ("fma"))
+      {
+        f = ddoti_avx2;
+        name = "avx2";
+      }
+  }
+#endif
+
+  /* concurrent first calls store the same values */
+  kernels_avx2 = (f != ddoti_ref);
+  ddoti_name = name;
+  ddoti_selected = f;
+}
+
+const char *
+gsl_spblas_kernels_name (void)
+{
+  if (ddoti_selected == NULL)
+    kernels_select ();
+
+  return ddoti_name;
+}
+
+void
+gsl_spblas_dgemv_rows (const size_t r0, const size_t r1, const double alpha,
+                       const int * Ap, const int * Aj, const double * Ad,
+                       const double * X, const size_t incX, const double beta,
+                       double * Y, const size_t incY)
+{
+  spblas_ddoti ddoti;
+  size_t r;
+
+  if (ddoti_selected == NULL)
+    kernels_select ();
+
+  ddoti = ddoti_selected;
+
+  for (r = r0; r < r1; ++r)
+    {
+      const int n = Ap[r + 1] - Ap[r];
+      const double *a = Ad + Ap[r];
+      const int *ja = Aj + Ap[r];
+      double *yr = Y + r * incY;
+      double sum;
+
+      if (incX == 1)
+        {
+          sum = (n >= SPBLAS_DDOTI_MIN) ? ddoti (n, a, ja, X) : ddoti_ref (n, a, ja, X);
+        }
+      else
+        {
+          int k;
+
+          sum = 0.0;
+          for (k = 0; k < n; ++k)
+            sum += a[k] * X[ja[k] * incX];
+        }
+
+      spblas_yupdate (yr, alpha, sum, beta);
+    }
+}
+
+void
+gsl_spblas_dgemv_sell_slices (const size_t s0, const size_t s1, const double alpha,
+                              const gsl_spmatrix_sell * A,
+                              const double * X, const size_t incX, const double beta,
+                              double * Y, const size_t incY)
+{
+  size_t s;
+
+  if (ddoti_selected == NULL)
+    kernels_select ();
+
+  for (s = s0; s < s1; ++s)
+    {
+#ifdef SPBLAS_HAVE_X86_DISPATCH
+      if (kernels_avx2 && incX == 1 && A->C % 4 == 0 &&
+          (s + 1) * A->C <= A->size1)
+        {
+          sell_slice_avx2 (A, s, alpha, X, beta, Y, incY);
+          continue;
+        }
+#endif
+
+      sell_slice_ref (A, s, alpha, X, incX, beta, Y, incY);
+    }
+}
+
+void
+gsl_spblas_dgemv_bsr_rows (const size_t I0, const size_t I1, const double alpha,
+                           const gsl_spmatrix_bsr * A,
+                           const double * X, const size_t incX, const double beta,
+                           double * Y, const size_t incY)
+{
+  size_t I;
+
+  if (ddoti_selected == NULL)
+    kernels_select ();
+
+  for (I = I0; I < I1; ++I)
+    {
+#ifdef SPBLAS_HAVE_X86_DISPATCH
+      if (kernels_avx2 && incX == 1 && A->b >= 2 && A->b <= SPBLAS_BSR_ROWS)
+        {
+          bsr_row_avx2 (A, I, alpha, X, beta, Y, incY);
+          continue;
+        }
+#endif
+
+      bsr_row_ref (A, I, alpha, X, incX, beta, Y, incY);
+    }
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+static void kernels_init (void) __attribute__ ((constructor));
+
+static void
+kernels_init (void)
+{
+  gsl_spblas_kernels_name ();
+}
+#endif
@@ -0,0 +1,52 @@
+/* spblas/kernels.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_SPBLAS_KERNELS_H__
+#define __GSL_SPBLAS_KERNELS_H__
+
+#include <gsl/gsl_spmatrix.h>
+
+/* Internal interface of the sparse matrix-vector kernels (kernels.c) */
+
+/* y_r := alpha * sum_{k = Ap[r]}^{Ap[r+1]-1} Ad[k] x_{Aj[k]} + beta * y_r
+   for the rows r0 <= r < r1 of a matrix stored by rows; y is not read
+   when beta = 0 */
+void gsl_spblas_dgemv_rows (const size_t r0, const size_t r1, const double alpha,
+                            const int * Ap, const int * Aj, const double * Ad,
+                            const double * X, const size_t incX, const double beta,
+                            double * Y, const size_t incY);
+
+/* y := alpha * A x + beta * y for the rows of the slices s0 <= s < s1
+   of a matrix in SELL-C-sigma format; y is not read when beta = 0 */
+void gsl_spblas_dgemv_sell_slices (const size_t s0, const size_t s1, const double alpha,
+                                   const gsl_spmatrix_sell * A,
+                                   const double * X, const size_t incX, const double beta,
+                                   double * Y, const size_t incY);
+
+/* y := alpha * A x + beta * y for the rows of the block rows
+   I0 <= I < I1 of a matrix in BSR format; y is not read when beta = 0 */
+void gsl_spblas_dgemv_bsr_rows (const size_t I0, const size_t I1, const double alpha,
+                                const gsl_spmatrix_bsr * A,
+                                const double * X, const size_t incX, const double beta,
+                                double * Y, const size_t incY);
+
+/* name of the instruction set of the selected kernels */
+const char * gsl_spblas_kernels_name (void);
+
+#endif /* __GSL_SPBLAS_KERNELS_H__ */
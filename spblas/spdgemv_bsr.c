@@ -0,0 +1,121 @@
+/* spblas/spdgemv_bsr.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_blas.h>
+
+#include "kernels.h"
+
+/*
+gsl_spblas_dgemv_bsr()
+  Multiply a sparse matrix in BSR format and a vector
+
+Inputs: TransA - CblasNoTrans or CblasTrans
+        alpha  - scalar factor
+        A      - sparse matrix in BSR format
+        x      - dense vector
+        beta   - scalar factor
+        y      - (input/output) dense vector
+
+Return: y = alpha*op(A)*x + beta*y
+*/
+
+int
+gsl_spblas_dgemv_bsr(const CBLAS_TRANSPOSE_t TransA, const double alpha,
+                     const gsl_spmatrix_bsr *A, const gsl_vector *x,
+                     const double beta, gsl_vector *y)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+
+  if ((TransA == CblasNoTrans && N != x->size) ||
+      (TransA == CblasTrans && M != x->size))
+    {
+      GSL_ERROR("invalid length of x vector", GSL_EBADLEN);
+    }
+  else if ((TransA == CblasNoTrans && M != y->size) ||
+           (TransA == CblasTrans && N != y->size))
+    {
+      GSL_ERROR("invalid length of y vector", GSL_EBADLEN);
+    }
+  else if (alpha != 0.0 && TransA == CblasNoTrans)
+    {
+      /* each block row of A forms its elements of y, with y := beta*y fused */
+      gsl_spblas_dgemv_bsr_rows(0, A->nbrows, alpha, A, x->data, x->stride,
+                                beta, y->data, y->stride);
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      const size_t b = A->b;
+      const size_t bb = b * b;
+      const size_t incX = x->stride;
+      const size_t incY = y->stride;
+      const double *X = x->data;
+      double *Y = y->data;
+      size_t I;
+
+      /* form y := beta*y */
+      if (beta == 0.0)
+        gsl_vector_set_zero(y);
+      else if (beta != 1.0)
+        gsl_blas_dscal(beta, y);
+
+      if (alpha == 0.0)
+        return GSL_SUCCESS;
+
+      /* form y := alpha*A^T*x + y: column c of a block in block row I
+         and block column J adds to element J*b + c of y */
+      for (I = 0; I < A->nbrows; ++I)
+        {
+          const size_t nr = GSL_MIN(b, M - I * b);
+          const double *xI = X + I * b * incX;
+          int k;
+
+          for (k = A->p[I]; k < A->p[I + 1]; ++k)
+            {
+              const size_t J = (size_t) A->j[k];
+              const size_t nc = GSL_MIN(b, N - J * b);
+              const double *blk = A->data + (size_t) k * bb;
+              double *yJ = Y + J * b * incY;
+              size_t c, i;
+
+              for (c = 0; c < nc; ++c)
+                {
+                  const double *a = blk + c * b;
+                  double sum = 0.0;
+
+                  for (i = 0; i < nr; ++i)
+                    sum += a[i] * xI[i * incX];
+
+                  yJ[c * incY] += alpha * sum;
+                }
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
@@ -0,0 +1,408 @@
+/* spblas/spdgemv_par.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Parallel sparse matrix-vector product y := alpha op(A) x + beta y.
+ *
+ * The product is computed by rows of op(A): each row block forms its
+ * own elements of y, so that the blocks are independent and are run
+ * as the tasks of a gsl_thread_pool. The rows are split into blocks of
+ * about the same number of non-zero elements, found by bisection of
+ * the row pointers, since the time of a block is proportional to the
+ * memory traffic of its elements rather than to its number of rows.
+ *
+ * When op(A) is not stored by rows (CSC with CblasNoTrans, CSR with
+ * CblasTrans, or COO) the workspace holds a copy of op(A) in
+ * compressed row form, made once by gsl_spblas_dgemv_alloc, whose
+ * values are refreshed by gsl_spblas_dgemv_update. This replaces the
+ * scatter of the columns into y, which cannot be divided between
+ * threads without a private copy of y per thread. The products use
+ * the copy, so a change of A is only seen after an update; a change
+ * of the number of non-zero elements without an update is detected
+ * and rejected, but a change of the values alone cannot be.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+
+#include "../sys/thread_pool.h"
+#include "kernels.h"
+
+/* matrices with fewer non-zero elements are multiplied by one thread */
+#define SPBLAS_PAR_MIN_NNZ 32768
+
+/* number of row blocks per thread, to absorb differences in the speed
+   of the threads */
+#define SPBLAS_PAR_BLOCKS 4
+
+typedef struct
+{
+  const int * Ap;
+  const int * Aj;
+  const double * Ad;
+  const size_t * block;
+  double alpha;
+  double beta;
+  const gsl_vector * x;
+  gsl_vector * y;
+} spblas_par_params;
+
+static int spblas_par_blocks (const gsl_spmatrix * A, gsl_spblas_dgemv_workspace * w);
+static int spblas_par_mirror (const gsl_spmatrix * A, gsl_spblas_dgemv_workspace * w);
+static void spblas_par_partition (const gsl_spmatrix * A, gsl_spblas_dgemv_workspace * w);
+static void spblas_par_task (void * arg, const size_t task);
+
+/*
+gsl_spblas_dgemv_alloc()
+  Allocate a workspace for the products y := alpha op(A) x + beta y
+with gsl_spblas_dgemv_par
+
+Inputs: TransA - CblasNoTrans or CblasTrans
+        A      - sparse matrix, in COO, CSC or CSR format
+        pool   - thread pool, or NULL to compute the products serially
+
+Return: pointer to workspace
+
+Notes:
+1) The workspace depends on the sparsity pattern of A, and, for
+matrices which are not stored by rows of op(A), on its values; see
+gsl_spblas_dgemv_update
+*/
+
+gsl_spblas_dgemv_workspace *
+gsl_spblas_dgemv_alloc (const CBLAS_TRANSPOSE_t TransA, const gsl_spmatrix * A,
+                        gsl_thread_pool * pool)
+{
+  gsl_spblas_dgemv_workspace *w;
+
+  if (TransA != CblasNoTrans && TransA != CblasTrans)
+    {
+      GSL_ERROR_NULL ("TransA must be CblasNoTrans or CblasTrans", GSL_EINVAL);
+    }
+  else if (!GSL_SPMATRIX_ISCOO(A) && !GSL_SPMATRIX_ISCSC(A) && !GSL_SPMATRIX_ISCSR(A))
+    {
+      GSL_ERROR_NULL ("unsupported matrix type", GSL_EINVAL);
+    }
+
+  w = calloc (1, sizeof (gsl_spblas_dgemv_workspace));
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->TransA = TransA;
+  w->size1 = A->size1;
+  w->size2 = A->size2;
+  w->sptype = A->sptype;
+  w->pool = pool;
+
+  if (spblas_par_blocks (A, w))
+    {
+      gsl_spblas_dgemv_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for row blocks", GSL_ENOMEM);
+    }
+
+  if (spblas_par_mirror (A, w))
+    {
+      gsl_spblas_dgemv_free (w);
+      GSL_ERROR_NULL ("failed to copy matrix", GSL_ENOMEM);
+    }
+
+  spblas_par_partition (A, w);
+
+  return w;
+}
+
+void
+gsl_spblas_dgemv_free (gsl_spblas_dgemv_workspace * w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->block)
+    free (w->block);
+
+  if (w->At)
+    gsl_spmatrix_free (w->At);
+
+  free (w);
+}
+
+/*
+gsl_spblas_dgemv_update()
+  Update the workspace after the values or the sparsity pattern of A
+have changed; the size and format of A must be those given to
+gsl_spblas_dgemv_alloc. The number of row blocks is recomputed, so a
+matrix which has grown past SPBLAS_PAR_MIN_NNZ non-zero elements is
+then multiplied in parallel
+*/
+
+int
+gsl_spblas_dgemv_update (const gsl_spmatrix * A, gsl_spblas_dgemv_workspace * w)
+{
+  if (A->size1 != w->size1 || A->size2 != w->size2)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else if (A->sptype != w->sptype)
+    {
+      GSL_ERROR ("matrix format does not match workspace", GSL_EINVAL);
+    }
+  else
+    {
+      int status = spblas_par_blocks (A, w);
+
+      if (status)
+        {
+          GSL_ERROR ("failed to allocate space for row blocks", status);
+        }
+
+      status = spblas_par_mirror (A, w);
+
+      if (status)
+        {
+          GSL_ERROR ("failed to copy matrix", status);
+        }
+
+      spblas_par_partition (A, w);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_spblas_dgemv_par()
+  Multiply a sparse matrix and a vector, using the threads of the
+pool given to gsl_spblas_dgemv_alloc
+
+Inputs: alpha - scalar factor
+        A     - sparse matrix, as given to gsl_spblas_dgemv_alloc
+        x     - dense vector
+        beta  - scalar factor
+        y     - (input/output) dense vector
+        w     - workspace
+
+Return: y = alpha*op(A)*x + beta*y, with op(A) as given to
+gsl_spblas_dgemv_alloc
+
+Notes:
+1) **If A is not stored by rows of op(A) (CSC with CblasNoTrans, CSR
+with CblasTrans, or COO), the product uses the copy of op(A) in the
+workspace, so gsl_spblas_dgemv_update must be called after any change
+of A.** A change of the number of non-zero elements without an update
+is rejected with GSL_EINVAL; a change of the values alone cannot be
+detected, and the product is then that of the previous values
+*/
+
+int
+gsl_spblas_dgemv_par (const double alpha, const gsl_spmatrix * A, const gsl_vector * x,
+                      const double beta, gsl_vector * y, gsl_spblas_dgemv_workspace * w)
+{
+  const CBLAS_TRANSPOSE_t TransA = w->TransA;
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+
+  if (M != w->size1 || N != w->size2)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else if (A->sptype != w->sptype)
+    {
+      GSL_ERROR ("matrix format does not match workspace", GSL_EINVAL);
+    }
+  else if ((TransA == CblasNoTrans && N != x->size) ||
+           (TransA == CblasTrans && M != x->size))
+    {
+      GSL_ERROR ("invalid length of x vector", GSL_EBADLEN);
+    }
+  else if ((TransA == CblasNoTrans && M != y->size) ||
+           (TransA == CblasTrans && N != y->size))
+    {
+      GSL_ERROR ("invalid length of y vector", GSL_EBADLEN);
+    }
+  else if (w->At != NULL && gsl_spmatrix_nnz (A) != w->nnz)
+    {
+      GSL_ERROR ("matrix has changed since gsl_spblas_dgemv_update", GSL_EINVAL);
+    }
+  else if (alpha == 0.0)
+    {
+      if (beta == 0.0)
+        gsl_vector_set_zero (y);
+      else if (beta != 1.0)
+        gsl_blas_dscal (beta, y);
+
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      const gsl_spmatrix * B = (w->At != NULL) ? w->At : A;
+      spblas_par_params params;
+
+      params.Ap = B->p;
+      params.Aj = B->i;
+      params.Ad = B->data;
+      params.block = w->block;
+      params.alpha = alpha;
+      params.beta = beta;
+      params.x = x;
+      params.y = y;
+
+      if (w->nblocks == 1)
+        spblas_par_task (&params, 0);
+      else
+        thread_pool_run (w->pool, w->nblocks, spblas_par_task, &params);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* choose the number of row blocks of op(A) from the number of
+   non-zero elements of A and the threads of the pool, and size
+   w->block for them */
+static int
+spblas_par_blocks (const gsl_spmatrix * A, gsl_spblas_dgemv_workspace * w)
+{
+  const size_t nrows = (w->TransA == CblasNoTrans) ? w->size1 : w->size2;
+  size_t nthreads = (w->pool != NULL) ? gsl_thread_pool_nthreads (w->pool) : 1;
+  size_t nblocks;
+
+  if (gsl_spmatrix_nnz (A) < SPBLAS_PAR_MIN_NNZ)
+    nthreads = 1;
+
+  nblocks = (nthreads > 1) ? GSL_MIN (SPBLAS_PAR_BLOCKS * nthreads, GSL_MAX (nrows, 1)) : 1;
+
+  if (w->block == NULL || nblocks != w->nblocks)
+    {
+      size_t * block = realloc (w->block, (nblocks + 1) * sizeof (size_t));
+
+      if (block == NULL)
+        return GSL_ENOMEM;
+
+      w->block = block;
+      w->nblocks = nblocks;
+    }
+
+  w->nnz = gsl_spmatrix_nnz (A);
+
+  return GSL_SUCCESS;
+}
+
+/* make w->At the compressed row form of op(A) if A is not stored by
+   rows of op(A); the arrays p, i, data of a CSC matrix of op(A)^T are
+   those of the CSR form of op(A) */
+static int
+spblas_par_mirror (const gsl_spmatrix * A, gsl_spblas_dgemv_workspace * w)
+{
+  const size_t nz = gsl_spmatrix_nnz (A);
+  int status;
+
+  if ((GSL_SPMATRIX_ISCSR(A) && w->TransA == CblasNoTrans) ||
+      (GSL_SPMATRIX_ISCSC(A) && w->TransA == CblasTrans))
+    {
+      return GSL_SUCCESS;
+    }
+
+  if (GSL_SPMATRIX_ISCOO(A))
+    {
+      /* CSR of A, or CSC of A which is the CSR of A^T */
+      const int sptype = (w->TransA == CblasNoTrans) ? GSL_SPMATRIX_CSR : GSL_SPMATRIX_CSC;
+
+      if (w->At == NULL)
+        {
+          w->At = gsl_spmatrix_alloc_nzmax (A->size1, A->size2, GSL_MAX (nz, 1), sptype);
+          if (w->At == NULL)
+            return GSL_ENOMEM;
+        }
+
+      if (sptype == GSL_SPMATRIX_CSR)
+        status = gsl_spmatrix_csr (w->At, A);
+      else
+        status = gsl_spmatrix_csc (w->At, A);
+    }
+  else
+    {
+      /* CSC of A^T is the CSR of A, and CSR of A^T is the CSC of A */
+      if (w->At == NULL)
+        {
+          w->At = gsl_spmatrix_alloc_nzmax (A->size2, A->size1, GSL_MAX (nz, 1), A->sptype);
+          if (w->At == NULL)
+            return GSL_ENOMEM;
+        }
+
+      status = gsl_spmatrix_transpose_memcpy (w->At, A);
+    }
+
+  return status;
+}
+
+/* split the rows of op(A) into w->nblocks blocks of nearly equal
+   numbers of non-zero elements; block b is the rows
+   block[b] <= r < block[b+1] */
+static void
+spblas_par_partition (const gsl_spmatrix * A, gsl_spblas_dgemv_workspace * w)
+{
+  const size_t nrows = (w->TransA == CblasNoTrans) ? w->size1 : w->size2;
+  const size_t nb = w->nblocks;
+  size_t b;
+
+  w->block[0] = 0;
+  w->block[nb] = nrows;
+
+  if (nb > 1)
+    {
+      /* row pointers of op(A) */
+      const int * Ap = (w->At != NULL) ? w->At->p : A->p;
+      const double nnz = (double) Ap[nrows];
+
+      for (b = 1; b < nb; ++b)
+        {
+          /* first row r with Ap[r] >= b * nnz / nb */
+          const double target = b * nnz / nb;
+          size_t lo = w->block[b - 1], hi = nrows;
+
+          while (lo < hi)
+            {
+              size_t mid = lo + (hi - lo) / 2;
+
+              if ((double) Ap[mid] < target)
+                lo = mid + 1;
+              else
+                hi = mid;
+            }
+
+          w->block[b] = lo;
+        }
+    }
+}
+
+static void
+spblas_par_task (void * arg, const size_t task)
+{
+  spblas_par_params * params = (spblas_par_params *) arg;
+
+  gsl_spblas_dgemv_rows (params->block[task], params->block[task + 1], params->alpha,
+                         params->Ap, params->Aj, params->Ad,
+                         params->x->data, params->x->stride, params->beta,
+                         params->y->data, params->y->stride);
+}
@@ -0,0 +1,106 @@
+/* spblas/spdgemv_sell.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_blas.h>
+
+#include "kernels.h"
+
+/*
+gsl_spblas_dgemv_sell()
+  Multiply a sparse matrix in SELL-C-sigma format and a vector
+
+Inputs: TransA - CblasNoTrans or CblasTrans
+        alpha  - scalar factor
+        A      - sparse matrix in SELL-C-sigma format
+        x      - dense vector
+        beta   - scalar factor
+        y      - (input/output) dense vector
+
+Return: y = alpha*op(A)*x + beta*y
+*/
+
+int
+gsl_spblas_dgemv_sell(const CBLAS_TRANSPOSE_t TransA, const double alpha,
+                      const gsl_spmatrix_sell *A, const gsl_vector *x,
+                      const double beta, gsl_vector *y)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+
+  if ((TransA == CblasNoTrans && N != x->size) ||
+      (TransA == CblasTrans && M != x->size))
+    {
+      GSL_ERROR("invalid length of x vector", GSL_EBADLEN);
+    }
+  else if ((TransA == CblasNoTrans && M != y->size) ||
+           (TransA == CblasTrans && N != y->size))
+    {
+      GSL_ERROR("invalid length of y vector", GSL_EBADLEN);
+    }
+  else if (alpha != 0.0 && TransA == CblasNoTrans)
+    {
+      /* each row of A forms its element of y, with y := beta*y fused */
+      gsl_spblas_dgemv_sell_slices(0, A->nslices, alpha, A, x->data, x->stride,
+                                   beta, y->data, y->stride);
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      const size_t C = A->C;
+      const size_t incX = x->stride;
+      const size_t incY = y->stride;
+      const double *X = x->data;
+      double *Y = y->data;
+      size_t r;
+
+      /* form y := beta*y */
+      if (beta == 0.0)
+        gsl_vector_set_zero(y);
+      else if (beta != 1.0)
+        gsl_blas_dscal(beta, y);
+
+      if (alpha == 0.0)
+        return GSL_SUCCESS;
+
+      /* form y := alpha*A^T*x + y by scattering the rows of A */
+      for (r = 0; r < M; ++r)
+        {
+          const size_t s = r / C;
+          const size_t q = r - s * C;
+          const int *col = A->col + A->slice[s] + q;
+          const double *data = A->data + A->slice[s] + q;
+          const double ax = alpha * X[A->perm[r] * incX];
+          const int n = A->len[r];
+          int k;
+
+          for (k = 0; k < n; ++k)
+            Y[col[k * C] * incY] += data[k * C] * ax;
+        }
+
+      return GSL_SUCCESS;
+    }
+}
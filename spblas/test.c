@@ -176,6 +176,199 @@ test_dgemv(const size_t N, const size_t M, const double alpha,
   gsl_vector_free(y_sp);
 } /* test_dgemv() */
 
+/* compare gsl_spblas_dgemv_par with gsl_spblas_dgemv for all formats,
+   with strided vectors when stride > 1 */
+static void
+test_dgemv_par(const size_t M, const size_t N, const double density,
+               const double alpha, const double beta,
+               const CBLAS_TRANSPOSE_t TransA, const size_t stride,
+               gsl_thread_pool *pool, const gsl_rng *r)
+{
+  gsl_spmatrix *T = create_random_sparse(M, N, density, r);
+  const size_t lenX = (TransA == CblasNoTrans) ? N : M;
+  const size_t lenY = (TransA == CblasNoTrans) ? M : N;
+  gsl_vector *xbuf = gsl_vector_alloc(lenX * stride);
+  gsl_vector *ybuf = gsl_vector_alloc(lenY * stride);
+  gsl_vector *y0 = gsl_vector_alloc(lenY);
+  gsl_vector *y_exp = gsl_vector_alloc(lenY);
+  gsl_vector_view x = gsl_vector_subvector_with_stride(xbuf, 0, stride, lenX);
+  gsl_vector_view y = gsl_vector_subvector_with_stride(ybuf, 0, stride, lenY);
+  size_t k;
+
+  create_random_vector(&x.vector, r);
+  create_random_vector(y0, r);
+
+  for (k = 0; k < 3; ++k)
+    {
+      gsl_spmatrix *A = (k == 0) ? T : gsl_spmatrix_compress(T, (k == 1) ? GSL_SPMATRIX_CSC : GSL_SPMATRIX_CSR);
+      gsl_spblas_dgemv_workspace *w = gsl_spblas_dgemv_alloc(TransA, A, pool);
+      const char *desc = (k == 0) ? "COO" : (k == 1) ? "CSC" : "CSR";
+      char str[64];
+
+      gsl_vector_memcpy(y_exp, y0);
+      gsl_spblas_dgemv(TransA, alpha, A, &x.vector, beta, y_exp);
+
+      gsl_vector_memcpy(&y.vector, y0);
+      gsl_spblas_dgemv_par(alpha, A, &x.vector, beta, &y.vector, w);
+
+      sprintf(str, "test_dgemv_par: %s %s stride=%zu nblocks=%zu",
+              desc, (TransA == CblasNoTrans) ? "N" : "T", stride, w->nblocks);
+      test_vectors(&y.vector, y_exp, 1.0e-10, str);
+
+      /* change the values of A and update the workspace */
+      gsl_spmatrix_scale(A, -2.0);
+      if (k != 0)
+        gsl_spmatrix_scale(T, -2.0);
+      gsl_spblas_dgemv_update(A, w);
+
+      gsl_vector_memcpy(y_exp, y0);
+      gsl_spblas_dgemv(TransA, alpha, A, &x.vector, beta, y_exp);
+
+      gsl_vector_memcpy(&y.vector, y0);
+      gsl_spblas_dgemv_par(alpha, A, &x.vector, beta, &y.vector, w);
+
+      sprintf(str, "test_dgemv_par: %s %s stride=%zu update", desc,
+              (TransA == CblasNoTrans) ? "N" : "T", stride);
+      test_vectors(&y.vector, y_exp, 1.0e-10, str);
+
+      gsl_spblas_dgemv_free(w);
+      if (k != 0)
+        gsl_spmatrix_free(A);
+    }
+
+  gsl_spmatrix_free(T);
+  gsl_vector_free(xbuf);
+  gsl_vector_free(ybuf);
+  gsl_vector_free(y0);
+  gsl_vector_free(y_exp);
+} /* test_dgemv_par() */
+
+/* compare gsl_spblas_dgemv_sell and gsl_spblas_dgemv_bsr with
+   gsl_spblas_dgemv for several slice heights, sorting windows and
+   block dimensions */
+/* grow a small matrix past the threshold of the parallel product: a
+   product without an update is rejected, and the update splits the
+   rows between the threads */
+static void
+test_dgemv_par_grow(const CBLAS_TRANSPOSE_t TransA, gsl_thread_pool *pool,
+                    const gsl_rng *r)
+{
+  const size_t N = 2000;
+  gsl_spmatrix *A = gsl_spmatrix_alloc(N, N);
+  gsl_vector *x = gsl_vector_alloc(N);
+  gsl_vector *y = gsl_vector_alloc(N);
+  gsl_vector *y_exp = gsl_vector_alloc(N);
+  gsl_spblas_dgemv_workspace *w;
+  gsl_error_handler_t *old_handler;
+  size_t i, j;
+  int status;
+
+  for (i = 0; i < N; ++i)
+    gsl_spmatrix_set(A, i, i, 1.0 + i);
+
+  w = gsl_spblas_dgemv_alloc(TransA, A, pool);
+  gsl_test(w->nblocks != 1, "test_dgemv_par_grow: %s small nblocks=%zu",
+           (TransA == CblasNoTrans) ? "N" : "T", w->nblocks);
+
+  for (i = 0; i < N; ++i)
+    for (j = 1; j < 20; ++j)
+      gsl_spmatrix_set(A, i, (i + 97 * j) % N, gsl_rng_uniform(r));
+
+  create_random_vector(x, r);
+  create_random_vector(y, r);
+
+  old_handler = gsl_set_error_handler_off();
+  status = gsl_spblas_dgemv_par(1.0, A, x, 0.0, y, w);
+  gsl_set_error_handler(old_handler);
+
+  gsl_test(status != GSL_EINVAL, "test_dgemv_par_grow: %s without update status=%d",
+           (TransA == CblasNoTrans) ? "N" : "T", status);
+
+  gsl_spblas_dgemv_update(A, w);
+  gsl_test(w->nblocks < 2, "test_dgemv_par_grow: %s large nblocks=%zu",
+           (TransA == CblasNoTrans) ? "N" : "T", w->nblocks);
+
+  gsl_vector_memcpy(y_exp, y);
+  gsl_spblas_dgemv(TransA, 2.0, A, x, -0.5, y_exp);
+  gsl_spblas_dgemv_par(2.0, A, x, -0.5, y, w);
+  test_vectors(y, y_exp, 1.0e-10, (TransA == CblasNoTrans) ?
+               "test_dgemv_par_grow: N update" : "test_dgemv_par_grow: T update");
+
+  gsl_spblas_dgemv_free(w);
+  gsl_spmatrix_free(A);
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+  gsl_vector_free(y_exp);
+} /* test_dgemv_par_grow() */
+
+static void
+test_dgemv_fmt(const size_t M, const size_t N, const double density,
+               const double alpha, const double beta,
+               const CBLAS_TRANSPOSE_t TransA, const size_t stride,
+               const gsl_rng *r)
+{
+  const size_t C[] = { 1, 3, 4, 8, 12 };
+  const size_t b[] = { 1, 2, 3, 4, 6, 8, 10 };
+  gsl_spmatrix *T = create_random_sparse(M, N, density, r);
+  gsl_spmatrix *A = gsl_spmatrix_compress(T, GSL_SPMATRIX_CSR);
+  const size_t lenX = (TransA == CblasNoTrans) ? N : M;
+  const size_t lenY = (TransA == CblasNoTrans) ? M : N;
+  gsl_vector *xbuf = gsl_vector_alloc(lenX * stride);
+  gsl_vector *ybuf = gsl_vector_alloc(lenY * stride);
+  gsl_vector *y0 = gsl_vector_alloc(lenY);
+  gsl_vector *y_exp = gsl_vector_alloc(lenY);
+  gsl_vector_view x = gsl_vector_subvector_with_stride(xbuf, 0, stride, lenX);
+  gsl_vector_view y = gsl_vector_subvector_with_stride(ybuf, 0, stride, lenY);
+  const char *trans = (TransA == CblasNoTrans) ? "N" : "T";
+  char str[128];
+  size_t i, k;
+
+  create_random_vector(&x.vector, r);
+  create_random_vector(y0, r);
+
+  gsl_vector_memcpy(y_exp, y0);
+  gsl_spblas_dgemv(TransA, alpha, A, &x.vector, beta, y_exp);
+
+  for (i = 0; i < sizeof(C) / sizeof(C[0]); ++i)
+    {
+      for (k = 0; k < 3; ++k)
+        {
+          const size_t sigma = (k == 0) ? 1 : (k == 1) ? C[i] : 4 * C[i];
+          gsl_spmatrix_sell *S = gsl_spmatrix_sell_compress(A, C[i], sigma);
+
+          gsl_vector_memcpy(&y.vector, y0);
+          gsl_spblas_dgemv_sell(TransA, alpha, S, &x.vector, beta, &y.vector);
+
+          sprintf(str, "test_dgemv_fmt: SELL-%zu-%zu %zu-by-%zu %s stride=%zu",
+                  C[i], sigma, M, N, trans, stride);
+          test_vectors(&y.vector, y_exp, 1.0e-10, str);
+
+          gsl_spmatrix_sell_free(S);
+        }
+    }
+
+  for (i = 0; i < sizeof(b) / sizeof(b[0]); ++i)
+    {
+      gsl_spmatrix_bsr *B = gsl_spmatrix_bsr_compress(A, b[i]);
+
+      gsl_vector_memcpy(&y.vector, y0);
+      gsl_spblas_dgemv_bsr(TransA, alpha, B, &x.vector, beta, &y.vector);
+
+      sprintf(str, "test_dgemv_fmt: BSR-%zu %zu-by-%zu %s stride=%zu",
+              b[i], M, N, trans, stride);
+      test_vectors(&y.vector, y_exp, 1.0e-10, str);
+
+      gsl_spmatrix_bsr_free(B);
+    }
+
+  gsl_spmatrix_free(T);
+  gsl_spmatrix_free(A);
+  gsl_vector_free(xbuf);
+  gsl_vector_free(ybuf);
+  gsl_vector_free(y0);
+  gsl_vector_free(y_exp);
+} /* test_dgemv_fmt() */
+
 static void
 test_dgemm(const double alpha, const size_t M, const size_t N,
            const gsl_rng *r)
@@ -251,6 +444,45 @@ main()
         }
     }
 
+  {
+    gsl_thread_pool *pool = gsl_thread_pool_alloc(3);
+
+    for (m = 1; m <= 20; m += 3)
+      {
+        for (n = 1; n <= 20; n += 4)
+          {
+            test_dgemv_par(m, n, 0.3, 1.0, 0.0, CblasNoTrans, 1, NULL, r);
+            test_dgemv_par(m, n, 0.3, 2.4, -0.5, CblasTrans, 1, NULL, r);
+          }
+      }
+
+    /* large enough to be split into row blocks */
+    test_dgemv_par(400, 300, 0.4, 1.0, 0.0, CblasNoTrans, 1, pool, r);
+    test_dgemv_par(400, 300, 0.4, 2.4, -0.5, CblasTrans, 1, pool, r);
+    test_dgemv_par(300, 500, 0.3, 0.1, 10.0, CblasNoTrans, 2, pool, r);
+    test_dgemv_par(300, 500, 0.3, -1.0, 1.0, CblasTrans, 3, pool, r);
+
+    test_dgemv_par_grow(CblasNoTrans, pool, r);
+    test_dgemv_par_grow(CblasTrans, pool, r);
+
+    gsl_thread_pool_free(pool);
+  }
+
+  for (m = 1; m <= 25; m += 4)
+    {
+      for (n = 1; n <= 25; n += 3)
+        {
+          test_dgemv_fmt(m, n, 0.3, 1.0, 0.0, CblasNoTrans, 1, r);
+          test_dgemv_fmt(m, n, 0.3, 2.4, -0.5, CblasTrans, 1, r);
+        }
+    }
+
+  test_dgemv_fmt(96, 100, 0.2, 1.0, 0.0, CblasNoTrans, 1, r);
+  test_dgemv_fmt(101, 77, 0.05, 2.4, -0.5, CblasNoTrans, 1, r);
+  test_dgemv_fmt(64, 80, 0.5, 0.1, 10.0, CblasNoTrans, 2, r);
+  test_dgemv_fmt(96, 100, 0.2, -1.0, 1.0, CblasTrans, 3, r);
+  test_dgemv_fmt(40, 40, 0.1, 0.0, 2.0, CblasNoTrans, 1, r);
+
   test_dgemm(1.0, 10, 10, r);
   test_dgemm(2.3, 20, 15, r);
   test_dgemm(1.8, 12, 30, r);
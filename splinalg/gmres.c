@@ -53,6 +53,9 @@ typedef struct
   double *s;
 
   double normr;    /* residual norm ||r|| */
+
+  gsl_thread_pool *pool;           /* threads of the products A*v, or NULL */
+  gsl_spblas_dgemv_workspace *spw; /* workspace of the parallel products */
 } gmres_state_t;
 
 static void gmres_free(void *vstate);
@@ -160,9 +163,72 @@ gmres_free(void *vstate)
   if (state->s)
     free(state->s);
 
+  if (state->spw)
+    gsl_spblas_dgemv_free(state->spw);
+
   free(state);
 } /* gmres_free() */
 
+/*
+gmres_set_pool()
+  Compute the products with the matrix with the threads of pool, or
+serially if pool is NULL; the parallel workspace is made at the next
+call to gmres_iterate
+*/
+
+static int
+gmres_set_pool(gsl_thread_pool *pool, void *vstate)
+{
+  gmres_state_t *state = (gmres_state_t *) vstate;
+
+  if (state->spw)
+    {
+      gsl_spblas_dgemv_free(state->spw);
+      state->spw = NULL;
+    }
+
+  state->pool = pool;
+
+  return GSL_SUCCESS;
+} /* gmres_set_pool() */
+
+/* prepare the workspace of the parallel products for the matrix A;
+   A may have changed since the previous call to gmres_iterate */
+static int
+gmres_prepare(const gsl_spmatrix *A, gmres_state_t *state)
+{
+  if (state->pool == NULL)
+    return GSL_SUCCESS;
+
+  if (state->spw != NULL && state->spw->sptype != A->sptype)
+    {
+      gsl_spblas_dgemv_free(state->spw);
+      state->spw = NULL;
+    }
+
+  if (state->spw == NULL)
+    {
+      state->spw = gsl_spblas_dgemv_alloc(CblasNoTrans, A, state->pool);
+      if (state->spw == NULL)
+        return GSL_ENOMEM;
+
+      return GSL_SUCCESS;
+    }
+
+  return gsl_spblas_dgemv_update(A, state->spw);
+}
+
+/* y = alpha*A*x + beta*y, in parallel if a pool was given */
+static int
+gmres_dgemv(const double alpha, const gsl_spmatrix *A, const gsl_vector *x,
+            const double beta, gsl_vector *y, gmres_state_t *state)
+{
+  if (state->spw != NULL)
+    return gsl_spblas_dgemv_par(alpha, A, x, beta, y, state->spw);
+  else
+    return gsl_spblas_dgemv(CblasNoTrans, alpha, A, x, beta, y);
+}
+
 /*
 gmres_iterate()
   Solve A*x = b using GMRES algorithm
@@ -189,6 +255,9 @@ Notes:
 (Saad, 2003 [2])
 
 2) On output, work->normr contains ||b - A*x||
+
+3) If a thread pool was given with gmres_set_pool, the products with
+A are computed by gsl_spblas_dgemv_par
 */
 
 static int
@@ -215,6 +284,10 @@ gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
     {
       GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
     }
+  else if (gmres_prepare(A, state))
+    {
+      GSL_ERROR("failed to prepare parallel matrix-vector product", GSL_ENOMEM);
+    }
   else
     {
       int status = GSL_SUCCESS;
@@ -247,7 +320,7 @@ gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
 
       /* Step 1a: compute r = b - A*x_0 */
       gsl_vector_memcpy(r, b);
-      gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, r);
+      gmres_dgemv(-1.0, A, x, 1.0, r, state);
 
       /* Step 1b */
       gsl_vector_memcpy(&h0.vector, r);
@@ -276,9 +349,8 @@ gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
 
           /* Step 2a: form v_m = P_m e_m = e_m - tau_m w_m */
           gsl_vector_set_zero(&vm.vector);
-          gsl_vector_memcpy(&vv.vector, &um.vector);
           tau = gsl_vector_get(state->tau, j); /* tau_m */
-          gsl_vector_scale(&vv.vector, -tau);
+          gsl_blas_daxpby(-tau, &um.vector, 0.0, &vv.vector);
           gsl_vector_set(&vv.vector, 0, 1.0 - tau);
 
           /* Step 2a: v_m <- P_1 P_2 ... P_{m-1} v_m */
@@ -293,7 +365,7 @@ gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
             }
 
           /* Step 2a: v_m <- A*v_m */
-          gsl_spblas_dgemv(CblasNoTrans, 1.0, A, &vm.vector, 0.0, r);
+          gmres_dgemv(1.0, A, &vm.vector, 0.0, r, state);
           gsl_vector_memcpy(&vm.vector, r);
 
           /* Step 2a: v_m <- P_m ... P_1 v_m */
@@ -400,7 +472,7 @@ gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
 
       /* compute new residual r = b - A*x */
       gsl_vector_memcpy(r, b);
-      gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, r);
+      gmres_dgemv(-1.0, A, x, 1.0, r, state);
       normr = gsl_blas_dnrm2(r);
 
       if (normr <= reltol)
@@ -428,7 +500,8 @@ static const gsl_splinalg_itersolve_type gmres_type =
   &gmres_alloc,
   &gmres_iterate,
   &gmres_normr,
-  &gmres_free
+  &gmres_free,
+  &gmres_set_pool
 };
 
 const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_gmres =
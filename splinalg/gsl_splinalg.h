@@ -25,6 +25,7 @@
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_spmatrix.h>
 #include <gsl/gsl_linalg.h>
+#include <gsl/gsl_thread_pool.h>
 #include <gsl/gsl_types.h>
 
 #undef __BEGIN_DECLS
@@ -48,6 +49,7 @@ typedef struct
                   const double tol, gsl_vector *x, void *);
   double (*normr)(const void *);
   void (*free) (void *);
+  int (*set_pool) (gsl_thread_pool *, void *);
 } gsl_splinalg_itersolve_type;
 
 typedef struct
@@ -73,6 +75,8 @@ int gsl_splinalg_itersolve_iterate(const gsl_spmatrix *A,
                                    const double tol, gsl_vector *x,
                                    gsl_splinalg_itersolve *w);
 double gsl_splinalg_itersolve_normr(const gsl_splinalg_itersolve *w);
+int gsl_splinalg_itersolve_set_pool(gsl_thread_pool *pool,
+                                    gsl_splinalg_itersolve *w);
 
 __END_DECLS
 
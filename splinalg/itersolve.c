@@ -88,3 +88,15 @@ gsl_splinalg_itersolve_normr(const gsl_splinalg_itersolve *w)
 {
   return w->normr;
 }
+
+int
+gsl_splinalg_itersolve_set_pool(gsl_thread_pool *pool,
+                                gsl_splinalg_itersolve *w)
+{
+  if (w->type->set_pool == NULL)
+    {
+      GSL_ERROR("solver does not support a thread pool", GSL_EINVAL);
+    }
+
+  return w->type->set_pool(pool, w->state);
+}
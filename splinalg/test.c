@@ -285,7 +285,8 @@ test_toeplitz(const size_t N, const double a, const double b,
 } /* test_toeplitz() */
 
 static void
-test_random(const size_t N, const gsl_rng *r, const int compress)
+test_random(const size_t N, const gsl_rng *r, const int compress,
+            gsl_thread_pool *pool)
 {
   const gsl_splinalg_itersolve_type *T = gsl_splinalg_itersolve_gmres;
   const double tol = 1.0e-8;
@@ -300,6 +301,9 @@ test_random(const size_t N, const gsl_rng *r, const int compress)
 
   const char *desc = gsl_splinalg_itersolve_name(w);
 
+  if (pool != NULL)
+    gsl_splinalg_itersolve_set_pool(pool, w);
+
   create_random_vector(b, r);
 
   if (compress)
@@ -308,7 +312,8 @@ test_random(const size_t N, const gsl_rng *r, const int compress)
     B = A;
 
   status = gsl_splinalg_itersolve_iterate(B, b, tol, x, w);
-  gsl_test(status, "%s random status s=%d N=%zu", desc, status, N);
+  gsl_test(status, "%s random status s=%d N=%zu pool=%d", desc, status, N,
+           pool != NULL);
 
   /* check that the residual satisfies ||r|| <= tol*||b|| */
   {
@@ -322,8 +327,8 @@ test_random(const size_t N, const gsl_rng *r, const int compress)
     normb = gsl_blas_dnrm2(b);
 
     status = (normr <= tol*normb) != 1;
-    gsl_test(status, "%s random residual N=%zu normr=%.12e normb=%.12e",
-             desc, N, normr, normb);
+    gsl_test(status, "%s random residual N=%zu pool=%d normr=%.12e normb=%.12e",
+             desc, N, pool != NULL, normr, normb);
 
     gsl_vector_free(res);
   }
@@ -362,10 +367,20 @@ main()
 
   for (n = 1; n <= 100; ++n)
     {
-      test_random(n, r, 0);
-      test_random(n, r, 1);
+      test_random(n, r, 0, NULL);
+      test_random(n, r, 1, NULL);
     }
 
+  /* large enough for the products to be split between the threads */
+  {
+    gsl_thread_pool *pool = gsl_thread_pool_alloc(3);
+
+    test_random(400, r, 0, pool);
+    test_random(400, r, 1, pool);
+
+    gsl_thread_pool_free(pool);
+  }
+
   gsl_rng_free(r);
 
   exit (gsl_test_summary());
@@ -0,0 +1,208 @@
+/* spmatrix/bsr.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+
+static int bsr_compare (const void * a, const void * b);
+
+/*
+gsl_spmatrix_bsr_compress()
+  Create a sparse matrix in block compressed row format (BSR)
+
+Inputs: A - sparse matrix in CSR format, as made by gsl_spmatrix_compress
+        b - block dimension
+
+Return: pointer to new matrix (should be freed with gsl_spmatrix_bsr_free)
+
+Notes: every b-by-b block containing an element of A is stored in
+full, so the format suits matrices whose elements come in dense
+blocks, such as those of finite element discretizations with several
+unknowns per node.
+*/
+
+gsl_spmatrix_bsr *
+gsl_spmatrix_bsr_compress (const gsl_spmatrix * A, const size_t b)
+{
+  if (!GSL_SPMATRIX_ISCSR(A))
+    {
+      GSL_ERROR_NULL ("input matrix must be in CSR format", GSL_EINVAL);
+    }
+  else if (b == 0)
+    {
+      GSL_ERROR_NULL ("block dimension b must be positive", GSL_EINVAL);
+    }
+  else
+    {
+      const size_t M = A->size1;
+      const size_t bb = b * b;
+      const int *Ap = A->p;
+      const int *Aj = A->i;
+      const double *Ad = A->data;
+      gsl_spmatrix_bsr *m;
+      int *mark;                /* last block row with a block in each block column */
+      int *pos;                 /* index of the block of each block column in the current block row */
+      size_t I, nzb;
+      int k;
+
+      m = calloc (1, sizeof (gsl_spmatrix_bsr));
+      if (!m)
+        {
+          GSL_ERROR_NULL ("failed to allocate space for spmatrix_bsr struct",
+                          GSL_ENOMEM);
+        }
+
+      m->size1 = M;
+      m->size2 = A->size2;
+      m->b = b;
+      m->nbrows = (M + b - 1) / b;
+      m->nbcols = (A->size2 + b - 1) / b;
+      m->nz = A->nz;
+
+      m->p = malloc ((m->nbrows + 1) * sizeof (int));
+      mark = malloc (m->nbcols * sizeof (int));
+      pos = malloc (m->nbcols * sizeof (int));
+      if (!m->p || !mark || !pos)
+        {
+          free (mark);
+          free (pos);
+          gsl_spmatrix_bsr_free (m);
+          GSL_ERROR_NULL ("failed to allocate space for block row pointers",
+                          GSL_ENOMEM);
+        }
+
+      /* count the blocks of each block row */
+      for (I = 0; I < m->nbcols; ++I)
+        mark[I] = -1;
+
+      nzb = 0;
+      m->p[0] = 0;
+      for (I = 0; I < m->nbrows; ++I)
+        {
+          const size_t r1 = GSL_MIN ((I + 1) * b, M);
+          size_t r;
+
+          for (r = I * b; r < r1; ++r)
+            {
+              for (k = Ap[r]; k < Ap[r + 1]; ++k)
+                {
+                  const size_t J = (size_t) Aj[k] / b;
+
+                  if (mark[J] != (int) I)
+                    {
+                      mark[J] = (int) I;
+                      ++nzb;
+                    }
+                }
+            }
+
+          m->p[I + 1] = (int) nzb;
+        }
+
+      m->nzb = nzb;
+
+      /* allocate at least one block so that an empty matrix is valid */
+      m->j = malloc (GSL_MAX (nzb, 1) * sizeof (int));
+      m->data = calloc (GSL_MAX (nzb, 1) * bb, sizeof (double));
+      if (!m->j || !m->data)
+        {
+          free (mark);
+          free (pos);
+          gsl_spmatrix_bsr_free (m);
+          GSL_ERROR_NULL ("failed to allocate space for blocks", GSL_ENOMEM);
+        }
+
+      /* list the block columns of each block row in increasing order,
+         then copy the elements into their blocks */
+      for (I = 0; I < m->nbcols; ++I)
+        mark[I] = -1;
+
+      for (I = 0; I < m->nbrows; ++I)
+        {
+          const size_t r1 = GSL_MIN ((I + 1) * b, M);
+          int *j = m->j + m->p[I];
+          int n = 0;
+          size_t r;
+
+          for (r = I * b; r < r1; ++r)
+            {
+              for (k = Ap[r]; k < Ap[r + 1]; ++k)
+                {
+                  const size_t J = (size_t) Aj[k] / b;
+
+                  if (mark[J] != (int) I)
+                    {
+                      mark[J] = (int) I;
+                      j[n++] = (int) J;
+                    }
+                }
+            }
+
+          qsort (j, (size_t) n, sizeof (int), bsr_compare);
+
+          for (k = 0; k < n; ++k)
+            pos[j[k]] = m->p[I] + k;
+
+          for (r = I * b; r < r1; ++r)
+            {
+              for (k = Ap[r]; k < Ap[r + 1]; ++k)
+                {
+                  const size_t c = (size_t) Aj[k];
+                  double *block = m->data + (size_t) pos[c / b] * bb;
+
+                  block[(c % b) * b + (r - I * b)] += Ad[k];
+                }
+            }
+        }
+
+      free (mark);
+      free (pos);
+
+      return m;
+    }
+}
+
+void
+gsl_spmatrix_bsr_free (gsl_spmatrix_bsr * m)
+{
+  RETURN_IF_NULL (m);
+
+  if (m->p)
+    free (m->p);
+
+  if (m->j)
+    free (m->j);
+
+  if (m->data)
+    free (m->data);
+
+  free (m);
+}
+
+static int
+bsr_compare (const void * a, const void * b)
+{
+  const int ia = *(const int *) a;
+  const int ib = *(const int *) b;
+
+  return (ia > ib) - (ia < ib);
+}
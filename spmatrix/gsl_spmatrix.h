@@ -59,4 +59,7 @@ void gsl_spmatrix_cumsum(const size_t n, int * c);
 #include <gsl/gsl_spmatrix_uchar.h>
 #include <gsl/gsl_spmatrix_char.h>
 
+#include <gsl/gsl_spmatrix_sell.h>
+#include <gsl/gsl_spmatrix_bsr.h>
+
 #endif /* __GSL_SPMATRIX_H__ */
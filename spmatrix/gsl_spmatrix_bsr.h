@@ -0,0 +1,72 @@
+/* spmatrix/gsl_spmatrix_bsr.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_SPMATRIX_BSR_H__
+#define __GSL_SPMATRIX_BSR_H__
+
+#include <stdlib.h>
+#include <gsl/gsl_spmatrix_double.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/*
+ * Block compressed row format (BSR):
+ *
+ * The matrix is divided into b-by-b blocks, and the blocks containing
+ * a non-zero element are stored as dense arrays by columns, in
+ * compressed row format over the block rows. Block k, with
+ * p[I] <= k < p[I+1], is in block row I and block column j[k], so
+ * that element (I*b + r, j[k]*b + c) is
+ *
+ *   data[k*b*b + c*b + r]
+ *
+ * The blocks of the last block row and column are padded with zeros
+ * if b does not divide the dimensions of the matrix.
+ */
+
+typedef struct
+{
+  size_t size1;               /* number of rows */
+  size_t size2;               /* number of columns */
+  size_t b;                   /* block dimension */
+  size_t nbrows;              /* number of block rows, ceil(size1 / b) */
+  size_t nbcols;              /* number of block columns, ceil(size2 / b) */
+  size_t nz;                  /* number of non-zero elements */
+  size_t nzb;                 /* number of stored blocks */
+  int *p;                     /* first block of each block row, size nbrows + 1 */
+  int *j;                     /* block column of each block, size nzb */
+  double *data;               /* blocks, size nzb*b*b */
+} gsl_spmatrix_bsr;
+
+gsl_spmatrix_bsr * gsl_spmatrix_bsr_compress (const gsl_spmatrix * A, const size_t b);
+void gsl_spmatrix_bsr_free (gsl_spmatrix_bsr * m);
+
+__END_DECLS
+
+#endif /* __GSL_SPMATRIX_BSR_H__ */
@@ -0,0 +1,77 @@
+/* spmatrix/gsl_spmatrix_sell.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_SPMATRIX_SELL_H__
+#define __GSL_SPMATRIX_SELL_H__
+
+#include <stdlib.h>
+#include <gsl/gsl_spmatrix_double.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/*
+ * Sliced ELLPACK format (SELL-C-sigma):
+ *
+ * The rows are sorted by decreasing length within windows of sigma
+ * consecutive rows, and the sorted rows are grouped into slices of C
+ * rows. Row r of the sorted order is row perm[r] of the matrix. Each
+ * slice is stored as a dense C-by-w array by columns, where w is the
+ * length of its longest row, so that element k of sorted row
+ * r = s*C + q of slice s is
+ *
+ *   data[slice[s] + k*C + q],   in column col[slice[s] + k*C + q]
+ *
+ * for 0 <= k < len[r]. The rows are padded to w elements with zeros,
+ * whose column is that of the last element of the row (or 0), and the
+ * last slice with empty rows.
+ */
+
+typedef struct
+{
+  size_t size1;               /* number of rows */
+  size_t size2;               /* number of columns */
+  size_t C;                   /* rows in a slice */
+  size_t sigma;               /* rows in a sorting window */
+  size_t nslices;             /* number of slices, ceil(size1 / C) */
+  size_t nz;                  /* number of non-zero elements */
+  size_t nzmax;               /* number of stored elements, including padding */
+  size_t *slice;              /* start of each slice in data, size nslices + 1 */
+  int *perm;                  /* row of the matrix of each sorted row, size size1 */
+  int *len;                   /* length of each sorted row, size size1 */
+  int *col;                   /* column indices, size nzmax */
+  double *data;               /* matrix elements, size nzmax */
+} gsl_spmatrix_sell;
+
+gsl_spmatrix_sell * gsl_spmatrix_sell_compress (const gsl_spmatrix * A, const size_t C,
+                                                const size_t sigma);
+void gsl_spmatrix_sell_free (gsl_spmatrix_sell * m);
+
+__END_DECLS
+
+#endif /* __GSL_SPMATRIX_SELL_H__ */
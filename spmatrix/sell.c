@@ -0,0 +1,225 @@
+/* spmatrix/sell.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+
+typedef struct
+{
+  int len;
+  int row;
+} sell_row;
+
+static int sell_compare (const void * a, const void * b);
+
+/*
+gsl_spmatrix_sell_compress()
+  Create a sparse matrix in sliced ELLPACK format (SELL-C-sigma)
+
+Inputs: A     - sparse matrix in CSR format, as made by gsl_spmatrix_compress
+        C     - number of rows in a slice
+        sigma - number of rows in a sorting window; sigma = 1 keeps
+                the rows in their original order
+
+Return: pointer to new matrix (should be freed with gsl_spmatrix_sell_free)
+
+Notes: the rows are sorted by decreasing number of elements within
+windows of sigma rows, so that the rows of a slice have about the same
+length and the slice needs little padding. A window larger than C
+reduces the padding further, at the cost of less locality in y.
+*/
+
+gsl_spmatrix_sell *
+gsl_spmatrix_sell_compress (const gsl_spmatrix * A, const size_t C, const size_t sigma)
+{
+  if (!GSL_SPMATRIX_ISCSR(A))
+    {
+      GSL_ERROR_NULL ("input matrix must be in CSR format", GSL_EINVAL);
+    }
+  else if (C == 0)
+    {
+      GSL_ERROR_NULL ("slice height C must be positive", GSL_EINVAL);
+    }
+  else if (sigma == 0)
+    {
+      GSL_ERROR_NULL ("sorting window sigma must be positive", GSL_EINVAL);
+    }
+  else
+    {
+      const size_t M = A->size1;
+      const int *Ap = A->p;
+      const int *Aj = A->i;
+      const double *Ad = A->data;
+      gsl_spmatrix_sell *m;
+      sell_row *rows;
+      size_t r, s;
+
+      m = calloc (1, sizeof (gsl_spmatrix_sell));
+      if (!m)
+        {
+          GSL_ERROR_NULL ("failed to allocate space for spmatrix_sell struct",
+                          GSL_ENOMEM);
+        }
+
+      m->size1 = M;
+      m->size2 = A->size2;
+      m->C = C;
+      m->sigma = sigma;
+      m->nslices = (M + C - 1) / C;
+      m->nz = A->nz;
+
+      m->slice = malloc ((m->nslices + 1) * sizeof (size_t));
+      m->perm = malloc (M * sizeof (int));
+      m->len = malloc (M * sizeof (int));
+      rows = malloc (M * sizeof (sell_row));
+      if (!m->slice || !m->perm || !m->len || !rows)
+        {
+          free (rows);
+          gsl_spmatrix_sell_free (m);
+          GSL_ERROR_NULL ("failed to allocate space for slices", GSL_ENOMEM);
+        }
+
+      /* sort the rows by decreasing length within each window */
+      for (r = 0; r < M; ++r)
+        {
+          rows[r].len = Ap[r + 1] - Ap[r];
+          rows[r].row = (int) r;
+        }
+
+      if (sigma > 1)
+        {
+          for (r = 0; r < M; r += sigma)
+            {
+              const size_t n = GSL_MIN (sigma, M - r);
+              qsort (rows + r, n, sizeof (sell_row), sell_compare);
+            }
+        }
+
+      for (r = 0; r < M; ++r)
+        {
+          m->perm[r] = rows[r].row;
+          m->len[r] = rows[r].len;
+        }
+
+      free (rows);
+
+      /* each slice is as wide as its longest row */
+      m->slice[0] = 0;
+      for (s = 0; s < m->nslices; ++s)
+        {
+          const size_t r1 = GSL_MIN ((s + 1) * C, M);
+          int width = 0;
+
+          for (r = s * C; r < r1; ++r)
+            width = GSL_MAX (width, m->len[r]);
+
+          m->slice[s + 1] = m->slice[s] + C * (size_t) width;
+        }
+
+      m->nzmax = m->slice[m->nslices];
+
+      /* allocate at least one element so that an empty matrix is valid */
+      m->col = malloc (GSL_MAX (m->nzmax, 1) * sizeof (int));
+      m->data = malloc (GSL_MAX (m->nzmax, 1) * sizeof (double));
+      if (!m->col || !m->data)
+        {
+          gsl_spmatrix_sell_free (m);
+          GSL_ERROR_NULL ("failed to allocate space for data", GSL_ENOMEM);
+        }
+
+      /* store the slices by columns, padding the rows with zeros */
+      for (s = 0; s < m->nslices; ++s)
+        {
+          const size_t width = (m->slice[s + 1] - m->slice[s]) / C;
+          size_t q, k;
+
+          for (q = 0; q < C; ++q)
+            {
+              int *col = m->col + m->slice[s] + q;
+              double *data = m->data + m->slice[s] + q;
+              size_t n = 0;
+              int pad = 0;
+
+              r = s * C + q;
+
+              if (r < M)
+                {
+                  const int p = Ap[m->perm[r]];
+
+                  n = (size_t) m->len[r];
+                  for (k = 0; k < n; ++k)
+                    {
+                      col[k * C] = Aj[p + k];
+                      data[k * C] = Ad[p + k];
+                    }
+
+                  if (n > 0)
+                    pad = Aj[p + n - 1];
+                }
+
+              for (k = n; k < width; ++k)
+                {
+                  col[k * C] = pad;
+                  data[k * C] = 0.0;
+                }
+            }
+        }
+
+      return m;
+    }
+}
+
+void
+gsl_spmatrix_sell_free (gsl_spmatrix_sell * m)
+{
+  RETURN_IF_NULL (m);
+
+  if (m->slice)
+    free (m->slice);
+
+  if (m->perm)
+    free (m->perm);
+
+  if (m->len)
+    free (m->len);
+
+  if (m->col)
+    free (m->col);
+
+  if (m->data)
+    free (m->data);
+
+  free (m);
+}
+
+/* decreasing length, then increasing row */
+static int
+sell_compare (const void * a, const void * b)
+{
+  const sell_row *ra = (const sell_row *) a;
+  const sell_row *rb = (const sell_row *) b;
+
+  if (ra->len != rb->len)
+    return (ra->len > rb->len) ? -1 : 1;
+
+  return (ra->row > rb->row) - (ra->row < rb->row);
+}
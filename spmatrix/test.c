@@ -113,6 +113,128 @@ int status = 0;
 #include "templates_off.h"
 #undef  BASE_CHAR
 
+/* random M-by-N matrix in CSR format */
+static gsl_spmatrix *
+test_random_csr (const size_t M, const size_t N, const double density,
+                 const gsl_rng * r)
+{
+  gsl_spmatrix *T = gsl_spmatrix_alloc (M, N);
+  gsl_spmatrix *A;
+  size_t i, j;
+
+  for (i = 0; i < M; ++i)
+    {
+      for (j = 0; j < N; ++j)
+        {
+          if (gsl_rng_uniform (r) < density)
+            gsl_spmatrix_set (T, i, j, gsl_rng_uniform (r) + 1.0);
+        }
+    }
+
+  A = gsl_spmatrix_compress (T, GSL_SPMATRIX_CSR);
+  gsl_spmatrix_free (T);
+
+  return A;
+}
+
+static void
+test_sell (const size_t M, const size_t N, const double density,
+           const size_t C, const size_t sigma, const gsl_rng * r)
+{
+  gsl_spmatrix *A = test_random_csr (M, N, density, r);
+  gsl_spmatrix_sell *S = gsl_spmatrix_sell_compress (A, C, sigma);
+  int *seen = calloc (M, sizeof (int));
+  int s_perm = 0, s_sort = 0, s_data = 0;
+  size_t nz = 0;
+  size_t i, k;
+
+  gsl_test_int (S->nslices, (M + C - 1) / C, "sell M=%zu C=%zu nslices", M, C);
+
+  for (i = 0; i < M; ++i)
+    {
+      const size_t s = i / C, q = i % C;
+      const size_t width = (S->slice[s + 1] - S->slice[s]) / C;
+      const int row = S->perm[i];
+
+      if (row < 0 || row >= (int) M || seen[row]++)
+        s_perm = 1;
+      else if (S->len[i] != A->p[row + 1] - A->p[row])
+        s_perm = 1;
+
+      /* rows are sorted by decreasing length within each window */
+      if (i % sigma != 0 && S->len[i] > S->len[i - 1])
+        s_sort = 1;
+
+      for (k = 0; k < width; ++k)
+        {
+          const size_t idx = S->slice[s] + k * C + q;
+
+          if ((int) k < S->len[i])
+            s_data |= (S->data[idx] != gsl_spmatrix_get (A, row, S->col[idx]));
+          else
+            s_data |= (S->data[idx] != 0.0);
+        }
+
+      nz += S->len[i];
+    }
+
+  gsl_test (s_perm, "sell M=%zu N=%zu C=%zu sigma=%zu permutation", M, N, C, sigma);
+  gsl_test (s_sort, "sell M=%zu N=%zu C=%zu sigma=%zu sorting", M, N, C, sigma);
+  gsl_test (s_data, "sell M=%zu N=%zu C=%zu sigma=%zu elements", M, N, C, sigma);
+  gsl_test_int (nz, A->nz, "sell M=%zu N=%zu C=%zu sigma=%zu nz", M, N, C, sigma);
+
+  free (seen);
+  gsl_spmatrix_sell_free (S);
+  gsl_spmatrix_free (A);
+}
+
+static void
+test_bsr (const size_t M, const size_t N, const double density,
+          const size_t b, const gsl_rng * r)
+{
+  gsl_spmatrix *A = test_random_csr (M, N, density, r);
+  gsl_spmatrix_bsr *B = gsl_spmatrix_bsr_compress (A, b);
+  int s_order = 0, s_data = 0;
+  size_t nz = 0;
+  size_t I, ii, jj;
+  int k;
+
+  for (I = 0; I < B->nbrows; ++I)
+    {
+      for (k = B->p[I]; k < B->p[I + 1]; ++k)
+        {
+          const size_t J = B->j[k];
+          const double *blk = B->data + k * b * b;
+
+          if (k > B->p[I] && B->j[k] <= B->j[k - 1])
+            s_order = 1;
+
+          for (jj = 0; jj < b; ++jj)
+            {
+              for (ii = 0; ii < b; ++ii)
+                {
+                  const size_t row = I * b + ii, col = J * b + jj;
+                  const double a = blk[jj * b + ii];
+
+                  if (row < M && col < N)
+                    s_data |= (a != gsl_spmatrix_get (A, row, col));
+                  else
+                    s_data |= (a != 0.0);
+
+                  nz += (a != 0.0);
+                }
+            }
+        }
+    }
+
+  gsl_test (s_order, "bsr M=%zu N=%zu b=%zu block columns", M, N, b);
+  gsl_test (s_data, "bsr M=%zu N=%zu b=%zu elements", M, N, b);
+  gsl_test_int (nz, A->nz, "bsr M=%zu N=%zu b=%zu nz", M, N, b);
+
+  gsl_spmatrix_bsr_free (B);
+  gsl_spmatrix_free (A);
+}
+
 int
 main (void)
 {
@@ -140,6 +262,15 @@ main (void)
       test_complex_all (M[i], N[i], density[i], r);
       test_complex_float_all (M[i], N[i], density[i], r);
       test_complex_long_double_all (M[i], N[i], density[i], r);
+
+      test_sell (M[i], N[i], density[i], 1, 1, r);
+      test_sell (M[i], N[i], density[i], 4, 4, r);
+      test_sell (M[i], N[i], density[i], 8, 32, r);
+      test_sell (M[i], N[i], density[i], 6, 5, r);
+
+      test_bsr (M[i], N[i], density[i], 1, r);
+      test_bsr (M[i], N[i], density[i], 3, r);
+      test_bsr (M[i], N[i], density[i], 8, r);
     }
 
   gsl_rng_free(r);
@@ -0,0 +1,48 @@
+/* sys/gsl_thread_pool.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_THREAD_POOL_H__
+#define __GSL_THREAD_POOL_H__
+
+#include <stdlib.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* pool of threads for the parallel linalg and spblas routines */
+
+typedef struct gsl_thread_pool_struct gsl_thread_pool;
+
+gsl_thread_pool * gsl_thread_pool_alloc (const size_t nthreads);
+void gsl_thread_pool_free (gsl_thread_pool * pool);
+size_t gsl_thread_pool_nthreads (const gsl_thread_pool * pool);
+int gsl_thread_pool_in_worker (void);
+
+__END_DECLS
+
+#endif /* __GSL_THREAD_POOL_H__ */
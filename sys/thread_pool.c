@@ -0,0 +1,587 @@
+/* sys/thread_pool.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * A pool of threads for the parallel linalg and spblas routines.
+ *
+ * The pool has nthreads - 1 worker threads, created when the pool is
+ * allocated; the thread which submits a job takes part in it as well.
+ * A job is a set of independent tasks numbered 0..ntasks-1, handed out
+ * one at a time under the pool lock.
+ *
+ * Only one job runs on a pool at a time. A job submitted while the
+ * pool is busy, by another thread or by a task of the running job, is
+ * run serially by the submitting thread.
+ *
+ * The threads running the tasks of a parallel job are marked with a
+ * thread-specific flag, which gsl_thread_pool_in_worker reports. The
+ * thread pool of the CBLAS library checks it, so that the Level 3
+ * routines called from these tasks do not start threads of their own.
+ *
+ * Without POSIX threads the pool runs every job serially.
+ *
+ * Task graphs are executed by running one scheduling loop per thread of
+ * the pool as the tasks of a job. Each loop owns a deque of ready tasks:
+ * it takes its most recently readied task first, which keeps the data of
+ * a completed task in its cache for the tasks it enables, and when its
+ * deque is empty it steals the oldest ready task of another loop. The
+ * successors of a task are readied in the order in which their edges
+ * were added, so that the first one is run next by the same thread;
+ * callers add the edges of critical path tasks first.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_thread_pool.h>
+
+#include "thread_pool.h"
+
+#ifdef HAVE_PTHREAD
+
+#include <pthread.h>
+
+struct gsl_thread_pool_struct
+{
+  size_t nthreads;
+  size_t nworkers;              /* worker threads created */
+  pthread_t *workers;
+  pthread_mutex_t lock;
+  pthread_cond_t wake;
+  pthread_cond_t done;
+  unsigned long generation;     /* incremented for each job */
+  int shutdown;
+  int busy;
+
+  /* current job, protected by lock */
+  thread_pool_task task;
+  void *arg;
+  size_t ntasks;
+  size_t next;
+  size_t finished;
+};
+
+static pthread_once_t worker_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t worker_key;
+
+static void
+worker_key_create (void)
+{
+  pthread_key_create (&worker_key, NULL);
+}
+
+int
+gsl_thread_pool_in_worker (void)
+{
+  pthread_once (&worker_key_once, worker_key_create);
+  return pthread_getspecific (worker_key) != NULL;
+}
+
+/* execute tasks of the current job until none are left; called and
+   returns with the lock held */
+static void
+pool_run_tasks (gsl_thread_pool * pool)
+{
+  static int marker;
+  void *outer;
+
+  pthread_once (&worker_key_once, worker_key_create);
+  outer = pthread_getspecific (worker_key);
+
+  while (pool->next < pool->ntasks)
+    {
+      const size_t t = pool->next++;
+
+      pthread_mutex_unlock (&pool->lock);
+
+      pthread_setspecific (worker_key, &marker);
+      pool->task (pool->arg, t);
+      pthread_setspecific (worker_key, outer);
+
+      pthread_mutex_lock (&pool->lock);
+
+      if (++pool->finished == pool->ntasks)
+        pthread_cond_signal (&pool->done);
+    }
+}
+
+static void *
+pool_worker (void *arg)
+{
+  gsl_thread_pool *pool = (gsl_thread_pool *) arg;
+  unsigned long seen;
+
+  pthread_mutex_lock (&pool->lock);
+  seen = pool->generation;
+
+  for (;;)
+    {
+      while (pool->generation == seen && !pool->shutdown)
+        pthread_cond_wait (&pool->wake, &pool->lock);
+
+      if (pool->shutdown)
+        break;
+
+      seen = pool->generation;
+      pool_run_tasks (pool);
+    }
+
+  pthread_mutex_unlock (&pool->lock);
+
+  return NULL;
+}
+
+gsl_thread_pool *
+gsl_thread_pool_alloc (const size_t nthreads)
+{
+  gsl_thread_pool *pool;
+
+  if (nthreads == 0)
+    {
+      GSL_ERROR_NULL ("number of threads must be positive", GSL_EINVAL);
+    }
+
+  pool = calloc (1, sizeof (gsl_thread_pool));
+
+  if (pool == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate pool", GSL_ENOMEM);
+    }
+
+  pool->workers = malloc (nthreads * sizeof (pthread_t));
+
+  if (pool->workers == NULL)
+    {
+      free (pool);
+      GSL_ERROR_NULL ("failed to allocate pool threads", GSL_ENOMEM);
+    }
+
+  pthread_mutex_init (&pool->lock, NULL);
+  pthread_cond_init (&pool->wake, NULL);
+  pthread_cond_init (&pool->done, NULL);
+
+  while (pool->nworkers < nthreads - 1)
+    {
+      if (pthread_create (&pool->workers[pool->nworkers], NULL, pool_worker, pool) != 0)
+        break;              /* run with the threads we have */
+
+      pool->nworkers++;
+    }
+
+  pool->nthreads = pool->nworkers + 1;
+
+  return pool;
+}
+
+void
+gsl_thread_pool_free (gsl_thread_pool * pool)
+{
+  size_t i;
+
+  RETURN_IF_NULL (pool);
+
+  pthread_mutex_lock (&pool->lock);
+  pool->shutdown = 1;
+  pthread_cond_broadcast (&pool->wake);
+  pthread_mutex_unlock (&pool->lock);
+
+  for (i = 0; i < pool->nworkers; i++)
+    pthread_join (pool->workers[i], NULL);
+
+  pthread_cond_destroy (&pool->done);
+  pthread_cond_destroy (&pool->wake);
+  pthread_mutex_destroy (&pool->lock);
+
+  free (pool->workers);
+  free (pool);
+}
+
+void
+thread_pool_run (gsl_thread_pool * pool, const size_t ntasks,
+                 thread_pool_task task, void *arg)
+{
+  size_t t;
+
+  if (pool != NULL && pool->nthreads > 1 && ntasks > 1)
+    {
+      pthread_mutex_lock (&pool->lock);
+
+      if (!pool->busy)
+        {
+          pool->busy = 1;
+          pool->task = task;
+          pool->arg = arg;
+          pool->ntasks = ntasks;
+          pool->next = 0;
+          pool->finished = 0;
+          pool->generation++;
+          pthread_cond_broadcast (&pool->wake);
+
+          pool_run_tasks (pool);
+
+          while (pool->finished < pool->ntasks)
+            pthread_cond_wait (&pool->done, &pool->lock);
+
+          pool->busy = 0;
+          pthread_mutex_unlock (&pool->lock);
+          return;
+        }
+
+      pthread_mutex_unlock (&pool->lock);
+    }
+
+  for (t = 0; t < ntasks; t++)
+    task (arg, t);
+}
+
+#else /* !HAVE_PTHREAD */
+
+struct gsl_thread_pool_struct
+{
+  size_t nthreads;
+};
+
+gsl_thread_pool *
+gsl_thread_pool_alloc (const size_t nthreads)
+{
+  gsl_thread_pool *pool;
+
+  if (nthreads == 0)
+    {
+      GSL_ERROR_NULL ("number of threads must be positive", GSL_EINVAL);
+    }
+
+  pool = malloc (sizeof (gsl_thread_pool));
+
+  if (pool == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate pool", GSL_ENOMEM);
+    }
+
+  pool->nthreads = 1;
+
+  return pool;
+}
+
+void
+gsl_thread_pool_free (gsl_thread_pool * pool)
+{
+  RETURN_IF_NULL (pool);
+  free (pool);
+}
+
+int
+gsl_thread_pool_in_worker (void)
+{
+  return 0;
+}
+
+void
+thread_pool_run (gsl_thread_pool * pool, const size_t ntasks,
+                 thread_pool_task task, void *arg)
+{
+  size_t t;
+
+  (void) pool;
+
+  for (t = 0; t < ntasks; t++)
+    task (arg, t);
+}
+
+#endif /* HAVE_PTHREAD */
+
+size_t
+gsl_thread_pool_nthreads (const gsl_thread_pool * pool)
+{
+  return pool->nthreads;
+}
+
+struct thread_dag_struct
+{
+  size_t ntasks;
+  size_t nedges;
+  size_t max_edges;
+  size_t *from;
+  size_t *to;
+  int overflow;
+};
+
+typedef struct
+{
+  thread_dag_task task;
+  void *arg;
+  size_t ntasks;
+  size_t nthreads;
+  size_t *succ_ptr;     /* successors of task i are succ[succ_ptr[i]..succ_ptr[i+1]) */
+  size_t *succ;
+  size_t *npred;        /* predecessors not yet completed */
+  size_t *deque;        /* ready tasks of thread t in deque[t*ntasks + head[t]..tail[t]) */
+  size_t *head;
+  size_t *tail;
+  size_t ndone;
+  int status;
+#ifdef HAVE_PTHREAD
+  pthread_mutex_t lock;
+  pthread_cond_t ready;
+#endif
+} dag_exec;
+
+#ifdef HAVE_PTHREAD
+#define DAG_LOCK(e) pthread_mutex_lock (&(e)->lock)
+#define DAG_UNLOCK(e) pthread_mutex_unlock (&(e)->lock)
+#define DAG_WAIT(e) pthread_cond_wait (&(e)->ready, &(e)->lock)
+#define DAG_BROADCAST(e) pthread_cond_broadcast (&(e)->ready)
+#else
+#define DAG_LOCK(e)
+#define DAG_UNLOCK(e)
+#define DAG_WAIT(e)
+#define DAG_BROADCAST(e)
+#endif
+
+thread_dag *
+thread_dag_alloc (const size_t ntasks, const size_t nedges)
+{
+  thread_dag *dag = calloc (1, sizeof (thread_dag));
+
+  if (dag == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate task graph", GSL_ENOMEM);
+    }
+
+  dag->from = malloc ((nedges + 1) * sizeof (size_t));
+  dag->to = malloc ((nedges + 1) * sizeof (size_t));
+
+  if (dag->from == NULL || dag->to == NULL)
+    {
+      thread_dag_free (dag);
+      GSL_ERROR_NULL ("failed to allocate task graph edges", GSL_ENOMEM);
+    }
+
+  dag->ntasks = ntasks;
+  dag->max_edges = nedges;
+
+  return dag;
+}
+
+void
+thread_dag_free (thread_dag * dag)
+{
+  RETURN_IF_NULL (dag);
+
+  if (dag->from)
+    free (dag->from);
+
+  if (dag->to)
+    free (dag->to);
+
+  free (dag);
+}
+
+/* task 'to' depends on task 'from' */
+void
+thread_dag_edge (thread_dag * dag, const size_t from, const size_t to)
+{
+  if (dag->nedges < dag->max_edges && from < to && to < dag->ntasks)
+    {
+      dag->from[dag->nedges] = from;
+      dag->to[dag->nedges] = to;
+      dag->nedges++;
+    }
+  else
+    {
+      /* edges must point forward, so that the graph is acyclic */
+      dag->overflow = 1;
+    }
+}
+
+/* number of threads which may execute tasks of a graph run on pool */
+size_t
+thread_dag_nthreads (const gsl_thread_pool * pool)
+{
+  return (pool == NULL) ? 1 : pool->nthreads;
+}
+
+/* scheduling loop of thread t */
+static void
+dag_loop (void *arg, const size_t t)
+{
+  dag_exec *e = (dag_exec *) arg;
+  size_t *own = e->deque + t * e->ntasks;
+
+  DAG_LOCK (e);
+
+  while (e->ndone < e->ntasks && e->status == GSL_SUCCESS)
+    {
+      size_t id = e->ntasks;
+      size_t u, k;
+      int status;
+
+      if (e->tail[t] > e->head[t])
+        {
+          id = own[--e->tail[t]];
+        }
+      else
+        {
+          for (k = 1; k < e->nthreads; k++)
+            {
+              u = (t + k) % e->nthreads;
+
+              if (e->tail[u] > e->head[u])
+                {
+                  id = e->deque[u * e->ntasks + e->head[u]++];
+                  break;
+                }
+            }
+        }
+
+      if (id == e->ntasks)
+        {
+          /* nothing is ready: another thread is running a task */
+          DAG_WAIT (e);
+          continue;
+        }
+
+      DAG_UNLOCK (e);
+      status = e->task (e->arg, id, t);
+      DAG_LOCK (e);
+
+      if (status)
+        {
+          if (e->status == GSL_SUCCESS)
+            e->status = status;
+
+          DAG_BROADCAST (e);
+          break;
+        }
+
+      /* ready the successors, the first one on top of the deque */
+      for (k = e->succ_ptr[id + 1]; k > e->succ_ptr[id]; k--)
+        {
+          const size_t s = e->succ[k - 1];
+
+          if (--e->npred[s] == 0)
+            {
+              if (e->tail[t] == e->ntasks)
+                {
+                  /* compact the deque */
+                  memmove (own, own + e->head[t], (e->tail[t] - e->head[t]) * sizeof (size_t));
+                  e->tail[t] -= e->head[t];
+                  e->head[t] = 0;
+                }
+
+              own[e->tail[t]++] = s;
+            }
+        }
+
+      if (++e->ndone == e->ntasks || e->tail[t] - e->head[t] > 1)
+        DAG_BROADCAST (e);
+    }
+
+  DAG_UNLOCK (e);
+}
+
+int
+thread_dag_run (gsl_thread_pool * pool, thread_dag * dag,
+                thread_dag_task task, void *arg)
+{
+  const size_t ntasks = dag->ntasks;
+  const size_t nthreads = thread_dag_nthreads (pool);
+  dag_exec e;
+  size_t i;
+
+  if (dag->overflow)
+    {
+      GSL_ERROR ("invalid task graph", GSL_ESANITY);
+    }
+
+  if (ntasks == 0)
+    return GSL_SUCCESS;
+
+  e.task = task;
+  e.arg = arg;
+  e.ntasks = ntasks;
+  e.nthreads = nthreads;
+  e.ndone = 0;
+  e.status = GSL_SUCCESS;
+  e.succ_ptr = calloc (ntasks + 1, sizeof (size_t));
+  e.succ = malloc ((dag->nedges + 1) * sizeof (size_t));
+  e.npred = calloc (ntasks, sizeof (size_t));
+  e.deque = malloc (nthreads * ntasks * sizeof (size_t));
+  e.head = calloc (nthreads, sizeof (size_t));
+  e.tail = calloc (nthreads, sizeof (size_t));
+
+  if (e.succ_ptr == NULL || e.succ == NULL || e.npred == NULL ||
+      e.deque == NULL || e.head == NULL || e.tail == NULL)
+    {
+      free (e.succ_ptr);
+      free (e.succ);
+      free (e.npred);
+      free (e.deque);
+      free (e.head);
+      free (e.tail);
+      GSL_ERROR ("failed to allocate task graph workspace", GSL_ENOMEM);
+    }
+
+  /* successor lists, in the order the edges were added */
+  for (i = 0; i < dag->nedges; i++)
+    {
+      e.succ_ptr[dag->from[i] + 1]++;
+      e.npred[dag->to[i]]++;
+    }
+
+  for (i = 0; i < ntasks; i++)
+    e.succ_ptr[i + 1] += e.succ_ptr[i];
+
+  for (i = 0; i < dag->nedges; i++)
+    e.succ[e.succ_ptr[dag->from[i]]++] = dag->to[i];
+
+  for (i = ntasks; i > 0; i--)
+    e.succ_ptr[i] = e.succ_ptr[i - 1];
+
+  e.succ_ptr[0] = 0;
+
+  /* tasks without predecessors start on thread 0, lowest index on top */
+  for (i = ntasks; i > 0; i--)
+    {
+      if (e.npred[i - 1] == 0)
+        e.deque[e.tail[0]++] = i - 1;
+    }
+
+#ifdef HAVE_PTHREAD
+  pthread_mutex_init (&e.lock, NULL);
+  pthread_cond_init (&e.ready, NULL);
+#endif
+
+  thread_pool_run (pool, nthreads, dag_loop, &e);
+
+#ifdef HAVE_PTHREAD
+  pthread_cond_destroy (&e.ready);
+  pthread_mutex_destroy (&e.lock);
+#endif
+
+  free (e.succ_ptr);
+  free (e.succ);
+  free (e.npred);
+  free (e.deque);
+  free (e.head);
+  free (e.tail);
+
+  return e.status;
+}
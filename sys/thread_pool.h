@@ -0,0 +1,57 @@
+/* sys/thread_pool.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_THREAD_POOL_INTERNAL_H__
+#define __GSL_THREAD_POOL_INTERNAL_H__
+
+/* Internal interface of the thread pool (thread_pool.c) */
+
+typedef void (*thread_pool_task) (void *arg, const size_t task);
+
+/* run task(arg, t) for t = 0, ..., ntasks - 1 on the threads of the
+   pool, and return when all tasks are complete. The tasks are run
+   serially by the calling thread if pool is NULL, or if the pool is
+   already running a job */
+void thread_pool_run (gsl_thread_pool * pool, const size_t ntasks,
+                      thread_pool_task task, void *arg);
+
+/*
+ * Task graphs: tasks numbered 0..ntasks-1 with dependencies added by
+ * thread_dag_edge(). thread_dag_run() executes each task once
+ * all of its predecessors have completed, passing the index of the
+ * executing thread (0 <= thread < thread_dag_nthreads(pool)) so
+ * that tasks can use per-thread workspace. A task returning a nonzero
+ * status stops the scheduling of further tasks, and the status of the
+ * failed task is returned. The task functions must not call the GSL
+ * error handler.
+ */
+
+typedef int (*thread_dag_task) (void *arg, const size_t task,
+                                const size_t thread);
+
+typedef struct thread_dag_struct thread_dag;
+
+thread_dag * thread_dag_alloc (const size_t ntasks, const size_t nedges);
+void thread_dag_free (thread_dag * dag);
+void thread_dag_edge (thread_dag * dag, const size_t from, const size_t to);
+size_t thread_dag_nthreads (const gsl_thread_pool * pool);
+int thread_dag_run (gsl_thread_pool * pool, thread_dag * dag,
+                    thread_dag_task task, void *arg);
+
+#endif /* __GSL_THREAD_POOL_INTERNAL_H__ */